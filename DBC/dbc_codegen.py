@@ -0,0 +1,488 @@
+#!/usr/bin/env python3
+"""Generate C code for the CAN signals defined in Lunar_CAN_Messages.dbc.
+
+The generated header holds a pack and an unpack function for each message and
+one set of conversion functions for each scaled signal.  Packing follows the
+bit layout of the DBC (start bit, length, Intel or Motorola byte order, sign)
+with fixed shifts and masks, so it does not depend on the layout of the C
+structures.  Value tables become enumerations.
+
+The conversions use single-precision floats or 32-bit integers, so no
+double-precision arithmetic is pulled into the firmware.  Every conversion to
+a raw value is clamped to the signal range given in the DBC.
+
+Usage:
+    python3 DBC/dbc_codegen.py DBC/Lunar_CAN_Messages.dbc \\
+        Src/Boards/XMC4800_AWS/ReportMgr_CANSignals.h \\
+        Src/Boards/XMC4400_Platform2Go/ReportMgr_CANSignals.h \\
+        Src/Boards/XMC1400_Boot_Kit/ReportMgr_CANSignals.h
+"""
+
+import re
+import sys
+from fractions import Fraction
+
+# Matches: BO_ <id> <name>: <dlc> <sender>
+MESSAGE_PATTERN = re.compile(r"^BO_\s+(\d+)\s+(\w+)\s*:\s*(\d+)\s+(\w+)")
+
+# Matches: SG_ <name> : <start>|<length>@<order><sign> (<factor>,<offset>) [<min>|<max>] "<unit>" <receivers>
+SIGNAL_PATTERN = re.compile(
+    r"^\s*SG_\s+(\w+)\s*:\s*(\d+)\|(\d+)@([01])([+-])\s*"
+    r"\(([^,]+),([^)]+)\)\s*\[([^|]+)\|([^\]]+)\]\s*\"([^\"]*)\"")
+
+# Matches: VAL_TABLE_ <name> <value> "<label>" ... ;
+VALUE_TABLE_PATTERN = re.compile(r"^VAL_TABLE_\s+(\w+)\s+(.*);")
+
+# Matches: VAL_ <id> <signal> <value> "<label>" ... ;
+SIGNAL_VALUES_PATTERN = re.compile(r"^VAL_\s+(\d+)\s+(\w+)\s+(.*);")
+
+# Matches a single <value> "<label>" pair of a value table
+VALUE_PATTERN = re.compile(r"(-?\d+)\s+\"([^\"]*)\"")
+
+# Extended identifiers are flagged with bit 31 in the DBC
+DBC_EXTENDED_ID_FLAG = 0x80000000
+
+# Conversions to and from milli-units are generated with this scale
+MILLI_SCALE = 1000
+
+
+class Signal:
+    """A single signal of a CAN message."""
+
+    def __init__(self, match):
+        self.name = match.group(1)
+        self.start_bit = int(match.group(2))
+        self.length = int(match.group(3))
+        self.little_endian = match.group(4) == "1"
+        self.is_signed = match.group(5) == "-"
+        # Fractions keep the decimal factors exact, 0.01 stays 1/100
+        self.factor = Fraction(match.group(6).strip())
+        self.offset = Fraction(match.group(7).strip())
+        self.minimum = Fraction(match.group(8).strip())
+        self.maximum = Fraction(match.group(9).strip())
+        self.unit = match.group(10)
+
+    def is_scaled(self):
+        """Signals without a factor or offset need no conversion."""
+        return (self.factor != 1) or (self.offset != 0)
+
+    def raw_limits(self):
+        """The raw values allowed by the bit length of the signal."""
+        if self.is_signed:
+            return -(1 << (self.length - 1)), (1 << (self.length - 1)) - 1
+        return 0, (1 << self.length) - 1
+
+    def raw_range(self):
+        """The raw values allowed by both the DBC range and the bit length."""
+        low, high = self.raw_limits()
+        raw_min = round((self.minimum - self.offset) / self.factor)
+        raw_max = round((self.maximum - self.offset) / self.factor)
+        if raw_min > raw_max:
+            raw_min, raw_max = raw_max, raw_min
+        return max(low, raw_min), min(high, raw_max)
+
+    def raw_bits(self):
+        """The number of bits needed to store the raw range."""
+        raw_min, raw_max = self.raw_range()
+        if raw_min < 0:
+            return max((-raw_min - 1).bit_length(), raw_max.bit_length()) + 1
+        return max(raw_max.bit_length(), 1)
+
+    def raw_width(self):
+        """The width of the unsigned integer used while packing."""
+        return 32 if self.length <= 32 else 64
+
+    def bit_segments(self):
+        """Split the signal into runs of bits that share a byte of the frame.
+
+        Each run is (byte, first bit in the byte, number of bits, first bit in
+        the raw value).  Intel signals start at their least significant bit,
+        Motorola signals start at their most significant bit and continue with
+        the next byte once bit 0 of a byte has been used.
+        """
+        positions = []
+        if self.little_endian:
+            for value_bit in range(self.length):
+                position = self.start_bit + value_bit
+                positions.append((position // 8, position % 8, value_bit))
+        else:
+            position = self.start_bit
+            for value_bit in range(self.length - 1, -1, -1):
+                positions.append((position // 8, position % 8, value_bit))
+                position = position + 15 if (position % 8) == 0 else position - 1
+
+        segments = []
+        for byte, bit, value_bit in sorted(positions, key=lambda item: item[2]):
+            if segments:
+                last_byte, last_bit, width, value_shift = segments[-1]
+                if (byte == last_byte) and (bit == last_bit + width) and (value_bit == value_shift + width):
+                    segments[-1] = (last_byte, last_bit, width + 1, value_shift)
+                    continue
+            segments.append((byte, bit, 1, value_bit))
+        return segments
+
+    def c_type(self):
+        """The smallest C type that holds a raw value."""
+        for bits in (8, 16, 32):
+            if self.length <= bits:
+                return ("int%d_t" if self.is_signed else "uint%d_t") % bits
+        return "int64_t" if self.is_signed else "uint64_t"
+
+
+class Message:
+    """A CAN message and its signals."""
+
+    def __init__(self, match):
+        dbc_id = int(match.group(1))
+        self.can_id = dbc_id & ~DBC_EXTENDED_ID_FLAG
+        self.is_extended = (dbc_id & DBC_EXTENDED_ID_FLAG) != 0
+        self.name = match.group(2)
+        self.dlc = int(match.group(3))
+        self.signals = []
+
+
+def parse_values(text):
+    """Read the value and label pairs of a value table."""
+    values = []
+    for value, label in VALUE_PATTERN.findall(text):
+        label = re.sub(r"\W", "_", label)
+        values.append((int(value), label))
+    return sorted(values)
+
+
+def parse_dbc(path):
+    """Read the messages, signals and value tables of a DBC file."""
+    messages = []
+    value_tables = []
+    with open(path, "r", encoding="latin-1") as dbc_file:
+        for line in dbc_file:
+            line = line.rstrip("\r\n")
+            message_match = MESSAGE_PATTERN.match(line)
+            signal_match = SIGNAL_PATTERN.match(line)
+            table_match = VALUE_TABLE_PATTERN.match(line)
+            values_match = SIGNAL_VALUES_PATTERN.match(line)
+            if message_match:
+                messages.append(Message(message_match))
+            elif signal_match and messages:
+                messages[-1].signals.append(Signal(signal_match))
+            elif table_match:
+                value_tables.append((table_match.group(1), parse_values(table_match.group(2))))
+            elif values_match:
+                # Signal value tables are named after the message and signal
+                can_id = int(values_match.group(1)) & ~DBC_EXTENDED_ID_FLAG
+                for message in messages:
+                    if message.can_id == can_id:
+                        name = "%s_%s" % (message.name, values_match.group(2))
+                        value_tables.append((name, parse_values(values_match.group(3))))
+    return messages, value_tables
+
+
+def format_float(value):
+    """Format an exact fraction as a single-precision C literal."""
+    text = repr(float(value))
+    if "e" not in text and "." not in text:
+        text += ".0"
+    return text + "f"
+
+
+def format_int(value):
+    """Format an integer as a C literal, negative values in parentheses."""
+    return "%d" % value if value >= 0 else "(%d)" % value
+
+
+def emit_clamp(lines, variable, prefix, cast):
+    """Emit the statements that clamp a variable to the raw signal range."""
+    lines.append("   if (%s < %s%s_MinRaw)" % (variable, cast, prefix))
+    lines.append("   {")
+    lines.append("      %s = %s%s_MinRaw;" % (variable, cast, prefix))
+    lines.append("   }")
+    lines.append("   else if (%s > %s%s_MaxRaw)" % (variable, cast, prefix))
+    lines.append("   {")
+    lines.append("      %s = %s%s_MaxRaw;" % (variable, cast, prefix))
+    lines.append("   }")
+
+
+def emit_signal(lines, message, signal):
+    """Emit the range and conversion functions of one signal."""
+    prefix = "%s_%s" % (message.name, signal.name)
+    c_type = signal.c_type()
+    raw_min, raw_max = signal.raw_range()
+    scale = 1 / signal.factor
+
+    # Milli-units: raw = (value - offset * 1000) / (factor * 1000), both integers
+    milli_per_raw = signal.factor * MILLI_SCALE
+    offset_milli = signal.offset * MILLI_SCALE
+
+    lines.append("// signal: @%s  Factor= %s  Offset= %s" % (signal.name, float(signal.factor), float(signal.offset)))
+    lines.append("#define %s_MinRaw %s" % (prefix, format_int(raw_min)))
+    lines.append("#define %s_MaxRaw %s" % (prefix, format_int(raw_max)))
+    lines.append("")
+
+    # Float to raw
+    lines.append("// conversion value to CAN signal, clamped to the signal range")
+    lines.append("static inline %s %s_toS(const float value)" % (c_type, prefix))
+    lines.append("{")
+    if signal.offset > 0:
+        expression = "value - %s" % format_float(signal.offset)
+    elif signal.offset < 0:
+        expression = "value + %s" % format_float(-signal.offset)
+    else:
+        expression = "value"
+    if scale != 1:
+        if signal.offset != 0:
+            expression = "(%s)" % expression
+        expression = "%s * %s" % (expression, format_float(scale))
+    lines.append("   float raw = %s;" % expression)
+    emit_clamp(lines, "raw", prefix, "(float)")
+    lines.append("   return((%s)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));" % c_type)
+    lines.append("}")
+    lines.append("")
+
+    # Milli-units to raw
+    lines.append("// conversion value in milli-units to CAN signal, clamped to the signal range")
+    lines.append("static inline %s %s_toS_Milli(const int32_t value)" % (c_type, prefix))
+    lines.append("{")
+    if (offset_milli.denominator != 1) or (milli_per_raw.denominator != 1):
+        raise ValueError("%s: factor or offset is finer than a milli-unit" % prefix)
+    if offset_milli != 0:
+        operator = "-" if offset_milli > 0 else "+"
+        lines.append("   int32_t raw = value %s %d;" % (operator, abs(int(offset_milli))))
+    else:
+        lines.append("   int32_t raw = value;")
+    if milli_per_raw != 1:
+        divisor = milli_per_raw.numerator
+        half = divisor // 2
+        lines.append("   raw = (raw >= 0) ? ((raw + %d) / %d) : ((raw - %d) / %d);" % (half, divisor, half, divisor))
+    emit_clamp(lines, "raw", prefix, "")
+    lines.append("   return((%s)raw);" % c_type)
+    lines.append("}")
+    lines.append("")
+
+    # Raw to float
+    lines.append("// conversion value from CAN signal")
+    lines.append("static inline float %s_fromS(const int32_t raw)" % prefix)
+    lines.append("{")
+    if signal.factor != 1:
+        expression = "(float)raw * %s" % format_float(signal.factor)
+    else:
+        expression = "(float)raw"
+    if signal.offset != 0:
+        operator = "+" if signal.offset > 0 else "-"
+        expression = "(%s) %s %s" % (expression, operator, format_float(abs(signal.offset)))
+    lines.append("   return(%s);" % expression)
+    lines.append("}")
+    lines.append("")
+
+    # Raw to milli-units
+    lines.append("// conversion value from CAN signal to milli-units")
+    lines.append("static inline int32_t %s_fromS_Milli(const int32_t raw)" % prefix)
+    lines.append("{")
+    if milli_per_raw != 1:
+        product = "raw * %d" % milli_per_raw.numerator
+    else:
+        product = "raw"
+    if offset_milli != 0:
+        operator = "+" if offset_milli > 0 else "-"
+        lines.append("   return((%s) %s %d);" % (product, operator, abs(int(offset_milli))))
+    else:
+        lines.append("   return(%s);" % product)
+    lines.append("}")
+    lines.append("")
+
+
+def emit_value_table(lines, name, values):
+    """Emit an enumeration for a value table."""
+    prefix = name.upper()
+    lines.append("// Value table: %s" % name)
+    lines.append("typedef enum")
+    lines.append("{")
+    for value, label in values:
+        lines.append("   %s_%s = %d," % (prefix, label, value))
+    lines.append("} %s_t;" % name)
+    lines.append("")
+
+
+def pack_term(signal, segment, raw_name):
+    """The expression that places one segment of a raw value in its byte."""
+    byte, bit, width, value_shift = segment
+    suffix = "U" if signal.raw_width() == 32 else "ULL"
+    term = raw_name if value_shift == 0 else "(%s >> %d)" % (raw_name, value_shift)
+    if width < 8:
+        term = "(%s & 0x%X%s)" % (term, (1 << width) - 1, suffix)
+    if bit != 0:
+        term = "(%s << %d)" % (term, bit)
+    return term
+
+
+def unpack_term(signal, segment):
+    """The expression that moves one segment of a byte to its raw value bits."""
+    byte, bit, width, value_shift = segment
+    raw_type = "uint%d_t" % signal.raw_width()
+    term = "(%s)data[%d]" % (raw_type, byte)
+    if bit != 0:
+        term = "(%s >> %d)" % (term, bit)
+    if bit + width < 8:
+        term = "(%s & 0x%XU)" % (term, (1 << width) - 1)
+    if value_shift != 0:
+        term = "(%s << %d)" % (term, value_shift)
+    return term
+
+
+def emit_message_packing(lines, message):
+    """Emit the field checks and the pack and unpack functions of a message."""
+    name = message.name
+    byte_terms = [[] for _ in range(message.dlc)]
+
+    if message.signals:
+        lines.append("// The raw range of every signal must fit in its structure field")
+    for signal in message.signals:
+        lines.append("REPORTMGR_CAN_STATIC_ASSERT(%s_%s_FieldCheck, REPORTMGR_CAN_FIELD_FITS(%s_t, %s, %dU));"
+                     % (name, signal.name, name, signal.name, signal.raw_bits()))
+        for segment in signal.bit_segments():
+            if segment[0] >= message.dlc:
+                raise ValueError("%s_%s: signal does not fit in %d bytes" % (name, signal.name, message.dlc))
+    lines.append("")
+
+    # Pack
+    lines.append("// pack the signals into the CAN frame data, every byte of the frame is written")
+    lines.append("static inline void %s_Pack(uint8_t *const data, const %s_t *const signals)" % (name, name))
+    lines.append("{")
+    for signal in message.signals:
+        raw_name = "raw%s" % signal.name
+        raw_type = "uint%d_t" % signal.raw_width()
+        cast = "(%s)(int%d_t)" % (raw_type, signal.raw_width()) if signal.is_signed else "(%s)" % raw_type
+        lines.append("   const %s %s = %ssignals->%s;" % (raw_type, raw_name, cast, signal.name))
+        for segment in signal.bit_segments():
+            byte_terms[segment[0]].append(pack_term(signal, segment, raw_name))
+    if message.signals:
+        lines.append("")
+    for byte, terms in enumerate(byte_terms):
+        if not terms:
+            lines.append("   data[%d] = 0U;" % byte)
+        elif len(terms) == 1:
+            lines.append("   data[%d] = (uint8_t)%s;" % (byte, terms[0]))
+        else:
+            lines.append("   data[%d] = (uint8_t)(%s);" % (byte, " | ".join(terms)))
+    lines.append("}")
+    lines.append("")
+
+    # Unpack
+    lines.append("// unpack the signals from the CAN frame data")
+    lines.append("static inline void %s_Unpack(%s_t *const signals, const uint8_t *const data)" % (name, name))
+    lines.append("{")
+    for index, signal in enumerate(message.signals):
+        raw_name = "raw%s" % signal.name
+        raw_type = "uint%d_t" % signal.raw_width()
+        suffix = "U" if signal.raw_width() == 32 else "ULL"
+        terms = [unpack_term(signal, segment) for segment in signal.bit_segments()]
+        if index != 0:
+            lines.append("")
+        lines.append("   // %s : %d|%d@%s%s" % (signal.name, signal.start_bit, signal.length,
+                                              "1" if signal.little_endian else "0",
+                                              "-" if signal.is_signed else "+"))
+        if signal.is_signed and signal.length < signal.raw_width():
+            # Sign extend without a branch
+            sign_bit = "0x%X%s" % (1 << (signal.length - 1), suffix)
+            lines.append("   const %s %s = ((%s) ^ %s) - %s;" % (raw_type, raw_name, " | ".join(terms), sign_bit, sign_bit))
+        else:
+            lines.append("   const %s %s = %s;" % (raw_type, raw_name, " | ".join(terms)))
+        if signal.is_signed:
+            lines.append("   signals->%s = (%s)(int%d_t)%s;" % (signal.name, signal.c_type(), signal.raw_width(), raw_name))
+        else:
+            lines.append("   signals->%s = (%s)%s;" % (signal.name, signal.c_type(), raw_name))
+    if not message.signals:
+        lines.append("   (void)signals;")
+        lines.append("   (void)data;")
+    lines.append("}")
+    lines.append("")
+
+
+def generate_header(messages, value_tables, dbc_name):
+    """Build the signal conversion header."""
+    lines = [
+        "/*******************************************************************************",
+        "// Report Manager CAN Signal Packing and Conversions (Autogenerated)",
+        "*******************************************************************************/",
+        "#pragma once",
+        "",
+        "#ifdef __cplusplus",
+        "extern \"C\"",
+        "{",
+        "#endif",
+        "",
+        "/*******************************************************************************",
+        "// Includes",
+        "*******************************************************************************/",
+        "",
+        "// Module Includes",
+        "// Platform Includes",
+        "// Other Includes",
+        "#include <stdint.h>",
+        "",
+        "// NOTE: This file is generated by DBC/dbc_codegen.py from %s, do not edit" % dbc_name,
+        "// It is included at the end of ReportMgr_CAN.h, after the message structures",
+        "",
+        "",
+        "/*******************************************************************************",
+        "// Public Constant Definitions",
+        "*******************************************************************************/",
+        "",
+        "// Compile-time check, a false condition declares an array with a negative size",
+        "#define REPORTMGR_CAN_STATIC_ASSERT(name, condition) typedef char name[(condition) ? 1 : -1]",
+        "",
+        "// true if the structure field is wide enough for the given number of bits",
+        "#define REPORTMGR_CAN_FIELD_FITS(type, field, bits) ((sizeof(((type *)0)->field) * 8U) >= (bits))",
+        "",
+        "",
+        "/*******************************************************************************",
+        "// Public Type Declarations",
+        "*******************************************************************************/",
+        "",
+    ]
+
+    for name, values in value_tables:
+        emit_value_table(lines, name, values)
+
+    lines += [
+        "",
+        "/*******************************************************************************",
+        "// Public Function Implementations",
+        "*******************************************************************************/",
+        "",
+    ]
+
+    for message in messages:
+        lines.append("// %s CAN Message (0x%XU)" % (message.name, message.can_id))
+        lines.append("")
+        emit_message_packing(lines, message)
+        for signal in message.signals:
+            if signal.is_scaled():
+                emit_signal(lines, message, signal)
+
+    lines += [
+        "",
+        "#ifdef __cplusplus",
+        "}",
+        "#endif",
+        "",
+    ]
+    return "\n".join(lines)
+
+
+def main(argv):
+    if len(argv) < 3:
+        print(__doc__)
+        return 1
+
+    dbc_path = argv[1]
+    messages, value_tables = parse_dbc(dbc_path)
+    header = generate_header(messages, value_tables, "DBC/" + dbc_path.replace("\\", "/").split("/")[-1])
+
+    for output_path in argv[2:]:
+        with open(output_path, "w", encoding="ascii", newline="\n") as output_file:
+            output_file.write(header)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,110 @@
+/*******************************************************************************
+// ADC Driver
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "ADC_Drv_Config.h"
+// Platform Includes
+#include "Lunar_MessageRouter.h"
+#include "Platform.h"
+// Other Includes
+#include <stdbool.h>
+#include <stdint.h>
+
+
+/*******************************************************************************
+// Public Type Declarations
+*******************************************************************************/
+
+// A buffer of consecutive scans, each scan holds one result of every channel
+typedef struct
+{
+   // The 12-bit results, indexed by scan and ADC_Drv_Channel_t
+   uint16_t samples[ADC_DRV_SAMPLES_PER_BUFFER][ADC_DRV_CHANNEL_Count];
+} ADC_Drv_Buffer_t;
+
+
+/*******************************************************************************
+// Public Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function initializes the converter and starts the acquisition.
+  *    A timer triggers a scan of all channels at the sample rate and the DMA
+  *    moves each result into one of two buffers.  The CPU is only involved
+  *    once a buffer is full.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void ADC_Drv_Init(void);
+
+/** Description:
+  *    This is the scheduled update function.  It raises the buffer ready
+  *    event once for each buffer the DMA completed since the last call.
+  *    Buffers that completed while an earlier one was not handed over yet
+  *    are counted as overruns.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void ADC_Drv_Update(void);
+
+/** Description:
+  *    This function returns the last buffer completed by the DMA.  The DMA
+  *    fills the other buffer meanwhile, so the samples stay valid for one
+  *    buffer time after the buffer ready event.
+  * Returns:
+  *    const ADC_Drv_Buffer_t * - The completed buffer, NULL before the first
+  *                               buffer is complete
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+const ADC_Drv_Buffer_t *ADC_Drv_GetReadyBuffer(void);
+
+/** Description:
+  *    This function returns the time the last buffer was completed, which is
+  *    the time of its last scan within the interrupt latency.  The time of a
+  *    scan in the buffer follows from the sample rate.
+  * Returns:
+  *    uint32_t - The Timebase_Drv_GetCycleCount value at the end of the buffer
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+uint32_t ADC_Drv_GetReadyBufferTime(void);
+
+
+/*******************************************************************************
+// Message Router Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    Message handler that returns the acquisition counters and the last
+  *    result of each channel.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void ADC_Drv_MessageRouter_GetStatus(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
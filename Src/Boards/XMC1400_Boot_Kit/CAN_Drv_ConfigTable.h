@@ -17,6 +17,10 @@ extern "C"
 #include "CAN_Drv_Config.h" // Defines channel enumeration
 // Platform Includes
 #include "DevicePin_Config.h" // Port/Pin definition
+#include "Lunar_CANTransport_Config.h" // Message Router request identifiers
+#include "Lunar_FwUpdate_Config.h" // Firmware update identifiers
+#include "Lunar_TimeSync_Config.h" // SYNC identifiers
+#include "NodeAddrMgr_Config.h" // Node ID claim identifier
 // Other Includes
 #include "xmc_can.h"
 #include "xmc_gpio.h"
@@ -60,9 +64,35 @@ static const CAN_Drv_ConfigItem_t canConfigTable[CAN_DRV_CHANNEL_Count] =
          .output_level = XMC_GPIO_OUTPUT_LEVEL_HIGH
       },
       .input = XMC_CAN_NODE_RECEIVE_INPUT_RXDCC,
+      // Only the receive interrupt is used, it also counts the frames sent from the transmit queue
+      .rxIrqNum = IRQ3_IRQn,
+      .rxIRQServiceRequest = 0,
+      // Below the SysTick, which keeps the receive timestamps up to date
+      .rxIRQPriority = 3,
+      .rxInterruptControlSource = XMC_SCU_IRQCTRL_CAN0_SR0_IRQ3
    },
 };
 
+// This table defines the receive filters of the primary channel.  Each
+// filter is given its own receive FIFO.
+static const CAN_Drv_FilterConfigItem_t canFilterConfigTable[] =
+{
+   // Battery block commands
+   { BB_CommandCMD_CANID | 0x80000000U, 0x1FFFFFFFU, 2U },
+   // SYNC and follow-up frames of the time master
+   { LUNAR_TIMESYNC_SYNC_CANID | 0x80000000U, 0x1FFFFFFEU, 2U },
+   // Node ID claims, the low 8 bits hold the name of the sender
+   { NODEADDRMGR_CLAIM_CANID | 0x80000000U, 0x1FFFFF00U, 4U },
+   // Image data frames of a firmware update, sent back to back
+   { LUNAR_FWUPDATE_DATA_CANID | 0x80000000U, 0x1FFFFF00U, 4U },
+   // Control frames of a firmware update
+   { LUNAR_FWUPDATE_CONTROL_CANID | 0x80000000U, 0x1FFFFFFCU, 2U },
+   // Message Router requests
+   { LUNAR_CANTRANSPORT_REQUEST_CANID | 0x80000000U, LUNAR_CANTRANSPORT_REQUEST_MASK, 2U },
+   // Segmented Message Router requests and flow control frames
+   { LUNAR_CANTRANSPORT_ISOTP_REQUEST_CANID | 0x80000000U, LUNAR_CANTRANSPORT_REQUEST_MASK, 2U },
+};
+
 
 #ifdef __cplusplus
 extern "C"
@@ -131,7 +131,22 @@ Control_State_t Control_GetState(void)
 // Event handler for fault
 void Control_Fault(void)
 {
-   // TODO
+   // Stop the control so that it does not resume by itself once the errors clear
+   bool wasConnected = (status.deviceState == CONTROL_STATE_CONNECTED);
+
+   status.deviceState = CONTROL_STATE_STANDBY;
+   if (wasConnected)
+   {
+      // Trigger the Enable State Change event
+      Lunar_EventMgr_HandleEvent(LUNAR_EVENTMGR_CONFIG_EVENT_Control_Disabled);
+   }
+
+   // Show the fault now rather than at the next update
+   GPIO_Drv_Write(GPIO_DRV_CHANNEL_LED_FAULT, true);
+
+   // Keep the fault until it is cleared.  This error is not critical, so it
+   // does not raise the critical error event that called this handler again.
+   Lunar_ErrorMgr_SetErrorState(LUNAR_ERRORMGR_ERROR_CONTROL_FAULT, true);
 }
 
 
@@ -216,10 +231,11 @@ void Control_MessageRouter_BB_CommandCMD(Lunar_MessageRouter_Message_t *const me
 
    // Verify the length of the command parameters and make sure we have room for the response
    //	Note that the error response will be set, if necessary
-   if (Lunar_MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), 0))
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, BB_CommandCMD_DLC, 0))
    {
-      // Cast the command buffer as the command type.
-      Command_t *command = (Command_t *)message->commandParams.data;
+      // Unpack the signals from the command buffer
+      Command_t command;
+      BB_CommandCMD_Unpack(&command, message->commandParams.data);
 
       //-----------------------------------------------
       // Execute Command
@@ -228,7 +244,7 @@ void Control_MessageRouter_BB_CommandCMD(Lunar_MessageRouter_Message_t *const me
       // State and Reset are combined into one command
       // Check Reset first. Reset if non-zero
       //      Bits=08.  [ 0     , 255    ]  Unit:''
-      if (command->BB_ResetReq != 0)
+      if (command.BB_ResetReq != 0)
       {
          // Just call the platform reset function
          Reset_Drv_Execute();
@@ -238,7 +254,7 @@ void Control_MessageRouter_BB_CommandCMD(Lunar_MessageRouter_Message_t *const me
          // No reset requested, check for state change
          // We can call this each time since Control will only act if the state changes
          //      Bits=08.  [ 0     , 255    ]  Unit:''
-         Control_SetState((Control_State_t)command->BB_StateReq);
+         Control_SetState((Control_State_t)command.BB_StateReq);
       }
 
       // Set the response length
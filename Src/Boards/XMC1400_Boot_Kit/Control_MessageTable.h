@@ -27,9 +27,9 @@ extern "C"
 // This table provides a list of commands for this module.
 static const Lunar_MessageRouter_CommandTableItem_t Control_messageTable[] =
 {
-   // {Command ID, Message Handler Function Pointer}
-   { 0x01, Control_MessageRouter_GetState },
-   { 0x02, Control_MessageRouter_SetState }
+   // {Command ID, Message Handler Function Pointer, Cache Max Age (ms)}
+   { 0x01, Control_MessageRouter_GetState, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 0x02, Control_MessageRouter_SetState, LUNAR_MESSAGEROUTER_CACHE_NEVER }
 };
 
 // Control has a second message table just to align the commands with CAN
@@ -37,8 +37,8 @@ static const Lunar_MessageRouter_CommandTableItem_t Control_messageTable[] =
 // to be shared.
 static const Lunar_MessageRouter_CommandTableItem_t Control_messageTableCAN[] =
 {
-   // {Command ID, Message Handler Function Pointer}
-   { 0x01, Control_MessageRouter_BB_CommandCMD },
+   // {Command ID, Message Handler Function Pointer, Cache Max Age (ms)}
+   { 0x01, Control_MessageRouter_BB_CommandCMD, LUNAR_MESSAGEROUTER_CACHE_NEVER },
 };
 
 
@@ -0,0 +1,39 @@
+/*******************************************************************************
+// Flash Driver Configuration
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+// Platform Includes
+// Other Includes
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// The number of bytes in a page, the smallest unit that can be programmed
+#define FLASH_DRV_PAGE_SIZE (256U)
+
+// The number of bytes erased by Flash_Drv_StartEraseSector
+// The XMC1 erases a 4 KB sector one page at a time
+#define FLASH_DRV_SECTOR_SIZE (0x1000U)
+
+// The value read from an erased word of flash
+#define FLASH_DRV_ERASED_WORD (0x00000000UL)
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
@@ -0,0 +1,47 @@
+/*******************************************************************************
+// Core CAN Transport Configuration
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Platform Includes
+// Other Includes
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+/** First identifier of the Message Router requests to the battery block.  The low
+  * 16 bits of a request identifier are the module and command, so any
+  * command can be sent on the bus.
+*/
+#define LUNAR_CANTRANSPORT_REQUEST_CANID (0x1B10000U)
+
+// First identifier of the responses, the low 16 bits match the request
+#define LUNAR_CANTRANSPORT_RESPONSE_CANID (0x1B20000U)
+
+/** First identifier of the segmented (ISO-TP) Message Router requests, which
+  * carry commands and responses of up to a message buffer pool block.  The
+  * low 16 bits are the module and command as for the single frame requests.
+*/
+#define LUNAR_CANTRANSPORT_ISOTP_REQUEST_CANID (0x1B30000U)
+
+// First identifier of the segmented responses and flow control frames
+#define LUNAR_CANTRANSPORT_ISOTP_RESPONSE_CANID (0x1B40000U)
+
+// Mask that matches every request identifier
+#define LUNAR_CANTRANSPORT_REQUEST_MASK (0x1FFF0000U)
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
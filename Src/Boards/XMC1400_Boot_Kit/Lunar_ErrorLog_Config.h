@@ -0,0 +1,40 @@
+/*******************************************************************************
+// Core Error Log Configuration
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+// Platform Includes
+// Other Includes
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// The address of the first flash sector reserved for the error log
+// The last 8 KB of flash are reserved for the log in the scatter file
+#define LUNAR_ERRORLOG_FLASH_START_ADDRESS (0x10031000UL)
+
+// The number of consecutive sectors used by the log
+// At least 2 are required so the newest records survive erasing the oldest sector
+#define LUNAR_ERRORLOG_NUM_SECTORS (2U)
+
+// The longest time in milliseconds a record waits in RAM before it is written
+#define LUNAR_ERRORLOG_FLUSH_DELAY_MS (1000U)
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
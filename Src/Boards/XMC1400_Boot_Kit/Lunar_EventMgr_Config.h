@@ -28,6 +28,12 @@ typedef enum
    LUNAR_EVENTMGR_CONFIG_EVENT_Control_Disabled,
    // Event for any critical error
    LUNAR_EVENTMGR_CONFIG_EVENT_Critical_Error,
+   // Event for any error being set or cleared
+   LUNAR_EVENTMGR_CONFIG_EVENT_Error_Changed,
+   // Event when the node ID is claimed or lost to another node
+   LUNAR_EVENTMGR_CONFIG_EVENT_Node_Address_Changed,
+   // Event when the time was synchronized with the time master
+   LUNAR_EVENTMGR_CONFIG_EVENT_Time_Synchronized,
    // Value representing the number of events in the enumeration
    LUNAR_EVENTMGR_CONFIG_EVENT_Count,
    // This event is primarily a placeholder for placing an unused event in the config table
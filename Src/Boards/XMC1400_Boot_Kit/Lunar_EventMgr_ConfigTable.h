@@ -18,6 +18,7 @@ extern "C"
 // Platform Includes
 // Other Includes
 #include "Control.h"
+#include "ReportMgr.h"
 
 
 /*******************************************************************************
@@ -28,7 +29,10 @@ extern "C"
 static const Lunar_EventMgr_Table_Item_t Lunar_EventMgr_eventConfigTable[] =
 {
    // {Event, Event Callback }
-   { LUNAR_EVENTMGR_CONFIG_EVENT_Critical_Error, Control_Fault }
+   { LUNAR_EVENTMGR_CONFIG_EVENT_Critical_Error, Control_Fault },
+   { LUNAR_EVENTMGR_CONFIG_EVENT_Error_Changed, ReportMgr_ErrorChanged },
+   { LUNAR_EVENTMGR_CONFIG_EVENT_Node_Address_Changed, ReportMgr_NodeAddressChanged },
+   { LUNAR_EVENTMGR_CONFIG_EVENT_Time_Synchronized, ReportMgr_TimeSynchronized }
 };
 
 #ifdef __cplusplus
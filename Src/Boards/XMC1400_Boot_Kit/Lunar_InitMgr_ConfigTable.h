@@ -16,18 +16,28 @@ extern "C"
 #include "Lunar_InitMgr.h"
 // Platform Includes
 #include "CAN_Drv.h"
+#include "Flash_Drv.h"
 #include "GPIO_Drv.h"
 #include "Reset_Drv.h"
 #include "RTC_Drv.h"
 #include "SysTick_Drv.h"
+#include "Lunar_CANTransport.h"
+#include "Lunar_ErrorLog.h"
 #include "Lunar_ErrorMgr.h"
+#include "Lunar_FwUpdate.h"
 #include "Lunar_EventMgr.h"
+#include "Lunar_IsoTp.h"
 #include "Lunar_Main.h"
+#include "Lunar_MessageBufferPool.h"
+#include "Lunar_MessageRouter.h"
 #include "Lunar_Scheduler.h"
 #include "Lunar_Serial.h"
+#include "Lunar_SubscriptionMgr.h"
+#include "Lunar_TimeSync.h"
 // Other Includes
 #include "Control.h"
 #include "LEDMgr.h"
+#include "NodeAddrMgr.h"
 #include "ReportMgr.h"
 
 
@@ -49,7 +59,11 @@ static const Lunar_InitMgr_ConfigItem_t initMgrConfigTable[] =
    { Lunar_ErrorMgr_Init },
    // Timebase second to make sure timing is correct
    { SysTick_Drv_Init },
+   // Synchronized time third, the errors are logged with it
+   { Lunar_TimeSync_Init },
    { Lunar_EventMgr_Init },
+   { Lunar_MessageBufferPool_Init },
+   { Lunar_MessageRouter_Init },
    { Reset_Drv_Init },
    // RTC driver needs Reset Drv initialzed to determine if time 
    // should be preserved
@@ -59,9 +73,19 @@ static const Lunar_InitMgr_ConfigItem_t initMgrConfigTable[] =
    { Lunar_Scheduler_Init },
    { LEDMgr_Init },
    { CAN_Drv_Init },
+   { Lunar_CANTransport_Init },
+   { Lunar_IsoTp_Init },
    { Lunar_Serial_Init },
+   { Lunar_SubscriptionMgr_Init },
    { Control_Init },
+   // The reports are scheduled in the slot of the node ID
+   { NodeAddrMgr_Init },
    { ReportMgr_Init },
+   { Flash_Drv_Init },
+   // Error log last, restoring persistent errors may trigger the critical
+   // error event, so every module must be ready to handle it
+   { Lunar_ErrorLog_Init },
+   { Lunar_FwUpdate_Init },
 };
 
 #ifdef __cplusplus
@@ -0,0 +1,40 @@
+/*******************************************************************************
+// Core ISO-TP Configuration
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Platform Includes
+// Other Includes
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// The number of segmented transfers that may be in progress at one time.
+// Each transfer holds a message buffer pool block until it is complete.
+#define LUNAR_ISOTP_NUM_SESSIONS (1U)
+
+// The number of consecutive frames the sender may send before waiting for the
+// next flow control frame.  This keeps a command within the receive ring.
+#define LUNAR_ISOTP_BLOCK_SIZE (4U)
+
+// The minimum time between consecutive frames requested from the sender
+#define LUNAR_ISOTP_SEPARATION_TIME_MS (1U)
+
+// Time to wait for the next frame from the other node before the transfer is ended
+#define LUNAR_ISOTP_TIMEOUT_MS (1000U)
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
@@ -0,0 +1,39 @@
+/*******************************************************************************
+// Core Message Buffer Pool Configuration
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Platform Includes
+// Other Includes
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+/** The number of blocks in the message buffer pool.  Each serial port holds
+  * a block from a complete command header until the response is sent.  The
+  * remaining blocks are used briefly while a message is processed (CAN,
+  * subscriptions, etc.), except for a segmented CAN transfer, which holds a
+  * block until it is complete.  There must be more blocks than serial ports
+  * and ISO-TP sessions together.
+*/
+#define LUNAR_MESSAGEBUFFERPOOL_NUM_BLOCKS (4U)
+
+// The size of each block in bytes -- this is the largest command or response
+// that may be processed by the Message Router
+#define LUNAR_MESSAGEBUFFERPOOL_BLOCK_SIZE (48U)
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
@@ -0,0 +1,35 @@
+/*******************************************************************************
+// Core Message Router Configuration
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Platform Includes
+// Other Includes
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// The number of responses that may be held in the response cache at one time
+#define LUNAR_MESSAGEROUTER_CACHE_NUM_ENTRIES (4U)
+
+// The largest response that may be cached -- larger responses always call the handler
+#define LUNAR_MESSAGEROUTER_CACHE_MAX_RESPONSE_SIZE (20U)
+
+// Per-command metrics are removed to save RAM on this device (1 = enabled)
+#define LUNAR_MESSAGEROUTER_METRICS_ENABLED (0)
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
@@ -16,12 +16,19 @@ extern "C"
 // Module Includes
 #include "Lunar_MessageRouter.h"
 // Platform Includes
+#include "Lunar_CANTransport_MessageTable.h"
 #include "Lunar_ErrorMgr_MessageTable.h"
+#include "Lunar_FwUpdate_MessageTable.h"
 #include "Lunar_Main_MessageTable.h"
+#include "Lunar_MessageRouter_MessageTable.h"
 #include "Lunar_Serial_MessageTable.h"
+#include "Lunar_SubscriptionMgr_MessageTable.h"
+#include "Lunar_TimeSync_MessageTable.h"
 // Other Includes
+#include "CAN_Drv_MessageTable.h"
 #include "Control_MessageTable.h"
 #include "LEDMgr_MessageTable.h"
+#include "NodeAddrMgr_MessageTable.h"
 #include "ReportMgr_MessageTable.h"
 #include "RTC_Drv_MessageTable.h"
 
@@ -44,6 +51,13 @@ static const Lunar_MessageRouter_ConfigItem_t messageRouterConfigTable[] =
    // { 0x07, PWM_messageTable, sizeof(PWM_messageTable) / sizeof(Lunar_MessageRouter_CommandTableItem_t) },
    // { 0x08, TemperatureMonitor_messageTable, sizeof(TemperatureMonitor_messageTable) / sizeof(Lunar_MessageRouter_CommandTableItem_t) },
    { 0x09, RTC_Drv_messageTable, sizeof(RTC_Drv_messageTable) / sizeof(Lunar_MessageRouter_CommandTableItem_t)},
+   { 0x0A, Lunar_SubscriptionMgr_messageTable, sizeof(Lunar_SubscriptionMgr_messageTable) / sizeof(Lunar_MessageRouter_CommandTableItem_t) },
+   { 0x0B, Lunar_MessageRouter_messageTable, sizeof(Lunar_MessageRouter_messageTable) / sizeof(Lunar_MessageRouter_CommandTableItem_t) },
+   { 0x0C, CAN_Drv_messageTable, sizeof(CAN_Drv_messageTable) / sizeof(Lunar_MessageRouter_CommandTableItem_t) },
+   { 0x0E, NodeAddrMgr_messageTable, sizeof(NodeAddrMgr_messageTable) / sizeof(Lunar_MessageRouter_CommandTableItem_t) },
+   { 0x0F, Lunar_TimeSync_messageTable, sizeof(Lunar_TimeSync_messageTable) / sizeof(Lunar_MessageRouter_CommandTableItem_t) },
+   { 0x10, Lunar_FwUpdate_messageTable, sizeof(Lunar_FwUpdate_messageTable) / sizeof(Lunar_MessageRouter_CommandTableItem_t) },
+   { 0x12, Lunar_CANTransport_messageTable, sizeof(Lunar_CANTransport_messageTable) / sizeof(Lunar_MessageRouter_CommandTableItem_t) },
    { 0xB0, ReportMgr_messageTable, sizeof(ReportMgr_messageTable) / sizeof(Lunar_MessageRouter_CommandTableItem_t) },
    { 0xB1, Control_messageTableCAN, sizeof(Control_messageTableCAN) / sizeof(Lunar_MessageRouter_CommandTableItem_t)},
 };
@@ -0,0 +1,44 @@
+/*******************************************************************************
+// Core Subscription Manager Configuration
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Platform Includes
+// Other Includes
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// The maximum number of subscriptions that may be active at one time
+#define LUNAR_SUBSCRIPTIONMGR_MAX_SUBSCRIPTIONS (4U)
+
+// The maximum number of command parameter bytes stored for each subscription
+#define LUNAR_SUBSCRIPTIONMGR_MAX_COMMAND_SIZE (4U)
+
+// The shortest allowed interval between responses for a single subscription
+#define LUNAR_SUBSCRIPTIONMGR_MIN_INTERVAL_MS (50U)
+
+/** The total bandwidth that may be used by all subscriptions in bytes per
+  * second.  Each response is counted as the message header, length and
+  * response data before it is encoded by the transport.
+*/
+#define LUNAR_SUBSCRIPTIONMGR_BANDWIDTH_BYTES_PER_SECOND (2000U)
+
+// The number of bytes that may be sent at once after the subscriptions have been idle
+#define LUNAR_SUBSCRIPTIONMGR_BANDWIDTH_BURST_BYTES (128U)
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
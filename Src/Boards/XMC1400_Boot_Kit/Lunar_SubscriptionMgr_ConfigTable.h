@@ -0,0 +1,40 @@
+/*******************************************************************************
+// Core Subscription Manager Configuration
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Lunar_SubscriptionMgr.h"
+// Platform Includes
+#include "Lunar_CANTransport.h"
+#include "Lunar_MessageRouter.h"
+#include "Lunar_Serial.h"
+// Other Includes
+
+
+/*******************************************************************************
+// Constant Configuration Variable Declarations
+*******************************************************************************/
+
+// Table that defines the transports that are able to receive subscription responses
+// Subscriptions received from transports that are not listed are rejected.
+static const Lunar_SubscriptionMgr_TransportConfigItem_t Lunar_SubscriptionMgr_transportConfigTable[] =
+{
+   // {Transport, Send Message Function }
+   { LUNAR_MESSAGEROUTER_TRANSPORT_Serial, Lunar_Serial_SendMessage },
+   { LUNAR_MESSAGEROUTER_TRANSPORT_CAN, Lunar_CANTransport_SendMessage },
+};
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
@@ -0,0 +1,458 @@
+/*******************************************************************************
+// Node Address Manager
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "NodeAddrMgr.h"
+#include "NodeAddrMgr_Config.h"
+// Platform Includes
+#include "CAN_Drv.h"
+#include "Lunar_EventMgr.h"
+#include "Lunar_MessageRouter.h"
+#include "Reset_Drv.h"
+#include "Timebase_Drv.h"
+// Other Includes
+#include <stdbool.h>
+#include <stdint.h>
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// Flag in the node ID byte of a claim, set when the sender already uses the ID
+#define CLAIMED_FLAG (0x80U)
+
+// The number of words in the table of node IDs claimed by other nodes
+#define NUM_TAKEN_WORDS ((NODEADDRMGR_NUM_NODES + 31U) / 32U)
+
+// The value of the lowest node ID bit in a CAN identifier
+#define NODE_ID_SCALE (NODEADDRMGR_CANID_NODE_ID_MASK & (~NODEADDRMGR_CANID_NODE_ID_MASK + 1U))
+
+// The 64-bit FNV-1a hash used to fold the unique chip ID into the name
+#define FNV_OFFSET_BASIS (0xCBF29CE484222325ULL)
+#define FNV_PRIME (0x00000100000001B3ULL)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// The states of the claim protocol
+typedef enum
+{
+   // Waiting a random time before the claim is sent
+   STATE_Holdoff,
+   // The claim was sent, waiting for objections
+   STATE_Claiming,
+   // The node ID is in use
+   STATE_Claimed,
+   // Every node ID is taken, waiting before trying again
+   STATE_NoAddress
+} State_t;
+
+// This structure holds the private information for this module
+typedef struct
+{
+   // The name of this node, built from the unique chip ID
+   uint64_t name;
+
+   // The state of the random number generator for the claim delay
+   uint32_t randomState;
+
+   // The time the current state was entered
+   uint32_t stateTime;
+
+   // The delay before the claim is sent in the holdoff state
+   uint32_t holdoffTicks;
+
+   // Bit i is set once node ID i was claimed by another node
+   uint32_t takenNodes[NUM_TAKEN_WORDS];
+
+   // The number of claims sent and the number of claims lost to other nodes
+   uint32_t numClaimsSent;
+   uint16_t numClaimsLost;
+
+   // The number of claims of other nodes for the ID of this node that were rejected
+   uint16_t numClaimsRejected;
+
+   // The node ID being claimed or in use
+   uint8_t candidateId;
+
+   // The node ID in use, NODEADDRMGR_NO_NODE until the claim succeeded
+   uint8_t nodeId;
+
+   // The state of the claim protocol
+   State_t state;
+
+   // true when the claim must be repeated to reject the claim of another node
+   bool isClaimPending;
+} NodeAddrMgr_Status_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The variable used for holding all internal data for this module.
+static NodeAddrMgr_Status_t status;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function returns the next value of a xorshift random number
+  *    generator.  The generator is seeded with the name, so nodes starting
+  *    at the same time pick different delays.
+  * Returns:
+  *    uint32_t - The random value
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint32_t GetRandom(void);
+
+/** Description:
+  *    This function starts claiming the first free node ID, starting at the
+  *    given ID and wrapping around.  When every node ID is taken, the node
+  *    waits and tries again later.
+  * Parameters:
+  *    firstNodeId :  The first node ID to be tried
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void StartClaim(const uint8_t firstNodeId);
+
+/** Description:
+  *    This function sends the claim for the candidate node ID.
+  * Returns:
+  *    bool - true if the frame was queued
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool SendClaim(void);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Get the next random value
+static uint32_t GetRandom(void)
+{
+   uint32_t x = status.randomState;
+
+   x ^= x << 13U;
+   x ^= x >> 17U;
+   x ^= x << 5U;
+   status.randomState = x;
+
+   return(x);
+}
+
+
+// Claim the first free node ID
+static void StartClaim(const uint8_t firstNodeId)
+{
+   uint8_t nodeId = firstNodeId;
+   bool isFound = false;
+
+   for (uint32_t i = 0U; (i < NODEADDRMGR_NUM_NODES) && (!isFound); i++)
+   {
+      if ((status.takenNodes[nodeId / 32U] & (1UL << (nodeId % 32U))) == 0U)
+      {
+         isFound = true;
+      }
+      else
+      {
+         nodeId = (uint8_t)((nodeId + 1U) % NODEADDRMGR_NUM_NODES);
+      }
+   }
+
+   status.stateTime = Timebase_Drv_GetCurrentTickCount();
+   status.isClaimPending = false;
+
+   if (isFound)
+   {
+      status.candidateId = nodeId;
+      status.holdoffTicks = GetRandom() % ((NODEADDRMGR_CLAIM_HOLDOFF_MS * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND) + 1U);
+      status.state = STATE_Holdoff;
+   }
+   else
+   {
+      status.state = STATE_NoAddress;
+   }
+}
+
+
+// Send the claim for the candidate node ID
+static bool SendClaim(void)
+{
+   uint8_t frameData[8];
+
+   // The top byte of the name is sent in the identifier, the others in the data
+   frameData[0] = status.candidateId | ((status.state == STATE_Claimed) ? CLAIMED_FLAG : 0U);
+   for (uint32_t i = 0U; i < 7U; i++)
+   {
+      frameData[1U + i] = (uint8_t)(status.name >> (8U * i));
+   }
+
+   bool isQueued = CAN_Drv_StartTransmitFrame(CAN_DRV_CHANNEL_PRIMARY, NODEADDRMGR_CLAIM_CANID | (uint32_t)(status.name >> 56U) | CAN_DRV_EXTENDED_ID, frameData, (uint8_t)sizeof(frameData));
+
+   if (isQueued)
+   {
+      status.numClaimsSent++;
+   }
+
+   return(isQueued);
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Module initialization
+void NodeAddrMgr_Init(void)
+{
+   uint8_t uniqueId[RESET_DRV_UNIQUE_ID_LENGTH];
+
+   Reset_Drv_GetUniqueId(uniqueId);
+
+   // Fold the unique chip ID into a 64-bit name
+   status.name = FNV_OFFSET_BASIS;
+   for (uint32_t i = 0U; i < RESET_DRV_UNIQUE_ID_LENGTH; i++)
+   {
+      status.name = (status.name ^ uniqueId[i]) * FNV_PRIME;
+   }
+
+   // The generator must not start at zero
+   status.randomState = (uint32_t)status.name ^ (uint32_t)(status.name >> 32U);
+   if (status.randomState == 0U)
+   {
+      status.randomState = 1U;
+   }
+
+   for (uint32_t i = 0U; i < NUM_TAKEN_WORDS; i++)
+   {
+      status.takenNodes[i] = 0U;
+   }
+
+   status.numClaimsSent = 0U;
+   status.numClaimsLost = 0U;
+   status.numClaimsRejected = 0U;
+   status.nodeId = NODEADDRMGR_NO_NODE;
+
+   StartClaim((uint8_t)(status.name % NODEADDRMGR_NUM_NODES));
+}
+
+
+// Run the claim protocol
+void NodeAddrMgr_Update(void)
+{
+   uint32_t elapsedTime = Timebase_Drv_GetCurrentTickCount() - status.stateTime;
+
+   if (status.state == STATE_Holdoff)
+   {
+      // A claim that cannot be queued is tried again on the next call
+      if ((elapsedTime >= status.holdoffTicks) && (SendClaim()))
+      {
+         status.stateTime = Timebase_Drv_GetCurrentTickCount();
+         status.state = STATE_Claiming;
+      }
+   }
+   else if (status.state == STATE_Claiming)
+   {
+      if (elapsedTime >= (NODEADDRMGR_CLAIM_TIMEOUT_MS * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND))
+      {
+         // No node objected, the node ID can be used
+         status.nodeId = status.candidateId;
+         status.state = STATE_Claimed;
+         Lunar_EventMgr_HandleEvent(LUNAR_EVENTMGR_CONFIG_EVENT_Node_Address_Changed);
+      }
+   }
+   else if (status.state == STATE_NoAddress)
+   {
+      if (elapsedTime >= (NODEADDRMGR_RETRY_TIME_MS * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND))
+      {
+         // Nodes may have left the bus since their claims were seen
+         for (uint32_t i = 0U; i < NUM_TAKEN_WORDS; i++)
+         {
+            status.takenNodes[i] = 0U;
+         }
+
+         StartClaim((uint8_t)(status.name % NODEADDRMGR_NUM_NODES));
+      }
+   }
+   else
+   {
+      // Claimed, nothing to do until another node claims the same ID
+   }
+
+   // Repeat the claim so the other node gives up the ID
+   if ((status.isClaimPending) && (SendClaim()))
+   {
+      status.isClaimPending = false;
+   }
+}
+
+
+// Get the claimed node ID
+uint8_t NodeAddrMgr_GetNodeId(void)
+{
+   return(status.nodeId);
+}
+
+
+// Place the node ID in a CAN identifier
+uint32_t NodeAddrMgr_GetCanId(const uint32_t canId)
+{
+   uint32_t nodeIdBits = 0U;
+
+   if (status.nodeId != NODEADDRMGR_NO_NODE)
+   {
+      nodeIdBits = (uint32_t)status.nodeId * NODE_ID_SCALE;
+   }
+
+   return((canId & ~NODEADDRMGR_CANID_NODE_ID_MASK) | nodeIdBits);
+}
+
+
+/*******************************************************************************
+// Message Router Function Implementations
+*******************************************************************************/
+
+// Message handler to get the name, node ID and claim statistics
+void NodeAddrMgr_MessageRouter_GetStatus(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // Response
+   typedef struct
+   {
+      uint32_t nameLow;
+      uint32_t nameHigh;
+      uint32_t numClaimsSent;
+      uint16_t numClaimsLost;
+      uint16_t numClaimsRejected;
+      uint8_t nodeId;
+      uint8_t candidateId;
+      uint8_t state;
+      uint8_t reserved;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   {
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      response->nameLow = (uint32_t)status.name;
+      response->nameHigh = (uint32_t)(status.name >> 32U);
+      response->numClaimsSent = status.numClaimsSent;
+      response->numClaimsLost = status.numClaimsLost;
+      response->numClaimsRejected = status.numClaimsRejected;
+      response->nodeId = status.nodeId;
+      response->candidateId = status.candidateId;
+      response->state = (uint8_t)status.state;
+      response->reserved = 0U;
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+// Message handler for the claims of other nodes
+void NodeAddrMgr_MessageRouter_Claim(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // Command
+   typedef struct
+   {
+      uint8_t nodeId;
+      uint8_t name[7];
+   } Command_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), 0))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      // The top byte of the name is carried in the identifier
+      uint64_t otherName = (uint64_t)message->source.address << 56U;
+      for (uint32_t i = 0U; i < 7U; i++)
+      {
+         otherName |= (uint64_t)command->name[i] << (8U * i);
+      }
+
+      uint8_t otherNodeId = command->nodeId & (uint8_t)~CLAIMED_FLAG;
+      bool isOtherClaimed = ((command->nodeId & CLAIMED_FLAG) != 0U);
+
+      // Claims with this name or outside the node ID range are ignored
+      if ((otherName != status.name) && (otherNodeId < NODEADDRMGR_NUM_NODES))
+      {
+         status.takenNodes[otherNodeId / 32U] |= (1UL << (otherNodeId % 32U));
+
+         if ((otherNodeId == status.candidateId) && (status.state != STATE_NoAddress))
+         {
+            bool isClaimed = (status.state == STATE_Claimed);
+
+            // A node using the ID keeps it, otherwise the lower name wins
+            if ((isOtherClaimed && (!isClaimed)) ||
+                ((isOtherClaimed == isClaimed) && (otherName < status.name)))
+            {
+               status.numClaimsLost++;
+
+               if (isClaimed)
+               {
+                  status.nodeId = NODEADDRMGR_NO_NODE;
+                  Lunar_EventMgr_HandleEvent(LUNAR_EVENTMGR_CONFIG_EVENT_Node_Address_Changed);
+               }
+
+               StartClaim((uint8_t)((otherNodeId + 1U) % NODEADDRMGR_NUM_NODES));
+            }
+            else if (status.state != STATE_Holdoff)
+            {
+               // The other node gives up the ID once it sees the claim again
+               status.numClaimsRejected++;
+               status.isClaimPending = true;
+            }
+            else
+            {
+               // The claim is sent after the holdoff, within the claim timeout of the other node
+            }
+         }
+      }
+   }
+}
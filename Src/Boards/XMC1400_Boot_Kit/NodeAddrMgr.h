@@ -0,0 +1,116 @@
+/*******************************************************************************
+// Node Address Manager
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "NodeAddrMgr_Config.h"
+// Platform Includes
+#include "Lunar_MessageRouter.h"
+#include "Platform.h"
+// Other Includes
+#include <stdint.h>
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// Node ID returned while the node has not claimed a node ID
+#define NODEADDRMGR_NO_NODE (0xFFU)
+
+
+/*******************************************************************************
+// Public Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function initializes the module.  The name of the node is built
+  *    from the unique chip ID and the first node ID to be claimed is derived
+  *    from the name, so nodes running the same firmware start with
+  *    different node IDs.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void NodeAddrMgr_Init(void);
+
+/** Description:
+  *    This is the scheduled update function that runs the claim protocol.
+  *    After a random delay, the node claims a node ID on the CAN bus and
+  *    uses it once no node objected within the claim timeout.  A node that
+  *    already uses the ID, or a node with a lower name claiming at the same
+  *    time, wins the ID and the losing node claims the next free ID.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void NodeAddrMgr_Update(void);
+
+/** Description:
+  *    This function returns the claimed node ID.
+  * Returns:
+  *    uint8_t - The node ID or NODEADDRMGR_NO_NODE while no ID is claimed
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+uint8_t NodeAddrMgr_GetNodeId(void);
+
+/** Description:
+  *    This function places the claimed node ID in the node ID bits of a CAN
+  *    identifier.
+  * Parameters:
+  *    canId :  The identifier without a node ID
+  * Returns:
+  *    uint32_t - The identifier of this node
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+uint32_t NodeAddrMgr_GetCanId(const uint32_t canId);
+
+
+/*******************************************************************************
+// Message Router Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    Message handler that returns the name, node ID and claim statistics
+  *    of this node.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void NodeAddrMgr_MessageRouter_GetStatus(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+/** Description:
+  *    Message handler for the node ID claims of other nodes.  The source
+  *    address holds the top byte of the name of the sender.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void NodeAddrMgr_MessageRouter_Claim(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
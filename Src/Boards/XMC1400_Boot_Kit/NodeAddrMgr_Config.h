@@ -0,0 +1,46 @@
+/*******************************************************************************
+// Node Address Manager Configuration
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/*******************************************************************************
+// Public Constant Declarations
+*******************************************************************************/
+
+// The number of node IDs that can be claimed on the bus
+// This must cover every node ID of NODEADDRMGR_CANID_NODE_ID_MASK
+#define NODEADDRMGR_NUM_NODES (64U)
+
+/** Identifier bits 17-22 of the reports hold the node ID, so every node
+  * shares the DBC identifiers.  This must match the node ID mask of the
+  * battery block route on the inverter.
+*/
+#define NODEADDRMGR_CANID_NODE_ID_MASK (0x007E0000U)
+
+/** Identifier of the node ID claims.  The low 8 bits hold the top byte of
+  * the name of the sender, so two nodes never send the same identifier and
+  * the lower name wins the arbitration.
+*/
+#define NODEADDRMGR_CLAIM_CANID (0x1B50000U)
+
+// The time a claim must stand without a conflict before the node ID is used
+#define NODEADDRMGR_CLAIM_TIMEOUT_MS (250U)
+
+// The longest random delay before a claim is sent
+// This spreads the claims of nodes that start at the same time
+#define NODEADDRMGR_CLAIM_HOLDOFF_MS (64U)
+
+// The time before claiming again when every node ID is taken
+#define NODEADDRMGR_RETRY_TIME_MS (5000U)
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
@@ -0,0 +1,38 @@
+/*******************************************************************************
+// Node Address Manager Message Router Commands
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "NodeAddrMgr.h"
+// Platform Includes
+#include "Lunar_MessageRouter.h"
+// Other Includes
+
+
+/*******************************************************************************
+// Message Router Table
+*******************************************************************************/
+
+// This table provides a list of commands for this module
+static const Lunar_MessageRouter_CommandTableItem_t NodeAddrMgr_messageTable[] =
+{
+   // {Command ID, Message Handler Function Pointer, Cache Max Age (ms)}
+   { 1, NodeAddrMgr_MessageRouter_GetStatus, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   // The claims of other nodes are routed here by the CAN transport
+   { 2, NodeAddrMgr_MessageRouter_Claim, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+};
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
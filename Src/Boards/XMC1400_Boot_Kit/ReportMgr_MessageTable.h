@@ -20,6 +20,14 @@ extern "C"
 // Other Includes
 
 
+/*******************************************************************************
+// Constants
+*******************************************************************************/
+
+// The maximum age of a cached measurement response
+#define REPORTMGR_MEASUREMENT_CACHE_MAX_AGE_MS (10U)
+
+
 /*******************************************************************************
 // Message Router Table
 *******************************************************************************/
@@ -28,16 +36,18 @@ extern "C"
 // is to link each Command ID to its corresponding message handler function
 static const Lunar_MessageRouter_CommandTableItem_t ReportMgr_messageTable[] =
 {
-   // {Command ID, Message Handler Function Pointer}
+   // {Command ID, Message Handler Function Pointer, Cache Max Age (ms)}
    // Note that the Command IDs are currently aligned with the auto-generated ReportMgr_CAN.h file
    // Only the LSB of the CAN ID is used for the Command ID
-   { (uint8_t)BB_BatteryStatusRSP_CANID, ReportMgr_MessageRouter_BB_BatteryStatusRSP },
-   { (uint8_t)BB_DCDCStatusRSP_CANID, ReportMgr_MessageRouter_BB_DCDCStatusRSP },
-   { (uint8_t)BB_CellVoltage1to4RSP_CANID, ReportMgr_MessageRouter_BB_CellVoltage1to4RSP },
-   { (uint8_t)BB_CellVoltage5to8RSP_CANID, ReportMgr_MessageRouter_BB_CellVoltage5to8RSP },
-   { (uint8_t)BB_CellVoltage9to12RSP_CANID, ReportMgr_MessageRouter_BB_CellVoltage9to12RSP },
-   { (uint8_t)BB_CellTempRSP_CANID, ReportMgr_MessageRouter_BB_CellTempRSP },
-   { (uint8_t)BB_DCDCTemperaturesRSP_CANID, ReportMgr_MessageRouter_BB_DCDCTemperaturesRSP },
+   // Measurements may be a few milliseconds old, the state and errors must always be current
+   { (uint8_t)BB_BatteryStatusRSP_CANID, ReportMgr_MessageRouter_BB_BatteryStatusRSP, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { (uint8_t)BB_DCDCStatusRSP_CANID, ReportMgr_MessageRouter_BB_DCDCStatusRSP, REPORTMGR_MEASUREMENT_CACHE_MAX_AGE_MS },
+   { (uint8_t)BB_CellVoltage1to4RSP_CANID, ReportMgr_MessageRouter_BB_CellVoltage1to4RSP, REPORTMGR_MEASUREMENT_CACHE_MAX_AGE_MS },
+   { (uint8_t)BB_CellVoltage5to8RSP_CANID, ReportMgr_MessageRouter_BB_CellVoltage5to8RSP, REPORTMGR_MEASUREMENT_CACHE_MAX_AGE_MS },
+   { (uint8_t)BB_CellVoltage9to12RSP_CANID, ReportMgr_MessageRouter_BB_CellVoltage9to12RSP, REPORTMGR_MEASUREMENT_CACHE_MAX_AGE_MS },
+   { (uint8_t)BB_CellTempRSP_CANID, ReportMgr_MessageRouter_BB_CellTempRSP, REPORTMGR_MEASUREMENT_CACHE_MAX_AGE_MS },
+   { (uint8_t)BB_DCDCTemperaturesRSP_CANID, ReportMgr_MessageRouter_BB_DCDCTemperaturesRSP, REPORTMGR_MEASUREMENT_CACHE_MAX_AGE_MS },
+   { (uint8_t)BB_ErrorStatusRSP_CANID, ReportMgr_MessageRouter_BB_ErrorStatusRSP, LUNAR_MESSAGEROUTER_CACHE_NEVER },
 };
 
 #ifdef __cplusplus
@@ -29,8 +29,10 @@ extern "C"
 
 /** Defines the IRQ priority used for the SysTick Note that the
   * XMC1400 does not use priority grouping                     
+  * The cycle count is built from the tick count, so the SysTick must
+  * preempt the CAN and UART interrupts (3) that timestamp with it.
 */
-#define SYSTICK_DRV_IRQ_PRIORITY (3U)
+#define SYSTICK_DRV_IRQ_PRIORITY (2U)
 
 /** Defines the SysTick IRQ specified by the device specific
   * startup code                                            
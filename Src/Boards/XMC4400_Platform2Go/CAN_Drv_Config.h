@@ -28,15 +28,38 @@ extern "C"
 // Public Constant Definitions
 *******************************************************************************/
 
-// Configure CAN message ID target->host.
-#define CAN_TX_MSG_ID          (BB_BatteryStatusRSP_CANID | 0x80000000)
-// Configure number of bytes in the target->host CAN message.
-#define CAN_TX_MAX_DATA        (BB_BatteryStatusRSP_DLC)
+// The number of transmit message objects
+// The node sends the pending object with the lowest identifier first
+#define CAN_DRV_NUM_TX_MSG_OBJS   (4U)
 
-// Configure CAN message ID host->target.
-#define CAN_RX_MSG_ID          (BB_CommandCMD_CANID | 0x80000000)
-// Configure number of bytes in the host->target CAN message.
-#define CAN_RX_MAX_DATA        (BB_CommandCMD_DLC)
+// The number of transmit message objects kept free for high priority frames
+#define CAN_DRV_NUM_RESERVED_TX_MSG_OBJS   (1U)
+
+// Frames that win the arbitration against this identifier may use the reserved
+// objects, bit 31 selects an extended identifier as for the frames
+// This covers the command frames (0xA101, 0xB101), the reports start at 0x1A001
+#define CAN_DRV_TX_RESERVED_ID_LIMIT   (0x10000U | CAN_DRV_EXTENDED_ID)
+
+// The number of frames that can wait for a transmit message object
+#define CAN_DRV_TX_QUEUE_SIZE   (8U)
+
+// The time a frame may wait in a message object before it is aborted for a
+// higher priority frame
+#define CAN_DRV_TX_ABORT_TIME_MS   (10U)
+
+// The number of received frames buffered until they are read
+// One entry is always kept free
+#define CAN_DRV_RX_RING_SIZE   (16U)
+
+// The number of identifiers counted separately in the statistics
+// Frames of further identifiers are only counted in total
+#define CAN_DRV_NUM_ID_STATISTICS   (16U)
+
+// The CAN Channel Index for the receive interrupt handler
+// Specifying here allows the handler IRQ to be linked with the channel index in one spot
+#define CAN0_CONFIG_RX_CHANNEL_INDEX  CAN_DRV_CHANNEL_PRIMARY
+// CAN0_SR0 uses CAN0_0_IRQn
+#define CAN0_CONFIG_RX_HANDLER        IRQ_Hdlr_76
 
 
 /*******************************************************************************
@@ -55,6 +78,19 @@ typedef enum
 } CAN_Drv_Channel_t;
 
 
+// Defines the structure used for each entry in the CAN receive filter table
+// Each filter allocates a receive FIFO of fifoSize message objects plus a
+// base object that holds the acceptance filter
+typedef struct
+{
+   // The identifier to accept, bit 31 selects a 29-bit extended identifier
+   uint32_t canId;
+   // The identifier bits that must match canId
+   uint32_t idMask;
+   // The number of frames the FIFO holds before frames are lost
+   uint8_t fifoSize;
+} CAN_Drv_FilterConfigItem_t;
+
 // Defines the structure used for each entry it the UART Driver Config table
 typedef struct
 {
@@ -0,0 +1,40 @@
+/*******************************************************************************
+// CAN Driver Message Router Commands
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "CAN_Drv.h"
+// Platform Includes
+#include "Lunar_MessageRouter.h"
+// Other Includes
+
+
+/*******************************************************************************
+// Message Router Table
+*******************************************************************************/
+
+// This table provides a list of commands for this module
+static const Lunar_MessageRouter_CommandTableItem_t CAN_Drv_messageTable[] =
+{
+   // {Command ID, Message Handler Function Pointer, Cache Max Age (ms)}
+   { 1, CAN_Drv_MessageRouter_GetTrafficStatistics, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 2, CAN_Drv_MessageRouter_GetLatencyStatistics, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 3, CAN_Drv_MessageRouter_GetErrorStatistics, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 4, CAN_Drv_MessageRouter_GetIdStatistics, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 5, CAN_Drv_MessageRouter_ResetStatistics, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+};
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
@@ -0,0 +1,39 @@
+/*******************************************************************************
+// Flash Driver Configuration
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+// Platform Includes
+// Other Includes
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// The number of bytes in a page, the smallest unit that can be programmed
+#define FLASH_DRV_PAGE_SIZE (256U)
+
+// The number of bytes erased by Flash_Drv_StartEraseSector in logical sectors 0-7
+// The logical sectors after these are 128 KB (8) and 256 KB (9 and up) and are erased whole
+#define FLASH_DRV_SECTOR_SIZE (0x4000U)
+
+// The value read from an erased word of flash
+#define FLASH_DRV_ERASED_WORD (0x00000000UL)
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
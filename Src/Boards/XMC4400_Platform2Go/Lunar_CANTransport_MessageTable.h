@@ -0,0 +1,37 @@
+/*******************************************************************************
+// Core CAN Transport Module Message Router Commands
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Lunar_CANTransport.h"
+// Platform Includes
+#include "Lunar_MessageRouter.h"
+// Other Includes
+#include <stddef.h>
+
+
+/*******************************************************************************
+// Message Router Table
+*******************************************************************************/
+
+// This table provides a list of commands for this module.
+static const Lunar_MessageRouter_CommandTableItem_t Lunar_CANTransport_messageTable[] =
+{
+   // {Command ID, Message Handler Function Pointer, Cache Max Age (ms)}
+   { 0x01, Lunar_CANTransport_MessageRouter_GetStatistics, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+};
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
@@ -24,7 +24,10 @@ extern "C"
   * errors to non-volatile memory. Setting this value to true =
   * enabled, false = disabled.                                  
 */
-#define ERRORMGR_FLASH_STORAGE_ENABLED (false)
+#define ERRORMGR_FLASH_STORAGE_ENABLED (true)
+
+// The number of recent error transitions kept in RAM
+#define LUNAR_ERRORMGR_NUM_HISTORY_TRANSITIONS (16U)
 
 
 /*******************************************************************************
@@ -46,11 +49,15 @@ typedef enum
    // This error means the RAM has been detected as invalid by the software
    LUNAR_ERRORMGR_ERROR_RAM_CHECK_FAILED,
 
+   // This error means the control was stopped by a critical error.  It is not
+   // critical itself and stays set until it is cleared.
+   LUNAR_ERRORMGR_ERROR_CONTROL_FAULT,
+
    // This is the number of errors defined by the enumerated type
    LUNAR_ERRORMGR_ERROR_Count,
 
    // This error defines an error that will never appear in the bit-packed array
-   // It is primarily a placeholder for empty critical and persistent error tables
+   // It is primarily a placeholder used to denote that no error is given
    LUNAR_ERRORMGR_ERROR_None
 } Lunar_ErrorMgr_Error_t;
 
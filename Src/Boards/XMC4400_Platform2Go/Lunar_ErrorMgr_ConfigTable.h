@@ -12,6 +12,7 @@ extern "C"
 // Includes
 *******************************************************************************/
 // Platform Includes
+#include "Lunar_ErrorMgr.h"
 #include "Lunar_ErrorMgr_Config.h"
 // Other Includes
 
@@ -20,20 +21,38 @@ extern "C"
 // Constant Configuration Variable Declarations
 *******************************************************************************/
 
-// This constant array defines the errors that will be considered by the 
-// Error Manager module to be critical errors.
-static const Lunar_ErrorMgr_Error_t Lunar_ErrorMgr_criticalErrorConfigTable[] =
+/** This mask defines the errors that will be considered by the Error Manager
+  * module to be critical errors.  The mask is a constant for each 32-bit error
+  * word, so add one LUNAR_ERRORMGR_ERROR_BIT per critical error.
+*/
+#define LUNAR_ERRORMGR_CRITICAL_ERROR_MASK(word) \
+   (LUNAR_ERRORMGR_ERROR_BIT((word), LUNAR_ERRORMGR_ERROR_WATCHDOG_TIMEOUT) | \
+    LUNAR_ERRORMGR_ERROR_BIT((word), LUNAR_ERRORMGR_ERROR_VOLTAGE_LOW) | \
+    LUNAR_ERRORMGR_ERROR_BIT((word), LUNAR_ERRORMGR_ERROR_RAM_CHECK_FAILED))
+
+/** This mask defines the errors that persist across reboots.  The errors are
+  * restored from the error log at startup and remain set until cleared.
+*/
+#define LUNAR_ERRORMGR_PERSISTENT_ERROR_MASK(word) \
+   (LUNAR_ERRORMGR_ERROR_BIT((word), LUNAR_ERRORMGR_ERROR_WATCHDOG_TIMEOUT) | \
+    LUNAR_ERRORMGR_ERROR_BIT((word), LUNAR_ERRORMGR_ERROR_RAM_CHECK_FAILED))
+
+/** This table defines how each error is qualified before its state changes
+  * and how often a critical error may raise the critical error event.
+  * Errors that are not listed change on the first request and raise the
+  * event on every rising edge.
+*/
+static const Lunar_ErrorMgr_QualificationConfigItem_t Lunar_ErrorMgr_qualificationConfigTable[LUNAR_ERRORMGR_ERROR_Count] =
 {
-   LUNAR_ERRORMGR_ERROR_WATCHDOG_TIMEOUT,
-   LUNAR_ERRORMGR_ERROR_VOLTAGE_LOW,
-   LUNAR_ERRORMGR_ERROR_RAM_CHECK_FAILED,
-};
-
-// This table deines the list of errors that persist across reboots
-// NOTE: Persitent storage is not currently implemented
-static const Lunar_ErrorMgr_Error_t Lunar_ErrorMgr_persistentErrorConfigTable[] =
-{
-   LUNAR_ERRORMGR_ERROR_None
+   // [Error] = { Set time (ms), Clear time (ms), Minimum re-trigger time (ms) }
+   // Voltage is sampled continuously, so require it to stay low
+   [LUNAR_ERRORMGR_ERROR_VOLTAGE_LOW] = { 50U, 50U, 1000U },
+   [LUNAR_ERRORMGR_ERROR_WATCHDOG_TIMEOUT] = { 0U, 0U, 1000U },
+   [LUNAR_ERRORMGR_ERROR_RAM_CHECK_FAILED] = { 0U, 0U, 1000U },
+   // Generic error used for testing faults
+   [LUNAR_ERRORMGR_ERROR_BATTERY_FAULT] = { 300U, 300U, 0U },
+   // Set by the control when it stops for a critical error
+   [LUNAR_ERRORMGR_ERROR_CONTROL_FAULT] = { 0U, 0U, 0U },
 };
 
 #ifdef __cplusplus
@@ -0,0 +1,42 @@
+/*******************************************************************************
+// Core Firmware Update Configuration
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// The product ID of the battery blocks
+// Every node of a product receives the same broadcast image
+#define LUNAR_FWUPDATE_PRODUCT_ID (2U)
+
+// Identifiers of the image data frames and the control frames of this product
+// The low 8 bits of a data frame hold the block and the frame in the block
+#define LUNAR_FWUPDATE_DATA_CANID (0x1C00000U | (LUNAR_FWUPDATE_PRODUCT_ID << 12U))
+#define LUNAR_FWUPDATE_CONTROL_CANID (LUNAR_FWUPDATE_DATA_CANID | 0x100U)
+
+// Identifier of the status reports of the nodes
+// The low 16 bits hold a tag taken from the unique chip ID
+#define LUNAR_FWUPDATE_REPORT_CANID (0x1C10000U)
+
+// The flash area the new image is received into
+// Must match __STAGING_SIZE in the scatter file
+#define LUNAR_FWUPDATE_STAGING_ADDRESS (0x0C040000UL)
+#define LUNAR_FWUPDATE_STAGING_SIZE (0x00040000UL)
+
+// The size of the sectors of the staging area
+// The staging area is the 256 KB logical sector 9
+#define LUNAR_FWUPDATE_SECTOR_SIZE (0x00040000UL)
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
@@ -27,13 +27,13 @@ extern "C"
 // is to link each Command ID to its corresponding message handler function
 static const Lunar_MessageRouter_CommandTableItem_t Lunar_Main_messageTable[] =
 {
-   // {Command ID, Message Handler Function Pointer}
-   { 0x01, Lunar_Main_MessageRouter_GetApplicationVersion },
-   { 0x02, Lunar_Main_MessageRouter_GetProductID },
-   { 0x03, Lunar_Main_MessageRouter_GetProductName },
-   { 0x04, Lunar_Main_MessageRouter_Reset },
-   { 0x05, Lunar_Main_MessageRouter_GetResetReason },
-   { 0x06, Lunar_Main_MessageRouter_GetUptimeMillseconds },
+   // {Command ID, Message Handler Function Pointer, Cache Max Age (ms)}
+   { 0x01, Lunar_Main_MessageRouter_GetApplicationVersion, LUNAR_MESSAGEROUTER_CACHE_FOREVER },
+   { 0x02, Lunar_Main_MessageRouter_GetProductID, LUNAR_MESSAGEROUTER_CACHE_FOREVER },
+   { 0x03, Lunar_Main_MessageRouter_GetProductName, LUNAR_MESSAGEROUTER_CACHE_FOREVER },
+   { 0x04, Lunar_Main_MessageRouter_Reset, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 0x05, Lunar_Main_MessageRouter_GetResetReason, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 0x06, Lunar_Main_MessageRouter_GetUptimeMillseconds, LUNAR_MESSAGEROUTER_CACHE_NEVER },
 };
 
 #ifdef __cplusplus
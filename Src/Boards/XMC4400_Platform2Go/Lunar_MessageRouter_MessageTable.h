@@ -0,0 +1,42 @@
+/*******************************************************************************
+// Core Message Router Message Router Commands
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Lunar_MessageRouter.h"
+#include "Lunar_MessageRouter_Config.h"
+// Platform Includes
+// Other Includes
+
+
+/*******************************************************************************
+// Message Router Table
+*******************************************************************************/
+
+// This table provides a list of commands for this module.
+static const Lunar_MessageRouter_CommandTableItem_t Lunar_MessageRouter_messageTable[] =
+{
+   // {Command ID, Message Handler Function Pointer, Cache Max Age (ms)}
+   { 0x01, Lunar_MessageRouter_MessageRouter_GetCacheStatistics, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 0x02, Lunar_MessageRouter_MessageRouter_ClearCache, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+#if LUNAR_MESSAGEROUTER_METRICS_ENABLED
+   { 0x03, Lunar_MessageRouter_MessageRouter_GetMetricsSummary, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 0x04, Lunar_MessageRouter_MessageRouter_GetCommandMetrics, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 0x05, Lunar_MessageRouter_MessageRouter_ResetMetrics, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+#endif
+};
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
@@ -14,11 +14,18 @@ extern "C"
 // Module Includes
 #include "Lunar_Scheduler.h"
 // Platform Includes
+#include "Lunar_CANTransport.h"
+#include "Lunar_ErrorLog.h"
+#include "Lunar_FwUpdate.h"
+#include "Lunar_IsoTp.h"
 #include "Lunar_Serial.h"
+#include "Lunar_SubscriptionMgr.h"
+#include "Lunar_TimeSync.h"
 // Other Includes
 #include "Control.h"
 #include "LEDMgr.h"
 #include "CAN_Drv.h"
+#include "ReportMgr.h"
 
 
 /*******************************************************************************
@@ -35,9 +42,17 @@ static const Lunar_Scheduler_ConfigItem_t schedulerConfigTable[] =
    // { s, ms, Pointer To Scheduled Function }
    // { 0, 5, Watchdog_Update},
    { 0,   10, Lunar_Serial_Update },
+   { 0,   10, Lunar_SubscriptionMgr_Update },
    { 0,   50, Control_Update },
    { 0,   50, LEDMgr_Update },
-   { 5,    0, CAN_Drv_Update },
+   { 0,   10, Lunar_ErrorLog_Update },
+   { 0,   10, Lunar_TimeSync_Update },
+   // The flash steps of an update are paced into the pauses of the data stream
+   { 0,    1, Lunar_FwUpdate_Update },
+   { 0,    5, ReportMgr_Update },
+   { 0,    1, Lunar_CANTransport_Update },
+   { 0,    1, Lunar_IsoTp_Update },
+   { 0,    1, CAN_Drv_Update },
 };
 
 #ifdef __cplusplus
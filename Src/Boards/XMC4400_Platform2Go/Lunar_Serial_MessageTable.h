@@ -27,8 +27,8 @@ extern "C"
 // This table provides a list of commands for this module.
 static const Lunar_MessageRouter_CommandTableItem_t Lunar_Serial_messageTable[] =
 {
-   // {Command ID, Message Handler Function Pointer}
-   { 0x01, Lunar_Serial_MessageRouter_GetSerialStatistics },
+   // {Command ID, Message Handler Function Pointer, Cache Max Age (ms)}
+   { 0x01, Lunar_Serial_MessageRouter_GetSerialStatistics, LUNAR_MESSAGEROUTER_CACHE_NEVER },
 };
 
 #ifdef __cplusplus
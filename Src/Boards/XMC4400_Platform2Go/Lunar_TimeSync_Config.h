@@ -0,0 +1,47 @@
+/*******************************************************************************
+// Core Time Synchronization Configuration
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// The battery block follows the time of the inverter
+#define LUNAR_TIMESYNC_IS_MASTER (0)
+
+// Identifiers of the SYNC and follow-up frames
+// The low identifiers win the arbitration, so the frames are not held back
+#define LUNAR_TIMESYNC_SYNC_CANID (0x1000U)
+#define LUNAR_TIMESYNC_FOLLOWUP_CANID (0x1001U)
+
+// The time without a follow-up before the node is no longer synchronized
+// The master sends a SYNC frame every second
+#define LUNAR_TIMESYNC_TIMEOUT_MS (3500U)
+
+// The largest drift of the timebase against the master in parts per million
+// Both nodes run from a crystal
+// A larger measured drift restarts the synchronization (Ex. the master restarted)
+#define LUNAR_TIMESYNC_MAX_DRIFT_PPM (1000U)
+
+// The largest offset of a synchronized node at a follow-up in microseconds
+// The drift correction keeps the offset at each follow-up to a few microseconds
+// A larger offset is dropped as a bad timestamp
+#define LUNAR_TIMESYNC_MAX_OFFSET_US (500U)
+
+// The number of large offsets in a row that are dropped
+// The next one is used, as the master time jumped (Ex. the master was set)
+// The drops must end before the timeout, with a SYNC frame every second
+#define LUNAR_TIMESYNC_MAX_REJECTED_OFFSETS (2U)
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
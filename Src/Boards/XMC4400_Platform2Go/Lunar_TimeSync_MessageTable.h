@@ -0,0 +1,40 @@
+/*******************************************************************************
+// Core Time Synchronization Message Router Commands
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Lunar_TimeSync.h"
+// Platform Includes
+#include "Lunar_MessageRouter.h"
+// Other Includes
+#include <stddef.h>
+
+
+/*******************************************************************************
+// Message Router Table
+*******************************************************************************/
+
+// This table provides a list of commands for this module.
+static const Lunar_MessageRouter_CommandTableItem_t Lunar_TimeSync_messageTable[] =
+{
+   // {Command ID, Message Handler Function Pointer, Cache Max Age (ms)}
+   { 0x01, Lunar_TimeSync_MessageRouter_GetStatus, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   // The SYNC and follow-up frames of the master are routed here by the CAN transport
+   { 0x02, Lunar_TimeSync_MessageRouter_Sync, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 0x03, Lunar_TimeSync_MessageRouter_FollowUp, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+};
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
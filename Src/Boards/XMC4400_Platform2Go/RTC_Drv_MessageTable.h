@@ -26,9 +26,9 @@ extern "C"
 // This table provides a list of commands for this module
 static const Lunar_MessageRouter_CommandTableItem_t RTC_Drv_messageTable[] =
 {
-   // {Command ID, Message Handler Function Pointer}
-   { 1, RTC_Drv_MessageRouter_GetCurrentDateTime },
-   { 2, RTC_Drv_MessageRouter_SetCurrentDateTime },
+   // {Command ID, Message Handler Function Pointer, Cache Max Age (ms)}
+   { 1, RTC_Drv_MessageRouter_GetCurrentDateTime, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 2, RTC_Drv_MessageRouter_SetCurrentDateTime, LUNAR_MESSAGEROUTER_CACHE_NEVER },
 };
 
 #ifdef __cplusplus
@@ -8,11 +8,15 @@
 
 // Module Includes
 #include "ReportMgr.h"
+#include "ReportMgr_ConfigTable.h"
 #include "ReportMgr_CAN.h"
 // Platform Includes
 #include "CAN_Drv.h"
 #include "Platform.h"
+#include "Lunar_ErrorMgr.h"
 #include "Lunar_SoftTimerLib.h"
+#include "Lunar_TimeSync.h"
+#include "Timebase_Drv.h"
 // Other Includes
 #include "Control.h"
 #include <stdbool.h>
@@ -24,6 +28,19 @@
 // Private Constant Definitions
 *******************************************************************************/
 
+// The CAN identifier of the error status broadcast, always a 29-bit identifier
+#define ERROR_STATUS_CANID (BB_ErrorStatusRSP_CANID | 0x80000000U)
+
+// The minimum time between error status frames in milliseconds
+// Changes within this time are merged into the next frame
+#define ERROR_STATUS_MIN_INTERVAL_MS (5U)
+
+// The time between repeated error status frames while no error changes
+#define ERROR_STATUS_REPEAT_INTERVAL_MS (1000U)
+
+// The number of messages in the transmit schedule
+#define NUM_TX_SCHEDULE_ITEMS (sizeof(ReportMgr_txScheduleTable) / sizeof(ReportMgr_TxScheduleItem_t))
+
 
 /*******************************************************************************
 // Private Type Declarations
@@ -34,6 +51,24 @@ typedef struct
 {
 	// Last update timestamp
 	uint32_t lastUpdateTimestamp;	
+
+   // true once the CAN driver can accept frames
+   bool initialized;
+
+   // true if an error change has not been broadcast yet
+   bool errorStatusPending;
+
+   // Incremented on every error change so receivers can detect merged frames
+   uint16_t errorSequence;
+
+   // The number of error changes since the last error status frame
+   uint16_t numErrorChanges;
+
+   // The time the last error status frame was queued
+   uint32_t lastErrorStatusTime;
+
+   // The time each scheduled message is due next
+   uint32_t nextTxTime[NUM_TX_SCHEDULE_ITEMS];
 } ReportMgr_Status_t;
 
 
@@ -49,11 +84,189 @@ static ReportMgr_Status_t status;
 // Private Function Declarations
 *******************************************************************************/
 
+/** Description:
+  *    This function fills an error status frame with the current errors.
+  * Parameters:
+  *    errorStatus :  The frame to be filled
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void BuildErrorStatus(BB_ErrorStatusRSP_t *const errorStatus) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function queues the error status frame on the CAN bus when a
+  *    change is pending and the minimum interval has passed, or when the
+  *    repeat interval has passed.  A frame that cannot be queued is retried
+  *    on the next call.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void SendErrorStatus(void);
+
+/** Description:
+  *    This function sends the first scheduled message that is due.  A message
+  *    that cannot be queued stays due and is retried on the next call.  A
+  *    message that fell more than a cycle behind is rescheduled from the
+  *    current time instead of sending the missed frames in a burst.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void ServiceTxSchedule(void);
+
+/** Description:
+  *    This function moves every scheduled message to the next time its
+  *    phase offset is reached in synchronized time, so the reports of all
+  *    nodes are sampled at the same time.  The instance closest to the time
+  *    the message was due is used, so a small correction of the time
+  *    neither sends a message twice nor skips it.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void AlignSchedule(void);
+
 
 /*******************************************************************************
 // Private Function Implementations
 *******************************************************************************/
 
+// Fill the error status frame
+static void BuildErrorStatus(BB_ErrorStatusRSP_t *const errorStatus)
+{
+   uint32_t errorWords[LUNAR_ERRORMGR_NUM_ERROR_WORDS];
+
+   // The frame carries the first 32 errors, one bit per error
+   Lunar_ErrorMgr_GetErrorWords(errorWords);
+
+   errorStatus->ActiveErrors = errorWords[0];
+   errorStatus->ErrorSequence = status.errorSequence;
+   errorStatus->NumErrorChanges = status.numErrorChanges;
+}
+
+
+// Queue the error status frame if the rate limit allows it
+static void SendErrorStatus(void)
+{
+   uint32_t currentTime = Timebase_Drv_GetCurrentTickCount();
+   uint32_t elapsedTime = currentTime - status.lastErrorStatusTime;
+
+   // Send a change as soon as the minimum interval allows, otherwise repeat the state slowly
+   if (((status.errorStatusPending) && (elapsedTime >= (ERROR_STATUS_MIN_INTERVAL_MS * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND))) ||
+       (elapsedTime >= (ERROR_STATUS_REPEAT_INTERVAL_MS * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND)))
+   {
+      BB_ErrorStatusRSP_t errorStatus;
+      uint8_t frameData[BB_ErrorStatusRSP_DLC];
+
+      BuildErrorStatus(&errorStatus);
+      BB_ErrorStatusRSP_Pack(frameData, &errorStatus);
+
+      // The previous frame may still be waiting for the bus, try again next time
+      if (CAN_Drv_StartTransmitFrame(CAN_DRV_CHANNEL_PRIMARY, ERROR_STATUS_CANID, frameData, (uint8_t)BB_ErrorStatusRSP_DLC))
+      {
+         status.errorStatusPending = false;
+         status.numErrorChanges = 0U;
+         status.lastErrorStatusTime = currentTime;
+      }
+   }
+}
+
+
+// Send the next scheduled message
+static void ServiceTxSchedule(void)
+{
+   uint32_t currentTime = Timebase_Drv_GetCurrentTickCount();
+   bool frameQueued = false;
+
+   // Only one frame is queued per call, later messages wait for the next call
+   for (uint32_t i = 0U; (i < NUM_TX_SCHEDULE_ITEMS) && (!frameQueued); i++)
+   {
+      const ReportMgr_TxScheduleItem_t *item = &ReportMgr_txScheduleTable[i];
+
+      // The signed difference handles the wrap of the tick count
+      if ((int32_t)(currentTime - status.nextTxTime[i]) >= 0)
+      {
+         // The message functions pack the signals byte by byte into the frame
+         uint8_t frameData[CAN_DRV_MAX_DATA_LENGTH];
+         Lunar_MessageRouter_Message_t message;
+
+         // Build an internal request for the message, without command parameters
+         message.header.moduleID = (uint8_t)(item->canId >> 8U);
+         message.header.commandID = (uint8_t)item->canId;
+         message.header.messageID = 0U;
+         message.commandParams.data = frameData;
+         message.commandParams.maxLength = (uint8_t)sizeof(frameData);
+         message.commandParams.length = 0U;
+         message.responseParams.data = frameData;
+         message.responseParams.maxLength = (uint8_t)sizeof(frameData);
+         message.responseParams.length = 0U;
+         message.responseCode = LUNAR_MESSAGEROUTER_RESPONSE_CODE_None;
+         message.source.transport = LUNAR_MESSAGEROUTER_TRANSPORT_Internal;
+         message.source.channel = 0U;
+         message.source.address = 0U;
+         message.source.timestamp = Timebase_Drv_GetCycleCount();
+
+         item->packFunction(&message);
+
+         // A message that cannot be packed skips this cycle rather than retrying forever
+         bool isPacked = (message.responseCode == LUNAR_MESSAGEROUTER_RESPONSE_CODE_None);
+
+         if ((isPacked) && (!CAN_Drv_StartTransmitFrame(CAN_DRV_CHANNEL_PRIMARY, item->canId, frameData, message.responseParams.length)))
+         {
+            // The previous frame is still waiting for the bus, try again next time
+            break;
+         }
+
+         frameQueued = isPacked;
+
+         // Keep the phase of the message
+         status.nextTxTime[i] += (uint32_t)item->cycleTimeMs * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND;
+
+         // Do not catch up on missed frames
+         if ((int32_t)(currentTime - status.nextTxTime[i]) >= 0)
+         {
+            status.nextTxTime[i] = currentTime + ((uint32_t)item->cycleTimeMs * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND);
+         }
+      }
+   }
+}
+
+
+// Align the schedule to the synchronized time
+static void AlignSchedule(void)
+{
+   uint32_t currentTime = Timebase_Drv_GetCurrentTickCount();
+   uint64_t syncTime = (Lunar_TimeSync_GetTimeUs() / 1000U) * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND;
+
+   for (uint32_t i = 0U; i < NUM_TX_SCHEDULE_ITEMS; i++)
+   {
+      const ReportMgr_TxScheduleItem_t *item = &ReportMgr_txScheduleTable[i];
+      uint32_t cycleTime = (uint32_t)item->cycleTimeMs * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND;
+      uint32_t phaseOffset = ((uint32_t)item->phaseOffsetMs * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND) % cycleTime;
+      uint32_t alignedTime = currentTime + ((phaseOffset + cycleTime - (uint32_t)(syncTime % cycleTime)) % cycleTime);
+      int32_t difference = (int32_t)(alignedTime - status.nextTxTime[i]);
+
+      // A message that was just sent waits for the next cycle, one that is
+      // just due is sent right away by the next update
+      if (difference < -(int32_t)(cycleTime / 2U))
+      {
+         alignedTime += cycleTime;
+      }
+      else if (difference > (int32_t)(cycleTime / 2U))
+      {
+         alignedTime -= cycleTime;
+      }
+      else
+      {
+         // Close to the time it was due
+      }
+
+      status.nextTxTime[i] = alignedTime;
+   }
+}
+
 
 /*******************************************************************************
 // Public Function Implementations
@@ -64,13 +277,58 @@ void ReportMgr_Init(void)
 {
 	// Clear the last update timestamp
 	status.lastUpdateTimestamp = 0;
+
+   // Announce the current errors right away
+   // Changes made before this point are already counted in the sequence
+   status.errorStatusPending = true;
+   status.lastErrorStatusTime = Timebase_Drv_GetCurrentTickCount() - (ERROR_STATUS_MIN_INTERVAL_MS * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND);
+
+   // Start every scheduled message at its phase offset
+   uint32_t currentTime = Timebase_Drv_GetCurrentTickCount();
+   for (uint32_t i = 0U; i < NUM_TX_SCHEDULE_ITEMS; i++)
+   {
+      status.nextTxTime[i] = currentTime + ((uint32_t)ReportMgr_txScheduleTable[i].phaseOffsetMs * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND);
+   }
+
+   status.initialized = true;
 }
 
 // Periodic update function
 void ReportMgr_Update(void)
 {
-   // TODO add functionality
-   return;
+   // Error changes go first, they share the transmit queue with the schedule
+   SendErrorStatus();
+
+   // Stream the periodic messages
+   ServiceTxSchedule();
+}
+
+
+// Note an error change
+void ReportMgr_ErrorChanged(void)
+{
+   status.errorSequence++;
+
+   if (status.numErrorChanges < UINT16_MAX)
+   {
+      status.numErrorChanges++;
+   }
+
+   status.errorStatusPending = true;
+
+   // Send the change without waiting for the next update
+   // The CAN driver is not ready until this module has been initialized
+   if (status.initialized)
+   {
+      SendErrorStatus();
+   }
+}
+
+
+// Keep the schedule in step with the synchronized time
+void ReportMgr_TimeSynchronized(void)
+{
+   AlignSchedule();
 }
 
 
@@ -78,6 +336,38 @@ void ReportMgr_Update(void)
 // Message Router Function Implementations
 *******************************************************************************/
 
+// BB_ErrorStatusRSP
+void ReportMgr_MessageRouter_BB_ErrorStatusRSP(Lunar_MessageRouter_Message_t *const message)
+{
+   // Command/Response Params defined in ReportMgr_CAN.h file
+   typedef BB_ErrorStatusRSP_t Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, BB_ErrorStatusRSP_DLC))
+   {
+      // Fill in the signals, they are packed into the response buffer below
+      Response_t response = {0};
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      // The same frame that is broadcast on every error change
+      BuildErrorStatus(&response);
+
+      // Pack the signals into the frame layout of the DBC
+      BB_ErrorStatusRSP_Pack(message->responseParams.data, &response);
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, BB_ErrorStatusRSP_DLC);
+   }
+}
+
 // BB_BatteryStatusRSP
 void ReportMgr_MessageRouter_BB_BatteryStatusRSP(Lunar_MessageRouter_Message_t *const message)
 {
@@ -90,26 +380,29 @@ void ReportMgr_MessageRouter_BB_BatteryStatusRSP(Lunar_MessageRouter_Message_t *
 
    // Verify the length of the command parameters and make sure we have room for the response
    //	Note that the error response will be set, if necessary
-   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, BB_BatteryStatusRSP_DLC))
    {
-      // Cast the response buffer as the response type
-      Response_t *response = (Response_t *)message->responseParams.data;
+      // Fill in the signals, they are packed into the response buffer below
+      Response_t response = {0};
 
       //-----------------------------------------------
       // Execute Command
       //-----------------------------------------------
      
       //      Bits=16.  [ 0     , 255    ]  Unit:''     
-      response->BatteryBlockState = (uint8_t)Control_GetState();
+      response.BatteryBlockState = (uint8_t)Control_GetState();
       //      Bits=16.  [ 0     , 65.535 ]  Unit:''      Factor= 0.001 
-      response->BatteryVoltageV = BB_BatteryStatusRSP_BatteryVoltageV_toS(3);
+      response.BatteryVoltageV = BB_BatteryStatusRSP_BatteryVoltageV_toS(3);
       //      Bits=16.  [ 0     , 102.3  ]  Unit:''      Factor= 0.1   
-      response->BatteryCurrentA = BB_BatteryStatusRSP_BatteryCurrentA_toS(100); 
+      response.BatteryCurrentA = BB_BatteryStatusRSP_BatteryCurrentA_toS(100); 
       //      Bits=16.  [ 0     , 255    ]  Unit:''     
-      response->BatterySOC = BB_BatteryStatusRSP_BatterySOC_toS(100);
+      response.BatterySOC = BB_BatteryStatusRSP_BatterySOC_toS(100);
+
+      // Pack the signals into the frame layout of the DBC
+      BB_BatteryStatusRSP_Pack(message->responseParams.data, &response);
 
       // Set the response length
-      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+      Lunar_MessageRouter_SetResponseSize(message, BB_BatteryStatusRSP_DLC);
    }
 }
 
@@ -125,7 +418,7 @@ void ReportMgr_MessageRouter_BB_DCDCStatusRSP(Lunar_MessageRouter_Message_t *con
 
    // Verify the length of the command parameters and make sure we have room for the response
    //	Note that the error response will be set, if necessary
-   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, BB_DCDCStatusRSP_DLC))
    {
       //-----------------------------------------------
       // Message Processing
@@ -133,22 +426,25 @@ void ReportMgr_MessageRouter_BB_DCDCStatusRSP(Lunar_MessageRouter_Message_t *con
 
       // Verify the length of the command parameters and make sure we have room for the response
       //	Note that the error response will be set, if necessary
-      if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+      if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, BB_DCDCStatusRSP_DLC))
       {
-         // Cast the response buffer as the response type
-         Response_t *response = (Response_t *)message->responseParams.data;
+         // Fill in the signals, they are packed into the response buffer below
+         Response_t response = {0};
 
          //-----------------------------------------------
          // Execute Command
          //-----------------------------------------------
 
          //      Bits=16.  [ 0     , 655.35 ]  Unit:''      Factor= 0.01  
-         response->DCBusVoltageV = BB_DCDCStatusRSP_DCBusVoltageV_toS(300);
+         response.DCBusVoltageV = BB_DCDCStatusRSP_DCBusVoltageV_toS(300);
          //  [-] Bits=16.  [ -163.84, 163.835 ]  Unit:''      Factor= 0.005        
-         response->DCBusCurrentA = BB_DCDCStatusRSP_DCBusCurrentA_toS(100);                   
+         response.DCBusCurrentA = BB_DCDCStatusRSP_DCBusCurrentA_toS(100);                   
+
+         // Pack the signals into the frame layout of the DBC
+         BB_DCDCStatusRSP_Pack(message->responseParams.data, &response);
 
          // Set the response length
-         Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+         Lunar_MessageRouter_SetResponseSize(message, BB_DCDCStatusRSP_DLC);
       }
    }
 }
@@ -165,7 +461,7 @@ void ReportMgr_MessageRouter_BB_CellVoltage1to4RSP(Lunar_MessageRouter_Message_t
 
    // Verify the length of the command parameters and make sure we have room for the response
    //	Note that the error response will be set, if necessary
-   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, BB_CellVoltage1to4RSP_DLC))
    {
       //-----------------------------------------------
       // Message Processing
@@ -173,26 +469,29 @@ void ReportMgr_MessageRouter_BB_CellVoltage1to4RSP(Lunar_MessageRouter_Message_t
 
       // Verify the length of the command parameters and make sure we have room for the response
       //	Note that the error response will be set, if necessary
-      if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+      if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, BB_CellVoltage1to4RSP_DLC))
       {
-         // Cast the response buffer as the response type
-         Response_t *response = (Response_t *)message->responseParams.data;
+         // Fill in the signals, they are packed into the response buffer below
+         Response_t response = {0};
 
          //-----------------------------------------------
          // Execute Command
          //-----------------------------------------------
 
          //      Bits=16.  [ 0     , 65.535 ]  Unit:''      Factor= 0.001 
-         response->Cell1V = BB_CellVoltage1to4RSP_Cell1V_toS(3.01);
+         response.Cell1V = BB_CellVoltage1to4RSP_Cell1V_toS(3.01);
          //      Bits=16.  [ 0     , 65.535 ]  Unit:''      Factor= 0.001 
-         response->Cell2V = BB_CellVoltage1to4RSP_Cell2V_toS(3.02);                        
+         response.Cell2V = BB_CellVoltage1to4RSP_Cell2V_toS(3.02);                        
          //      Bits=16.  [ 0     , 65.535 ]  Unit:''      Factor= 0.001 
-         response->Cell3V = BB_CellVoltage1to4RSP_Cell3V_toS(3.03);
+         response.Cell3V = BB_CellVoltage1to4RSP_Cell3V_toS(3.03);
          //      Bits=16.  [ 0     , 65.535 ]  Unit:''      Factor= 0.001 
-         response->Cell4V = BB_CellVoltage1to4RSP_Cell4V_toS(3.04);
+         response.Cell4V = BB_CellVoltage1to4RSP_Cell4V_toS(3.04);
+
+         // Pack the signals into the frame layout of the DBC
+         BB_CellVoltage1to4RSP_Pack(message->responseParams.data, &response);
 
          // Set the response length
-         Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+         Lunar_MessageRouter_SetResponseSize(message, BB_CellVoltage1to4RSP_DLC);
       }
    }
 }
@@ -209,7 +508,7 @@ void ReportMgr_MessageRouter_BB_CellVoltage5to8RSP(Lunar_MessageRouter_Message_t
 
    // Verify the length of the command parameters and make sure we have room for the response
    //	Note that the error response will be set, if necessary
-   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, BB_CellVoltage5to8RSP_DLC))
    {
       //-----------------------------------------------
       // Message Processing
@@ -217,26 +516,29 @@ void ReportMgr_MessageRouter_BB_CellVoltage5to8RSP(Lunar_MessageRouter_Message_t
 
       // Verify the length of the command parameters and make sure we have room for the response
       //	Note that the error response will be set, if necessary
-      if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+      if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, BB_CellVoltage5to8RSP_DLC))
       {
-         // Cast the response buffer as the response type
-         Response_t *response = (Response_t *)message->responseParams.data;
+         // Fill in the signals, they are packed into the response buffer below
+         Response_t response = {0};
 
          //-----------------------------------------------
          // Execute Command
          //-----------------------------------------------
 
          //      Bits=16.  [ 0     , 65.535 ]  Unit:''      Factor= 0.001 
-         response->Cell5V = BB_CellVoltage5to8RSP_Cell5V_toS(3.05);
+         response.Cell5V = BB_CellVoltage5to8RSP_Cell5V_toS(3.05);
          //      Bits=16.  [ 0     , 65.535 ]  Unit:''      Factor= 0.001 
-         response->Cell6V = BB_CellVoltage5to8RSP_Cell6V_toS(3.06);                        
+         response.Cell6V = BB_CellVoltage5to8RSP_Cell6V_toS(3.06);                        
          //      Bits=16.  [ 0     , 65.535 ]  Unit:''      Factor= 0.001 
-         response->Cell7V = BB_CellVoltage5to8RSP_Cell7V_toS(3.07);
+         response.Cell7V = BB_CellVoltage5to8RSP_Cell7V_toS(3.07);
          //      Bits=16.  [ 0     , 65.535 ]  Unit:''      Factor= 0.001 
-         response->Cell8V = BB_CellVoltage5to8RSP_Cell8V_toS(3.08);
+         response.Cell8V = BB_CellVoltage5to8RSP_Cell8V_toS(3.08);
+
+         // Pack the signals into the frame layout of the DBC
+         BB_CellVoltage5to8RSP_Pack(message->responseParams.data, &response);
 
          // Set the response length
-         Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+         Lunar_MessageRouter_SetResponseSize(message, BB_CellVoltage5to8RSP_DLC);
       }
    }
 }
@@ -253,7 +555,7 @@ void ReportMgr_MessageRouter_BB_CellVoltage9to12RSP(Lunar_MessageRouter_Message_
 
    // Verify the length of the command parameters and make sure we have room for the response
    //	Note that the error response will be set, if necessary
-   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, BB_CellVoltage9to12RSP_DLC))
    {
       //-----------------------------------------------
       // Message Processing
@@ -261,26 +563,29 @@ void ReportMgr_MessageRouter_BB_CellVoltage9to12RSP(Lunar_MessageRouter_Message_
 
       // Verify the length of the command parameters and make sure we have room for the response
       //	Note that the error response will be set, if necessary
-      if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+      if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, BB_CellVoltage9to12RSP_DLC))
       {
-         // Cast the response buffer as the response type
-         Response_t *response = (Response_t *)message->responseParams.data;
+         // Fill in the signals, they are packed into the response buffer below
+         Response_t response = {0};
 
          //-----------------------------------------------
          // Execute Command
          //-----------------------------------------------
 
          //      Bits=16.  [ 0     , 65.535 ]  Unit:''      Factor= 0.001 
-         response->Cell9V = BB_CellVoltage9to12RSP_Cell9V_toS(3.09);
+         response.Cell9V = BB_CellVoltage9to12RSP_Cell9V_toS(3.09);
          //      Bits=16.  [ 0     , 65.535 ]  Unit:''      Factor= 0.001 
-         response->Cell10V = BB_CellVoltage9to12RSP_Cell10V_toS(3.10);                        
+         response.Cell10V = BB_CellVoltage9to12RSP_Cell10V_toS(3.10);                        
          //      Bits=16.  [ 0     , 65.535 ]  Unit:''      Factor= 0.001 
-         response->Cell11V = BB_CellVoltage9to12RSP_Cell11V_toS(3.11);
+         response.Cell11V = BB_CellVoltage9to12RSP_Cell11V_toS(3.11);
          //      Bits=16.  [ 0     , 65.535 ]  Unit:''      Factor= 0.001 
-         response->Cell12V = BB_CellVoltage9to12RSP_Cell12V_toS(3.12);
+         response.Cell12V = BB_CellVoltage9to12RSP_Cell12V_toS(3.12);
+
+         // Pack the signals into the frame layout of the DBC
+         BB_CellVoltage9to12RSP_Pack(message->responseParams.data, &response);
 
          // Set the response length
-         Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+         Lunar_MessageRouter_SetResponseSize(message, BB_CellVoltage9to12RSP_DLC);
       }
    }
 }
@@ -297,7 +602,7 @@ void ReportMgr_MessageRouter_BB_CellTempRSP(Lunar_MessageRouter_Message_t *const
 
    // Verify the length of the command parameters and make sure we have room for the response
    //	Note that the error response will be set, if necessary
-   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, BB_CellTempRSP_DLC))
    {
       //-----------------------------------------------
       // Message Processing
@@ -305,30 +610,33 @@ void ReportMgr_MessageRouter_BB_CellTempRSP(Lunar_MessageRouter_Message_t *const
 
       // Verify the length of the command parameters and make sure we have room for the response
       //	Note that the error response will be set, if necessary
-      if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+      if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, BB_CellTempRSP_DLC))
       {
-         // Cast the response buffer as the response type
-         Response_t *response = (Response_t *)message->responseParams.data;
+         // Fill in the signals, they are packed into the response buffer below
+         Response_t response = {0};
 
          //-----------------------------------------------
          // Execute Command
          //-----------------------------------------------
 
          //      Bits=08.  [ -40   , 87.5   ]  Unit:''      Offset= -40       Factor= 0.5   
-         response->Submodule1C = BB_CellTempRSP_Submodule1C_toS(21.5);
+         response.Submodule1C = BB_CellTempRSP_Submodule1C_toS(21.5);
          //      Bits=08.  [ -40   , 87.5   ]  Unit:''      Offset= -40       Factor= 0.5   
-         response->Submodule2C = BB_CellTempRSP_Submodule2C_toS(22.5);
+         response.Submodule2C = BB_CellTempRSP_Submodule2C_toS(22.5);
          //      Bits=08.  [ -40   , 87.5   ]  Unit:''      Offset= -40       Factor= 0.5   
-         response->Submodule3C = BB_CellTempRSP_Submodule3C_toS(23.5);
+         response.Submodule3C = BB_CellTempRSP_Submodule3C_toS(23.5);
          //      Bits=08.  [ -40   , 87.5   ]  Unit:''      Offset= -40       Factor= 0.5   
-         response->Submodule4C = BB_CellTempRSP_Submodule4C_toS(24.5);
+         response.Submodule4C = BB_CellTempRSP_Submodule4C_toS(24.5);
          //      Bits=08.  [ -40   , 87.5   ]  Unit:''      Offset= -40       Factor= 0.5   
-         response->Submodule5C = BB_CellTempRSP_Submodule5C_toS(25.5);
+         response.Submodule5C = BB_CellTempRSP_Submodule5C_toS(25.5);
          //      Bits=08.  [ -40   , 87.5   ]  Unit:''      Offset= -40       Factor= 0.5   
-         response->Submodule6C = BB_CellTempRSP_Submodule6C_toS(26.5);
+         response.Submodule6C = BB_CellTempRSP_Submodule6C_toS(26.5);
+
+         // Pack the signals into the frame layout of the DBC
+         BB_CellTempRSP_Pack(message->responseParams.data, &response);
 
          // Set the response length
-         Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+         Lunar_MessageRouter_SetResponseSize(message, BB_CellTempRSP_DLC);
       }
    }
 }
@@ -345,7 +653,7 @@ void ReportMgr_MessageRouter_BB_DCDCTemperaturesRSP(Lunar_MessageRouter_Message_
 
    // Verify the length of the command parameters and make sure we have room for the response
    //	Note that the error response will be set, if necessary
-   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, BB_DCDCTemperaturesRSP_DLC))
    {
       //-----------------------------------------------
       // Message Processing
@@ -353,22 +661,25 @@ void ReportMgr_MessageRouter_BB_DCDCTemperaturesRSP(Lunar_MessageRouter_Message_
 
       // Verify the length of the command parameters and make sure we have room for the response
       //	Note that the error response will be set, if necessary
-      if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+      if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, BB_DCDCTemperaturesRSP_DLC))
       {
-         // Cast the response buffer as the response type
-         Response_t *response = (Response_t *)message->responseParams.data;
+         // Fill in the signals, they are packed into the response buffer below
+         Response_t response = {0};
 
          //-----------------------------------------------
          // Execute Command
          //-----------------------------------------------
 
          //      Bits=16.  [ -60   , 195    ]  Unit:''      Offset= -60      
-         response->BBHeatsinkC = BB_DCDCTemperaturesRSP_BBHeatsinkC_toS(20);
+         response.BBHeatsinkC = BB_DCDCTemperaturesRSP_BBHeatsinkC_toS(20);
          //      Bits=16.  [ 0     , 102.3  ]  Unit:''      Factor= 0.1   
-         response->FanDutyCycle = BB_DCDCTemperaturesRSP_FanDutyCycle_toS(90.5);
+         response.FanDutyCycle = BB_DCDCTemperaturesRSP_FanDutyCycle_toS(90.5);
+
+         // Pack the signals into the frame layout of the DBC
+         BB_DCDCTemperaturesRSP_Pack(message->responseParams.data, &response);
 
          // Set the response length
-         Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+         Lunar_MessageRouter_SetResponseSize(message, BB_DCDCTemperaturesRSP_DLC);
       }
    }
 }
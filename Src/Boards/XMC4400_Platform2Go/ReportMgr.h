@@ -30,6 +30,22 @@ extern "C"
 // Public Type Declarations
 *******************************************************************************/
 
+// This structure defines an entry in the CAN transmit schedule table
+typedef struct
+{
+   // The CAN identifier, bit 31 selects a 29-bit extended identifier
+   uint32_t canId;
+
+   // The time between frames in milliseconds
+   uint16_t cycleTimeMs;
+
+   // The delay of the first frame after initialization in milliseconds
+   uint16_t phaseOffsetMs;
+
+   // The Message Router handler that packs the frame data
+   Lunar_MessageRouter_MessageHandler_t packFunction;
+} ReportMgr_TxScheduleItem_t;
+
 
 /*******************************************************************************
 // Public Function Declarations
@@ -45,18 +61,53 @@ void ReportMgr_Init(void);
 
 /** Description:
   *    This is the periodic scheduled function that builds and sends out reports
-  *    for the system.
+  *    for the system.  The messages in the transmit schedule table are sent
+  *    at their cycle time, one frame per call at most.
   * History: 
   *    * 6/6/2021: Function created (EJH)
+  *    * 10/19/2026: Stream the transmit schedule table (EJH)
   *                                                              
 */
 void ReportMgr_Update(void);
 
+/** Description:
+  *    This function is the callback for the error changed event.  The new
+  *    error state is broadcast on the CAN bus right away, limited to one
+  *    frame every few milliseconds, so other nodes do not need to poll.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void ReportMgr_ErrorChanged(void);
+
+/** Description:
+  *    This function is the callback for the time synchronized event.  The
+  *    messages are moved to their phase offsets in synchronized time, so
+  *    the reports of every node are sampled at the same time.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void ReportMgr_TimeSynchronized(void);
+
 
 /*******************************************************************************
 // Message Router Function Declarations
 *******************************************************************************/
 
+/** Description:
+  *    This function retrieves the information for the BB_ErrorStatusRSP message.
+  *    The bit-packed error flags are the same as the broadcast frame.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void ReportMgr_MessageRouter_BB_ErrorStatusRSP(Lunar_MessageRouter_Message_t *const message);
+
 /** Description:
   *    This function retrieves the information for the BB_BatteryStatus message.
   * Parameters:
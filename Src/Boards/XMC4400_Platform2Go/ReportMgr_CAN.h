@@ -33,33 +33,6 @@ typedef struct
 #define INV_L2NStatusRSP_DLC (8U)
 // INV_L2NStatusRSP CAN Message (70657)
 #define INV_L2NStatusRSP_CANID (0x1A001U)
-// signal: @L1NVoltageVrms
-#define INV_L2NStatusRSP_L1NVoltageVrms_CovFactor (0.01)
-// conversion value to CAN signal
-#define INV_L2NStatusRSP_L1NVoltageVrms_toS(x) ((uint16_t)((x) / 0.01))
-// conversion value from CAN signal
-#define INV_L2NStatusRSP_L1NVoltageVrms_fromS(x) ((x) * 0.01)
-
-// signal: @L2NVoltageVrms
-#define INV_L2NStatusRSP_L2NVoltageVrms_CovFactor (0.01)
-// conversion value to CAN signal
-#define INV_L2NStatusRSP_L2NVoltageVrms_toS(x) ((uint16_t)((x) / 0.01))
-// conversion value from CAN signal
-#define INV_L2NStatusRSP_L2NVoltageVrms_fromS(x) ((x) * 0.01)
-
-// signal: @L1NCurrentArms
-#define INV_L2NStatusRSP_L1NCurrentArms_CovFactor (0.005)
-// conversion value to CAN signal
-#define INV_L2NStatusRSP_L1NCurrentArms_toS(x) ((uint16_t)((x) / 0.005))
-// conversion value from CAN signal
-#define INV_L2NStatusRSP_L1NCurrentArms_fromS(x) ((x) * 0.005)
-
-// signal: @L2NCurrentArms
-#define INV_L2NStatusRSP_L2NCurrentArms_CovFactor (0.005)
-// conversion value to CAN signal
-#define INV_L2NStatusRSP_L2NCurrentArms_toS(x) ((uint16_t)((x) / 0.005))
-// conversion value from CAN signal
-#define INV_L2NStatusRSP_L2NCurrentArms_fromS(x) ((x) * 0.005)
 
 // INV_L2NStatusRSP CAN Message (70657)
 typedef struct
@@ -78,19 +51,7 @@ typedef struct
 #define INV_L2LStatusRSP_DLC (4U)
 // INV_L2LStatusRSP CAN Message (70658)
 #define INV_L2LStatusRSP_CANID (0x1A002U)
-// signal: @L1L2VoltageVrms
-#define INV_L2LStatusRSP_L1L2VoltageVrms_CovFactor (0.01)
-// conversion value to CAN signal
-#define INV_L2LStatusRSP_L1L2VoltageVrms_toS(x) ((uint16_t)((x) / 0.01))
-// conversion value from CAN signal
-#define INV_L2LStatusRSP_L1L2VoltageVrms_fromS(x) ((x) * 0.01)
-
-// signal: @L1L2CurrentArms
-#define INV_L2LStatusRSP_L1L2CurrentArms_CovFactor (0.005)
-// conversion value to CAN signal
-#define INV_L2LStatusRSP_L1L2CurrentArms_toS(x) ((uint16_t)((x) / 0.005))
-// conversion value from CAN signal
-#define INV_L2LStatusRSP_L1L2CurrentArms_fromS(x) ((x) * 0.005)
+
 // INV_L2LStatusRSP CAN Message (70658)
 typedef struct
 {
@@ -104,33 +65,6 @@ typedef struct
 #define INV_DCBusStatusRSP_DLC (8U)
 // INV_DCBusStatusRSP CAN Message (70659)
 #define INV_DCBusStatusRSP_CANID (0x1A003U)
-// signal: @PosBusVoltage
-#define INV_DCBusStatusRSP_PosBusVoltage_CovFactor (0.01)
-// conversion value to CAN signal
-#define INV_DCBusStatusRSP_PosBusVoltage_toS(x) ((uint16_t)((x) / 0.01))
-// conversion value from CAN signal
-#define INV_DCBusStatusRSP_PosBusVoltage_fromS(x) ((x) * 0.01)
-
-// signal: @NegBusVoltage
-#define INV_DCBusStatusRSP_NegBusVoltage_CovFactor (0.01)
-// conversion value to CAN signal
-#define INV_DCBusStatusRSP_NegBusVoltage_toS(x) ((uint16_t)((x) / 0.01))
-// conversion value from CAN signal
-#define INV_DCBusStatusRSP_NegBusVoltage_fromS(x) ((x) * 0.01)
-
-// signal: @PosBusCurrent
-#define INV_DCBusStatusRSP_PosBusCurrent_CovFactor (0.005)
-// conversion value to CAN signal
-#define INV_DCBusStatusRSP_PosBusCurrent_toS(x) ((uint16_t)((x) / 0.005))
-// conversion value from CAN signal
-#define INV_DCBusStatusRSP_PosBusCurrent_fromS(x) ((x) * 0.005)
-
-// signal: @NegBusCurrent
-#define INV_DCBusStatusRSP_NegBusCurrent_CovFactor (0.005)
-// conversion value to CAN signal
-#define INV_DCBusStatusRSP_NegBusCurrent_toS(x) ((uint16_t)((x) / 0.005))
-// conversion value from CAN signal
-#define INV_DCBusStatusRSP_NegBusCurrent_fromS(x) ((x) * 0.005)
 
 // INV_DCBusStatusRSP CAN Message (70659)
 typedef struct
@@ -149,47 +83,7 @@ typedef struct
 #define INV_TemperaturesRSP_DLC (8U)
 // INV_TemperaturesRSP CAN Message (70660)
 #define INV_TemperaturesRSP_CANID (0x1A004U)
-// signal: @InvHeatsinkC
-#define INV_TemperaturesRSP_InvHeatsinkC_CovFactor (1)
-// conversion value to CAN signal
-#define INV_TemperaturesRSP_InvHeatsinkC_toS(x) ((int16_t)((x) + 60))
-// conversion value from CAN signal
-#define INV_TemperaturesRSP_InvHeatsinkC_fromS(x) ((x))
-
-// signal: @InvPowerStage1C
-#define INV_TemperaturesRSP_InvPowerStage1C_CovFactor (1)
-// conversion value to CAN signal
-#define INV_TemperaturesRSP_InvPowerStage1C_toS(x) ((int16_t)((x) + 60))
-// conversion value from CAN signal
-#define INV_TemperaturesRSP_InvPowerStage1C_fromS(x) ((x))
-
-// signal: @InvPowerStage2C
-#define INV_TemperaturesRSP_InvPowerStage2C_CovFactor (1)
-// conversion value to CAN signal
-#define INV_TemperaturesRSP_InvPowerStage2C_toS(x) ((int16_t)((x) + 60))
-// conversion value from CAN signal
-#define INV_TemperaturesRSP_InvPowerStage2C_fromS(x) ((x))
-
-// signal: @InvPowerStage3C
-#define INV_TemperaturesRSP_InvPowerStage3C_CovFactor (1)
-// conversion value to CAN signal
-#define INV_TemperaturesRSP_InvPowerStage3C_toS(x) ((int16_t)((x) + 60))
-// conversion value from CAN signal
-#define INV_TemperaturesRSP_InvPowerStage3C_fromS(x) ((x))
-
-// signal: @InvFanDutyCycle1
-#define INV_TemperaturesRSP_InvFanDutyCycle1_CovFactor (0.1)
-// conversion value to CAN signal
-#define INV_TemperaturesRSP_InvFanDutyCycle1_toS(x) ((uint16_t)((x) / 0.1))
-// conversion value from CAN signal
-#define INV_TemperaturesRSP_InvFanDutyCycle1_fromS(x) ((x) * 0.1)
-
-// signal: @InvFanDutyCycle2
-#define INV_TemperaturesRSP_InvFanDutyCycle2_CovFactor (0.1)
-// conversion value to CAN signal
-#define INV_TemperaturesRSP_InvFanDutyCycle2_toS(x) ((uint16_t)((x) / 0.1))
-// conversion value from CAN signal
-#define INV_TemperaturesRSP_InvFanDutyCycle2_fromS(x) ((x) * 0.1)
+
 // INV_TemperaturesRSP CAN Message (70660)
 typedef struct
 {
@@ -222,6 +116,21 @@ typedef struct
    uint8_t INV_L1L2InPhase;
 } INV_StateRSP_t;
 
+// INV_ErrorStatusRSP CAN Message Length
+#define INV_ErrorStatusRSP_DLC (8U)
+// INV_ErrorStatusRSP CAN Message (70662)
+#define INV_ErrorStatusRSP_CANID (0x1A006U)
+// INV_ErrorStatusRSP CAN Message (70662)
+typedef struct
+{
+   //      Bits=32.  [ 0     , 4294967295 ]  Unit:''
+   uint32_t ActiveErrors;
+   //      Bits=16.  [ 0     , 65535  ]  Unit:''
+   uint16_t ErrorSequence;
+   //      Bits=16.  [ 0     , 65535  ]  Unit:''
+   uint16_t NumErrorChanges;
+} INV_ErrorStatusRSP_t;
+
 // BB_CommandCMD Message Length
 #define BB_CommandCMD_DLC (2U)
 // BB_CommandCMD CAN Message (2817)
@@ -239,26 +148,6 @@ typedef struct
 #define BB_BatteryStatusRSP_DLC (8U)
 // BB_BatteryStatusRSP CAN Message (68097)
 #define BB_BatteryStatusRSP_CANID (0x1B001U)
-// signal: @BatteryVoltageV
-#define BB_BatteryStatusRSP_BatteryVoltageV_CovFactor (0.001)
-// conversion value to CAN signal
-#define BB_BatteryStatusRSP_BatteryVoltageV_toS(x) ((uint16_t)((x) / 0.001))
-// conversion value from CAN signal
-#define BB_BatteryStatusRSP_BatteryVoltageV_fromS(x) ((x) * 0.001)
-
-// signal: @BatteryCurrentA
-#define BB_BatteryStatusRSP_BatteryCurrentA_CovFactor (0.005)
-// conversion value to CAN signal
-#define BB_BatteryStatusRSP_BatteryCurrentA_toS(x) ((int16_t)((x) / 0.005))
-// conversion value from CAN signal
-#define BB_BatteryStatusRSP_BatteryCurrentA_fromS(x) ((x) * 0.005)
-
-// signal: @BatterySOC
-#define BB_BatteryStatusRSP_BatterySOC_CovFactor (0.1)
-// conversion value to CAN signal
-#define BB_BatteryStatusRSP_BatterySOC_toS(x) ((uint16_t)((x) / 0.1))
-// conversion value from CAN signal
-#define BB_BatteryStatusRSP_BatterySOC_fromS(x) ((x) * 0.1)
 
 // BB_BatteryStatusRSP CAN Message (68097)
 typedef struct
@@ -277,19 +166,6 @@ typedef struct
 #define BB_DCDCStatusRSP_DLC (4U)
 // BB_DCDCStatusRSP CAN Message (68098)
 #define BB_DCDCStatusRSP_CANID (0x1B002U)
-// signal: @DCBusVoltageV
-#define BB_DCDCStatusRSP_DCBusVoltageV_CovFactor (0.01)
-// conversion value to CAN signal
-#define BB_DCDCStatusRSP_DCBusVoltageV_toS(x) ((uint16_t)((x) / 0.01))
-// conversion value from CAN signal
-#define BB_DCDCStatusRSP_DCBusVoltageV_fromS(x) ((x) * 0.01)
-
-// signal: @DCBusCurrentA
-#define BB_DCDCStatusRSP_DCBusCurrentA_CovFactor (0.005)
-// conversion value to CAN signal
-#define BB_DCDCStatusRSP_DCBusCurrentA_toS(x) ((int16_t)((x) / 0.005))
-// conversion value from CAN signal
-#define BB_DCDCStatusRSP_DCBusCurrentA_fromS(x) ((x) * 0.005)
 
 // BB_DCDCStatusRSP CAN Message (68098)
 typedef struct
@@ -304,33 +180,6 @@ typedef struct
 #define BB_CellVoltage1to4RSP_DLC (8U)
 // BB_CellVoltage1to4RSP CAN Message (68099)
 #define BB_CellVoltage1to4RSP_CANID (0x1B003U)
-// signal: @Cell1V
-#define BB_CellVoltage1to4RSP_Cell1V_CovFactor (0.001)
-// conversion value to CAN signal
-#define BB_CellVoltage1to4RSP_Cell1V_toS(x) ((uint16_t)((x) / 0.001))
-// conversion value from CAN signal
-#define BB_CellVoltage1to4RSP_Cell1V_fromS(x) ((x) * 0.001)
-
-// signal: @Cell2V
-#define BB_CellVoltage1to4RSP_Cell2V_CovFactor (0.001)
-// conversion value to CAN signal
-#define BB_CellVoltage1to4RSP_Cell2V_toS(x) ((uint16_t)((x) / 0.001))
-// conversion value from CAN signal
-#define BB_CellVoltage1to4RSP_Cell2V_fromS(x) ((x) * 0.001)
-
-// signal: @Cell3V
-#define BB_CellVoltage1to4RSP_Cell3V_CovFactor (0.001)
-// conversion value to CAN signal
-#define BB_CellVoltage1to4RSP_Cell3V_toS(x) ((uint16_t)((x) / 0.001))
-// conversion value from CAN signal
-#define BB_CellVoltage1to4RSP_Cell3V_fromS(x) ((x) * 0.001)
-
-// signal: @Cell4V
-#define BB_CellVoltage1to4RSP_Cell4V_CovFactor (0.001)
-// conversion value to CAN signal
-#define BB_CellVoltage1to4RSP_Cell4V_toS(x) ((uint16_t)((x) / 0.001))
-// conversion value from CAN signal
-#define BB_CellVoltage1to4RSP_Cell4V_fromS(x) ((x) * 0.001)
 
 // BB_CellVoltage1to4RSP CAN Message (68099)
 typedef struct
@@ -345,39 +194,10 @@ typedef struct
    uint16_t Cell4V;
 } BB_CellVoltage1to4RSP_t;
 
-
-
 // BB_CellVoltage5to8RSP Message Length
 #define BB_CellVoltage5to8RSP_DLC (8U)
 // BB_CellVoltage5to8RSP CAN Message (68100)
 #define BB_CellVoltage5to8RSP_CANID (0x1B004U)
-// signal: @Cell5V
-#define BB_CellVoltage5to8RSP_Cell5V_CovFactor (0.001)
-// conversion value to CAN signal
-#define BB_CellVoltage5to8RSP_Cell5V_toS(x) ((uint16_t)((x) / 0.001))
-// conversion value from CAN signal
-#define BB_CellVoltage5to8RSP_Cell5V_fromS(x) ((x) * 0.001)
-
-// signal: @Cell6V
-#define BB_CellVoltage5to8RSP_Cell6V_CovFactor (0.001)
-// conversion value to CAN signal
-#define BB_CellVoltage5to8RSP_Cell6V_toS(x) ((uint16_t)((x) / 0.001))
-// conversion value from CAN signal
-#define BB_CellVoltage5to8RSP_Cell6V_fromS(x) ((x) * 0.001)
-
-// signal: @Cell7V
-#define BB_CellVoltage5to8RSP_Cell7V_CovFactor (0.001)
-// conversion value to CAN signal
-#define BB_CellVoltage5to8RSP_Cell7V_toS(x) ((uint16_t)((x) / 0.001))
-// conversion value from CAN signal
-#define BB_CellVoltage5to8RSP_Cell7V_fromS(x) ((x) * 0.001)
-
-// signal: @Cell8V
-#define BB_CellVoltage5to8RSP_Cell8V_CovFactor (0.001)
-// conversion value to CAN signal
-#define BB_CellVoltage5to8RSP_Cell8V_toS(x) ((uint16_t)((x) / 0.001))
-// conversion value from CAN signal
-#define BB_CellVoltage5to8RSP_Cell8V_fromS(x) ((x) * 0.001)
 
 // BB_CellVoltage5to8RSP CAN Message (68100)
 typedef struct
@@ -392,39 +212,10 @@ typedef struct
    uint16_t Cell8V;
 } BB_CellVoltage5to8RSP_t;
 
-
-
 // BB_CellVoltage9to12RSP Message Length
 #define BB_CellVoltage9to12RSP_DLC (8U)
 // BB_CellVoltage9to12RSP CAN Message (68101)
 #define BB_CellVoltage9to12RSP_CANID (0x1B005U)
-// signal: @Cell9V
-#define BB_CellVoltage9to12RSP_Cell9V_CovFactor (0.001)
-// conversion value to CAN signal
-#define BB_CellVoltage9to12RSP_Cell9V_toS(x) ((uint16_t)((x) / 0.001))
-// conversion value from CAN signal
-#define BB_CellVoltage9to12RSP_Cell9V_fromS(x) ((x) * 0.001)
-
-// signal: @Cell10V
-#define BB_CellVoltage9to12RSP_Cell10V_CovFactor (0.001)
-// conversion value to CAN signal
-#define BB_CellVoltage9to12RSP_Cell10V_toS(x) ((uint16_t)((x) / 0.001))
-// conversion value from CAN signal
-#define BB_CellVoltage9to12RSP_Cell10V_fromS(x) ((x) * 0.001)
-
-// signal: @Cell11V
-#define BB_CellVoltage9to12RSP_Cell11V_CovFactor (0.001)
-// conversion value to CAN signal
-#define BB_CellVoltage9to12RSP_Cell11V_toS(x) ((uint16_t)((x) / 0.001))
-// conversion value from CAN signal
-#define BB_CellVoltage9to12RSP_Cell11V_fromS(x) ((x) * 0.001)
-
-// signal: @Cell12V
-#define BB_CellVoltage9to12RSP_Cell12V_CovFactor (0.001)
-// conversion value to CAN signal
-#define BB_CellVoltage9to12RSP_Cell12V_toS(x) ((uint16_t)((x) / 0.001))
-// conversion value from CAN signal
-#define BB_CellVoltage9to12RSP_Cell12V_fromS(x) ((x) * 0.001)
 
 // BB_CellVoltage9to12RSP CAN Message (68101)
 typedef struct
@@ -443,47 +234,6 @@ typedef struct
 #define BB_CellTempRSP_DLC (6U)
 // BB_CellTempRSP CAN Message (68102)
 #define BB_CellTempRSP_CANID (0x1B006U)
-// signal: @Submodule1C
-#define BB_CellTempRSP_Submodule1C_CovFactor (0.5)
-// conversion value to CAN signal
-#define BB_CellTempRSP_Submodule1C_toS(x) ((int16_t)((x) / 0.5 + 80))
-// conversion value from CAN signal
-#define BB_CellTempRSP_Submodule1C_fromS(x) ((x) * 0.5)
-
-// signal: @Submodule2C
-#define BB_CellTempRSP_Submodule2C_CovFactor (0.5)
-// conversion value to CAN signal
-#define BB_CellTempRSP_Submodule2C_toS(x) ((int16_t)((x) / 0.5 + 80))
-// conversion value from CAN signal
-#define BB_CellTempRSP_Submodule2C_fromS(x) ((x) * 0.5)
-
-// signal: @Submodule3C
-#define BB_CellTempRSP_Submodule3C_CovFactor (0.5)
-// conversion value to CAN signal
-#define BB_CellTempRSP_Submodule3C_toS(x) ((int16_t)((x) / 0.5 + 80))
-// conversion value from CAN signal
-#define BB_CellTempRSP_Submodule3C_fromS(x) ((x) * 0.5)
-
-// signal: @Submodule4C
-#define BB_CellTempRSP_Submodule4C_CovFactor (0.5)
-// conversion value to CAN signal
-#define BB_CellTempRSP_Submodule4C_toS(x) ((int16_t)((x) / 0.5 + 80))
-// conversion value from CAN signal
-#define BB_CellTempRSP_Submodule4C_fromS(x) ((x) * 0.5)
-
-// signal: @Submodule5C
-#define BB_CellTempRSP_Submodule5C_CovFactor (0.5)
-// conversion value to CAN signal
-#define BB_CellTempRSP_Submodule5C_toS(x) ((int16_t)((x) / 0.5 + 80))
-// conversion value from CAN signal
-#define BB_CellTempRSP_Submodule5C_fromS(x) ((x) * 0.5)
-
-// signal: @Submodule6C
-#define BB_CellTempRSP_Submodule6C_CovFactor (0.5)
-// conversion value to CAN signal
-#define BB_CellTempRSP_Submodule6C_toS(x) ((int16_t)((x) / 0.5 + 80))
-// conversion value from CAN signal
-#define BB_CellTempRSP_Submodule6C_fromS(x) ((x) * 0.5)
 
 // BB_CellTempRSP CAN Message (68102)
 typedef struct
@@ -518,19 +268,6 @@ typedef struct
 #define BB_DCDCTemperaturesRSP_DLC (4U)
 // BB_DCDCTemperaturesRSP CAN Message (68103)
 #define BB_DCDCTemperaturesRSP_CANID (0x1B007U)
-// signal: @BBHeatsinkC
-#define BB_DCDCTemperaturesRSP_BBHeatsinkC_CovFactor (1)
-// conversion value to CAN signal
-#define BB_DCDCTemperaturesRSP_BBHeatsinkC_toS(x) ((int32_t)((x) + 60))
-// conversion value from CAN signal
-#define BB_DCDCTemperaturesRSP_BBHeatsinkC_fromS(x) ((x))
-
-// signal: @FanDutyCycle
-#define BB_DCDCTemperaturesRSP_FanDutyCycle_CovFactor (0.1)
-// conversion value to CAN signal
-#define BB_DCDCTemperaturesRSP_FanDutyCycle_toS(x) ((uint16_t)((x) / 0.1))
-// conversion value from CAN signal
-#define BB_DCDCTemperaturesRSP_FanDutyCycle_fromS(x) ((x) * 0.1)
 
 // BB_DCDCTemperaturesRSP CAN Message (68103)
 typedef struct
@@ -543,7 +280,24 @@ typedef struct
    uint16_t FanDutyCycle;
 } BB_DCDCTemperaturesRSP_t;
 
+// BB_ErrorStatusRSP Message Length
+#define BB_ErrorStatusRSP_DLC (8U)
+// BB_ErrorStatusRSP CAN Message (68104)
+#define BB_ErrorStatusRSP_CANID (0x1B008U)
+// BB_ErrorStatusRSP CAN Message (68104)
+typedef struct
+{
+   //      Bits=32.  [ 0     , 4294967295 ]  Unit:''
+   uint32_t ActiveErrors;
+   //      Bits=16.  [ 0     , 65535  ]  Unit:''
+   uint16_t ErrorSequence;
+   //      Bits=16.  [ 0     , 65535  ]  Unit:''
+   uint16_t NumErrorChanges;
+} BB_ErrorStatusRSP_t;
+
+// The message packing and signal conversions are generated from the DBC
+#include "ReportMgr_CANSignals.h"
+
 #ifdef __cplusplus
 }
 #endif
-
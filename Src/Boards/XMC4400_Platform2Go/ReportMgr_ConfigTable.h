@@ -0,0 +1,47 @@
+/*******************************************************************************
+// Report Manager Configuration
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "ReportMgr.h"
+#include "ReportMgr_CAN.h"
+// Platform Includes
+// Other Includes
+
+
+/*******************************************************************************
+// Constant Configuration Variable Declarations
+*******************************************************************************/
+
+// This table defines the messages streamed on the CAN bus
+// Each message is packed by its Message Router handler, so a streamed frame
+// matches the response to a request for the same message.
+// The phase offsets spread the frames evenly, at most one scheduled frame is
+// sent per ReportMgr_Update call.
+static const ReportMgr_TxScheduleItem_t ReportMgr_txScheduleTable[] =
+{
+   // { CAN ID, Cycle (ms), Phase (ms), Packing Function }
+   // The 100 ms messages are spread 20 ms apart, the slower messages fill the gaps
+   { BB_BatteryStatusRSP_CANID | 0x80000000U,    100U,  0U, ReportMgr_MessageRouter_BB_BatteryStatusRSP },
+   { BB_DCDCStatusRSP_CANID | 0x80000000U,       100U, 20U, ReportMgr_MessageRouter_BB_DCDCStatusRSP },
+   { BB_CellVoltage1to4RSP_CANID | 0x80000000U,  500U, 40U, ReportMgr_MessageRouter_BB_CellVoltage1to4RSP },
+   { BB_CellVoltage5to8RSP_CANID | 0x80000000U,  500U, 60U, ReportMgr_MessageRouter_BB_CellVoltage5to8RSP },
+   { BB_CellVoltage9to12RSP_CANID | 0x80000000U, 500U, 80U, ReportMgr_MessageRouter_BB_CellVoltage9to12RSP },
+   { BB_CellTempRSP_CANID | 0x80000000U,         1000U, 50U, ReportMgr_MessageRouter_BB_CellTempRSP },
+   { BB_DCDCTemperaturesRSP_CANID | 0x80000000U, 1000U, 70U, ReportMgr_MessageRouter_BB_DCDCTemperaturesRSP },
+};
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
@@ -0,0 +1,113 @@
+/*******************************************************************************
+// ADC Driver Configuration
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+// Platform Includes
+#include "DevicePin_Config.h"
+// Other Includes
+#include <stdint.h>
+#include "xmc_ccu4.h"
+#include "xmc_dma.h"
+#include "xmc_vadc.h"
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// The rate at which all channels are scanned
+#define ADC_DRV_SAMPLE_RATE_HZ (10000U)
+
+// The number of scans in each of the two buffers
+// One buffer is handed over every 10ms, which leaves the consumer a full
+// buffer time before the DMA writes to it again
+#define ADC_DRV_SAMPLES_PER_BUFFER (100U)
+
+// The converter group that holds all channels
+// The background source converts a group in channel order, the groups would
+// convert in parallel and store their results in no fixed order
+#define ADC_DRV_GROUP VADC_G0
+#define ADC_DRV_GROUP_INDEX (0U)
+
+// The analog clock is the peripheral clock divided by this value plus one,
+// 144MHz / 6 = 24MHz stays below the 30MHz limit of the converter
+#define ADC_DRV_ANALOG_CLOCK_DIVIDER (5U)
+
+// The CCU4 slice that triggers a scan at the sample rate
+// Its period match uses CCU40.SR2, which is trigger input A of the VADC
+#define ADC_DRV_TRIGGER_MODULE CCU40
+#define ADC_DRV_TRIGGER_SLICE CCU40_CC42
+#define ADC_DRV_TRIGGER_SLICE_NUMBER (2U)
+#define ADC_DRV_TRIGGER_SHADOW_TRANSFER XMC_CCU4_SHADOW_TRANSFER_SLICE_2
+#define ADC_DRV_TRIGGER_SERVICE_REQUEST XMC_CCU4_SLICE_SR_ID_2
+#define ADC_DRV_TRIGGER_INPUT XMC_VADC_REQ_TR_A
+
+// The DMA channel that moves the results into the buffers
+// Only channels 0 and 1 of GPDMA0 support linked lists
+#define ADC_DRV_DMA_CHANNEL (0U)
+// The global result event uses the common service request 0, DLR line 0
+#define ADC_DRV_DMA_REQUEST DMA0_PERIPHERAL_REQUEST_VADC_C0SR0_0
+
+// Block complete interrupt of the DMA channel
+// The priority is above the CAN interrupt, the handler only swaps the buffers
+#define ADC_DRV_DMA_IRQ_NUM GPDMA0_0_IRQn
+#define ADC_DRV_DMA_IRQ_PRIORITY (48U)
+// GPDMA0 uses GPDMA0_0_IRQn
+#define ADC_DRV_DMA_HANDLER IRQ_Hdlr_105
+
+
+/*******************************************************************************
+// Public Type Declarations
+*******************************************************************************/
+
+/** The enumeration of the converted signals.  The value is the position of
+  * the signal in each scan of the buffers.  The background source converts
+  * the highest channel number first, so the config table must list the
+  * channels in descending order.
+*/
+typedef enum
+{
+   // Line 1 to neutral voltage
+   ADC_DRV_CHANNEL_L1N_Voltage,
+   // Line 2 to neutral voltage
+   ADC_DRV_CHANNEL_L2N_Voltage,
+   // Line 1 current
+   ADC_DRV_CHANNEL_L1_Current,
+   // Line 2 current
+   ADC_DRV_CHANNEL_L2_Current,
+   // Positive DC bus to midpoint voltage
+   ADC_DRV_CHANNEL_PosBus_Voltage,
+   // Negative DC bus to midpoint voltage
+   ADC_DRV_CHANNEL_NegBus_Voltage,
+   // DC bus current
+   ADC_DRV_CHANNEL_Bus_Current,
+   // The number of converted signals, must match the config table
+   ADC_DRV_CHANNEL_Count
+} ADC_Drv_Channel_t;
+
+// Defines the structure used for each entry in the ADC Driver Config table
+typedef struct
+{
+   // The channel number in the converter group
+   uint8_t channelNumber;
+   // The analog input pin of the channel
+   DevicePin_Config_t pin;
+} ADC_Drv_ChannelConfigItem_t;
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
@@ -0,0 +1,52 @@
+/*******************************************************************************
+// ADC Driver Configuration
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "ADC_Drv_Config.h" // Defines channel enumeration
+// Platform Includes
+#include "DevicePin_Config.h" // Port/Pin definition
+// Other Includes
+#include "xmc_gpio.h"
+
+
+/*******************************************************************************
+// Constant Configuration Variable Declarations
+*******************************************************************************/
+
+// This table defines the converter channel of each signal, in the order of
+// the channel enumeration.  Group 0 channel n is on pin P14.n.  Channel 3 is
+// not used, P14.3 is the CAN receive input.
+static const ADC_Drv_ChannelConfigItem_t adcChannelConfigTable[ADC_DRV_CHANNEL_Count] =
+{
+   // ADC_DRV_CHANNEL_L1N_Voltage
+   { .channelNumber = 7U, .pin = { .port = XMC_GPIO_PORT14, .pin = 7U } },
+   // ADC_DRV_CHANNEL_L2N_Voltage
+   { .channelNumber = 6U, .pin = { .port = XMC_GPIO_PORT14, .pin = 6U } },
+   // ADC_DRV_CHANNEL_L1_Current
+   { .channelNumber = 5U, .pin = { .port = XMC_GPIO_PORT14, .pin = 5U } },
+   // ADC_DRV_CHANNEL_L2_Current
+   { .channelNumber = 4U, .pin = { .port = XMC_GPIO_PORT14, .pin = 4U } },
+   // ADC_DRV_CHANNEL_PosBus_Voltage
+   { .channelNumber = 2U, .pin = { .port = XMC_GPIO_PORT14, .pin = 2U } },
+   // ADC_DRV_CHANNEL_NegBus_Voltage
+   { .channelNumber = 1U, .pin = { .port = XMC_GPIO_PORT14, .pin = 1U } },
+   // ADC_DRV_CHANNEL_Bus_Current
+   { .channelNumber = 0U, .pin = { .port = XMC_GPIO_PORT14, .pin = 0U } },
+};
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
@@ -0,0 +1,38 @@
+/*******************************************************************************
+// ADC Driver Message Router Commands
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "ADC_Drv.h"
+// Platform Includes
+#include "Lunar_MessageRouter.h"
+// Other Includes
+#include <stddef.h>
+
+
+/*******************************************************************************
+// Message Router Table
+*******************************************************************************/
+
+// This table provides a list of commands for this module.
+static const Lunar_MessageRouter_CommandTableItem_t ADC_messageTable[] =
+{
+   // {Command ID, Message Handler Function Pointer, Cache Max Age (ms)}
+   // The status is larger than a cache entry, so it is not cached
+   { 0x01, ADC_Drv_MessageRouter_GetStatus, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+};
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
@@ -0,0 +1,626 @@
+/*******************************************************************************
+// Battery Manager
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "BatteryMgr.h"
+#include "BatteryMgr_Config.h"
+// Platform Includes
+#include "Lunar_ErrorMgr.h"
+#include "Lunar_MessageRouter.h"
+#include "Timebase_Drv.h"
+// Other Includes
+#include "ReportMgr_CANSignals.h" // For the battery block states
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h> // memset
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The number of cells in each cell voltage report
+#define CELLS_PER_REPORT (4U)
+
+// The number of cell voltage reports of a block
+#define NUM_CELL_REPORTS (BATTERYMGR_NUM_CELLS / CELLS_PER_REPORT)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// This structure holds the latest reports of a single battery block
+typedef struct
+{
+   // The time the last battery status and each cell voltage report was received
+   uint32_t statusTime;
+   uint32_t cellReportTime[NUM_CELL_REPORTS];
+
+   // The last active errors reported by the block
+   uint32_t activeErrors;
+
+   // The last cell voltages, 0.001 V per bit
+   uint16_t cellVoltage[BATTERYMGR_NUM_CELLS];
+
+   // The last battery status signals in their raw scaling
+   uint16_t voltage;
+   int16_t current;
+   uint16_t soc;
+   uint8_t state;
+
+   // Bit i is set while cell voltage report i is current
+   uint8_t cellReports;
+
+   // Lowest and highest voltage of the cells with a current report
+   uint16_t minCellVoltage;
+   uint16_t maxCellVoltage;
+
+   // true while the battery status is current
+   bool isOnline;
+
+   // true while the block is in the fault state or reports active errors
+   bool isFaulted;
+
+   // true once the battery status timed out, until the block reports again
+   bool isLost;
+} Node_t;
+
+// This structure holds the private information for this module
+typedef struct
+{
+   // The battery blocks, indexed by node ID
+   Node_t nodes[BATTERYMGR_NUM_NODES];
+
+   // The values aggregated over all blocks
+   BatteryMgr_Summary_t summary;
+
+   // The number of reports that could not be stored (Ex. node ID outside the table)
+   uint32_t numUnknownNodeReports;
+} BatteryMgr_Status_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The variable used for holding all internal data for this module.
+static BatteryMgr_Status_t status;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function finds the lowest and highest voltage of the cells of a
+  *    block that have a current report.
+  * Parameters:
+  *    node :  The block to be updated
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void UpdateNodeCells(Node_t *const node) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function updates the lowest and highest cell voltage after the
+  *    cells of a block changed.  All blocks are only searched when the block
+  *    held a value that got better or the block has no current cells.
+  * Parameters:
+  *    nodeId :  The node ID of the block that changed
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void UpdateCellSummary(const uint8_t nodeId);
+
+/** Description:
+  *    This function updates the worst state of charge after the battery
+  *    status of a block changed.  All blocks are only searched when the
+  *    block held the worst value and it got better or the block went offline.
+  * Parameters:
+  *    nodeId :  The node ID of the block that changed
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void UpdateSocSummary(const uint8_t nodeId);
+
+/** Description:
+  *    This function updates the fault state of a block and the number of
+  *    faulted blocks.
+  * Parameters:
+  *    node :  The block to be updated
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void UpdateNodeFault(Node_t *const node) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function removes a block whose battery status timed out from the
+  *    total current and the worst state of charge and marks it lost.
+  * Parameters:
+  *    nodeId :  The node ID of the block
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void SetNodeLost(const uint8_t nodeId);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Find the cell voltage range of a block
+static void UpdateNodeCells(Node_t *const node)
+{
+   node->minCellVoltage = UINT16_MAX;
+   node->maxCellVoltage = 0U;
+
+   for (uint8_t report = 0U; report < NUM_CELL_REPORTS; report++)
+   {
+      if ((node->cellReports & (1U << report)) != 0U)
+      {
+         for (uint8_t cell = report * CELLS_PER_REPORT; cell < ((report + 1U) * CELLS_PER_REPORT); cell++)
+         {
+            node->minCellVoltage = PLATFORM_MIN(node->minCellVoltage, node->cellVoltage[cell]);
+            node->maxCellVoltage = PLATFORM_MAX(node->maxCellVoltage, node->cellVoltage[cell]);
+         }
+      }
+   }
+}
+
+
+// Update the cell voltage range of all blocks
+static void UpdateCellSummary(const uint8_t nodeId)
+{
+   const Node_t *const node = &status.nodes[nodeId];
+   const bool hasCells = (node->cellReports != 0U);
+   BatteryMgr_Summary_t *const summary = &status.summary;
+
+   if ((summary->minCellNodeId == nodeId) && ((!hasCells) || (node->minCellVoltage > summary->minCellVoltage)))
+   {
+      // The block held the lowest cell, any block may hold it now
+      summary->minCellNodeId = BATTERYMGR_NO_NODE;
+      summary->minCellVoltage = 0U;
+      for (uint8_t i = 0U; i < BATTERYMGR_NUM_NODES; i++)
+      {
+         if ((status.nodes[i].cellReports != 0U) &&
+             ((summary->minCellNodeId == BATTERYMGR_NO_NODE) || (status.nodes[i].minCellVoltage < summary->minCellVoltage)))
+         {
+            summary->minCellNodeId = i;
+            summary->minCellVoltage = status.nodes[i].minCellVoltage;
+         }
+      }
+   }
+   else if (hasCells && ((summary->minCellNodeId == BATTERYMGR_NO_NODE) || (node->minCellVoltage <= summary->minCellVoltage)))
+   {
+      summary->minCellNodeId = nodeId;
+      summary->minCellVoltage = node->minCellVoltage;
+   }
+   else
+   {
+      // Another block holds a lower cell
+   }
+
+   if ((summary->maxCellNodeId == nodeId) && ((!hasCells) || (node->maxCellVoltage < summary->maxCellVoltage)))
+   {
+      // The block held the highest cell, any block may hold it now
+      summary->maxCellNodeId = BATTERYMGR_NO_NODE;
+      summary->maxCellVoltage = 0U;
+      for (uint8_t i = 0U; i < BATTERYMGR_NUM_NODES; i++)
+      {
+         if ((status.nodes[i].cellReports != 0U) &&
+             ((summary->maxCellNodeId == BATTERYMGR_NO_NODE) || (status.nodes[i].maxCellVoltage > summary->maxCellVoltage)))
+         {
+            summary->maxCellNodeId = i;
+            summary->maxCellVoltage = status.nodes[i].maxCellVoltage;
+         }
+      }
+   }
+   else if (hasCells && ((summary->maxCellNodeId == BATTERYMGR_NO_NODE) || (node->maxCellVoltage >= summary->maxCellVoltage)))
+   {
+      summary->maxCellNodeId = nodeId;
+      summary->maxCellVoltage = node->maxCellVoltage;
+   }
+   else
+   {
+      // Another block holds a higher cell
+   }
+}
+
+
+// Update the worst state of charge of all blocks
+static void UpdateSocSummary(const uint8_t nodeId)
+{
+   const Node_t *const node = &status.nodes[nodeId];
+   BatteryMgr_Summary_t *const summary = &status.summary;
+
+   if ((summary->worstSocNodeId == nodeId) && ((!node->isOnline) || (node->soc > summary->worstSoc)))
+   {
+      // The block held the worst value, any block may hold it now
+      summary->worstSocNodeId = BATTERYMGR_NO_NODE;
+      summary->worstSoc = 0U;
+      for (uint8_t i = 0U; i < BATTERYMGR_NUM_NODES; i++)
+      {
+         if ((status.nodes[i].isOnline) &&
+             ((summary->worstSocNodeId == BATTERYMGR_NO_NODE) || (status.nodes[i].soc < summary->worstSoc)))
+         {
+            summary->worstSocNodeId = i;
+            summary->worstSoc = status.nodes[i].soc;
+         }
+      }
+   }
+   else if ((node->isOnline) && ((summary->worstSocNodeId == BATTERYMGR_NO_NODE) || (node->soc <= summary->worstSoc)))
+   {
+      summary->worstSocNodeId = nodeId;
+      summary->worstSoc = node->soc;
+   }
+   else
+   {
+      // Another block has a lower state of charge
+   }
+}
+
+
+// Update the fault state of a block
+static void UpdateNodeFault(Node_t *const node)
+{
+   const bool isFaulted = (node->state == (uint8_t)BB_STATE_ENUM_Fault) || (node->activeErrors != 0U);
+
+   if (isFaulted && (!node->isFaulted))
+   {
+      status.summary.numFaultedNodes++;
+   }
+   else if ((!isFaulted) && (node->isFaulted))
+   {
+      status.summary.numFaultedNodes--;
+   }
+   else
+   {
+      // No change
+   }
+
+   node->isFaulted = isFaulted;
+}
+
+
+// Remove a block that stopped reporting
+static void SetNodeLost(const uint8_t nodeId)
+{
+   Node_t *const node = &status.nodes[nodeId];
+
+   node->isOnline = false;
+   node->isLost = true;
+   status.summary.numOnlineNodes--;
+   status.summary.numLostNodes++;
+   status.summary.totalCurrent -= node->current;
+
+   UpdateSocSummary(nodeId);
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Initialize the node table
+void BatteryMgr_Init(void)
+{
+   memset(&status, 0, sizeof(status));
+
+   status.summary.minCellNodeId = BATTERYMGR_NO_NODE;
+   status.summary.maxCellNodeId = BATTERYMGR_NO_NODE;
+   status.summary.worstSocNodeId = BATTERYMGR_NO_NODE;
+}
+
+
+// Scheduled function to time out the reports
+void BatteryMgr_Update(void)
+{
+   const uint32_t currentTime = Timebase_Drv_GetCurrentTickCount();
+
+   for (uint8_t nodeId = 0U; nodeId < BATTERYMGR_NUM_NODES; nodeId++)
+   {
+      Node_t *const node = &status.nodes[nodeId];
+
+      if ((node->isOnline) && ((currentTime - node->statusTime) >= (BATTERYMGR_STATUS_TIMEOUT_MS * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND)))
+      {
+         SetNodeLost(nodeId);
+      }
+
+      if (node->cellReports != 0U)
+      {
+         const uint8_t cellReports = node->cellReports;
+
+         for (uint8_t report = 0U; report < NUM_CELL_REPORTS; report++)
+         {
+            if ((currentTime - node->cellReportTime[report]) >= (BATTERYMGR_CELL_TIMEOUT_MS * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND))
+            {
+               node->cellReports &= (uint8_t)~(1U << report);
+            }
+         }
+
+         if (node->cellReports != cellReports)
+         {
+            UpdateNodeCells(node);
+            UpdateCellSummary(nodeId);
+         }
+      }
+   }
+
+   // The error qualification times the request, so it is made on every update
+   Lunar_ErrorMgr_SetErrorState(LUNAR_ERRORMGR_ERROR_BATTERY_FAULT, (status.summary.numFaultedNodes != 0U) || (status.summary.numLostNodes != 0U));
+}
+
+
+// Store the battery status of a block
+void BatteryMgr_SetBatteryStatus(const uint8_t nodeId, const BB_BatteryStatusRSP_t *const signals)
+{
+   if (nodeId < BATTERYMGR_NUM_NODES)
+   {
+      Node_t *const node = &status.nodes[nodeId];
+
+      if (node->isOnline)
+      {
+         // Replace the previous current in the total
+         status.summary.totalCurrent -= node->current;
+      }
+      else
+      {
+         node->isOnline = true;
+         status.summary.numOnlineNodes++;
+
+         if (node->isLost)
+         {
+            node->isLost = false;
+            status.summary.numLostNodes--;
+         }
+      }
+
+      node->statusTime = Timebase_Drv_GetCurrentTickCount();
+      node->state = (uint8_t)signals->BatteryBlockState;
+      node->voltage = signals->BatteryVoltageV;
+      node->current = signals->BatteryCurrentA;
+      node->soc = signals->BatterySOC;
+
+      status.summary.totalCurrent += node->current;
+      UpdateSocSummary(nodeId);
+      UpdateNodeFault(node);
+   }
+   else
+   {
+      status.numUnknownNodeReports++;
+   }
+}
+
+
+// Store four cell voltages of a block
+void BatteryMgr_SetCellVoltages(const uint8_t nodeId, const uint8_t firstCell, const uint16_t *const cellVoltages)
+{
+   if ((nodeId < BATTERYMGR_NUM_NODES) && ((firstCell % CELLS_PER_REPORT) == 0U) && (firstCell < BATTERYMGR_NUM_CELLS))
+   {
+      Node_t *const node = &status.nodes[nodeId];
+      const uint8_t report = firstCell / CELLS_PER_REPORT;
+
+      memcpy(&node->cellVoltage[firstCell], cellVoltages, CELLS_PER_REPORT * sizeof(uint16_t));
+      node->cellReports |= (uint8_t)(1U << report);
+      node->cellReportTime[report] = Timebase_Drv_GetCurrentTickCount();
+
+      UpdateNodeCells(node);
+      UpdateCellSummary(nodeId);
+   }
+   else
+   {
+      status.numUnknownNodeReports++;
+   }
+}
+
+
+// Store the active errors of a block
+void BatteryMgr_SetActiveErrors(const uint8_t nodeId, const uint32_t activeErrors)
+{
+   if (nodeId < BATTERYMGR_NUM_NODES)
+   {
+      status.nodes[nodeId].activeErrors = activeErrors;
+      UpdateNodeFault(&status.nodes[nodeId]);
+   }
+   else
+   {
+      status.numUnknownNodeReports++;
+   }
+}
+
+
+// Get the aggregated values
+void BatteryMgr_GetSummary(BatteryMgr_Summary_t *const summary)
+{
+   *summary = status.summary;
+}
+
+
+/*******************************************************************************
+// Message Router Function Implementations
+*******************************************************************************/
+
+// Message handler to get the aggregated values
+void BatteryMgr_MessageRouter_GetSummary(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // Sum of the current of the online blocks, 0.005 A per bit
+      int32_t totalCurrent;
+      // Cell voltages 0.001 V and state of charge 0.1 % per bit
+      uint16_t minCellVoltage;
+      uint16_t maxCellVoltage;
+      uint16_t worstSoc;
+      // The blocks holding the values above, 0xFF if none
+      uint8_t minCellNodeId;
+      uint8_t maxCellNodeId;
+      uint8_t worstSocNodeId;
+      uint8_t numOnlineNodes;
+      uint8_t numFaultedNodes;
+      uint8_t numLostNodes;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   {
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      response->totalCurrent = status.summary.totalCurrent;
+      response->minCellVoltage = status.summary.minCellVoltage;
+      response->maxCellVoltage = status.summary.maxCellVoltage;
+      response->worstSoc = status.summary.worstSoc;
+      response->minCellNodeId = status.summary.minCellNodeId;
+      response->maxCellNodeId = status.summary.maxCellNodeId;
+      response->worstSocNodeId = status.summary.worstSocNodeId;
+      response->numOnlineNodes = status.summary.numOnlineNodes;
+      response->numFaultedNodes = status.summary.numFaultedNodes;
+      response->numLostNodes = status.summary.numLostNodes;
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+// Message handler to get the values of one block
+void BatteryMgr_MessageRouter_GetNodeStatus(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the command
+   typedef struct
+   {
+      // The node ID of the block
+      uint8_t nodeId;
+   } Command_t;
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // The last active errors of the block
+      uint32_t activeErrors;
+      // The time since the last battery status
+      uint32_t statusAgeMs;
+      // Battery status signals in their raw scaling
+      uint16_t voltage;
+      int16_t current;
+      uint16_t soc;
+      // Range of the cells with a current report, 0.001 V per bit
+      uint16_t minCellVoltage;
+      uint16_t maxCellVoltage;
+      uint8_t state;
+      // Bit i is set while cell voltage report i is current
+      uint8_t cellReports;
+      uint8_t isOnline;
+      uint8_t isFaulted;
+      uint8_t isLost;
+      uint8_t reserved;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), sizeof(Response_t)))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      // Read the node ID before the response is written over the command
+      uint8_t nodeId = command->nodeId;
+
+      // Values are zero for an invalid node ID
+      memset(response, 0, sizeof(Response_t));
+
+      if (nodeId < BATTERYMGR_NUM_NODES)
+      {
+         const Node_t *const node = &status.nodes[nodeId];
+
+         response->activeErrors = node->activeErrors;
+         response->statusAgeMs = (Timebase_Drv_GetCurrentTickCount() - node->statusTime) / TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND;
+         response->voltage = node->voltage;
+         response->current = node->current;
+         response->soc = node->soc;
+         response->minCellVoltage = (node->cellReports != 0U) ? node->minCellVoltage : 0U;
+         response->maxCellVoltage = node->maxCellVoltage;
+         response->state = node->state;
+         response->cellReports = node->cellReports;
+         response->isOnline = node->isOnline ? 1U : 0U;
+         response->isFaulted = node->isFaulted ? 1U : 0U;
+         response->isLost = node->isLost ? 1U : 0U;
+      }
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+// Message handler to remove the lost blocks
+void BatteryMgr_MessageRouter_ClearLostNodes(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, 0))
+   {
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      for (uint8_t nodeId = 0U; nodeId < BATTERYMGR_NUM_NODES; nodeId++)
+      {
+         Node_t *const node = &status.nodes[nodeId];
+
+         if (node->isLost)
+         {
+            // Forget the faults and cells of the block as well
+            status.summary.numLostNodes--;
+            if (node->isFaulted)
+            {
+               status.summary.numFaultedNodes--;
+            }
+
+            memset(node, 0, sizeof(Node_t));
+            UpdateCellSummary(nodeId);
+         }
+      }
+   }
+}
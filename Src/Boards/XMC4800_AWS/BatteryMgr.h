@@ -0,0 +1,182 @@
+/*******************************************************************************
+// Battery Manager
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "BatteryMgr_Config.h"
+// Platform Includes
+#include "Lunar_MessageRouter.h"
+#include "Platform.h"
+// Other Includes
+#include "ReportMgr_CAN.h" // For the battery block signals
+#include <stdbool.h>
+#include <stdint.h>
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// Node ID used in the summary while no block provides the value
+#define BATTERYMGR_NO_NODE (0xFFU)
+
+
+/*******************************************************************************
+// Public Type Declarations
+*******************************************************************************/
+
+/** This structure holds the values aggregated over all battery blocks.  The
+  * values use the raw scaling of the DBC signals, so no conversion is needed
+  * as frames arrive.
+*/
+typedef struct
+{
+   // Sum of the battery current of the online blocks, 0.005 A per bit
+   int32_t totalCurrent;
+
+   // Lowest and highest cell voltage of the blocks with current cell reports, 0.001 V per bit
+   uint16_t minCellVoltage;
+   uint16_t maxCellVoltage;
+
+   // Lowest state of charge of the online blocks, 0.1 % per bit
+   uint16_t worstSoc;
+
+   // The blocks that hold the values above, BATTERYMGR_NO_NODE if none
+   uint8_t minCellNodeId;
+   uint8_t maxCellNodeId;
+   uint8_t worstSocNodeId;
+
+   // The number of blocks reporting their status
+   uint8_t numOnlineNodes;
+
+   // The number of blocks in the fault state or with active errors
+   uint8_t numFaultedNodes;
+
+   // The number of blocks that stopped reporting their status
+   uint8_t numLostNodes;
+} BatteryMgr_Summary_t;
+
+
+/*******************************************************************************
+// Public Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function initializes the node table.  No block is online until
+  *    its first battery status arrives.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void BatteryMgr_Init(void);
+
+/** Description:
+  *    This is the scheduled update function that ends the reports of blocks
+  *    that have not been received within their timeout.  A block without a
+  *    current battery status is lost and counted as a battery fault until it
+  *    reports again or is cleared.  The aggregated values are not polled,
+  *    they are updated as frames arrive or expire.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void BatteryMgr_Update(void);
+
+/** Description:
+  *    This function stores the battery status of a block and updates the
+  *    total current, the worst state of charge and the battery fault.
+  * Parameters:
+  *    nodeId - The node ID of the block
+  *    signals - The decoded battery status signals
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void BatteryMgr_SetBatteryStatus(const uint8_t nodeId, const BB_BatteryStatusRSP_t *const signals) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function stores four cell voltages of a block and updates the
+  *    lowest and highest cell voltage.
+  * Parameters:
+  *    nodeId - The node ID of the block
+  *    firstCell - The index of the first of the four cells (0, 4 or 8)
+  *    cellVoltages - The four cell voltages, 0.001 V per bit
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void BatteryMgr_SetCellVoltages(const uint8_t nodeId, const uint8_t firstCell, const uint16_t *const cellVoltages) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function stores the active errors of a block.  Any active error
+  *    is a battery fault for the inverter.
+  * Parameters:
+  *    nodeId - The node ID of the block
+  *    activeErrors - The active error bits reported by the block
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void BatteryMgr_SetActiveErrors(const uint8_t nodeId, const uint32_t activeErrors);
+
+/** Description:
+  *    This function gets the values aggregated over all battery blocks.
+  * Parameters:
+  *    summary - The location where the summary is to be placed
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void BatteryMgr_GetSummary(BatteryMgr_Summary_t *const summary) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function retrieves the values aggregated over all battery blocks.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void BatteryMgr_MessageRouter_GetSummary(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function retrieves the latest values of a single battery block.
+  *    The command holds the node ID.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void BatteryMgr_MessageRouter_GetNodeStatus(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function removes the lost blocks from the node table, so a block
+  *    that was taken out of service no longer holds the battery fault.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void BatteryMgr_MessageRouter_ClearLostNodes(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+
+#ifdef __cplusplus
+}
+#endif
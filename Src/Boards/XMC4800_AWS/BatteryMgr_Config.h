@@ -0,0 +1,35 @@
+/*******************************************************************************
+// Battery Manager Configuration
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/*******************************************************************************
+// Public Constant Declarations
+*******************************************************************************/
+
+// The number of battery blocks in the node table, indexed by node ID
+// This must cover every node ID of LUNAR_CANTRANSPORT_BB_NODE_ID_MASK
+#define BATTERYMGR_NUM_NODES (64U)
+
+// The number of cells reported by each battery block
+#define BATTERYMGR_NUM_CELLS (12U)
+
+// The time without a battery status before a block is lost
+// The status is reported every 100 ms
+#define BATTERYMGR_STATUS_TIMEOUT_MS (500U)
+
+// The time without a cell voltage report before its cells are ignored
+// The cell voltages are reported every 500 ms
+#define BATTERYMGR_CELL_TIMEOUT_MS (2500U)
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
@@ -0,0 +1,39 @@
+/*******************************************************************************
+// Battery Manager Message Router Commands
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "BatteryMgr.h"
+// Platform Includes
+#include "Lunar_MessageRouter.h"
+// Other Includes
+
+
+/*******************************************************************************
+// Message Router Table
+*******************************************************************************/
+
+// This table provides a list of commands for this module
+static const Lunar_MessageRouter_CommandTableItem_t BatteryMgr_messageTable[] =
+{
+   // {Command ID, Message Handler Function Pointer, Cache Max Age (ms)}
+   // The summary is not cached, a cached copy would still list the nodes removed by ClearLostNodes
+   { 1, BatteryMgr_MessageRouter_GetSummary, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 2, BatteryMgr_MessageRouter_GetNodeStatus, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 3, BatteryMgr_MessageRouter_ClearLostNodes, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+};
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
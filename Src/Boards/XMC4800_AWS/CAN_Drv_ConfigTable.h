@@ -17,6 +17,8 @@ extern "C"
 #include "CAN_Drv_Config.h" // Defines channel enumeration
 // Platform Includes
 #include "DevicePin_Config.h" // Port/Pin definition
+#include "Lunar_CANTransport_Config.h" // Message Router request identifiers
+#include "Lunar_FwUpdate_Config.h" // Firmware update identifiers
 // Other Includes
 #include "xmc_can.h"
 #include "xmc_gpio.h"
@@ -60,19 +62,32 @@ static const CAN_Drv_ConfigItem_t canConfigTable[CAN_DRV_CHANNEL_Count] =
          .output_strength = XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE
       },
       .input = XMC_CAN_NODE_RECEIVE_INPUT_RXDCB,
-		/*
-      .rxIrqNum = IRQ9_IRQn,
-      .txIrqNum = IRQ10_IRQn,
+      // Only the receive interrupt is used, it also counts the frames sent from the transmit queue
+      .rxIrqNum = CAN0_0_IRQn,
       .rxIRQServiceRequest = 0,
-      .txIRQServiceRequest = 1,
-      .rxIRQPriority = 3,
-      .txIRQPriority = 3,
-      .txInterruptControlSource = XMC_SCU_IRQCTRL_USIC0_SR1_IRQ10,
-      .rxInterruptControlSource = XMC_SCU_IRQCTRL_USIC0_SR0_IRQ9
-		*/
+      .rxIRQPriority = 64,
    },
 };
 
+// This table defines the receive filters of the primary channel.  Each
+// filter is given its own receive FIFO, so a burst of battery reports cannot
+// push out a command.
+static const CAN_Drv_FilterConfigItem_t canFilterConfigTable[] =
+{
+   // Battery block reports (0x1B0xx) of every node
+   { (BB_BatteryStatusRSP_CANID & 0x1FFFFF00U) | 0x80000000U, 0x1FFFFF00U & ~LUNAR_CANTRANSPORT_BB_NODE_ID_MASK, 4U },
+   // Inverter commands
+   { INV_CommandCMD_CANID | 0x80000000U, 0x1FFFFFFFU, 2U },
+   // Image data frames of a firmware update, sent back to back
+   { LUNAR_FWUPDATE_DATA_CANID | 0x80000000U, 0x1FFFFF00U, 8U },
+   // Control frames of a firmware update
+   { LUNAR_FWUPDATE_CONTROL_CANID | 0x80000000U, 0x1FFFFFFCU, 2U },
+   // Message Router requests
+   { LUNAR_CANTRANSPORT_REQUEST_CANID | 0x80000000U, LUNAR_CANTRANSPORT_REQUEST_MASK, 2U },
+   // Segmented Message Router requests and flow control frames
+   { LUNAR_CANTRANSPORT_ISOTP_REQUEST_CANID | 0x80000000U, LUNAR_CANTRANSPORT_REQUEST_MASK, 2U },
+};
+
 
 #ifdef __cplusplus
 extern "C"
@@ -85,9 +85,12 @@ Control_State_t Control_GetState(void);
 
 /** Description:
   *    Fault handler -- used primarily for critical error events triggered by
-  *    the Event Manager. 
+  *    the Event Manager.  The control is put in standby and the control fault
+  *    error is set, so the control must be enabled again once the errors are
+  *    cleared.
   *  History:
   *    * 6/6/2021: Function created (EJH)
+  *    * 10/19/2026: Stops the control and sets the control fault error (EJH)
   *                                                              
 */
 void Control_Fault(void);
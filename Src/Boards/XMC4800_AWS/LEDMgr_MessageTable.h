@@ -26,8 +26,8 @@ extern "C"
 // This table provides a list of commands for this module.
 static const Lunar_MessageRouter_CommandTableItem_t LEDMgr_messageTable[] =
 {
-   // {Command ID, Message Handler Function Pointer}
-   { 1, LEDMgr_MessageRouter_GetFlashCode }
+   // {Command ID, Message Handler Function Pointer, Cache Max Age (ms)}
+   { 1, LEDMgr_MessageRouter_GetFlashCode, LUNAR_MESSAGEROUTER_CACHE_NEVER }
 };
 
 
@@ -0,0 +1,53 @@
+/*******************************************************************************
+// Core CAN Transport Configuration
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Platform Includes
+// Other Includes
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+/** First identifier of the Message Router requests to the inverter.  The low
+  * 16 bits of a request identifier are the module and command, so any
+  * command can be sent on the bus.
+*/
+#define LUNAR_CANTRANSPORT_REQUEST_CANID (0x1A10000U)
+
+// First identifier of the responses, the low 16 bits match the request
+#define LUNAR_CANTRANSPORT_RESPONSE_CANID (0x1A20000U)
+
+/** First identifier of the segmented (ISO-TP) Message Router requests, which
+  * carry commands and responses of up to a message buffer pool block.  The
+  * low 16 bits are the module and command as for the single frame requests.
+*/
+#define LUNAR_CANTRANSPORT_ISOTP_REQUEST_CANID (0x1A30000U)
+
+// First identifier of the segmented responses and flow control frames
+#define LUNAR_CANTRANSPORT_ISOTP_RESPONSE_CANID (0x1A40000U)
+
+// Mask that matches every request identifier
+#define LUNAR_CANTRANSPORT_REQUEST_MASK (0x1FFF0000U)
+
+/** Identifier bits 17-22 of the battery block reports hold the node ID of
+  * the block, so up to 64 blocks share the DBC identifiers.  Blocks without
+  * an assigned node ID report as node 0.
+*/
+#define LUNAR_CANTRANSPORT_BB_NODE_ID_MASK (0x007E0000U)
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
@@ -0,0 +1,50 @@
+/*******************************************************************************
+// Core CAN Transport Configuration
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "Lunar_CANTransport.h"
+#include "Lunar_CANTransport_Config.h"
+// Platform Includes
+#include "CAN_Drv.h"
+// Other Includes
+#include "Lunar_FwUpdate_Config.h" // For the update identifiers
+#include "ReportMgr_CAN.h" // For DBC identifiers
+
+
+/*******************************************************************************
+// Constant Configuration Variable Declarations
+*******************************************************************************/
+
+// Table that maps ranges of received CAN identifiers onto Message Router
+// commands.  Frames with an identifier that is not listed are dropped.
+static const Lunar_CANTransport_RouteConfigItem_t Lunar_CANTransport_routeConfigTable[] =
+{
+   // { First CAN ID, Last CAN ID, Module ID, Command ID, First Response CAN ID, Framing, Node ID Mask }
+   // Battery block reports (0x1B0xx) of every node, the inverter does not respond
+   { (BB_BatteryStatusRSP_CANID & 0x1FFFFF00U) | CAN_DRV_EXTENDED_ID, BB_BatteryStatusRSP_CANID | 0xFFU | CAN_DRV_EXTENDED_ID, 0xB0, 0x00, LUNAR_CANTRANSPORT_NO_RESPONSE, LUNAR_CANTRANSPORT_FRAMING_Single, LUNAR_CANTRANSPORT_BB_NODE_ID_MASK },
+   // Inverter commands, the state is reported by the scheduled reports
+   { (INV_CommandCMD_CANID & 0x1FFFFF00U) | CAN_DRV_EXTENDED_ID, INV_CommandCMD_CANID | 0xFFU | CAN_DRV_EXTENDED_ID, 0xA1, 0x00, LUNAR_CANTRANSPORT_NO_RESPONSE, LUNAR_CANTRANSPORT_FRAMING_Single, 0U },
+   // Image data frames of a firmware update, the low 8 bits are the block and frame numbers
+   { LUNAR_FWUPDATE_DATA_CANID | CAN_DRV_EXTENDED_ID, LUNAR_FWUPDATE_DATA_CANID | CAN_DRV_EXTENDED_ID, 0x10, 0x06, LUNAR_CANTRANSPORT_NO_RESPONSE, LUNAR_CANTRANSPORT_FRAMING_Single, 0xFFU },
+   // Start, commit, finish and abort of a firmware update, the nodes answer with their own reports
+   { LUNAR_FWUPDATE_CONTROL_CANID | CAN_DRV_EXTENDED_ID, (LUNAR_FWUPDATE_CONTROL_CANID + 3U) | CAN_DRV_EXTENDED_ID, 0x10, 0x02, LUNAR_CANTRANSPORT_NO_RESPONSE, LUNAR_CANTRANSPORT_FRAMING_Single, 0U },
+   // Message Router requests, every module and command can be reached
+   { LUNAR_CANTRANSPORT_REQUEST_CANID | CAN_DRV_EXTENDED_ID, (LUNAR_CANTRANSPORT_REQUEST_CANID | 0xFFFFU) | CAN_DRV_EXTENDED_ID, 0x00, 0x00, LUNAR_CANTRANSPORT_RESPONSE_CANID | CAN_DRV_EXTENDED_ID, LUNAR_CANTRANSPORT_FRAMING_Single, 0U },
+   // Segmented Message Router requests, for commands and responses longer than a frame
+   { LUNAR_CANTRANSPORT_ISOTP_REQUEST_CANID | CAN_DRV_EXTENDED_ID, (LUNAR_CANTRANSPORT_ISOTP_REQUEST_CANID | 0xFFFFU) | CAN_DRV_EXTENDED_ID, 0x00, 0x00, LUNAR_CANTRANSPORT_ISOTP_RESPONSE_CANID | CAN_DRV_EXTENDED_ID, LUNAR_CANTRANSPORT_FRAMING_IsoTp, 0U },
+};
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
@@ -0,0 +1,41 @@
+/*******************************************************************************
+// Core Error Log Configuration
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+// Platform Includes
+// Other Includes
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// The address of the first flash sector reserved for the error log
+// Logical sectors 6 and 7 are reserved for the log in the scatter file, the
+// uncached address is used so that reads are never served from the cache
+#define LUNAR_ERRORLOG_FLASH_START_ADDRESS (0x0C018000UL)
+
+// The number of consecutive sectors used by the log
+// At least 2 are required so the newest records survive erasing the oldest sector
+#define LUNAR_ERRORLOG_NUM_SECTORS (2U)
+
+// The longest time in milliseconds a record waits in RAM before it is written
+#define LUNAR_ERRORLOG_FLUSH_DELAY_MS (1000U)
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
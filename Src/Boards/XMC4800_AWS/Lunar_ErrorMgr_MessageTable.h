@@ -25,12 +25,16 @@ extern "C"
 // This table provides a list of commands for this module.
 static const Lunar_MessageRouter_CommandTableItem_t Lunar_ErrorMgr_messageTable[] =
 {
-   // {Command ID, Message Handler Function Pointer}
-   { 0x01, Lunar_ErrorMgr_MessageRouter_GetErrorState },
-   { 0x02, Lunar_ErrorMgr_MessageRouter_SetErrorState },
-   { 0x03, Lunar_ErrorMgr_MessageRouter_DoErrorsExist },
-   { 0x04, Lunar_ErrorMgr_MessageRouter_ClearAllErrors },
-   { 0x05, Lunar_ErrorMgr_MessageRouter_GetAllErrors }
+   // {Command ID, Message Handler Function Pointer, Cache Max Age (ms)}
+   { 0x01, Lunar_ErrorMgr_MessageRouter_GetErrorState, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 0x02, Lunar_ErrorMgr_MessageRouter_SetErrorState, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 0x03, Lunar_ErrorMgr_MessageRouter_DoErrorsExist, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 0x04, Lunar_ErrorMgr_MessageRouter_ClearAllErrors, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 0x05, Lunar_ErrorMgr_MessageRouter_GetAllErrors, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 0x06, Lunar_ErrorMgr_MessageRouter_GetErrorHistory, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 0x07, Lunar_ErrorMgr_MessageRouter_GetAllErrorCounts, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 0x08, Lunar_ErrorMgr_MessageRouter_GetRecentTransitions, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 0x09, Lunar_ErrorMgr_MessageRouter_ClearErrorHistory, LUNAR_MESSAGEROUTER_CACHE_NEVER }
 };
 
 #ifdef __cplusplus
@@ -28,6 +28,10 @@ typedef enum
    LUNAR_EVENTMGR_CONFIG_EVENT_Control_Disabled,
    // Event for any critical error
    LUNAR_EVENTMGR_CONFIG_EVENT_Critical_Error,
+   // Event for any error being set or cleared
+   LUNAR_EVENTMGR_CONFIG_EVENT_Error_Changed,
+   // Event when the ADC driver hands over a full sample buffer
+   LUNAR_EVENTMGR_CONFIG_EVENT_ADC_BufferReady,
    // Value representing the number of events in the enumeration
    LUNAR_EVENTMGR_CONFIG_EVENT_Count,
    // This event is primarily a placeholder for placing an unused event in the config table
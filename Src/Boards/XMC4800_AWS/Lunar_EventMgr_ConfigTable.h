@@ -18,6 +18,8 @@ extern "C"
 // Platform Includes
 // Other Includes
 #include "Control.h"
+#include "PowerCalc.h"
+#include "ReportMgr.h"
 
 
 /*******************************************************************************
@@ -28,7 +30,9 @@ extern "C"
 static const Lunar_EventMgr_Table_Item_t Lunar_EventMgr_eventConfigTable[] =
 {
    // {Event, Event Callback }
-   { LUNAR_EVENTMGR_CONFIG_EVENT_Critical_Error, Control_Fault }
+   { LUNAR_EVENTMGR_CONFIG_EVENT_Critical_Error, Control_Fault },
+   { LUNAR_EVENTMGR_CONFIG_EVENT_Error_Changed, ReportMgr_ErrorChanged },
+   { LUNAR_EVENTMGR_CONFIG_EVENT_ADC_BufferReady, PowerCalc_BufferReady }
 };
 
 #ifdef __cplusplus
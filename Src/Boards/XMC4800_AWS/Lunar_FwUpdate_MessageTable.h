@@ -0,0 +1,43 @@
+/*******************************************************************************
+// Core Firmware Update Message Router Commands
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Lunar_FwUpdate.h"
+// Platform Includes
+#include "Lunar_MessageRouter.h"
+// Other Includes
+#include <stddef.h>
+
+
+/*******************************************************************************
+// Message Router Table
+*******************************************************************************/
+
+// This table provides a list of commands for this module.
+static const Lunar_MessageRouter_CommandTableItem_t Lunar_FwUpdate_messageTable[] =
+{
+   // {Command ID, Message Handler Function Pointer, Cache Max Age (ms)}
+   { 0x01, Lunar_FwUpdate_MessageRouter_GetStatus, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   // The control and data frames of the image broadcast are routed here by the CAN transport
+   { 0x02, Lunar_FwUpdate_MessageRouter_Start, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 0x03, Lunar_FwUpdate_MessageRouter_Commit, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 0x04, Lunar_FwUpdate_MessageRouter_Finish, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 0x05, Lunar_FwUpdate_MessageRouter_Abort, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 0x06, Lunar_FwUpdate_MessageRouter_Data, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+};
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
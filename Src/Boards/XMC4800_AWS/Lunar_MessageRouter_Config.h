@@ -0,0 +1,39 @@
+/*******************************************************************************
+// Core Message Router Configuration
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Platform Includes
+// Other Includes
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// The number of responses that may be held in the response cache at one time
+#define LUNAR_MESSAGEROUTER_CACHE_NUM_ENTRIES (8U)
+
+// The largest response that may be cached -- larger responses always call the handler
+#define LUNAR_MESSAGEROUTER_CACHE_MAX_RESPONSE_SIZE (20U)
+
+// Enables the per-command metrics (1 = enabled)
+#define LUNAR_MESSAGEROUTER_METRICS_ENABLED (1)
+
+// The number of commands for which metrics are kept, this must be at least the
+// total number of commands in all command tables
+#define LUNAR_MESSAGEROUTER_METRICS_MAX_COMMANDS (56U)
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
@@ -0,0 +1,40 @@
+/*******************************************************************************
+// Core Subscription Manager Message Router Commands
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Lunar_SubscriptionMgr.h"
+// Platform Includes
+#include "Lunar_MessageRouter.h"
+// Other Includes
+#include <stddef.h>
+
+
+/*******************************************************************************
+// Message Router Table
+*******************************************************************************/
+
+// This table provides a list of commands for this module.
+static const Lunar_MessageRouter_CommandTableItem_t Lunar_SubscriptionMgr_messageTable[] =
+{
+   // {Command ID, Message Handler Function Pointer, Cache Max Age (ms)}
+   { 0x01, Lunar_SubscriptionMgr_MessageRouter_Subscribe, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 0x02, Lunar_SubscriptionMgr_MessageRouter_Unsubscribe, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 0x03, Lunar_SubscriptionMgr_MessageRouter_UnsubscribeAll, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { 0x04, Lunar_SubscriptionMgr_MessageRouter_GetStatistics, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+};
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
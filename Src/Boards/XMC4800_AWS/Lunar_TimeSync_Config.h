@@ -0,0 +1,31 @@
+/*******************************************************************************
+// Core Time Synchronization Configuration
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// The inverter is the time master, the other nodes follow its time
+#define LUNAR_TIMESYNC_IS_MASTER (1)
+
+// Identifiers of the SYNC and follow-up frames
+// The low identifiers win the arbitration, so the frames are not held back
+#define LUNAR_TIMESYNC_SYNC_CANID (0x1000U)
+#define LUNAR_TIMESYNC_FOLLOWUP_CANID (0x1001U)
+
+// The time between SYNC frames
+#define LUNAR_TIMESYNC_PERIOD_MS (1000U)
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
@@ -0,0 +1,546 @@
+/*******************************************************************************
+// Power Calculation
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "PowerCalc.h"
+#include "PowerCalc_Config.h"
+#include "PowerCalc_ConfigTable.h"
+// Platform Includes
+#include "ADC_Drv.h"
+#include "Lunar_MathLib.h"
+#include "Lunar_MessageRouter.h"
+#include "Timebase_Drv.h"
+// Other Includes
+#include "xmc_common.h" // CMSIS core and DSP instructions
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h> // memset
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// Fractional bits of the interpolated zero crossing positions, in samples
+#define CROSSING_FRACTION_BITS (8U)
+
+// The number of buffers per second
+#define BUFFERS_PER_SECOND (ADC_DRV_SAMPLE_RATE_HZ / ADC_DRV_SAMPLES_PER_BUFFER)
+
+// The dual 16-bit multiply accumulate of the Cortex-M4 adds the products of
+// both halfwords to a 64-bit sum, so two samples take one instruction
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define PACK_PAIR(first, second) (__PKHBT((uint32_t)(uint16_t)(first), (uint32_t)(uint16_t)(second), 16))
+#define MAC_PAIR(x, y, sum) ((int64_t)__SMLALD((x), (y), (uint64_t)(sum)))
+#else
+// Equivalent calculation for cores without the DSP instructions
+#define PACK_PAIR(first, second) ((uint32_t)(uint16_t)(first) | ((uint32_t)(uint16_t)(second) << 16U))
+#define MAC_PAIR(x, y, sum) ((sum) + ((int64_t)(int16_t)(x) * (int16_t)(y)) + ((int64_t)(int16_t)((x) >> 16U) * (int16_t)((y) >> 16U)))
+#endif
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// The grid signals, the line to line values are taken from the line values
+typedef enum
+{
+   AC_L1N_VOLTAGE,
+   AC_L2N_VOLTAGE,
+   AC_L1L2_VOLTAGE,
+   AC_L1_CURRENT,
+   AC_L2_CURRENT,
+   AC_L1L2_CURRENT,
+   AC_Count
+} AcSignal_t;
+
+// The bus signals, which are averaged
+typedef enum
+{
+   DC_POSBUS_VOLTAGE,
+   DC_NEGBUS_VOLTAGE,
+   DC_BUS_CURRENT,
+   DC_Count
+} DcSignal_t;
+
+// The lines whose power is calculated
+typedef enum
+{
+   LINE_L1,
+   LINE_L2,
+   LINE_Count
+} Line_t;
+
+// The signals of one scan, in ADC counts from their zero value
+typedef struct
+{
+   int16_t ac[AC_Count];
+   int16_t dc[DC_Count];
+} Scan_t;
+
+// The sums of the current cycle
+// A cycle has at most a few hundred samples of 13 bits, so the sums of
+// squares and products are exact in 64 bits and the sums in 32 bits
+typedef struct
+{
+   int64_t sumSquares[AC_Count];
+   int64_t sumProducts[LINE_Count];
+   int32_t sum[DC_Count];
+   uint32_t numSamples;
+} Accumulator_t;
+
+// This structure holds the private information for this module
+typedef struct
+{
+   // The sums of the cycle in progress
+   Accumulator_t accumulator;
+
+   // The values of the last complete cycle
+   PowerCalc_Results_t results;
+
+   // The value of one count of each signal in micro-units
+   int32_t acScale[AC_Count];
+   int32_t dcScale[DC_Count];
+
+   // The number of samples processed, wraps
+   uint32_t sampleCount;
+
+   // The position of the last rising zero crossing, in samples with
+   // CROSSING_FRACTION_BITS fractional bits, wraps
+   uint32_t lastCrossing;
+
+   // The last L1-N voltage sample
+   int16_t previousL1nVoltage;
+
+   // true once the L1-N voltage was below the hysteresis since the last crossing
+   bool isArmed;
+
+   // true if the cycle in progress started at a zero crossing
+   bool isCycleStarted;
+
+   // The time of the last buffer, to notice buffers that were missed
+   uint32_t lastBufferTime;
+   bool hasBuffer;
+
+   // The number of gaps in the buffers, each drops a cycle
+   uint32_t numGaps;
+} PowerCalc_Status_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// Status structure for this module
+static PowerCalc_Status_t status;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function removes the zero value from a sample.
+  * Parameters:
+  *    samples - The samples of one scan
+  *    channel - The channel to be taken
+  * Returns:
+  *    int16_t - The sample in ADC counts from the zero value
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static int16_t GetSample(const uint16_t *const samples, const ADC_Drv_Channel_t channel) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function takes the signals of one scan.
+  * Parameters:
+  *    samples - The samples of one scan
+  *    scan - The location where the signals are to be placed
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void GetScan(const uint16_t *const samples, Scan_t *const scan) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function adds a range of scans to the sums of the current cycle.
+  *    Pairs of scans use the dual multiply accumulate.
+  * Parameters:
+  *    buffer - The buffer that holds the scans
+  *    first - The first scan to be added
+  *    end - The scan after the last scan to be added
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void AccumulateScans(const ADC_Drv_Buffer_t *const buffer, uint16_t first, const uint16_t end) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function calculates the values of the current cycle, publishes
+  *    them and starts the next cycle.
+  * Parameters:
+  *    period - The length of the cycle in samples with
+  *             CROSSING_FRACTION_BITS fractional bits, 0 for a window
+  *             without grid cycles
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void FinishCycle(const uint32_t period);
+
+/** Description:
+  *    This function calculates an RMS value from a sum of squares.
+  * Parameters:
+  *    sumSquares - The sum of the squared samples
+  *    length - The length of the sum in samples with CROSSING_FRACTION_BITS
+  *             fractional bits
+  *    scale - The value of one count in micro-units
+  * Returns:
+  *    uint32_t - The RMS value in milli-units
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint32_t GetRms(const int64_t sumSquares, const uint32_t length, const int32_t scale);
+
+/** Description:
+  *    This function calculates an average in milli-units from a sum of
+  *    products of two signals.  An average of single samples uses a second
+  *    scale of 1000000, one micro-unit per micro-unit.
+  * Parameters:
+  *    sum - The sum of the samples or products
+  *    length - The length of the sum in samples with CROSSING_FRACTION_BITS
+  *             fractional bits
+  *    scale1 - The value of one count of the first signal in micro-units
+  *    scale2 - The value of one count of the second signal in micro-units
+  * Returns:
+  *    int32_t - The average in milli-units
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static int32_t GetAverage(const int64_t sum, const uint32_t length, const int32_t scale1, const int32_t scale2);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Remove the zero value from a sample
+static int16_t GetSample(const uint16_t *const samples, const ADC_Drv_Channel_t channel)
+{
+   return((int16_t)((int32_t)samples[channel] - powerCalcChannelConfigTable[channel].offset));
+}
+
+// Take the signals of one scan
+static void GetScan(const uint16_t *const samples, Scan_t *const scan)
+{
+   scan->ac[AC_L1N_VOLTAGE] = GetSample(samples, ADC_DRV_CHANNEL_L1N_Voltage);
+   scan->ac[AC_L2N_VOLTAGE] = GetSample(samples, ADC_DRV_CHANNEL_L2N_Voltage);
+   scan->ac[AC_L1_CURRENT] = GetSample(samples, ADC_DRV_CHANNEL_L1_Current);
+   scan->ac[AC_L2_CURRENT] = GetSample(samples, ADC_DRV_CHANNEL_L2_Current);
+   // The differences stay within 13 bits, the current is halved by its scale
+   scan->ac[AC_L1L2_VOLTAGE] = scan->ac[AC_L1N_VOLTAGE] - scan->ac[AC_L2N_VOLTAGE];
+   scan->ac[AC_L1L2_CURRENT] = scan->ac[AC_L1_CURRENT] - scan->ac[AC_L2_CURRENT];
+
+   scan->dc[DC_POSBUS_VOLTAGE] = GetSample(samples, ADC_DRV_CHANNEL_PosBus_Voltage);
+   scan->dc[DC_NEGBUS_VOLTAGE] = GetSample(samples, ADC_DRV_CHANNEL_NegBus_Voltage);
+   scan->dc[DC_BUS_CURRENT] = GetSample(samples, ADC_DRV_CHANNEL_Bus_Current);
+}
+
+// Add a range of scans to the sums
+static void AccumulateScans(const ADC_Drv_Buffer_t *const buffer, uint16_t first, const uint16_t end)
+{
+   Accumulator_t *accumulator = &status.accumulator;
+   Scan_t scan1;
+   Scan_t scan2;
+   uint8_t index;
+
+   accumulator->numSamples += (uint32_t)end - first;
+
+   // Two scans at a time, each signal packed into one word
+   while ((first + 1U) < end)
+   {
+      uint32_t packed[AC_Count];
+
+      GetScan(buffer->samples[first], &scan1);
+      GetScan(buffer->samples[first + 1U], &scan2);
+
+      for (index = 0U; index < (uint8_t)AC_Count; index++)
+      {
+         packed[index] = PACK_PAIR(scan1.ac[index], scan2.ac[index]);
+         accumulator->sumSquares[index] = MAC_PAIR(packed[index], packed[index], accumulator->sumSquares[index]);
+      }
+
+      accumulator->sumProducts[LINE_L1] = MAC_PAIR(packed[AC_L1N_VOLTAGE], packed[AC_L1_CURRENT], accumulator->sumProducts[LINE_L1]);
+      accumulator->sumProducts[LINE_L2] = MAC_PAIR(packed[AC_L2N_VOLTAGE], packed[AC_L2_CURRENT], accumulator->sumProducts[LINE_L2]);
+
+      for (index = 0U; index < (uint8_t)DC_Count; index++)
+      {
+         accumulator->sum[index] += (int32_t)scan1.dc[index] + scan2.dc[index];
+      }
+
+      first += 2U;
+   }
+
+   // The odd scan at the end of the range
+   if (first < end)
+   {
+      GetScan(buffer->samples[first], &scan1);
+
+      for (index = 0U; index < (uint8_t)AC_Count; index++)
+      {
+         accumulator->sumSquares[index] += (int64_t)scan1.ac[index] * scan1.ac[index];
+      }
+
+      accumulator->sumProducts[LINE_L1] += (int64_t)scan1.ac[AC_L1N_VOLTAGE] * scan1.ac[AC_L1_CURRENT];
+      accumulator->sumProducts[LINE_L2] += (int64_t)scan1.ac[AC_L2N_VOLTAGE] * scan1.ac[AC_L2_CURRENT];
+
+      for (index = 0U; index < (uint8_t)DC_Count; index++)
+      {
+         accumulator->sum[index] += scan1.dc[index];
+      }
+   }
+   else
+   {
+      // Even number of scans
+   }
+}
+
+// Calculate and publish the values of the cycle
+static void FinishCycle(const uint32_t period)
+{
+   const Accumulator_t *accumulator = &status.accumulator;
+   PowerCalc_Results_t *results = &status.results;
+   const uint32_t numSamples = accumulator->numSamples;
+   // The grid signals are averaged over the interpolated cycle, a sample
+   // more or less at the crossings would otherwise change the RMS values by
+   // a fraction of a percent
+   const uint32_t acLength = (period > 0U) ? period : (numSamples << CROSSING_FRACTION_BITS);
+   const uint32_t dcLength = numSamples << CROSSING_FRACTION_BITS;
+
+   if (numSamples > 0U)
+   {
+      results->l1nVoltageRms = GetRms(accumulator->sumSquares[AC_L1N_VOLTAGE], acLength, status.acScale[AC_L1N_VOLTAGE]);
+      results->l2nVoltageRms = GetRms(accumulator->sumSquares[AC_L2N_VOLTAGE], acLength, status.acScale[AC_L2N_VOLTAGE]);
+      results->l1l2VoltageRms = GetRms(accumulator->sumSquares[AC_L1L2_VOLTAGE], acLength, status.acScale[AC_L1L2_VOLTAGE]);
+      results->l1CurrentRms = GetRms(accumulator->sumSquares[AC_L1_CURRENT], acLength, status.acScale[AC_L1_CURRENT]);
+      results->l2CurrentRms = GetRms(accumulator->sumSquares[AC_L2_CURRENT], acLength, status.acScale[AC_L2_CURRENT]);
+      results->l1l2CurrentRms = GetRms(accumulator->sumSquares[AC_L1L2_CURRENT], acLength, status.acScale[AC_L1L2_CURRENT]);
+
+      results->l1RealPower = GetAverage(accumulator->sumProducts[LINE_L1], acLength, status.acScale[AC_L1N_VOLTAGE], status.acScale[AC_L1_CURRENT]);
+      results->l2RealPower = GetAverage(accumulator->sumProducts[LINE_L2], acLength, status.acScale[AC_L2N_VOLTAGE], status.acScale[AC_L2_CURRENT]);
+
+      // mV * mA is uVA
+      results->l1ApparentPower = (uint32_t)(((uint64_t)results->l1nVoltageRms * results->l1CurrentRms) / 1000U);
+      results->l2ApparentPower = (uint32_t)(((uint64_t)results->l2nVoltageRms * results->l2CurrentRms) / 1000U);
+
+      results->posBusVoltage = GetAverage(accumulator->sum[DC_POSBUS_VOLTAGE], dcLength, status.dcScale[DC_POSBUS_VOLTAGE], 1000000);
+      results->negBusVoltage = GetAverage(accumulator->sum[DC_NEGBUS_VOLTAGE], dcLength, status.dcScale[DC_NEGBUS_VOLTAGE], 1000000);
+      results->busCurrent = GetAverage(accumulator->sum[DC_BUS_CURRENT], dcLength, status.dcScale[DC_BUS_CURRENT], 1000000);
+
+      if (period > 0U)
+      {
+         results->frequency = (uint32_t)(((uint64_t)ADC_DRV_SAMPLE_RATE_HZ * 1000U << CROSSING_FRACTION_BITS) / period);
+      }
+      else
+      {
+         results->frequency = 0U;
+      }
+
+      results->numCycles++;
+   }
+   else
+   {
+      // Nothing to calculate
+   }
+
+   memset(&status.accumulator, 0, sizeof(Accumulator_t));
+}
+
+// RMS value in milli-units
+static uint32_t GetRms(const int64_t sumSquares, const uint32_t length, const int32_t scale)
+{
+   // The mean square keeps 16 fractional bits, so the root keeps 8
+   const uint64_t meanSquare = ((uint64_t)sumSquares << (16U + CROSSING_FRACTION_BITS)) / length;
+   const uint64_t rms = Lunar_MathLib_SqrtUint64(meanSquare);
+
+   return((uint32_t)((rms * (uint64_t)scale) / (256U * 1000U)));
+}
+
+// Average in milli-units
+static int32_t GetAverage(const int64_t sum, const uint32_t length, const int32_t scale1, const int32_t scale2)
+{
+   // The mean keeps 8 fractional bits, the first scale is applied before the
+   // second to stay within 64 bits
+   const int64_t mean = (sum * (256 << CROSSING_FRACTION_BITS)) / (int64_t)length;
+   const int64_t scaled = (mean * scale1) / 1000000;
+
+   return((int32_t)((scaled * scale2) / (256 * 1000)));
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Initialize the module
+void PowerCalc_Init(void)
+{
+   memset(&status, 0, sizeof(PowerCalc_Status_t));
+
+   status.acScale[AC_L1N_VOLTAGE] = powerCalcChannelConfigTable[ADC_DRV_CHANNEL_L1N_Voltage].scale;
+   status.acScale[AC_L2N_VOLTAGE] = powerCalcChannelConfigTable[ADC_DRV_CHANNEL_L2N_Voltage].scale;
+   status.acScale[AC_L1L2_VOLTAGE] = powerCalcChannelConfigTable[ADC_DRV_CHANNEL_L1N_Voltage].scale;
+   status.acScale[AC_L1_CURRENT] = powerCalcChannelConfigTable[ADC_DRV_CHANNEL_L1_Current].scale;
+   status.acScale[AC_L2_CURRENT] = powerCalcChannelConfigTable[ADC_DRV_CHANNEL_L2_Current].scale;
+   // Half the difference of the line currents
+   status.acScale[AC_L1L2_CURRENT] = powerCalcChannelConfigTable[ADC_DRV_CHANNEL_L1_Current].scale / 2;
+
+   status.dcScale[DC_POSBUS_VOLTAGE] = powerCalcChannelConfigTable[ADC_DRV_CHANNEL_PosBus_Voltage].scale;
+   status.dcScale[DC_NEGBUS_VOLTAGE] = powerCalcChannelConfigTable[ADC_DRV_CHANNEL_NegBus_Voltage].scale;
+   status.dcScale[DC_BUS_CURRENT] = powerCalcChannelConfigTable[ADC_DRV_CHANNEL_Bus_Current].scale;
+}
+
+// Add the samples of a new buffer to the cycle
+void PowerCalc_BufferReady(void)
+{
+   const ADC_Drv_Buffer_t *buffer = ADC_Drv_GetReadyBuffer();
+   const uint32_t bufferTime = ADC_Drv_GetReadyBufferTime();
+   // Half a buffer time of tolerance for the interrupt latency
+   const uint32_t maxBufferCycles = (Timebase_Drv_GetCyclesPerSecond() / BUFFERS_PER_SECOND) * 3U / 2U;
+   uint16_t first = 0U;
+   uint16_t scan;
+
+   if ((status.hasBuffer) && ((bufferTime - status.lastBufferTime) > maxBufferCycles))
+   {
+      // A buffer was missed, the cycle in progress is incomplete
+      memset(&status.accumulator, 0, sizeof(Accumulator_t));
+      status.isCycleStarted = false;
+      status.isArmed = false;
+      status.numGaps++;
+   }
+   else
+   {
+      // The buffers are contiguous
+   }
+   status.lastBufferTime = bufferTime;
+   status.hasBuffer = true;
+
+   for (scan = 0U; scan < ADC_DRV_SAMPLES_PER_BUFFER; scan++)
+   {
+      const int16_t l1nVoltage = GetSample(buffer->samples[scan], ADC_DRV_CHANNEL_L1N_Voltage);
+      const uint32_t numSamples = status.accumulator.numSamples + scan - first;
+
+      // The first crossing only starts a cycle, so it is taken however soon
+      // it follows a missed buffer
+      if ((status.isArmed) && (status.previousL1nVoltage < 0) && (l1nVoltage >= 0) &&
+          ((numSamples >= POWERCALC_MIN_CYCLE_SAMPLES) || (!status.isCycleStarted)))
+      {
+         // The crossing lies between the previous sample and this one
+         const uint32_t fraction = ((uint32_t)(-status.previousL1nVoltage) << CROSSING_FRACTION_BITS) /
+                                   (uint32_t)(l1nVoltage - status.previousL1nVoltage);
+         const uint32_t crossing = ((status.sampleCount + scan - 1U) << CROSSING_FRACTION_BITS) + fraction;
+
+         AccumulateScans(buffer, first, scan);
+         first = scan;
+
+         if (status.isCycleStarted)
+         {
+            FinishCycle(crossing - status.lastCrossing);
+         }
+         else
+         {
+            // The samples before the first crossing are not a full cycle
+            memset(&status.accumulator, 0, sizeof(Accumulator_t));
+         }
+
+         status.lastCrossing = crossing;
+         status.isCycleStarted = true;
+         status.isArmed = false;
+      }
+      else if (numSamples >= POWERCALC_MAX_CYCLE_SAMPLES)
+      {
+         // No grid cycle, the values are taken over the window
+         AccumulateScans(buffer, first, scan);
+         first = scan;
+
+         FinishCycle(0U);
+         status.isCycleStarted = false;
+      }
+      else
+      {
+         // The cycle continues
+      }
+
+      if (l1nVoltage < -POWERCALC_CROSSING_HYSTERESIS)
+      {
+         status.isArmed = true;
+      }
+      else
+      {
+         // Keep the state
+      }
+
+      status.previousL1nVoltage = l1nVoltage;
+   }
+
+   AccumulateScans(buffer, first, ADC_DRV_SAMPLES_PER_BUFFER);
+   status.sampleCount += ADC_DRV_SAMPLES_PER_BUFFER;
+}
+
+// Get the values of the last cycle
+void PowerCalc_GetResults(PowerCalc_Results_t *const results)
+{
+   *results = status.results;
+}
+
+
+/*******************************************************************************
+// Message Router Function Implementations
+*******************************************************************************/
+
+// Message handler to get the values of the last cycle
+void PowerCalc_MessageRouter_GetResults(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // The values of the last cycle
+      PowerCalc_Results_t results;
+      // The number of cycles dropped for missed buffers
+      uint32_t numGaps;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   {
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      response->results = status.results;
+      response->numGaps = status.numGaps;
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
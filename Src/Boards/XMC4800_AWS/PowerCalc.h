@@ -0,0 +1,124 @@
+/*******************************************************************************
+// Power Calculation
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "PowerCalc_Config.h"
+// Platform Includes
+#include "Lunar_MessageRouter.h"
+#include "Platform.h"
+// Other Includes
+#include <stdbool.h>
+#include <stdint.h>
+
+
+/*******************************************************************************
+// Public Type Declarations
+*******************************************************************************/
+
+/** This structure holds the values of the last grid cycle.  The values are
+  * in milli-units, which the report signals take without a floating point
+  * conversion.
+*/
+typedef struct
+{
+   // RMS voltages, mV
+   uint32_t l1nVoltageRms;
+   uint32_t l2nVoltageRms;
+   uint32_t l1l2VoltageRms;
+
+   // RMS currents, mA
+   // The L1-L2 current is the part of the line currents that flows from L1
+   // to L2, half of their difference
+   uint32_t l1CurrentRms;
+   uint32_t l2CurrentRms;
+   uint32_t l1l2CurrentRms;
+
+   // Real power of each line, mW, negative when power flows into the inverter
+   int32_t l1RealPower;
+   int32_t l2RealPower;
+
+   // Apparent power of each line, mVA
+   uint32_t l1ApparentPower;
+   uint32_t l2ApparentPower;
+
+   // Average bus voltages, mV, and bus current, mA
+   int32_t posBusVoltage;
+   int32_t negBusVoltage;
+   int32_t busCurrent;
+
+   // The grid frequency, mHz, 0 if the values are taken over a window
+   // without grid cycles
+   uint32_t frequency;
+
+   // The number of cycles and windows calculated
+   uint32_t numCycles;
+} PowerCalc_Results_t;
+
+
+/*******************************************************************************
+// Public Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function initializes the module.  All values are zero until the
+  *    first cycle is complete.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void PowerCalc_Init(void);
+
+/** Description:
+  *    This is the handler of the ADC buffer ready event.  The samples of the
+  *    buffer are added to the sums of the current cycle, and a cycle is
+  *    complete at each rising zero crossing of the L1-N voltage.  A gap in
+  *    the buffers drops the current cycle.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void PowerCalc_BufferReady(void);
+
+/** Description:
+  *    This function gets the values of the last complete cycle.
+  * Parameters:
+  *    results - The location where the values are to be placed
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void PowerCalc_GetResults(PowerCalc_Results_t *const results) PLATFORM_NON_NULL;
+
+
+/*******************************************************************************
+// Message Router Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    Message handler that returns the values of the last complete cycle.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void PowerCalc_MessageRouter_GetResults(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
@@ -0,0 +1,55 @@
+/*******************************************************************************
+// Power Calculation Configuration
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+// Platform Includes
+#include "ADC_Drv_Config.h" // Sample rate
+// Other Includes
+#include <stdint.h>
+
+
+/*******************************************************************************
+// Public Constant Declarations
+*******************************************************************************/
+
+// The shortest and longest grid cycle, in samples
+// A zero crossing is ignored until the cycle is 70 Hz long, without a
+// crossing for a 40 Hz cycle the values are calculated over that window
+#define POWERCALC_MIN_CYCLE_SAMPLES (ADC_DRV_SAMPLE_RATE_HZ / 70U)
+#define POWERCALC_MAX_CYCLE_SAMPLES (ADC_DRV_SAMPLE_RATE_HZ / 40U)
+
+// The L1-N voltage must fall below minus this value, in ADC counts, before
+// the next rising zero crossing is accepted, so noise does not split a cycle
+#define POWERCALC_CROSSING_HYSTERESIS (64)
+
+
+/*******************************************************************************
+// Public Type Declarations
+*******************************************************************************/
+
+// Defines the calibration of each ADC channel
+typedef struct
+{
+   // The ADC count of a zero value
+   int16_t offset;
+   // The value of one ADC count in micro-units (uV, uA)
+   int32_t scale;
+} PowerCalc_ChannelConfigItem_t;
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
@@ -0,0 +1,49 @@
+/*******************************************************************************
+// Power Calculation Configuration
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "PowerCalc_Config.h"
+// Platform Includes
+#include "ADC_Drv_Config.h" // Channel enumeration
+// Other Includes
+
+
+/*******************************************************************************
+// Constant Configuration Variable Declarations
+*******************************************************************************/
+
+// This table defines the calibration of each ADC channel, in the order of the
+// channel enumeration
+static const PowerCalc_ChannelConfigItem_t powerCalcChannelConfigTable[ADC_DRV_CHANNEL_Count] =
+{
+   // { offset, scale }
+   // Grid voltages, +/-500 V over the ADC range
+   { 2048, 244141 },
+   { 2048, 244141 },
+   // Line currents, +/-150 A over the ADC range
+   { 2048, 73242 },
+   { 2048, 73242 },
+   // Bus voltages, 0-600 V over the ADC range
+   // The negative bus is measured inverted, as its distance below the midpoint
+   { 0, 146484 },
+   { 0, 146484 },
+   // Bus current, +/-150 A over the ADC range
+   { 2048, 73242 },
+};
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
@@ -8,14 +8,18 @@
 
 // Module Includes
 #include "ReportMgr.h"
+#include "ReportMgr_ConfigTable.h"
 #include "ReportMgr_CAN.h"
 // Platform Includes
 #include "CAN_Drv.h"
 #include "Platform.h"
 #include "Lunar_ErrorMgr.h"
 #include "Lunar_SoftTimerLib.h"
+#include "Timebase_Drv.h"
 // Other Includes
+#include "BatteryMgr.h"
 #include "Control.h"
+#include "PowerCalc.h"
 #include <stdbool.h>
 #include <stdint.h>
 #include <string.h> // Used for memcpy
@@ -25,10 +29,18 @@
 // Private Constant Definitions
 *******************************************************************************/
 
-// This value represent the fault state returned by the BB_BatteryStatusRSP
-// This is currently used to test cacading faults over CAN but is expected to 
-// replaced as the control is implemented.
-#define BATTERY_FAULT_VALUE (99U)
+// The CAN identifier of the error status broadcast, always a 29-bit identifier
+#define ERROR_STATUS_CANID (INV_ErrorStatusRSP_CANID | 0x80000000U)
+
+// The minimum time between error status frames in milliseconds
+// Changes within this time are merged into the next frame
+#define ERROR_STATUS_MIN_INTERVAL_MS (5U)
+
+// The time between repeated error status frames while no error changes
+#define ERROR_STATUS_REPEAT_INTERVAL_MS (1000U)
+
+// The number of messages in the transmit schedule
+#define NUM_TX_SCHEDULE_ITEMS (sizeof(ReportMgr_txScheduleTable) / sizeof(ReportMgr_TxScheduleItem_t))
 
 
 /*******************************************************************************
@@ -40,6 +52,24 @@ typedef struct
 {
    // Last update timestamp
    uint32_t lastUpdateTimestamp;
+
+   // true once the CAN driver can accept frames
+   bool initialized;
+
+   // true if an error change has not been broadcast yet
+   bool errorStatusPending;
+
+   // Incremented on every error change so receivers can detect merged frames
+   uint16_t errorSequence;
+
+   // The number of error changes since the last error status frame
+   uint16_t numErrorChanges;
+
+   // The time the last error status frame was queued
+   uint32_t lastErrorStatusTime;
+
+   // The time each scheduled message is due next
+   uint32_t nextTxTime[NUM_TX_SCHEDULE_ITEMS];
 } ReportMgr_Status_t;
 
 
@@ -55,11 +85,143 @@ static ReportMgr_Status_t status;
 // Private Function Declarations
 *******************************************************************************/
 
+/** Description:
+  *    This function fills an error status frame with the current errors.
+  * Parameters:
+  *    errorStatus :  The frame to be filled
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void BuildErrorStatus(INV_ErrorStatusRSP_t *const errorStatus) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function queues the error status frame on the CAN bus when a
+  *    change is pending and the minimum interval has passed, or when the
+  *    repeat interval has passed.  A frame that cannot be queued is retried
+  *    on the next call.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void SendErrorStatus(void);
+
+/** Description:
+  *    This function sends the first scheduled message that is due.  A message
+  *    that cannot be queued stays due and is retried on the next call.  A
+  *    message that fell more than a cycle behind is rescheduled from the
+  *    current time instead of sending the missed frames in a burst.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void ServiceTxSchedule(void);
+
 
 /*******************************************************************************
 // Private Function Implementations
 *******************************************************************************/
 
+// Fill the error status frame
+static void BuildErrorStatus(INV_ErrorStatusRSP_t *const errorStatus)
+{
+   uint32_t errorWords[LUNAR_ERRORMGR_NUM_ERROR_WORDS];
+
+   // The frame carries the first 32 errors, one bit per error
+   Lunar_ErrorMgr_GetErrorWords(errorWords);
+
+   errorStatus->ActiveErrors = errorWords[0];
+   errorStatus->ErrorSequence = status.errorSequence;
+   errorStatus->NumErrorChanges = status.numErrorChanges;
+}
+
+
+// Queue the error status frame if the rate limit allows it
+static void SendErrorStatus(void)
+{
+   uint32_t currentTime = Timebase_Drv_GetCurrentTickCount();
+   uint32_t elapsedTime = currentTime - status.lastErrorStatusTime;
+
+   // Send a change as soon as the minimum interval allows, otherwise repeat the state slowly
+   if (((status.errorStatusPending) && (elapsedTime >= (ERROR_STATUS_MIN_INTERVAL_MS * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND))) ||
+       (elapsedTime >= (ERROR_STATUS_REPEAT_INTERVAL_MS * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND)))
+   {
+      INV_ErrorStatusRSP_t errorStatus;
+      uint8_t frameData[INV_ErrorStatusRSP_DLC];
+
+      BuildErrorStatus(&errorStatus);
+      INV_ErrorStatusRSP_Pack(frameData, &errorStatus);
+
+      // The previous frame may still be waiting for the bus, try again next time
+      if (CAN_Drv_StartTransmitFrame(CAN_DRV_CHANNEL_PRIMARY, ERROR_STATUS_CANID, frameData, (uint8_t)INV_ErrorStatusRSP_DLC))
+      {
+         status.errorStatusPending = false;
+         status.numErrorChanges = 0U;
+         status.lastErrorStatusTime = currentTime;
+      }
+   }
+}
+
+
+// Send the next scheduled message
+static void ServiceTxSchedule(void)
+{
+   uint32_t currentTime = Timebase_Drv_GetCurrentTickCount();
+   bool frameQueued = false;
+
+   // Only one frame is queued per call, later messages wait for the next call
+   for (uint32_t i = 0U; (i < NUM_TX_SCHEDULE_ITEMS) && (!frameQueued); i++)
+   {
+      const ReportMgr_TxScheduleItem_t *item = &ReportMgr_txScheduleTable[i];
+
+      // The signed difference handles the wrap of the tick count
+      if ((int32_t)(currentTime - status.nextTxTime[i]) >= 0)
+      {
+         // The message functions pack the signals byte by byte into the frame
+         uint8_t frameData[CAN_DRV_MAX_DATA_LENGTH];
+         Lunar_MessageRouter_Message_t message;
+
+         // Build an internal request for the message, without command parameters
+         message.header.moduleID = (uint8_t)(item->canId >> 8U);
+         message.header.commandID = (uint8_t)item->canId;
+         message.header.messageID = 0U;
+         message.commandParams.data = frameData;
+         message.commandParams.maxLength = (uint8_t)sizeof(frameData);
+         message.commandParams.length = 0U;
+         message.responseParams.data = frameData;
+         message.responseParams.maxLength = (uint8_t)sizeof(frameData);
+         message.responseParams.length = 0U;
+         message.responseCode = LUNAR_MESSAGEROUTER_RESPONSE_CODE_None;
+         message.source.transport = LUNAR_MESSAGEROUTER_TRANSPORT_Internal;
+         message.source.channel = 0U;
+         message.source.address = 0U;
+         message.source.timestamp = Timebase_Drv_GetCycleCount();
+
+         item->packFunction(&message);
+
+         // A message that cannot be packed skips this cycle rather than retrying forever
+         bool isPacked = (message.responseCode == LUNAR_MESSAGEROUTER_RESPONSE_CODE_None);
+
+         if ((isPacked) && (!CAN_Drv_StartTransmitFrame(CAN_DRV_CHANNEL_PRIMARY, item->canId, frameData, message.responseParams.length)))
+         {
+            // The previous frame is still waiting for the bus, try again next time
+            break;
+         }
+
+         frameQueued = isPacked;
+
+         // Keep the phase of the message
+         status.nextTxTime[i] += (uint32_t)item->cycleTimeMs * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND;
+
+         // Do not catch up on missed frames
+         if ((int32_t)(currentTime - status.nextTxTime[i]) >= 0)
+         {
+            status.nextTxTime[i] = currentTime + ((uint32_t)item->cycleTimeMs * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND);
+         }
+      }
+   }
+}
+
 
 /*******************************************************************************
 // Public Function Implementations
@@ -70,15 +232,52 @@ void ReportMgr_Init(void)
 {
    // Clear the last update timestamp
    status.lastUpdateTimestamp = 0;
+
+   // Announce the current errors right away
+   // Changes made before this point are already counted in the sequence
+   status.errorStatusPending = true;
+   status.lastErrorStatusTime = Timebase_Drv_GetCurrentTickCount() - (ERROR_STATUS_MIN_INTERVAL_MS * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND);
+
+   // Start every scheduled message at its phase offset
+   uint32_t currentTime = Timebase_Drv_GetCurrentTickCount();
+   for (uint32_t i = 0U; i < NUM_TX_SCHEDULE_ITEMS; i++)
+   {
+      status.nextTxTime[i] = currentTime + ((uint32_t)ReportMgr_txScheduleTable[i].phaseOffsetMs * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND);
+   }
+
+   status.initialized = true;
 }
 
 
 // Periodic update function
 void ReportMgr_Update(void)
 {
-   //static uint8_t data[] = {1,2,3}; //,4,5,6,7,8};
-   //CAN_Drv_TransmitPacket(&data[0], sizeof(data));
-		
+   // Error changes go first, they share the transmit queue with the schedule
+   SendErrorStatus();
+
+   // Stream the periodic messages
+   ServiceTxSchedule();
+}
+
+
+// Note an error change
+void ReportMgr_ErrorChanged(void)
+{
+   status.errorSequence++;
+
+   if (status.numErrorChanges < UINT16_MAX)
+   {
+      status.numErrorChanges++;
+   }
+
+   status.errorStatusPending = true;
+
+   // Send the change without waiting for the next update
+   // The CAN driver is not ready until this module has been initialized
+   if (status.initialized)
+   {
+      SendErrorStatus();
+   }
 }
 
 
@@ -86,6 +285,38 @@ void ReportMgr_Update(void)
 // Message Router Function Implementations
 *******************************************************************************/
 
+// INV_ErrorStatusRSP
+void ReportMgr_MessageRouter_INV_ErrorStatusRSP(Lunar_MessageRouter_Message_t *const message)
+{
+   // Command/Response Params defined in ReportMgr_CAN.h file
+   typedef INV_ErrorStatusRSP_t Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, INV_ErrorStatusRSP_DLC))
+   {
+      // Fill in the signals, they are packed into the response buffer below
+      Response_t response = {0};
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      // The same frame that is broadcast on every error change
+      BuildErrorStatus(&response);
+
+      // Pack the signals into the frame layout of the DBC
+      INV_ErrorStatusRSP_Pack(message->responseParams.data, &response);
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, INV_ErrorStatusRSP_DLC);
+   }
+}
+
 
 //INV_L2NStatusRSP_CANID
 void ReportMgr_MessageRouter_INV_L2NStatusRSP(Lunar_MessageRouter_Message_t *const message)
@@ -99,26 +330,33 @@ void ReportMgr_MessageRouter_INV_L2NStatusRSP(Lunar_MessageRouter_Message_t *con
 
    // Verify the length of the command parameters and make sure we have room for the response
    //	Note that the error response will be set, if necessary
-   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, INV_L2NStatusRSP_DLC))
    {
-      // Cast the response buffer as the response type
-      Response_t *response = (Response_t *)message->responseParams.data;
+      // Fill in the signals, they are packed into the response buffer below
+      Response_t response = {0};
+      // The values of the last grid cycle
+      PowerCalc_Results_t results;
 
       //-----------------------------------------------
       // Execute Command
       //-----------------------------------------------
 
+      PowerCalc_GetResults(&results);
+
       //      Bits=16.  [ 0     , 655.35 ]  Unit:''      Factor= 0.01
-      response->L1NVoltageVrms = INV_L2NStatusRSP_L1NVoltageVrms_toS(300.01);
+      response.L1NVoltageVrms = INV_L2NStatusRSP_L1NVoltageVrms_toS_Milli((int32_t)results.l1nVoltageRms);
       //      Bits=16.  [ 0     , 655.35 ]  Unit:''      Factor= 0.01
-      response->L2NVoltageVrms = INV_L2NStatusRSP_L2NVoltageVrms_toS(300.02);
+      response.L2NVoltageVrms = INV_L2NStatusRSP_L2NVoltageVrms_toS_Milli((int32_t)results.l2nVoltageRms);
       //      Bits=16.  [ 0     , 327.675 ]  Unit:''      Factor= 0.005
-      response->L1NCurrentArms = INV_L2NStatusRSP_L1NCurrentArms_toS(100.005);
+      response.L1NCurrentArms = INV_L2NStatusRSP_L1NCurrentArms_toS_Milli((int32_t)results.l1CurrentRms);
       //      Bits=16.  [ 0     , 327.675 ]  Unit:''      Factor= 0.005
-      response->L2NCurrentArms = INV_L2NStatusRSP_L2NCurrentArms_toS(100.010);
+      response.L2NCurrentArms = INV_L2NStatusRSP_L2NCurrentArms_toS_Milli((int32_t)results.l2CurrentRms);
+
+      // Pack the signals into the frame layout of the DBC
+      INV_L2NStatusRSP_Pack(message->responseParams.data, &response);
 
       // Set the response length
-      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+      Lunar_MessageRouter_SetResponseSize(message, INV_L2NStatusRSP_DLC);
    }
 }
 
@@ -135,22 +373,29 @@ void ReportMgr_MessageRouter_INV_L2LStatusRSP(Lunar_MessageRouter_Message_t *con
 
    // Verify the length of the command parameters and make sure we have room for the response
    //	Note that the error response will be set, if necessary
-   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, INV_L2LStatusRSP_DLC))
    {
-      // Cast the response buffer as the response type
-      Response_t *response = (Response_t *)message->responseParams.data;
+      // Fill in the signals, they are packed into the response buffer below
+      Response_t response = {0};
+      // The values of the last grid cycle
+      PowerCalc_Results_t results;
 
       //-----------------------------------------------
       // Execute Command
       //-----------------------------------------------
 
+      PowerCalc_GetResults(&results);
+
       //      Bits=16.  [ 0     , 655.35 ]  Unit:''      Factor= 0.01
-      response->L1L2VoltageVrms = INV_L2LStatusRSP_L1L2VoltageVrms_toS(300.01);
+      response.L1L2VoltageVrms = INV_L2LStatusRSP_L1L2VoltageVrms_toS_Milli((int32_t)results.l1l2VoltageRms);
       //      Bits=16.  [ 0     , 327.675 ]  Unit:''      Factor= 0.005
-      response->L1L2CurrentArms = INV_L2LStatusRSP_L1L2CurrentArms_toS(100.005);
+      response.L1L2CurrentArms = INV_L2LStatusRSP_L1L2CurrentArms_toS_Milli((int32_t)results.l1l2CurrentRms);
+
+      // Pack the signals into the frame layout of the DBC
+      INV_L2LStatusRSP_Pack(message->responseParams.data, &response);
 
       // Set the response length
-      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+      Lunar_MessageRouter_SetResponseSize(message, INV_L2LStatusRSP_DLC);
    }
 }
 
@@ -166,26 +411,35 @@ void ReportMgr_MessageRouter_INV_DCBusStatusRSP(Lunar_MessageRouter_Message_t *c
 
    // Verify the length of the command parameters and make sure we have room for the response
    //	Note that the error response will be set, if necessary
-   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, INV_DCBusStatusRSP_DLC))
    {
-      // Cast the response buffer as the response type
-      Response_t *response = (Response_t *)message->responseParams.data;
+      // Fill in the signals, they are packed into the response buffer below
+      Response_t response = {0};
+      // The averages of the last grid cycle
+      PowerCalc_Results_t results;
 
       //-----------------------------------------------
       // Execute Command
       //-----------------------------------------------
-		
-		//      Bits=16.  [ 0     , 655.35 ]  Unit:''      Factor= 0.01
-		response->PosBusVoltage = INV_DCBusStatusRSP_PosBusVoltage_toS(300.01);
-		//      Bits=16.  [ 0     , 655.35 ]  Unit:''      Factor= 0.01
-		response->NegBusVoltage = INV_DCBusStatusRSP_NegBusVoltage_toS(300.02);
-		//      Bits=16.  [ 0     , 327.675 ]  Unit:''      Factor= 0.005
-		response->PosBusCurrent = INV_DCBusStatusRSP_PosBusCurrent_toS(100.05);
-		//      Bits=16.  [ 0     , 327.675 ]  Unit:''      Factor= 0.005
-		response->NegBusCurrent = INV_DCBusStatusRSP_NegBusCurrent_toS(100.10);
+
+      PowerCalc_GetResults(&results);
+
+      //      Bits=16.  [ 0     , 655.35 ]  Unit:''      Factor= 0.01
+      response.PosBusVoltage = INV_DCBusStatusRSP_PosBusVoltage_toS_Milli(results.posBusVoltage);
+      //      Bits=16.  [ 0     , 655.35 ]  Unit:''      Factor= 0.01
+      response.NegBusVoltage = INV_DCBusStatusRSP_NegBusVoltage_toS_Milli(results.negBusVoltage);
+      // The current of the positive bus returns through the negative bus,
+      // a single sensor measures both
+      //      Bits=16.  [ 0     , 327.675 ]  Unit:''      Factor= 0.005
+      response.PosBusCurrent = INV_DCBusStatusRSP_PosBusCurrent_toS_Milli(results.busCurrent);
+      //      Bits=16.  [ 0     , 327.675 ]  Unit:''      Factor= 0.005
+      response.NegBusCurrent = INV_DCBusStatusRSP_NegBusCurrent_toS_Milli(results.busCurrent);
+
+      // Pack the signals into the frame layout of the DBC
+      INV_DCBusStatusRSP_Pack(message->responseParams.data, &response);
 
       // Set the response length
-      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+      Lunar_MessageRouter_SetResponseSize(message, INV_DCBusStatusRSP_DLC);
    }	
 }
 
@@ -201,30 +455,33 @@ void ReportMgr_MessageRouter_INV_TemperaturesRSP(Lunar_MessageRouter_Message_t *
 
    // Verify the length of the command parameters and make sure we have room for the response
    //	Note that the error response will be set, if necessary
-   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, INV_TemperaturesRSP_DLC))
    {
-      // Cast the response buffer as the response type
-      Response_t *response = (Response_t *)message->responseParams.data;
+      // Fill in the signals, they are packed into the response buffer below
+      Response_t response = {0};
 
       //-----------------------------------------------
       // Execute Command
       //-----------------------------------------------
 
 		//      Bits=08.  [ -60   , 195    ]  Unit:''      Offset= -60
-		response->InvHeatsinkC = INV_TemperaturesRSP_InvHeatsinkC_toS(100);
+		response.InvHeatsinkC = INV_TemperaturesRSP_InvHeatsinkC_toS(100);
 		//      Bits=08.  [ -60   , 195    ]  Unit:''      Offset= -60
-		response->InvPowerStage1C = INV_TemperaturesRSP_InvPowerStage1C_toS(101);
+		response.InvPowerStage1C = INV_TemperaturesRSP_InvPowerStage1C_toS(101);
 		//      Bits=08.  [ -60   , 195    ]  Unit:''      Offset= -60
-		response->InvPowerStage2C = INV_TemperaturesRSP_InvPowerStage2C_toS(102);
+		response.InvPowerStage2C = INV_TemperaturesRSP_InvPowerStage2C_toS(102);
 		//     Bits=08.  [ -60   , 195    ]  Unit:''      Offset= -60
-		response->InvPowerStage3C = INV_TemperaturesRSP_InvPowerStage3C_toS(103);
+		response.InvPowerStage3C = INV_TemperaturesRSP_InvPowerStage3C_toS(103);
 		//      Bits=16.  [ 0     , 102.3  ]  Unit:''      Factor= 0.1
-		response->InvFanDutyCycle1 = INV_TemperaturesRSP_InvFanDutyCycle1_toS(90.1);
+		response.InvFanDutyCycle1 = INV_TemperaturesRSP_InvFanDutyCycle1_toS(90.1);
 		//      Bits=16.  [ 0     , 102.3  ]  Unit:''      Factor= 0.1
-		response->InvFanDutyCycle2 = INV_TemperaturesRSP_InvFanDutyCycle1_toS(90.2);
+		response.InvFanDutyCycle2 = INV_TemperaturesRSP_InvFanDutyCycle1_toS(90.2);
 		
+      // Pack the signals into the frame layout of the DBC
+      INV_TemperaturesRSP_Pack(message->responseParams.data, &response);
+
       // Set the response length
-      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+      Lunar_MessageRouter_SetResponseSize(message, INV_TemperaturesRSP_DLC);
    }	
 }
 
@@ -240,24 +497,27 @@ void ReportMgr_MessageRouter_INV_StateRSP(Lunar_MessageRouter_Message_t *const m
 
    // Verify the length of the command parameters and make sure we have room for the response
    //	Note that the error response will be set, if necessary
-   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, INV_StateRSP_DLC))
    {
-      // Cast the response buffer as the response type
-      Response_t *response = (Response_t *)message->responseParams.data;
+      // Fill in the signals, they are packed into the response buffer below
+      Response_t response = {0};
 
       //-----------------------------------------------
       // Execute Command
       //-----------------------------------------------
 
 		//      Bits=08.  [ 0     , 255    ]  Unit:''
-		response->InvState = (uint8_t)Control_GetState();;
+		response.InvState = (uint8_t)Control_GetState();;
 		//      Bits=08.  [ 0     , 255    ]  Unit:''
-		response->InvACRelay = 255U;
+		response.InvACRelay = 255U;
 		//      Bits=08.  [ 0     , 255    ]  Unit:''
-		response->INV_L1L2InPhase = 255U;
+		response.INV_L1L2InPhase = 255U;
 		
+      // Pack the signals into the frame layout of the DBC
+      INV_StateRSP_Pack(message->responseParams.data, &response);
+
       // Set the response length
-      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+      Lunar_MessageRouter_SetResponseSize(message, INV_StateRSP_DLC);
    }		
 }
 
@@ -273,22 +533,140 @@ void ReportMgr_MessageRouter_BB_BatteryStatusRSP(Lunar_MessageRouter_Message_t *
 
    // Verify the length of the command parameters and make sure we have room for the response
    //	Note that the error response will be set, if necessary
-   if (Lunar_MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), 0))
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, BB_BatteryStatusRSP_DLC, 0))
    {
-      // Cast the response buffer as the response type
-      Command_t *command = (Command_t *)message->commandParams.data;
+      // Unpack the signals from the command buffer
+      Command_t command;
+      BB_BatteryStatusRSP_Unpack(&command, message->commandParams.data);
 
       //-----------------------------------------------
       // Execute Command
       //-----------------------------------------------
-		
-		// Just set the error state if the battery is in fault mode
-		Lunar_ErrorMgr_SetErrorState(LUNAR_ERRORMGR_ERROR_BATTERY_FAULT, command->BatteryBlockState == BATTERY_FAULT_VALUE);
-		
+
+      // The node ID of the block is taken from the CAN identifier
+      BatteryMgr_SetBatteryStatus(message->source.address, &command);
+
       // Set the response length
       Lunar_MessageRouter_SetResponseSize(message, 0);
    }		
 }
 
+//BB_ErrorStatusRSP
+void ReportMgr_MessageRouter_BB_ErrorStatusRSP(Lunar_MessageRouter_Message_t *const message)
+{
+   // Command/Response Params defined in ReportMgr_CAN.h file
+   typedef BB_ErrorStatusRSP_t Command_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, BB_ErrorStatusRSP_DLC, 0))
+   {
+      // Unpack the signals from the command buffer
+      Command_t command;
+      BB_ErrorStatusRSP_Unpack(&command, message->commandParams.data);
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      // Any active error in the battery block is a battery fault for the inverter
+      BatteryMgr_SetActiveErrors(message->source.address, command.ActiveErrors);
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, 0);
+   }
+}
+
+//BB_CellVoltage1to4RSP
+void ReportMgr_MessageRouter_BB_CellVoltage1to4RSP(Lunar_MessageRouter_Message_t *const message)
+{
+   // Command/Response Params defined in ReportMgr_CAN.h file
+   typedef BB_CellVoltage1to4RSP_t Command_t;
 
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, BB_CellVoltage1to4RSP_DLC, 0))
+   {
+      // Unpack the signals from the command buffer
+      Command_t command;
+      BB_CellVoltage1to4RSP_Unpack(&command, message->commandParams.data);
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      const uint16_t cellVoltages[4] = { command.Cell1V, command.Cell2V, command.Cell3V, command.Cell4V };
+      BatteryMgr_SetCellVoltages(message->source.address, 0U, cellVoltages);
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, 0);
+   }
+}
 
+//BB_CellVoltage5to8RSP
+void ReportMgr_MessageRouter_BB_CellVoltage5to8RSP(Lunar_MessageRouter_Message_t *const message)
+{
+   // Command/Response Params defined in ReportMgr_CAN.h file
+   typedef BB_CellVoltage5to8RSP_t Command_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, BB_CellVoltage5to8RSP_DLC, 0))
+   {
+      // Unpack the signals from the command buffer
+      Command_t command;
+      BB_CellVoltage5to8RSP_Unpack(&command, message->commandParams.data);
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      const uint16_t cellVoltages[4] = { command.Cell5V, command.Cell6V, command.Cell7V, command.Cell8V };
+      BatteryMgr_SetCellVoltages(message->source.address, 4U, cellVoltages);
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, 0);
+   }
+}
+
+//BB_CellVoltage9to12RSP
+void ReportMgr_MessageRouter_BB_CellVoltage9to12RSP(Lunar_MessageRouter_Message_t *const message)
+{
+   // Command/Response Params defined in ReportMgr_CAN.h file
+   typedef BB_CellVoltage9to12RSP_t Command_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, BB_CellVoltage9to12RSP_DLC, 0))
+   {
+      // Unpack the signals from the command buffer
+      Command_t command;
+      BB_CellVoltage9to12RSP_Unpack(&command, message->commandParams.data);
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      const uint16_t cellVoltages[4] = { command.Cell9V, command.Cell10V, command.Cell11V, command.Cell12V };
+      BatteryMgr_SetCellVoltages(message->source.address, 8U, cellVoltages);
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, 0);
+   }
+}
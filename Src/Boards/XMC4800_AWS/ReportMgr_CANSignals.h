@@ -0,0 +1,2639 @@
+/*******************************************************************************
+// Report Manager CAN Signal Packing and Conversions (Autogenerated)
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+// Platform Includes
+// Other Includes
+#include <stdint.h>
+
+// NOTE: This file is generated by DBC/dbc_codegen.py from DBC/Lunar_CAN_Messages.dbc, do not edit
+// It is included at the end of ReportMgr_CAN.h, after the message structures
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// Compile-time check, a false condition declares an array with a negative size
+#define REPORTMGR_CAN_STATIC_ASSERT(name, condition) typedef char name[(condition) ? 1 : -1]
+
+// true if the structure field is wide enough for the given number of bits
+#define REPORTMGR_CAN_FIELD_FITS(type, field, bits) ((sizeof(((type *)0)->field) * 8U) >= (bits))
+
+
+/*******************************************************************************
+// Public Type Declarations
+*******************************************************************************/
+
+// Value table: BB_State_Enum
+typedef enum
+{
+   BB_STATE_ENUM_Unknown = 0,
+   BB_STATE_ENUM_Disconnected = 1,
+   BB_STATE_ENUM_Initializing = 2,
+   BB_STATE_ENUM_Connected = 3,
+   BB_STATE_ENUM_Standby = 4,
+   BB_STATE_ENUM_Soc_Protection = 5,
+   BB_STATE_ENUM_Suspending = 6,
+   BB_STATE_ENUM_Fault = 99,
+} BB_State_Enum_t;
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// BB_BatteryStatusRSP CAN Message (0x1B001U)
+
+// The raw range of every signal must fit in its structure field
+REPORTMGR_CAN_STATIC_ASSERT(BB_BatteryStatusRSP_BatteryBlockState_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_BatteryStatusRSP_t, BatteryBlockState, 8U));
+REPORTMGR_CAN_STATIC_ASSERT(BB_BatteryStatusRSP_BatteryVoltageV_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_BatteryStatusRSP_t, BatteryVoltageV, 16U));
+REPORTMGR_CAN_STATIC_ASSERT(BB_BatteryStatusRSP_BatteryCurrentA_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_BatteryStatusRSP_t, BatteryCurrentA, 16U));
+REPORTMGR_CAN_STATIC_ASSERT(BB_BatteryStatusRSP_BatterySOC_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_BatteryStatusRSP_t, BatterySOC, 10U));
+
+// pack the signals into the CAN frame data, every byte of the frame is written
+static inline void BB_BatteryStatusRSP_Pack(uint8_t *const data, const BB_BatteryStatusRSP_t *const signals)
+{
+   const uint32_t rawBatteryBlockState = (uint32_t)signals->BatteryBlockState;
+   const uint32_t rawBatteryVoltageV = (uint32_t)signals->BatteryVoltageV;
+   const uint32_t rawBatteryCurrentA = (uint32_t)(int32_t)signals->BatteryCurrentA;
+   const uint32_t rawBatterySOC = (uint32_t)signals->BatterySOC;
+
+   data[0] = (uint8_t)rawBatteryBlockState;
+   data[1] = (uint8_t)(rawBatteryBlockState >> 8);
+   data[2] = (uint8_t)rawBatteryVoltageV;
+   data[3] = (uint8_t)(rawBatteryVoltageV >> 8);
+   data[4] = (uint8_t)rawBatteryCurrentA;
+   data[5] = (uint8_t)(rawBatteryCurrentA >> 8);
+   data[6] = (uint8_t)rawBatterySOC;
+   data[7] = (uint8_t)(rawBatterySOC >> 8);
+}
+
+// unpack the signals from the CAN frame data
+static inline void BB_BatteryStatusRSP_Unpack(BB_BatteryStatusRSP_t *const signals, const uint8_t *const data)
+{
+   // BatteryBlockState : 0|16@1+
+   const uint32_t rawBatteryBlockState = (uint32_t)data[0] | ((uint32_t)data[1] << 8);
+   signals->BatteryBlockState = (uint16_t)rawBatteryBlockState;
+
+   // BatteryVoltageV : 16|16@1+
+   const uint32_t rawBatteryVoltageV = (uint32_t)data[2] | ((uint32_t)data[3] << 8);
+   signals->BatteryVoltageV = (uint16_t)rawBatteryVoltageV;
+
+   // BatteryCurrentA : 32|16@1-
+   const uint32_t rawBatteryCurrentA = (((uint32_t)data[4] | ((uint32_t)data[5] << 8)) ^ 0x8000U) - 0x8000U;
+   signals->BatteryCurrentA = (int16_t)(int32_t)rawBatteryCurrentA;
+
+   // BatterySOC : 48|16@1+
+   const uint32_t rawBatterySOC = (uint32_t)data[6] | ((uint32_t)data[7] << 8);
+   signals->BatterySOC = (uint16_t)rawBatterySOC;
+}
+
+// signal: @BatteryVoltageV  Factor= 0.001  Offset= 0.0
+#define BB_BatteryStatusRSP_BatteryVoltageV_MinRaw 0
+#define BB_BatteryStatusRSP_BatteryVoltageV_MaxRaw 65535
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t BB_BatteryStatusRSP_BatteryVoltageV_toS(const float value)
+{
+   float raw = value * 1000.0f;
+   if (raw < (float)BB_BatteryStatusRSP_BatteryVoltageV_MinRaw)
+   {
+      raw = (float)BB_BatteryStatusRSP_BatteryVoltageV_MinRaw;
+   }
+   else if (raw > (float)BB_BatteryStatusRSP_BatteryVoltageV_MaxRaw)
+   {
+      raw = (float)BB_BatteryStatusRSP_BatteryVoltageV_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t BB_BatteryStatusRSP_BatteryVoltageV_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   if (raw < BB_BatteryStatusRSP_BatteryVoltageV_MinRaw)
+   {
+      raw = BB_BatteryStatusRSP_BatteryVoltageV_MinRaw;
+   }
+   else if (raw > BB_BatteryStatusRSP_BatteryVoltageV_MaxRaw)
+   {
+      raw = BB_BatteryStatusRSP_BatteryVoltageV_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float BB_BatteryStatusRSP_BatteryVoltageV_fromS(const int32_t raw)
+{
+   return((float)raw * 0.001f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t BB_BatteryStatusRSP_BatteryVoltageV_fromS_Milli(const int32_t raw)
+{
+   return(raw);
+}
+
+// signal: @BatteryCurrentA  Factor= 0.005  Offset= 0.0
+#define BB_BatteryStatusRSP_BatteryCurrentA_MinRaw (-32768)
+#define BB_BatteryStatusRSP_BatteryCurrentA_MaxRaw 32767
+
+// conversion value to CAN signal, clamped to the signal range
+static inline int16_t BB_BatteryStatusRSP_BatteryCurrentA_toS(const float value)
+{
+   float raw = value * 200.0f;
+   if (raw < (float)BB_BatteryStatusRSP_BatteryCurrentA_MinRaw)
+   {
+      raw = (float)BB_BatteryStatusRSP_BatteryCurrentA_MinRaw;
+   }
+   else if (raw > (float)BB_BatteryStatusRSP_BatteryCurrentA_MaxRaw)
+   {
+      raw = (float)BB_BatteryStatusRSP_BatteryCurrentA_MaxRaw;
+   }
+   return((int16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline int16_t BB_BatteryStatusRSP_BatteryCurrentA_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   raw = (raw >= 0) ? ((raw + 2) / 5) : ((raw - 2) / 5);
+   if (raw < BB_BatteryStatusRSP_BatteryCurrentA_MinRaw)
+   {
+      raw = BB_BatteryStatusRSP_BatteryCurrentA_MinRaw;
+   }
+   else if (raw > BB_BatteryStatusRSP_BatteryCurrentA_MaxRaw)
+   {
+      raw = BB_BatteryStatusRSP_BatteryCurrentA_MaxRaw;
+   }
+   return((int16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float BB_BatteryStatusRSP_BatteryCurrentA_fromS(const int32_t raw)
+{
+   return((float)raw * 0.005f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t BB_BatteryStatusRSP_BatteryCurrentA_fromS_Milli(const int32_t raw)
+{
+   return(raw * 5);
+}
+
+// signal: @BatterySOC  Factor= 0.1  Offset= 0.0
+#define BB_BatteryStatusRSP_BatterySOC_MinRaw 0
+#define BB_BatteryStatusRSP_BatterySOC_MaxRaw 1023
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t BB_BatteryStatusRSP_BatterySOC_toS(const float value)
+{
+   float raw = value * 10.0f;
+   if (raw < (float)BB_BatteryStatusRSP_BatterySOC_MinRaw)
+   {
+      raw = (float)BB_BatteryStatusRSP_BatterySOC_MinRaw;
+   }
+   else if (raw > (float)BB_BatteryStatusRSP_BatterySOC_MaxRaw)
+   {
+      raw = (float)BB_BatteryStatusRSP_BatterySOC_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t BB_BatteryStatusRSP_BatterySOC_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   raw = (raw >= 0) ? ((raw + 50) / 100) : ((raw - 50) / 100);
+   if (raw < BB_BatteryStatusRSP_BatterySOC_MinRaw)
+   {
+      raw = BB_BatteryStatusRSP_BatterySOC_MinRaw;
+   }
+   else if (raw > BB_BatteryStatusRSP_BatterySOC_MaxRaw)
+   {
+      raw = BB_BatteryStatusRSP_BatterySOC_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float BB_BatteryStatusRSP_BatterySOC_fromS(const int32_t raw)
+{
+   return((float)raw * 0.1f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t BB_BatteryStatusRSP_BatterySOC_fromS_Milli(const int32_t raw)
+{
+   return(raw * 100);
+}
+
+// BB_DCDCStatusRSP CAN Message (0x1B002U)
+
+// The raw range of every signal must fit in its structure field
+REPORTMGR_CAN_STATIC_ASSERT(BB_DCDCStatusRSP_DCBusVoltageV_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_DCDCStatusRSP_t, DCBusVoltageV, 16U));
+REPORTMGR_CAN_STATIC_ASSERT(BB_DCDCStatusRSP_DCBusCurrentA_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_DCDCStatusRSP_t, DCBusCurrentA, 16U));
+
+// pack the signals into the CAN frame data, every byte of the frame is written
+static inline void BB_DCDCStatusRSP_Pack(uint8_t *const data, const BB_DCDCStatusRSP_t *const signals)
+{
+   const uint32_t rawDCBusVoltageV = (uint32_t)signals->DCBusVoltageV;
+   const uint32_t rawDCBusCurrentA = (uint32_t)(int32_t)signals->DCBusCurrentA;
+
+   data[0] = (uint8_t)rawDCBusVoltageV;
+   data[1] = (uint8_t)(rawDCBusVoltageV >> 8);
+   data[2] = (uint8_t)rawDCBusCurrentA;
+   data[3] = (uint8_t)(rawDCBusCurrentA >> 8);
+}
+
+// unpack the signals from the CAN frame data
+static inline void BB_DCDCStatusRSP_Unpack(BB_DCDCStatusRSP_t *const signals, const uint8_t *const data)
+{
+   // DCBusVoltageV : 0|16@1+
+   const uint32_t rawDCBusVoltageV = (uint32_t)data[0] | ((uint32_t)data[1] << 8);
+   signals->DCBusVoltageV = (uint16_t)rawDCBusVoltageV;
+
+   // DCBusCurrentA : 16|16@1-
+   const uint32_t rawDCBusCurrentA = (((uint32_t)data[2] | ((uint32_t)data[3] << 8)) ^ 0x8000U) - 0x8000U;
+   signals->DCBusCurrentA = (int16_t)(int32_t)rawDCBusCurrentA;
+}
+
+// signal: @DCBusVoltageV  Factor= 0.01  Offset= 0.0
+#define BB_DCDCStatusRSP_DCBusVoltageV_MinRaw 0
+#define BB_DCDCStatusRSP_DCBusVoltageV_MaxRaw 65535
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t BB_DCDCStatusRSP_DCBusVoltageV_toS(const float value)
+{
+   float raw = value * 100.0f;
+   if (raw < (float)BB_DCDCStatusRSP_DCBusVoltageV_MinRaw)
+   {
+      raw = (float)BB_DCDCStatusRSP_DCBusVoltageV_MinRaw;
+   }
+   else if (raw > (float)BB_DCDCStatusRSP_DCBusVoltageV_MaxRaw)
+   {
+      raw = (float)BB_DCDCStatusRSP_DCBusVoltageV_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t BB_DCDCStatusRSP_DCBusVoltageV_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   raw = (raw >= 0) ? ((raw + 5) / 10) : ((raw - 5) / 10);
+   if (raw < BB_DCDCStatusRSP_DCBusVoltageV_MinRaw)
+   {
+      raw = BB_DCDCStatusRSP_DCBusVoltageV_MinRaw;
+   }
+   else if (raw > BB_DCDCStatusRSP_DCBusVoltageV_MaxRaw)
+   {
+      raw = BB_DCDCStatusRSP_DCBusVoltageV_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float BB_DCDCStatusRSP_DCBusVoltageV_fromS(const int32_t raw)
+{
+   return((float)raw * 0.01f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t BB_DCDCStatusRSP_DCBusVoltageV_fromS_Milli(const int32_t raw)
+{
+   return(raw * 10);
+}
+
+// signal: @DCBusCurrentA  Factor= 0.005  Offset= 0.0
+#define BB_DCDCStatusRSP_DCBusCurrentA_MinRaw (-32768)
+#define BB_DCDCStatusRSP_DCBusCurrentA_MaxRaw 32767
+
+// conversion value to CAN signal, clamped to the signal range
+static inline int16_t BB_DCDCStatusRSP_DCBusCurrentA_toS(const float value)
+{
+   float raw = value * 200.0f;
+   if (raw < (float)BB_DCDCStatusRSP_DCBusCurrentA_MinRaw)
+   {
+      raw = (float)BB_DCDCStatusRSP_DCBusCurrentA_MinRaw;
+   }
+   else if (raw > (float)BB_DCDCStatusRSP_DCBusCurrentA_MaxRaw)
+   {
+      raw = (float)BB_DCDCStatusRSP_DCBusCurrentA_MaxRaw;
+   }
+   return((int16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline int16_t BB_DCDCStatusRSP_DCBusCurrentA_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   raw = (raw >= 0) ? ((raw + 2) / 5) : ((raw - 2) / 5);
+   if (raw < BB_DCDCStatusRSP_DCBusCurrentA_MinRaw)
+   {
+      raw = BB_DCDCStatusRSP_DCBusCurrentA_MinRaw;
+   }
+   else if (raw > BB_DCDCStatusRSP_DCBusCurrentA_MaxRaw)
+   {
+      raw = BB_DCDCStatusRSP_DCBusCurrentA_MaxRaw;
+   }
+   return((int16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float BB_DCDCStatusRSP_DCBusCurrentA_fromS(const int32_t raw)
+{
+   return((float)raw * 0.005f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t BB_DCDCStatusRSP_DCBusCurrentA_fromS_Milli(const int32_t raw)
+{
+   return(raw * 5);
+}
+
+// BB_CellVoltage1to4RSP CAN Message (0x1B003U)
+
+// The raw range of every signal must fit in its structure field
+REPORTMGR_CAN_STATIC_ASSERT(BB_CellVoltage1to4RSP_Cell1V_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_CellVoltage1to4RSP_t, Cell1V, 16U));
+REPORTMGR_CAN_STATIC_ASSERT(BB_CellVoltage1to4RSP_Cell2V_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_CellVoltage1to4RSP_t, Cell2V, 16U));
+REPORTMGR_CAN_STATIC_ASSERT(BB_CellVoltage1to4RSP_Cell3V_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_CellVoltage1to4RSP_t, Cell3V, 16U));
+REPORTMGR_CAN_STATIC_ASSERT(BB_CellVoltage1to4RSP_Cell4V_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_CellVoltage1to4RSP_t, Cell4V, 16U));
+
+// pack the signals into the CAN frame data, every byte of the frame is written
+static inline void BB_CellVoltage1to4RSP_Pack(uint8_t *const data, const BB_CellVoltage1to4RSP_t *const signals)
+{
+   const uint32_t rawCell1V = (uint32_t)signals->Cell1V;
+   const uint32_t rawCell2V = (uint32_t)signals->Cell2V;
+   const uint32_t rawCell3V = (uint32_t)signals->Cell3V;
+   const uint32_t rawCell4V = (uint32_t)signals->Cell4V;
+
+   data[0] = (uint8_t)rawCell1V;
+   data[1] = (uint8_t)(rawCell1V >> 8);
+   data[2] = (uint8_t)rawCell2V;
+   data[3] = (uint8_t)(rawCell2V >> 8);
+   data[4] = (uint8_t)rawCell3V;
+   data[5] = (uint8_t)(rawCell3V >> 8);
+   data[6] = (uint8_t)rawCell4V;
+   data[7] = (uint8_t)(rawCell4V >> 8);
+}
+
+// unpack the signals from the CAN frame data
+static inline void BB_CellVoltage1to4RSP_Unpack(BB_CellVoltage1to4RSP_t *const signals, const uint8_t *const data)
+{
+   // Cell1V : 0|16@1+
+   const uint32_t rawCell1V = (uint32_t)data[0] | ((uint32_t)data[1] << 8);
+   signals->Cell1V = (uint16_t)rawCell1V;
+
+   // Cell2V : 16|16@1+
+   const uint32_t rawCell2V = (uint32_t)data[2] | ((uint32_t)data[3] << 8);
+   signals->Cell2V = (uint16_t)rawCell2V;
+
+   // Cell3V : 32|16@1+
+   const uint32_t rawCell3V = (uint32_t)data[4] | ((uint32_t)data[5] << 8);
+   signals->Cell3V = (uint16_t)rawCell3V;
+
+   // Cell4V : 48|16@1+
+   const uint32_t rawCell4V = (uint32_t)data[6] | ((uint32_t)data[7] << 8);
+   signals->Cell4V = (uint16_t)rawCell4V;
+}
+
+// signal: @Cell1V  Factor= 0.001  Offset= 0.0
+#define BB_CellVoltage1to4RSP_Cell1V_MinRaw 0
+#define BB_CellVoltage1to4RSP_Cell1V_MaxRaw 65535
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t BB_CellVoltage1to4RSP_Cell1V_toS(const float value)
+{
+   float raw = value * 1000.0f;
+   if (raw < (float)BB_CellVoltage1to4RSP_Cell1V_MinRaw)
+   {
+      raw = (float)BB_CellVoltage1to4RSP_Cell1V_MinRaw;
+   }
+   else if (raw > (float)BB_CellVoltage1to4RSP_Cell1V_MaxRaw)
+   {
+      raw = (float)BB_CellVoltage1to4RSP_Cell1V_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t BB_CellVoltage1to4RSP_Cell1V_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   if (raw < BB_CellVoltage1to4RSP_Cell1V_MinRaw)
+   {
+      raw = BB_CellVoltage1to4RSP_Cell1V_MinRaw;
+   }
+   else if (raw > BB_CellVoltage1to4RSP_Cell1V_MaxRaw)
+   {
+      raw = BB_CellVoltage1to4RSP_Cell1V_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float BB_CellVoltage1to4RSP_Cell1V_fromS(const int32_t raw)
+{
+   return((float)raw * 0.001f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t BB_CellVoltage1to4RSP_Cell1V_fromS_Milli(const int32_t raw)
+{
+   return(raw);
+}
+
+// signal: @Cell2V  Factor= 0.001  Offset= 0.0
+#define BB_CellVoltage1to4RSP_Cell2V_MinRaw 0
+#define BB_CellVoltage1to4RSP_Cell2V_MaxRaw 65535
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t BB_CellVoltage1to4RSP_Cell2V_toS(const float value)
+{
+   float raw = value * 1000.0f;
+   if (raw < (float)BB_CellVoltage1to4RSP_Cell2V_MinRaw)
+   {
+      raw = (float)BB_CellVoltage1to4RSP_Cell2V_MinRaw;
+   }
+   else if (raw > (float)BB_CellVoltage1to4RSP_Cell2V_MaxRaw)
+   {
+      raw = (float)BB_CellVoltage1to4RSP_Cell2V_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t BB_CellVoltage1to4RSP_Cell2V_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   if (raw < BB_CellVoltage1to4RSP_Cell2V_MinRaw)
+   {
+      raw = BB_CellVoltage1to4RSP_Cell2V_MinRaw;
+   }
+   else if (raw > BB_CellVoltage1to4RSP_Cell2V_MaxRaw)
+   {
+      raw = BB_CellVoltage1to4RSP_Cell2V_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float BB_CellVoltage1to4RSP_Cell2V_fromS(const int32_t raw)
+{
+   return((float)raw * 0.001f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t BB_CellVoltage1to4RSP_Cell2V_fromS_Milli(const int32_t raw)
+{
+   return(raw);
+}
+
+// signal: @Cell3V  Factor= 0.001  Offset= 0.0
+#define BB_CellVoltage1to4RSP_Cell3V_MinRaw 0
+#define BB_CellVoltage1to4RSP_Cell3V_MaxRaw 65535
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t BB_CellVoltage1to4RSP_Cell3V_toS(const float value)
+{
+   float raw = value * 1000.0f;
+   if (raw < (float)BB_CellVoltage1to4RSP_Cell3V_MinRaw)
+   {
+      raw = (float)BB_CellVoltage1to4RSP_Cell3V_MinRaw;
+   }
+   else if (raw > (float)BB_CellVoltage1to4RSP_Cell3V_MaxRaw)
+   {
+      raw = (float)BB_CellVoltage1to4RSP_Cell3V_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t BB_CellVoltage1to4RSP_Cell3V_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   if (raw < BB_CellVoltage1to4RSP_Cell3V_MinRaw)
+   {
+      raw = BB_CellVoltage1to4RSP_Cell3V_MinRaw;
+   }
+   else if (raw > BB_CellVoltage1to4RSP_Cell3V_MaxRaw)
+   {
+      raw = BB_CellVoltage1to4RSP_Cell3V_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float BB_CellVoltage1to4RSP_Cell3V_fromS(const int32_t raw)
+{
+   return((float)raw * 0.001f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t BB_CellVoltage1to4RSP_Cell3V_fromS_Milli(const int32_t raw)
+{
+   return(raw);
+}
+
+// signal: @Cell4V  Factor= 0.001  Offset= 0.0
+#define BB_CellVoltage1to4RSP_Cell4V_MinRaw 0
+#define BB_CellVoltage1to4RSP_Cell4V_MaxRaw 65535
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t BB_CellVoltage1to4RSP_Cell4V_toS(const float value)
+{
+   float raw = value * 1000.0f;
+   if (raw < (float)BB_CellVoltage1to4RSP_Cell4V_MinRaw)
+   {
+      raw = (float)BB_CellVoltage1to4RSP_Cell4V_MinRaw;
+   }
+   else if (raw > (float)BB_CellVoltage1to4RSP_Cell4V_MaxRaw)
+   {
+      raw = (float)BB_CellVoltage1to4RSP_Cell4V_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t BB_CellVoltage1to4RSP_Cell4V_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   if (raw < BB_CellVoltage1to4RSP_Cell4V_MinRaw)
+   {
+      raw = BB_CellVoltage1to4RSP_Cell4V_MinRaw;
+   }
+   else if (raw > BB_CellVoltage1to4RSP_Cell4V_MaxRaw)
+   {
+      raw = BB_CellVoltage1to4RSP_Cell4V_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float BB_CellVoltage1to4RSP_Cell4V_fromS(const int32_t raw)
+{
+   return((float)raw * 0.001f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t BB_CellVoltage1to4RSP_Cell4V_fromS_Milli(const int32_t raw)
+{
+   return(raw);
+}
+
+// BB_CellVoltage5to8RSP CAN Message (0x1B004U)
+
+// The raw range of every signal must fit in its structure field
+REPORTMGR_CAN_STATIC_ASSERT(BB_CellVoltage5to8RSP_Cell5V_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_CellVoltage5to8RSP_t, Cell5V, 16U));
+REPORTMGR_CAN_STATIC_ASSERT(BB_CellVoltage5to8RSP_Cell6V_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_CellVoltage5to8RSP_t, Cell6V, 16U));
+REPORTMGR_CAN_STATIC_ASSERT(BB_CellVoltage5to8RSP_Cell7V_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_CellVoltage5to8RSP_t, Cell7V, 16U));
+REPORTMGR_CAN_STATIC_ASSERT(BB_CellVoltage5to8RSP_Cell8V_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_CellVoltage5to8RSP_t, Cell8V, 16U));
+
+// pack the signals into the CAN frame data, every byte of the frame is written
+static inline void BB_CellVoltage5to8RSP_Pack(uint8_t *const data, const BB_CellVoltage5to8RSP_t *const signals)
+{
+   const uint32_t rawCell5V = (uint32_t)signals->Cell5V;
+   const uint32_t rawCell6V = (uint32_t)signals->Cell6V;
+   const uint32_t rawCell7V = (uint32_t)signals->Cell7V;
+   const uint32_t rawCell8V = (uint32_t)signals->Cell8V;
+
+   data[0] = (uint8_t)rawCell5V;
+   data[1] = (uint8_t)(rawCell5V >> 8);
+   data[2] = (uint8_t)rawCell6V;
+   data[3] = (uint8_t)(rawCell6V >> 8);
+   data[4] = (uint8_t)rawCell7V;
+   data[5] = (uint8_t)(rawCell7V >> 8);
+   data[6] = (uint8_t)rawCell8V;
+   data[7] = (uint8_t)(rawCell8V >> 8);
+}
+
+// unpack the signals from the CAN frame data
+static inline void BB_CellVoltage5to8RSP_Unpack(BB_CellVoltage5to8RSP_t *const signals, const uint8_t *const data)
+{
+   // Cell5V : 0|16@1+
+   const uint32_t rawCell5V = (uint32_t)data[0] | ((uint32_t)data[1] << 8);
+   signals->Cell5V = (uint16_t)rawCell5V;
+
+   // Cell6V : 16|16@1+
+   const uint32_t rawCell6V = (uint32_t)data[2] | ((uint32_t)data[3] << 8);
+   signals->Cell6V = (uint16_t)rawCell6V;
+
+   // Cell7V : 32|16@1+
+   const uint32_t rawCell7V = (uint32_t)data[4] | ((uint32_t)data[5] << 8);
+   signals->Cell7V = (uint16_t)rawCell7V;
+
+   // Cell8V : 48|16@1+
+   const uint32_t rawCell8V = (uint32_t)data[6] | ((uint32_t)data[7] << 8);
+   signals->Cell8V = (uint16_t)rawCell8V;
+}
+
+// signal: @Cell5V  Factor= 0.001  Offset= 0.0
+#define BB_CellVoltage5to8RSP_Cell5V_MinRaw 0
+#define BB_CellVoltage5to8RSP_Cell5V_MaxRaw 65535
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t BB_CellVoltage5to8RSP_Cell5V_toS(const float value)
+{
+   float raw = value * 1000.0f;
+   if (raw < (float)BB_CellVoltage5to8RSP_Cell5V_MinRaw)
+   {
+      raw = (float)BB_CellVoltage5to8RSP_Cell5V_MinRaw;
+   }
+   else if (raw > (float)BB_CellVoltage5to8RSP_Cell5V_MaxRaw)
+   {
+      raw = (float)BB_CellVoltage5to8RSP_Cell5V_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t BB_CellVoltage5to8RSP_Cell5V_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   if (raw < BB_CellVoltage5to8RSP_Cell5V_MinRaw)
+   {
+      raw = BB_CellVoltage5to8RSP_Cell5V_MinRaw;
+   }
+   else if (raw > BB_CellVoltage5to8RSP_Cell5V_MaxRaw)
+   {
+      raw = BB_CellVoltage5to8RSP_Cell5V_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float BB_CellVoltage5to8RSP_Cell5V_fromS(const int32_t raw)
+{
+   return((float)raw * 0.001f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t BB_CellVoltage5to8RSP_Cell5V_fromS_Milli(const int32_t raw)
+{
+   return(raw);
+}
+
+// signal: @Cell6V  Factor= 0.001  Offset= 0.0
+#define BB_CellVoltage5to8RSP_Cell6V_MinRaw 0
+#define BB_CellVoltage5to8RSP_Cell6V_MaxRaw 65535
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t BB_CellVoltage5to8RSP_Cell6V_toS(const float value)
+{
+   float raw = value * 1000.0f;
+   if (raw < (float)BB_CellVoltage5to8RSP_Cell6V_MinRaw)
+   {
+      raw = (float)BB_CellVoltage5to8RSP_Cell6V_MinRaw;
+   }
+   else if (raw > (float)BB_CellVoltage5to8RSP_Cell6V_MaxRaw)
+   {
+      raw = (float)BB_CellVoltage5to8RSP_Cell6V_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t BB_CellVoltage5to8RSP_Cell6V_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   if (raw < BB_CellVoltage5to8RSP_Cell6V_MinRaw)
+   {
+      raw = BB_CellVoltage5to8RSP_Cell6V_MinRaw;
+   }
+   else if (raw > BB_CellVoltage5to8RSP_Cell6V_MaxRaw)
+   {
+      raw = BB_CellVoltage5to8RSP_Cell6V_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float BB_CellVoltage5to8RSP_Cell6V_fromS(const int32_t raw)
+{
+   return((float)raw * 0.001f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t BB_CellVoltage5to8RSP_Cell6V_fromS_Milli(const int32_t raw)
+{
+   return(raw);
+}
+
+// signal: @Cell7V  Factor= 0.001  Offset= 0.0
+#define BB_CellVoltage5to8RSP_Cell7V_MinRaw 0
+#define BB_CellVoltage5to8RSP_Cell7V_MaxRaw 65535
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t BB_CellVoltage5to8RSP_Cell7V_toS(const float value)
+{
+   float raw = value * 1000.0f;
+   if (raw < (float)BB_CellVoltage5to8RSP_Cell7V_MinRaw)
+   {
+      raw = (float)BB_CellVoltage5to8RSP_Cell7V_MinRaw;
+   }
+   else if (raw > (float)BB_CellVoltage5to8RSP_Cell7V_MaxRaw)
+   {
+      raw = (float)BB_CellVoltage5to8RSP_Cell7V_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t BB_CellVoltage5to8RSP_Cell7V_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   if (raw < BB_CellVoltage5to8RSP_Cell7V_MinRaw)
+   {
+      raw = BB_CellVoltage5to8RSP_Cell7V_MinRaw;
+   }
+   else if (raw > BB_CellVoltage5to8RSP_Cell7V_MaxRaw)
+   {
+      raw = BB_CellVoltage5to8RSP_Cell7V_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float BB_CellVoltage5to8RSP_Cell7V_fromS(const int32_t raw)
+{
+   return((float)raw * 0.001f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t BB_CellVoltage5to8RSP_Cell7V_fromS_Milli(const int32_t raw)
+{
+   return(raw);
+}
+
+// signal: @Cell8V  Factor= 0.001  Offset= 0.0
+#define BB_CellVoltage5to8RSP_Cell8V_MinRaw 0
+#define BB_CellVoltage5to8RSP_Cell8V_MaxRaw 65535
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t BB_CellVoltage5to8RSP_Cell8V_toS(const float value)
+{
+   float raw = value * 1000.0f;
+   if (raw < (float)BB_CellVoltage5to8RSP_Cell8V_MinRaw)
+   {
+      raw = (float)BB_CellVoltage5to8RSP_Cell8V_MinRaw;
+   }
+   else if (raw > (float)BB_CellVoltage5to8RSP_Cell8V_MaxRaw)
+   {
+      raw = (float)BB_CellVoltage5to8RSP_Cell8V_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t BB_CellVoltage5to8RSP_Cell8V_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   if (raw < BB_CellVoltage5to8RSP_Cell8V_MinRaw)
+   {
+      raw = BB_CellVoltage5to8RSP_Cell8V_MinRaw;
+   }
+   else if (raw > BB_CellVoltage5to8RSP_Cell8V_MaxRaw)
+   {
+      raw = BB_CellVoltage5to8RSP_Cell8V_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float BB_CellVoltage5to8RSP_Cell8V_fromS(const int32_t raw)
+{
+   return((float)raw * 0.001f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t BB_CellVoltage5to8RSP_Cell8V_fromS_Milli(const int32_t raw)
+{
+   return(raw);
+}
+
+// BB_CellVoltage9to12RSP CAN Message (0x1B005U)
+
+// The raw range of every signal must fit in its structure field
+REPORTMGR_CAN_STATIC_ASSERT(BB_CellVoltage9to12RSP_Cell9V_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_CellVoltage9to12RSP_t, Cell9V, 16U));
+REPORTMGR_CAN_STATIC_ASSERT(BB_CellVoltage9to12RSP_Cell10V_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_CellVoltage9to12RSP_t, Cell10V, 16U));
+REPORTMGR_CAN_STATIC_ASSERT(BB_CellVoltage9to12RSP_Cell11V_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_CellVoltage9to12RSP_t, Cell11V, 16U));
+REPORTMGR_CAN_STATIC_ASSERT(BB_CellVoltage9to12RSP_Cell12V_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_CellVoltage9to12RSP_t, Cell12V, 16U));
+
+// pack the signals into the CAN frame data, every byte of the frame is written
+static inline void BB_CellVoltage9to12RSP_Pack(uint8_t *const data, const BB_CellVoltage9to12RSP_t *const signals)
+{
+   const uint32_t rawCell9V = (uint32_t)signals->Cell9V;
+   const uint32_t rawCell10V = (uint32_t)signals->Cell10V;
+   const uint32_t rawCell11V = (uint32_t)signals->Cell11V;
+   const uint32_t rawCell12V = (uint32_t)signals->Cell12V;
+
+   data[0] = (uint8_t)rawCell9V;
+   data[1] = (uint8_t)(rawCell9V >> 8);
+   data[2] = (uint8_t)rawCell10V;
+   data[3] = (uint8_t)(rawCell10V >> 8);
+   data[4] = (uint8_t)rawCell11V;
+   data[5] = (uint8_t)(rawCell11V >> 8);
+   data[6] = (uint8_t)rawCell12V;
+   data[7] = (uint8_t)(rawCell12V >> 8);
+}
+
+// unpack the signals from the CAN frame data
+static inline void BB_CellVoltage9to12RSP_Unpack(BB_CellVoltage9to12RSP_t *const signals, const uint8_t *const data)
+{
+   // Cell9V : 0|16@1+
+   const uint32_t rawCell9V = (uint32_t)data[0] | ((uint32_t)data[1] << 8);
+   signals->Cell9V = (uint16_t)rawCell9V;
+
+   // Cell10V : 16|16@1+
+   const uint32_t rawCell10V = (uint32_t)data[2] | ((uint32_t)data[3] << 8);
+   signals->Cell10V = (uint16_t)rawCell10V;
+
+   // Cell11V : 32|16@1+
+   const uint32_t rawCell11V = (uint32_t)data[4] | ((uint32_t)data[5] << 8);
+   signals->Cell11V = (uint16_t)rawCell11V;
+
+   // Cell12V : 48|16@1+
+   const uint32_t rawCell12V = (uint32_t)data[6] | ((uint32_t)data[7] << 8);
+   signals->Cell12V = (uint16_t)rawCell12V;
+}
+
+// signal: @Cell9V  Factor= 0.001  Offset= 0.0
+#define BB_CellVoltage9to12RSP_Cell9V_MinRaw 0
+#define BB_CellVoltage9to12RSP_Cell9V_MaxRaw 65535
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t BB_CellVoltage9to12RSP_Cell9V_toS(const float value)
+{
+   float raw = value * 1000.0f;
+   if (raw < (float)BB_CellVoltage9to12RSP_Cell9V_MinRaw)
+   {
+      raw = (float)BB_CellVoltage9to12RSP_Cell9V_MinRaw;
+   }
+   else if (raw > (float)BB_CellVoltage9to12RSP_Cell9V_MaxRaw)
+   {
+      raw = (float)BB_CellVoltage9to12RSP_Cell9V_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t BB_CellVoltage9to12RSP_Cell9V_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   if (raw < BB_CellVoltage9to12RSP_Cell9V_MinRaw)
+   {
+      raw = BB_CellVoltage9to12RSP_Cell9V_MinRaw;
+   }
+   else if (raw > BB_CellVoltage9to12RSP_Cell9V_MaxRaw)
+   {
+      raw = BB_CellVoltage9to12RSP_Cell9V_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float BB_CellVoltage9to12RSP_Cell9V_fromS(const int32_t raw)
+{
+   return((float)raw * 0.001f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t BB_CellVoltage9to12RSP_Cell9V_fromS_Milli(const int32_t raw)
+{
+   return(raw);
+}
+
+// signal: @Cell10V  Factor= 0.001  Offset= 0.0
+#define BB_CellVoltage9to12RSP_Cell10V_MinRaw 0
+#define BB_CellVoltage9to12RSP_Cell10V_MaxRaw 65535
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t BB_CellVoltage9to12RSP_Cell10V_toS(const float value)
+{
+   float raw = value * 1000.0f;
+   if (raw < (float)BB_CellVoltage9to12RSP_Cell10V_MinRaw)
+   {
+      raw = (float)BB_CellVoltage9to12RSP_Cell10V_MinRaw;
+   }
+   else if (raw > (float)BB_CellVoltage9to12RSP_Cell10V_MaxRaw)
+   {
+      raw = (float)BB_CellVoltage9to12RSP_Cell10V_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t BB_CellVoltage9to12RSP_Cell10V_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   if (raw < BB_CellVoltage9to12RSP_Cell10V_MinRaw)
+   {
+      raw = BB_CellVoltage9to12RSP_Cell10V_MinRaw;
+   }
+   else if (raw > BB_CellVoltage9to12RSP_Cell10V_MaxRaw)
+   {
+      raw = BB_CellVoltage9to12RSP_Cell10V_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float BB_CellVoltage9to12RSP_Cell10V_fromS(const int32_t raw)
+{
+   return((float)raw * 0.001f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t BB_CellVoltage9to12RSP_Cell10V_fromS_Milli(const int32_t raw)
+{
+   return(raw);
+}
+
+// signal: @Cell11V  Factor= 0.001  Offset= 0.0
+#define BB_CellVoltage9to12RSP_Cell11V_MinRaw 0
+#define BB_CellVoltage9to12RSP_Cell11V_MaxRaw 65535
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t BB_CellVoltage9to12RSP_Cell11V_toS(const float value)
+{
+   float raw = value * 1000.0f;
+   if (raw < (float)BB_CellVoltage9to12RSP_Cell11V_MinRaw)
+   {
+      raw = (float)BB_CellVoltage9to12RSP_Cell11V_MinRaw;
+   }
+   else if (raw > (float)BB_CellVoltage9to12RSP_Cell11V_MaxRaw)
+   {
+      raw = (float)BB_CellVoltage9to12RSP_Cell11V_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t BB_CellVoltage9to12RSP_Cell11V_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   if (raw < BB_CellVoltage9to12RSP_Cell11V_MinRaw)
+   {
+      raw = BB_CellVoltage9to12RSP_Cell11V_MinRaw;
+   }
+   else if (raw > BB_CellVoltage9to12RSP_Cell11V_MaxRaw)
+   {
+      raw = BB_CellVoltage9to12RSP_Cell11V_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float BB_CellVoltage9to12RSP_Cell11V_fromS(const int32_t raw)
+{
+   return((float)raw * 0.001f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t BB_CellVoltage9to12RSP_Cell11V_fromS_Milli(const int32_t raw)
+{
+   return(raw);
+}
+
+// signal: @Cell12V  Factor= 0.001  Offset= 0.0
+#define BB_CellVoltage9to12RSP_Cell12V_MinRaw 0
+#define BB_CellVoltage9to12RSP_Cell12V_MaxRaw 65535
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t BB_CellVoltage9to12RSP_Cell12V_toS(const float value)
+{
+   float raw = value * 1000.0f;
+   if (raw < (float)BB_CellVoltage9to12RSP_Cell12V_MinRaw)
+   {
+      raw = (float)BB_CellVoltage9to12RSP_Cell12V_MinRaw;
+   }
+   else if (raw > (float)BB_CellVoltage9to12RSP_Cell12V_MaxRaw)
+   {
+      raw = (float)BB_CellVoltage9to12RSP_Cell12V_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t BB_CellVoltage9to12RSP_Cell12V_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   if (raw < BB_CellVoltage9to12RSP_Cell12V_MinRaw)
+   {
+      raw = BB_CellVoltage9to12RSP_Cell12V_MinRaw;
+   }
+   else if (raw > BB_CellVoltage9to12RSP_Cell12V_MaxRaw)
+   {
+      raw = BB_CellVoltage9to12RSP_Cell12V_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float BB_CellVoltage9to12RSP_Cell12V_fromS(const int32_t raw)
+{
+   return((float)raw * 0.001f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t BB_CellVoltage9to12RSP_Cell12V_fromS_Milli(const int32_t raw)
+{
+   return(raw);
+}
+
+// BB_CellTempRSP CAN Message (0x1B006U)
+
+// The raw range of every signal must fit in its structure field
+REPORTMGR_CAN_STATIC_ASSERT(BB_CellTempRSP_Submodule1C_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_CellTempRSP_t, Submodule1C, 8U));
+REPORTMGR_CAN_STATIC_ASSERT(BB_CellTempRSP_Submodule2C_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_CellTempRSP_t, Submodule2C, 8U));
+REPORTMGR_CAN_STATIC_ASSERT(BB_CellTempRSP_Submodule3C_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_CellTempRSP_t, Submodule3C, 8U));
+REPORTMGR_CAN_STATIC_ASSERT(BB_CellTempRSP_Submodule4C_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_CellTempRSP_t, Submodule4C, 8U));
+REPORTMGR_CAN_STATIC_ASSERT(BB_CellTempRSP_Submodule5C_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_CellTempRSP_t, Submodule5C, 8U));
+REPORTMGR_CAN_STATIC_ASSERT(BB_CellTempRSP_Submodule6C_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_CellTempRSP_t, Submodule6C, 8U));
+
+// pack the signals into the CAN frame data, every byte of the frame is written
+static inline void BB_CellTempRSP_Pack(uint8_t *const data, const BB_CellTempRSP_t *const signals)
+{
+   const uint32_t rawSubmodule1C = (uint32_t)signals->Submodule1C;
+   const uint32_t rawSubmodule2C = (uint32_t)signals->Submodule2C;
+   const uint32_t rawSubmodule3C = (uint32_t)signals->Submodule3C;
+   const uint32_t rawSubmodule4C = (uint32_t)signals->Submodule4C;
+   const uint32_t rawSubmodule5C = (uint32_t)signals->Submodule5C;
+   const uint32_t rawSubmodule6C = (uint32_t)signals->Submodule6C;
+
+   data[0] = (uint8_t)rawSubmodule1C;
+   data[1] = (uint8_t)rawSubmodule2C;
+   data[2] = (uint8_t)rawSubmodule3C;
+   data[3] = (uint8_t)rawSubmodule4C;
+   data[4] = (uint8_t)rawSubmodule5C;
+   data[5] = (uint8_t)rawSubmodule6C;
+}
+
+// unpack the signals from the CAN frame data
+static inline void BB_CellTempRSP_Unpack(BB_CellTempRSP_t *const signals, const uint8_t *const data)
+{
+   // Submodule1C : 0|8@1+
+   const uint32_t rawSubmodule1C = (uint32_t)data[0];
+   signals->Submodule1C = (uint8_t)rawSubmodule1C;
+
+   // Submodule2C : 8|8@1+
+   const uint32_t rawSubmodule2C = (uint32_t)data[1];
+   signals->Submodule2C = (uint8_t)rawSubmodule2C;
+
+   // Submodule3C : 16|8@1+
+   const uint32_t rawSubmodule3C = (uint32_t)data[2];
+   signals->Submodule3C = (uint8_t)rawSubmodule3C;
+
+   // Submodule4C : 24|8@1+
+   const uint32_t rawSubmodule4C = (uint32_t)data[3];
+   signals->Submodule4C = (uint8_t)rawSubmodule4C;
+
+   // Submodule5C : 32|8@1+
+   const uint32_t rawSubmodule5C = (uint32_t)data[4];
+   signals->Submodule5C = (uint8_t)rawSubmodule5C;
+
+   // Submodule6C : 40|8@1+
+   const uint32_t rawSubmodule6C = (uint32_t)data[5];
+   signals->Submodule6C = (uint8_t)rawSubmodule6C;
+}
+
+// signal: @Submodule1C  Factor= 0.5  Offset= -40.0
+#define BB_CellTempRSP_Submodule1C_MinRaw 0
+#define BB_CellTempRSP_Submodule1C_MaxRaw 255
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint8_t BB_CellTempRSP_Submodule1C_toS(const float value)
+{
+   float raw = (value + 40.0f) * 2.0f;
+   if (raw < (float)BB_CellTempRSP_Submodule1C_MinRaw)
+   {
+      raw = (float)BB_CellTempRSP_Submodule1C_MinRaw;
+   }
+   else if (raw > (float)BB_CellTempRSP_Submodule1C_MaxRaw)
+   {
+      raw = (float)BB_CellTempRSP_Submodule1C_MaxRaw;
+   }
+   return((uint8_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint8_t BB_CellTempRSP_Submodule1C_toS_Milli(const int32_t value)
+{
+   int32_t raw = value + 40000;
+   raw = (raw >= 0) ? ((raw + 250) / 500) : ((raw - 250) / 500);
+   if (raw < BB_CellTempRSP_Submodule1C_MinRaw)
+   {
+      raw = BB_CellTempRSP_Submodule1C_MinRaw;
+   }
+   else if (raw > BB_CellTempRSP_Submodule1C_MaxRaw)
+   {
+      raw = BB_CellTempRSP_Submodule1C_MaxRaw;
+   }
+   return((uint8_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float BB_CellTempRSP_Submodule1C_fromS(const int32_t raw)
+{
+   return(((float)raw * 0.5f) - 40.0f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t BB_CellTempRSP_Submodule1C_fromS_Milli(const int32_t raw)
+{
+   return((raw * 500) - 40000);
+}
+
+// signal: @Submodule2C  Factor= 0.5  Offset= -40.0
+#define BB_CellTempRSP_Submodule2C_MinRaw 0
+#define BB_CellTempRSP_Submodule2C_MaxRaw 255
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint8_t BB_CellTempRSP_Submodule2C_toS(const float value)
+{
+   float raw = (value + 40.0f) * 2.0f;
+   if (raw < (float)BB_CellTempRSP_Submodule2C_MinRaw)
+   {
+      raw = (float)BB_CellTempRSP_Submodule2C_MinRaw;
+   }
+   else if (raw > (float)BB_CellTempRSP_Submodule2C_MaxRaw)
+   {
+      raw = (float)BB_CellTempRSP_Submodule2C_MaxRaw;
+   }
+   return((uint8_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint8_t BB_CellTempRSP_Submodule2C_toS_Milli(const int32_t value)
+{
+   int32_t raw = value + 40000;
+   raw = (raw >= 0) ? ((raw + 250) / 500) : ((raw - 250) / 500);
+   if (raw < BB_CellTempRSP_Submodule2C_MinRaw)
+   {
+      raw = BB_CellTempRSP_Submodule2C_MinRaw;
+   }
+   else if (raw > BB_CellTempRSP_Submodule2C_MaxRaw)
+   {
+      raw = BB_CellTempRSP_Submodule2C_MaxRaw;
+   }
+   return((uint8_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float BB_CellTempRSP_Submodule2C_fromS(const int32_t raw)
+{
+   return(((float)raw * 0.5f) - 40.0f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t BB_CellTempRSP_Submodule2C_fromS_Milli(const int32_t raw)
+{
+   return((raw * 500) - 40000);
+}
+
+// signal: @Submodule3C  Factor= 0.5  Offset= -40.0
+#define BB_CellTempRSP_Submodule3C_MinRaw 0
+#define BB_CellTempRSP_Submodule3C_MaxRaw 255
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint8_t BB_CellTempRSP_Submodule3C_toS(const float value)
+{
+   float raw = (value + 40.0f) * 2.0f;
+   if (raw < (float)BB_CellTempRSP_Submodule3C_MinRaw)
+   {
+      raw = (float)BB_CellTempRSP_Submodule3C_MinRaw;
+   }
+   else if (raw > (float)BB_CellTempRSP_Submodule3C_MaxRaw)
+   {
+      raw = (float)BB_CellTempRSP_Submodule3C_MaxRaw;
+   }
+   return((uint8_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint8_t BB_CellTempRSP_Submodule3C_toS_Milli(const int32_t value)
+{
+   int32_t raw = value + 40000;
+   raw = (raw >= 0) ? ((raw + 250) / 500) : ((raw - 250) / 500);
+   if (raw < BB_CellTempRSP_Submodule3C_MinRaw)
+   {
+      raw = BB_CellTempRSP_Submodule3C_MinRaw;
+   }
+   else if (raw > BB_CellTempRSP_Submodule3C_MaxRaw)
+   {
+      raw = BB_CellTempRSP_Submodule3C_MaxRaw;
+   }
+   return((uint8_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float BB_CellTempRSP_Submodule3C_fromS(const int32_t raw)
+{
+   return(((float)raw * 0.5f) - 40.0f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t BB_CellTempRSP_Submodule3C_fromS_Milli(const int32_t raw)
+{
+   return((raw * 500) - 40000);
+}
+
+// signal: @Submodule4C  Factor= 0.5  Offset= -40.0
+#define BB_CellTempRSP_Submodule4C_MinRaw 0
+#define BB_CellTempRSP_Submodule4C_MaxRaw 255
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint8_t BB_CellTempRSP_Submodule4C_toS(const float value)
+{
+   float raw = (value + 40.0f) * 2.0f;
+   if (raw < (float)BB_CellTempRSP_Submodule4C_MinRaw)
+   {
+      raw = (float)BB_CellTempRSP_Submodule4C_MinRaw;
+   }
+   else if (raw > (float)BB_CellTempRSP_Submodule4C_MaxRaw)
+   {
+      raw = (float)BB_CellTempRSP_Submodule4C_MaxRaw;
+   }
+   return((uint8_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint8_t BB_CellTempRSP_Submodule4C_toS_Milli(const int32_t value)
+{
+   int32_t raw = value + 40000;
+   raw = (raw >= 0) ? ((raw + 250) / 500) : ((raw - 250) / 500);
+   if (raw < BB_CellTempRSP_Submodule4C_MinRaw)
+   {
+      raw = BB_CellTempRSP_Submodule4C_MinRaw;
+   }
+   else if (raw > BB_CellTempRSP_Submodule4C_MaxRaw)
+   {
+      raw = BB_CellTempRSP_Submodule4C_MaxRaw;
+   }
+   return((uint8_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float BB_CellTempRSP_Submodule4C_fromS(const int32_t raw)
+{
+   return(((float)raw * 0.5f) - 40.0f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t BB_CellTempRSP_Submodule4C_fromS_Milli(const int32_t raw)
+{
+   return((raw * 500) - 40000);
+}
+
+// signal: @Submodule5C  Factor= 0.5  Offset= -40.0
+#define BB_CellTempRSP_Submodule5C_MinRaw 0
+#define BB_CellTempRSP_Submodule5C_MaxRaw 255
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint8_t BB_CellTempRSP_Submodule5C_toS(const float value)
+{
+   float raw = (value + 40.0f) * 2.0f;
+   if (raw < (float)BB_CellTempRSP_Submodule5C_MinRaw)
+   {
+      raw = (float)BB_CellTempRSP_Submodule5C_MinRaw;
+   }
+   else if (raw > (float)BB_CellTempRSP_Submodule5C_MaxRaw)
+   {
+      raw = (float)BB_CellTempRSP_Submodule5C_MaxRaw;
+   }
+   return((uint8_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint8_t BB_CellTempRSP_Submodule5C_toS_Milli(const int32_t value)
+{
+   int32_t raw = value + 40000;
+   raw = (raw >= 0) ? ((raw + 250) / 500) : ((raw - 250) / 500);
+   if (raw < BB_CellTempRSP_Submodule5C_MinRaw)
+   {
+      raw = BB_CellTempRSP_Submodule5C_MinRaw;
+   }
+   else if (raw > BB_CellTempRSP_Submodule5C_MaxRaw)
+   {
+      raw = BB_CellTempRSP_Submodule5C_MaxRaw;
+   }
+   return((uint8_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float BB_CellTempRSP_Submodule5C_fromS(const int32_t raw)
+{
+   return(((float)raw * 0.5f) - 40.0f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t BB_CellTempRSP_Submodule5C_fromS_Milli(const int32_t raw)
+{
+   return((raw * 500) - 40000);
+}
+
+// signal: @Submodule6C  Factor= 0.5  Offset= -40.0
+#define BB_CellTempRSP_Submodule6C_MinRaw 0
+#define BB_CellTempRSP_Submodule6C_MaxRaw 255
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint8_t BB_CellTempRSP_Submodule6C_toS(const float value)
+{
+   float raw = (value + 40.0f) * 2.0f;
+   if (raw < (float)BB_CellTempRSP_Submodule6C_MinRaw)
+   {
+      raw = (float)BB_CellTempRSP_Submodule6C_MinRaw;
+   }
+   else if (raw > (float)BB_CellTempRSP_Submodule6C_MaxRaw)
+   {
+      raw = (float)BB_CellTempRSP_Submodule6C_MaxRaw;
+   }
+   return((uint8_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint8_t BB_CellTempRSP_Submodule6C_toS_Milli(const int32_t value)
+{
+   int32_t raw = value + 40000;
+   raw = (raw >= 0) ? ((raw + 250) / 500) : ((raw - 250) / 500);
+   if (raw < BB_CellTempRSP_Submodule6C_MinRaw)
+   {
+      raw = BB_CellTempRSP_Submodule6C_MinRaw;
+   }
+   else if (raw > BB_CellTempRSP_Submodule6C_MaxRaw)
+   {
+      raw = BB_CellTempRSP_Submodule6C_MaxRaw;
+   }
+   return((uint8_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float BB_CellTempRSP_Submodule6C_fromS(const int32_t raw)
+{
+   return(((float)raw * 0.5f) - 40.0f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t BB_CellTempRSP_Submodule6C_fromS_Milli(const int32_t raw)
+{
+   return((raw * 500) - 40000);
+}
+
+// BB_DCDCTemperaturesRSP CAN Message (0x1B007U)
+
+// The raw range of every signal must fit in its structure field
+REPORTMGR_CAN_STATIC_ASSERT(BB_DCDCTemperaturesRSP_BBHeatsinkC_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_DCDCTemperaturesRSP_t, BBHeatsinkC, 8U));
+REPORTMGR_CAN_STATIC_ASSERT(BB_DCDCTemperaturesRSP_FanDutyCycle_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_DCDCTemperaturesRSP_t, FanDutyCycle, 10U));
+
+// pack the signals into the CAN frame data, every byte of the frame is written
+static inline void BB_DCDCTemperaturesRSP_Pack(uint8_t *const data, const BB_DCDCTemperaturesRSP_t *const signals)
+{
+   const uint32_t rawBBHeatsinkC = (uint32_t)signals->BBHeatsinkC;
+   const uint32_t rawFanDutyCycle = (uint32_t)signals->FanDutyCycle;
+
+   data[0] = (uint8_t)rawBBHeatsinkC;
+   data[1] = (uint8_t)(rawBBHeatsinkC >> 8);
+   data[2] = (uint8_t)rawFanDutyCycle;
+   data[3] = (uint8_t)(rawFanDutyCycle >> 8);
+}
+
+// unpack the signals from the CAN frame data
+static inline void BB_DCDCTemperaturesRSP_Unpack(BB_DCDCTemperaturesRSP_t *const signals, const uint8_t *const data)
+{
+   // BBHeatsinkC : 0|16@1+
+   const uint32_t rawBBHeatsinkC = (uint32_t)data[0] | ((uint32_t)data[1] << 8);
+   signals->BBHeatsinkC = (uint16_t)rawBBHeatsinkC;
+
+   // FanDutyCycle : 16|16@1+
+   const uint32_t rawFanDutyCycle = (uint32_t)data[2] | ((uint32_t)data[3] << 8);
+   signals->FanDutyCycle = (uint16_t)rawFanDutyCycle;
+}
+
+// signal: @BBHeatsinkC  Factor= 1.0  Offset= -60.0
+#define BB_DCDCTemperaturesRSP_BBHeatsinkC_MinRaw 0
+#define BB_DCDCTemperaturesRSP_BBHeatsinkC_MaxRaw 255
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t BB_DCDCTemperaturesRSP_BBHeatsinkC_toS(const float value)
+{
+   float raw = value + 60.0f;
+   if (raw < (float)BB_DCDCTemperaturesRSP_BBHeatsinkC_MinRaw)
+   {
+      raw = (float)BB_DCDCTemperaturesRSP_BBHeatsinkC_MinRaw;
+   }
+   else if (raw > (float)BB_DCDCTemperaturesRSP_BBHeatsinkC_MaxRaw)
+   {
+      raw = (float)BB_DCDCTemperaturesRSP_BBHeatsinkC_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t BB_DCDCTemperaturesRSP_BBHeatsinkC_toS_Milli(const int32_t value)
+{
+   int32_t raw = value + 60000;
+   raw = (raw >= 0) ? ((raw + 500) / 1000) : ((raw - 500) / 1000);
+   if (raw < BB_DCDCTemperaturesRSP_BBHeatsinkC_MinRaw)
+   {
+      raw = BB_DCDCTemperaturesRSP_BBHeatsinkC_MinRaw;
+   }
+   else if (raw > BB_DCDCTemperaturesRSP_BBHeatsinkC_MaxRaw)
+   {
+      raw = BB_DCDCTemperaturesRSP_BBHeatsinkC_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float BB_DCDCTemperaturesRSP_BBHeatsinkC_fromS(const int32_t raw)
+{
+   return(((float)raw) - 60.0f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t BB_DCDCTemperaturesRSP_BBHeatsinkC_fromS_Milli(const int32_t raw)
+{
+   return((raw * 1000) - 60000);
+}
+
+// signal: @FanDutyCycle  Factor= 0.1  Offset= 0.0
+#define BB_DCDCTemperaturesRSP_FanDutyCycle_MinRaw 0
+#define BB_DCDCTemperaturesRSP_FanDutyCycle_MaxRaw 1023
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t BB_DCDCTemperaturesRSP_FanDutyCycle_toS(const float value)
+{
+   float raw = value * 10.0f;
+   if (raw < (float)BB_DCDCTemperaturesRSP_FanDutyCycle_MinRaw)
+   {
+      raw = (float)BB_DCDCTemperaturesRSP_FanDutyCycle_MinRaw;
+   }
+   else if (raw > (float)BB_DCDCTemperaturesRSP_FanDutyCycle_MaxRaw)
+   {
+      raw = (float)BB_DCDCTemperaturesRSP_FanDutyCycle_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t BB_DCDCTemperaturesRSP_FanDutyCycle_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   raw = (raw >= 0) ? ((raw + 50) / 100) : ((raw - 50) / 100);
+   if (raw < BB_DCDCTemperaturesRSP_FanDutyCycle_MinRaw)
+   {
+      raw = BB_DCDCTemperaturesRSP_FanDutyCycle_MinRaw;
+   }
+   else if (raw > BB_DCDCTemperaturesRSP_FanDutyCycle_MaxRaw)
+   {
+      raw = BB_DCDCTemperaturesRSP_FanDutyCycle_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float BB_DCDCTemperaturesRSP_FanDutyCycle_fromS(const int32_t raw)
+{
+   return((float)raw * 0.1f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t BB_DCDCTemperaturesRSP_FanDutyCycle_fromS_Milli(const int32_t raw)
+{
+   return(raw * 100);
+}
+
+// INV_L2NStatusRSP CAN Message (0x1A001U)
+
+// The raw range of every signal must fit in its structure field
+REPORTMGR_CAN_STATIC_ASSERT(INV_L2NStatusRSP_L1NVoltageVrms_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_L2NStatusRSP_t, L1NVoltageVrms, 16U));
+REPORTMGR_CAN_STATIC_ASSERT(INV_L2NStatusRSP_L2NVoltageVrms_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_L2NStatusRSP_t, L2NVoltageVrms, 16U));
+REPORTMGR_CAN_STATIC_ASSERT(INV_L2NStatusRSP_L1NCurrentArms_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_L2NStatusRSP_t, L1NCurrentArms, 16U));
+REPORTMGR_CAN_STATIC_ASSERT(INV_L2NStatusRSP_L2NCurrentArms_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_L2NStatusRSP_t, L2NCurrentArms, 16U));
+
+// pack the signals into the CAN frame data, every byte of the frame is written
+static inline void INV_L2NStatusRSP_Pack(uint8_t *const data, const INV_L2NStatusRSP_t *const signals)
+{
+   const uint32_t rawL1NVoltageVrms = (uint32_t)signals->L1NVoltageVrms;
+   const uint32_t rawL2NVoltageVrms = (uint32_t)signals->L2NVoltageVrms;
+   const uint32_t rawL1NCurrentArms = (uint32_t)signals->L1NCurrentArms;
+   const uint32_t rawL2NCurrentArms = (uint32_t)signals->L2NCurrentArms;
+
+   data[0] = (uint8_t)rawL1NVoltageVrms;
+   data[1] = (uint8_t)(rawL1NVoltageVrms >> 8);
+   data[2] = (uint8_t)rawL2NVoltageVrms;
+   data[3] = (uint8_t)(rawL2NVoltageVrms >> 8);
+   data[4] = (uint8_t)rawL1NCurrentArms;
+   data[5] = (uint8_t)(rawL1NCurrentArms >> 8);
+   data[6] = (uint8_t)rawL2NCurrentArms;
+   data[7] = (uint8_t)(rawL2NCurrentArms >> 8);
+}
+
+// unpack the signals from the CAN frame data
+static inline void INV_L2NStatusRSP_Unpack(INV_L2NStatusRSP_t *const signals, const uint8_t *const data)
+{
+   // L1NVoltageVrms : 0|16@1+
+   const uint32_t rawL1NVoltageVrms = (uint32_t)data[0] | ((uint32_t)data[1] << 8);
+   signals->L1NVoltageVrms = (uint16_t)rawL1NVoltageVrms;
+
+   // L2NVoltageVrms : 16|16@1+
+   const uint32_t rawL2NVoltageVrms = (uint32_t)data[2] | ((uint32_t)data[3] << 8);
+   signals->L2NVoltageVrms = (uint16_t)rawL2NVoltageVrms;
+
+   // L1NCurrentArms : 32|16@1+
+   const uint32_t rawL1NCurrentArms = (uint32_t)data[4] | ((uint32_t)data[5] << 8);
+   signals->L1NCurrentArms = (uint16_t)rawL1NCurrentArms;
+
+   // L2NCurrentArms : 48|16@1+
+   const uint32_t rawL2NCurrentArms = (uint32_t)data[6] | ((uint32_t)data[7] << 8);
+   signals->L2NCurrentArms = (uint16_t)rawL2NCurrentArms;
+}
+
+// signal: @L1NVoltageVrms  Factor= 0.01  Offset= 0.0
+#define INV_L2NStatusRSP_L1NVoltageVrms_MinRaw 0
+#define INV_L2NStatusRSP_L1NVoltageVrms_MaxRaw 65535
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t INV_L2NStatusRSP_L1NVoltageVrms_toS(const float value)
+{
+   float raw = value * 100.0f;
+   if (raw < (float)INV_L2NStatusRSP_L1NVoltageVrms_MinRaw)
+   {
+      raw = (float)INV_L2NStatusRSP_L1NVoltageVrms_MinRaw;
+   }
+   else if (raw > (float)INV_L2NStatusRSP_L1NVoltageVrms_MaxRaw)
+   {
+      raw = (float)INV_L2NStatusRSP_L1NVoltageVrms_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t INV_L2NStatusRSP_L1NVoltageVrms_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   raw = (raw >= 0) ? ((raw + 5) / 10) : ((raw - 5) / 10);
+   if (raw < INV_L2NStatusRSP_L1NVoltageVrms_MinRaw)
+   {
+      raw = INV_L2NStatusRSP_L1NVoltageVrms_MinRaw;
+   }
+   else if (raw > INV_L2NStatusRSP_L1NVoltageVrms_MaxRaw)
+   {
+      raw = INV_L2NStatusRSP_L1NVoltageVrms_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float INV_L2NStatusRSP_L1NVoltageVrms_fromS(const int32_t raw)
+{
+   return((float)raw * 0.01f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t INV_L2NStatusRSP_L1NVoltageVrms_fromS_Milli(const int32_t raw)
+{
+   return(raw * 10);
+}
+
+// signal: @L2NVoltageVrms  Factor= 0.01  Offset= 0.0
+#define INV_L2NStatusRSP_L2NVoltageVrms_MinRaw 0
+#define INV_L2NStatusRSP_L2NVoltageVrms_MaxRaw 65535
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t INV_L2NStatusRSP_L2NVoltageVrms_toS(const float value)
+{
+   float raw = value * 100.0f;
+   if (raw < (float)INV_L2NStatusRSP_L2NVoltageVrms_MinRaw)
+   {
+      raw = (float)INV_L2NStatusRSP_L2NVoltageVrms_MinRaw;
+   }
+   else if (raw > (float)INV_L2NStatusRSP_L2NVoltageVrms_MaxRaw)
+   {
+      raw = (float)INV_L2NStatusRSP_L2NVoltageVrms_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t INV_L2NStatusRSP_L2NVoltageVrms_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   raw = (raw >= 0) ? ((raw + 5) / 10) : ((raw - 5) / 10);
+   if (raw < INV_L2NStatusRSP_L2NVoltageVrms_MinRaw)
+   {
+      raw = INV_L2NStatusRSP_L2NVoltageVrms_MinRaw;
+   }
+   else if (raw > INV_L2NStatusRSP_L2NVoltageVrms_MaxRaw)
+   {
+      raw = INV_L2NStatusRSP_L2NVoltageVrms_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float INV_L2NStatusRSP_L2NVoltageVrms_fromS(const int32_t raw)
+{
+   return((float)raw * 0.01f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t INV_L2NStatusRSP_L2NVoltageVrms_fromS_Milli(const int32_t raw)
+{
+   return(raw * 10);
+}
+
+// signal: @L1NCurrentArms  Factor= 0.005  Offset= 0.0
+#define INV_L2NStatusRSP_L1NCurrentArms_MinRaw 0
+#define INV_L2NStatusRSP_L1NCurrentArms_MaxRaw 65535
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t INV_L2NStatusRSP_L1NCurrentArms_toS(const float value)
+{
+   float raw = value * 200.0f;
+   if (raw < (float)INV_L2NStatusRSP_L1NCurrentArms_MinRaw)
+   {
+      raw = (float)INV_L2NStatusRSP_L1NCurrentArms_MinRaw;
+   }
+   else if (raw > (float)INV_L2NStatusRSP_L1NCurrentArms_MaxRaw)
+   {
+      raw = (float)INV_L2NStatusRSP_L1NCurrentArms_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t INV_L2NStatusRSP_L1NCurrentArms_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   raw = (raw >= 0) ? ((raw + 2) / 5) : ((raw - 2) / 5);
+   if (raw < INV_L2NStatusRSP_L1NCurrentArms_MinRaw)
+   {
+      raw = INV_L2NStatusRSP_L1NCurrentArms_MinRaw;
+   }
+   else if (raw > INV_L2NStatusRSP_L1NCurrentArms_MaxRaw)
+   {
+      raw = INV_L2NStatusRSP_L1NCurrentArms_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float INV_L2NStatusRSP_L1NCurrentArms_fromS(const int32_t raw)
+{
+   return((float)raw * 0.005f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t INV_L2NStatusRSP_L1NCurrentArms_fromS_Milli(const int32_t raw)
+{
+   return(raw * 5);
+}
+
+// signal: @L2NCurrentArms  Factor= 0.005  Offset= 0.0
+#define INV_L2NStatusRSP_L2NCurrentArms_MinRaw 0
+#define INV_L2NStatusRSP_L2NCurrentArms_MaxRaw 65535
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t INV_L2NStatusRSP_L2NCurrentArms_toS(const float value)
+{
+   float raw = value * 200.0f;
+   if (raw < (float)INV_L2NStatusRSP_L2NCurrentArms_MinRaw)
+   {
+      raw = (float)INV_L2NStatusRSP_L2NCurrentArms_MinRaw;
+   }
+   else if (raw > (float)INV_L2NStatusRSP_L2NCurrentArms_MaxRaw)
+   {
+      raw = (float)INV_L2NStatusRSP_L2NCurrentArms_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t INV_L2NStatusRSP_L2NCurrentArms_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   raw = (raw >= 0) ? ((raw + 2) / 5) : ((raw - 2) / 5);
+   if (raw < INV_L2NStatusRSP_L2NCurrentArms_MinRaw)
+   {
+      raw = INV_L2NStatusRSP_L2NCurrentArms_MinRaw;
+   }
+   else if (raw > INV_L2NStatusRSP_L2NCurrentArms_MaxRaw)
+   {
+      raw = INV_L2NStatusRSP_L2NCurrentArms_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float INV_L2NStatusRSP_L2NCurrentArms_fromS(const int32_t raw)
+{
+   return((float)raw * 0.005f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t INV_L2NStatusRSP_L2NCurrentArms_fromS_Milli(const int32_t raw)
+{
+   return(raw * 5);
+}
+
+// INV_L2LStatusRSP CAN Message (0x1A002U)
+
+// The raw range of every signal must fit in its structure field
+REPORTMGR_CAN_STATIC_ASSERT(INV_L2LStatusRSP_L1L2VoltageVrms_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_L2LStatusRSP_t, L1L2VoltageVrms, 16U));
+REPORTMGR_CAN_STATIC_ASSERT(INV_L2LStatusRSP_L1L2CurrentArms_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_L2LStatusRSP_t, L1L2CurrentArms, 16U));
+
+// pack the signals into the CAN frame data, every byte of the frame is written
+static inline void INV_L2LStatusRSP_Pack(uint8_t *const data, const INV_L2LStatusRSP_t *const signals)
+{
+   const uint32_t rawL1L2VoltageVrms = (uint32_t)signals->L1L2VoltageVrms;
+   const uint32_t rawL1L2CurrentArms = (uint32_t)signals->L1L2CurrentArms;
+
+   data[0] = (uint8_t)rawL1L2VoltageVrms;
+   data[1] = (uint8_t)(rawL1L2VoltageVrms >> 8);
+   data[2] = (uint8_t)rawL1L2CurrentArms;
+   data[3] = (uint8_t)(rawL1L2CurrentArms >> 8);
+}
+
+// unpack the signals from the CAN frame data
+static inline void INV_L2LStatusRSP_Unpack(INV_L2LStatusRSP_t *const signals, const uint8_t *const data)
+{
+   // L1L2VoltageVrms : 0|16@1+
+   const uint32_t rawL1L2VoltageVrms = (uint32_t)data[0] | ((uint32_t)data[1] << 8);
+   signals->L1L2VoltageVrms = (uint16_t)rawL1L2VoltageVrms;
+
+   // L1L2CurrentArms : 16|16@1+
+   const uint32_t rawL1L2CurrentArms = (uint32_t)data[2] | ((uint32_t)data[3] << 8);
+   signals->L1L2CurrentArms = (uint16_t)rawL1L2CurrentArms;
+}
+
+// signal: @L1L2VoltageVrms  Factor= 0.01  Offset= 0.0
+#define INV_L2LStatusRSP_L1L2VoltageVrms_MinRaw 0
+#define INV_L2LStatusRSP_L1L2VoltageVrms_MaxRaw 65535
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t INV_L2LStatusRSP_L1L2VoltageVrms_toS(const float value)
+{
+   float raw = value * 100.0f;
+   if (raw < (float)INV_L2LStatusRSP_L1L2VoltageVrms_MinRaw)
+   {
+      raw = (float)INV_L2LStatusRSP_L1L2VoltageVrms_MinRaw;
+   }
+   else if (raw > (float)INV_L2LStatusRSP_L1L2VoltageVrms_MaxRaw)
+   {
+      raw = (float)INV_L2LStatusRSP_L1L2VoltageVrms_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t INV_L2LStatusRSP_L1L2VoltageVrms_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   raw = (raw >= 0) ? ((raw + 5) / 10) : ((raw - 5) / 10);
+   if (raw < INV_L2LStatusRSP_L1L2VoltageVrms_MinRaw)
+   {
+      raw = INV_L2LStatusRSP_L1L2VoltageVrms_MinRaw;
+   }
+   else if (raw > INV_L2LStatusRSP_L1L2VoltageVrms_MaxRaw)
+   {
+      raw = INV_L2LStatusRSP_L1L2VoltageVrms_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float INV_L2LStatusRSP_L1L2VoltageVrms_fromS(const int32_t raw)
+{
+   return((float)raw * 0.01f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t INV_L2LStatusRSP_L1L2VoltageVrms_fromS_Milli(const int32_t raw)
+{
+   return(raw * 10);
+}
+
+// signal: @L1L2CurrentArms  Factor= 0.005  Offset= 0.0
+#define INV_L2LStatusRSP_L1L2CurrentArms_MinRaw 0
+#define INV_L2LStatusRSP_L1L2CurrentArms_MaxRaw 65535
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t INV_L2LStatusRSP_L1L2CurrentArms_toS(const float value)
+{
+   float raw = value * 200.0f;
+   if (raw < (float)INV_L2LStatusRSP_L1L2CurrentArms_MinRaw)
+   {
+      raw = (float)INV_L2LStatusRSP_L1L2CurrentArms_MinRaw;
+   }
+   else if (raw > (float)INV_L2LStatusRSP_L1L2CurrentArms_MaxRaw)
+   {
+      raw = (float)INV_L2LStatusRSP_L1L2CurrentArms_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t INV_L2LStatusRSP_L1L2CurrentArms_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   raw = (raw >= 0) ? ((raw + 2) / 5) : ((raw - 2) / 5);
+   if (raw < INV_L2LStatusRSP_L1L2CurrentArms_MinRaw)
+   {
+      raw = INV_L2LStatusRSP_L1L2CurrentArms_MinRaw;
+   }
+   else if (raw > INV_L2LStatusRSP_L1L2CurrentArms_MaxRaw)
+   {
+      raw = INV_L2LStatusRSP_L1L2CurrentArms_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float INV_L2LStatusRSP_L1L2CurrentArms_fromS(const int32_t raw)
+{
+   return((float)raw * 0.005f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t INV_L2LStatusRSP_L1L2CurrentArms_fromS_Milli(const int32_t raw)
+{
+   return(raw * 5);
+}
+
+// INV_DCBusStatusRSP CAN Message (0x1A003U)
+
+// The raw range of every signal must fit in its structure field
+REPORTMGR_CAN_STATIC_ASSERT(INV_DCBusStatusRSP_PosBusVoltage_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_DCBusStatusRSP_t, PosBusVoltage, 16U));
+REPORTMGR_CAN_STATIC_ASSERT(INV_DCBusStatusRSP_NegBusVoltage_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_DCBusStatusRSP_t, NegBusVoltage, 16U));
+REPORTMGR_CAN_STATIC_ASSERT(INV_DCBusStatusRSP_PosBusCurrent_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_DCBusStatusRSP_t, PosBusCurrent, 16U));
+REPORTMGR_CAN_STATIC_ASSERT(INV_DCBusStatusRSP_NegBusCurrent_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_DCBusStatusRSP_t, NegBusCurrent, 16U));
+
+// pack the signals into the CAN frame data, every byte of the frame is written
+static inline void INV_DCBusStatusRSP_Pack(uint8_t *const data, const INV_DCBusStatusRSP_t *const signals)
+{
+   const uint32_t rawPosBusVoltage = (uint32_t)signals->PosBusVoltage;
+   const uint32_t rawNegBusVoltage = (uint32_t)signals->NegBusVoltage;
+   const uint32_t rawPosBusCurrent = (uint32_t)signals->PosBusCurrent;
+   const uint32_t rawNegBusCurrent = (uint32_t)signals->NegBusCurrent;
+
+   data[0] = (uint8_t)rawPosBusVoltage;
+   data[1] = (uint8_t)(rawPosBusVoltage >> 8);
+   data[2] = (uint8_t)rawNegBusVoltage;
+   data[3] = (uint8_t)(rawNegBusVoltage >> 8);
+   data[4] = (uint8_t)rawPosBusCurrent;
+   data[5] = (uint8_t)(rawPosBusCurrent >> 8);
+   data[6] = (uint8_t)rawNegBusCurrent;
+   data[7] = (uint8_t)(rawNegBusCurrent >> 8);
+}
+
+// unpack the signals from the CAN frame data
+static inline void INV_DCBusStatusRSP_Unpack(INV_DCBusStatusRSP_t *const signals, const uint8_t *const data)
+{
+   // PosBusVoltage : 0|16@1+
+   const uint32_t rawPosBusVoltage = (uint32_t)data[0] | ((uint32_t)data[1] << 8);
+   signals->PosBusVoltage = (uint16_t)rawPosBusVoltage;
+
+   // NegBusVoltage : 16|16@1+
+   const uint32_t rawNegBusVoltage = (uint32_t)data[2] | ((uint32_t)data[3] << 8);
+   signals->NegBusVoltage = (uint16_t)rawNegBusVoltage;
+
+   // PosBusCurrent : 32|16@1+
+   const uint32_t rawPosBusCurrent = (uint32_t)data[4] | ((uint32_t)data[5] << 8);
+   signals->PosBusCurrent = (uint16_t)rawPosBusCurrent;
+
+   // NegBusCurrent : 48|16@1+
+   const uint32_t rawNegBusCurrent = (uint32_t)data[6] | ((uint32_t)data[7] << 8);
+   signals->NegBusCurrent = (uint16_t)rawNegBusCurrent;
+}
+
+// signal: @PosBusVoltage  Factor= 0.01  Offset= 0.0
+#define INV_DCBusStatusRSP_PosBusVoltage_MinRaw 0
+#define INV_DCBusStatusRSP_PosBusVoltage_MaxRaw 65535
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t INV_DCBusStatusRSP_PosBusVoltage_toS(const float value)
+{
+   float raw = value * 100.0f;
+   if (raw < (float)INV_DCBusStatusRSP_PosBusVoltage_MinRaw)
+   {
+      raw = (float)INV_DCBusStatusRSP_PosBusVoltage_MinRaw;
+   }
+   else if (raw > (float)INV_DCBusStatusRSP_PosBusVoltage_MaxRaw)
+   {
+      raw = (float)INV_DCBusStatusRSP_PosBusVoltage_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t INV_DCBusStatusRSP_PosBusVoltage_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   raw = (raw >= 0) ? ((raw + 5) / 10) : ((raw - 5) / 10);
+   if (raw < INV_DCBusStatusRSP_PosBusVoltage_MinRaw)
+   {
+      raw = INV_DCBusStatusRSP_PosBusVoltage_MinRaw;
+   }
+   else if (raw > INV_DCBusStatusRSP_PosBusVoltage_MaxRaw)
+   {
+      raw = INV_DCBusStatusRSP_PosBusVoltage_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float INV_DCBusStatusRSP_PosBusVoltage_fromS(const int32_t raw)
+{
+   return((float)raw * 0.01f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t INV_DCBusStatusRSP_PosBusVoltage_fromS_Milli(const int32_t raw)
+{
+   return(raw * 10);
+}
+
+// signal: @NegBusVoltage  Factor= 0.01  Offset= 0.0
+#define INV_DCBusStatusRSP_NegBusVoltage_MinRaw 0
+#define INV_DCBusStatusRSP_NegBusVoltage_MaxRaw 65535
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t INV_DCBusStatusRSP_NegBusVoltage_toS(const float value)
+{
+   float raw = value * 100.0f;
+   if (raw < (float)INV_DCBusStatusRSP_NegBusVoltage_MinRaw)
+   {
+      raw = (float)INV_DCBusStatusRSP_NegBusVoltage_MinRaw;
+   }
+   else if (raw > (float)INV_DCBusStatusRSP_NegBusVoltage_MaxRaw)
+   {
+      raw = (float)INV_DCBusStatusRSP_NegBusVoltage_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t INV_DCBusStatusRSP_NegBusVoltage_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   raw = (raw >= 0) ? ((raw + 5) / 10) : ((raw - 5) / 10);
+   if (raw < INV_DCBusStatusRSP_NegBusVoltage_MinRaw)
+   {
+      raw = INV_DCBusStatusRSP_NegBusVoltage_MinRaw;
+   }
+   else if (raw > INV_DCBusStatusRSP_NegBusVoltage_MaxRaw)
+   {
+      raw = INV_DCBusStatusRSP_NegBusVoltage_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float INV_DCBusStatusRSP_NegBusVoltage_fromS(const int32_t raw)
+{
+   return((float)raw * 0.01f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t INV_DCBusStatusRSP_NegBusVoltage_fromS_Milli(const int32_t raw)
+{
+   return(raw * 10);
+}
+
+// signal: @PosBusCurrent  Factor= 0.005  Offset= 0.0
+#define INV_DCBusStatusRSP_PosBusCurrent_MinRaw 0
+#define INV_DCBusStatusRSP_PosBusCurrent_MaxRaw 65535
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t INV_DCBusStatusRSP_PosBusCurrent_toS(const float value)
+{
+   float raw = value * 200.0f;
+   if (raw < (float)INV_DCBusStatusRSP_PosBusCurrent_MinRaw)
+   {
+      raw = (float)INV_DCBusStatusRSP_PosBusCurrent_MinRaw;
+   }
+   else if (raw > (float)INV_DCBusStatusRSP_PosBusCurrent_MaxRaw)
+   {
+      raw = (float)INV_DCBusStatusRSP_PosBusCurrent_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t INV_DCBusStatusRSP_PosBusCurrent_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   raw = (raw >= 0) ? ((raw + 2) / 5) : ((raw - 2) / 5);
+   if (raw < INV_DCBusStatusRSP_PosBusCurrent_MinRaw)
+   {
+      raw = INV_DCBusStatusRSP_PosBusCurrent_MinRaw;
+   }
+   else if (raw > INV_DCBusStatusRSP_PosBusCurrent_MaxRaw)
+   {
+      raw = INV_DCBusStatusRSP_PosBusCurrent_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float INV_DCBusStatusRSP_PosBusCurrent_fromS(const int32_t raw)
+{
+   return((float)raw * 0.005f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t INV_DCBusStatusRSP_PosBusCurrent_fromS_Milli(const int32_t raw)
+{
+   return(raw * 5);
+}
+
+// signal: @NegBusCurrent  Factor= 0.005  Offset= 0.0
+#define INV_DCBusStatusRSP_NegBusCurrent_MinRaw 0
+#define INV_DCBusStatusRSP_NegBusCurrent_MaxRaw 65535
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t INV_DCBusStatusRSP_NegBusCurrent_toS(const float value)
+{
+   float raw = value * 200.0f;
+   if (raw < (float)INV_DCBusStatusRSP_NegBusCurrent_MinRaw)
+   {
+      raw = (float)INV_DCBusStatusRSP_NegBusCurrent_MinRaw;
+   }
+   else if (raw > (float)INV_DCBusStatusRSP_NegBusCurrent_MaxRaw)
+   {
+      raw = (float)INV_DCBusStatusRSP_NegBusCurrent_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t INV_DCBusStatusRSP_NegBusCurrent_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   raw = (raw >= 0) ? ((raw + 2) / 5) : ((raw - 2) / 5);
+   if (raw < INV_DCBusStatusRSP_NegBusCurrent_MinRaw)
+   {
+      raw = INV_DCBusStatusRSP_NegBusCurrent_MinRaw;
+   }
+   else if (raw > INV_DCBusStatusRSP_NegBusCurrent_MaxRaw)
+   {
+      raw = INV_DCBusStatusRSP_NegBusCurrent_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float INV_DCBusStatusRSP_NegBusCurrent_fromS(const int32_t raw)
+{
+   return((float)raw * 0.005f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t INV_DCBusStatusRSP_NegBusCurrent_fromS_Milli(const int32_t raw)
+{
+   return(raw * 5);
+}
+
+// INV_TemperaturesRSP CAN Message (0x1A004U)
+
+// The raw range of every signal must fit in its structure field
+REPORTMGR_CAN_STATIC_ASSERT(INV_TemperaturesRSP_InvHeatsinkC_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_TemperaturesRSP_t, InvHeatsinkC, 8U));
+REPORTMGR_CAN_STATIC_ASSERT(INV_TemperaturesRSP_InvPowerStage1C_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_TemperaturesRSP_t, InvPowerStage1C, 8U));
+REPORTMGR_CAN_STATIC_ASSERT(INV_TemperaturesRSP_InvPowerStage2C_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_TemperaturesRSP_t, InvPowerStage2C, 8U));
+REPORTMGR_CAN_STATIC_ASSERT(INV_TemperaturesRSP_InvPowerStage3C_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_TemperaturesRSP_t, InvPowerStage3C, 8U));
+REPORTMGR_CAN_STATIC_ASSERT(INV_TemperaturesRSP_InvFanDutyCycle1_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_TemperaturesRSP_t, InvFanDutyCycle1, 10U));
+REPORTMGR_CAN_STATIC_ASSERT(INV_TemperaturesRSP_InvFanDutyCycle2_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_TemperaturesRSP_t, InvFanDutyCycle2, 10U));
+
+// pack the signals into the CAN frame data, every byte of the frame is written
+static inline void INV_TemperaturesRSP_Pack(uint8_t *const data, const INV_TemperaturesRSP_t *const signals)
+{
+   const uint32_t rawInvHeatsinkC = (uint32_t)signals->InvHeatsinkC;
+   const uint32_t rawInvPowerStage1C = (uint32_t)signals->InvPowerStage1C;
+   const uint32_t rawInvPowerStage2C = (uint32_t)signals->InvPowerStage2C;
+   const uint32_t rawInvPowerStage3C = (uint32_t)signals->InvPowerStage3C;
+   const uint32_t rawInvFanDutyCycle1 = (uint32_t)signals->InvFanDutyCycle1;
+   const uint32_t rawInvFanDutyCycle2 = (uint32_t)signals->InvFanDutyCycle2;
+
+   data[0] = (uint8_t)rawInvHeatsinkC;
+   data[1] = (uint8_t)rawInvPowerStage1C;
+   data[2] = (uint8_t)rawInvPowerStage2C;
+   data[3] = (uint8_t)rawInvPowerStage3C;
+   data[4] = (uint8_t)rawInvFanDutyCycle1;
+   data[5] = (uint8_t)(rawInvFanDutyCycle1 >> 8);
+   data[6] = (uint8_t)rawInvFanDutyCycle2;
+   data[7] = (uint8_t)(rawInvFanDutyCycle2 >> 8);
+}
+
+// unpack the signals from the CAN frame data
+static inline void INV_TemperaturesRSP_Unpack(INV_TemperaturesRSP_t *const signals, const uint8_t *const data)
+{
+   // InvHeatsinkC : 0|8@1+
+   const uint32_t rawInvHeatsinkC = (uint32_t)data[0];
+   signals->InvHeatsinkC = (uint8_t)rawInvHeatsinkC;
+
+   // InvPowerStage1C : 8|8@1+
+   const uint32_t rawInvPowerStage1C = (uint32_t)data[1];
+   signals->InvPowerStage1C = (uint8_t)rawInvPowerStage1C;
+
+   // InvPowerStage2C : 16|8@1+
+   const uint32_t rawInvPowerStage2C = (uint32_t)data[2];
+   signals->InvPowerStage2C = (uint8_t)rawInvPowerStage2C;
+
+   // InvPowerStage3C : 24|8@1+
+   const uint32_t rawInvPowerStage3C = (uint32_t)data[3];
+   signals->InvPowerStage3C = (uint8_t)rawInvPowerStage3C;
+
+   // InvFanDutyCycle1 : 32|16@1+
+   const uint32_t rawInvFanDutyCycle1 = (uint32_t)data[4] | ((uint32_t)data[5] << 8);
+   signals->InvFanDutyCycle1 = (uint16_t)rawInvFanDutyCycle1;
+
+   // InvFanDutyCycle2 : 48|16@1+
+   const uint32_t rawInvFanDutyCycle2 = (uint32_t)data[6] | ((uint32_t)data[7] << 8);
+   signals->InvFanDutyCycle2 = (uint16_t)rawInvFanDutyCycle2;
+}
+
+// signal: @InvHeatsinkC  Factor= 1.0  Offset= -60.0
+#define INV_TemperaturesRSP_InvHeatsinkC_MinRaw 0
+#define INV_TemperaturesRSP_InvHeatsinkC_MaxRaw 255
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint8_t INV_TemperaturesRSP_InvHeatsinkC_toS(const float value)
+{
+   float raw = value + 60.0f;
+   if (raw < (float)INV_TemperaturesRSP_InvHeatsinkC_MinRaw)
+   {
+      raw = (float)INV_TemperaturesRSP_InvHeatsinkC_MinRaw;
+   }
+   else if (raw > (float)INV_TemperaturesRSP_InvHeatsinkC_MaxRaw)
+   {
+      raw = (float)INV_TemperaturesRSP_InvHeatsinkC_MaxRaw;
+   }
+   return((uint8_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint8_t INV_TemperaturesRSP_InvHeatsinkC_toS_Milli(const int32_t value)
+{
+   int32_t raw = value + 60000;
+   raw = (raw >= 0) ? ((raw + 500) / 1000) : ((raw - 500) / 1000);
+   if (raw < INV_TemperaturesRSP_InvHeatsinkC_MinRaw)
+   {
+      raw = INV_TemperaturesRSP_InvHeatsinkC_MinRaw;
+   }
+   else if (raw > INV_TemperaturesRSP_InvHeatsinkC_MaxRaw)
+   {
+      raw = INV_TemperaturesRSP_InvHeatsinkC_MaxRaw;
+   }
+   return((uint8_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float INV_TemperaturesRSP_InvHeatsinkC_fromS(const int32_t raw)
+{
+   return(((float)raw) - 60.0f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t INV_TemperaturesRSP_InvHeatsinkC_fromS_Milli(const int32_t raw)
+{
+   return((raw * 1000) - 60000);
+}
+
+// signal: @InvPowerStage1C  Factor= 1.0  Offset= -60.0
+#define INV_TemperaturesRSP_InvPowerStage1C_MinRaw 0
+#define INV_TemperaturesRSP_InvPowerStage1C_MaxRaw 255
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint8_t INV_TemperaturesRSP_InvPowerStage1C_toS(const float value)
+{
+   float raw = value + 60.0f;
+   if (raw < (float)INV_TemperaturesRSP_InvPowerStage1C_MinRaw)
+   {
+      raw = (float)INV_TemperaturesRSP_InvPowerStage1C_MinRaw;
+   }
+   else if (raw > (float)INV_TemperaturesRSP_InvPowerStage1C_MaxRaw)
+   {
+      raw = (float)INV_TemperaturesRSP_InvPowerStage1C_MaxRaw;
+   }
+   return((uint8_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint8_t INV_TemperaturesRSP_InvPowerStage1C_toS_Milli(const int32_t value)
+{
+   int32_t raw = value + 60000;
+   raw = (raw >= 0) ? ((raw + 500) / 1000) : ((raw - 500) / 1000);
+   if (raw < INV_TemperaturesRSP_InvPowerStage1C_MinRaw)
+   {
+      raw = INV_TemperaturesRSP_InvPowerStage1C_MinRaw;
+   }
+   else if (raw > INV_TemperaturesRSP_InvPowerStage1C_MaxRaw)
+   {
+      raw = INV_TemperaturesRSP_InvPowerStage1C_MaxRaw;
+   }
+   return((uint8_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float INV_TemperaturesRSP_InvPowerStage1C_fromS(const int32_t raw)
+{
+   return(((float)raw) - 60.0f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t INV_TemperaturesRSP_InvPowerStage1C_fromS_Milli(const int32_t raw)
+{
+   return((raw * 1000) - 60000);
+}
+
+// signal: @InvPowerStage2C  Factor= 1.0  Offset= -60.0
+#define INV_TemperaturesRSP_InvPowerStage2C_MinRaw 0
+#define INV_TemperaturesRSP_InvPowerStage2C_MaxRaw 255
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint8_t INV_TemperaturesRSP_InvPowerStage2C_toS(const float value)
+{
+   float raw = value + 60.0f;
+   if (raw < (float)INV_TemperaturesRSP_InvPowerStage2C_MinRaw)
+   {
+      raw = (float)INV_TemperaturesRSP_InvPowerStage2C_MinRaw;
+   }
+   else if (raw > (float)INV_TemperaturesRSP_InvPowerStage2C_MaxRaw)
+   {
+      raw = (float)INV_TemperaturesRSP_InvPowerStage2C_MaxRaw;
+   }
+   return((uint8_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint8_t INV_TemperaturesRSP_InvPowerStage2C_toS_Milli(const int32_t value)
+{
+   int32_t raw = value + 60000;
+   raw = (raw >= 0) ? ((raw + 500) / 1000) : ((raw - 500) / 1000);
+   if (raw < INV_TemperaturesRSP_InvPowerStage2C_MinRaw)
+   {
+      raw = INV_TemperaturesRSP_InvPowerStage2C_MinRaw;
+   }
+   else if (raw > INV_TemperaturesRSP_InvPowerStage2C_MaxRaw)
+   {
+      raw = INV_TemperaturesRSP_InvPowerStage2C_MaxRaw;
+   }
+   return((uint8_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float INV_TemperaturesRSP_InvPowerStage2C_fromS(const int32_t raw)
+{
+   return(((float)raw) - 60.0f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t INV_TemperaturesRSP_InvPowerStage2C_fromS_Milli(const int32_t raw)
+{
+   return((raw * 1000) - 60000);
+}
+
+// signal: @InvPowerStage3C  Factor= 1.0  Offset= -60.0
+#define INV_TemperaturesRSP_InvPowerStage3C_MinRaw 0
+#define INV_TemperaturesRSP_InvPowerStage3C_MaxRaw 255
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint8_t INV_TemperaturesRSP_InvPowerStage3C_toS(const float value)
+{
+   float raw = value + 60.0f;
+   if (raw < (float)INV_TemperaturesRSP_InvPowerStage3C_MinRaw)
+   {
+      raw = (float)INV_TemperaturesRSP_InvPowerStage3C_MinRaw;
+   }
+   else if (raw > (float)INV_TemperaturesRSP_InvPowerStage3C_MaxRaw)
+   {
+      raw = (float)INV_TemperaturesRSP_InvPowerStage3C_MaxRaw;
+   }
+   return((uint8_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint8_t INV_TemperaturesRSP_InvPowerStage3C_toS_Milli(const int32_t value)
+{
+   int32_t raw = value + 60000;
+   raw = (raw >= 0) ? ((raw + 500) / 1000) : ((raw - 500) / 1000);
+   if (raw < INV_TemperaturesRSP_InvPowerStage3C_MinRaw)
+   {
+      raw = INV_TemperaturesRSP_InvPowerStage3C_MinRaw;
+   }
+   else if (raw > INV_TemperaturesRSP_InvPowerStage3C_MaxRaw)
+   {
+      raw = INV_TemperaturesRSP_InvPowerStage3C_MaxRaw;
+   }
+   return((uint8_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float INV_TemperaturesRSP_InvPowerStage3C_fromS(const int32_t raw)
+{
+   return(((float)raw) - 60.0f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t INV_TemperaturesRSP_InvPowerStage3C_fromS_Milli(const int32_t raw)
+{
+   return((raw * 1000) - 60000);
+}
+
+// signal: @InvFanDutyCycle1  Factor= 0.1  Offset= 0.0
+#define INV_TemperaturesRSP_InvFanDutyCycle1_MinRaw 0
+#define INV_TemperaturesRSP_InvFanDutyCycle1_MaxRaw 1023
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t INV_TemperaturesRSP_InvFanDutyCycle1_toS(const float value)
+{
+   float raw = value * 10.0f;
+   if (raw < (float)INV_TemperaturesRSP_InvFanDutyCycle1_MinRaw)
+   {
+      raw = (float)INV_TemperaturesRSP_InvFanDutyCycle1_MinRaw;
+   }
+   else if (raw > (float)INV_TemperaturesRSP_InvFanDutyCycle1_MaxRaw)
+   {
+      raw = (float)INV_TemperaturesRSP_InvFanDutyCycle1_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t INV_TemperaturesRSP_InvFanDutyCycle1_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   raw = (raw >= 0) ? ((raw + 50) / 100) : ((raw - 50) / 100);
+   if (raw < INV_TemperaturesRSP_InvFanDutyCycle1_MinRaw)
+   {
+      raw = INV_TemperaturesRSP_InvFanDutyCycle1_MinRaw;
+   }
+   else if (raw > INV_TemperaturesRSP_InvFanDutyCycle1_MaxRaw)
+   {
+      raw = INV_TemperaturesRSP_InvFanDutyCycle1_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float INV_TemperaturesRSP_InvFanDutyCycle1_fromS(const int32_t raw)
+{
+   return((float)raw * 0.1f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t INV_TemperaturesRSP_InvFanDutyCycle1_fromS_Milli(const int32_t raw)
+{
+   return(raw * 100);
+}
+
+// signal: @InvFanDutyCycle2  Factor= 0.1  Offset= 0.0
+#define INV_TemperaturesRSP_InvFanDutyCycle2_MinRaw 0
+#define INV_TemperaturesRSP_InvFanDutyCycle2_MaxRaw 1023
+
+// conversion value to CAN signal, clamped to the signal range
+static inline uint16_t INV_TemperaturesRSP_InvFanDutyCycle2_toS(const float value)
+{
+   float raw = value * 10.0f;
+   if (raw < (float)INV_TemperaturesRSP_InvFanDutyCycle2_MinRaw)
+   {
+      raw = (float)INV_TemperaturesRSP_InvFanDutyCycle2_MinRaw;
+   }
+   else if (raw > (float)INV_TemperaturesRSP_InvFanDutyCycle2_MaxRaw)
+   {
+      raw = (float)INV_TemperaturesRSP_InvFanDutyCycle2_MaxRaw;
+   }
+   return((uint16_t)(int32_t)(raw + ((raw >= 0.0f) ? 0.5f : -0.5f)));
+}
+
+// conversion value in milli-units to CAN signal, clamped to the signal range
+static inline uint16_t INV_TemperaturesRSP_InvFanDutyCycle2_toS_Milli(const int32_t value)
+{
+   int32_t raw = value;
+   raw = (raw >= 0) ? ((raw + 50) / 100) : ((raw - 50) / 100);
+   if (raw < INV_TemperaturesRSP_InvFanDutyCycle2_MinRaw)
+   {
+      raw = INV_TemperaturesRSP_InvFanDutyCycle2_MinRaw;
+   }
+   else if (raw > INV_TemperaturesRSP_InvFanDutyCycle2_MaxRaw)
+   {
+      raw = INV_TemperaturesRSP_InvFanDutyCycle2_MaxRaw;
+   }
+   return((uint16_t)raw);
+}
+
+// conversion value from CAN signal
+static inline float INV_TemperaturesRSP_InvFanDutyCycle2_fromS(const int32_t raw)
+{
+   return((float)raw * 0.1f);
+}
+
+// conversion value from CAN signal to milli-units
+static inline int32_t INV_TemperaturesRSP_InvFanDutyCycle2_fromS_Milli(const int32_t raw)
+{
+   return(raw * 100);
+}
+
+// INV_StateRSP CAN Message (0x1A005U)
+
+// The raw range of every signal must fit in its structure field
+REPORTMGR_CAN_STATIC_ASSERT(INV_StateRSP_InvState_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_StateRSP_t, InvState, 8U));
+REPORTMGR_CAN_STATIC_ASSERT(INV_StateRSP_InvACRelay_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_StateRSP_t, InvACRelay, 8U));
+REPORTMGR_CAN_STATIC_ASSERT(INV_StateRSP_INV_L1L2InPhase_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_StateRSP_t, INV_L1L2InPhase, 8U));
+
+// pack the signals into the CAN frame data, every byte of the frame is written
+static inline void INV_StateRSP_Pack(uint8_t *const data, const INV_StateRSP_t *const signals)
+{
+   const uint32_t rawInvState = (uint32_t)signals->InvState;
+   const uint32_t rawInvACRelay = (uint32_t)signals->InvACRelay;
+   const uint32_t rawINV_L1L2InPhase = (uint32_t)signals->INV_L1L2InPhase;
+
+   data[0] = (uint8_t)rawInvState;
+   data[1] = (uint8_t)rawInvACRelay;
+   data[2] = (uint8_t)rawINV_L1L2InPhase;
+}
+
+// unpack the signals from the CAN frame data
+static inline void INV_StateRSP_Unpack(INV_StateRSP_t *const signals, const uint8_t *const data)
+{
+   // InvState : 0|8@1+
+   const uint32_t rawInvState = (uint32_t)data[0];
+   signals->InvState = (uint8_t)rawInvState;
+
+   // InvACRelay : 8|8@1+
+   const uint32_t rawInvACRelay = (uint32_t)data[1];
+   signals->InvACRelay = (uint8_t)rawInvACRelay;
+
+   // INV_L1L2InPhase : 16|8@1+
+   const uint32_t rawINV_L1L2InPhase = (uint32_t)data[2];
+   signals->INV_L1L2InPhase = (uint8_t)rawINV_L1L2InPhase;
+}
+
+// INV_ErrorStatusRSP CAN Message (0x1A006U)
+
+// The raw range of every signal must fit in its structure field
+REPORTMGR_CAN_STATIC_ASSERT(INV_ErrorStatusRSP_ActiveErrors_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_ErrorStatusRSP_t, ActiveErrors, 32U));
+REPORTMGR_CAN_STATIC_ASSERT(INV_ErrorStatusRSP_ErrorSequence_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_ErrorStatusRSP_t, ErrorSequence, 16U));
+REPORTMGR_CAN_STATIC_ASSERT(INV_ErrorStatusRSP_NumErrorChanges_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_ErrorStatusRSP_t, NumErrorChanges, 16U));
+
+// pack the signals into the CAN frame data, every byte of the frame is written
+static inline void INV_ErrorStatusRSP_Pack(uint8_t *const data, const INV_ErrorStatusRSP_t *const signals)
+{
+   const uint32_t rawActiveErrors = (uint32_t)signals->ActiveErrors;
+   const uint32_t rawErrorSequence = (uint32_t)signals->ErrorSequence;
+   const uint32_t rawNumErrorChanges = (uint32_t)signals->NumErrorChanges;
+
+   data[0] = (uint8_t)rawActiveErrors;
+   data[1] = (uint8_t)(rawActiveErrors >> 8);
+   data[2] = (uint8_t)(rawActiveErrors >> 16);
+   data[3] = (uint8_t)(rawActiveErrors >> 24);
+   data[4] = (uint8_t)rawErrorSequence;
+   data[5] = (uint8_t)(rawErrorSequence >> 8);
+   data[6] = (uint8_t)rawNumErrorChanges;
+   data[7] = (uint8_t)(rawNumErrorChanges >> 8);
+}
+
+// unpack the signals from the CAN frame data
+static inline void INV_ErrorStatusRSP_Unpack(INV_ErrorStatusRSP_t *const signals, const uint8_t *const data)
+{
+   // ActiveErrors : 0|32@1+
+   const uint32_t rawActiveErrors = (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+   signals->ActiveErrors = (uint32_t)rawActiveErrors;
+
+   // ErrorSequence : 32|16@1+
+   const uint32_t rawErrorSequence = (uint32_t)data[4] | ((uint32_t)data[5] << 8);
+   signals->ErrorSequence = (uint16_t)rawErrorSequence;
+
+   // NumErrorChanges : 48|16@1+
+   const uint32_t rawNumErrorChanges = (uint32_t)data[6] | ((uint32_t)data[7] << 8);
+   signals->NumErrorChanges = (uint16_t)rawNumErrorChanges;
+}
+
+// BB_ErrorStatusRSP CAN Message (0x1B008U)
+
+// The raw range of every signal must fit in its structure field
+REPORTMGR_CAN_STATIC_ASSERT(BB_ErrorStatusRSP_ActiveErrors_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_ErrorStatusRSP_t, ActiveErrors, 32U));
+REPORTMGR_CAN_STATIC_ASSERT(BB_ErrorStatusRSP_ErrorSequence_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_ErrorStatusRSP_t, ErrorSequence, 16U));
+REPORTMGR_CAN_STATIC_ASSERT(BB_ErrorStatusRSP_NumErrorChanges_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_ErrorStatusRSP_t, NumErrorChanges, 16U));
+
+// pack the signals into the CAN frame data, every byte of the frame is written
+static inline void BB_ErrorStatusRSP_Pack(uint8_t *const data, const BB_ErrorStatusRSP_t *const signals)
+{
+   const uint32_t rawActiveErrors = (uint32_t)signals->ActiveErrors;
+   const uint32_t rawErrorSequence = (uint32_t)signals->ErrorSequence;
+   const uint32_t rawNumErrorChanges = (uint32_t)signals->NumErrorChanges;
+
+   data[0] = (uint8_t)rawActiveErrors;
+   data[1] = (uint8_t)(rawActiveErrors >> 8);
+   data[2] = (uint8_t)(rawActiveErrors >> 16);
+   data[3] = (uint8_t)(rawActiveErrors >> 24);
+   data[4] = (uint8_t)rawErrorSequence;
+   data[5] = (uint8_t)(rawErrorSequence >> 8);
+   data[6] = (uint8_t)rawNumErrorChanges;
+   data[7] = (uint8_t)(rawNumErrorChanges >> 8);
+}
+
+// unpack the signals from the CAN frame data
+static inline void BB_ErrorStatusRSP_Unpack(BB_ErrorStatusRSP_t *const signals, const uint8_t *const data)
+{
+   // ActiveErrors : 0|32@1+
+   const uint32_t rawActiveErrors = (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+   signals->ActiveErrors = (uint32_t)rawActiveErrors;
+
+   // ErrorSequence : 32|16@1+
+   const uint32_t rawErrorSequence = (uint32_t)data[4] | ((uint32_t)data[5] << 8);
+   signals->ErrorSequence = (uint16_t)rawErrorSequence;
+
+   // NumErrorChanges : 48|16@1+
+   const uint32_t rawNumErrorChanges = (uint32_t)data[6] | ((uint32_t)data[7] << 8);
+   signals->NumErrorChanges = (uint16_t)rawNumErrorChanges;
+}
+
+// BB_CommandCMD CAN Message (0xB101U)
+
+// The raw range of every signal must fit in its structure field
+REPORTMGR_CAN_STATIC_ASSERT(BB_CommandCMD_BB_StateReq_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_CommandCMD_t, BB_StateReq, 8U));
+REPORTMGR_CAN_STATIC_ASSERT(BB_CommandCMD_BB_ResetReq_FieldCheck, REPORTMGR_CAN_FIELD_FITS(BB_CommandCMD_t, BB_ResetReq, 8U));
+
+// pack the signals into the CAN frame data, every byte of the frame is written
+static inline void BB_CommandCMD_Pack(uint8_t *const data, const BB_CommandCMD_t *const signals)
+{
+   const uint32_t rawBB_StateReq = (uint32_t)signals->BB_StateReq;
+   const uint32_t rawBB_ResetReq = (uint32_t)signals->BB_ResetReq;
+
+   data[0] = (uint8_t)rawBB_StateReq;
+   data[1] = (uint8_t)rawBB_ResetReq;
+}
+
+// unpack the signals from the CAN frame data
+static inline void BB_CommandCMD_Unpack(BB_CommandCMD_t *const signals, const uint8_t *const data)
+{
+   // BB_StateReq : 0|8@1+
+   const uint32_t rawBB_StateReq = (uint32_t)data[0];
+   signals->BB_StateReq = (uint8_t)rawBB_StateReq;
+
+   // BB_ResetReq : 8|8@1+
+   const uint32_t rawBB_ResetReq = (uint32_t)data[1];
+   signals->BB_ResetReq = (uint8_t)rawBB_ResetReq;
+}
+
+// INV_CommandCMD CAN Message (0xA101U)
+
+// The raw range of every signal must fit in its structure field
+REPORTMGR_CAN_STATIC_ASSERT(INV_CommandCMD_INV_StateReq_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_CommandCMD_t, INV_StateReq, 8U));
+REPORTMGR_CAN_STATIC_ASSERT(INV_CommandCMD_INV_ResetReq_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_CommandCMD_t, INV_ResetReq, 8U));
+REPORTMGR_CAN_STATIC_ASSERT(INV_CommandCMD_INV_RapidShutdown_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_CommandCMD_t, INV_RapidShutdown, 8U));
+REPORTMGR_CAN_STATIC_ASSERT(INV_CommandCMD_INV_L1L2InPhaseReq_FieldCheck, REPORTMGR_CAN_FIELD_FITS(INV_CommandCMD_t, INV_L1L2InPhaseReq, 8U));
+
+// pack the signals into the CAN frame data, every byte of the frame is written
+static inline void INV_CommandCMD_Pack(uint8_t *const data, const INV_CommandCMD_t *const signals)
+{
+   const uint32_t rawINV_StateReq = (uint32_t)signals->INV_StateReq;
+   const uint32_t rawINV_ResetReq = (uint32_t)signals->INV_ResetReq;
+   const uint32_t rawINV_RapidShutdown = (uint32_t)signals->INV_RapidShutdown;
+   const uint32_t rawINV_L1L2InPhaseReq = (uint32_t)signals->INV_L1L2InPhaseReq;
+
+   data[0] = (uint8_t)rawINV_StateReq;
+   data[1] = (uint8_t)rawINV_ResetReq;
+   data[2] = (uint8_t)rawINV_RapidShutdown;
+   data[3] = (uint8_t)rawINV_L1L2InPhaseReq;
+}
+
+// unpack the signals from the CAN frame data
+static inline void INV_CommandCMD_Unpack(INV_CommandCMD_t *const signals, const uint8_t *const data)
+{
+   // INV_StateReq : 0|8@1+
+   const uint32_t rawINV_StateReq = (uint32_t)data[0];
+   signals->INV_StateReq = (uint8_t)rawINV_StateReq;
+
+   // INV_ResetReq : 8|8@1+
+   const uint32_t rawINV_ResetReq = (uint32_t)data[1];
+   signals->INV_ResetReq = (uint8_t)rawINV_ResetReq;
+
+   // INV_RapidShutdown : 16|8@1+
+   const uint32_t rawINV_RapidShutdown = (uint32_t)data[2];
+   signals->INV_RapidShutdown = (uint8_t)rawINV_RapidShutdown;
+
+   // INV_L1L2InPhaseReq : 24|8@1+
+   const uint32_t rawINV_L1L2InPhaseReq = (uint32_t)data[3];
+   signals->INV_L1L2InPhaseReq = (uint8_t)rawINV_L1L2InPhaseReq;
+}
+
+
+#ifdef __cplusplus
+}
+#endif
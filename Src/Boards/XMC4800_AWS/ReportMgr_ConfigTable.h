@@ -0,0 +1,45 @@
+/*******************************************************************************
+// Report Manager Configuration
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "ReportMgr.h"
+#include "ReportMgr_CAN.h"
+// Platform Includes
+// Other Includes
+
+
+/*******************************************************************************
+// Constant Configuration Variable Declarations
+*******************************************************************************/
+
+// This table defines the messages streamed on the CAN bus
+// Each message is packed by its Message Router handler, so a streamed frame
+// matches the response to a request for the same message.
+// The phase offsets spread the frames evenly, at most one scheduled frame is
+// sent per ReportMgr_Update call.
+static const ReportMgr_TxScheduleItem_t ReportMgr_txScheduleTable[] =
+{
+   // { CAN ID, Cycle (ms), Phase (ms), Packing Function }
+   // The 100 ms messages are spread 20 ms apart, the slow message fills a gap
+   { INV_L2NStatusRSP_CANID | 0x80000000U,    100U,  0U, ReportMgr_MessageRouter_INV_L2NStatusRSP },
+   { INV_L2LStatusRSP_CANID | 0x80000000U,    100U, 20U, ReportMgr_MessageRouter_INV_L2LStatusRSP },
+   { INV_DCBusStatusRSP_CANID | 0x80000000U,  100U, 40U, ReportMgr_MessageRouter_INV_DCBusStatusRSP },
+   { INV_StateRSP_CANID | 0x80000000U,        100U, 60U, ReportMgr_MessageRouter_INV_StateRSP },
+   { INV_TemperaturesRSP_CANID | 0x80000000U, 1000U, 80U, ReportMgr_MessageRouter_INV_TemperaturesRSP },
+};
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
@@ -20,6 +20,14 @@ extern "C"
 // Other Includes
 
 
+/*******************************************************************************
+// Constants
+*******************************************************************************/
+
+// The maximum age of a cached measurement response
+#define REPORTMGR_MEASUREMENT_CACHE_MAX_AGE_MS (10U)
+
+
 /*******************************************************************************
 // Message Router Table
 *******************************************************************************/
@@ -28,23 +36,30 @@ extern "C"
 // is to link each Command ID to its corresponding message handler function
 static const Lunar_MessageRouter_CommandTableItem_t ReportMgr_messageTable[] =
 {
-   // {Command ID, Message Handler Function Pointer}
+   // {Command ID, Message Handler Function Pointer, Cache Max Age (ms)}
    // Note that the Command IDs are currently aligned with the auto-generated ReportMgr_CAN.h file
    // Only the LSB of the CAN ID is used for the Command ID
-   { (uint8_t)INV_L2NStatusRSP_CANID, ReportMgr_MessageRouter_INV_L2NStatusRSP },
-   { (uint8_t)INV_L2LStatusRSP_CANID, ReportMgr_MessageRouter_INV_L2LStatusRSP },
-   { (uint8_t)INV_DCBusStatusRSP_CANID, ReportMgr_MessageRouter_INV_DCBusStatusRSP },
-   { (uint8_t)INV_TemperaturesRSP_CANID, ReportMgr_MessageRouter_INV_TemperaturesRSP },   
-   { (uint8_t)INV_StateRSP_CANID, ReportMgr_MessageRouter_INV_StateRSP },
+   // Measurements may be a few milliseconds old, the state must always be current
+   { (uint8_t)INV_L2NStatusRSP_CANID, ReportMgr_MessageRouter_INV_L2NStatusRSP, REPORTMGR_MEASUREMENT_CACHE_MAX_AGE_MS },
+   { (uint8_t)INV_L2LStatusRSP_CANID, ReportMgr_MessageRouter_INV_L2LStatusRSP, REPORTMGR_MEASUREMENT_CACHE_MAX_AGE_MS },
+   { (uint8_t)INV_DCBusStatusRSP_CANID, ReportMgr_MessageRouter_INV_DCBusStatusRSP, REPORTMGR_MEASUREMENT_CACHE_MAX_AGE_MS },
+   { (uint8_t)INV_TemperaturesRSP_CANID, ReportMgr_MessageRouter_INV_TemperaturesRSP, REPORTMGR_MEASUREMENT_CACHE_MAX_AGE_MS },   
+   { (uint8_t)INV_StateRSP_CANID, ReportMgr_MessageRouter_INV_StateRSP, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { (uint8_t)INV_ErrorStatusRSP_CANID, ReportMgr_MessageRouter_INV_ErrorStatusRSP, LUNAR_MESSAGEROUTER_CACHE_NEVER },
 };
 
 // This table provides provides handlers for Battery Block messages
 static const Lunar_MessageRouter_CommandTableItem_t ReportMgr_messageTableBattery[] =
 {
-   // {Command ID, Message Handler Function Pointer}
+   // {Command ID, Message Handler Function Pointer, Cache Max Age (ms)}
    // Note that the Command IDs are currently aligned with the auto-generated ReportMgr_CAN.h file
    // Only the LSB of the CAN ID is used for the Command ID
-   { (uint8_t)BB_BatteryStatusRSP_CANID, ReportMgr_MessageRouter_BB_BatteryStatusRSP },
+   // These are the reports of the blocks, which carry parameters and are never cached
+   { (uint8_t)BB_BatteryStatusRSP_CANID, ReportMgr_MessageRouter_BB_BatteryStatusRSP, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { (uint8_t)BB_CellVoltage1to4RSP_CANID, ReportMgr_MessageRouter_BB_CellVoltage1to4RSP, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { (uint8_t)BB_CellVoltage5to8RSP_CANID, ReportMgr_MessageRouter_BB_CellVoltage5to8RSP, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { (uint8_t)BB_CellVoltage9to12RSP_CANID, ReportMgr_MessageRouter_BB_CellVoltage9to12RSP, LUNAR_MESSAGEROUTER_CACHE_NEVER },
+   { (uint8_t)BB_ErrorStatusRSP_CANID, ReportMgr_MessageRouter_BB_ErrorStatusRSP, LUNAR_MESSAGEROUTER_CACHE_NEVER },
 };
 
 #ifdef __cplusplus
@@ -14,6 +14,7 @@ extern "C"
 // Module Includes
 #include "CAN_Drv_Config.h" // For channel enumeration
 // Platform Includes
+#include "Lunar_MessageRouter.h"
 #include "Platform.h"
 // Other Includes
 #include <stdbool.h> // Boolean types
@@ -24,11 +25,35 @@ extern "C"
 // Public Constant Definitions
 *******************************************************************************/
 
+// Identifier flag that selects a 29-bit extended CAN identifier
+#define CAN_DRV_EXTENDED_ID (0x80000000U)
+
+// The maximum number of data bytes in a single CAN frame
+#define CAN_DRV_MAX_DATA_LENGTH (8U)
+
 
 /*******************************************************************************
 // Public Type Declarations
 *******************************************************************************/
 
+// This structure defines a single received CAN frame
+typedef struct
+{
+   // The CAN identifier, bit 31 is set for a 29-bit extended identifier
+   uint32_t canId;
+
+   // Timebase_Drv_GetCycleCount value when the frame was read from the hardware
+   // or, for frames that are sent, when the frame was queued
+   uint32_t timestamp;
+
+   // The frame data
+   // Message handlers read their parameters from here, so this must stay 32-bit aligned
+   uint8_t data[CAN_DRV_MAX_DATA_LENGTH];
+
+   // The number of valid bytes in data (0-8)
+   uint8_t length;
+} CAN_Drv_Frame_t;
+
 
 /*******************************************************************************
 // Public Function Declarations
@@ -44,48 +69,202 @@ extern "C"
 void CAN_Drv_Init(void);
 
 /** Description:
-  *    This is the scheduled update function that will check the message object
-  *    for a new command.  If found, the corresponding command will be
-  *    executed via a call to the Message Router module.
+  *    This is the scheduled update function that moves queued frames into
+  *    the transmit message objects freed since the last call.  Received
+  *    frames are routed by the CAN transport (Lunar_CANTransport).
   * History: 
   *    * 6/18/2021: Function created (EJH)
+  *    * 10/19/2026: Process every waiting frame, periodic report moved to ReportMgr (EJH)
+  *    * 10/19/2026: Read from the receive ring and measure the latency (EJH)
+  *    * 10/19/2026: Message routing moved to Lunar_CANTransport (EJH)
+  *    * 10/19/2026: Sample the node error state and calculate the bus load (EJH)
   *                                                              
 */
 void CAN_Drv_Update(void);
 
 /** Description:
-  *    This function is called to transmit a single data packet over CAN.
-  *    The data that is passed into this function will be placed into the message object
-  *    for sending on the bus.
-  * Parameters: 
+  *    This function queues a single frame and returns without waiting for
+  *    the bus.  Queued frames are sent in identifier order, so the frame with
+  *    the highest bus priority goes first.  A frame that is still queued
+  *    with the same identifier is replaced by the new data.  The frame is
+  *    not queued if the queue is full of higher priority frames, so the
+  *    caller is expected to retry later with its newest data.
+  * Parameters:
   *    channel - The configured CAN channel that is to be written
+  *    canId - The CAN identifier, bit 31 selects a 29-bit extended identifier
   *    data - A pointer to the data that is to be sent
-  *    length - The number of bytes in the data buffer that is to be sent
-  * History: 
-  *    * 6/18/2021: Function created (EJH)
-  *                                                              
+  *    length - The number of bytes in the data buffer (0-8)
+  * Returns:
+  *    bool - true if the frame was queued for transmission
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *    * 10/19/2026: Queue in the transmit FIFO (EJH)
+  *    * 10/19/2026: Queue in identifier order (EJH)
+  *
 */
-void CAN_Drv_TransmitPacket(const CAN_Drv_Channel_t channel, uint8_t *const data, uint8_t const length) PLATFORM_NON_NULL;
+bool CAN_Drv_StartTransmitFrame(const CAN_Drv_Channel_t channel, const uint32_t canId, const uint8_t *const data, const uint8_t length) PLATFORM_NON_NULL;
 
 /** Description:
-  *    This function is called to receive a single data packet from the CAN
-  *    message object. The data that is passed into this function will be placed into 
-  *    the Message Router object for processing.
-  * Parameters: 
-  *    channel - The configured CAN channel that is to be written
-  *    data - A pointer where the data is to be placed.  Not that this buffer must be 
-  *    large enough to hold an entire CAN data message (8 bytes).
-  *    length - The pointer where the received number of bytes is to be placed.
+  *    This function checks if a frame with the given identifier is queued or
+  *    waiting in a transmit message object.  A queued frame is replaced by
+  *    the next frame with the same identifier and frames in different
+  *    message objects may be sent in any order, so a sender of a sequence of
+  *    frames with one identifier must wait until this returns false.
+  * Parameters:
+  *    channel - The configured CAN channel that is to be checked
+  *    canId - The CAN identifier, bit 31 selects a 29-bit extended identifier
+  * Returns:
+  *    bool - true if a frame with the identifier has not been sent yet
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+bool CAN_Drv_IsTransmitPending(const CAN_Drv_Channel_t channel, const uint32_t canId);
+
+/** Description:
+  *    This function arms the capture of the time the next frame with the
+  *    given identifier is sent.  The time is taken in the interrupt of the
+  *    completed frame, so it marks the end of the frame on the bus as
+  *    closely as the receive timestamps of other nodes.  Only a single
+  *    identifier is captured at a time, arming again replaces it.
+  * Parameters:
+  *    channel - The configured CAN channel of the frame
+  *    canId - The CAN identifier, bit 31 selects a 29-bit extended identifier
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void CAN_Drv_StartTransmitTimeCapture(const CAN_Drv_Channel_t channel, const uint32_t canId);
+
+/** Description:
+  *    This function returns the time captured for the frame given to
+  *    CAN_Drv_StartTransmitTimeCapture once the frame was sent.
+  * Parameters:
+  *    channel - The configured CAN channel of the frame
+  *    timestamp - The Timebase_Drv_GetCycleCount value when the frame was sent
+  * Returns:
+  *    bool - true if the frame was sent and timestamp was set
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+bool CAN_Drv_GetTransmitTime(const CAN_Drv_Channel_t channel, uint32_t *const timestamp) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function reads the next frame from the receive ring.  The
+  *    receive interrupt moves frames from the hardware FIFOs into the ring.
+  *    Only frames that pass one of the filters in canFilterConfigTable are
+  *    received.  The FIFOs are read in turn, so frames of different filters
+  *    are not returned in the order they arrived.  Only a single task may
+  *    call this function.
+  * Parameters:
+  *    channel - The configured CAN channel that is to be read
+  *    frame - The location where the received frame is to be placed
   * Returns:
   *    bool - The result of the receive operation
   * Return Value List:
-  *    true - A message was received successfully and the data was placed in the given buffer.
-  *    false - No mesasage was received.
-  * History: 
-  *    * 6/18/2021: Function created (EJH)
-  *                                                              
+  *    true - A frame was received and placed in the given frame.
+  *    false - No frame was waiting.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *    * 10/19/2026: Read from the receive ring (EJH)
+  *
+*/
+bool CAN_Drv_ReceiveFrame(const CAN_Drv_Channel_t channel, CAN_Drv_Frame_t *const frame) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function returns the oldest frame in the receive ring without
+  *    copying it.  The frame stays owned by the caller, who may also write
+  *    to it, until CAN_Drv_ReleaseFrame is called.  The time from reception
+  *    to this call is recorded as the receive latency.  Only a single task
+  *    may read the ring.
+  * Parameters:
+  *    channel - The configured CAN channel that is to be read
+  * Returns:
+  *    CAN_Drv_Frame_t * - The oldest received frame, 0 if no frame is waiting
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+CAN_Drv_Frame_t *CAN_Drv_PeekFrame(const CAN_Drv_Channel_t channel);
+
+/** Description:
+  *    This function removes the frame returned by CAN_Drv_PeekFrame from the
+  *    receive ring, so its entry can be reused by the receive interrupt.
+  * Parameters:
+  *    channel - The configured CAN channel that was read
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void CAN_Drv_ReleaseFrame(const CAN_Drv_Channel_t channel);
+
+/** Description:
+  *    This function retrieves the traffic statistics: the frames and bits
+  *    received and sent in total and in the last second, the bus load and
+  *    the frames that were lost, dropped or replaced.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void CAN_Drv_MessageRouter_GetTrafficStatistics(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function retrieves the transmit latency percentiles, from queueing
+  *    until the frame was sent, and the receive latency, from reception until
+  *    the frame was read.  All values are in microseconds.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void CAN_Drv_MessageRouter_GetLatencyStatistics(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function retrieves the node error counters, the node state and
+  *    the number of bus errors, error warnings and bus-off events.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void CAN_Drv_MessageRouter_GetErrorStatistics(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function retrieves the number of frames received and sent with a
+  *    single identifier.  The command holds the index in the identifier
+  *    table, an unused entry returns identifier 0.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void CAN_Drv_MessageRouter_GetIdStatistics(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function clears all statistics, including the identifier table.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
 */
-bool CAN_Drv_ReceivePacket(const CAN_Drv_Channel_t channel, uint8_t *const data, uint8_t *const length) PLATFORM_NON_NULL;
+void CAN_Drv_MessageRouter_ResetStatistics(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
 
 
 #ifdef __cplusplus
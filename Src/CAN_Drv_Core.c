@@ -0,0 +1,1163 @@
+/*******************************************************************************
+// CAN Driver Core
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "CAN_Drv_Core.h" // Core and device functions
+#include "CAN_Drv.h" // Driver API
+#include "CAN_Drv_Config.h" // Channel enumeration
+// Platform Includes
+#include "Lunar_MessageRouter.h"
+#include "Platform.h"
+#include "Timebase_Drv.h"
+// Other Includes
+#include <string.h> // memset
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// Bits in a frame besides the data: start of frame, arbitration, control,
+// CRC, acknowledge, end of frame and intermission.  Stuff bits are not counted.
+#define STANDARD_FRAME_OVERHEAD_BITS (47U)
+#define EXTENDED_FRAME_OVERHEAD_BITS (67U)
+
+// Number of buckets in the transmit latency histogram
+#define NUM_TX_LATENCY_BUCKETS (12U)
+
+// Upper limit of the first transmit latency bucket in CPU cycles, each
+// following bucket covers twice the time of the one before
+#define FIRST_TX_LATENCY_BUCKET_CYCLES (4096U)
+
+// The interval used to calculate the frame rates and the bus load
+#define RATE_INTERVAL_MS (1000U)
+
+// Bus load is reported in tenths of a percent
+#define BUS_LOAD_FULL_SCALE (1000U)
+
+// Bits of the longest frame on the bus, an extended frame with 8 data bytes
+// and the most stuff bits.  A frame that started before an abort request is
+// complete after this time.
+#define MAX_FRAME_BITS (160U)
+
+// Position of the fields of an identifier in the order of the arbitration
+// field: the 11 base identifier bits, SRR and IDE, then the 18 extension bits
+#define PRIORITY_BASE_ID_SHIFT (19U)
+#define PRIORITY_IDE_BIT (1UL << 18U)
+#define EXTENDED_ID_BASE_SHIFT (18U)
+#define BASE_ID_MASK (0x7FFU)
+#define ID_EXTENSION_MASK (0x3FFFFU)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// Struct that defines TX/RX statistics used for debugging and testing
+typedef struct
+{
+    // The number of CAN frames received by the driver
+    uint32_t numFramesReceived;
+
+    // The number of CAN frames sent by the driver
+    uint32_t numFramesSent;
+
+    // The number of received frames overwritten before they were read
+    uint32_t numFramesLost;
+
+    // The number of frames refused because the transmit queue was full
+    uint32_t numTxQueueFull;
+
+    // The number of queued frames replaced by a newer frame
+    uint32_t numTxReplaced;
+
+    // The number of frames aborted for a higher priority frame
+    uint32_t numTxAborted;
+
+    // The number of received frames dropped because the receive ring was full
+    uint32_t numRxRingOverflows;
+
+    // CPU cycles from reception of the last frame until it was read from the ring
+    uint32_t lastRxLatencyCycles;
+
+    // The longest reception to read latency seen, in CPU cycles
+    uint32_t maxRxLatencyCycles;
+
+    // The number of bits received and sent, estimated from the identifier type and length
+    uint32_t numRxBits;
+    uint32_t numTxBits;
+
+    // The number of sent frames that waited for frames of other nodes,
+    // because they lost arbitration or the bus was busy.  The controller
+    // does not report lost arbitration itself.
+    uint32_t numTxArbitrationDelays;
+
+    // Time from queueing until the frame was sent, bucket i counts latencies
+    // below FIRST_TX_LATENCY_BUCKET_CYCLES << i, the last bucket all above
+    uint32_t txLatencyHistogram[NUM_TX_LATENCY_BUCKETS];
+
+    // The longest queueing to sent latency seen, in CPU cycles
+    uint32_t maxTxLatencyCycles;
+
+    // Rates of the last complete RATE_INTERVAL_MS
+    uint32_t rxBitsPerSecond;
+    uint32_t txBitsPerSecond;
+    uint16_t rxFramesPerSecond;
+    uint16_t txFramesPerSecond;
+    uint16_t busLoad;
+    uint16_t peakBusLoad;
+
+    // Node error counters sampled by the update function and their highest values
+    uint8_t transmitErrorCount;
+    uint8_t receiveErrorCount;
+    uint8_t maxTransmitErrorCount;
+    uint8_t maxReceiveErrorCount;
+
+    // The last bus error code (LEC) seen by the node, 0 for no error
+    uint8_t lastErrorCode;
+
+    // Node state flags
+    bool isBusOff;
+    bool isErrorWarning;
+
+    // The number of update intervals that saw a bus error
+    uint32_t numBusErrors;
+
+    // The number of times the error counters reached the warning limit
+    uint32_t numErrorWarnings;
+
+    // The number of times the node went bus-off and recovered
+    uint32_t numBusOffEvents;
+    uint32_t numBusOffRecoveries;
+
+    // The number of frames of identifiers that did not fit in the identifier table
+    uint32_t numUntrackedFrames;
+} TxRxStatistics_t;
+
+// Struct that counts the frames of a single identifier
+typedef struct
+{
+   // The CAN identifier, 0 while the entry is unused
+   uint32_t canId;
+
+   // The number of frames received and sent with the identifier
+   uint32_t numReceived;
+   uint32_t numSent;
+} IdStatistics_t;
+
+// This structure holds the frame loaded in a transmit message object
+typedef struct
+{
+   // The identifier of the frame
+   uint32_t canId;
+
+   // The tick count when the object was loaded
+   uint32_t loadTime;
+
+   // Cycle count when the frame was queued and loaded
+   uint32_t queueCycles;
+   uint32_t loadCycles;
+
+   // Cycle count when the abort of the frame was requested
+   uint32_t abortCycles;
+
+   // The data length of the frame
+   uint8_t length;
+
+   // true from the abort request until the object may be loaded again
+   bool isAbortRequested;
+} TxObject_t;
+
+// This structure holds the private information for this module
+typedef struct
+{
+   // Frames waiting for a transmit message object, sorted by bus priority
+   // The first entry holds the frame that wins the arbitration
+   CAN_Drv_Frame_t txQueue[CAN_DRV_TX_QUEUE_SIZE];
+
+   // The number of frames in txQueue
+   uint8_t txQueueCount;
+
+   // The frame loaded in each transmit message object
+   TxObject_t txObjects[CAN_DRV_NUM_TX_MSG_OBJS];
+
+   // Cycle count when the last frame of this node was sent
+   uint32_t lastTxCompleteCycles;
+
+   // The identifier whose transmit time is captured and the captured cycle count
+   uint32_t txCaptureCanId;
+   uint32_t txCaptureCycles;
+
+   // true while waiting for the captured frame and once it was sent
+   bool isTxCaptureArmed;
+   volatile bool isTxCaptured;
+
+   // The bit rate of the bus and the CPU cycles per bit
+   uint32_t baudrate;
+   uint32_t cyclesPerBit;
+
+   // Frames moved out of the device by the receive interrupt
+   CAN_Drv_Frame_t rxRing[CAN_DRV_RX_RING_SIZE];
+
+   // Index of the next ring entry to be written, only changed by the interrupt
+   volatile uint8_t rxRingHead;
+
+   // Index of the next ring entry to be read, only changed by the task
+   volatile uint8_t rxRingTail;
+
+   // Stats for transmit and receive data
+   TxRxStatistics_t statistics;
+
+   // Frame counts of the first identifiers seen
+   IdStatistics_t idStatistics[CAN_DRV_NUM_ID_STATISTICS];
+
+   // Start of the current rate interval and the totals at that time
+   uint32_t rateIntervalStartTime;
+   uint32_t rateNumFramesReceived;
+   uint32_t rateNumFramesSent;
+   uint32_t rateNumRxBits;
+   uint32_t rateNumTxBits;
+} CAN_Drv_Core_Status_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// Status structure for this module
+static CAN_Drv_Core_Status_t status;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function adds a frame to the transmit queue in bus priority
+  *    order.  A queued frame with the same identifier is replaced, so only
+  *    the newest data is sent.  When the queue is full, the lowest priority
+  *    frame is dropped if the new frame has a higher priority.
+  * Parameters:
+  *    frame :  The frame to be queued
+  * Returns:
+  *    bool - true if the frame was queued
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *    * 10/19/2026: Sort by the arbitration order (EJH)
+  *
+*/
+static bool EnqueueTxFrame(const CAN_Drv_Frame_t *const frame) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function counts a frame in the identifier table.  A new
+  *    identifier takes the next unused entry, frames of identifiers that do
+  *    not fit are only counted in total.
+  * Parameters:
+  *    canId :  The identifier of the frame
+  *    isSent :  true for a sent frame, false for a received frame
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void CountIdFrame(const uint32_t canId, const bool isSent);
+
+/** Description:
+  *    This function finds the latency below which the given share of the sent
+  *    frames was, using the upper limit of the histogram bucket.
+  * Parameters:
+  *    percentile :  The share of the frames in percent (1-100)
+  * Returns:
+  *    uint32_t - The latency in microseconds, 0 if no frame was sent
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint32_t GetTxLatencyPercentile(const uint8_t percentile);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Add a frame to the transmit queue
+static bool EnqueueTxFrame(const CAN_Drv_Frame_t *const frame)
+{
+   const uint32_t key = CAN_Drv_Core_GetPriorityKey(frame->canId);
+   bool queued = false;
+   uint8_t position = 0U;
+
+   // Find the first entry with the same or a lower priority
+   while ((position < status.txQueueCount) && (CAN_Drv_Core_GetPriorityKey(status.txQueue[position].canId) < key))
+   {
+      position++;
+   }
+
+   if ((position < status.txQueueCount) && (status.txQueue[position].canId == frame->canId))
+   {
+      // The waiting frame is stale, send the newest data in its place
+      status.txQueue[position] = *frame;
+      status.statistics.numTxReplaced++;
+      queued = true;
+   }
+   else if (position < CAN_DRV_TX_QUEUE_SIZE)
+   {
+      // Drop the lowest priority frame if there is no room
+      if (status.txQueueCount >= CAN_DRV_TX_QUEUE_SIZE)
+      {
+         status.txQueueCount--;
+         status.statistics.numTxQueueFull++;
+      }
+
+      // Make room at the position
+      for (uint8_t i = status.txQueueCount; i > position; i--)
+      {
+         status.txQueue[i] = status.txQueue[i - 1U];
+      }
+
+      status.txQueue[position] = *frame;
+      status.txQueueCount++;
+      queued = true;
+   }
+   else
+   {
+      // Every queued frame has a higher priority
+      status.statistics.numTxQueueFull++;
+   }
+
+   return(queued);
+}
+
+// Count a frame of a single identifier
+static void CountIdFrame(const uint32_t canId, const bool isSent)
+{
+   IdStatistics_t *entry = 0;
+
+   // The table is short and fills in the order the identifiers are first seen
+   for (uint8_t i = 0U; (i < CAN_DRV_NUM_ID_STATISTICS) && (entry == 0); i++)
+   {
+      if (status.idStatistics[i].canId == canId)
+      {
+         entry = &status.idStatistics[i];
+      }
+      else if (status.idStatistics[i].canId == 0U)
+      {
+         // First unused entry, the identifier was not seen before
+         status.idStatistics[i].canId = canId;
+         entry = &status.idStatistics[i];
+      }
+      else
+      {
+         // Entry belongs to another identifier
+      }
+   }
+
+   if (entry == 0)
+   {
+      status.statistics.numUntrackedFrames++;
+   }
+   else if (isSent)
+   {
+      entry->numSent++;
+   }
+   else
+   {
+      entry->numReceived++;
+   }
+}
+
+// Find a transmit latency percentile from the histogram
+static uint32_t GetTxLatencyPercentile(const uint8_t percentile)
+{
+   uint32_t numFrames = 0U;
+   uint32_t latencyCycles = 0U;
+
+   for (uint8_t bucket = 0U; bucket < NUM_TX_LATENCY_BUCKETS; bucket++)
+   {
+      numFrames += status.statistics.txLatencyHistogram[bucket];
+   }
+
+   if (numFrames > 0U)
+   {
+      // The number of frames at or below the percentile, rounded up
+      const uint32_t target = (uint32_t)((((uint64_t)numFrames * percentile) + 99U) / 100U);
+      uint32_t count = status.statistics.txLatencyHistogram[0];
+      uint32_t bucketLimit = FIRST_TX_LATENCY_BUCKET_CYCLES;
+      uint8_t bucket = 0U;
+
+      while ((count < target) && (bucket < (NUM_TX_LATENCY_BUCKETS - 1U)))
+      {
+         bucket++;
+         bucketLimit <<= 1U;
+         count += status.statistics.txLatencyHistogram[bucket];
+      }
+
+      // The last bucket has no upper limit and no latency was above the maximum
+      latencyCycles = bucketLimit;
+      if ((bucket == (NUM_TX_LATENCY_BUCKETS - 1U)) || (status.statistics.maxTxLatencyCycles < bucketLimit))
+      {
+         latencyCycles = status.statistics.maxTxLatencyCycles;
+      }
+   }
+
+   return(latencyCycles / (Timebase_Drv_GetCyclesPerSecond() / 1000000U));
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+//-----------------------------------------------
+// Core Functions
+//-----------------------------------------------
+
+// Clear the queue, the ring and the statistics
+void CAN_Drv_Core_Init(const uint32_t baudrate)
+{
+   memset(&status, 0, sizeof(status));
+
+   status.baudrate = baudrate;
+   status.cyclesPerBit = Timebase_Drv_GetCyclesPerSecond() / baudrate;
+   status.lastTxCompleteCycles = Timebase_Drv_GetCycleCount();
+   status.rateIntervalStartTime = Timebase_Drv_GetCurrentTickCount();
+}
+
+// Move queued frames into the transmit message objects
+void CAN_Drv_Core_ServiceTxQueue(void)
+{
+   const uint32_t abortCycles = MAX_FRAME_BITS * status.cyclesPerBit;
+   bool isAbortWaiting = false;
+   bool objectFound = true;
+
+   // Free the objects whose abort took effect
+   for (uint8_t index = 0U; index < CAN_DRV_NUM_TX_MSG_OBJS; index++)
+   {
+      TxObject_t *object = &status.txObjects[index];
+
+      if (object->isAbortRequested)
+      {
+         // The frame may have started before the request, only the end of the
+         // longest frame tells if it was sent.  A sent frame cleared the flag.
+         if ((!CAN_Drv_Device_IsTxObjectBusy(index)) && ((Timebase_Drv_GetCycleCount() - object->abortCycles) >= abortCycles))
+         {
+            if (object->isAbortRequested)
+            {
+               status.statistics.numTxAborted++;
+               object->isAbortRequested = false;
+            }
+         }
+         else
+         {
+            isAbortWaiting = true;
+         }
+      }
+   }
+
+   // Load the highest priority frames first
+   while ((status.txQueueCount > 0U) && (objectFound))
+   {
+      const CAN_Drv_Frame_t *frame = &status.txQueue[0];
+      const uint32_t key = CAN_Drv_Core_GetPriorityKey(frame->canId);
+      uint32_t currentTime = Timebase_Drv_GetCurrentTickCount();
+      uint8_t numUsableObjects = CAN_DRV_NUM_TX_MSG_OBJS - CAN_DRV_NUM_RESERVED_TX_MSG_OBJS;
+      uint8_t lowestPriorityIndex = 0U;
+      uint8_t freeIndex = 0U;
+
+      // Only high priority frames may use the reserved objects
+      if (key < CAN_Drv_Core_GetPriorityKey(CAN_DRV_TX_RESERVED_ID_LIMIT))
+      {
+         numUsableObjects = CAN_DRV_NUM_TX_MSG_OBJS;
+      }
+
+      objectFound = false;
+      for (uint8_t index = 0U; (index < numUsableObjects) && (!objectFound); index++)
+      {
+         if (status.txObjects[index].isAbortRequested)
+         {
+            // The object is freed once the abort took effect
+         }
+         else if (!CAN_Drv_Device_IsTxObjectBusy(index))
+         {
+            freeIndex = index;
+            objectFound = true;
+         }
+         else if ((status.txObjects[lowestPriorityIndex].isAbortRequested) ||
+                  (CAN_Drv_Core_GetPriorityKey(status.txObjects[index].canId) > CAN_Drv_Core_GetPriorityKey(status.txObjects[lowestPriorityIndex].canId)))
+         {
+            lowestPriorityIndex = index;
+         }
+         else
+         {
+            // This object holds a higher priority frame
+         }
+      }
+
+      // Without a free object, abort a lower priority frame that waited too long
+      // The aborted frame is dropped, a newer one follows in its next cycle
+      // The object is loaded by a later call, once the abort took effect
+      if ((!objectFound) && (!isAbortWaiting) &&
+          (!status.txObjects[lowestPriorityIndex].isAbortRequested) &&
+          (CAN_Drv_Core_GetPriorityKey(status.txObjects[lowestPriorityIndex].canId) > key) &&
+          ((currentTime - status.txObjects[lowestPriorityIndex].loadTime) >= (CAN_DRV_TX_ABORT_TIME_MS * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND)))
+      {
+         // The interrupt must not complete the frame between the flag and the request
+         uint32_t interruptState = CAN_Drv_Device_DisableInterrupts();
+
+         status.txObjects[lowestPriorityIndex].isAbortRequested = true;
+         status.txObjects[lowestPriorityIndex].abortCycles = Timebase_Drv_GetCycleCount();
+         CAN_Drv_Device_AbortTxObject(lowestPriorityIndex);
+
+         CAN_Drv_Device_RestoreInterrupts(interruptState);
+         isAbortWaiting = true;
+      }
+
+      if (objectFound)
+      {
+         // The interrupt must not see the object between the frames
+         uint32_t interruptState = CAN_Drv_Device_DisableInterrupts();
+         TxObject_t *object = &status.txObjects[freeIndex];
+
+         object->canId = frame->canId;
+         object->loadTime = currentTime;
+         object->queueCycles = frame->timestamp;
+         object->loadCycles = Timebase_Drv_GetCycleCount();
+         object->length = frame->length;
+         CAN_Drv_Device_LoadTxObject(freeIndex, frame);
+
+         CAN_Drv_Device_RestoreInterrupts(interruptState);
+
+         // Remove the frame from the queue
+         status.txQueueCount--;
+         for (uint8_t i = 0U; i < status.txQueueCount; i++)
+         {
+            status.txQueue[i] = status.txQueue[i + 1U];
+         }
+      }
+   }
+}
+
+// Count a frame that was sent from a transmit message object
+void CAN_Drv_Core_HandleTxComplete(const uint8_t index, const uint32_t completeCycles)
+{
+   TxObject_t *const object = &status.txObjects[index];
+   const uint32_t frameBits = CAN_Drv_Core_GetFrameBits(object->canId, object->length);
+   const uint32_t latency = completeCycles - object->queueCycles;
+   uint32_t readyCycles = object->loadCycles;
+   uint32_t bucketLimit = FIRST_TX_LATENCY_BUCKET_CYCLES;
+   uint8_t bucket = 0U;
+
+   // Increment the sent value in statistics
+   // Note this value is expected to wrap eventually
+   status.statistics.numFramesSent++;
+   status.statistics.numTxBits += frameBits;
+   CountIdFrame(object->canId, true);
+
+   // The frame started before its abort was requested, so it was not aborted
+   object->isAbortRequested = false;
+
+   // Find the histogram bucket of the latency
+   while ((bucket < (NUM_TX_LATENCY_BUCKETS - 1U)) && (latency >= bucketLimit))
+   {
+      bucket++;
+      bucketLimit <<= 1U;
+   }
+   status.statistics.txLatencyHistogram[bucket]++;
+   status.statistics.maxTxLatencyCycles = PLATFORM_MAX(status.statistics.maxTxLatencyCycles, latency);
+
+   // Waiting for a frame of this node is not counted, so start when the last one ended
+   if ((int32_t)(status.lastTxCompleteCycles - readyCycles) > 0)
+   {
+      readyCycles = status.lastTxCompleteCycles;
+   }
+
+   // Allow for the interrupt latency before calling the wait a delay by other nodes
+   if ((completeCycles - readyCycles) > (2U * frameBits * status.cyclesPerBit))
+   {
+      status.statistics.numTxArbitrationDelays++;
+   }
+   status.lastTxCompleteCycles = completeCycles;
+
+   // Note the time of a frame that is used to align the time of other nodes
+   if ((status.isTxCaptureArmed) && (object->canId == status.txCaptureCanId))
+   {
+      status.txCaptureCycles = completeCycles;
+      status.isTxCaptureArmed = false;
+      status.isTxCaptured = true;
+   }
+}
+
+// Count a received frame and store it in the receive ring
+bool CAN_Drv_Core_HandleRxFrame(const CAN_Drv_Frame_t *const frame)
+{
+   bool isStored = false;
+   uint8_t head = status.rxRingHead;
+   uint8_t nextHead = head + 1U;
+
+   if (nextHead >= CAN_DRV_RX_RING_SIZE)
+   {
+      nextHead = 0U;
+   }
+
+   // Increment the number of frames in the statistics
+   // This value will wrap eventually
+   status.statistics.numFramesReceived++;
+   status.statistics.numRxBits += CAN_Drv_Core_GetFrameBits(frame->canId, frame->length);
+   CountIdFrame(frame->canId, false);
+
+   // One entry stays free to tell a full ring from an empty one
+   if (nextHead != status.rxRingTail)
+   {
+      // The SysTick preempts the receive interrupt, see SYSTICK_DRV_IRQ_PRIORITY,
+      // so the cycle count of the XMC1 does not lag behind
+      status.rxRing[head] = *frame;
+      status.rxRing[head].length = PLATFORM_MIN(frame->length, (uint8_t)CAN_DRV_MAX_DATA_LENGTH);
+      status.rxRing[head].timestamp = Timebase_Drv_GetCycleCount();
+
+      // Publish the entry only after it was written
+      CAN_Drv_Device_MemoryBarrier();
+      status.rxRingHead = nextHead;
+      isStored = true;
+   }
+   else
+   {
+      status.statistics.numRxRingOverflows++;
+   }
+
+   return(isStored);
+}
+
+// Count a frame lost by the device
+void CAN_Drv_Core_CountLostFrame(void)
+{
+   status.statistics.numFramesLost++;
+}
+
+// Count the errors and state changes of the node
+bool CAN_Drv_Core_UpdateNodeStatistics(const uint8_t transmitErrorCount, const uint8_t receiveErrorCount, const uint8_t lastErrorCode,
+                                       const bool isBusOff, const bool isErrorWarning)
+{
+   bool isBusError = false;
+
+   status.statistics.transmitErrorCount = transmitErrorCount;
+   status.statistics.receiveErrorCount = receiveErrorCount;
+   status.statistics.maxTransmitErrorCount = PLATFORM_MAX(status.statistics.maxTransmitErrorCount, transmitErrorCount);
+   status.statistics.maxReceiveErrorCount = PLATFORM_MAX(status.statistics.maxReceiveErrorCount, receiveErrorCount);
+
+   // Error codes 1-6 are bus errors, 7 is only written by software
+   if ((lastErrorCode != 0U) && (lastErrorCode != 7U))
+   {
+      status.statistics.lastErrorCode = lastErrorCode;
+      status.statistics.numBusErrors++;
+      isBusError = true;
+   }
+
+   if (isErrorWarning && (!status.statistics.isErrorWarning))
+   {
+      status.statistics.numErrorWarnings++;
+   }
+   status.statistics.isErrorWarning = isErrorWarning;
+
+   if (isBusOff && (!status.statistics.isBusOff))
+   {
+      status.statistics.numBusOffEvents++;
+   }
+   else if ((!isBusOff) && status.statistics.isBusOff)
+   {
+      status.statistics.numBusOffRecoveries++;
+   }
+   else
+   {
+      // No change of the bus-off state
+   }
+   status.statistics.isBusOff = isBusOff;
+
+   return(isBusError);
+}
+
+// Calculate the frame rates and bus load of the last interval
+void CAN_Drv_Core_UpdateRateStatistics(void)
+{
+   const uint32_t currentTime = Timebase_Drv_GetCurrentTickCount();
+   const uint32_t elapsedTicks = currentTime - status.rateIntervalStartTime;
+
+   if (elapsedTicks >= (RATE_INTERVAL_MS * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND))
+   {
+      // Totals are updated by the interrupt, so take a copy of each once
+      const uint32_t numFramesReceived = status.statistics.numFramesReceived;
+      const uint32_t numFramesSent = status.statistics.numFramesSent;
+      const uint32_t numRxBits = status.statistics.numRxBits;
+      const uint32_t numTxBits = status.statistics.numTxBits;
+      const uint32_t elapsedMs = elapsedTicks / TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND;
+      uint32_t busLoad;
+
+      status.statistics.rxFramesPerSecond = (uint16_t)(((numFramesReceived - status.rateNumFramesReceived) * 1000U) / elapsedMs);
+      status.statistics.txFramesPerSecond = (uint16_t)(((numFramesSent - status.rateNumFramesSent) * 1000U) / elapsedMs);
+      status.statistics.rxBitsPerSecond = (uint32_t)(((uint64_t)(numRxBits - status.rateNumRxBits) * 1000U) / elapsedMs);
+      status.statistics.txBitsPerSecond = (uint32_t)(((uint64_t)(numTxBits - status.rateNumTxBits) * 1000U) / elapsedMs);
+
+      // Both directions share the bus
+      busLoad = (uint32_t)(((uint64_t)(status.statistics.rxBitsPerSecond + status.statistics.txBitsPerSecond) * BUS_LOAD_FULL_SCALE) /
+                           status.baudrate);
+      status.statistics.busLoad = (uint16_t)PLATFORM_MIN(busLoad, BUS_LOAD_FULL_SCALE);
+      status.statistics.peakBusLoad = PLATFORM_MAX(status.statistics.peakBusLoad, status.statistics.busLoad);
+
+      status.rateIntervalStartTime = currentTime;
+      status.rateNumFramesReceived = numFramesReceived;
+      status.rateNumFramesSent = numFramesSent;
+      status.rateNumRxBits = numRxBits;
+      status.rateNumTxBits = numTxBits;
+   }
+}
+
+// Estimate the number of bits of a frame
+uint32_t CAN_Drv_Core_GetFrameBits(const uint32_t canId, const uint8_t length)
+{
+   uint32_t numBits = STANDARD_FRAME_OVERHEAD_BITS;
+
+   if ((canId & CAN_DRV_EXTENDED_ID) != 0U)
+   {
+      numBits = EXTENDED_FRAME_OVERHEAD_BITS;
+   }
+
+   return(numBits + ((uint32_t)length * 8U));
+}
+
+// Find the arbitration order of an identifier
+uint32_t CAN_Drv_Core_GetPriorityKey(const uint32_t canId)
+{
+   uint32_t key;
+
+   if ((canId & CAN_DRV_EXTENDED_ID) != 0U)
+   {
+      key = (((canId >> EXTENDED_ID_BASE_SHIFT) & BASE_ID_MASK) << PRIORITY_BASE_ID_SHIFT) | PRIORITY_IDE_BIT | (canId & ID_EXTENSION_MASK);
+   }
+   else
+   {
+      key = (canId & BASE_ID_MASK) << PRIORITY_BASE_ID_SHIFT;
+   }
+
+   return(key);
+}
+
+//-----------------------------------------------
+// Driver Functions
+//-----------------------------------------------
+
+// Queue a single CAN frame without waiting for the bus
+bool CAN_Drv_StartTransmitFrame(const CAN_Drv_Channel_t channel, const uint32_t canId, const uint8_t *const data, const uint8_t length)
+{
+   bool started = false;
+
+   // Verify the channel index and the frame length
+   if ((channel < CAN_DRV_CHANNEL_Count) && (length <= CAN_DRV_MAX_DATA_LENGTH))
+   {
+      CAN_Drv_Frame_t frame;
+
+      frame.canId = canId;
+      frame.timestamp = Timebase_Drv_GetCycleCount();
+      frame.length = length;
+      for (uint8_t byteIdx = 0U; byteIdx < length; byteIdx++)
+      {
+         frame.data[byteIdx] = data[byteIdx];
+      }
+
+      started = EnqueueTxFrame(&frame);
+
+      // Start the transmission right away if a message object is free
+      CAN_Drv_Core_ServiceTxQueue();
+   }
+
+   return(started);
+}
+
+// See if a frame with the given identifier has not been sent yet
+bool CAN_Drv_IsTransmitPending(const CAN_Drv_Channel_t channel, const uint32_t canId)
+{
+   bool pending = false;
+
+   if (channel < CAN_DRV_CHANNEL_Count)
+   {
+      // Frames still waiting in the queue
+      for (uint8_t i = 0U; (i < status.txQueueCount) && (!pending); i++)
+      {
+         pending = (status.txQueue[i].canId == canId);
+      }
+
+      // Frames loaded in a message object that has not been sent
+      for (uint8_t index = 0U; (index < CAN_DRV_NUM_TX_MSG_OBJS) && (!pending); index++)
+      {
+         pending = (status.txObjects[index].canId == canId) && CAN_Drv_Device_IsTxObjectBusy(index);
+      }
+   }
+
+   return(pending);
+}
+
+// Capture the transmit time of the next frame with the identifier
+void CAN_Drv_StartTransmitTimeCapture(const CAN_Drv_Channel_t channel, const uint32_t canId)
+{
+   if (channel < CAN_DRV_CHANNEL_Count)
+   {
+      // The transmit interrupt must not see a partly armed capture
+      uint32_t interruptState = CAN_Drv_Device_DisableInterrupts();
+
+      status.txCaptureCanId = canId;
+      status.isTxCaptured = false;
+      status.isTxCaptureArmed = true;
+
+      CAN_Drv_Device_RestoreInterrupts(interruptState);
+   }
+}
+
+// Get the captured transmit time
+bool CAN_Drv_GetTransmitTime(const CAN_Drv_Channel_t channel, uint32_t *const timestamp)
+{
+   bool captured = false;
+
+   if ((channel < CAN_DRV_CHANNEL_Count) && (status.isTxCaptured))
+   {
+      *timestamp = status.txCaptureCycles;
+      captured = true;
+   }
+
+   return(captured);
+}
+
+// Receive a single CAN frame, if available
+bool CAN_Drv_ReceiveFrame(const CAN_Drv_Channel_t channel, CAN_Drv_Frame_t *const frame)
+{
+   bool result = false;
+   CAN_Drv_Frame_t *const oldestFrame = CAN_Drv_PeekFrame(channel);
+
+   if (oldestFrame != 0)
+   {
+      *frame = *oldestFrame;
+      CAN_Drv_ReleaseFrame(channel);
+      result = true;
+   }
+
+   return(result);
+}
+
+
+// Get the oldest received frame without removing it
+CAN_Drv_Frame_t *CAN_Drv_PeekFrame(const CAN_Drv_Channel_t channel)
+{
+   CAN_Drv_Frame_t *frame = 0;
+
+   // Verify the channel index
+   // The ring is empty when the interrupt has not written past the read index
+   if ((channel < CAN_DRV_CHANNEL_Count) && (status.rxRingTail != status.rxRingHead))
+   {
+      frame = &status.rxRing[status.rxRingTail];
+
+      // Measure the time from reception to handling of the frame
+      uint32_t latency = Timebase_Drv_GetCycleCount() - frame->timestamp;
+      status.statistics.lastRxLatencyCycles = latency;
+      status.statistics.maxRxLatencyCycles = PLATFORM_MAX(status.statistics.maxRxLatencyCycles, latency);
+   }
+
+   return(frame);
+}
+
+
+// Remove the oldest received frame
+void CAN_Drv_ReleaseFrame(const CAN_Drv_Channel_t channel)
+{
+   uint8_t tail = status.rxRingTail;
+
+   // Verify the channel index and that a frame is waiting
+   if ((channel < CAN_DRV_CHANNEL_Count) && (tail != status.rxRingHead))
+   {
+      // Release the entry only after the caller is done with it
+      CAN_Drv_Device_MemoryBarrier();
+      tail++;
+      if (tail >= CAN_DRV_RX_RING_SIZE)
+      {
+         tail = 0U;
+      }
+      status.rxRingTail = tail;
+   }
+}
+
+
+/*******************************************************************************
+// Message Router Function Implementations
+*******************************************************************************/
+
+// Message handler to get the traffic statistics
+void CAN_Drv_MessageRouter_GetTrafficStatistics(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // Totals since the statistics were cleared
+      uint32_t numFramesReceived;
+      uint32_t numFramesSent;
+      // Rates of the last second, bits do not include stuff bits
+      uint32_t rxBitsPerSecond;
+      uint32_t txBitsPerSecond;
+      uint16_t rxFramesPerSecond;
+      uint16_t txFramesPerSecond;
+      // Bus load in tenths of a percent
+      uint16_t busLoad;
+      uint16_t peakBusLoad;
+      // Frames that were not received or not sent
+      uint32_t numFramesLost;
+      uint32_t numRxRingOverflows;
+      uint32_t numTxQueueFull;
+      uint32_t numTxReplaced;
+      uint32_t numTxAborted;
+      // Frames of identifiers that are not in the identifier table
+      uint32_t numUntrackedFrames;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   {
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      response->numFramesReceived = status.statistics.numFramesReceived;
+      response->numFramesSent = status.statistics.numFramesSent;
+      response->rxBitsPerSecond = status.statistics.rxBitsPerSecond;
+      response->txBitsPerSecond = status.statistics.txBitsPerSecond;
+      response->rxFramesPerSecond = status.statistics.rxFramesPerSecond;
+      response->txFramesPerSecond = status.statistics.txFramesPerSecond;
+      response->busLoad = status.statistics.busLoad;
+      response->peakBusLoad = status.statistics.peakBusLoad;
+      response->numFramesLost = status.statistics.numFramesLost;
+      response->numRxRingOverflows = status.statistics.numRxRingOverflows;
+      response->numTxQueueFull = status.statistics.numTxQueueFull;
+      response->numTxReplaced = status.statistics.numTxReplaced;
+      response->numTxAborted = status.statistics.numTxAborted;
+      response->numUntrackedFrames = status.statistics.numUntrackedFrames;
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+// Message handler to get the latency statistics
+void CAN_Drv_MessageRouter_GetLatencyStatistics(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // Time from queueing until the frame was sent, in microseconds
+      // Percentiles are the upper limit of the histogram bucket
+      uint32_t txLatencyMedianUs;
+      uint32_t txLatency90thUs;
+      uint32_t txLatency99thUs;
+      uint32_t maxTxLatencyUs;
+      // Time from reception until the frame was read, in microseconds
+      uint32_t lastRxLatencyUs;
+      uint32_t maxRxLatencyUs;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   {
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+      const uint32_t cyclesPerMicrosecond = Timebase_Drv_GetCyclesPerSecond() / 1000000U;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      response->txLatencyMedianUs = GetTxLatencyPercentile(50U);
+      response->txLatency90thUs = GetTxLatencyPercentile(90U);
+      response->txLatency99thUs = GetTxLatencyPercentile(99U);
+      response->maxTxLatencyUs = status.statistics.maxTxLatencyCycles / cyclesPerMicrosecond;
+      response->lastRxLatencyUs = status.statistics.lastRxLatencyCycles / cyclesPerMicrosecond;
+      response->maxRxLatencyUs = status.statistics.maxRxLatencyCycles / cyclesPerMicrosecond;
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+// Message handler to get the error statistics
+void CAN_Drv_MessageRouter_GetErrorStatistics(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // Node error counters and their highest values
+      uint8_t transmitErrorCount;
+      uint8_t receiveErrorCount;
+      uint8_t maxTransmitErrorCount;
+      uint8_t maxReceiveErrorCount;
+      // The last bus error code (LEC), 0 for no error
+      uint8_t lastErrorCode;
+      // 1 while the node is bus-off or above the error warning limit
+      uint8_t isBusOff;
+      uint8_t isErrorWarning;
+      uint8_t reserved;
+      uint32_t numBusErrors;
+      uint32_t numErrorWarnings;
+      uint32_t numBusOffEvents;
+      uint32_t numBusOffRecoveries;
+      // Sent frames that waited for frames of other nodes
+      uint32_t numTxArbitrationDelays;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   {
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      response->transmitErrorCount = status.statistics.transmitErrorCount;
+      response->receiveErrorCount = status.statistics.receiveErrorCount;
+      response->maxTransmitErrorCount = status.statistics.maxTransmitErrorCount;
+      response->maxReceiveErrorCount = status.statistics.maxReceiveErrorCount;
+      response->lastErrorCode = status.statistics.lastErrorCode;
+      response->isBusOff = status.statistics.isBusOff ? 1U : 0U;
+      response->isErrorWarning = status.statistics.isErrorWarning ? 1U : 0U;
+      response->reserved = 0U;
+      response->numBusErrors = status.statistics.numBusErrors;
+      response->numErrorWarnings = status.statistics.numErrorWarnings;
+      response->numBusOffEvents = status.statistics.numBusOffEvents;
+      response->numBusOffRecoveries = status.statistics.numBusOffRecoveries;
+      response->numTxArbitrationDelays = status.statistics.numTxArbitrationDelays;
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+// Message handler to get the frame counts of one identifier
+void CAN_Drv_MessageRouter_GetIdStatistics(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the command
+   typedef struct
+   {
+      // Index in the identifier table
+      uint8_t index;
+   } Command_t;
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // The CAN identifier, 0 for an unused entry
+      uint32_t canId;
+      uint32_t numReceived;
+      uint32_t numSent;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), sizeof(Response_t)))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      // Read the index before the response is written over the command
+      uint8_t index = command->index;
+
+      // Counts are zero for an invalid index
+      memset(response, 0, sizeof(Response_t));
+
+      if (index < CAN_DRV_NUM_ID_STATISTICS)
+      {
+         response->canId = status.idStatistics[index].canId;
+         response->numReceived = status.idStatistics[index].numReceived;
+         response->numSent = status.idStatistics[index].numSent;
+      }
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+// Message handler to clear the statistics
+void CAN_Drv_MessageRouter_ResetStatistics(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, 0))
+   {
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      // The node state is kept, so a node that stays bus-off is not counted again
+      const bool isBusOff = status.statistics.isBusOff;
+      const bool isErrorWarning = status.statistics.isErrorWarning;
+
+      // The interrupt must not count a frame while the totals are cleared
+      uint32_t interruptState = CAN_Drv_Device_DisableInterrupts();
+
+      memset(&status.statistics, 0, sizeof(status.statistics));
+      memset(status.idStatistics, 0, sizeof(status.idStatistics));
+      status.rateNumFramesReceived = 0U;
+      status.rateNumFramesSent = 0U;
+      status.rateNumRxBits = 0U;
+      status.rateNumTxBits = 0U;
+
+      CAN_Drv_Device_RestoreInterrupts(interruptState);
+
+      status.statistics.isBusOff = isBusOff;
+      status.statistics.isErrorWarning = isErrorWarning;
+   }
+}
@@ -0,0 +1,239 @@
+/*******************************************************************************
+// CAN Driver Core
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "CAN_Drv.h" // Frame type
+#include "CAN_Drv_Config.h" // Channel enumeration and queue sizes
+// Platform Includes
+#include "Platform.h"
+// Other Includes
+#include <stdbool.h> // Boolean types
+#include <stdint.h> // Integer types
+
+
+/*******************************************************************************
+// Public Function Declarations
+*******************************************************************************/
+
+//-----------------------------------------------
+// Core Functions
+//-----------------------------------------------
+
+// The core holds the transmit queue, the receive ring, the statistics and the
+// Message Router handlers of the CAN driver.  It implements the public driver
+// functions that do not touch the hardware, so every device runs the same
+// logic.  The device drivers call the functions below and implement the
+// CAN_Drv_Device functions for their frame I/O.
+
+/** Description:
+  *    This function clears the transmit queue, the receive ring and the
+  *    statistics.  It is called by CAN_Drv_Init of the device before the
+  *    node is started.
+  * Parameters:
+  *    baudrate :  The bit rate of the bus, used for the bus load
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void CAN_Drv_Core_Init(const uint32_t baudrate);
+
+/** Description:
+  *    This function moves the highest priority queued frames into free
+  *    transmit message objects.  The last CAN_DRV_NUM_RESERVED_TX_MSG_OBJS
+  *    objects are only used by frames that win the arbitration against
+  *    CAN_DRV_TX_RESERVED_ID_LIMIT.  When no object is free, a lower
+  *    priority frame that has waited CAN_DRV_TX_ABORT_TIME_MS is aborted to
+  *    make room.  Its object is loaded by a later call, once a frame that
+  *    already started must have ended, and only one abort waits at a time.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *    * 10/19/2026: Wait for the abort to take effect (EJH)
+  *
+*/
+void CAN_Drv_Core_ServiceTxQueue(void);
+
+/** Description:
+  *    This function counts the frame of a transmit message object that was
+  *    sent.  The latency from queueing to the end of the frame is added to
+  *    the histogram and the time of an armed transmit time capture is
+  *    taken.  It is called by the device before the object is reloaded.
+  * Parameters:
+  *    index :           The index of the transmit message object
+  *    completeCycles :  Timebase_Drv_GetCycleCount value at the end of the frame
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void CAN_Drv_Core_HandleTxComplete(const uint8_t index, const uint32_t completeCycles);
+
+/** Description:
+  *    This function counts a frame that passed the acceptance filters and
+  *    stores it in the receive ring with the current cycle count.  The frame
+  *    is dropped and counted when the ring is full.  It may be called from
+  *    the receive interrupt while the task reads the ring.
+  * Parameters:
+  *    frame :  The received frame, the timestamp is set here
+  * Returns:
+  *    bool - true if the frame was stored
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+bool CAN_Drv_Core_HandleRxFrame(const CAN_Drv_Frame_t *const frame) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function counts a received frame that the device overwrote
+  *    before it was read.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void CAN_Drv_Core_CountLostFrame(void);
+
+/** Description:
+  *    This function takes the error counters and state sampled from the
+  *    node and counts the bus errors, error warnings and bus-off events.
+  * Parameters:
+  *    transmitErrorCount :  The transmit error counter of the node
+  *    receiveErrorCount :   The receive error counter of the node
+  *    lastErrorCode :       The last error code (LEC), 0 for no error
+  *    isBusOff :            true while the node is bus-off
+  *    isErrorWarning :      true while an error counter is above the warning limit
+  * Returns:
+  *    bool - true if lastErrorCode was counted as a bus error, so the device
+  *           clears it before the next sample
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+bool CAN_Drv_Core_UpdateNodeStatistics(const uint8_t transmitErrorCount, const uint8_t receiveErrorCount, const uint8_t lastErrorCode,
+                                       const bool isBusOff, const bool isErrorWarning);
+
+/** Description:
+  *    This function calculates the frame and bit rates and the bus load once
+  *    per second.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void CAN_Drv_Core_UpdateRateStatistics(void);
+
+/** Description:
+  *    This function estimates the number of bits of a frame on the bus.
+  * Parameters:
+  *    canId :   The identifier of the frame, bit 31 for an extended identifier
+  *    length :  The number of data bytes
+  * Returns:
+  *    uint32_t - The number of bits without stuff bits
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+uint32_t CAN_Drv_Core_GetFrameBits(const uint32_t canId, const uint8_t length);
+
+/** Description:
+  *    This function finds the order of an identifier in the arbitration on
+  *    the bus.  A standard identifier wins against an extended identifier
+  *    with the same 11 base bits, as its recessive SRR and IDE bits come
+  *    later, but loses against one with lower base bits.
+  * Parameters:
+  *    canId :  The identifier, bit 31 set for an extended identifier
+  * Returns:
+  *    uint32_t - A key that is lower for a higher priority on the bus
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+uint32_t CAN_Drv_Core_GetPriorityKey(const uint32_t canId);
+
+
+//-----------------------------------------------
+// Device Functions
+//-----------------------------------------------
+
+// Each device driver implements these functions for the core
+
+/** Description:
+  *    This function checks if a transmit message object still holds a
+  *    frame that was not sent.  A frame that was sent but not counted yet
+  *    is counted with CAN_Drv_Core_HandleTxComplete first.
+  * Parameters:
+  *    index :  The index of the transmit message object
+  * Returns:
+  *    bool - true while the frame waits for the bus
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+bool CAN_Drv_Device_IsTxObjectBusy(const uint8_t index);
+
+/** Description:
+  *    This function writes a frame into a free transmit message object and
+  *    requests its transmission.  It is called with the interrupts
+  *    disabled.
+  * Parameters:
+  *    index :  The index of the transmit message object
+  *    frame :  The frame to be sent
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void CAN_Drv_Device_LoadTxObject(const uint8_t index, const CAN_Drv_Frame_t *const frame) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function withdraws the transmit request of a message object.  A
+  *    frame that already started on the bus is still completed.
+  * Parameters:
+  *    index :  The index of the transmit message object
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void CAN_Drv_Device_AbortTxObject(const uint8_t index);
+
+/** Description:
+  *    This function disables the CAN interrupts, so the core can change data
+  *    that the interrupt uses.
+  * Returns:
+  *    uint32_t - The previous interrupt state for CAN_Drv_Device_RestoreInterrupts
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+uint32_t CAN_Drv_Device_DisableInterrupts(void);
+
+/** Description:
+  *    This function restores the interrupt state saved by
+  *    CAN_Drv_Device_DisableInterrupts.
+  * Parameters:
+  *    state :  The saved interrupt state
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void CAN_Drv_Device_RestoreInterrupts(const uint32_t state);
+
+/** Description:
+  *    This function completes the memory accesses before it, so a receive
+  *    ring entry is written before it is published to the other side.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void CAN_Drv_Device_MemoryBarrier(void);
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
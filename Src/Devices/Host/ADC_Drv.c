@@ -0,0 +1,308 @@
+/*******************************************************************************
+// ADC Driver
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "ADC_Drv.h" // Driver API
+#include "ADC_Drv_Config.h" // Channel enumeration
+// Platform Includes
+#include "Host_Drv.h"
+#include "Lunar_EventMgr.h"
+#include "Lunar_MessageRouter.h"
+#include "Platform.h"
+#include "Timebase_Drv.h"
+// Other Includes
+#include <stddef.h> // NULL
+#include <string.h> // memset
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The number of buffers the acquisition alternates between, as the DMA does
+#define NUM_BUFFERS (2U)
+
+// Index used before the first buffer is complete
+#define NO_BUFFER_INDEX (0xFFU)
+
+// The simulated cycles between two scans
+#define CYCLES_PER_SCAN (HOST_DRV_CYCLES_PER_SECOND / ADC_DRV_SAMPLE_RATE_HZ)
+
+// The result of a grounded input, half of the 12-bit range
+#define MIDSCALE_RESULT (0x800U)
+
+// The bits of a 12-bit result
+#define RESULT_MASK (0x0FFFU)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// Status structure for this module
+typedef struct
+{
+   // The number of buffers completed by the simulated acquisition
+   uint32_t numBuffersCompleted;
+
+   // The buffer completed last and the time it completed
+   uint8_t completedBufferIndex;
+   uint32_t completedBufferTime;
+
+   // The number of DMA error events, always 0 on the host
+   uint32_t numDmaErrors;
+
+   // The number of completed buffers handed over by the update function
+   uint32_t numBuffersReady;
+
+   // The buffer handed over last and the time it completed
+   // These only change in the update function, so a consumer sees a
+   // consistent pair while it handles the buffer ready event
+   uint8_t readyBufferIndex;
+   uint32_t readyBufferTime;
+
+   // The number of buffers that completed before the previous buffer was
+   // handed over, their samples were not seen by the consumers
+   uint32_t numOverruns;
+
+   // The buffer filled next and the cycle count of its last scan
+   uint8_t fillBufferIndex;
+   uint32_t fillBufferEndTime;
+
+   // The number of scans since the start of the acquisition
+   uint32_t numScans;
+} ADC_Drv_Status_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// Status structure for this module
+static ADC_Drv_Status_t status;
+
+// The waveform replayed on the inputs, set by the test and kept when the
+// driver is initialized
+static const uint16_t *waveformSamples = NULL;
+static uint32_t waveformNumScans = 0U;
+
+// The sample buffers, one is filled while the other is handed over
+static ADC_Drv_Buffer_t buffers[NUM_BUFFERS];
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function returns the simulated result of one channel in a scan.
+  * Parameters:
+  *    channel :    The converted signal
+  *    scanIndex :  The number of scans before this one
+  * Returns:
+  *    uint16_t - The 12-bit result
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint16_t GetResult(const ADC_Drv_Channel_t channel, const uint32_t scanIndex);
+
+/** Description:
+  *    This function completes the buffers whose last scan is in the past,
+  *    as the DMA and its interrupt would.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void CompleteBuffers(void);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Get the simulated result of a channel
+static uint16_t GetResult(const ADC_Drv_Channel_t channel, const uint32_t scanIndex)
+{
+   uint16_t result = MIDSCALE_RESULT;
+
+   // Without a waveform nothing is connected to the inputs
+   if (waveformNumScans > 0U)
+   {
+      const uint32_t waveformScan = scanIndex % waveformNumScans;
+
+      result = waveformSamples[(waveformScan * (uint32_t)ADC_DRV_CHANNEL_Count) + (uint32_t)channel] & RESULT_MASK;
+   }
+
+   return(result);
+}
+
+// Complete the buffers filled since the last call
+static void CompleteBuffers(void)
+{
+   while ((int32_t)(Timebase_Drv_GetCycleCount() - status.fillBufferEndTime) >= 0)
+   {
+      ADC_Drv_Buffer_t *buffer = &buffers[status.fillBufferIndex];
+
+      for (uint32_t sample = 0U; sample < ADC_DRV_SAMPLES_PER_BUFFER; sample++)
+      {
+         for (uint8_t channel = 0U; channel < (uint8_t)ADC_DRV_CHANNEL_Count; channel++)
+         {
+            buffer->samples[sample][channel] = GetResult((ADC_Drv_Channel_t)channel, status.numScans);
+         }
+         status.numScans++;
+      }
+
+      status.completedBufferIndex = status.fillBufferIndex;
+      status.completedBufferTime = status.fillBufferEndTime;
+      status.numBuffersCompleted++;
+
+      status.fillBufferIndex = (status.fillBufferIndex + 1U) % NUM_BUFFERS;
+      status.fillBufferEndTime += ADC_DRV_SAMPLES_PER_BUFFER * CYCLES_PER_SCAN;
+   }
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Initialize the converter and start the acquisition
+void ADC_Drv_Init(void)
+{
+   memset(&status, 0, sizeof(ADC_Drv_Status_t));
+   status.completedBufferIndex = NO_BUFFER_INDEX;
+   status.readyBufferIndex = NO_BUFFER_INDEX;
+
+   // The first buffer is complete one buffer time after the start
+   status.fillBufferEndTime = Timebase_Drv_GetCycleCount() + (ADC_DRV_SAMPLES_PER_BUFFER * CYCLES_PER_SCAN);
+}
+
+// Scheduled function to hand over the completed buffers
+void ADC_Drv_Update(void)
+{
+   // Run the acquisition up to the current time
+   CompleteBuffers();
+
+   if (status.numBuffersCompleted != status.numBuffersReady)
+   {
+      // Only the newest buffer is handed over, older ones were overwritten
+      status.numOverruns += status.numBuffersCompleted - status.numBuffersReady - 1U;
+      status.numBuffersReady = status.numBuffersCompleted;
+      status.readyBufferIndex = status.completedBufferIndex;
+      status.readyBufferTime = status.completedBufferTime;
+
+      Lunar_EventMgr_HandleEvent(LUNAR_EVENTMGR_CONFIG_EVENT_ADC_BufferReady);
+   }
+   else
+   {
+      // No new buffer
+   }
+}
+
+// Returns the buffer handed over last
+const ADC_Drv_Buffer_t *ADC_Drv_GetReadyBuffer(void)
+{
+   const ADC_Drv_Buffer_t *buffer = NULL;
+
+   if (status.readyBufferIndex < NUM_BUFFERS)
+   {
+      buffer = &buffers[status.readyBufferIndex];
+   }
+   else
+   {
+      // No buffer complete yet
+   }
+
+   return(buffer);
+}
+
+// Returns the time the buffer handed over last was completed
+uint32_t ADC_Drv_GetReadyBufferTime(void)
+{
+   return(status.readyBufferTime);
+}
+
+
+/*******************************************************************************
+// Message Router Function Implementations
+*******************************************************************************/
+
+// Message handler to get the acquisition status
+void ADC_Drv_MessageRouter_GetStatus(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // The acquisition settings
+      uint32_t sampleRateHz;
+      uint16_t samplesPerBuffer;
+      uint16_t numChannels;
+      // Buffers completed by the DMA and buffers the consumers missed
+      uint32_t numBuffers;
+      uint32_t numOverruns;
+      uint32_t numDmaErrors;
+      // The last scan of the ready buffer, in channel enumeration order
+      uint16_t lastSamples[ADC_DRV_CHANNEL_Count];
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   {
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+      const ADC_Drv_Buffer_t *buffer = ADC_Drv_GetReadyBuffer();
+      uint8_t channel;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      response->sampleRateHz = ADC_DRV_SAMPLE_RATE_HZ;
+      response->samplesPerBuffer = ADC_DRV_SAMPLES_PER_BUFFER;
+      response->numChannels = ADC_DRV_CHANNEL_Count;
+      response->numBuffers = status.numBuffersCompleted;
+      response->numOverruns = status.numOverruns;
+      response->numDmaErrors = status.numDmaErrors;
+
+      for (channel = 0U; channel < (uint8_t)ADC_DRV_CHANNEL_Count; channel++)
+      {
+         if (buffer != NULL)
+         {
+            response->lastSamples[channel] = buffer->samples[ADC_DRV_SAMPLES_PER_BUFFER - 1U][channel];
+         }
+         else
+         {
+            response->lastSamples[channel] = 0U;
+         }
+      }
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+
+/*******************************************************************************
+// Host Test Function Implementations
+*******************************************************************************/
+
+// Set the waveform on the inputs
+void Host_Drv_ReplayADC(const uint16_t *const samples, const uint32_t numScans)
+{
+   waveformSamples = samples;
+   waveformNumScans = (samples != NULL) ? numScans : 0U;
+}
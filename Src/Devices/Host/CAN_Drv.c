@@ -0,0 +1,525 @@
+/*******************************************************************************
+// Can Driver
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "CAN_Drv.h" // Driver API
+#include "CAN_Drv_Core.h" // Queue, receive ring and statistics
+#include "CAN_Drv_Config.h" // Channel enumeration
+#include "CAN_Drv_ConfigTable.h" // CAN port configuration
+// Platform Includes
+#include "Host_Drv.h"
+#include "Platform.h"
+#include "Timebase_Drv.h"
+// Other Includes
+#include <errno.h> // errno
+#include <fcntl.h> // fcntl
+#include <linux/can.h> // SocketCAN frames and filters
+#include <linux/can/raw.h> // CAN_RAW_FILTER
+#include <net/if.h> // if_nametoindex
+#include <string.h> // memset
+#include <sys/socket.h> // socket, bind
+#include <unistd.h> // read, write, close
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The number of receive filters in the configuration table
+#define NUM_CAN_FILTERS (sizeof(canFilterConfigTable) / sizeof(CAN_Drv_FilterConfigItem_t))
+
+// The number of simulated cycles in a tick
+#define CYCLES_PER_TICK (HOST_DRV_CYCLES_PER_SECOND / TIMEBASE_DRV_NUM_TICKS_PER_SECOND)
+
+// The number of simulated cycles in a bit at the configured baud rate
+#define CYCLES_PER_BIT (HOST_DRV_CYCLES_PER_SECOND / canConfigTable[CAN_DRV_CHANNEL_PRIMARY].channelConfig.baudrate)
+
+// The number of sent frames kept until the test takes them
+#define TX_OUTPUT_SIZE (256U)
+
+// Error counter value that sets the error warning of the node
+#define ERROR_WARNING_LIMIT (96U)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// This structure defines a simulated transmit message object
+typedef struct
+{
+   // The frame loaded by the core
+   CAN_Drv_Frame_t frame;
+
+   // true while the frame waits for the bus
+   bool isPending;
+} TxObject_t;
+
+
+// This structure holds the private information for this module
+typedef struct
+{
+   // The transmit message objects loaded by the core
+   TxObject_t txObjects[CAN_DRV_NUM_TX_MSG_OBJS];
+
+   // Cycle count when the simulated bus is idle again
+   uint32_t busIdleCycles;
+
+   // The error state of the simulated node set by the test
+   uint8_t transmitErrorCount;
+   uint8_t receiveErrorCount;
+   uint8_t lastErrorCode;
+   bool isBusOff;
+
+   // Frames sent on the simulated bus that the test did not take yet
+   CAN_Drv_Frame_t txOutput[TX_OUTPUT_SIZE];
+   uint16_t txOutputHead;
+   uint16_t txOutputCount;
+} CAN_Drv_Status_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// Status structure for this module
+static CAN_Drv_Status_t status;
+
+// SocketCAN socket of the bus, -1 while the simulated bus is used
+// Kept outside of the status so the bus stays open when the firmware restarts
+static int busSocket = -1;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function sends the loaded frames, highest priority first, that
+  *    start on the simulated bus before the next update.  Each frame
+  *    occupies the bus for its number of bits, so the message objects and
+  *    the queue back up like on the device when the bus is loaded.  A
+  *    bus-off node sends nothing.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *    * 10/19/2026: Send from the message objects of the core (EJH)
+  *    * 10/19/2026: Nothing is sent while bus-off (EJH)
+  *
+*/
+static void RunSimulatedBus(void);
+
+/** Description:
+  *    This function writes the loaded frames to the SocketCAN bus,
+  *    highest priority first.  A frame the socket cannot take stays in its
+  *    message object until the next update.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *    * 10/19/2026: Send from the message objects of the core (EJH)
+  *
+*/
+static void WriteSocketFrames(void);
+
+/** Description:
+  *    This function reads every frame waiting on the SocketCAN bus and
+  *    stores it like the receive interrupt of the device.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void ReceiveSocketFrames(void);
+
+/** Description:
+  *    This function finds the pending message object with the highest
+  *    priority frame, which wins the arbitration on the bus.
+  * Parameters:
+  *    index :  Destination for the index of the message object
+  * Returns:
+  *    bool - true if a message object is pending
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool FindPendingTxObject(uint8_t *const index) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function completes the frame of a message object and keeps it
+  *    for the test.
+  * Parameters:
+  *    index :           The index of the message object
+  *    completeCycles :  Cycle count when the frame was complete on the bus
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *    * 10/19/2026: Counting moved to CAN_Drv_Core (EJH)
+  *
+*/
+static void HandleTxComplete(const uint8_t index, const uint32_t completeCycles);
+
+/** Description:
+  *    This function passes a frame through the acceptance filters and stores
+  *    it in the receive ring, as the receive interrupt of the device would.
+  * Parameters:
+  *    frame :  The frame seen on the bus
+  * Returns:
+  *    bool - true if the frame was accepted and stored
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *    * 10/19/2026: Counting moved to CAN_Drv_Core (EJH)
+  *
+*/
+static bool HandleRxFrame(const CAN_Drv_Frame_t *const frame) PLATFORM_NON_NULL;
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Send the loaded frames that start before the next update
+static void RunSimulatedBus(void)
+{
+   const uint32_t currentCycles = Timebase_Drv_GetCycleCount();
+   uint8_t index = 0U;
+
+   // The idle bus starts the next frame right away
+   if ((int32_t)(status.busIdleCycles - currentCycles) < 0)
+   {
+      status.busIdleCycles = currentCycles;
+   }
+
+   // The message objects of the device hold the frames for about one update,
+   // so only the frames that start within the next tick are sent
+   while ((!status.isBusOff) && ((status.busIdleCycles - currentCycles) < CYCLES_PER_TICK) && FindPendingTxObject(&index))
+   {
+      const CAN_Drv_Frame_t *const frame = &status.txObjects[index].frame;
+
+      status.busIdleCycles += CAN_Drv_Core_GetFrameBits(frame->canId, frame->length) * CYCLES_PER_BIT;
+
+      HandleTxComplete(index, status.busIdleCycles);
+   }
+}
+
+// Write the loaded frames to the SocketCAN bus
+static void WriteSocketFrames(void)
+{
+   bool isSocketFull = false;
+   uint8_t index = 0U;
+
+   while ((!isSocketFull) && FindPendingTxObject(&index))
+   {
+      const CAN_Drv_Frame_t *const frame = &status.txObjects[index].frame;
+      struct can_frame socketFrame;
+
+      memset(&socketFrame, 0, sizeof(socketFrame));
+      if ((frame->canId & CAN_DRV_EXTENDED_ID) != 0U)
+      {
+         socketFrame.can_id = (frame->canId & CAN_EFF_MASK) | CAN_EFF_FLAG;
+      }
+      else
+      {
+         socketFrame.can_id = frame->canId & CAN_SFF_MASK;
+      }
+      socketFrame.can_dlc = frame->length;
+      memcpy(socketFrame.data, frame->data, frame->length);
+
+      if (write(busSocket, &socketFrame, sizeof(socketFrame)) == (ssize_t)sizeof(socketFrame))
+      {
+         // The kernel took the frame, the time on the wire is not known
+         HandleTxComplete(index, Timebase_Drv_GetCycleCount());
+      }
+      else
+      {
+         // The transmit queue of the interface is full or the interface is
+         // down, the frame waits like on a busy bus until the core aborts it
+         isSocketFull = true;
+      }
+   }
+}
+
+// Read the frames waiting on the SocketCAN bus
+static void ReceiveSocketFrames(void)
+{
+   struct can_frame socketFrame;
+
+   while (read(busSocket, &socketFrame, sizeof(socketFrame)) == (ssize_t)sizeof(socketFrame))
+   {
+      // Remote and error frames are not used by the firmware
+      if ((socketFrame.can_id & (CAN_RTR_FLAG | CAN_ERR_FLAG)) == 0U)
+      {
+         CAN_Drv_Frame_t frame;
+
+         memset(&frame, 0, sizeof(frame));
+         if ((socketFrame.can_id & CAN_EFF_FLAG) != 0U)
+         {
+            frame.canId = (socketFrame.can_id & CAN_EFF_MASK) | CAN_DRV_EXTENDED_ID;
+         }
+         else
+         {
+            frame.canId = socketFrame.can_id & CAN_SFF_MASK;
+         }
+         frame.length = PLATFORM_MIN(socketFrame.can_dlc, (uint8_t)CAN_DRV_MAX_DATA_LENGTH);
+         memcpy(frame.data, socketFrame.data, frame.length);
+
+         (void)HandleRxFrame(&frame);
+      }
+   }
+}
+
+// Find the message object that wins the arbitration
+static bool FindPendingTxObject(uint8_t *const index)
+{
+   bool found = false;
+
+   for (uint8_t i = 0U; i < CAN_DRV_NUM_TX_MSG_OBJS; i++)
+   {
+      if ((status.txObjects[i].isPending) &&
+          ((!found) || (CAN_Drv_Core_GetPriorityKey(status.txObjects[i].frame.canId) < CAN_Drv_Core_GetPriorityKey(status.txObjects[*index].frame.canId))))
+      {
+         *index = i;
+         found = true;
+      }
+   }
+
+   return(found);
+}
+
+// Complete the frame of a message object
+static void HandleTxComplete(const uint8_t index, const uint32_t completeCycles)
+{
+   uint16_t outputIndex;
+
+   status.txObjects[index].isPending = false;
+   CAN_Drv_Core_HandleTxComplete(index, completeCycles);
+
+   // Keep the frame for the test, the oldest frame is dropped when it is not taken
+   if (status.txOutputCount >= TX_OUTPUT_SIZE)
+   {
+      status.txOutputHead = (status.txOutputHead + 1U) % TX_OUTPUT_SIZE;
+      status.txOutputCount--;
+   }
+   outputIndex = (status.txOutputHead + status.txOutputCount) % TX_OUTPUT_SIZE;
+   status.txOutput[outputIndex] = status.txObjects[index].frame;
+   status.txOutput[outputIndex].timestamp = completeCycles;
+   status.txOutputCount++;
+}
+
+// Filter a frame from the bus and pass it to the core
+static bool HandleRxFrame(const CAN_Drv_Frame_t *const frame)
+{
+   bool isStored = false;
+   bool isAccepted = false;
+
+   // The identifier type must match as well as the masked identifier bits
+   for (uint8_t filter = 0U; (filter < NUM_CAN_FILTERS) && (!isAccepted); filter++)
+   {
+      const uint32_t compareMask = canFilterConfigTable[filter].idMask | CAN_DRV_EXTENDED_ID;
+
+      isAccepted = (((frame->canId ^ canFilterConfigTable[filter].canId) & compareMask) == 0U);
+   }
+
+   if (isAccepted)
+   {
+      isStored = CAN_Drv_Core_HandleRxFrame(frame);
+   }
+
+   return(isStored);
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Initialize all configured CAN channels
+void CAN_Drv_Init(void)
+{
+   memset(&status, 0, sizeof(status));
+
+   // The simulated bus runs at the configured baud rate
+   CAN_Drv_Core_Init(canConfigTable[CAN_DRV_CHANNEL_PRIMARY].channelConfig.baudrate);
+   status.busIdleCycles = Timebase_Drv_GetCycleCount();
+}
+
+// Scheduled function to service the transmit queue
+void CAN_Drv_Update(void)
+{
+   // Move waiting frames into the message objects freed since the last call
+   CAN_Drv_Core_ServiceTxQueue();
+
+   if (busSocket >= 0)
+   {
+      // Frames of the other nodes arrive on the socket, not by interrupt
+      ReceiveSocketFrames();
+      WriteSocketFrames();
+   }
+   else
+   {
+      // Send the frames that fit on the bus until the next call
+      RunSimulatedBus();
+   }
+
+   // Sample the node state set by the test, a counted error code is cleared
+   if (CAN_Drv_Core_UpdateNodeStatistics(status.transmitErrorCount, status.receiveErrorCount, status.lastErrorCode, status.isBusOff,
+                                         (status.transmitErrorCount >= ERROR_WARNING_LIMIT) || (status.receiveErrorCount >= ERROR_WARNING_LIMIT)))
+   {
+      status.lastErrorCode = 0U;
+   }
+   CAN_Drv_Core_UpdateRateStatistics();
+}
+
+
+/*******************************************************************************
+// Device Function Implementations
+*******************************************************************************/
+
+// See if a transmit message object still holds a frame
+bool CAN_Drv_Device_IsTxObjectBusy(const uint8_t index)
+{
+   // Frames are completed by the update, nothing is left to count here
+   return(status.txObjects[index].isPending);
+}
+
+// Write a frame into a transmit message object
+void CAN_Drv_Device_LoadTxObject(const uint8_t index, const CAN_Drv_Frame_t *const frame)
+{
+   // The frame goes on the bus with the next update
+   status.txObjects[index].frame = *frame;
+   status.txObjects[index].isPending = true;
+}
+
+// Withdraw the transmit request of a message object
+void CAN_Drv_Device_AbortTxObject(const uint8_t index)
+{
+   // Frames on the simulated bus are sent in one step, so none is in progress
+   status.txObjects[index].isPending = false;
+}
+
+// Disable the interrupts
+uint32_t CAN_Drv_Device_DisableInterrupts(void)
+{
+   // The host build has no interrupts
+   return(0U);
+}
+
+// Restore the interrupt state
+void CAN_Drv_Device_RestoreInterrupts(const uint32_t state)
+{
+   (void)state;
+}
+
+// Complete the memory accesses before the barrier
+void CAN_Drv_Device_MemoryBarrier(void)
+{
+   // The host build runs in a single thread
+}
+
+
+/*******************************************************************************
+// Host Test Function Implementations
+*******************************************************************************/
+
+// Receive a frame from another node
+bool Host_Drv_ReceiveCAN(const CAN_Drv_Frame_t *const frame)
+{
+   // The frame occupies the bus, so frames of this node wait for it
+   const uint32_t currentCycles = Timebase_Drv_GetCycleCount();
+
+   if ((int32_t)(status.busIdleCycles - currentCycles) < 0)
+   {
+      status.busIdleCycles = currentCycles;
+   }
+   status.busIdleCycles += CAN_Drv_Core_GetFrameBits(frame->canId, frame->length) * CYCLES_PER_BIT;
+
+   return(HandleRxFrame(frame));
+}
+
+// Connect the driver to a SocketCAN interface
+bool Host_Drv_OpenCAN(const char *const interfaceName)
+{
+   struct can_filter filters[NUM_CAN_FILTERS];
+   struct sockaddr_can address;
+   const unsigned int interfaceIndex = if_nametoindex(interfaceName);
+   int newSocket = -1;
+   bool isOpen = false;
+
+   if (interfaceIndex != 0U)
+   {
+      newSocket = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+   }
+
+   if (newSocket >= 0)
+   {
+      // The kernel applies the acceptance filters of the board, like the
+      // message objects of the device
+      for (uint8_t filter = 0U; filter < NUM_CAN_FILTERS; filter++)
+      {
+         if ((canFilterConfigTable[filter].canId & CAN_DRV_EXTENDED_ID) != 0U)
+         {
+            filters[filter].can_id = (canFilterConfigTable[filter].canId & CAN_EFF_MASK) | CAN_EFF_FLAG;
+            filters[filter].can_mask = (canFilterConfigTable[filter].idMask & CAN_EFF_MASK) | CAN_EFF_FLAG | CAN_RTR_FLAG;
+         }
+         else
+         {
+            filters[filter].can_id = canFilterConfigTable[filter].canId & CAN_SFF_MASK;
+            filters[filter].can_mask = (canFilterConfigTable[filter].idMask & CAN_SFF_MASK) | CAN_EFF_FLAG | CAN_RTR_FLAG;
+         }
+      }
+
+      memset(&address, 0, sizeof(address));
+      address.can_family = AF_CAN;
+      address.can_ifindex = (int)interfaceIndex;
+
+      isOpen = ((setsockopt(newSocket, SOL_CAN_RAW, CAN_RAW_FILTER, filters, sizeof(filters)) == 0) &&
+                (fcntl(newSocket, F_SETFL, O_NONBLOCK) == 0) &&
+                (bind(newSocket, (struct sockaddr *)&address, sizeof(address)) == 0));
+
+      if (isOpen)
+      {
+         Host_Drv_CloseCAN();
+         busSocket = newSocket;
+      }
+      else
+      {
+         (void)close(newSocket);
+      }
+   }
+
+   return(isOpen);
+}
+
+// Return to the simulated bus
+void Host_Drv_CloseCAN(void)
+{
+   if (busSocket >= 0)
+   {
+      (void)close(busSocket);
+      busSocket = -1;
+   }
+}
+
+// Take the oldest frame sent by the firmware
+bool Host_Drv_TakeCANOutput(CAN_Drv_Frame_t *const frame)
+{
+   bool taken = false;
+
+   if (status.txOutputCount > 0U)
+   {
+      *frame = status.txOutput[status.txOutputHead];
+      status.txOutputHead = (status.txOutputHead + 1U) % TX_OUTPUT_SIZE;
+      status.txOutputCount--;
+      taken = true;
+   }
+
+   return(taken);
+}
+
+// Set the error state of the simulated node
+void Host_Drv_SetCANNodeState(const uint8_t transmitErrorCount, const uint8_t receiveErrorCount, const uint8_t lastErrorCode, const bool isBusOff)
+{
+   status.transmitErrorCount = transmitErrorCount;
+   status.receiveErrorCount = receiveErrorCount;
+   status.lastErrorCode = lastErrorCode;
+   status.isBusOff = isBusOff;
+}
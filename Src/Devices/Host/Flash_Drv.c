@@ -0,0 +1,467 @@
+/*******************************************************************************
+// Flash Driver
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "Flash_Drv.h"
+#include "Flash_Drv_Config.h"
+// Platform Includes
+#include "Host_Drv.h"
+// Other Includes
+#include "xmc_device.h" // Device family of the simulated flash
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The number of FLASH_DRV_SECTOR_SIZE sectors that can be used at the same
+// time, storage is only allocated for sectors that are written
+#define NUM_SIMULATED_SECTORS (128U)
+
+#if UC_FAMILY == XMC4
+// Start of the flash and the end of the 16 kB and 128 kB physical sectors.
+// The 256 kB sectors follow.
+#define FLASH_START_ADDRESS (0x0C000000UL)
+#define SMALL_SECTORS_END_OFFSET (0x00020000UL)
+#define MEDIUM_SECTOR_END_OFFSET (0x00040000UL)
+#define LARGE_SECTOR_SIZE (0x00040000UL)
+#endif
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// This enumeration defines the operations of the driver
+typedef enum
+{
+   // No operation in progress
+   FLASH_OPERATION_Idle,
+   // A sector is being erased
+   FLASH_OPERATION_Erase,
+   // A page is being programmed
+   FLASH_OPERATION_Program,
+} Flash_Operation_t;
+
+// This structure holds the contents of one simulated sector
+typedef struct
+{
+   // Address of the first byte of the sector, 0 while the entry is unused
+   uint32_t address;
+
+   // The contents, NULL while the whole sector is erased
+   uint32_t *words;
+} Sector_t;
+
+// This structure counts the erases of one sector
+typedef struct
+{
+   // Address of the first byte of the sector
+   uint32_t address;
+
+   // The number of times the sector was erased, 0 while the entry is unused
+   uint32_t numErases;
+} EraseCount_t;
+
+// This structure defines the internal variables used by the module
+typedef struct
+{
+   // The operation in progress
+   Flash_Operation_t operation;
+
+   // The result of the last finished operation
+   bool operationFailed;
+
+   // The address and size of the area being erased
+   uint32_t eraseAddress;
+   uint32_t eraseSize;
+
+   // The page being programmed and its data
+   uint32_t programAddress;
+   uint32_t programWords[FLASH_DRV_WORDS_PER_PAGE];
+
+   // The next operation stops after interruptBytes bytes, as on a power loss
+   bool isInterruptPending;
+   uint32_t interruptBytes;
+
+   // Set once an operation was interrupted, nothing changes until the
+   // firmware is started again
+   bool isPowerLost;
+} Flash_Status_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The variable used for holding all internal data for this module.
+static Flash_Status_t status;
+
+// The simulated flash contents, kept over a restart of the firmware like the
+// device flash
+static Sector_t sectors[NUM_SIMULATED_SECTORS];
+
+// The number of erases of each sector since the start, for wear checks
+static EraseCount_t eraseCounts[NUM_SIMULATED_SECTORS];
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function finds the simulated sector holding an address.
+  * Parameters:
+  *    address :      An address in the sector
+  *    isAllocated :  true to allocate the storage of an erased sector
+  * Returns:
+  *    Sector_t * - The sector, NULL if the sector is erased and isAllocated
+  *                 is false
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static Sector_t *FindSector(const uint32_t address, const bool isAllocated);
+
+/** Description:
+  *    This function returns the size of the area erased for a sector
+  *    address.  The larger physical sectors of the XMC4 are erased whole.
+  * Parameters:
+  *    sectorAddress :  The address of the first byte of the sector
+  * Returns:
+  *    uint32_t - The number of bytes erased
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint32_t GetEraseSize(const uint32_t sectorAddress);
+
+/** Description:
+  *    This function finds the erase counter of a sector.
+  * Parameters:
+  *    address :      An address in the sector
+  *    isAllocated :  true to start a counter for a sector that was never erased
+  * Returns:
+  *    EraseCount_t * - The counter, NULL if the sector was never erased and
+  *                     isAllocated is false
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static EraseCount_t *FindEraseCount(const uint32_t address, const bool isAllocated);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Find the simulated sector of an address
+static Sector_t *FindSector(const uint32_t address, const bool isAllocated)
+{
+   const uint32_t sectorAddress = address - (address % FLASH_DRV_SECTOR_SIZE);
+   Sector_t *sector = NULL;
+   Sector_t *unusedSector = NULL;
+
+   for (uint32_t i = 0U; (i < NUM_SIMULATED_SECTORS) && (sector == NULL); i++)
+   {
+      if ((sectors[i].words != NULL) && (sectors[i].address == sectorAddress))
+      {
+         sector = &sectors[i];
+      }
+      else if ((sectors[i].words == NULL) && (unusedSector == NULL))
+      {
+         unusedSector = &sectors[i];
+      }
+      else
+      {
+         // Sector of another address
+      }
+   }
+
+   // A sector is only stored once it holds programmed data
+   if ((sector == NULL) && (isAllocated) && (unusedSector != NULL))
+   {
+      unusedSector->words = malloc(FLASH_DRV_SECTOR_SIZE);
+      if (unusedSector->words != NULL)
+      {
+         for (uint32_t i = 0U; i < (FLASH_DRV_SECTOR_SIZE / sizeof(uint32_t)); i++)
+         {
+            unusedSector->words[i] = FLASH_DRV_ERASED_WORD;
+         }
+         unusedSector->address = sectorAddress;
+         sector = unusedSector;
+      }
+   }
+
+   return(sector);
+}
+
+// Get the size of the area erased for a sector address
+static uint32_t GetEraseSize(const uint32_t sectorAddress)
+{
+   uint32_t eraseSize = FLASH_DRV_SECTOR_SIZE;
+
+#if UC_FAMILY == XMC4
+   const uint32_t offset = sectorAddress - FLASH_START_ADDRESS;
+
+   if (offset >= MEDIUM_SECTOR_END_OFFSET)
+   {
+      eraseSize = LARGE_SECTOR_SIZE;
+   }
+   else if (offset >= SMALL_SECTORS_END_OFFSET)
+   {
+      eraseSize = MEDIUM_SECTOR_END_OFFSET - SMALL_SECTORS_END_OFFSET;
+   }
+   else
+   {
+      // One of the 16 kB sectors
+   }
+#endif
+
+   return(eraseSize);
+}
+
+// Find the erase counter of a sector
+static EraseCount_t *FindEraseCount(const uint32_t address, const bool isAllocated)
+{
+   const uint32_t sectorAddress = address - (address % FLASH_DRV_SECTOR_SIZE);
+   EraseCount_t *eraseCount = NULL;
+
+   for (uint32_t i = 0U; (i < NUM_SIMULATED_SECTORS) && (eraseCount == NULL); i++)
+   {
+      if ((eraseCounts[i].numErases > 0U) && (eraseCounts[i].address == sectorAddress))
+      {
+         eraseCount = &eraseCounts[i];
+      }
+      else if ((eraseCounts[i].numErases == 0U) && (isAllocated))
+      {
+         // Counters are used in order, so the sector was never erased
+         eraseCounts[i].address = sectorAddress;
+         eraseCount = &eraseCounts[i];
+      }
+      else
+      {
+         // Counter of another sector
+      }
+   }
+
+   return(eraseCount);
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Initialize the driver
+void Flash_Drv_Init(void)
+{
+   // An operation cut off by a power loss is abandoned
+   status.operation = FLASH_OPERATION_Idle;
+   status.operationFailed = false;
+   status.isPowerLost = false;
+}
+
+
+// Start erasing a sector
+bool Flash_Drv_StartEraseSector(const uint32_t sectorAddress)
+{
+   bool started = false;
+
+   // Only one operation may be in progress
+   if ((status.operation == FLASH_OPERATION_Idle) && ((sectorAddress % FLASH_DRV_SECTOR_SIZE) == 0U))
+   {
+      // The physical sector holding the address is erased
+      status.eraseSize = GetEraseSize(sectorAddress);
+      status.eraseAddress = sectorAddress - (sectorAddress % status.eraseSize);
+      status.operation = FLASH_OPERATION_Erase;
+      status.operationFailed = false;
+      started = true;
+   }
+
+   return(started);
+}
+
+
+// Start programming a page
+bool Flash_Drv_StartProgramPage(const uint32_t pageAddress, const uint32_t *const data)
+{
+   bool started = false;
+
+   // Only one operation may be in progress
+   if ((status.operation == FLASH_OPERATION_Idle) && ((pageAddress % FLASH_DRV_PAGE_SIZE) == 0U))
+   {
+      // The data is copied, as into the page buffer of the device
+      memcpy(status.programWords, data, sizeof(status.programWords));
+      status.programAddress = pageAddress;
+      status.operation = FLASH_OPERATION_Program;
+      status.operationFailed = false;
+      started = true;
+   }
+
+   return(started);
+}
+
+
+// Advance the operation in progress
+void Flash_Drv_Update(void)
+{
+   // An interrupted operation stops part way and never finishes, the
+   // firmware has to be started again
+   const uint32_t operationBytes = status.isInterruptPending ? status.interruptBytes : UINT32_MAX;
+
+   // Each operation takes until the next update, as a short one on the device
+   if (status.isPowerLost)
+   {
+      // The interrupted operation stays busy
+   }
+   else if (status.operation == FLASH_OPERATION_Erase)
+   {
+      for (uint32_t offset = 0U; offset < status.eraseSize; offset += FLASH_DRV_SECTOR_SIZE)
+      {
+         Sector_t *sector = FindSector(status.eraseAddress + offset, false);
+
+         if ((sector != NULL) && (operationBytes >= (offset + FLASH_DRV_SECTOR_SIZE)))
+         {
+            free(sector->words);
+            sector->words = NULL;
+         }
+         else if ((sector != NULL) && (operationBytes > offset))
+         {
+            for (uint32_t i = 0U; i < ((operationBytes - offset) / sizeof(uint32_t)); i++)
+            {
+               sector->words[i] = FLASH_DRV_ERASED_WORD;
+            }
+         }
+         else
+         {
+            // Already erased, or not reached before the power loss
+         }
+
+         EraseCount_t *eraseCount = FindEraseCount(status.eraseAddress + offset, true);
+
+         if ((eraseCount != NULL) && (operationBytes > offset))
+         {
+            eraseCount->numErases++;
+         }
+      }
+   }
+   else if (status.operation == FLASH_OPERATION_Program)
+   {
+      Sector_t *sector = FindSector(status.programAddress, true);
+
+      if (sector != NULL)
+      {
+         uint32_t *words = &sector->words[(status.programAddress - sector->address) / sizeof(uint32_t)];
+
+         for (uint32_t i = 0U; (i < FLASH_DRV_WORDS_PER_PAGE) && ((i * sizeof(uint32_t)) < operationBytes); i++)
+         {
+            // Programming only sets the erased bits, the verify fails
+            // when the page was not erased
+            if (words[i] != FLASH_DRV_ERASED_WORD)
+            {
+               status.operationFailed = true;
+            }
+            words[i] = FLASH_DRV_ERASED_WORD ^ ((words[i] ^ FLASH_DRV_ERASED_WORD) | (status.programWords[i] ^ FLASH_DRV_ERASED_WORD));
+         }
+      }
+      else
+      {
+         // More sectors were written than the simulation holds
+         status.operationFailed = true;
+      }
+   }
+   else
+   {
+      // No operation in progress
+   }
+
+   if ((status.operation != FLASH_OPERATION_Idle) && (status.isInterruptPending))
+   {
+      // The operation stays busy until the firmware is started again
+      status.isInterruptPending = false;
+      status.isPowerLost = true;
+   }
+   else if (!status.isPowerLost)
+   {
+      status.operation = FLASH_OPERATION_Idle;
+   }
+   else
+   {
+      // Waiting for the firmware to be started again
+   }
+}
+
+
+// Check for an operation in progress
+bool Flash_Drv_IsBusy(void)
+{
+   return(status.operation != FLASH_OPERATION_Idle);
+}
+
+
+// Get the result of the last operation
+bool Flash_Drv_DidOperationFail(void)
+{
+   return(status.operationFailed);
+}
+
+
+// Read data from the flash
+void Flash_Drv_Read(const uint32_t address, void *const data, const uint32_t length)
+{
+   uint8_t *bytes = (uint8_t *)data;
+   uint32_t numRead = 0U;
+
+   // Copy sector by sector, an erased sector has no storage
+   while (numRead < length)
+   {
+      const uint32_t currentAddress = address + numRead;
+      const uint32_t sectorOffset = currentAddress % FLASH_DRV_SECTOR_SIZE;
+      const uint32_t numBytes = PLATFORM_MIN(length - numRead, FLASH_DRV_SECTOR_SIZE - sectorOffset);
+      const Sector_t *sector = FindSector(currentAddress, false);
+
+      if (sector != NULL)
+      {
+         memcpy(&bytes[numRead], (const uint8_t *)sector->words + sectorOffset, numBytes);
+      }
+      else
+      {
+         for (uint32_t i = 0U; i < numBytes; i++)
+         {
+            bytes[numRead + i] = (uint8_t)(FLASH_DRV_ERASED_WORD >> (8U * ((currentAddress + i) % sizeof(uint32_t))));
+         }
+      }
+
+      numRead += numBytes;
+   }
+}
+
+
+/*******************************************************************************
+// Host Test Function Implementations
+*******************************************************************************/
+
+// Cut off the next flash operation
+void Host_Drv_InterruptFlash(const uint32_t numBytes)
+{
+   status.isInterruptPending = true;
+   status.interruptBytes = numBytes;
+}
+
+
+// Get the number of erases of a sector
+uint32_t Host_Drv_GetFlashEraseCount(const uint32_t address)
+{
+   const EraseCount_t *eraseCount = FindEraseCount(address, false);
+
+   return((eraseCount != NULL) ? eraseCount->numErases : 0U);
+}
@@ -0,0 +1,106 @@
+/*******************************************************************************
+// GPIO Driver
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "GPIO_Drv.h" // Driver API
+#include "GPIO_Drv_Config.h" // Defines channel enumeration
+#include "GPIO_Drv_ConfigTable.h" // Implementation Configuration
+// Platform Includes
+// Other Includes
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// This structure defines the internal variables used by the module
+typedef struct
+{
+   // Current enable state for each configured pin
+   // Inputs stay in the inactive state, nothing drives them on the host
+   bool enableState[GPIO_DRV_CHANNEL_Count];
+} GPIO_Drv_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The variable used for holding all internal data for this module.
+static GPIO_Drv_t status;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Initialize all configured pins
+void GPIO_Drv_Init(void)
+{
+   // Loop through each GPIO entry and set the initial state
+   for (uint8_t channel = 0U; channel < GPIO_DRV_CHANNEL_Count; channel++)
+   {
+      if (gpioConfigTable[channel].direction == GPIO_DRV_DIRECTION_OUTPUT)
+      {
+         status.enableState[channel] = gpioConfigTable[channel].gpioConfig.gpioOutput.initialEnableState;
+      }
+      else
+      {
+         status.enableState[channel] = false;
+      }
+   }
+}
+
+// Read the current state of the given pin
+bool GPIO_Drv_Read(const GPIO_Drv_Channel_t channel)
+{
+   bool enableState = false;
+
+   // Verify the given channel is valid
+   if (channel < GPIO_DRV_CHANNEL_Count)
+   {
+      enableState = status.enableState[channel];
+   }
+
+   // Return the pin state
+   return(enableState);
+}
+
+// Write the given state to the given pin
+void GPIO_Drv_Write(const GPIO_Drv_Channel_t channel, const bool enableState)
+{
+   // Verify the given channel is valid and the pin is configured for output
+   if ((channel < GPIO_DRV_CHANNEL_Count) && (gpioConfigTable[channel].direction == GPIO_DRV_DIRECTION_OUTPUT))
+   {
+      status.enableState[channel] = enableState;
+   }
+}
+
+// Toggle the given pin
+void GPIO_Drv_Toggle(const GPIO_Drv_Channel_t channel)
+{
+   // Verify the given channel is valid and the pin is configured for output
+   if ((channel < GPIO_DRV_CHANNEL_Count) && (gpioConfigTable[channel].direction == GPIO_DRV_DIRECTION_OUTPUT))
+   {
+      status.enableState[channel] = !status.enableState[channel];
+   }
+}
@@ -0,0 +1,217 @@
+/*******************************************************************************
+// Host Driver Test Interface
+*******************************************************************************/
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+// Platform Includes
+#include "CAN_Drv.h"
+#include "Platform.h"
+#include "UART_Drv.h"
+// Other Includes
+#include <stdbool.h> // Boolean types
+#include <stdint.h> // Integer types
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// The rate of the simulated cycle counter, chosen so a microsecond is a whole
+// number of cycles
+#define HOST_DRV_CYCLES_PER_SECOND (100000000U)
+
+
+/*******************************************************************************
+// Public Type Declarations
+*******************************************************************************/
+
+
+/*******************************************************************************
+// Public Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function advances the simulated time.  The host drivers do not
+  *    read a clock, so time only passes when a test calls this function.
+  *    Timer ticks, the cycle counter and the real-time clock all follow it.
+  * Parameters:
+  *    microseconds :  The time to be added
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Host_Drv_AdvanceTime(const uint32_t microseconds);
+
+/** Description:
+  *    This function places bytes into the receive buffer of a UART, as the
+  *    receive interrupt of the device would.  Like the device, a full buffer
+  *    drops its oldest bytes to make room.
+  * Parameters:
+  *    channel :  The UART the bytes are received on
+  *    data :     The received bytes
+  *    length :   The number of bytes in data
+  * Returns:
+  *    uint32_t - The number of bytes stored in the receive buffer
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+uint32_t Host_Drv_ReceiveUART(const UART_Drv_Channel_t channel, const uint8_t *const data, const uint32_t length) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function removes the bytes written to a UART by the firmware.
+  * Parameters:
+  *    channel :    The UART that was written
+  *    data :       Buffer for the written bytes
+  *    maxLength :  The size of data
+  * Returns:
+  *    uint32_t - The number of bytes copied into data
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+uint32_t Host_Drv_TakeUARTOutput(const UART_Drv_Channel_t channel, uint8_t *const data, const uint32_t maxLength) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function places a frame into the receive ring of the CAN driver,
+  *    as if it was received from another node.  The frame passes the
+  *    acceptance filters of the board configuration and takes its time on
+  *    the simulated bus.
+  * Parameters:
+  *    frame :  The received frame, the timestamp is set by the driver
+  * Returns:
+  *    bool - true if the frame was accepted and stored
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+bool Host_Drv_ReceiveCAN(const CAN_Drv_Frame_t *const frame) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function removes the oldest frame sent on the simulated bus by
+  *    the firmware.
+  * Parameters:
+  *    frame :  Destination for the sent frame, the timestamp is the cycle
+  *             count when the frame was complete on the bus
+  * Returns:
+  *    bool - true if a sent frame was copied into frame
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+bool Host_Drv_TakeCANOutput(CAN_Drv_Frame_t *const frame) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function connects the CAN driver to a Linux SocketCAN interface,
+  *    such as a vcan interface, instead of the simulated bus.  The acceptance
+  *    filters of the board are set on the socket.  Frames are sent and
+  *    received on the interface when the scheduled CAN update runs, and sent
+  *    frames can still be taken with Host_Drv_TakeCANOutput.  The socket
+  *    stays open when the firmware is started again.
+  * Parameters:
+  *    interfaceName :  The name of the interface, for example "vcan0"
+  * Returns:
+  *    bool - true if the interface was opened, the simulated bus is kept otherwise
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+bool Host_Drv_OpenCAN(const char *const interfaceName) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function closes the SocketCAN interface and returns the CAN
+  *    driver to the simulated bus.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Host_Drv_CloseCAN(void);
+
+/** Description:
+  *    This function sets the error state of the simulated CAN node, which
+  *    the driver samples with its next update.  The error warning is set
+  *    while a counter is at least 96.  A bus-off node sends no frames until
+  *    the state is set again, and a last error code is cleared once it was
+  *    sampled, as on the device.
+  * Parameters:
+  *    transmitErrorCount :  The transmit error counter
+  *    receiveErrorCount :   The receive error counter
+  *    lastErrorCode :       The last error code (LEC), 0 for no error
+  *    isBusOff :            true while the node is bus-off
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Host_Drv_SetCANNodeState(const uint8_t transmitErrorCount, const uint8_t receiveErrorCount, const uint8_t lastErrorCode, const bool isBusOff);
+
+/** Description:
+  *    This function sets the waveform converted by the simulated ADC, such
+  *    as a recording of the inputs.  Each scan takes the next
+  *    ADC_DRV_CHANNEL_Count results, in channel enumeration order, and the
+  *    waveform repeats after numScans scans.  Only the lower 12 bits are
+  *    converted.  The replay starts over when the ADC driver is initialized,
+  *    without a waveform every result is mid-scale.
+  * Parameters:
+  *    samples :   numScans * ADC_DRV_CHANNEL_Count results, kept by the caller
+  *                until the replay is removed
+  *    numScans :  The number of scans in samples, 0 removes the waveform
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Host_Drv_ReplayADC(const uint16_t *const samples, const uint32_t numScans);
+
+/** Description:
+  *    This function simulates a power loss during the next flash operation.
+  *    Only the first numBytes of the page being programmed, or of the area
+  *    being erased, are changed.  The operation then stays busy until the
+  *    firmware is started again, the flash contents are kept.
+  * Parameters:
+  *    numBytes :  The part of the operation done before the power is lost
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Host_Drv_InterruptFlash(const uint32_t numBytes);
+
+/** Description:
+  *    This function returns the number of times a flash sector was erased,
+  *    so tests can check the wear of the flash.
+  * Parameters:
+  *    address :  An address in the FLASH_DRV_SECTOR_SIZE sector
+  * Returns:
+  *    uint32_t - The number of erases since the start, an interrupted erase
+  *               is counted
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+uint32_t Host_Drv_GetFlashEraseCount(const uint32_t address);
+
+/** Description:
+  *    This function returns the number of times the firmware requested a
+  *    device reset.  The host keeps running after a reset request.
+  * Returns:
+  *    uint32_t - The number of reset requests since the start
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+uint32_t Host_Drv_GetNumResets(void);
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
@@ -0,0 +1,343 @@
+/*******************************************************************************
+// Real-time Clock Driver
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "RTC_Drv.h"
+#include "RTC_Drv_ConfigTable.h"
+// Platform Includes
+#include "Lunar_MessageRouter.h"
+#include "Platform.h"
+// Other Includes
+#include <stdint.h>
+#include <time.h>
+#include "Timebase_Drv.h"
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The <time.h> year offset is 1900 (Ex. 100 = Year 2000)
+#define TM_YEAR_OFFSET (1900U)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// This structure defines the internal variables used by the module
+typedef struct
+{
+   // Used to track the module enable state
+   bool enableState;
+
+   // The clock time in Unix seconds at the last start or set of the clock
+   time_t startTime;
+
+   // The tick count at that time, the clock follows the simulated time
+   uint32_t startTickCount;
+
+   // The clock time while the clock is stopped
+   time_t stoppedTime;
+} RTC_Status_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The variable used for holding all internal data for this module.
+static RTC_Status_t status;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function returns the clock time.
+  * Returns:
+  *    time_t - The clock time in Unix seconds (Seconds past 1/1/1970)
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static time_t GetClockTime(void);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Get the clock time
+static time_t GetClockTime(void)
+{
+   time_t clockTime = status.stoppedTime;
+
+   if (status.enableState)
+   {
+      clockTime = status.startTime + (time_t)((Timebase_Drv_GetCurrentTickCount() - status.startTickCount) / TIMEBASE_DRV_NUM_TICKS_PER_SECOND);
+   }
+
+   return(clockTime);
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Initialize and start the clock
+void RTC_Drv_Init(void)
+{
+   // The host always starts from power on, so the default time is set
+   struct tm tm = { 0 };
+
+   tm.tm_year = (int)rtcConfigTable.time.year - (int)TM_YEAR_OFFSET;
+   tm.tm_mon = (int)rtcConfigTable.time.month;
+   tm.tm_mday = (int)rtcConfigTable.time.days + 1;
+   tm.tm_hour = (int)rtcConfigTable.time.hours;
+   tm.tm_min = (int)rtcConfigTable.time.minutes;
+   tm.tm_sec = (int)rtcConfigTable.time.seconds;
+
+   status.enableState = false;
+   status.stoppedTime = timegm(&tm);
+
+   RTC_Drv_SetEnableState(true);
+}
+
+
+// See if the clock is active
+bool RTC_Drv_GetEnableState(void)
+{
+   // Just return the status of the clock
+   return(status.enableState);
+}
+
+
+// Start or stop the clock
+void RTC_Drv_SetEnableState(const bool newEnableState)
+{
+   // See if we are changing the enable state
+   if (status.enableState != newEnableState)
+   {
+      if (newEnableState)
+      {
+         // Continue from the time the clock was stopped
+         status.startTime = status.stoppedTime;
+         status.startTickCount = Timebase_Drv_GetCurrentTickCount();
+      }
+      else
+      {
+         status.stoppedTime = GetClockTime();
+      }
+
+      // Store the new state
+      status.enableState = newEnableState;
+   }
+}
+
+
+// Get the current time in common RTC Drvier format
+void RTC_Drv_GetCurrentTime(RTC_Drv_DateTime_t *const dateTime)
+{
+   const time_t secondsTime = GetClockTime();
+   struct tm timeStruct;
+
+   gmtime_r(&secondsTime, &timeStruct);
+
+   // Populate the response data
+   dateTime->time.seconds = timeStruct.tm_sec;
+   dateTime->time.minutes = timeStruct.tm_min;
+   dateTime->time.hours = timeStruct.tm_hour;
+   dateTime->time.timeFormat = RTC_DRV_TIME_FORMAT_24_HOUR;
+   // Days are 1-based (e.g. 1st of month = 1)
+   dateTime->date.day = timeStruct.tm_mday;
+   // Year is offset from 1900
+   // Return to user as full year
+   dateTime->date.year = timeStruct.tm_year + TM_YEAR_OFFSET;
+   // Month is 0-based (Ex: Jan = 0)
+   // Send to user as 1-based
+   dateTime->date.month = (RTC_Drv_Month_t)(timeStruct.tm_mon + 1);
+   dateTime->date.dayOfWeek = (RTC_Drv_DayOfWeek_t)(timeStruct.tm_wday);
+}
+
+
+// Set the time using common RTC Driver format
+bool RTC_Drv_SetCurrentTime(const RTC_Drv_DateTime_t *const dateTime)
+{
+   // 12-hour times are 0-11 and are converted to 24-hour below
+   uint8_t maxHours = (dateTime->time.timeFormat == RTC_DRV_TIME_FORMAT_24_HOUR) ? 23U : 11U;
+
+   // Reject the same values as the device driver
+   bool isValid = (dateTime->date.month >= RTC_DRV_MONTH_JANUARY) && (dateTime->date.month <= RTC_DRV_MONTH_DECEMBER) &&
+                  (dateTime->date.day >= 1U) && (dateTime->date.day <= 31U) &&
+                  (dateTime->date.dayOfWeek < RTC_DRV_DAY_Count) &&
+                  (dateTime->time.timeFormat < RTC_DRV_TIME_FORMAT_Count) &&
+                  (dateTime->time.hours <= maxHours) && (dateTime->time.minutes <= 59U) && (dateTime->time.seconds <= 59U);
+
+   if (isValid)
+   {
+      struct tm tm = { 0 };
+
+      tm.tm_sec = dateTime->time.seconds;
+      tm.tm_min = dateTime->time.minutes;
+      tm.tm_hour = dateTime->time.hours;
+      // Adjust time if 12 hour/PM
+      if (dateTime->time.timeFormat == RTC_DRV_TIME_FORMAT_PM)
+      {
+         // Add 12 hours when time is sent as 12HR and PM is selected
+         tm.tm_hour += 12;
+      }
+      tm.tm_mday = dateTime->date.day;
+      tm.tm_mon = (int)dateTime->date.month - 1;
+      tm.tm_year = (int)dateTime->date.year - (int)TM_YEAR_OFFSET;
+
+      // The day of the week follows from the date
+      status.stoppedTime = timegm(&tm);
+      status.startTime = status.stoppedTime;
+      status.startTickCount = Timebase_Drv_GetCurrentTickCount();
+   }
+
+   return(isValid);
+}
+
+
+/*******************************************************************************
+// Message Router Function Implementations
+*******************************************************************************/
+
+
+// Handler for GetCurrentDateTime message
+void RTC_Drv_MessageRouter_GetCurrentDateTime(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the response data
+   PLATFORM_PACK_START(1)
+   typedef struct
+   {
+      // YYYY,MM,DD,DoW, HH,MM,SS
+      // Date is packed version of RTC_Drv_Date_t
+      uint16_t year;
+      RTC_Drv_Month_t month;
+      uint8_t day;
+      RTC_Drv_DayOfWeek_t dayOfWeek;
+      // Time is packed version of RTC_Drv_Time_t
+      uint8_t hours;
+      uint8_t minutes;
+      uint8_t seconds;
+      RTC_Drv_TimeFormat_t timeFormat;
+   } PLATFORM_ATTRIBUTE_PACKED Response_t;
+   PLATFORM_PACK_END()
+
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   {
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      // Get the Time from RTC Driver function
+      RTC_Drv_DateTime_t dateTime;
+
+      RTC_Drv_GetCurrentTime(&dateTime);
+
+      // Place item in response
+      // Date
+      response->year = dateTime.date.year;
+      response->month = dateTime.date.month;
+      response->day = dateTime.date.day;
+      response->dayOfWeek = dateTime.date.dayOfWeek;
+      // Time
+      response->hours = dateTime.time.hours;
+      response->minutes = dateTime.time.minutes;
+      response->seconds = dateTime.time.seconds;
+      response->timeFormat = dateTime.time.timeFormat;
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+
+// Handler for SetCurrentDateTime message
+void RTC_Drv_MessageRouter_SetCurrentDateTime(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the response data
+   PLATFORM_PACK_START(1)
+   typedef struct
+   {
+      // YYYY,MM,DD,DoW, HH,MM,SS
+      // Date is packed version of RTC_Drv_Date_t
+      uint16_t year;
+      RTC_Drv_Month_t month;
+      uint8_t day;
+      RTC_Drv_DayOfWeek_t dayOfWeek;
+      // Time is packed version of RTC_Drv_Time_t
+      uint8_t hours;
+      uint8_t minutes;
+      uint8_t seconds;
+      RTC_Drv_TimeFormat_t timeFormat;
+   } PLATFORM_ATTRIBUTE_PACKED Command_t;
+   PLATFORM_PACK_END()
+
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), 0))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      RTC_Drv_DateTime_t dateTime;
+
+      // Date
+      dateTime.date.year = command->year;
+      dateTime.date.month = command->month;
+      dateTime.date.day = command->day;
+      dateTime.date.dayOfWeek = command->dayOfWeek;
+      // Time
+      dateTime.time.hours = command->hours;
+      dateTime.time.minutes = command->minutes;
+      dateTime.time.seconds = command->seconds;
+      dateTime.time.timeFormat = command->timeFormat;
+
+      // Call the driver set function, the time is not changed if it is invalid
+      if (!RTC_Drv_SetCurrentTime(&dateTime))
+      {
+         message->responseCode = LUNAR_MESSAGEROUTER_RESPONSE_CODE_InvalidParameter;
+      }
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, 0);
+   }
+}
+
+
@@ -0,0 +1,101 @@
+/*******************************************************************************
+// Reset Driver
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Reset_Drv.h"
+// Platform Includes
+#include "Host_Drv.h"
+// Other Includes
+#include <string.h> // Used for memcpy
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// This structure defines the internal variables used by the module
+typedef struct
+{
+   // The number of reset requests, the host keeps running after each one
+   uint32_t numResets;
+} Reset_Status_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The variable used for holding all internal data for this module.
+static Reset_Status_t status;
+
+// A fixed chip ID, so identifiers derived from it are the same in every run
+static const uint8_t uniqueId[RESET_DRV_UNIQUE_ID_LENGTH] =
+{
+   0x48U, 0x4FU, 0x53U, 0x54U, 0x00U, 0x01U, 0x02U, 0x03U,
+   0x04U, 0x05U, 0x06U, 0x07U, 0x08U, 0x09U, 0x0AU, 0x0BU
+};
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Initializes the module
+void Reset_Drv_Init(void)
+{
+   // Reset requests are counted over every start of the firmware
+}
+
+
+// Returns a value representing the reason for the previous reset
+uint32_t Reset_Drv_GetResetReason(void)
+{
+   // The host always starts from power on, there is no reason to report
+   return(0U);
+}
+
+
+// Reset the device immediately
+void Reset_Drv_Execute(void)
+{
+   // Only count the request, the test decides what a reset means for it
+   status.numResets++;
+}
+
+
+// Copy the unique chip ID
+void Reset_Drv_GetUniqueId(uint8_t *const id)
+{
+   memcpy(id, uniqueId, RESET_DRV_UNIQUE_ID_LENGTH);
+}
+
+
+/*******************************************************************************
+// Host Test Function Implementations
+*******************************************************************************/
+
+// Get the number of reset requests
+uint32_t Host_Drv_GetNumResets(void)
+{
+   return(status.numResets);
+}
@@ -0,0 +1,89 @@
+/*******************************************************************************
+// SysTick Driver
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "SysTick_Drv.h"
+#include "SysTick_Drv_Config.h"
+// Platform Includes
+#include "Host_Drv.h"
+#include "Timebase_Drv_Config.h"
+// Other Includes
+#include <stdint.h>
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The length of a tick in microseconds
+#define MICROSECONDS_PER_TICK (1000000U / TIMEBASE_DRV_NUM_TICKS_PER_SECOND)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// 32-bit system tick counter used for software timers
+// In the current implementation, this value is read by the Timebase module
+// to prevent the overhead of calling a function.
+volatile uint32_t SysTick_Drv_sysTickCount = 0U;
+
+// The microseconds passed since the last tick, read by the Timebase module
+// for the cycle counter
+uint32_t SysTick_Drv_tickMicroseconds = 0U;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Initialize module
+void SysTick_Drv_Init(void)
+{
+   // The simulated time starts over with every start of the firmware
+   SysTick_Drv_sysTickCount = 0U;
+   SysTick_Drv_tickMicroseconds = 0U;
+}
+
+
+// Get the current SysTick value
+uint32_t SysTick_Drv_GetCurrentTickCount(void)
+{
+   // Simply return the current SysTick value
+   return(SysTick_Drv_sysTickCount);
+}
+
+
+/*******************************************************************************
+// Host Test Function Implementations
+*******************************************************************************/
+
+// Advance the simulated time
+void Host_Drv_AdvanceTime(const uint32_t microseconds)
+{
+   uint32_t totalMicroseconds = SysTick_Drv_tickMicroseconds + microseconds;
+
+   // Count every tick that passed, as the interrupt would
+   SysTick_Drv_sysTickCount += totalMicroseconds / MICROSECONDS_PER_TICK;
+   SysTick_Drv_tickMicroseconds = totalMicroseconds % MICROSECONDS_PER_TICK;
+}
@@ -0,0 +1,78 @@
+/*******************************************************************************
+// Timebase Module
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Timebase_Drv.h"
+#include "Timebase_Drv_Config.h"
+// Platform Includes
+#include "Host_Drv.h"
+#include "SysTick_Drv.h"
+#include "SysTick_Drv_Config.h"
+// Other Includes
+#include <stdint.h>
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The number of simulated cycles in a microsecond and in a tick
+#define CYCLES_PER_MICROSECOND (HOST_DRV_CYCLES_PER_SECOND / 1000000U)
+#define CYCLES_PER_TICK (HOST_DRV_CYCLES_PER_SECOND / TIMEBASE_DRV_NUM_TICKS_PER_SECOND)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The microseconds since the last tick, kept by the SysTick driver
+extern uint32_t SysTick_Drv_tickMicroseconds;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Timebase_Drv_Init not needed since SysTick is used for the timebase in this implementation
+
+// Returns current Timebase tick value
+uint32_t Timebase_Drv_GetCurrentTickCount(void)
+{
+   // Simply return the current SysTick value
+   return(SysTick_Drv_sysTickCount);
+}
+
+
+// Returns the simulated cycle count
+uint32_t Timebase_Drv_GetCycleCount(void)
+{
+   // The count wraps like the device counter, so only differences are used
+   return((SysTick_Drv_sysTickCount * CYCLES_PER_TICK) + (SysTick_Drv_tickMicroseconds * CYCLES_PER_MICROSECOND));
+}
+
+
+// Returns the rate of the cycle counter
+uint32_t Timebase_Drv_GetCyclesPerSecond(void)
+{
+   return(HOST_DRV_CYCLES_PER_SECOND);
+}
@@ -0,0 +1,165 @@
+/*******************************************************************************
+// UART Driver
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "UART_Drv.h" // Driver API
+#include "UART_Drv_Config.h" // Channel enumeration
+// Platform Includes
+#include "Host_Drv.h"
+#include "Lunar_CircularBufferLib.h"
+// Other Includes
+#include <stdint.h>
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// Size of the local circular buffer used for receiving data, as on the device
+#define RX_BUFFER_SIZE (128)
+
+// Size of the buffer holding the written data until the test takes it.  The
+// device sends while the firmware runs, so this is larger than its buffer.
+#define TX_BUFFER_SIZE (4096)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// Structure to hold the circular buffers for each port
+typedef struct
+{
+   // Defines all parameters for the RX circular buffer.
+   Lunar_CircularBufferLib_t rxCircularBuffer;
+
+   // RX data buffer.
+   uint8_t rxCircularBufferData[RX_BUFFER_SIZE];
+
+   // Defines all parameters for the TX circular buffer.
+   Lunar_CircularBufferLib_t txCircularBuffer;
+
+   // TX data buffer.
+   uint8_t txCircularBufferData[TX_BUFFER_SIZE];
+} PortBuffers_t;
+
+// This structure holds the private information for this module
+typedef struct
+{
+   // Create one buffer object for each UART port used
+   PortBuffers_t portBuffers[UART_DRV_CHANNEL_Count];
+} UART_Status_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// Status structure for this module
+static UART_Status_t status;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Initialize all configured UART channels
+void UART_Drv_Init(void)
+{
+   // Loop through the UART channels and init each one
+   for (uint8_t channel = 0U; channel < UART_DRV_CHANNEL_Count; channel++)
+   {
+      // Store the buffer object for easy access
+      PortBuffers_t *portBuffer = &(status.portBuffers[channel]);
+
+      // Initialize the Circular TX Buffer
+      Lunar_CircularBufferLib_Init(&(portBuffer->txCircularBuffer), portBuffer->txCircularBufferData, sizeof(portBuffer->txCircularBufferData));
+      // Initialize the Circular RX Buffer
+      Lunar_CircularBufferLib_Init(&(portBuffer->rxCircularBuffer), portBuffer->rxCircularBufferData, sizeof(portBuffer->rxCircularBufferData));
+   }
+}
+
+// Write data to the given UART
+void UART_Drv_Write(const UART_Drv_Channel_t channel, uint8_t *const data, const uint8_t length)
+{
+   // Verify the given channel and buffer
+   if ((channel < UART_DRV_CHANNEL_Count) && (data != 0))
+   {
+      // Loop through the given data and add to the circular buffer
+      // The data is sent once the test takes it
+      for (uint8_t i = 0U; i < length; i++)
+      {
+         Lunar_CircularBufferLib_Enqueue(&(status.portBuffers[channel].txCircularBuffer), data[i]);
+      }
+   }
+}
+
+// Read a byte from the RX circular buffer
+bool UART_Drv_ReadByte(const UART_Drv_Channel_t channel, uint8_t *byteRead)
+{
+   bool result = false;
+
+   // Verify the given channel and buffer are valid
+   if ((channel < UART_DRV_CHANNEL_Count) && (byteRead != 0))
+   {
+      // Get the next byte from the buffer, if available
+      result = Lunar_CircularBufferLib_Dequeue(&(status.portBuffers[channel].rxCircularBuffer), byteRead);
+   }
+
+   return(result);
+}
+
+
+/*******************************************************************************
+// Host Test Function Implementations
+*******************************************************************************/
+
+// Receive bytes as the receive interrupt would
+uint32_t Host_Drv_ReceiveUART(const UART_Drv_Channel_t channel, const uint8_t *const data, const uint32_t length)
+{
+   uint32_t numReceived = 0U;
+
+   if (channel < UART_DRV_CHANNEL_Count)
+   {
+      // The receive buffer drops its oldest byte when it is full
+      while ((numReceived < length) &&
+             (Lunar_CircularBufferLib_Enqueue(&(status.portBuffers[channel].rxCircularBuffer), data[numReceived])))
+      {
+         numReceived++;
+      }
+   }
+
+   return(numReceived);
+}
+
+// Take the bytes written by the firmware
+uint32_t Host_Drv_TakeUARTOutput(const UART_Drv_Channel_t channel, uint8_t *const data, const uint32_t maxLength)
+{
+   uint32_t numTaken = 0U;
+
+   if (channel < UART_DRV_CHANNEL_Count)
+   {
+      while ((numTaken < maxLength) &&
+             (Lunar_CircularBufferLib_Dequeue(&(status.portBuffers[channel].txCircularBuffer), &data[numTaken])))
+      {
+         numTaken++;
+      }
+   }
+
+   return(numTaken);
+}
@@ -0,0 +1,435 @@
+/*******************************************************************************
+// ADC Driver
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "ADC_Drv.h" // Driver API
+#include "ADC_Drv_Config.h" // Channel enumeration
+#include "ADC_Drv_ConfigTable.h" // Channel configuration
+// Platform Includes
+#include "Lunar_EventMgr.h"
+#include "Lunar_MessageRouter.h"
+#include "Platform.h"
+#include "Timebase_Drv.h"
+// Other Includes
+#include "xmc_ccu4.h" // Scan trigger timer
+#include "xmc_dma.h" // Result transfer
+#include "xmc_gpio.h" // Analog input pins
+#include "xmc_scu.h" // Clock frequencies
+#include "xmc_vadc.h" // Converter
+#include <stddef.h> // NULL
+#include <string.h> // memset
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The number of buffers the DMA alternates between
+#define NUM_BUFFERS (2U)
+
+// The number of results in a buffer, which is the DMA block size
+// The DMA block size is limited to 4095 transfers
+#define RESULTS_PER_BUFFER (ADC_DRV_SAMPLES_PER_BUFFER * ADC_DRV_CHANNEL_Count)
+
+// Index used before the first buffer is complete
+#define NO_BUFFER_INDEX (0xFFU)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// Status structure for this module
+typedef struct
+{
+   // The number of buffers completed by the DMA, counted in the interrupt
+   volatile uint32_t numBuffersCompleted;
+
+   // The buffer completed last and the time it completed, set in the interrupt
+   volatile uint8_t completedBufferIndex;
+   volatile uint32_t completedBufferTime;
+
+   // The number of DMA error events
+   volatile uint32_t numDmaErrors;
+
+   // The number of completed buffers handed over by the update function
+   uint32_t numBuffersReady;
+
+   // The buffer handed over last and the time it completed
+   // These only change in the update function, so a consumer sees a
+   // consistent pair while it handles the buffer ready event
+   uint8_t readyBufferIndex;
+   uint32_t readyBufferTime;
+
+   // The number of buffers that completed before the previous buffer was
+   // handed over, their samples were not seen by the consumers
+   uint32_t numOverruns;
+} ADC_Drv_Status_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// Status structure for this module
+static ADC_Drv_Status_t status;
+
+// The sample buffers, the DMA writes one while the other is handed over
+static ADC_Drv_Buffer_t buffers[NUM_BUFFERS];
+
+// The DMA linked list, each item fills one buffer and links to the other
+static XMC_DMA_LLI_t dmaList[NUM_BUFFERS];
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function sets up the DMA channel that moves each result from the
+  *    global result register into the buffers.  The two linked list items
+  *    point to each other, so the channel switches buffers without the CPU.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void DmaInit(void);
+
+/** Description:
+  *    This function sets up the converter for the background scan of the
+  *    configured channels.  Every result goes to the global result register,
+  *    which waits until the DMA read it, and requests the DMA.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void VadcInit(void);
+
+/** Description:
+  *    This function starts the timer that triggers a scan at the sample rate.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void TriggerInit(void);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Set up the DMA to fill the buffers in turn
+static void DmaInit(void)
+{
+   XMC_DMA_CH_CONFIG_t dmaConfig;
+   uint8_t index;
+
+   // Each item fills a buffer and links to the other buffer
+   for (index = 0U; index < NUM_BUFFERS; index++)
+   {
+      memset(&dmaList[index], 0, sizeof(XMC_DMA_LLI_t));
+      dmaList[index].src_addr = (uint32_t)&VADC->GLOBRES;
+      dmaList[index].dst_addr = (uint32_t)&buffers[index].samples[0][0];
+      dmaList[index].llp = &dmaList[(index + 1U) % NUM_BUFFERS];
+      dmaList[index].enable_interrupt = 1U;
+      // The result is in the low half of the register
+      dmaList[index].src_transfer_width = (uint32_t)XMC_DMA_CH_TRANSFER_WIDTH_16;
+      dmaList[index].dst_transfer_width = (uint32_t)XMC_DMA_CH_TRANSFER_WIDTH_16;
+      dmaList[index].src_address_count_mode = (uint32_t)XMC_DMA_CH_ADDRESS_COUNT_MODE_NO_CHANGE;
+      dmaList[index].dst_address_count_mode = (uint32_t)XMC_DMA_CH_ADDRESS_COUNT_MODE_INCREMENT;
+      dmaList[index].src_burst_length = (uint32_t)XMC_DMA_CH_BURST_LENGTH_1;
+      dmaList[index].dst_burst_length = (uint32_t)XMC_DMA_CH_BURST_LENGTH_1;
+      dmaList[index].transfer_flow = (uint32_t)XMC_DMA_CH_TRANSFER_FLOW_P2M_DMA;
+      dmaList[index].enable_src_linked_list = 1U;
+      dmaList[index].enable_dst_linked_list = 1U;
+      dmaList[index].block_size = RESULTS_PER_BUFFER;
+   }
+
+   // The channel loads the first item when it is enabled
+   memset(&dmaConfig, 0, sizeof(XMC_DMA_CH_CONFIG_t));
+   dmaConfig.control = dmaList[0].control;
+   dmaConfig.src_addr = dmaList[0].src_addr;
+   dmaConfig.dst_addr = dmaList[0].dst_addr;
+   dmaConfig.linked_list_pointer = &dmaList[0];
+   dmaConfig.block_size = (uint16_t)RESULTS_PER_BUFFER;
+   dmaConfig.transfer_type = XMC_DMA_CH_TRANSFER_TYPE_MULTI_BLOCK_SRCADR_LINKED_DSTADR_LINKED;
+   dmaConfig.priority = XMC_DMA_CH_PRIORITY_7;
+   dmaConfig.src_handshaking = XMC_DMA_CH_SRC_HANDSHAKING_HARDWARE;
+   dmaConfig.src_peripheral_request = ADC_DRV_DMA_REQUEST;
+
+   XMC_DMA_Init(XMC_DMA0);
+   (void)XMC_DMA_CH_Init(XMC_DMA0, ADC_DRV_DMA_CHANNEL, &dmaConfig);
+   XMC_DMA_CH_EnableEvent(XMC_DMA0, ADC_DRV_DMA_CHANNEL, (uint32_t)XMC_DMA_CH_EVENT_BLOCK_TRANSFER_COMPLETE | (uint32_t)XMC_DMA_CH_EVENT_ERROR);
+
+   // Set priority and enable NVIC node for the block complete interrupt
+   NVIC_SetPriority(ADC_DRV_DMA_IRQ_NUM, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), ADC_DRV_DMA_IRQ_PRIORITY, 0U));
+   NVIC_EnableIRQ(ADC_DRV_DMA_IRQ_NUM);
+
+   XMC_DMA_CH_Enable(XMC_DMA0, ADC_DRV_DMA_CHANNEL);
+}
+
+// Set up the converter for the background scan
+static void VadcInit(void)
+{
+   XMC_VADC_GLOBAL_CONFIG_t globalConfig;
+   XMC_VADC_BACKGROUND_CONFIG_t backgroundConfig;
+   XMC_VADC_CHANNEL_CONFIG_t channelConfig;
+   uint8_t index;
+
+   // All channels use the 12-bit conversion class 0 and the global result
+   // register, which holds a result until it is read
+   memset(&globalConfig, 0, sizeof(XMC_VADC_GLOBAL_CONFIG_t));
+   globalConfig.clock_config.analog_clock_divider = ADC_DRV_ANALOG_CLOCK_DIVIDER;
+   globalConfig.class0.conversion_mode_standard = (uint32_t)XMC_VADC_CONVMODE_12BIT;
+   globalConfig.wait_for_read_mode = 1U;
+   globalConfig.event_gen_enable = 1U;
+   XMC_VADC_GLOBAL_Init(VADC, &globalConfig);
+
+   XMC_VADC_GROUP_SetPowerMode(ADC_DRV_GROUP, XMC_VADC_GROUP_POWERMODE_NORMAL);
+   XMC_VADC_GLOBAL_StartupCalibration(VADC);
+
+   // Each trigger loads the sequence and converts it once
+   memset(&backgroundConfig, 0, sizeof(XMC_VADC_BACKGROUND_CONFIG_t));
+   backgroundConfig.conv_start_mode = (uint32_t)XMC_VADC_STARTMODE_WFS;
+   backgroundConfig.req_src_priority = (uint32_t)XMC_VADC_GROUP_RS_PRIORITY_0;
+   backgroundConfig.trigger_signal = (uint32_t)ADC_DRV_TRIGGER_INPUT;
+   backgroundConfig.trigger_edge = (uint32_t)XMC_VADC_TRIGGER_EDGE_RISING;
+   backgroundConfig.gate_signal = (uint32_t)XMC_VADC_REQ_GT_A;
+   backgroundConfig.external_trigger = 1U;
+   backgroundConfig.enable_auto_scan = 0U;
+   backgroundConfig.load_mode = (uint32_t)XMC_VADC_SCAN_LOAD_OVERWRITE;
+   XMC_VADC_GLOBAL_BackgroundInit(VADC, &backgroundConfig);
+
+   memset(&channelConfig, 0, sizeof(XMC_VADC_CHANNEL_CONFIG_t));
+   channelConfig.input_class = (uint32_t)XMC_VADC_CHANNEL_CONV_GLOBAL_CLASS0;
+   channelConfig.use_global_result = 1U;
+   channelConfig.alias_channel = (int8_t)XMC_VADC_CHANNEL_ALIAS_DISABLED;
+
+   for (index = 0U; index < (uint8_t)ADC_DRV_CHANNEL_Count; index++)
+   {
+      const ADC_Drv_ChannelConfigItem_t *channel = &adcChannelConfigTable[index];
+
+      // The pins are analog inputs only
+      XMC_GPIO_DisableDigitalInput(channel->pin.port, channel->pin.pin);
+
+      XMC_VADC_GROUP_ChannelInit(ADC_DRV_GROUP, channel->channelNumber, &channelConfig);
+      XMC_VADC_GLOBAL_BackgroundAddChannelToSequence(VADC, ADC_DRV_GROUP_INDEX, channel->channelNumber);
+   }
+
+   // The result event requests the DMA through the common service request,
+   // its interrupt stays disabled in the NVIC
+   XMC_VADC_GLOBAL_SetResultEventInterruptNode(VADC, XMC_VADC_SR_SHARED_SR0);
+}
+
+// Start the scan trigger timer
+static void TriggerInit(void)
+{
+   XMC_CCU4_SLICE_COMPARE_CONFIG_t timerConfig;
+   const uint32_t period = XMC_SCU_CLOCK_GetCcuClockFrequency() / ADC_DRV_SAMPLE_RATE_HZ;
+
+   memset(&timerConfig, 0, sizeof(XMC_CCU4_SLICE_COMPARE_CONFIG_t));
+   timerConfig.timer_mode = (uint32_t)XMC_CCU4_SLICE_TIMER_COUNT_MODE_EA;
+   timerConfig.prescaler_mode = (uint32_t)XMC_CCU4_SLICE_PRESCALER_MODE_NORMAL;
+   timerConfig.prescaler_initval = (uint32_t)XMC_CCU4_SLICE_PRESCALER_1;
+
+   XMC_CCU4_Init(ADC_DRV_TRIGGER_MODULE, XMC_CCU4_SLICE_MCMS_ACTION_TRANSFER_PR_CR);
+   XMC_CCU4_SLICE_CompareInit(ADC_DRV_TRIGGER_SLICE, &timerConfig);
+   XMC_CCU4_SLICE_SetTimerPeriodMatch(ADC_DRV_TRIGGER_SLICE, (uint16_t)(period - 1U));
+   XMC_CCU4_EnableShadowTransfer(ADC_DRV_TRIGGER_MODULE, ADC_DRV_TRIGGER_SHADOW_TRANSFER);
+
+   // The period match triggers the scan, no interrupt is enabled for it
+   XMC_CCU4_SLICE_EnableEvent(ADC_DRV_TRIGGER_SLICE, XMC_CCU4_SLICE_IRQ_ID_PERIOD_MATCH);
+   XMC_CCU4_SLICE_SetInterruptNode(ADC_DRV_TRIGGER_SLICE, XMC_CCU4_SLICE_IRQ_ID_PERIOD_MATCH, ADC_DRV_TRIGGER_SERVICE_REQUEST);
+
+   XMC_CCU4_EnableClock(ADC_DRV_TRIGGER_MODULE, ADC_DRV_TRIGGER_SLICE_NUMBER);
+   XMC_CCU4_SLICE_StartTimer(ADC_DRV_TRIGGER_SLICE);
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Initialize the converter and start the acquisition
+void ADC_Drv_Init(void)
+{
+   memset(&status, 0, sizeof(ADC_Drv_Status_t));
+   status.completedBufferIndex = NO_BUFFER_INDEX;
+   status.readyBufferIndex = NO_BUFFER_INDEX;
+
+   // The DMA must wait for the first result before the scans start
+   DmaInit();
+   VadcInit();
+   TriggerInit();
+}
+
+// Scheduled function to hand over the completed buffers
+void ADC_Drv_Update(void)
+{
+   uint32_t numBuffersCompleted;
+   uint8_t completedBufferIndex;
+   uint32_t completedBufferTime;
+
+   // Take the buffer and its time together, the interrupt may swap them
+   __disable_irq();
+   numBuffersCompleted = status.numBuffersCompleted;
+   completedBufferIndex = status.completedBufferIndex;
+   completedBufferTime = status.completedBufferTime;
+   __enable_irq();
+
+   if (numBuffersCompleted != status.numBuffersReady)
+   {
+      // Only the newest buffer is handed over, older ones were overwritten
+      status.numOverruns += numBuffersCompleted - status.numBuffersReady - 1U;
+      status.numBuffersReady = numBuffersCompleted;
+      status.readyBufferIndex = completedBufferIndex;
+      status.readyBufferTime = completedBufferTime;
+
+      Lunar_EventMgr_HandleEvent(LUNAR_EVENTMGR_CONFIG_EVENT_ADC_BufferReady);
+   }
+   else
+   {
+      // No new buffer
+   }
+}
+
+// Returns the buffer handed over last
+const ADC_Drv_Buffer_t *ADC_Drv_GetReadyBuffer(void)
+{
+   const ADC_Drv_Buffer_t *buffer = NULL;
+
+   if (status.readyBufferIndex < NUM_BUFFERS)
+   {
+      buffer = &buffers[status.readyBufferIndex];
+   }
+   else
+   {
+      // No buffer complete yet
+   }
+
+   return(buffer);
+}
+
+// Returns the time the buffer handed over last was completed
+uint32_t ADC_Drv_GetReadyBufferTime(void)
+{
+   return(status.readyBufferTime);
+}
+
+
+/*******************************************************************************
+// Message Router Function Implementations
+*******************************************************************************/
+
+// Message handler to get the acquisition status
+void ADC_Drv_MessageRouter_GetStatus(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // The acquisition settings
+      uint32_t sampleRateHz;
+      uint16_t samplesPerBuffer;
+      uint16_t numChannels;
+      // Buffers completed by the DMA and buffers the consumers missed
+      uint32_t numBuffers;
+      uint32_t numOverruns;
+      uint32_t numDmaErrors;
+      // The last scan of the ready buffer, in channel enumeration order
+      uint16_t lastSamples[ADC_DRV_CHANNEL_Count];
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   {
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+      const ADC_Drv_Buffer_t *buffer = ADC_Drv_GetReadyBuffer();
+      uint8_t channel;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      response->sampleRateHz = ADC_DRV_SAMPLE_RATE_HZ;
+      response->samplesPerBuffer = ADC_DRV_SAMPLES_PER_BUFFER;
+      response->numChannels = ADC_DRV_CHANNEL_Count;
+      response->numBuffers = status.numBuffersCompleted;
+      response->numOverruns = status.numOverruns;
+      response->numDmaErrors = status.numDmaErrors;
+
+      for (channel = 0U; channel < (uint8_t)ADC_DRV_CHANNEL_Count; channel++)
+      {
+         if (buffer != NULL)
+         {
+            response->lastSamples[channel] = buffer->samples[ADC_DRV_SAMPLES_PER_BUFFER - 1U][channel];
+         }
+         else
+         {
+            response->lastSamples[channel] = 0U;
+         }
+      }
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+
+/*******************************************************************************
+// Interrupt Handlers
+*******************************************************************************/
+
+// This callback is called when the DMA completed a buffer
+// This is mapped to the XMC IRQ handler name in the config file
+void ADC_DRV_DMA_HANDLER(void)
+{
+   const uint32_t events = XMC_DMA_CH_GetEventStatus(XMC_DMA0, ADC_DRV_DMA_CHANNEL);
+   const uint32_t destination = XMC_DMA0->CH[ADC_DRV_DMA_CHANNEL].DAR;
+
+   XMC_DMA_CH_ClearEventStatus(XMC_DMA0, ADC_DRV_DMA_CHANNEL, events);
+
+   if ((events & (uint32_t)XMC_DMA_CH_EVENT_BLOCK_TRANSFER_COMPLETE) != 0U)
+   {
+      // The completed buffer is the one the channel does not write.  Before
+      // the next item is loaded the destination is the end of the completed
+      // buffer, which is the start of the next one as the buffers are
+      // contiguous, so the test holds either way.
+      if ((destination >= (uint32_t)&buffers[1]) && (destination < (uint32_t)&buffers[NUM_BUFFERS]))
+      {
+         status.completedBufferIndex = 0U;
+      }
+      else
+      {
+         status.completedBufferIndex = 1U;
+      }
+      status.completedBufferTime = Timebase_Drv_GetCycleCount();
+      status.numBuffersCompleted++;
+   }
+   else
+   {
+      // No buffer completed
+   }
+
+   if ((events & (uint32_t)XMC_DMA_CH_EVENT_ERROR) != 0U)
+   {
+      status.numDmaErrors++;
+   }
+   else
+   {
+      // No error
+   }
+}
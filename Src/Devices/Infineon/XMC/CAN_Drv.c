@@ -7,108 +7,60 @@
 *******************************************************************************/
 // Module Includes
 #include "CAN_Drv.h" // Driver API
+#include "CAN_Drv_Core.h" // Queue, receive ring and statistics
 #include "CAN_Drv_Config.h" // Channel enumeration
 #include "CAN_Drv_ConfigTable.h" // CAN port configuration
 // Platform Includes
-#include "Lunar_MessageRouter.h"
-#include "Lunar_SoftTimerLib.h"
 #include "Platform.h"
+#include "Timebase_Drv.h"
 // Other Includes
-#include "ReportMgr_CAN.h" // Autogenerated CAN messages
 #include "xmc_can.h"  // CAN driver
 #include "xmc_gpio.h" // GPIO driver header
+#include <string.h> // memset
 
 
 /*******************************************************************************
 // Private Constant Definitions
 *******************************************************************************/
 
-// The mask used for 29-bit CAN IDs
-#define CAN_EXTENDED_ID_MASK (0x80000000U)
-
 // The minimum function expected by this driver
 #define MIN_CAN_FREQUENCY    (12000000U) // 12MHz
 
 // The maximum frequency expected by the this driver
 #define MAX_CAN_FREQUENCY    (120000000U) // 120MHz
 
-// Timeout for transmitting a CAN message in milliseconds.
-#define CAN_MSG_TX_TIMEOUT_MS          (50U)
-
-// Message object dedicated to message transmission.
-#define CAN_TX_MSBOBJ            (CAN_MO0)
-
-// Index of the message object dedicated to message transmission 
-#define CAN_TX_MSBOBJ_IDX        (0)
-
-// Message object dedicated to message reception. 
-#define CAN_RX_MSBOBJ            (CAN_MO1)
-
-// Index of the message object dedicated to message reception.
-#define CAN_RX_MSBOBJ_IDX        (1)
+// The number of receive filters in the configuration table
+#define NUM_CAN_FILTERS (sizeof(canFilterConfigTable) / sizeof(CAN_Drv_FilterConfigItem_t))
 
-// This defines the maximum length of command data in bytes.
-#define COMMAND_DATA_MAX_SIZE (8)
-
-// This defines the maximum length of response data in bytes
-#define RESPONSE_DATA_MAX_SIZE (8)
-
-// Address used to identifying messages intended for any device
-#define BROADCAST_ADDRESS (0xFFU)
+// Index of the first transmit message object
+#define CAN_TX_MSG_OBJ_FIRST_IDX (0U)
 
+// Index of the first message object used by the receive filters
+#define CAN_RX_FIFO_FIRST_IDX (CAN_TX_MSG_OBJ_FIRST_IDX + CAN_DRV_NUM_TX_MSG_OBJS)
 
 /*******************************************************************************
 // Private Type Declarations
 *******************************************************************************/
 
-// Struct that defines TX/RX statistics used for debugging and testing
+// This structure defines the message objects used by a receive filter
 typedef struct
 {
-    // The number of CAN frames received by the driver
-    uint32_t numFramesReceived;
-	
-    // The number of CAN frames sent by the driver
-    uint32_t numFramesSent;
-} TxRxStatistics_t;
-
-// Structure to hold buffers and data for each port
-typedef struct
-{
-   // This is the message structure for the message that must be
-   // populated and sent to the message router for routing to the
-   // destination software module.
-   Lunar_MessageRouter_Message_t currentMessage;
-
-   // This buffer is allocated for command data and is pointed to by the
-   // command proc message structure.
-   uint8_t commandBuffer[COMMAND_DATA_MAX_SIZE];
+   // Index of the FIFO base object that holds the acceptance filter
+   uint8_t baseIndex;
 
-   // This buffer is allocated for response data and is pointed to by the
-   // command proc message structure.
-   uint8_t responseBuffer[RESPONSE_DATA_MAX_SIZE];
-
-   /** The address for this device on this port For simplicity in
-     * the driver, this initializes to BROADCAST_ADDRESS if
-     * addressing is not used                                    
-   */
-   uint8_t deviceAddress;
-
-   // Stats for transmit and receive data
-   TxRxStatistics_t statistics;
-} PortData_t;
+   // Index of the next FIFO slave object to be read
+   uint8_t readIndex;
+} RxFifo_t;
 
 
 // This structure holds the private information for this module
 typedef struct
 {
-   // Transmit message object data structure.
-   XMC_CAN_MO_t transmitMsgObj;
-
-   // Receive message object data structure.
-   XMC_CAN_MO_t receiveMsgObj;
+   // The receive FIFO for each filter
+   RxFifo_t rxFifo[NUM_CAN_FILTERS];
 
-   // Create a status object for each port used
-   PortData_t portData;
+   // The filter that is read first by the next receive, for round robin reading
+   uint8_t nextRxFilter;
 } CAN_Drv_Status_t;
 
 
@@ -126,37 +78,124 @@ static CAN_Drv_Status_t status;
 
 /** Description:
   *    This function initializes the message object used in the CAN driver.
-  * Parameters: 
+  * Parameters:
   *    channel :  The given CAN channel to be initialized.  Only a single CAN
   *    node has been tested with this implementation.
   * History:
   *    * 6/18/2021: Function created (EJH)
-  *                                                                   
+  *    * 10/19/2026: Allocate the FIFOs from the filter table (EJH)
+  *    * 10/19/2026: Enable the receive interrupt (EJH)
+  *    * 10/19/2026: Use separate transmit message objects (EJH)
+  *    * 10/19/2026: Raise the receive interrupt for sent frames (EJH)
+  *
 */
 static void CanInit(CAN_Drv_Channel_t channel);
 
 /** Description:
-  *    This function checks for a new command in the message object and returns the result.
+  *    This function configures a message object with the given identifier
+  *    and acceptance mask and allocates it to the channel.
+  * Parameters:
+  *    channel :  The CAN channel the object is allocated to
+  *    index :    The index of the message object
+  *    canId :    The identifier, bit 31 selects a 29-bit extended identifier
+  *    idMask :   The acceptance mask, only used by receive objects
+  *    type :     Transmit or receive message object
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void ConfigureMessageObject(const CAN_Drv_Channel_t channel, const uint8_t index, const uint32_t canId, const uint32_t idMask, const XMC_CAN_MO_TYPE_t type);
+
+/** Description:
+  *    This function reads the oldest frame of the next receive FIFO holding
+  *    a frame.  The FIFOs are read in turn, so no filter can starve another.
   * Parameters:
-  *    channel :  The message object where the CAN data is to be placed.
-  *    The Module ID and Command ID are also populated.
+  *    frame :  The location where the received frame is to be placed
   * Returns:
-  *    bool - The result of searching for a new to command to be sent to the message router.
-  * Return Value List:
-  *    true - A new command was located and placed into the given message object.
-  *    false - No command was found.
+  *    bool - true if a frame was read
   * History:
-  *    * 6/18/2021: Function created (EJH)
+  *    * 10/19/2026: Function created (EJH)
+  *    * 10/19/2026: Count the bits and identifier of the frame (EJH)
+  *    * 10/19/2026: Frames are counted by CAN_Drv_Core (EJH)
+  *
+*/
+static bool ReadHardwareFrame(CAN_Drv_Frame_t *const frame) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function moves every frame waiting in the receive FIFOs into the
+  *    receive ring of the core.
+  * Parameters:
+  *    channel :  The CAN channel that raised the interrupt
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void HandleChannelRXInterrupt(const CAN_Drv_Channel_t channel);
+
+/** Description:
+  *    This function passes the frame of a transmit message object that was
+  *    sent to the core and clears its transmit pending flag.
+  * Parameters:
+  *    index :  The index of the transmit message object
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *    * 10/19/2026: Capture the transmit time (EJH)
+  *    * 10/19/2026: Counting moved to CAN_Drv_Core (EJH)
+  *
+*/
+static void HandleTxComplete(const uint8_t index);
+
+/** Description:
+  *    This function counts the frames sent since the last call.  It is
+  *    called by the interrupt raised at the end of each transmission.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void HandleTxCompleteInterrupt(void);
+
+/** Description:
+  *    This function samples the error counters and state of the node.  A
+  *    node that went bus-off is restarted, it rejoins the bus after 128
+  *    occurrences of 11 recessive bits.
+  * Parameters:
+  *    channel :  The CAN channel to be sampled
+  * History:
+  *    * 10/19/2026: Function created (EJH)
   *
 */
-static bool FindNextCommand(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
-static void TriggerCommand(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+static void UpdateNodeStatistics(const CAN_Drv_Channel_t channel);
 
 
 /*******************************************************************************
 // Private Function Implementations
 *******************************************************************************/
 
+// Configure a single message object
+static void ConfigureMessageObject(const CAN_Drv_Channel_t channel, const uint8_t index, const uint32_t canId, const uint32_t idMask, const XMC_CAN_MO_TYPE_t type)
+{
+   XMC_CAN_MO_t messageObject;
+
+   // The identifier and mask fields share the register images, so start from zero
+   memset(&messageObject, 0, sizeof(messageObject));
+   messageObject.can_mo_ptr = &CAN_MO0[index];
+   messageObject.can_priority = XMC_CAN_ARBITRATION_MODE_IDE_DIR_BASED_PRIO_2;
+   messageObject.can_identifier = canId & ~CAN_DRV_EXTENDED_ID;
+   messageObject.can_id_mask = idMask & ~CAN_DRV_EXTENDED_ID;
+   messageObject.can_id_mode = ((canId & CAN_DRV_EXTENDED_ID) == 0U) ? XMC_CAN_FRAME_TYPE_STANDARD_11BITS : XMC_CAN_FRAME_TYPE_EXTENDED_29BITS;
+   messageObject.can_ide_mask = 1U;
+   messageObject.can_data_length = 0U;
+   messageObject.can_data[0] = 0U;
+   messageObject.can_data[1] = 0U;
+   messageObject.can_mo_type = type;
+   XMC_CAN_MO_Config(&messageObject);
+
+   // Only accept frames with the same identifier type
+   XMC_CAN_MO_AcceptOnlyMatchingIDE(&messageObject);
+
+   XMC_CAN_AllocateMOtoNodeList(CAN, canConfigTable[channel].channelIndex, index);
+}
+
 // Initialize the CAN channel
 static void CanInit(const CAN_Drv_Channel_t channel)
 {
@@ -171,7 +210,7 @@ static void CanInit(const CAN_Drv_Channel_t channel)
        * 16 message objects. This is sufficient for this CAN driver.
        */
       uint32_t canModuleFreqHz = XMC_SCU_CLOCK_GetPeripheralClockFrequency();
-      // increase if too low 
+      // increase if too low
       while (canModuleFreqHz < MIN_CAN_FREQUENCY)
       {
          // Double the frequency
@@ -188,7 +227,7 @@ static void CanInit(const CAN_Drv_Channel_t channel)
       // configure CAN module
 #if UC_FAMILY == XMC1
 		// XMC1000 uses a different clock definition than the XMC4000
-      XMC_CAN_Init(CAN, XMC_CAN_CANCLKSRC_MCLK, canModuleFreqHz);		
+      XMC_CAN_Init(CAN, XMC_CAN_CANCLKSRC_MCLK, canModuleFreqHz);
 #else
       // Documentation suggests using the XMC_CAN_InitEx function over the older XMC_CAN_Init
       XMC_CAN_InitEx(CAN, XMC_CAN_CANCLKSRC_FPERI, canModuleFreqHz);
@@ -202,185 +241,227 @@ static void CanInit(const CAN_Drv_Channel_t channel)
       baud.sjw = canConfig->channelConfig.sjw;
       XMC_CAN_NODE_NominalBitTimeConfigure(canConfig->channel, &baud);
 
-      // Set CCE and INIT bit NCR for node configuration 
+      // Set CCE and INIT bit NCR for node configuration
       XMC_CAN_NODE_EnableConfigurationChange(canConfig->channel);
       XMC_CAN_NODE_SetInitBit(canConfig->channel);
 
-      // Configure the transmit message object 
-      status.transmitMsgObj.can_mo_ptr = CAN_TX_MSBOBJ;
-      status.transmitMsgObj.can_priority = XMC_CAN_ARBITRATION_MODE_IDE_DIR_BASED_PRIO_2;
-      /* Set the transmit CAN identifier and negate the bit that configures it as a
-       * 29-bit extended CAN identifier.
-       */
-      uint32_t transmitId = CAN_TX_MSG_ID;
-      transmitId &= ~CAN_EXTENDED_ID_MASK;
-      if ((CAN_TX_MSG_ID & CAN_EXTENDED_ID_MASK) == 0)
-      {
-         /* 11-bit standard CAN identifier */
-         status.transmitMsgObj.can_identifier = transmitId;
-         status.transmitMsgObj.can_id_mask = transmitId;
-         status.transmitMsgObj.can_id_mode = XMC_CAN_FRAME_TYPE_STANDARD_11BITS;
-         XMC_CAN_MO_AcceptOnlyMatchingIDE(&status.transmitMsgObj);
-      }
-      else
-      {
-         /* 29-bit extended CAN identifier */
-         status.transmitMsgObj.can_identifier = transmitId;
-         status.transmitMsgObj.can_id_mask = transmitId;
-         status.transmitMsgObj.can_id_mode = XMC_CAN_FRAME_TYPE_EXTENDED_29BITS;
-         XMC_CAN_MO_AcceptOnlyMatchingIDE(&status.transmitMsgObj);
-      }
+      //-----------------------------------------------
+      // Transmit Message Objects
+      //-----------------------------------------------
 
-      status.transmitMsgObj.can_data_length = CAN_TX_MAX_DATA;
-      for (uint8_t byteIdx = 0; byteIdx < status.transmitMsgObj.can_data_length; byteIdx++)
+      // Each object gets its identifier when a frame is loaded
+      // The node sends the pending object with the lowest identifier first
+      for (uint8_t index = 0U; index < CAN_DRV_NUM_TX_MSG_OBJS; index++)
       {
-         status.transmitMsgObj.can_data_byte[byteIdx] = 0;
-      }
+         XMC_CAN_MO_t messageObject;
+
+         ConfigureMessageObject(channel, CAN_TX_MSG_OBJ_FIRST_IDX + index, CAN_DRV_EXTENDED_ID, 0U, XMC_CAN_MO_TYPE_TRANSMSGOBJ);
 
-      status.transmitMsgObj.can_mo_type = XMC_CAN_MO_TYPE_TRANSMSGOBJ;
-      XMC_CAN_MO_Config(&status.transmitMsgObj);
+         // The end of each transmission shares the receive interrupt, which counts the sent frame
+         messageObject.can_mo_ptr = &CAN_MO0[CAN_TX_MSG_OBJ_FIRST_IDX + index];
+         XMC_CAN_MO_SetEventNodePointer(&messageObject, XMC_CAN_MO_POINTER_EVENT_TRANSMIT, canConfig->rxIRQServiceRequest);
+         XMC_CAN_MO_EnableEvent(&messageObject, (uint32_t)XMC_CAN_MO_EVENT_TRANSMIT);
+      }
 
-      // Allocate transmit message object to the channel 
-      XMC_CAN_AllocateMOtoNodeList(CAN, canConfig->channelIndex, CAN_TX_MSBOBJ_IDX);
+      //-----------------------------------------------
+      // Receive FIFOs
+      //-----------------------------------------------
 
-		
-      /* configure the receive message object */
-      status.receiveMsgObj.can_mo_ptr = CAN_RX_MSBOBJ;
-      status.receiveMsgObj.can_priority = XMC_CAN_ARBITRATION_MODE_IDE_DIR_BASED_PRIO_2;
-      /* set the receive CAN identifier and negate the bit that configures it as a
-       * 29-bit extended CAN identifier.
-       */
-      uint32_t receiveId = CAN_RX_MSG_ID;
-      receiveId &= ~CAN_EXTENDED_ID_MASK;
+      // Each filter uses a base object holding the acceptance filter followed
+      // by the slave objects that store the received frames
+      uint8_t nextIndex = (uint8_t)CAN_RX_FIFO_FIRST_IDX;
 
-      if ((CAN_RX_MSG_ID & CAN_EXTENDED_ID_MASK) == 0)
-      {
-         /* 11-bit standard CAN identifier */
-         status.receiveMsgObj.can_identifier = receiveId;
-         status.receiveMsgObj.can_id_mask = receiveId;
-         status.receiveMsgObj.can_id_mode = XMC_CAN_FRAME_TYPE_STANDARD_11BITS;
-         XMC_CAN_MO_AcceptOnlyMatchingIDE(&status.receiveMsgObj);
-      }
-      else
+      for (uint8_t filter = 0U; filter < NUM_CAN_FILTERS; filter++)
       {
-         /* 29-bit extended CAN identifier */
-         status.receiveMsgObj.can_identifier = receiveId;
-         status.receiveMsgObj.can_id_mask = receiveId;
-         status.receiveMsgObj.can_id_mode = XMC_CAN_FRAME_TYPE_EXTENDED_29BITS;
-         XMC_CAN_MO_AcceptOnlyMatchingIDE(&status.receiveMsgObj);
-      }
+         const CAN_Drv_FilterConfigItem_t *filterConfig = &canFilterConfigTable[filter];
+         XMC_CAN_FIFO_CONFIG_t rxFifo;
+         XMC_CAN_MO_t messageObject;
+
+         rxFifo.fifo_base = nextIndex;
+         rxFifo.fifo_bottom = nextIndex + 1U;
+         rxFifo.fifo_top = nextIndex + filterConfig->fifoSize;
+
+         // The base object only filters, it must not receive frames itself
+         ConfigureMessageObject(channel, rxFifo.fifo_base, filterConfig->canId, filterConfig->idMask, XMC_CAN_MO_TYPE_RECMSGOBJ);
+         messageObject.can_mo_ptr = &CAN_MO0[rxFifo.fifo_base];
+         XMC_CAN_RXFIFO_ConfigMOBaseObject(&messageObject, rxFifo);
+         XMC_CAN_MO_SetEventNodePointer(&messageObject, XMC_CAN_MO_POINTER_EVENT_RECEIVE, canConfig->rxIRQServiceRequest);
+         XMC_CAN_MO_EnableEvent(&messageObject, (uint32_t)XMC_CAN_MO_EVENT_RECEIVE);
+
+         // The first frame is stored in the bottom object
+         CAN_MO0[rxFifo.fifo_base].MOFGPR = (CAN_MO0[rxFifo.fifo_base].MOFGPR & ~(uint32_t)CAN_MO_MOFGPR_CUR_Msk) |
+                                            (((uint32_t)rxFifo.fifo_bottom << CAN_MO_MOFGPR_CUR_Pos) & (uint32_t)CAN_MO_MOFGPR_CUR_Msk);
+
+         // The slave objects are only filled through the base object
+         for (uint8_t index = rxFifo.fifo_bottom; index <= rxFifo.fifo_top; index++)
+         {
+            ConfigureMessageObject(channel, index, filterConfig->canId, filterConfig->idMask, XMC_CAN_MO_TYPE_RECMSGOBJ);
+            messageObject.can_mo_ptr = &CAN_MO0[index];
+            XMC_CAN_RXFIFO_ConfigMOSlaveObject(&messageObject);
 
-      status.receiveMsgObj.can_data_length = CAN_RX_MAX_DATA;
-      for (uint8_t byteIdx = 0; byteIdx < status.receiveMsgObj.can_data_length; byteIdx++)
-      {
-         status.receiveMsgObj.can_data_byte[byteIdx] = 0;
-      }
+            // Every stored frame raises the receive interrupt
+            XMC_CAN_MO_SetEventNodePointer(&messageObject, XMC_CAN_MO_POINTER_EVENT_RECEIVE, canConfig->rxIRQServiceRequest);
+            XMC_CAN_MO_EnableEvent(&messageObject, (uint32_t)XMC_CAN_MO_EVENT_RECEIVE);
+         }
+
+         status.rxFifo[filter].baseIndex = rxFifo.fifo_base;
+         status.rxFifo[filter].readIndex = rxFifo.fifo_bottom;
 
-      status.receiveMsgObj.can_mo_type = XMC_CAN_MO_TYPE_RECMSGOBJ;
-      XMC_CAN_MO_Config(&status.receiveMsgObj);
+         nextIndex = rxFifo.fifo_top + 1U;
+      }
 
-      /* allocate receive message object to the channel */
-      XMC_CAN_AllocateMOtoNodeList(CAN, canConfig->channelIndex, CAN_RX_MSBOBJ_IDX);
+      status.nextRxFilter = 0U;
 
       /* reset CCE and INIT bit NCR for node configuration */
       XMC_CAN_NODE_DisableConfigurationChange(canConfig->channel);
       XMC_CAN_NODE_ResetInitBit(canConfig->channel);
 
-      // --- PORT INIT ---
-      // Init the port information and buffers
-      memset(&status.portData, 0, sizeof(PortData_t));
+      // Start with an empty queue and receive ring and clear the statistics
+      CAN_Drv_Core_Init(canConfig->channelConfig.baudrate);
+
+      // Set priority and enable NVIC node for RX interrupt
+#if UC_FAMILY == XMC1
+      NVIC_SetPriority(canConfig->rxIrqNum, canConfig->rxIRQPriority);
+#else
+      NVIC_SetPriority(canConfig->rxIrqNum, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), canConfig->rxIRQPriority, 0U));
+#endif
+
+      // Set the RX interrupt control -- only for XMC1400
+#if UC_SERIES == XMC14
+      XMC_SCU_SetInterruptControl(canConfig->rxIrqNum, (XMC_SCU_IRQCTRL_t)(canConfig->rxInterruptControlSource));
+#endif
 
-      // Always start with the broadcast address
-      status.portData.deviceAddress = BROADCAST_ADDRESS;
+      // Enable the RX IRQ
+      NVIC_EnableIRQ(canConfig->rxIrqNum);
    }
 
 
-} 
+}
 
-// See if a new CAN message has been received
-bool FindNextCommand(Lunar_MessageRouter_Message_t *const message)
+// Read the next frame from the receive FIFOs
+static bool ReadHardwareFrame(CAN_Drv_Frame_t *const frame)
 {
-   // Init to no message found
    bool result = false;
 
-   // Verify the parameter
-   if (message != 0)
+   // Check each filter once, starting after the filter read last time
+   for (uint8_t i = 0U; (i < NUM_CAN_FILTERS) && (!result); i++)
    {
-      // Check if a new message was received
-      if ((XMC_CAN_MO_GetStatus(&status.receiveMsgObj) & XMC_CAN_MO_STATUS_RX_PENDING) != 0)
+      uint8_t filter = status.nextRxFilter;
+      RxFifo_t *rxFifo = &status.rxFifo[filter];
+      XMC_CAN_MO_t messageObject;
+
+      status.nextRxFilter++;
+      if (status.nextRxFilter >= NUM_CAN_FILTERS)
       {
-         // Read out and process the newly received data
-         if (XMC_CAN_MO_Receive(&status.receiveMsgObj) == XMC_CAN_STATUS_SUCCESS)
-         {
-            // This message is for us, continue and extract the Module ID
-            message->header.moduleID = (uint8_t)(status.receiveMsgObj.can_identifier >> 8U);
+         status.nextRxFilter = 0U;
+      }
 
-            // Move to the next byte for CMD ID
-            message->header.commandID = (uint8_t)status.receiveMsgObj.can_identifier;
+      messageObject.can_mo_ptr = &CAN_MO0[rxFifo->readIndex];
 
-            // Verify buffer length is sufficient
-            if (message->commandParams.maxLength >= status.receiveMsgObj.can_data_length)
+      // The FIFO fills its objects in order, so only the oldest one is checked
+      uint32_t moStatus = XMC_CAN_MO_GetStatus(&messageObject);
+      if ((moStatus & XMC_CAN_MO_STATUS_RX_PENDING) != 0U)
+      {
+         // Read out the newly received data
+         if (XMC_CAN_MO_Receive(&messageObject) == XMC_CAN_STATUS_SUCCESS)
+         {
+            frame->canId = messageObject.can_identifier;
+            if (messageObject.can_id_mode == (uint32_t)XMC_CAN_FRAME_TYPE_EXTENDED_29BITS)
             {
-               // Store the length in the message object
-               message->commandParams.length = status.receiveMsgObj.can_data_length;
-
-               // Store the data in the message object
-               for (uint8_t byteIdx = 0; byteIdx < status.receiveMsgObj.can_data_length; byteIdx++)
-               {
-                  message->commandParams.data[byteIdx] = status.receiveMsgObj.can_data_byte[byteIdx];
-                  // Note that a command was found and is ready for processing
-                  result = true;
-               }
+               frame->canId |= CAN_DRV_EXTENDED_ID;
             }
 
-            // Increment the number of frames in the statistics
-            // This value will wrap eventually
-            status.portData.statistics.numFramesReceived++;
+            // A DLC of 9-15 still carries only 8 data bytes on classic CAN
+            frame->length = PLATFORM_MIN((uint8_t)messageObject.can_data_length, (uint8_t)CAN_DRV_MAX_DATA_LENGTH);
+            for (uint8_t byteIdx = 0U; byteIdx < frame->length; byteIdx++)
+            {
+               frame->data[byteIdx] = messageObject.can_data_byte[byteIdx];
+            }
+            result = true;
          }
 
-         // Reset the message received flag
-         XMC_CAN_MO_ResetStatus(&status.receiveMsgObj, XMC_CAN_MO_RESET_STATUS_RX_PENDING);
+         // A frame arrived while the object still held an unread frame
+         if ((moStatus & XMC_CAN_MO_STATUS_MESSAGE_LOST) != 0U)
+         {
+            CAN_Drv_Core_CountLostFrame();
+            XMC_CAN_MO_ResetStatus(&messageObject, XMC_CAN_MO_RESET_STATUS_MESSAGE_LOST);
+         }
+
+         // Reset the message received flag and move to the next object
+         XMC_CAN_MO_ResetStatus(&messageObject, XMC_CAN_MO_RESET_STATUS_RX_PENDING);
+
+         rxFifo->readIndex++;
+         if (rxFifo->readIndex > (rxFifo->baseIndex + canFilterConfigTable[filter].fifoSize))
+         {
+            rxFifo->readIndex = rxFifo->baseIndex + 1U;
+         }
       }
    }
 
    return(result);
 }
 
-// Trigger the processing of a single command using the Message Router
-static void TriggerCommand(Lunar_MessageRouter_Message_t *const message)
+// Move the received frames into the receive ring
+static void HandleChannelRXInterrupt(const CAN_Drv_Channel_t channel)
 {
-	// Verify the parameter
-	if (message != 0)
-	{      
-      //-----------------------------------------------
-      // Initialize Command Buffer
-      //-----------------------------------------------
-
-      // No command parameters
-      message->commandParams.length = 0U;
+   // Verify the channel index
+   if (channel < CAN_DRV_CHANNEL_Count)
+   {
+      CAN_Drv_Frame_t frame;
 
-      //-----------------------------------------------
-      // Initialize Response Buffer
-      //-----------------------------------------------
+      // Empty the receive FIFOs so a single interrupt handles a burst of frames
+      while (ReadHardwareFrame(&frame))
+      {
+         (void)CAN_Drv_Core_HandleRxFrame(&frame);
+      }
+   }
+}
 
-      // Setup the buffer for the response
-      message->responseParams.data = status.portData.responseBuffer;
-      message->responseParams.maxLength = (uint8_t)RESPONSE_DATA_MAX_SIZE;
-      message->responseParams.length = 0U;
+// Count a frame that was sent from a transmit message object
+static void HandleTxComplete(const uint8_t index)
+{
+   XMC_CAN_MO_t messageObject;
 
-      //-----------------------------------------------
-      // Process Command
-      //-----------------------------------------------
+   CAN_Drv_Core_HandleTxComplete(index, Timebase_Drv_GetCycleCount());
 
-      // Process message
-      Lunar_MessageRouter_ProcessMessage(message);
+   messageObject.can_mo_ptr = &CAN_MO0[CAN_TX_MSG_OBJ_FIRST_IDX + index];
+   XMC_CAN_MO_ResetStatus(&messageObject, XMC_CAN_MO_RESET_STATUS_TX_PENDING);
+}
 
-      // Increment the number of messages sent
-      // Send the response out the serial port.
-      CAN_Drv_TransmitPacket(CAN_DRV_CHANNEL_PRIMARY, message->responseParams.data, message->responseParams.length);							
-	}
+// Count the frames sent since the last interrupt
+static void HandleTxCompleteInterrupt(void)
+{
+   for (uint8_t index = 0U; index < CAN_DRV_NUM_TX_MSG_OBJS; index++)
+   {
+      if ((CAN_MO0[CAN_TX_MSG_OBJ_FIRST_IDX + index].MOSTAT & CAN_MO_MOSTAT_TXPND_Msk) != 0U)
+      {
+         HandleTxComplete(index);
+      }
+   }
 }
 
+// Sample the node error counters and state
+static void UpdateNodeStatistics(const CAN_Drv_Channel_t channel)
+{
+   CAN_NODE_TypeDef *const node = canConfigTable[channel].channel;
+   const uint32_t nodeStatus = XMC_CAN_NODE_GetStatus(node);
+   const uint8_t lastErrorCode = (uint8_t)((nodeStatus & CAN_NODE_NSR_LEC_Msk) >> CAN_NODE_NSR_LEC_Pos);
+   const bool isBusOff = ((nodeStatus & CAN_NODE_NSR_BOFF_Msk) != 0U);
+   const bool isErrorWarning = ((nodeStatus & CAN_NODE_NSR_EWRN_Msk) != 0U);
+
+   // A counted error code is cleared, so the next sample only sees new errors
+   if (CAN_Drv_Core_UpdateNodeStatistics(XMC_CAN_NODE_GetTransmitErrorCounter(node), XMC_CAN_NODE_GetReceiveErrorCounter(node),
+                                         lastErrorCode, isBusOff, isErrorWarning))
+   {
+      XMC_CAN_NODE_ClearStatus(node, XMC_CAN_NODE_STATUS_LAST_ERROR_CODE);
+   }
+
+   // The node stops with INIT set, clearing it starts the recovery sequence
+   if (isBusOff && ((node->NCR & CAN_NODE_NCR_INIT_Msk) != 0U))
+   {
+      XMC_CAN_NODE_ResetInitBit(node);
+   }
+}
 
 /*******************************************************************************
 // Public Function Implementations
@@ -408,7 +489,7 @@ void CAN_Drv_Init(void)
    tx_can_config.output_level = canConfig->txConfig.output_level;
 #if UC_FAMILY == XMC4
    tx_can_config.output_strength = canConfig->txConfig.output_strength;
-#endif	
+#endif
    XMC_GPIO_Init(canConfig->txPin.port, canConfig->txPin.pin, &tx_can_config);
    /* select CAN Receive Input C (N1_RXDC) to map P1_13 to CAN_NODE1 */
    XMC_CAN_NODE_EnableConfigurationChange(canConfig->channel);
@@ -416,162 +497,110 @@ void CAN_Drv_Init(void)
    XMC_CAN_NODE_DisableConfigurationChange(canConfig->channel);
 }
 
-// Scheduled function to process messages
+// Scheduled function to service the transmit queue
 void CAN_Drv_Update(void)
 {
-   // Store the message object for easy access
-   Lunar_MessageRouter_Message_t *const message = &(status.portData.currentMessage);
-
-	//-----------------------------------------------
-	// Initialize Command Buffer
-	//-----------------------------------------------
-
-	// Move to the next byte for DATA LENGTH
-	// Assign the command buffer
-	message->commandParams.data = status.portData.commandBuffer;
-	// Set the max size to prevent other modules from overwriting the bounds of the data buffer.
-	message->commandParams.maxLength = (uint8_t)COMMAND_DATA_MAX_SIZE;
-
-   // Look for a valid command in the circular RX buffer
-   if (FindNextCommand(message))
-   {	
-		// Init the message to no error
-		status.portData.currentMessage.responseCode = LUNAR_MESSAGEROUTER_RESPONSE_CODE_None;
-
-		//-----------------------------------------------
-		// Parse Header
-		//-----------------------------------------------
-
-		// Populate the command header.  This tells the Message Router
-		// how to route the command to the destination module.
-
-		// Addressing is not used, just set address to the broadcast address (0xFF)
-		uint8_t destinationAddress = (uint8_t)BROADCAST_ADDRESS;
-
-		// Verify this message is intended for us
-		// If addressing is not used, our address will be the broadcast address and the message is accepted
-		if ((destinationAddress == BROADCAST_ADDRESS) || (destinationAddress == status.portData.deviceAddress))
-		{
-			// Extract everything and verify the CRC
-			
-			// Module and Command were set when CAN message was received
-
-			//-----------------------------------------------
-			// Initialize Response Buffer
-			//-----------------------------------------------
-
-			// Setup the buffer for the response
-			message->responseParams.data = status.portData.responseBuffer;
-			message->responseParams.maxLength = (uint8_t)RESPONSE_DATA_MAX_SIZE;
-			message->responseParams.length = 0U;
-
-			//-----------------------------------------------
-			// Process Command
-			//-----------------------------------------------
-
-			// Increment the number of messages received since this command will at least generate some sort of response message
-			status.portData.statistics.numFramesReceived++;
-
-			// Process message
-			Lunar_MessageRouter_ProcessMessage(message);
-		}
+   // Move waiting frames into the message objects freed since the last call
+   CAN_Drv_Core_ServiceTxQueue();
+
+   // Sampling the node here keeps the error interrupts disabled
+   UpdateNodeStatistics(CAN_DRV_CHANNEL_PRIMARY);
+   CAN_Drv_Core_UpdateRateStatistics();
+}
+
+
+
+/*******************************************************************************
+// Device Function Implementations
+*******************************************************************************/
+
+// See if a transmit message object still holds a frame
+bool CAN_Drv_Device_IsTxObjectBusy(const uint8_t index)
+{
+   // A frame sent after the last interrupt is counted before the object is reused
+   uint32_t primask = __get_PRIMASK();
+   __disable_irq();
+
+   if ((CAN_MO0[CAN_TX_MSG_OBJ_FIRST_IDX + index].MOSTAT & CAN_MO_MOSTAT_TXPND_Msk) != 0U)
+   {
+      HandleTxComplete(index);
    }
 
-   // Trigger an outgoing message
-   //-----------------------------------------------
-   // Set Header
-   //-----------------------------------------------
-   message->header.moduleID = (uint8_t)(CAN_TX_MSG_ID >> 8U);
-   message->header.commandID = (uint8_t)(CAN_TX_MSG_ID);
-
-   //-----------------------------------------------
-   // Process Command
-   //-----------------------------------------------
-   TriggerCommand(message);
+   __set_PRIMASK(primask);
+
+   return((CAN_MO0[CAN_TX_MSG_OBJ_FIRST_IDX + index].MOSTAT & CAN_MO_MOSTAT_TXRQ_Msk) != 0U);
 }
 
+// Write a frame into a transmit message object
+void CAN_Drv_Device_LoadTxObject(const uint8_t index, const CAN_Drv_Frame_t *const frame)
+{
+   XMC_CAN_MO_t messageObject;
+   messageObject.can_mo_ptr = &CAN_MO0[CAN_TX_MSG_OBJ_FIRST_IDX + index];
+   messageObject.can_mo_type = XMC_CAN_MO_TYPE_TRANSMSGOBJ;
+
+   // Select the identifier type before writing the identifier
+   if ((frame->canId & CAN_DRV_EXTENDED_ID) == 0U)
+   {
+      XMC_CAN_MO_SetStandardID(&messageObject);
+   }
+   else
+   {
+      XMC_CAN_MO_SetExtendedID(&messageObject);
+   }
+   XMC_CAN_MO_SetIdentifier(&messageObject, frame->canId & ~CAN_DRV_EXTENDED_ID);
+
+   // Copy message data
+   messageObject.can_data[0] = 0U;
+   messageObject.can_data[1] = 0U;
+   messageObject.can_data_length = frame->length;
+   for (uint8_t byteIdx = 0U; byteIdx < frame->length; byteIdx++)
+   {
+      messageObject.can_data_byte[byteIdx] = frame->data[byteIdx];
+   }
+   XMC_CAN_MO_UpdateData(&messageObject);
+
+   // Request the transmission
+   XMC_CAN_MO_Transmit(&messageObject);
+}
 
-// Send a single CAN packet
-void CAN_Drv_TransmitPacket(const CAN_Drv_Channel_t channel, uint8_t *const data, const uint8_t length)
+// Withdraw the transmit request of a message object
+void CAN_Drv_Device_AbortTxObject(const uint8_t index)
 {
-	// Verify the channel index
-	if (channel < CAN_DRV_CHANNEL_Count)
-	{
-		// Copy message data
-		status.transmitMsgObj.can_data_length = length;
-		for (uint8_t byteIdx = 0; byteIdx < status.transmitMsgObj.can_data_length; byteIdx++)
-		{
-			status.transmitMsgObj.can_data_byte[byteIdx] = data[byteIdx];
-		}
-
-		/* update the message object */
-		XMC_CAN_MO_UpdateData(&status.transmitMsgObj);
-		/* reset the message object's transmit pending flag */
-		XMC_CAN_MO_ResetStatus(&status.transmitMsgObj, XMC_CAN_MO_RESET_STATUS_TX_PENDING);
-		/* submit message for transmission */
-		XMC_CAN_MO_Transmit(&status.transmitMsgObj);
-
-		/* set timeout time to wait for transmission completion */
-		Lunar_SoftTimerLib_Timer_t timer;
-
-		Lunar_SoftTimerLib_Init(&timer);
-		Lunar_SoftTimerLib_StartTimer(&timer, CAN_MSG_TX_TIMEOUT_MS);
-		
-		// Wait for transmit completion 
-		// Note that this will need to be moved to a non-blocking method
-		while ((XMC_CAN_MO_GetStatus(&status.transmitMsgObj) & XMC_CAN_MO_STATUS_TX_PENDING) != 0)
-		{
-			// Break loop upon timeout. This would indicate a hardware failure or no other
-			// nodes connected to the bus.
-			if (Lunar_SoftTimerLib_IsTimerExpired(&timer))
-			{
-				break;
-			}
-		}
-		
-		// Increment the sent value in statistics
-		// Note this value is expected to wrap eventually
-		status.portData.statistics.numFramesSent++;
-	}	
+   // A frame that already started on the bus is still completed by the node
+   CAN_MO0[CAN_TX_MSG_OBJ_FIRST_IDX + index].MOCTR = CAN_MO_MOCTR_RESTXRQ_Msk;
 }
 
-// Receive a single CAN packet, if available
-bool CAN_Drv_ReceivePacket(const CAN_Drv_Channel_t channel, uint8_t *const data, uint8_t *const length)
+// Disable the interrupts
+uint32_t CAN_Drv_Device_DisableInterrupts(void)
 {
-   bool result = false;
+   uint32_t primask = __get_PRIMASK();
+   __disable_irq();
 
-	// Verify the channel index
-	if (channel < CAN_DRV_CHANNEL_Count)
-	{
-		// Check if a new message was received
-		if ((XMC_CAN_MO_GetStatus(&status.receiveMsgObj) & XMC_CAN_MO_STATUS_RX_PENDING) != 0)
-		{
-			// Read out and process the newly received data 
-			if (XMC_CAN_MO_Receive(&status.receiveMsgObj) == XMC_CAN_STATUS_SUCCESS)
-			{
-				// Store the length in the given location
-				*length = status.receiveMsgObj.can_data_length;
-				for (uint8_t byteIdx = 0; byteIdx < status.receiveMsgObj.can_data_length; byteIdx++)
-				{
-					data[byteIdx] = status.receiveMsgObj.can_data_byte[byteIdx];
-					result = true;
-				}
-			}
-
-			// Reset the message received flag
-			XMC_CAN_MO_ResetStatus(&status.receiveMsgObj, XMC_CAN_MO_RESET_STATUS_RX_PENDING);
-			
-			// Increment the number of messages received since this command will at least generate some sort of response message
-			status.portData.statistics.numFramesReceived++;		
-		}
-	}
+   return(primask);
+}
 
-   return(result);
-} 
+// Restore the interrupt state
+void CAN_Drv_Device_RestoreInterrupts(const uint32_t state)
+{
+   __set_PRIMASK(state);
+}
+
+// Complete the memory accesses before the barrier
+void CAN_Drv_Device_MemoryBarrier(void)
+{
+   __DMB();
+}
 
 
 /*******************************************************************************
 // Interrupt Handlers
 *******************************************************************************/
 
-
+// This callback is called when a frame is stored in a receive FIFO or sent
+// This is mapped to the XMC IRQ handler name in the config file
+void CAN0_CONFIG_RX_HANDLER(void)
+{
+   // Pass the channel index from the config file, as done for the UART
+   HandleChannelRXInterrupt(CAN0_CONFIG_RX_CHANNEL_INDEX);
+   HandleTxCompleteInterrupt();
+}
@@ -0,0 +1,209 @@
+/*******************************************************************************
+// Flash Driver
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "Flash_Drv.h"
+#include "Flash_Drv_Config.h"
+// Platform Includes
+// Other Includes
+#include "xmc_flash.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+#if UC_FAMILY == XMC4
+// The status flags that report a failed operation
+#define FLASH_ERROR_FLAGS_MASK (FLASH_FSR_PFOPER_Msk | FLASH_FSR_SQER_Msk | FLASH_FSR_PROER_Msk | FLASH_FSR_VER_Msk)
+#endif
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// This enumeration defines the operations of the driver
+typedef enum
+{
+   // No operation in progress
+   FLASH_OPERATION_Idle,
+   // A sector is being erased
+   FLASH_OPERATION_Erase,
+   // A page is being programmed
+   FLASH_OPERATION_Program,
+} Flash_Operation_t;
+
+// This structure defines the internal variables used by the module
+typedef struct
+{
+   // The operation in progress
+   Flash_Operation_t operation;
+
+   // The result of the last finished operation
+   bool operationFailed;
+
+#if UC_FAMILY == XMC1
+   // The next page to be erased
+   uint32_t erasePageAddress;
+
+   // The number of pages left to erase in the sector
+   uint32_t numPagesToErase;
+#endif
+} Flash_Status_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The variable used for holding all internal data for this module.
+static Flash_Status_t status;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+#if UC_FAMILY == XMC4
+// The XMC4 library only provides blocking program and erase functions
+// These command sequences are exported by xmc4_flash.c without a declaration
+void XMC_FLASH_lEnterPageModeCommand(void);
+void XMC_FLASH_lLoadPageCommand(uint32_t low_word, uint32_t high_word);
+void XMC_FLASH_lWritePageCommand(uint32_t *page_start_address);
+void XMC_FLASH_lEraseSectorCommand(uint32_t *sector_start_address);
+void XMC_FLASH_lClearStatusCommand(void);
+#endif
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Initialize the driver
+void Flash_Drv_Init(void)
+{
+   status.operation = FLASH_OPERATION_Idle;
+   status.operationFailed = false;
+}
+
+
+// Start erasing a sector
+bool Flash_Drv_StartEraseSector(const uint32_t sectorAddress)
+{
+   bool started = false;
+
+   // Only one operation may be in progress
+   if ((status.operation == FLASH_OPERATION_Idle) && ((sectorAddress % FLASH_DRV_SECTOR_SIZE) == 0U))
+   {
+#if UC_FAMILY == XMC4
+      // Start the sector erase, Flash_Drv_Update polls for completion
+      XMC_FLASH_lClearStatusCommand();
+      XMC_FLASH_lEraseSectorCommand((uint32_t *)sectorAddress);
+#else
+      // The XMC1 erase functions wait for completion, so the sector is erased
+      // one page per update to keep each call short
+      status.erasePageAddress = sectorAddress;
+      status.numPagesToErase = FLASH_DRV_SECTOR_SIZE / FLASH_DRV_PAGE_SIZE;
+#endif
+      status.operation = FLASH_OPERATION_Erase;
+      status.operationFailed = false;
+      started = true;
+   }
+
+   return(started);
+}
+
+
+// Start programming a page
+bool Flash_Drv_StartProgramPage(const uint32_t pageAddress, const uint32_t *const data)
+{
+   bool started = false;
+
+   // Only one operation may be in progress
+   if ((status.operation == FLASH_OPERATION_Idle) && ((pageAddress % FLASH_DRV_PAGE_SIZE) == 0U))
+   {
+#if UC_FAMILY == XMC4
+      // Load the assembly buffer and start the write, Flash_Drv_Update polls for completion
+      XMC_FLASH_lClearStatusCommand();
+      XMC_FLASH_lEnterPageModeCommand();
+
+      for (uint32_t i = 0U; i < FLASH_DRV_WORDS_PER_PAGE; i += 2U)
+      {
+         XMC_FLASH_lLoadPageCommand(data[i], data[i + 1U]);
+      }
+
+      XMC_FLASH_lWritePageCommand((uint32_t *)pageAddress);
+
+      status.operation = FLASH_OPERATION_Program;
+      status.operationFailed = false;
+#else
+      // A single page write on the XMC1 is short, so it is done immediately
+      status.operationFailed = (XMC_FLASH_ProgramVerifyPage((uint32_t *)pageAddress, data) != (int32_t)NVM_PASS);
+#endif
+      started = true;
+   }
+
+   return(started);
+}
+
+
+// Advance the operation in progress
+void Flash_Drv_Update(void)
+{
+#if UC_FAMILY == XMC4
+   // The flash controller runs the operation, wait for it to finish
+   if ((status.operation != FLASH_OPERATION_Idle) && (!XMC_FLASH_IsBusy()))
+   {
+      status.operationFailed = ((XMC_FLASH_GetStatus() & FLASH_ERROR_FLAGS_MASK) != 0U);
+      status.operation = FLASH_OPERATION_Idle;
+   }
+#else
+   // Erase the next page of the sector
+   if (status.operation == FLASH_OPERATION_Erase)
+   {
+      if (XMC_FLASH_ErasePage((uint32_t *)status.erasePageAddress) != (int32_t)NVM_PASS)
+      {
+         status.operationFailed = true;
+      }
+
+      status.erasePageAddress += FLASH_DRV_PAGE_SIZE;
+      status.numPagesToErase--;
+
+      // Stop after the last page or the first failure
+      if ((status.numPagesToErase == 0U) || (status.operationFailed))
+      {
+         status.operation = FLASH_OPERATION_Idle;
+      }
+   }
+#endif
+}
+
+
+// Check for an operation in progress
+bool Flash_Drv_IsBusy(void)
+{
+   return(status.operation != FLASH_OPERATION_Idle);
+}
+
+
+// Get the result of the last operation
+bool Flash_Drv_DidOperationFail(void)
+{
+   return(status.operationFailed);
+}
+
+
+// Read data from the flash
+void Flash_Drv_Read(const uint32_t address, void *const data, const uint32_t length)
+{
+   // The flash is memory mapped
+   memcpy(data, (const void *)address, length);
+}
@@ -299,33 +299,48 @@ void RTC_Drv_GetCurrentTime(RTC_Drv_DateTime_t *const dateTime)
 
 
 // Set the time using common RTC Driver format
-void RTC_Drv_SetCurrentTime(const RTC_Drv_DateTime_t *const dateTime)
+bool RTC_Drv_SetCurrentTime(const RTC_Drv_DateTime_t *const dateTime)
 {
    // Set the RTC Time
    XMC_RTC_TIME_t timeValue;
 
-   // Populate the response data
-   timeValue.seconds = dateTime->time.seconds;
-   timeValue.minutes = dateTime->time.minutes;
-   timeValue.hours = dateTime->time.hours;
-   // Adjust time if 12 hour/PM
-   if (dateTime->time.timeFormat == RTC_DRV_TIME_FORMAT_PM)
+   // 12-hour times are 0-11 and are converted to 24-hour below
+   uint8_t maxHours = (dateTime->time.timeFormat == RTC_DRV_TIME_FORMAT_24_HOUR) ? 23U : 11U;
+
+   // Reject values that the RTC would store incorrectly
+   bool isValid = (dateTime->date.month >= RTC_DRV_MONTH_JANUARY) && (dateTime->date.month <= RTC_DRV_MONTH_DECEMBER) &&
+                  (dateTime->date.day >= 1U) && (dateTime->date.day <= 31U) &&
+                  (dateTime->date.dayOfWeek < RTC_DRV_DAY_Count) &&
+                  (dateTime->time.timeFormat < RTC_DRV_TIME_FORMAT_Count) &&
+                  (dateTime->time.hours <= maxHours) && (dateTime->time.minutes <= 59U) && (dateTime->time.seconds <= 59U);
+
+   if (isValid)
    {
-      // Add 12 hours when time is sent as 12HR and PM is selected
-      timeValue.hours += 12U;
+      // Populate the response data
+      timeValue.seconds = dateTime->time.seconds;
+      timeValue.minutes = dateTime->time.minutes;
+      timeValue.hours = dateTime->time.hours;
+      // Adjust time if 12 hour/PM
+      if (dateTime->time.timeFormat == RTC_DRV_TIME_FORMAT_PM)
+      {
+         // Add 12 hours when time is sent as 12HR and PM is selected
+         timeValue.hours += 12U;
+      }
+
+      // Days are sent as 1-based (e.g. 1st of month = 1), but stored as 0-based
+      timeValue.days = dateTime->date.day - 1;
+      // Set year as a whole number, not offset
+      timeValue.year = dateTime->date.year;
+      // Month is sent as 1-based (e.g. Jan = 1), but stored as 0-based
+      timeValue.month = dateTime->date.month - 1;
+      // Day of the week isn't need for XMC
+      timeValue.daysofweek = dateTime->date.dayOfWeek;
+
+      // Call XMC Lib to set the time and date
+      XMC_RTC_SetTime(&timeValue);
    }
 
-   // Days are sent as 1-based (e.g. 1st of month = 1), but stored as 0-based
-   timeValue.days = dateTime->date.day - 1;
-   // Set year as a whole number, not offset
-   timeValue.year = dateTime->date.year;
-   // Month is sent as 1-based (e.g. Jan = 1), but stored as 0-based
-   timeValue.month = dateTime->date.month - 1;
-   // Day of the week isn't need for XMC
-   timeValue.daysofweek = dateTime->date.dayOfWeek;
-
-   // Call XMC Lib to set the time and date
-   XMC_RTC_SetTime(&timeValue);
+   return(isValid);
 }
 
 
@@ -452,8 +467,11 @@ void RTC_Drv_MessageRouter_SetCurrentDateTime(Lunar_MessageRouter_Message_t *con
       dateTime.time.seconds = command->seconds;
       dateTime.time.timeFormat = command->timeFormat;
 
-      // Just call the driver set function
-      RTC_Drv_SetCurrentTime(&dateTime);
+      // Call the driver set function, the time is not changed if it is invalid
+      if (!RTC_Drv_SetCurrentTime(&dateTime))
+      {
+         message->responseCode = LUNAR_MESSAGEROUTER_RESPONSE_CODE_InvalidParameter;
+      }
 
       // Set the response length
       Lunar_MessageRouter_SetResponseSize(message, 0);
@@ -11,12 +11,18 @@
 // Platform Includes
 // Other Includes
 #include "xmc_scu.h" // Device reset functions
+#include <string.h> // Used for memcpy
 
 
 /*******************************************************************************
 // Private Constant Definitions
 *******************************************************************************/
 
+#if UC_FAMILY == XMC1
+// The XMC1000 unique chip ID is stored in the flash configuration sector
+#define UNIQUE_ID_ADDRESS (0x10000FF0U)
+#endif
+
 
 /*******************************************************************************
 // Private Type Declarations
@@ -84,3 +90,17 @@ void Reset_Drv_Execute(void)
    #error "Invalid device faimly"
 #endif
 }
+
+
+// Copy the unique chip ID
+void Reset_Drv_GetUniqueId(uint8_t *const uniqueId)
+{
+#if UC_FAMILY == XMC1
+   memcpy(uniqueId, (const void *)UNIQUE_ID_ADDRESS, RESET_DRV_UNIQUE_ID_LENGTH);
+#elif UC_FAMILY == XMC4
+   // The boot ROM copies the ID into RAM for the system startup code
+   memcpy(uniqueId, g_chipid, RESET_DRV_UNIQUE_ID_LENGTH);
+#else
+   #error "Invalid device family"
+#endif
+}
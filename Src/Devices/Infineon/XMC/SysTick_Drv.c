@@ -60,6 +60,11 @@ void SysTick_Drv_Init(void)
 #elif (UC_FAMILY == XMC4)
    // Set NVIC Priority for XMC400 devices
    NVIC_SetPriority(SYSTICK_DRV_IRQ, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), SYSTICK_DRV_IRQ_PRIORITY, SYSTICK_DRV_IRQ_SUBPRIORITY));
+
+   // Start the cycle counter used by Timebase_Drv_GetCycleCount
+   CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+   DWT->CYCCNT = 0U;
+   DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
 #endif
 
    // Set the SysTick Period to timebase setting of 1ms
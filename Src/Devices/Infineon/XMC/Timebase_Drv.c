@@ -13,8 +13,10 @@
 #include "SysTick_Drv.h"
 #include "SysTick_Drv_Config.h"
 // Other Includes
+#include <stdbool.h>
 #include <stdint.h>
 #include <time.h>
+#include "xmc_scu.h"
 
 
 
@@ -79,3 +81,49 @@ uint32_t Timebase_Drv_GetCurrentTickCount(void)
    return(SysTick_Drv_sysTickCount);
 }
 
+
+// Returns the current CPU cycle count
+uint32_t Timebase_Drv_GetCycleCount(void)
+{
+#if UC_FAMILY == XMC4
+   // The Cortex-M4 cycle counter is enabled by the SysTick driver
+   return(DWT->CYCCNT);
+#else
+   // The Cortex-M0 has no cycle counter, so build one from the SysTick
+   uint32_t tickCount;
+   uint32_t currentValue;
+   bool isTickPending;
+
+   // Re-read if the tick count changed while reading the down counter, or if
+   // the down counter reloaded before the pending flag was read
+   do
+   {
+      tickCount = SysTick_Drv_sysTickCount;
+      currentValue = SysTick->VAL;
+      isTickPending = ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0U);
+   } while ((tickCount != SysTick_Drv_sysTickCount) || (SysTick->VAL > currentValue));
+
+   // When called from an interrupt of the same or higher priority than the
+   // SysTick, the tick count is not incremented until that interrupt returns.
+   // The down counter has already reloaded, so count the pending tick here.
+   if (isTickPending)
+   {
+      tickCount++;
+   }
+   else
+   {
+      // The tick count is up to date
+   }
+
+   // Wrapping of the multiplication is expected, differences remain valid
+   return((tickCount * (SysTick->LOAD + 1U)) + (SysTick->LOAD - currentValue));
+#endif
+}
+
+
+// Returns the rate of the cycle counter
+uint32_t Timebase_Drv_GetCyclesPerSecond(void)
+{
+   // Both cycle counters run at the CPU clock
+   return(SystemCoreClock);
+}
@@ -0,0 +1,126 @@
+/*******************************************************************************
+// Flash Driver
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "Flash_Drv_Config.h"
+// Platform Includes
+#include "Platform.h"
+// Other Includes
+#include <stdbool.h>
+#include <stdint.h>
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// The number of 32-bit words in a flash page
+#define FLASH_DRV_WORDS_PER_PAGE (FLASH_DRV_PAGE_SIZE / sizeof(uint32_t))
+
+
+/*******************************************************************************
+// Public Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function initializes the flash driver.  No operation is in
+  *    progress after calling this function.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Flash_Drv_Init(void);
+
+/** Description:
+  *    This function starts erasing the FLASH_DRV_SECTOR_SIZE byte sector at
+  *    the given address.  The larger logical sectors of the XMC4, from 8
+  *    up, are erased whole.  The function does not wait for the erase to
+  *    finish, call Flash_Drv_Update until Flash_Drv_IsBusy returns false.
+  *    The driver is shared, so each user only advances its own operation.
+  * Parameters:
+  *    sectorAddress :  The address of the first byte of the sector
+  * Returns:
+  *    bool - true if the erase was started, false if an operation is
+  *    already in progress or the address is not aligned to a sector
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *    * 10/19/2026: Allow the larger XMC4 sectors (EJH)
+  *
+*/
+bool Flash_Drv_StartEraseSector(const uint32_t sectorAddress);
+
+/** Description:
+  *    This function starts programming one page of erased flash.  The data
+  *    is copied before the function returns, so the caller may reuse the
+  *    buffer immediately.  The function does not wait for the programming to
+  *    finish, call Flash_Drv_Update until Flash_Drv_IsBusy returns false.
+  * Parameters:
+  *    pageAddress :  The address of the first byte of the page
+  *    data :         FLASH_DRV_WORDS_PER_PAGE words to be programmed
+  * Returns:
+  *    bool - true if the programming was started, false if an operation is
+  *    already in progress or the address is not aligned to a page
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+bool Flash_Drv_StartProgramPage(const uint32_t pageAddress, const uint32_t *const data) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function advances the operation in progress and checks for its
+  *    completion.  It must be called periodically while Flash_Drv_IsBusy
+  *    returns true.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Flash_Drv_Update(void);
+
+/** Description:
+  *    This function returns the state of the last started operation.
+  * Returns:
+  *    bool - true if an erase or program operation is in progress
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+bool Flash_Drv_IsBusy(void);
+
+/** Description:
+  *    This function returns the result of the last finished operation.
+  * Returns:
+  *    bool - true if the last erase or program operation reported an error
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+bool Flash_Drv_DidOperationFail(void);
+
+/** Description:
+  *    This function copies data out of the flash.  Reading while an operation
+  *    is in progress returns undefined data.
+  * Parameters:
+  *    address :  The address of the first byte to be read
+  *    data :     Buffer for the read data
+  *    length :   The number of bytes to be read
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Flash_Drv_Read(const uint32_t address, void *const data, const uint32_t length) PLATFORM_NON_NULL;
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
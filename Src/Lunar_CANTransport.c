@@ -0,0 +1,402 @@
+/*******************************************************************************
+// Core CAN Transport Module
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Lunar_CANTransport.h"
+#include "Lunar_CANTransport_Config.h"
+#include "Lunar_CANTransport_ConfigTable.h"
+// Platform Includes
+#include "Lunar_IsoTp.h"
+#include "Lunar_MessageRouter.h"
+// Other Includes
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "CAN_Drv.h" // For CAN API
+#include "CAN_Drv_Config.h" // For CAN channel enumeration
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The number of routes in the route table
+#define NUM_ROUTES (sizeof(Lunar_CANTransport_routeConfigTable)/sizeof(Lunar_CANTransport_RouteConfigItem_t))
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// Holds statistics on routed frames and sent responses
+typedef struct
+{
+   // Number of frames passed to the Message Router
+   uint32_t numFramesRouted;
+   // Number of frames received with an identifier that has no route
+   uint32_t numFramesUnrouted;
+   // Number of responses queued for transmission
+   uint32_t numResponsesSent;
+   // Number of responses that could not be queued
+   uint32_t numResponsesDropped;
+   // Number of routed commands that failed, no response is sent for these
+   uint32_t numErrorResponses;
+} TxRxStatistics_t;
+
+// This structure holds the private information for this module
+typedef struct
+{
+   // This is the message structure for the frame being routed.  The
+   // command and response point to the frame data in the receive ring.
+   Lunar_MessageRouter_Message_t currentMessage;
+
+   // Stats for routed frames and responses
+   TxRxStatistics_t statistics;
+} Lunar_CANTransport_Status_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The variable used for holding all internal data for this module.
+static Lunar_CANTransport_Status_t status;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function finds the route of the given CAN identifier.  The node ID
+  *    bits of each route are ignored.
+  * Parameters:
+  *    canId : The received CAN identifier, bit 31 is set for an extended identifier
+  * Returns:
+  *    const Lunar_CANTransport_RouteConfigItem_t * : The route of the identifier,
+  *    0 if the identifier is not routed
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *    * 10/19/2026: Ignore the node ID bits (EJH)
+  *
+*/
+static const Lunar_CANTransport_RouteConfigItem_t *FindRoute(const uint32_t canId);
+
+/** Description:
+  *    This function finds the route with a response identifier for the given
+  *    module and command.
+  * Parameters:
+  *    moduleID : The module ID of the response
+  *    commandID : The command ID of the response
+  *    offset : The location where the offset of the command within the route
+  *             is to be placed
+  * Returns:
+  *    const Lunar_CANTransport_RouteConfigItem_t * : The route of the command,
+  *    0 if the command has no response identifier
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *    * 10/19/2026: Return the route for the framing of the response (EJH)
+  *
+*/
+static const Lunar_CANTransport_RouteConfigItem_t *FindResponseRoute(const uint8_t moduleID, const uint8_t commandID, uint32_t *const offset) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function routes a single received frame to the Message Router and
+  *    sends the response when the route has a response identifier.  Frames
+  *    of segmented routes are passed to the ISO-TP module instead.
+  * Parameters:
+  *    channel : The channel the frame was received on
+  *    route : The route of the frame identifier
+  *    frame : The received frame, the response is written over its data
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *    * 10/19/2026: Pass frames of segmented routes to ISO-TP (EJH)
+  *    * 10/19/2026: Remove the node ID before mapping the identifier (EJH)
+  *
+*/
+static void RouteFrame(const CAN_Drv_Channel_t channel, const Lunar_CANTransport_RouteConfigItem_t *const route, CAN_Drv_Frame_t *const frame) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function executes the command held in a single frame via the
+  *    Message Router and sends the response when the route has a response
+  *    identifier.
+  * Parameters:
+  *    channel : The channel the frame was received on
+  *    route : The route of the frame identifier
+  *    offset : The offset of the frame identifier within the route
+  *    moduleID : The module ID the command is routed to
+  *    commandID : The command ID the command is routed to
+  *    nodeId : The node ID of the sender, used as the source address
+  *    frame : The received frame, the response is written over its data
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void RouteSingleFrame(const CAN_Drv_Channel_t channel, const Lunar_CANTransport_RouteConfigItem_t *const route, const uint32_t offset, const uint8_t moduleID, const uint8_t commandID, const uint8_t nodeId, CAN_Drv_Frame_t *const frame) PLATFORM_NON_NULL;
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Find the route of a CAN identifier
+static const Lunar_CANTransport_RouteConfigItem_t *FindRoute(const uint32_t canId)
+{
+   const Lunar_CANTransport_RouteConfigItem_t *route = 0;
+
+   // The table is short, so a linear search is used
+   for (uint8_t i = 0U; (i < NUM_ROUTES) && (route == 0); i++)
+   {
+      const uint32_t routedCanId = canId & ~Lunar_CANTransport_routeConfigTable[i].nodeIdMask;
+
+      if ((routedCanId >= Lunar_CANTransport_routeConfigTable[i].firstCanId) && (routedCanId <= Lunar_CANTransport_routeConfigTable[i].lastCanId))
+      {
+         route = &Lunar_CANTransport_routeConfigTable[i];
+      }
+   }
+
+   return(route);
+}
+
+
+// Find the route of the response of a module and command
+static const Lunar_CANTransport_RouteConfigItem_t *FindResponseRoute(const uint8_t moduleID, const uint8_t commandID, uint32_t *const offset)
+{
+   const Lunar_CANTransport_RouteConfigItem_t *responseRoute = 0;
+   // Module and command as a single value, consecutive identifiers map to consecutive values
+   const uint32_t routerId = ((uint32_t)moduleID << 8U) | commandID;
+
+   for (uint8_t i = 0U; (i < NUM_ROUTES) && (responseRoute == 0); i++)
+   {
+      const Lunar_CANTransport_RouteConfigItem_t *const route = &Lunar_CANTransport_routeConfigTable[i];
+      const uint32_t firstRouterId = ((uint32_t)route->moduleID << 8U) | route->commandID;
+
+      // Only routes with a response identifier can send the message
+      if ((route->firstResponseCanId != LUNAR_CANTRANSPORT_NO_RESPONSE) &&
+          (routerId >= firstRouterId) &&
+          ((routerId - firstRouterId) <= (route->lastCanId - route->firstCanId)))
+      {
+         responseRoute = route;
+         *offset = routerId - firstRouterId;
+      }
+   }
+
+   return(responseRoute);
+}
+
+
+// Route a received frame to the Message Router
+static void RouteFrame(const CAN_Drv_Channel_t channel, const Lunar_CANTransport_RouteConfigItem_t *const route, CAN_Drv_Frame_t *const frame)
+{
+   // Offset of the frame within the route, also used for the response identifier
+   const uint32_t offset = (frame->canId & ~route->nodeIdMask) - route->firstCanId;
+   // The lowest bit of the mask is the scale of the node ID
+   const uint32_t nodeIdScale = route->nodeIdMask & (~route->nodeIdMask + 1U);
+   uint8_t nodeId = 0U;
+   // Module and command of the frame as a single value
+   const uint32_t routerId = (((uint32_t)route->moduleID << 8U) | route->commandID) + offset;
+
+   if (nodeIdScale != 0U)
+   {
+      nodeId = (uint8_t)((frame->canId & route->nodeIdMask) / nodeIdScale);
+   }
+
+   status.statistics.numFramesRouted++;
+
+   if (route->framing == LUNAR_CANTRANSPORT_FRAMING_IsoTp)
+   {
+      // The command is reassembled and the response is sent by ISO-TP
+      Lunar_IsoTp_ReceiveFrame(channel, frame, route->firstResponseCanId + offset, (uint8_t)(routerId >> 8U), (uint8_t)routerId);
+   }
+   else
+   {
+      RouteSingleFrame(channel, route, offset, (uint8_t)(routerId >> 8U), (uint8_t)routerId, nodeId, frame);
+   }
+}
+
+
+// Route a complete command held in a single frame
+static void RouteSingleFrame(const CAN_Drv_Channel_t channel, const Lunar_CANTransport_RouteConfigItem_t *const route, const uint32_t offset, const uint8_t moduleID, const uint8_t commandID, const uint8_t nodeId, CAN_Drv_Frame_t *const frame)
+{
+   // Store the message object for easy access
+   Lunar_MessageRouter_Message_t *const message = &(status.currentMessage);
+
+   // Init the message to no error
+   message->responseCode = LUNAR_MESSAGEROUTER_RESPONSE_CODE_None;
+
+   // Note where the message came from so that handlers can reply on the same bus
+   message->source.transport = LUNAR_MESSAGEROUTER_TRANSPORT_CAN;
+   message->source.channel = (uint8_t)channel;
+   message->source.address = nodeId;
+   message->source.timestamp = frame->timestamp;
+
+   // Populate the command header from the identifier
+   // CAN frames do not carry a message ID
+   message->header.moduleID = moduleID;
+   message->header.commandID = commandID;
+   message->header.messageID = 0U;
+
+   // The command is read from and the response is written to the frame in the receive ring
+   message->commandParams.data = frame->data;
+   message->commandParams.maxLength = CAN_DRV_MAX_DATA_LENGTH;
+   message->commandParams.length = frame->length;
+   message->responseParams.data = frame->data;
+   message->responseParams.maxLength = CAN_DRV_MAX_DATA_LENGTH;
+   message->responseParams.length = 0U;
+
+   // Process message
+   Lunar_MessageRouter_ProcessMessage(message);
+
+   if (message->responseCode != LUNAR_MESSAGEROUTER_RESPONSE_CODE_None)
+   {
+      // A frame cannot carry the response code, so failed commands are only counted
+      status.statistics.numErrorResponses++;
+   }
+   else if (route->firstResponseCanId != LUNAR_CANTRANSPORT_NO_RESPONSE)
+   {
+      // Send the response with the identifier that matches the command
+      if (CAN_Drv_StartTransmitFrame(channel, route->firstResponseCanId + offset, message->responseParams.data, message->responseParams.length))
+      {
+         status.statistics.numResponsesSent++;
+      }
+      else
+      {
+         status.statistics.numResponsesDropped++;
+      }
+   }
+   // else, the route does not have a response (Ex. reports from another board)
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Initialize the CAN transport
+void Lunar_CANTransport_Init(void)
+{
+   memset(&status, 0, sizeof(status));
+}
+
+
+// Scheduled update loop for routing received frames
+void Lunar_CANTransport_Update(void)
+{
+   for (uint8_t channel = 0U; channel < CAN_DRV_CHANNEL_Count; channel++)
+   {
+      // Process every frame waiting in the receive ring
+      CAN_Drv_Frame_t *frame = CAN_Drv_PeekFrame((CAN_Drv_Channel_t)channel);
+
+      while (frame != 0)
+      {
+         const Lunar_CANTransport_RouteConfigItem_t *const route = FindRoute(frame->canId);
+
+         if (route != 0)
+         {
+            RouteFrame((CAN_Drv_Channel_t)channel, route, frame);
+         }
+         else
+         {
+            // The filters accepted a frame that is not routed, throw it away
+            status.statistics.numFramesUnrouted++;
+         }
+
+         // The frame and response are no longer needed
+         CAN_Drv_ReleaseFrame((CAN_Drv_Channel_t)channel);
+         frame = CAN_Drv_PeekFrame((CAN_Drv_Channel_t)channel);
+      }
+   }
+}
+
+
+// Send a message response as a single frame
+void Lunar_CANTransport_SendMessage(const uint8_t channel, Lunar_MessageRouter_Message_t *const message)
+{
+   // Make sure the given channel and message are valid
+   if ((channel < CAN_DRV_CHANNEL_Count) && (message != 0) && (message->responseParams.data != 0))
+   {
+      uint32_t offset = 0U;
+      const Lunar_CANTransport_RouteConfigItem_t *const route = FindResponseRoute(message->header.moduleID, message->header.commandID, &offset);
+      bool isSent = false;
+
+      if (route == 0)
+      {
+         // The response must have an identifier
+      }
+      else if (route->framing == LUNAR_CANTRANSPORT_FRAMING_IsoTp)
+      {
+         // The receiver sends its flow control frames with the command identifier
+         isSent = Lunar_IsoTp_StartTransmit((CAN_Drv_Channel_t)channel, route->firstCanId + offset, route->firstResponseCanId + offset,
+                                            message->responseParams.data, message->responseParams.length);
+      }
+      else if (message->responseParams.length <= CAN_DRV_MAX_DATA_LENGTH)
+      {
+         isSent = CAN_Drv_StartTransmitFrame((CAN_Drv_Channel_t)channel, route->firstResponseCanId + offset, message->responseParams.data, message->responseParams.length);
+      }
+      else
+      {
+         // The response does not fit in a single frame
+      }
+
+      if (isSent)
+      {
+         status.statistics.numResponsesSent++;
+      }
+      else
+      {
+         status.statistics.numResponsesDropped++;
+      }
+   }
+}
+
+
+/*******************************************************************************
+// Message Router Function Implementations
+*******************************************************************************/
+
+// Get the statistics of the routed frames and the sent responses
+void Lunar_CANTransport_MessageRouter_GetStatistics(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // Items from TxRxStatistics_t
+      uint32_t numFramesRouted;
+      uint32_t numFramesUnrouted;
+      uint32_t numResponsesSent;
+      uint32_t numResponsesDropped;
+      uint32_t numErrorResponses;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   {
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      response->numFramesRouted = status.statistics.numFramesRouted;
+      response->numFramesUnrouted = status.statistics.numFramesUnrouted;
+      response->numResponsesSent = status.statistics.numResponsesSent;
+      response->numResponsesDropped = status.statistics.numResponsesDropped;
+      response->numErrorResponses = status.statistics.numErrorResponses;
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
@@ -0,0 +1,148 @@
+/*******************************************************************************
+// Core CAN Transport Module
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Lunar_CANTransport_Config.h"
+// Platform Includes
+#include "Lunar_MessageRouter.h"
+#include "CAN_Drv.h"
+#include "Platform.h"
+// Other Includes
+#include <stdint.h>
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// Response identifier used for routes that do not send a response
+#define LUNAR_CANTRANSPORT_NO_RESPONSE (0U)
+
+
+/*******************************************************************************
+// Public Type Declarations
+*******************************************************************************/
+
+// The framing of the commands and responses of a route
+typedef enum
+{
+   // Each frame holds a complete command and the response is a single frame
+   LUNAR_CANTRANSPORT_FRAMING_Single,
+   // Commands and responses are segmented with ISO 15765-2 (ISO-TP)
+   LUNAR_CANTRANSPORT_FRAMING_IsoTp
+} Lunar_CANTransport_Framing_t;
+
+/** This is an item in the route table.  A route maps a range of CAN
+  * identifiers onto consecutive Message Router commands.  The identifier
+  * firstCanId is routed to moduleID/commandID and each following identifier
+  * to the next command, continuing with command 0x00 of the next module
+  * after command 0xFF.  When a response identifier is given, the response
+  * of the handler is sent with firstResponseCanId plus the same offset.
+  * Segmented routes must have a response identifier, since it is also used
+  * for the flow control frames.  Identifier bits in nodeIdMask carry the
+  * node ID of the sender, so many nodes can share a route.  These bits are
+  * ignored for routing and the node ID is passed to the handler as the
+  * address of the message source.  A route may use the mask for other
+  * per-frame values instead of a node ID (Ex. the block and frame numbers
+  * of the firmware update data frames), its handler then decodes
+  * source.address itself.
+*/
+typedef struct
+{
+   // First CAN identifier of the range, bit 31 is set for an extended identifier
+   uint32_t firstCanId;
+
+   // Last CAN identifier of the range
+   uint32_t lastCanId;
+
+   // Module ID that firstCanId is routed to
+   uint8_t moduleID;
+
+   // Command ID that firstCanId is routed to
+   uint8_t commandID;
+
+   // CAN identifier of the response to firstCanId or LUNAR_CANTRANSPORT_NO_RESPONSE
+   uint32_t firstResponseCanId;
+
+   // Framing of the commands and responses
+   Lunar_CANTransport_Framing_t framing;
+
+   // Contiguous identifier bits that hold the node ID of the sender, 0 if not used
+   uint32_t nodeIdMask;
+} Lunar_CANTransport_RouteConfigItem_t;
+
+
+/*******************************************************************************
+// Public Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function initializes the CAN transport and clears its statistics.
+  *    The CAN driver must already be initialized.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_CANTransport_Init(void);
+
+/** Description:
+  *    This is the scheduled update function that routes every received frame
+  *    to the Message Router.  The command and response use the frame data in
+  *    the receive ring, so no copy or buffer pool block is needed.  The
+  *    response is sent on the same channel when the route of the frame has a
+  *    response identifier and the command did not fail.  Frames of
+  *    segmented routes are passed to the ISO-TP module.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *    * 10/19/2026: Pass frames of segmented routes to ISO-TP (EJH)
+  *    * 10/19/2026: Pass the node ID of the sender as the source address (EJH)
+  *
+*/
+void Lunar_CANTransport_Update(void);
+
+/** Description:
+  *    This function sends the response of the given message with the
+  *    framing of its route.  The identifier is found from the route of the
+  *    module and command, so only commands with a response identifier can be
+  *    sent.  This allows other modules to send unsolicited responses (Ex.
+  *    subscriptions) on the bus.
+  * Parameters:
+  *    channel - The configured CAN channel index used to send the message
+  *    message - A pointer to the Message Router object to be sent
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *    * 10/19/2026: Send responses of segmented routes through ISO-TP (EJH)
+  *
+*/
+void Lunar_CANTransport_SendMessage(const uint8_t channel, Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+
+/** Description:
+  *    This is the command handler used for querying the statistics of the
+  *    routed frames and the sent responses.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_CANTransport_MessageRouter_GetStatistics(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
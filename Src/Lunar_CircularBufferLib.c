@@ -110,6 +110,13 @@ bool Lunar_CircularBufferLib_Enqueue(Lunar_CircularBufferLib_t *const circularBu
          {
             // Increment the read index (because the write passed the read index).
             circularBuffer->indexRead++;
+
+            // Wrap the read index like the dequeue does
+            if (circularBuffer->indexRead >= circularBuffer->maxSize)
+            {
+               circularBuffer->indexRead = 0;
+            }
+
             // Decrement the size of the data in the buffer.
             circularBuffer->size--;
          }
@@ -0,0 +1,545 @@
+/*******************************************************************************
+// Core Error Log Module
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Lunar_ErrorLog.h"
+#include "Lunar_ErrorLog_Config.h"
+// Platform Includes
+#include "Flash_Drv.h"
+#include "Lunar_ErrorMgr.h"
+#include "Lunar_MathLib.h"
+#include "Lunar_TimeSync.h"
+#include "Timebase_Drv.h"
+// Other Includes
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// Marks a programmed page of the log ("ELOG")
+#define PAGE_MAGIC (0x474F4C45UL)
+
+// The number of pages in each sector of the log
+#define NUM_PAGES_PER_SECTOR (FLASH_DRV_SECTOR_SIZE / FLASH_DRV_PAGE_SIZE)
+
+// The number of pages in the log
+#define NUM_PAGES (NUM_PAGES_PER_SECTOR * LUNAR_ERRORLOG_NUM_SECTORS)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// This structure defines the start of every page in the log
+typedef struct
+{
+   // PAGE_MAGIC for a programmed page
+   uint32_t magic;
+
+   // Increments for every page written, the highest number is the newest page
+   uint32_t sequenceNumber;
+
+   // Increments on every reset, used to order the record timestamps
+   uint16_t bootNumber;
+
+   // The number of valid records in the page
+   uint16_t numRecords;
+
+   // All error flags at the time the page was written
+   uint32_t errorWords[LUNAR_ERRORMGR_NUM_ERROR_WORDS];
+
+   // CRC-16 of the page, excluding this field
+   uint16_t checksum;
+
+   // Unused, always 0
+   uint16_t reserved;
+} PageHeader_t;
+
+// The number of records that fit in a page after the header
+#define NUM_RECORDS_PER_PAGE ((FLASH_DRV_PAGE_SIZE - sizeof(PageHeader_t)) / sizeof(Lunar_ErrorLog_Record_t))
+
+// This is the format of one page of the log
+// The words are used for programming, the contents for building the page
+typedef union
+{
+   uint32_t words[FLASH_DRV_WORDS_PER_PAGE];
+   struct
+   {
+      PageHeader_t header;
+      Lunar_ErrorLog_Record_t records[NUM_RECORDS_PER_PAGE];
+   } contents;
+} Page_t;
+
+// This enumeration defines the states of the flash write sequence
+typedef enum
+{
+   // Waiting for records to be written
+   ERRORLOG_STATE_Idle,
+   // Erasing the sector that holds the next page
+   ERRORLOG_STATE_Erasing,
+   // Programming the next page
+   ERRORLOG_STATE_Programming,
+} Lunar_ErrorLog_State_t;
+
+// This structure holds the private information for this module
+typedef struct
+{
+   // The state of the flash write sequence
+   Lunar_ErrorLog_State_t state;
+
+   // The page holding the records that have not been written
+   Page_t page;
+
+   // Tick count when the first pending record was added
+   uint32_t firstRecordTime;
+
+   // The index of the next page to be written
+   uint32_t nextPageIndex;
+
+   // The sequence number of the next page to be written
+   uint32_t nextSequenceNumber;
+
+   // The boot number written to every page since reset
+   uint16_t bootNumber;
+
+   // The sequence number of the page being programmed, used for verification
+   uint32_t programSequenceNumber;
+
+   // The number of records in the page being programmed
+   uint16_t programNumRecords;
+
+   // Diagnostic counters
+   struct
+   {
+      // Records lost because the page was full or could not be written
+      uint32_t numDroppedRecords;
+
+      // Erase or program operations that failed
+      uint32_t numFailedOperations;
+   } statistics;
+} Lunar_ErrorLog_Status_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The variable used for holding all internal data for this module.
+static Lunar_ErrorLog_Status_t status;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function returns the flash address of the given page of the log.
+  * Parameters:
+  *    pageIndex :  Index of the page, 0 is the first page of the first sector
+  * Returns:
+  *    uint32_t - The address of the page
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static inline uint32_t GetPageAddress(const uint32_t pageIndex);
+
+/** Description:
+  *    This function calculates the checksum of a page, skipping the checksum
+  *    field itself.
+  * Parameters:
+  *    page :  The page to be checked
+  * Returns:
+  *    uint16_t - The CRC-16 of the page
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint16_t CalculateChecksum(const Page_t *const page);
+
+/** Description:
+  *    This function determines if the given page of the log has never been
+  *    programmed since its sector was erased.  Pages are always programmed in
+  *    order, so only the first word is checked.
+  * Parameters:
+  *    pageIndex :  Index of the page to be checked
+  * Returns:
+  *    bool - true if the page is blank
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool IsPageBlank(const uint32_t pageIndex);
+
+/** Description:
+  *    This function reads the given page of the log and checks its contents.
+  * Parameters:
+  *    pageIndex :  Index of the page to be read
+  *    page :       Buffer for the page contents
+  * Returns:
+  *    bool - true if the page holds a complete, valid set of records
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool ReadPage(const uint32_t pageIndex, Page_t *const page);
+
+/** Description:
+  *    This function finds the first page of the given sector that holds valid
+  *    records.  Normally this is the first page, unless writing the first
+  *    page was interrupted.
+  * Parameters:
+  *    sector :          Index of the sector to be searched
+  *    sequenceNumber :  Set to the sequence number of the page that was found
+  * Returns:
+  *    bool - true if a valid page was found in the sector
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool FindFirstValidPage(const uint32_t sector, uint32_t *const sequenceNumber);
+
+/** Description:
+  *    This function clears the pending page so new records can be added.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void ResetPendingPage(void);
+
+/** Description:
+  *    This function completes the pending page and starts programming it at
+  *    the next page of the log.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void StartProgramming(void);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Get the address of a page
+static inline uint32_t GetPageAddress(const uint32_t pageIndex)
+{
+   return(LUNAR_ERRORLOG_FLASH_START_ADDRESS + (pageIndex * FLASH_DRV_PAGE_SIZE));
+}
+
+
+// Calculate the checksum of a page
+static uint16_t CalculateChecksum(const Page_t *const page)
+{
+   const uint8_t *data = (const uint8_t *)page->words;
+
+   // Everything before the checksum field
+   uint16_t crc = Lunar_MathLib_Crc16(data, offsetof(PageHeader_t, checksum), LUNAR_MATHLIB_CRC16_INITIAL_VALUE);
+
+   // Everything after the checksum field
+   crc = Lunar_MathLib_Crc16(&data[offsetof(PageHeader_t, reserved)], FLASH_DRV_PAGE_SIZE - offsetof(PageHeader_t, reserved), crc);
+
+   return(crc);
+}
+
+
+// Check if a page is blank
+static bool IsPageBlank(const uint32_t pageIndex)
+{
+   uint32_t firstWord;
+
+   Flash_Drv_Read(GetPageAddress(pageIndex), &firstWord, sizeof(firstWord));
+
+   return(firstWord == FLASH_DRV_ERASED_WORD);
+}
+
+
+// Read and validate a page
+static bool ReadPage(const uint32_t pageIndex, Page_t *const page)
+{
+   Flash_Drv_Read(GetPageAddress(pageIndex), page->words, sizeof(page->words));
+
+   return((page->contents.header.magic == PAGE_MAGIC) &&
+          (page->contents.header.numRecords <= NUM_RECORDS_PER_PAGE) &&
+          (page->contents.header.checksum == CalculateChecksum(page)));
+}
+
+
+// Find the first valid page of a sector
+static bool FindFirstValidPage(const uint32_t sector, uint32_t *const sequenceNumber)
+{
+   bool pageFound = false;
+   uint32_t firstPage = sector * NUM_PAGES_PER_SECTOR;
+
+   // Stop at the first blank page, nothing after it has been written
+   for (uint32_t pageIndex = firstPage; (pageIndex < (firstPage + NUM_PAGES_PER_SECTOR)) && (!IsPageBlank(pageIndex)); pageIndex++)
+   {
+      if (ReadPage(pageIndex, &status.page))
+      {
+         *sequenceNumber = status.page.contents.header.sequenceNumber;
+         pageFound = true;
+         break;
+      }
+   }
+
+   return(pageFound);
+}
+
+
+// Clear the pending page
+static void ResetPendingPage(void)
+{
+   // Unused records are written as 0 so the checksum is repeatable
+   memset(&status.page, 0, sizeof(status.page));
+}
+
+
+// Start programming the pending page
+static void StartProgramming(void)
+{
+   PageHeader_t *header = &status.page.contents.header;
+
+   // Complete the header, the records are already in place
+   header->magic = PAGE_MAGIC;
+   header->sequenceNumber = status.nextSequenceNumber;
+   header->bootNumber = status.bootNumber;
+   Lunar_ErrorMgr_GetErrorWords(header->errorWords);
+   header->checksum = CalculateChecksum(&status.page);
+
+   if (Flash_Drv_StartProgramPage(GetPageAddress(status.nextPageIndex), status.page.words))
+   {
+      // The driver has its own copy of the page, so new records can be added
+      status.programSequenceNumber = status.nextSequenceNumber;
+      status.programNumRecords = header->numRecords;
+      status.nextSequenceNumber++;
+      ResetPendingPage();
+      status.state = ERRORLOG_STATE_Programming;
+   }
+   else
+   {
+      // Try again on the next update
+      status.state = ERRORLOG_STATE_Idle;
+   }
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Recover the log from flash
+void Lunar_ErrorLog_Init(void)
+{
+   bool newestFound = false;
+   uint32_t newestSector = 0U;
+   uint32_t newestSequenceNumber = 0U;
+
+   memset(&status, 0, sizeof(status));
+   status.state = ERRORLOG_STATE_Idle;
+
+   // Sectors are filled in order, so the newest sector starts with the
+   // highest sequence number.  Wrapping of the sequence number is allowed.
+   for (uint32_t sector = 0U; sector < LUNAR_ERRORLOG_NUM_SECTORS; sector++)
+   {
+      uint32_t sequenceNumber;
+
+      if ((FindFirstValidPage(sector, &sequenceNumber)) &&
+          ((!newestFound) || ((int32_t)(sequenceNumber - newestSequenceNumber) > 0)))
+      {
+         newestFound = true;
+         newestSector = sector;
+         newestSequenceNumber = sequenceNumber;
+      }
+   }
+
+   if (newestFound)
+   {
+      uint32_t firstPage = newestSector * NUM_PAGES_PER_SECTOR;
+      uint32_t low = 0U;
+      uint32_t high = NUM_PAGES_PER_SECTOR;
+
+      // Binary search for the first blank page of the sector
+      // Every page before it has been programmed, every page after it is blank
+      while (low < high)
+      {
+         uint32_t middle = low + ((high - low) / 2U);
+
+         if (IsPageBlank(firstPage + middle))
+         {
+            high = middle;
+         }
+         else
+         {
+            low = middle + 1U;
+         }
+      }
+
+      // Never program over a used page, even if it is not valid
+      status.nextPageIndex = (firstPage + low) % NUM_PAGES;
+
+      // The newest valid page is normally the last programmed page
+      bool pageValid = false;
+      for (uint32_t pageIndex = firstPage + low; (pageIndex > firstPage) && (!pageValid); pageIndex--)
+      {
+         pageValid = ReadPage(pageIndex - 1U, &status.page);
+      }
+
+      // Fall back to the first valid page of the sector, which always exists
+      if (!pageValid)
+      {
+         (void)FindFirstValidPage(newestSector, &newestSequenceNumber);
+      }
+
+      // Continue from the newest page
+      status.nextSequenceNumber = status.page.contents.header.sequenceNumber + 1U;
+      status.bootNumber = status.page.contents.header.bootNumber + 1U;
+
+      // Restore the errors that persist across resets
+      // This adds records to the pending page, so copy the errors first
+      uint32_t errorWords[LUNAR_ERRORMGR_NUM_ERROR_WORDS];
+      memcpy(errorWords, status.page.contents.header.errorWords, sizeof(errorWords));
+      ResetPendingPage();
+      Lunar_ErrorMgr_RestorePersistentErrors(errorWords);
+   }
+   else
+   {
+      // Empty log, start at the first page
+      ResetPendingPage();
+      status.nextPageIndex = 0U;
+      status.nextSequenceNumber = 1U;
+   }
+}
+
+
+// Write pending records to flash
+void Lunar_ErrorLog_Update(void)
+{
+   // Only the operation of this module is advanced, the flash driver is
+   // shared with the firmware update, which paces its own operations
+   if (status.state != ERRORLOG_STATE_Idle)
+   {
+      Flash_Drv_Update();
+   }
+
+   switch (status.state)
+   {
+      case ERRORLOG_STATE_Idle:
+      {
+         uint16_t numRecords = status.page.contents.header.numRecords;
+         uint32_t elapsedTime = Timebase_Drv_GetCurrentTickCount() - status.firstRecordTime;
+
+         // Write once the page is full or the oldest record has waited long enough
+         if ((numRecords >= NUM_RECORDS_PER_PAGE) ||
+             ((numRecords > 0U) && (elapsedTime >= (LUNAR_ERRORLOG_FLUSH_DELAY_MS * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND))))
+         {
+            // The sector must be erased before its first page is written
+            // This discards the oldest sector of the log
+            if ((status.nextPageIndex % NUM_PAGES_PER_SECTOR) == 0U)
+            {
+               if (Flash_Drv_StartEraseSector(GetPageAddress(status.nextPageIndex)))
+               {
+                  status.state = ERRORLOG_STATE_Erasing;
+               }
+            }
+            else
+            {
+               StartProgramming();
+            }
+         }
+         break;
+      }
+
+      case ERRORLOG_STATE_Erasing:
+      {
+         if (!Flash_Drv_IsBusy())
+         {
+            if (Flash_Drv_DidOperationFail())
+            {
+               // Skip the sector, the records are written to the next one
+               status.statistics.numFailedOperations++;
+               status.nextPageIndex = (status.nextPageIndex + NUM_PAGES_PER_SECTOR) % NUM_PAGES;
+               status.state = ERRORLOG_STATE_Idle;
+            }
+            else
+            {
+               StartProgramming();
+            }
+         }
+         break;
+      }
+
+      case ERRORLOG_STATE_Programming:
+      {
+         if (!Flash_Drv_IsBusy())
+         {
+            PageHeader_t header;
+
+            // Read back the header to make sure the page was written
+            // The records are not retained, so a failed page loses them
+            Flash_Drv_Read(GetPageAddress(status.nextPageIndex), &header, sizeof(header));
+
+            if ((Flash_Drv_DidOperationFail()) || (header.magic != PAGE_MAGIC) || (header.sequenceNumber != status.programSequenceNumber))
+            {
+               status.statistics.numFailedOperations++;
+               status.statistics.numDroppedRecords += status.programNumRecords;
+            }
+
+            // Never program the same page twice, but reuse a page that was
+            // left blank so the log has no gaps for the boot search
+            if (!IsPageBlank(status.nextPageIndex))
+            {
+               status.nextPageIndex = (status.nextPageIndex + 1U) % NUM_PAGES;
+            }
+            status.state = ERRORLOG_STATE_Idle;
+         }
+         break;
+      }
+
+      default:
+      {
+         // Invalid state, start over
+         status.state = ERRORLOG_STATE_Idle;
+         break;
+      }
+   }
+}
+
+
+// Add an error transition to the pending page
+void Lunar_ErrorLog_RecordErrorState(const Lunar_ErrorMgr_Error_t error, const bool errorState)
+{
+   uint16_t numRecords = status.page.contents.header.numRecords;
+
+   if (numRecords < NUM_RECORDS_PER_PAGE)
+   {
+      Lunar_ErrorLog_Record_t *record = &status.page.contents.records[numRecords];
+
+      // The flush delay starts with the first record
+      if (numRecords == 0U)
+      {
+         status.firstRecordTime = Timebase_Drv_GetCurrentTickCount();
+      }
+
+      record->timestamp = Lunar_TimeSync_GetTimeMs();
+      record->error = (uint16_t)error;
+      record->errorState = errorState ? 1U : 0U;
+      record->isSynchronized = Lunar_TimeSync_IsSynchronized() ? 1U : 0U;
+
+      status.page.contents.header.numRecords = numRecords + 1U;
+   }
+   else
+   {
+      // The page is full and waiting for the flash
+      status.statistics.numDroppedRecords++;
+   }
+}
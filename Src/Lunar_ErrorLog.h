@@ -0,0 +1,95 @@
+/*******************************************************************************
+// Core Error Log Module
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Lunar_ErrorLog_Config.h"
+// Platform Includes
+#include "Lunar_ErrorMgr.h"
+#include "Platform.h"
+// Other Includes
+#include <stdbool.h>
+#include <stdint.h>
+
+
+/*******************************************************************************
+// Public Type Declarations
+*******************************************************************************/
+
+// This structure defines a single error transition stored in the log
+typedef struct
+{
+   // Synchronized time of the transition in milliseconds
+   // Before the time is synchronized, this is relative to the boot number
+   // of the page holding the record
+   uint32_t timestamp;
+
+   // The error that changed state
+   uint16_t error;
+
+   // The new state of the error (0 = cleared, 1 = set)
+   uint8_t errorState;
+
+   // 1 if the timestamp follows the time master, 0 if it is local time
+   uint8_t isSynchronized;
+} Lunar_ErrorLog_Record_t;
+
+
+/*******************************************************************************
+// Public Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function recovers the error log from flash.  The newest page is
+  *    located by a binary search of the newest sector, so only a few pages
+  *    are read.  The persistent errors stored in the newest page are restored
+  *    to the Error Manager, so this must be called after every module that
+  *    handles the critical error event has been initialized.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_ErrorLog_Init(void);
+
+/** Description:
+  *    This is the scheduled update function for the error log.  Pending
+  *    records are written as a single page once the page is full or the
+  *    oldest record has waited LUNAR_ERRORLOG_FLUSH_DELAY_MS.  The erase and
+  *    program operations run in the background and are checked on each call.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *    * 10/19/2026: Only advance the operations of the error log (EJH)
+  *
+*/
+void Lunar_ErrorLog_Update(void);
+
+/** Description:
+  *    This function adds an error transition to the pending page.  The
+  *    record is dropped if the page is full while a flash operation is in
+  *    progress.  The record is stamped with the synchronized time, so the
+  *    logs of different nodes can be merged.
+  * Parameters:
+  *    error :       The error that changed state
+  *    errorState :  The new state of the error
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *    * 10/19/2026: Stamp with the synchronized time (EJH)
+  *
+*/
+void Lunar_ErrorLog_RecordErrorState(const Lunar_ErrorMgr_Error_t error, const bool errorState);
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
@@ -10,37 +10,95 @@
 #include "Lunar_ErrorMgr_Config.h"
 #include "Lunar_ErrorMgr_ConfigTable.h"
 // Platform Includes
+#include "Lunar_ErrorLog.h"
 #include "Lunar_EventMgr.h"
+#include "Timebase_Drv.h"
 // Other Includes
 #include <stdint.h>
+#include <string.h>
 
 
 /*******************************************************************************
 // Private Constants
 *******************************************************************************/
 
-/** This is the number of critical errors defined in the Critical
-  * Errors array. Note that this value must match the number of
-  * critical errors in the array.                                
-*/
-#define LUNAR_ERRORMGR_CRITICAL_ERROR_COUNT (sizeof(Lunar_ErrorMgr_criticalErrorConfigTable)/sizeof(Lunar_ErrorMgr_Error_t))
-
-// This is the number of persistent errors that are expected to remain after a reboot
-#define LUNAR_ERRORMGR_PERSISTENT_ERROR_COUNT (sizeof(Lunar_ErrorMgr_persistentErrorConfigTable)/sizeof(Lunar_ErrorMgr_Error_t))
-
 // This defines the number of bytes it takes to fully bit-pack all of the error flags.
 #define LUNAR_ERRORMGR_NUM_BYTES_TO_BIT_PACK_ERRORS (((uint8_t)LUNAR_ERRORMGR_ERROR_Count + 7)/8)
 
+// The number of bytes in each error word
+#define ERROR_WORD_SIZE (sizeof(uint32_t))
+
+// The number of transitions returned by one GetRecentTransitions command
+#define TRANSITIONS_PER_READ (6U)
+
 
 /*******************************************************************************
 // Private Type Declarations
 *******************************************************************************/
 
+// This structure holds the occurrence history of a single error
+typedef struct
+{
+   // Number of times the error has been set, saturates at UINT16_MAX
+   uint16_t numOccurrences;
+
+   // Tick count when the error was first set
+   uint32_t firstSeenTime;
+
+   // Tick count when the error was last set
+   uint32_t lastSeenTime;
+} ErrorHistory_t;
+
+// This structure holds one entry of the recent transition ring
+typedef struct
+{
+   // Tick count of the transition
+   uint32_t timestamp;
+
+   // The error that changed state
+   uint8_t error;
+
+   // The new state of the error
+   bool errorState;
+} Transition_t;
+
+// This structure holds the qualification state of a single error
+typedef struct
+{
+   // true while the opposite of the current state is requested
+   bool isQualifying;
+
+   // Tick count of the first request for the opposite of the current state
+   uint32_t qualifyStartTime;
+
+   // true once the critical error event has been raised for the error
+   bool eventRaised;
+
+   // Tick count when the critical error event was last raised
+   uint32_t lastEventTime;
+} Qualification_t;
+
 // This structure hold the private data for this module
 typedef struct
 {
-   // This array holds all of the errors
-   bool errors[LUNAR_ERRORMGR_ERROR_Count];
+   // This array holds all of the errors, one bit per error
+   // Error 0 is stored in bit 0 of word 0, error 32 in bit 0 of word 1, etc.
+   uint32_t errorWords[LUNAR_ERRORMGR_NUM_ERROR_WORDS];
+
+   // The qualification state of each error
+   Qualification_t qualification[LUNAR_ERRORMGR_ERROR_Count];
+
+   // The occurrence history of each error
+   ErrorHistory_t history[LUNAR_ERRORMGR_ERROR_Count];
+
+   // The most recent transitions, oldest entries are overwritten
+   Transition_t transitions[LUNAR_ERRORMGR_NUM_HISTORY_TRANSITIONS];
+
+   // The index of the next transition to be written
+   uint32_t nextTransitionIndex;
+
+   // The total number of transitions since the history was cleared
+   uint32_t numTransitions;
 } Lunar_ErrorMgr_Status_t;
 
 
@@ -72,6 +130,56 @@ static Lunar_ErrorMgr_Status_t status;
 */
 static bool IsCriticalError(const Lunar_ErrorMgr_Error_t error);
 
+/** Description:
+  *    This function returns the critical error mask for the given word.
+  * Parameters:
+  *    word :  Index of the error word
+  * Returns:
+  *    uint32_t - The bits of the critical errors stored in the word
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static inline uint32_t GetCriticalErrorMask(const uint32_t word);
+
+/** Description:
+  *    This function updates the history of the given error and adds the
+  *    transition to the recent transitions.  It runs in constant time since
+  *    it is called on every change of an error.
+  * Parameters:
+  *    error :       The error that changed state
+  *    errorState :  The new state of the error
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void RecordTransition(const Lunar_ErrorMgr_Error_t error, const bool errorState);
+
+/** Description:
+  *    This function changes the state of a valid error without qualification
+  *    and raises the critical error event if the error is critical and the
+  *    event was not raised within its minimum re-trigger interval.
+  * Parameters:
+  *    error :       The error to be changed
+  *    errorState :  The new state of the error
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void ChangeErrorState(const Lunar_ErrorMgr_Error_t error, const bool errorState);
+
+/** Description:
+  *    This function raises the critical error event for an error that was
+  *    set, unless the event was raised for it within its minimum re-trigger
+  *    interval.
+  * Parameters:
+  *    error :  The critical error that was set
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void RaiseCriticalErrorEvent(const Lunar_ErrorMgr_Error_t error);
+
 
 /*******************************************************************************
 // Private Function Implementations
@@ -80,24 +188,116 @@ static bool IsCriticalError(const Lunar_ErrorMgr_Error_t error);
 // This function return true if the given error is a critical error
 static bool IsCriticalError(const Lunar_ErrorMgr_Error_t error)
 {
-	// Assume no ciriticl error
-   bool foundCriticalError = false;
+   // Check the bit of the error in the critical mask for its word
+   uint32_t word = (uint32_t)error / 32U;
+   uint32_t bit = 1UL << ((uint32_t)error % 32U);
 
-   // Loop through the array of critical errors and see if any are flagged
-   for (uint8_t i = 0U; i < LUNAR_ERRORMGR_CRITICAL_ERROR_COUNT; i++)
+   return((GetCriticalErrorMask(word) & bit) != 0U);
+}
+
+
+// Get the critical error mask for a word
+static inline uint32_t GetCriticalErrorMask(const uint32_t word)
+{
+   // The configuration mask is a constant expression for a constant word
+   return(LUNAR_ERRORMGR_CRITICAL_ERROR_MASK(word));
+}
+
+
+// Record a change of an error
+static void RecordTransition(const Lunar_ErrorMgr_Error_t error, const bool errorState)
+{
+   uint32_t currentTime = Timebase_Drv_GetCurrentTickCount();
+
+   // Only setting the error counts as an occurrence
+   if (errorState)
    {
-      if (error == Lunar_ErrorMgr_criticalErrorConfigTable[i])
+      ErrorHistory_t *history = &status.history[error];
+
+      if (history->numOccurrences == 0U)
       {
-         // We have found a critical error
-         // Set the return value to true
-         foundCriticalError = true;
-         // Exit the for loop
-         break;
+         history->firstSeenTime = currentTime;
+      }
+
+      if (history->numOccurrences < UINT16_MAX)
+      {
+         history->numOccurrences++;
       }
+
+      history->lastSeenTime = currentTime;
    }
 
-   // Return the critical error status
-   return(foundCriticalError);
+   // Overwrite the oldest transition
+   Transition_t *transition = &status.transitions[status.nextTransitionIndex];
+   transition->timestamp = currentTime;
+   transition->error = (uint8_t)error;
+   transition->errorState = errorState;
+
+   status.nextTransitionIndex++;
+   if (status.nextTransitionIndex >= LUNAR_ERRORMGR_NUM_HISTORY_TRANSITIONS)
+   {
+      status.nextTransitionIndex = 0U;
+   }
+   status.numTransitions++;
+
+#if ERRORMGR_FLASH_STORAGE_ENABLED
+   // Add the transition to the error log
+   Lunar_ErrorLog_RecordErrorState(error, errorState);
+#endif
+
+   // Let other modules publish the change without polling
+   Lunar_EventMgr_HandleEvent(LUNAR_EVENTMGR_CONFIG_EVENT_Error_Changed);
+}
+
+
+// Change the state of an error
+static void ChangeErrorState(const Lunar_ErrorMgr_Error_t error, const bool errorState)
+{
+   uint32_t *errorWord = &status.errorWords[(uint32_t)error / 32U];
+   uint32_t bit = 1UL << ((uint32_t)error % 32U);
+
+   // If the state of this error is changing, continue
+   if (((*errorWord & bit) != 0U) != errorState)
+   {
+      // Error state is changing
+      // We have a valid error index, set the value
+      if (errorState)
+      {
+         *errorWord |= bit;
+      }
+      else
+      {
+         *errorWord &= ~bit;
+      }
+
+      // Keep the history of the error
+      RecordTransition(error, errorState);
+
+      // See if this a critical error being set
+      if ((errorState) && (IsCriticalError(error)))
+      {
+         RaiseCriticalErrorEvent(error);
+      }
+   }
+}
+
+
+// Raise the critical error event
+static void RaiseCriticalErrorEvent(const Lunar_ErrorMgr_Error_t error)
+{
+   Qualification_t *qualification = &status.qualification[error];
+   uint32_t currentTime = Timebase_Drv_GetCurrentTickCount();
+   uint32_t minRetriggerTime = (uint32_t)Lunar_ErrorMgr_qualificationConfigTable[error].minRetriggerMs * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND;
+
+   // Limit how often a flickering error can trigger the event
+   if ((!qualification->eventRaised) || ((currentTime - qualification->lastEventTime) >= minRetriggerTime))
+   {
+      qualification->eventRaised = true;
+      qualification->lastEventTime = currentTime;
+
+      // Trigger the event
+      Lunar_EventMgr_HandleEvent(LUNAR_EVENTMGR_CONFIG_EVENT_Critical_Error);
+   }
 }
 
 
@@ -110,6 +310,9 @@ void Lunar_ErrorMgr_Init(void)
 {
    // Clear all flags.
    Lunar_ErrorMgr_ClearAllErrors();
+
+   // Start a new history
+   Lunar_ErrorMgr_ClearErrorHistory();
 }
 
 
@@ -119,18 +322,30 @@ void Lunar_ErrorMgr_SetErrorState(const Lunar_ErrorMgr_Error_t error, const bool
    // Verify that the error does not exceed the maximum error value
    if (error < LUNAR_ERRORMGR_ERROR_Count)
    {
-      // If the state of this error is changing, continue
-      if (status.errors[(uint8_t)error] != errorState)
+      Qualification_t *qualification = &status.qualification[error];
+
+      if (Lunar_ErrorMgr_GetErrorState(error) == errorState)
+      {
+         // The request agrees with the current state, restart the qualification
+         qualification->isQualifying = false;
+      }
+      else
       {
-         // Error state is changing
-         // We have a valid error index, set the value
-         status.errors[(uint8_t)error] = errorState;
+         const Lunar_ErrorMgr_QualificationConfigItem_t *config = &Lunar_ErrorMgr_qualificationConfigTable[error];
+         uint32_t requiredTime = (uint32_t)(errorState ? config->setTimeMs : config->clearTimeMs) * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND;
+         uint32_t currentTime = Timebase_Drv_GetCurrentTickCount();
+
+         if (!qualification->isQualifying)
+         {
+            qualification->isQualifying = true;
+            qualification->qualifyStartTime = currentTime;
+         }
 
-         // See if this a critical error being set
-         if ((errorState) && (IsCriticalError(error)))
+         // Only change the state once it was requested long enough
+         if ((currentTime - qualification->qualifyStartTime) >= requiredTime)
          {
-            // Trigger the event
-            Lunar_EventMgr_HandleEvent(LUNAR_EVENTMGR_CONFIG_EVENT_Critical_Error);
+            qualification->isQualifying = false;
+            ChangeErrorState(error, errorState);
          }
       }
    }
@@ -146,7 +361,7 @@ bool Lunar_ErrorMgr_GetErrorState(const Lunar_ErrorMgr_Error_t error)
    if (error < LUNAR_ERRORMGR_ERROR_Count)
    {
       // We have a valid error index, return the value
-      errorState = status.errors[(uint8_t)error];
+      errorState = ((status.errorWords[(uint32_t)error / 32U] & (1UL << ((uint32_t)error % 32U))) != 0U);
    }
 
    // Finally, return the result
@@ -159,10 +374,10 @@ bool Lunar_ErrorMgr_DoAnyErrorsExist(void)
    // Assume failure
    bool errorsFound = false;
 
-   // Loop through all error flags to see if any are true
-   for (uint8_t i = 0U; i < (uint8_t)LUNAR_ERRORMGR_ERROR_Count; i++)
+   // Any set bit in any word is an error
+   for (uint32_t i = 0U; i < LUNAR_ERRORMGR_NUM_ERROR_WORDS; i++)
    {
-      if (Lunar_ErrorMgr_GetErrorState((Lunar_ErrorMgr_Error_t)i))
+      if (status.errorWords[i] != 0U)
       {
          errorsFound = true;
          // found an error, no need to keep looking
@@ -179,10 +394,10 @@ bool Lunar_ErrorMgr_GetCriticalErrorStatus(void)
 	// Assume failure
    bool errorState = false;
 
-   // Loop through the array of critical errors and see if any are flagged
-   for (uint8_t i = 0U; i < LUNAR_ERRORMGR_CRITICAL_ERROR_COUNT; i++)
+   // Compare each error word against the critical errors in that word
+   for (uint32_t i = 0U; i < LUNAR_ERRORMGR_NUM_ERROR_WORDS; i++)
    {
-      if (Lunar_ErrorMgr_GetErrorState(Lunar_ErrorMgr_criticalErrorConfigTable[i]))
+      if ((status.errorWords[i] & GetCriticalErrorMask(i)) != 0U)
       {
          // We have found a critical error
          // Set the return value to true
@@ -199,11 +414,23 @@ bool Lunar_ErrorMgr_GetCriticalErrorStatus(void)
 // Clear all errors
 void Lunar_ErrorMgr_ClearAllErrors(void)
 {
-   // Loop through the error values and initialize the values to false
-   for (uint8_t i = 0U; i < (uint8_t)LUNAR_ERRORMGR_ERROR_Count; i++)
+   // Record each error being cleared, this also keeps persistent errors
+   // from being restored
+   for (uint32_t error = 0U; error < (uint32_t)LUNAR_ERRORMGR_ERROR_Count; error++)
+   {
+      if (Lunar_ErrorMgr_GetErrorState((Lunar_ErrorMgr_Error_t)error))
+      {
+         RecordTransition((Lunar_ErrorMgr_Error_t)error, false);
+      }
+   }
+
+   // Clear every error bit (non-error state)
+   memset(status.errorWords, 0, sizeof(status.errorWords));
+
+   // Any qualification in progress no longer applies
+   for (uint32_t error = 0U; error < (uint32_t)LUNAR_ERRORMGR_ERROR_Count; error++)
    {
-      // Set the flag to false (non-error state)
-      status.errors[i] = false;
+      status.qualification[error].isQualifying = false;
    }
 }
 
@@ -217,39 +444,60 @@ uint8_t Lunar_ErrorMgr_GetBitPackedErrors(uint8_t byteIndex)
       byteIndex = (uint8_t)LUNAR_ERRORMGR_NUM_BYTES_TO_BIT_PACK_ERRORS - 1;
    }
 
-   // This variable specifies which flag index will be packed into bit 0 of the
-   // bit-packed error byte.
-   uint8_t bit0FlagIndex = byteIndex * 8U;
-   // This variable specifies which flag index will be packed into bit 7 of the
-   // bit-packed error byte.
-   uint8_t bit7FlagIndex = bit0FlagIndex + 7U;
+   // Each word holds four bytes of flags, byte 0 in the least significant bits
+   // Bits above the last error are never set
+   uint32_t errorWord = status.errorWords[byteIndex / ERROR_WORD_SIZE];
+   uint8_t errorFlags = (uint8_t)(errorWord >> ((byteIndex % ERROR_WORD_SIZE) * 8U));
 
-   // Make sure the High bit flag index does not go past the last error flag
-   // Not needed if we are using 8 errors or less
-#if LUNAR_ERRORMGR_ERROR_Count > 8U
-   if (bit7FlagIndex > (uint8_t)LUNAR_ERRORMGR_ERROR_Count)
-   {
-      bit7FlagIndex = (uint8_t)LUNAR_ERRORMGR_ERROR_Count - 1U;
-   }
+   // return the error flags
+   return(errorFlags);
+}
 
-#endif
+// Copy all error flags
+void Lunar_ErrorMgr_GetErrorWords(uint32_t *const errorWords)
+{
+   memcpy(errorWords, status.errorWords, sizeof(status.errorWords));
+}
+
+// Clear the history of all errors
+void Lunar_ErrorMgr_ClearErrorHistory(void)
+{
+   memset(status.history, 0, sizeof(status.history));
+   memset(status.transitions, 0, sizeof(status.transitions));
+   status.nextTransitionIndex = 0U;
+   status.numTransitions = 0U;
+}
 
-   // Init Error Flag Byte to 0
-   uint8_t errorFlags = 0U;
+// Restore the saved persistent errors
+void Lunar_ErrorMgr_RestorePersistentErrors(const uint32_t *const errorWords)
+{
+   bool isRestored = false;
 
-   // Pack the flags as bits.  To do this, start at the high flag and loop through
-   // to the low flag, shifting in a 1 each time a flag is set.
-   for (uint8_t i = bit0FlagIndex; i <= bit7FlagIndex; i++)
+   for (uint32_t error = 0U; error < (uint32_t)LUNAR_ERRORMGR_ERROR_Count; error++)
    {
-      // If the current flag is set, OR in a 1 at the current bit location
-      if (Lunar_ErrorMgr_GetErrorState((Lunar_ErrorMgr_Error_t)i))
+      uint32_t word = error / 32U;
+      uint32_t bit = 1UL << (error % 32U);
+
+      // The error was qualified and logged before it was saved, so only its
+      // bit is set, without a new transition, occurrence or log record
+      if ((errorWords[word] & LUNAR_ERRORMGR_PERSISTENT_ERROR_MASK(word) & ~status.errorWords[word] & bit) != 0U)
       {
-         errorFlags |= (uint8_t)(1U << (i - bit0FlagIndex));
+         status.errorWords[word] |= bit;
+         isRestored = true;
+
+         // Critical errors still trigger their event, so the system starts safe
+         if (IsCriticalError((Lunar_ErrorMgr_Error_t)error))
+         {
+            RaiseCriticalErrorEvent((Lunar_ErrorMgr_Error_t)error);
+         }
       }
    }
 
-   // return the error flags
-   return(errorFlags);
+   // Let other modules publish the restored errors
+   if (isRestored)
+   {
+      Lunar_EventMgr_HandleEvent(LUNAR_EVENTMGR_CONFIG_EVENT_Error_Changed);
+   }
 }
 
 
@@ -321,8 +569,9 @@ void Lunar_ErrorMgr_MessageRouter_SetErrorState(Lunar_MessageRouter_Message_t *c
    {
       // Index of the error to set.
       Lunar_ErrorMgr_Error_t errorIndex;
-      // State to set for the specified error.
-      bool bState;
+      // State to set for the specified error (0 = clear, otherwise set).
+      // Received as a byte since any value may be sent.
+      uint8_t bState;
    } Command_t;
 
    //-----------------------------------------------
@@ -339,7 +588,7 @@ void Lunar_ErrorMgr_MessageRouter_SetErrorState(Lunar_MessageRouter_Message_t *c
       //-----------------------------------------------
       // Execute Command
       //-----------------------------------------------
-      Lunar_ErrorMgr_SetErrorState(command->errorIndex, command->bState);
+      Lunar_ErrorMgr_SetErrorState(command->errorIndex, (command->bState != 0U));
 
 
       // Set the response length
@@ -440,9 +689,115 @@ void Lunar_ErrorMgr_MessageRouter_GetAllErrors(Lunar_MessageRouter_Message_t *co
       //-----------------------------------------------
 
       // Populate error bits
-      for (uint8_t i = 0U; i < (uint8_t)LUNAR_ERRORMGR_NUM_BYTES_TO_BIT_PACK_ERRORS; i++)
+      // The words are stored little-endian, so the bytes are already in bit-packed order
+      memcpy(response->errorByte, status.errorWords, sizeof(response->errorByte));
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+// Get the occurrence history of an error
+void Lunar_ErrorMgr_MessageRouter_GetErrorHistory(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+   // This structure defines the format of the command data.
+   typedef struct
+   {
+      // Index of the error to get
+      Lunar_ErrorMgr_Error_t errorIndex;
+   } Command_t;
+
+   // This structure defines the format of the response.
+   typedef struct
+   {
+      // Tick count when the error was first set
+      uint32_t firstSeenTime;
+      // Tick count when the error was last set
+      uint32_t lastSeenTime;
+      // Number of times the error has been set
+      uint16_t numOccurrences;
+      // Error index whose history was retrieved.
+      Lunar_ErrorMgr_Error_t errorIndex;
+      // Current state of the error
+      bool errorState;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), sizeof(Response_t)))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      // The response overwrites the command, so read it first
+      Lunar_ErrorMgr_Error_t errorIndex = command->errorIndex;
+
+      if (errorIndex < LUNAR_ERRORMGR_ERROR_Count)
+      {
+         const ErrorHistory_t *history = &status.history[errorIndex];
+
+         response->firstSeenTime = history->firstSeenTime;
+         response->lastSeenTime = history->lastSeenTime;
+         response->numOccurrences = history->numOccurrences;
+         response->errorIndex = errorIndex;
+         response->errorState = Lunar_ErrorMgr_GetErrorState(errorIndex);
+
+         // Set the response length
+         Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+      }
+      else
+      {
+         message->responseCode = LUNAR_MESSAGEROUTER_RESPONSE_CODE_InvalidParameter;
+         Lunar_MessageRouter_SetResponseSize(message, 0);
+      }
+   }
+}
+
+// Get the occurrence count of every error
+void Lunar_ErrorMgr_MessageRouter_GetAllErrorCounts(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+   // This structure defines the format of the response.
+   typedef struct
+   {
+      // Number of times each error has been set, indexed by error
+      uint16_t numOccurrences[LUNAR_ERRORMGR_ERROR_Count];
+   } Response_t;
+
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   {
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      for (uint32_t i = 0U; i < (uint32_t)LUNAR_ERRORMGR_ERROR_Count; i++)
       {
-         response->errorByte[i] = Lunar_ErrorMgr_GetBitPackedErrors(i);
+         response->numOccurrences[i] = status.history[i].numOccurrences;
       }
 
       // Set the response length
@@ -450,3 +805,104 @@ void Lunar_ErrorMgr_MessageRouter_GetAllErrors(Lunar_MessageRouter_Message_t *co
    }
 }
 
+// Get a page of the recent transitions
+void Lunar_ErrorMgr_MessageRouter_GetRecentTransitions(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+   // This structure defines the format of the command data.
+   typedef struct
+   {
+      // Number of transitions to skip, 0 starts with the newest transition
+      uint8_t startIndex;
+   } Command_t;
+
+   // This structure defines the format of the response.
+   // The fields are split into arrays to avoid padding in each entry.
+   typedef struct
+   {
+      // Total number of transitions since the history was cleared
+      uint32_t numTransitions;
+      // Number of valid entries in this response
+      uint8_t numEntries;
+      // New state of each entry, bit 0 is entry 0
+      uint8_t errorStates;
+      // Error of each entry, newest first
+      uint8_t errors[TRANSITIONS_PER_READ];
+      // Tick count of each entry
+      uint32_t timestamps[TRANSITIONS_PER_READ];
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), sizeof(Response_t)))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      // The response overwrites the command, so read it first
+      uint32_t startIndex = command->startIndex;
+      memset(response, 0, sizeof(Response_t));
+
+      // Only the entries still held in the ring can be returned
+      uint32_t numAvailable = PLATFORM_MIN(status.numTransitions, (uint32_t)LUNAR_ERRORMGR_NUM_HISTORY_TRANSITIONS);
+
+      for (uint32_t i = 0U; (i < TRANSITIONS_PER_READ) && ((startIndex + i) < numAvailable); i++)
+      {
+         // Walk backwards from the newest entry
+         uint32_t age = startIndex + i + 1U;
+         uint32_t ringIndex = (status.nextTransitionIndex + LUNAR_ERRORMGR_NUM_HISTORY_TRANSITIONS - age) % LUNAR_ERRORMGR_NUM_HISTORY_TRANSITIONS;
+         const Transition_t *transition = &status.transitions[ringIndex];
+
+         response->errors[i] = transition->error;
+         response->timestamps[i] = transition->timestamp;
+         if (transition->errorState)
+         {
+            response->errorStates |= (uint8_t)(1U << i);
+         }
+         response->numEntries++;
+      }
+      response->numTransitions = status.numTransitions;
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+// Clear the history of all errors
+void Lunar_ErrorMgr_MessageRouter_ClearErrorHistory(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+   // No command or response params for this message.
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, 0))
+   {
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      Lunar_ErrorMgr_ClearErrorHistory();
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, 0);
+   }
+}
@@ -18,6 +18,44 @@ extern "C"
 #include "Platform.h"
 // Other Includes
 #include <stdbool.h>
+#include <stdint.h>
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// The number of 32-bit words used to store all error flags
+#define LUNAR_ERRORMGR_NUM_ERROR_WORDS (((uint32_t)LUNAR_ERRORMGR_ERROR_Count + 31U) / 32U)
+
+/** This macro returns the bit for the given error if it is stored in the given
+  * error word, or 0 if it is stored in another word.  It is used to build the
+  * critical and persistent error masks in the configuration table.
+*/
+#define LUNAR_ERRORMGR_ERROR_BIT(word, error) \
+   ((((uint32_t)(error) / 32U) == (uint32_t)(word)) ? (1UL << ((uint32_t)(error) % 32U)) : 0UL)
+
+
+/*******************************************************************************
+// Public Type Declarations
+*******************************************************************************/
+
+// This structure defines how a change of an error is qualified before it
+// takes effect.  The new state must be requested, without a request for the
+// current state in between, for the given time.  The time is measured with
+// the timebase, so it does not depend on how often the state is requested.
+// A time of 0 changes the state on the first request.
+typedef struct
+{
+   // Time in milliseconds the error must be requested before it is set
+   uint16_t setTimeMs;
+
+   // Time in milliseconds the clear must be requested before the error is cleared
+   uint16_t clearTimeMs;
+
+   // Minimum time between critical error events raised by the error
+   uint16_t minRetriggerMs;
+} Lunar_ErrorMgr_QualificationConfigItem_t;
 
 
 /*******************************************************************************
@@ -35,13 +73,19 @@ void Lunar_ErrorMgr_Init(void);
 
 
 /** Description:
-  *    This function sets the specified error state to the given value.
+  *    This function sets the specified error state to the given value.  The
+  *    state only changes once it was requested for the time given in the
+  *    qualification configuration table.  Every change raises the
+  *    LUNAR_EVENTMGR_CONFIG_EVENT_Error_Changed event.
   * Parameters: 
   *     error - The enumerated error to be set
   *     errorState - The state to be set for the given error. true: error set,
   *     false: error cleared
   * History: 
   *    * 6/6/2021: Function created (EJH)
+  *    * 10/19/2026: Qualify the change and rate limit critical error events (EJH)
+  *    * 10/19/2026: Raise an event for every change (EJH)
+  *    * 10/19/2026: Qualify on the elapsed time instead of the number of requests (EJH)
   *                                                              
 */
 void Lunar_ErrorMgr_SetErrorState(const Lunar_ErrorMgr_Error_t error, const bool errorState);
@@ -125,6 +169,45 @@ void Lunar_ErrorMgr_ClearAllErrors(void);
 uint8_t Lunar_ErrorMgr_GetBitPackedErrors(uint8_t byteIndex);
 
 
+/** Description:
+  *    This function copies all error flags, one bit per error.  Error 0 is
+  *    stored in bit 0 of word 0, error 32 in bit 0 of word 1, etc.
+  * Parameters:
+  *    errorWords :  Buffer for LUNAR_ERRORMGR_NUM_ERROR_WORDS words
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_ErrorMgr_GetErrorWords(uint32_t *const errorWords) PLATFORM_NON_NULL;
+
+
+/** Description:
+  *    This function sets the errors that are included in the persistent error
+  *    mask and are set in the given error flags.  It is used to restore the
+  *    errors saved before the last reset.  The errors were logged when they
+  *    were set, so the restore adds no transition, occurrence or log record.
+  *    A restored critical error still raises the critical error event.
+  * Parameters:
+  *    errorWords :  LUNAR_ERRORMGR_NUM_ERROR_WORDS words of saved error flags
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *    * 10/19/2026: Restore without recording a transition (EJH)
+  *
+*/
+void Lunar_ErrorMgr_RestorePersistentErrors(const uint32_t *const errorWords) PLATFORM_NON_NULL;
+
+
+/** Description:
+  *    This function clears the occurrence counts, first and last seen times
+  *    and the recent transitions of all errors.  The current error states are
+  *    not changed.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_ErrorMgr_ClearErrorHistory(void);
+
+
 /*******************************************************************************
 // Message Router Function Declarations
 *******************************************************************************/
@@ -195,6 +278,60 @@ void Lunar_ErrorMgr_MessageRouter_ClearAllErrors(Lunar_MessageRouter_Message_t *
 void Lunar_ErrorMgr_MessageRouter_GetAllErrors(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
 
 
+/** Description:
+  *    Command to retrieve the occurrence count, first and last seen
+  *    times and current state of a given error.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_ErrorMgr_MessageRouter_GetErrorHistory(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+
+/** Description:
+  *    Command to retrieve the occurrence count of every error.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_ErrorMgr_MessageRouter_GetAllErrorCounts(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+
+/** Description:
+  *    Command to retrieve a page of the recent error transitions, newest
+  *    first.  The command gives the number of transitions to skip.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_ErrorMgr_MessageRouter_GetRecentTransitions(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+
+/** Description:
+  *    Command to clear the history of all errors.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_ErrorMgr_MessageRouter_ClearErrorHistory(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+
 #ifdef __cplusplus
 extern "C"
 }
@@ -26,11 +26,21 @@
 // Private Type Declarations
 *******************************************************************************/
 
+// This structure holds the private information for this module
+typedef struct
+{
+   // Number of times each event was triggered
+   uint32_t eventCounts[LUNAR_EVENTMGR_CONFIG_EVENT_Count];
+} Lunar_EventMgr_Status_t;
+
 
 /*******************************************************************************
 // Private Variable Definitions
 *******************************************************************************/
 
+// The variable used for holding all internal data for this module.
+static Lunar_EventMgr_Status_t status;
+
 
 /*******************************************************************************
 // Private Function Declarations
@@ -49,7 +59,11 @@
 // Initialize the module
 void Lunar_EventMgr_Init(void)
 {
-   // Nothing to do
+   // Clear the event counts
+   for (uint32_t i = 0U; i < (uint32_t)LUNAR_EVENTMGR_CONFIG_EVENT_Count; i++)
+   {
+      status.eventCounts[i] = 0U;
+   }
 }
 
 // Trigger each event handler for the given event
@@ -58,7 +72,9 @@ void Lunar_EventMgr_HandleEvent(const Lunar_EventMgr_Config_Event_t eventToTrigg
    // Validate the event is valid
    if (eventToTrigger < LUNAR_EVENTMGR_CONFIG_EVENT_Count)
    {
-      // Event is valid
+      // Event is valid, count it
+      status.eventCounts[eventToTrigger]++;
+
       // Loop through every entry in the table and check for a match
       // For every match, call the callback
       for (uint8_t i = 0U; i < NUM_EVENT_HANDLERS; i++)
@@ -76,6 +92,17 @@ void Lunar_EventMgr_HandleEvent(const Lunar_EventMgr_Config_Event_t eventToTrigg
          }
       }
    }
-
 }
 
+// Return how often an event was triggered
+uint32_t Lunar_EventMgr_GetEventCount(const Lunar_EventMgr_Config_Event_t event)
+{
+   uint32_t count = 0U;
+
+   if (event < LUNAR_EVENTMGR_CONFIG_EVENT_Count)
+   {
+      count = status.eventCounts[event];
+   }
+
+   return(count);
+}
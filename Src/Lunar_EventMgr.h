@@ -21,6 +21,7 @@ extern "C"
 // Platform Includes
 // Other Includes
 #include <stddef.h>
+#include <stdint.h>
 
 
 /*******************************************************************************
@@ -71,6 +72,22 @@ void Lunar_EventMgr_Init(void);
 void Lunar_EventMgr_HandleEvent(const Lunar_EventMgr_Config_Event_t eventToTrigger);
 
 
+/** Description:
+  *    This function returns how often an event was triggered since the
+  *    module was initialized.  It lets a test or a diagnostic see how often
+  *    a rate limited event really fired.
+  * Parameters:
+  *    event :  The enumerated event
+  * Returns:
+  *    uint32_t - The number of times the event was triggered, 0 for an
+  *               invalid event
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+uint32_t Lunar_EventMgr_GetEventCount(const Lunar_EventMgr_Config_Event_t event);
+
+
 #ifdef __cplusplus
 extern "C"
 }
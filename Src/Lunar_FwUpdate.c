@@ -0,0 +1,768 @@
+/*******************************************************************************
+// Core Firmware Update Module
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "Lunar_FwUpdate.h"
+#include "Lunar_FwUpdate_Config.h"
+// Platform Includes
+#include "CAN_Drv.h"
+#include "Flash_Drv.h"
+#include "Lunar_MathLib.h"
+#include "Lunar_MessageRouter.h"
+#include "Platform.h"
+#include "Reset_Drv.h"
+#include "Timebase_Drv.h"
+// Other Includes
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// A block of the image is one flash page
+#define BLOCK_SIZE (FLASH_DRV_PAGE_SIZE)
+
+// The number of image bytes in a data frame and of data frames in a block
+#define FRAME_DATA_SIZE (8U)
+#define FRAMES_PER_BLOCK (BLOCK_SIZE / FRAME_DATA_SIZE)
+
+// The received frames of a block are kept as one bit each
+#if FRAMES_PER_BLOCK != 32
+#error "A block must have one data frame per bit of the received frame bitmap"
+#endif
+#define ALL_FRAMES (0xFFFFFFFFUL)
+
+// The sender address of a data frame holds the frame number in the block and
+// the low bits of the block number, so late frames of a block are not taken
+// for the next one
+#define FRAME_NUMBER_MASK (0x1FU)
+#define BLOCK_TAG_SHIFT (5U)
+#define BLOCK_TAG_MASK (0x07U)
+
+// The flash stalls the CPU, so it is only used once the data frames have
+// stopped for this time
+#define FLASH_QUIET_TIME_MS (3U)
+
+// The flags of a report
+#define REPORT_FLAG_BUSY (0x01U)
+#define REPORT_FLAG_CRC_ERROR (0x02U)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// This enumeration defines the reasons an update failed
+typedef enum
+{
+   FAILURE_None,
+   // The image does not fit the staging area
+   FAILURE_ImageSize,
+   // An erase or program operation failed or the read back did not match
+   FAILURE_Flash,
+   // The CRC of the staged image does not match
+   FAILURE_ImageCrc,
+} Lunar_FwUpdate_Failure_t;
+
+// This enumeration defines the flash operation started by this module
+typedef enum
+{
+   FLASH_OPERATION_None,
+   FLASH_OPERATION_Erase,
+   FLASH_OPERATION_Program,
+} Lunar_FwUpdate_FlashOperation_t;
+
+// This structure holds the private information for this module
+typedef struct
+{
+   // The block being received
+   uint32_t receiveWords[FLASH_DRV_WORDS_PER_PAGE];
+
+   // The last committed block, until it is programmed
+   uint32_t programWords[FLASH_DRV_WORDS_PER_PAGE];
+
+   // The size and the CRC-32 of the image
+   uint32_t imageSize;
+   uint32_t imageCrc;
+
+   // One bit for each frame of the block being received
+   uint32_t receivedFrames;
+
+   // The staging area is erased up to this address
+   uint32_t erasedEnd;
+
+   // The address of the flash operation in progress
+   uint32_t flashAddress;
+
+   // The number of bytes of the staged image checked so far and their CRC
+   uint32_t verifyOffset;
+   uint32_t verifyCrc;
+
+   // The tick count of the last data frame
+   uint32_t lastDataTime;
+
+   // The missing frames sent by the pending report
+   uint32_t reportMissingFrames;
+
+   // The number of data frames received and received again
+   uint32_t numDataFrames;
+   uint32_t numRepeatedFrames;
+
+   // The number of blocks of the image, the block being received and the
+   // block waiting to be programmed
+   uint16_t numBlocks;
+   uint16_t nextBlock;
+   uint16_t programBlock;
+
+   // The number of committed blocks with a wrong CRC
+   uint16_t numBlockCrcErrors;
+
+   // The number of reports sent
+   uint16_t numReports;
+
+   // The low 16 bits of the report identifier of this node
+   uint16_t reportTag;
+
+   // The flags sent by the pending report
+   uint8_t reportFlags;
+
+   // true while a report could not be queued
+   bool isReportPending;
+
+   // true while the program buffer holds a block
+   bool isProgramPending;
+
+   Lunar_FwUpdate_State_t state;
+   Lunar_FwUpdate_Failure_t failure;
+   Lunar_FwUpdate_FlashOperation_t flashOperation;
+} Lunar_FwUpdate_Status_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The variable used for holding all internal data for this module.
+static Lunar_FwUpdate_Status_t status;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function returns the staging address of a block.
+  * Parameters:
+  *    block :  The block number
+  * Returns:
+  *    uint32_t - The address of the first byte of the block
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint32_t GetBlockAddress(const uint32_t block);
+
+/** Description:
+  *    This function sends the pending report.  The report holds the state,
+  *    the flags, the block being received and the frames missing from it.
+  *    A report that cannot be queued is tried again by the next update.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void SendReport(void);
+
+/** Description:
+  *    This function sends a report with the frames missing from the block
+  *    being received.
+  * Parameters:
+  *    flags :  The report flags
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void Report(const uint8_t flags);
+
+/** Description:
+  *    This function stops the update and reports the failure.
+  * Parameters:
+  *    failure :  The reason of the failure
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void Fail(const Lunar_FwUpdate_Failure_t failure);
+
+/** Description:
+  *    This function compares a programmed page with the program buffer.
+  * Parameters:
+  *    address :  The address of the page
+  * Returns:
+  *    bool - true if the flash holds the program buffer
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool IsPageProgrammed(const uint32_t address);
+
+/** Description:
+  *    This function starts the next flash operation of the update.  A
+  *    committed block is programmed once its sector is erased, otherwise the
+  *    sector after the one being received is erased.  The verification
+  *    starts once every block is programmed.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void StartFlashOperation(void);
+
+/** Description:
+  *    This function takes the result of the finished flash operation.  The
+  *    result is dropped if the update was stopped or started again meanwhile.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void FinishFlashOperation(void);
+
+/** Description:
+  *    This function adds the next block of the staged image to the image CRC
+  *    and reports the result after the last block.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void VerifyNextBlock(void);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Get the staging address of a block
+static uint32_t GetBlockAddress(const uint32_t block)
+{
+   return(LUNAR_FWUPDATE_STAGING_ADDRESS + (block * BLOCK_SIZE));
+}
+
+
+// Send the pending report
+static void SendReport(void)
+{
+   uint8_t frameData[8];
+
+   frameData[0] = (uint8_t)status.state;
+   frameData[1] = status.reportFlags;
+   frameData[2] = (uint8_t)status.nextBlock;
+   frameData[3] = (uint8_t)(status.nextBlock >> 8U);
+   frameData[4] = (uint8_t)status.reportMissingFrames;
+   frameData[5] = (uint8_t)(status.reportMissingFrames >> 8U);
+   frameData[6] = (uint8_t)(status.reportMissingFrames >> 16U);
+   frameData[7] = (uint8_t)(status.reportMissingFrames >> 24U);
+
+   if (CAN_Drv_StartTransmitFrame(CAN_DRV_CHANNEL_PRIMARY, (LUNAR_FWUPDATE_REPORT_CANID | status.reportTag) | CAN_DRV_EXTENDED_ID, frameData, (uint8_t)sizeof(frameData)))
+   {
+      status.isReportPending = false;
+      status.numReports++;
+   }
+   else
+   {
+      status.isReportPending = true;
+   }
+}
+
+
+// Report the missing frames
+static void Report(const uint8_t flags)
+{
+   status.reportFlags = flags;
+   status.reportMissingFrames = (status.state == LUNAR_FWUPDATE_STATE_Receiving) ? ~status.receivedFrames : 0U;
+   SendReport();
+}
+
+
+// Stop the update
+static void Fail(const Lunar_FwUpdate_Failure_t failure)
+{
+   status.state = LUNAR_FWUPDATE_STATE_Failed;
+   status.failure = failure;
+   status.isProgramPending = false;
+   Report(0U);
+}
+
+
+// Compare a programmed page with the program buffer
+static bool IsPageProgrammed(const uint32_t address)
+{
+   uint32_t words[8];
+   bool isEqual = true;
+
+   for (uint32_t offset = 0U; (offset < BLOCK_SIZE) && (isEqual); offset += sizeof(words))
+   {
+      Flash_Drv_Read(address + offset, words, sizeof(words));
+      isEqual = (memcmp(words, &((const uint8_t *)status.programWords)[offset], sizeof(words)) == 0);
+   }
+
+   return(isEqual);
+}
+
+
+// Start the next flash operation
+static void StartFlashOperation(void)
+{
+   // Only the blocks of the image are erased, one sector ahead of the block being received
+   uint32_t eraseLimit = PLATFORM_MIN(GetBlockAddress(status.numBlocks), GetBlockAddress(status.nextBlock) + LUNAR_FWUPDATE_SECTOR_SIZE);
+
+   if ((status.isProgramPending) && (GetBlockAddress(status.programBlock) < status.erasedEnd))
+   {
+      if (Flash_Drv_StartProgramPage(GetBlockAddress(status.programBlock), status.programWords))
+      {
+         status.flashAddress = GetBlockAddress(status.programBlock);
+         status.flashOperation = FLASH_OPERATION_Program;
+      }
+   }
+   else if (status.erasedEnd < eraseLimit)
+   {
+      if (Flash_Drv_StartEraseSector(status.erasedEnd))
+      {
+         status.flashAddress = status.erasedEnd;
+         status.flashOperation = FLASH_OPERATION_Erase;
+      }
+   }
+   else if ((!status.isProgramPending) && (status.nextBlock == status.numBlocks))
+   {
+      status.verifyOffset = 0U;
+      status.verifyCrc = LUNAR_MATHLIB_CRC32_INITIAL_VALUE;
+      status.state = LUNAR_FWUPDATE_STATE_Verifying;
+   }
+   else
+   {
+      // Waiting for the next block
+   }
+}
+
+
+// Take the result of the finished flash operation
+static void FinishFlashOperation(void)
+{
+   bool operationFailed = Flash_Drv_DidOperationFail();
+
+   if (status.state != LUNAR_FWUPDATE_STATE_Receiving)
+   {
+      // The update was stopped
+   }
+   else if (status.flashOperation == FLASH_OPERATION_Erase)
+   {
+      if (operationFailed)
+      {
+         Fail(FAILURE_Flash);
+      }
+      else if (status.flashAddress == status.erasedEnd)
+      {
+         status.erasedEnd += LUNAR_FWUPDATE_SECTOR_SIZE;
+      }
+      else
+      {
+         // The erase belongs to an update that was started again
+      }
+   }
+   else if ((status.isProgramPending) && (status.flashAddress == GetBlockAddress(status.programBlock)))
+   {
+      // The page is read back, as the XMC4 only checks the programming itself
+      if ((operationFailed) || (!IsPageProgrammed(status.flashAddress)))
+      {
+         Fail(FAILURE_Flash);
+      }
+      else
+      {
+         status.isProgramPending = false;
+      }
+   }
+   else
+   {
+      // The program operation belongs to an update that was started again
+   }
+
+   status.flashOperation = FLASH_OPERATION_None;
+}
+
+
+// Check the next block of the staged image
+static void VerifyNextBlock(void)
+{
+   uint32_t length = PLATFORM_MIN(BLOCK_SIZE, status.imageSize - status.verifyOffset);
+
+   // The receive buffer is free once every block is committed
+   Flash_Drv_Read(LUNAR_FWUPDATE_STAGING_ADDRESS + status.verifyOffset, status.receiveWords, length);
+   status.verifyCrc = Lunar_MathLib_Crc32((const uint8_t *)status.receiveWords, length, status.verifyCrc);
+   status.verifyOffset += length;
+
+   if (status.verifyOffset >= status.imageSize)
+   {
+      if (status.verifyCrc == status.imageCrc)
+      {
+         status.state = LUNAR_FWUPDATE_STATE_Verified;
+         Report(0U);
+      }
+      else
+      {
+         Fail(FAILURE_ImageCrc);
+      }
+   }
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Module initialization
+void Lunar_FwUpdate_Init(void)
+{
+   uint8_t uniqueId[RESET_DRV_UNIQUE_ID_LENGTH];
+
+   // The reports of the nodes are told apart by a tag of the unique chip ID
+   Reset_Drv_GetUniqueId(uniqueId);
+   status.reportTag = Lunar_MathLib_Crc16(uniqueId, sizeof(uniqueId), LUNAR_MATHLIB_CRC16_INITIAL_VALUE);
+
+   status.state = LUNAR_FWUPDATE_STATE_Idle;
+   status.failure = FAILURE_None;
+   status.flashOperation = FLASH_OPERATION_None;
+   status.lastDataTime = Timebase_Drv_GetCurrentTickCount();
+}
+
+
+// Advance the flash operations and the verification
+void Lunar_FwUpdate_Update(void)
+{
+   bool isQuiet = ((Timebase_Drv_GetCurrentTickCount() - status.lastDataTime) >= (FLASH_QUIET_TIME_MS * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND));
+
+   if (status.isReportPending)
+   {
+      SendReport();
+   }
+
+   if (status.flashOperation != FLASH_OPERATION_None)
+   {
+      // The flash driver is shared with the error log, only this operation is advanced
+      if (isQuiet)
+      {
+         Flash_Drv_Update();
+      }
+
+      if (!Flash_Drv_IsBusy())
+      {
+         FinishFlashOperation();
+      }
+   }
+   else if (Flash_Drv_IsBusy())
+   {
+      // Waiting for the operation of the error log
+   }
+   else if (status.state == LUNAR_FWUPDATE_STATE_Receiving)
+   {
+      if (isQuiet)
+      {
+         StartFlashOperation();
+      }
+   }
+   else if (status.state == LUNAR_FWUPDATE_STATE_Verifying)
+   {
+      VerifyNextBlock();
+   }
+   else
+   {
+      // No update in progress
+   }
+}
+
+
+/*******************************************************************************
+// Message Router Function Implementations
+*******************************************************************************/
+
+// Message handler to get the state of the update
+void Lunar_FwUpdate_MessageRouter_GetStatus(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // Response
+   typedef struct
+   {
+      uint32_t imageSize;
+      uint32_t imageCrc;
+      uint32_t numDataFrames;
+      uint32_t numRepeatedFrames;
+      uint16_t numBlocks;
+      uint16_t nextBlock;
+      uint16_t numBlockCrcErrors;
+      uint16_t numReports;
+      uint16_t reportTag;
+      uint8_t state;
+      uint8_t failure;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   {
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      response->imageSize = status.imageSize;
+      response->imageCrc = status.imageCrc;
+      response->numDataFrames = status.numDataFrames;
+      response->numRepeatedFrames = status.numRepeatedFrames;
+      response->numBlocks = status.numBlocks;
+      response->nextBlock = status.nextBlock;
+      response->numBlockCrcErrors = status.numBlockCrcErrors;
+      response->numReports = status.numReports;
+      response->reportTag = status.reportTag;
+      response->state = (uint8_t)status.state;
+      response->failure = (uint8_t)status.failure;
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+// Message handler for the start of an image broadcast
+void Lunar_FwUpdate_MessageRouter_Start(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // Command
+   typedef struct
+   {
+      uint32_t imageSize;
+      uint32_t imageCrc;
+   } Command_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), 0))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      if ((status.state != LUNAR_FWUPDATE_STATE_Idle) && (status.state != LUNAR_FWUPDATE_STATE_Failed) &&
+          (command->imageSize == status.imageSize) && (command->imageCrc == status.imageCrc))
+      {
+         // The start was repeated for the nodes that missed it
+      }
+      else
+      {
+         status.imageSize = command->imageSize;
+         status.imageCrc = command->imageCrc;
+         status.numBlocks = (uint16_t)((command->imageSize + (BLOCK_SIZE - 1U)) / BLOCK_SIZE);
+         status.nextBlock = 0U;
+         status.receivedFrames = 0U;
+         status.erasedEnd = LUNAR_FWUPDATE_STAGING_ADDRESS;
+         status.isProgramPending = false;
+         status.numDataFrames = 0U;
+         status.numRepeatedFrames = 0U;
+         status.numBlockCrcErrors = 0U;
+         status.failure = FAILURE_None;
+         status.state = LUNAR_FWUPDATE_STATE_Receiving;
+
+         if ((command->imageSize == 0U) || (command->imageSize > LUNAR_FWUPDATE_STAGING_SIZE))
+         {
+            Fail(FAILURE_ImageSize);
+         }
+      }
+   }
+}
+
+// Message handler for the end of a block
+void Lunar_FwUpdate_MessageRouter_Commit(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // Command
+   typedef struct
+   {
+      uint16_t block;
+      uint16_t blockCrc;
+   } Command_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), 0))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      if ((status.state != LUNAR_FWUPDATE_STATE_Receiving) || (command->block < status.nextBlock))
+      {
+         // The block is not needed, the silence is taken as an acknowledge
+      }
+      else if (command->block > status.nextBlock)
+      {
+         // A block was missed, the sender goes back to the block in the report
+         Report(0U);
+      }
+      else if (status.receivedFrames != ALL_FRAMES)
+      {
+         Report(0U);
+      }
+      else if (Lunar_MathLib_Crc16((const uint8_t *)status.receiveWords, BLOCK_SIZE, LUNAR_MATHLIB_CRC16_INITIAL_VALUE) != command->blockCrc)
+      {
+         // The frames cannot be told apart, so the whole block is received again
+         status.numBlockCrcErrors++;
+         status.receivedFrames = 0U;
+         Report(REPORT_FLAG_CRC_ERROR);
+      }
+      else if (status.isProgramPending)
+      {
+         // The block is kept, the sender commits it again after a pause
+         Report(REPORT_FLAG_BUSY);
+      }
+      else
+      {
+         memcpy(status.programWords, status.receiveWords, BLOCK_SIZE);
+         status.programBlock = status.nextBlock;
+         status.isProgramPending = true;
+         status.nextBlock++;
+         status.receivedFrames = 0U;
+      }
+   }
+}
+
+// Message handler for the end of the image broadcast
+void Lunar_FwUpdate_MessageRouter_Finish(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, 0))
+   {
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      if (status.state == LUNAR_FWUPDATE_STATE_Verifying)
+      {
+         // The report is sent when the verification is done
+      }
+      else if ((status.state == LUNAR_FWUPDATE_STATE_Receiving) && (status.nextBlock == status.numBlocks))
+      {
+         // The last blocks are still being programmed, the verification follows
+      }
+      else
+      {
+         Report(0U);
+      }
+   }
+}
+
+// Message handler to stop the update
+void Lunar_FwUpdate_MessageRouter_Abort(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, 0))
+   {
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      // A flash operation in progress is finished by the update, its result is dropped
+      status.state = LUNAR_FWUPDATE_STATE_Idle;
+      status.isProgramPending = false;
+   }
+}
+
+// Message handler for the image data frames
+void Lunar_FwUpdate_MessageRouter_Data(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // Command
+   typedef struct
+   {
+      uint8_t data[FRAME_DATA_SIZE];
+   } Command_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), 0))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+      // The data route passes the low identifier bits as the source address
+      uint32_t frameNumber = message->source.address & FRAME_NUMBER_MASK;
+      uint32_t blockTag = ((uint32_t)message->source.address >> BLOCK_TAG_SHIFT) & BLOCK_TAG_MASK;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      // The flash waits while the data frames arrive
+      status.lastDataTime = Timebase_Drv_GetCurrentTickCount();
+      status.numDataFrames++;
+
+      if ((status.state == LUNAR_FWUPDATE_STATE_Receiving) && (status.nextBlock < status.numBlocks) &&
+          (blockTag == (status.nextBlock & BLOCK_TAG_MASK)))
+      {
+         if ((status.receivedFrames & (1UL << frameNumber)) != 0U)
+         {
+            status.numRepeatedFrames++;
+         }
+         else
+         {
+            memcpy(&((uint8_t *)status.receiveWords)[frameNumber * FRAME_DATA_SIZE], command->data, FRAME_DATA_SIZE);
+            status.receivedFrames |= (1UL << frameNumber);
+         }
+      }
+   }
+}
@@ -0,0 +1,163 @@
+/*******************************************************************************
+// Core Firmware Update Module
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Lunar_FwUpdate_Config.h"
+// Platform Includes
+#include "Lunar_MessageRouter.h"
+#include "Platform.h"
+// Other Includes
+#include <stdbool.h>
+#include <stdint.h>
+
+
+/*******************************************************************************
+// Public Type Declarations
+*******************************************************************************/
+
+// This enumeration defines the states of an update, as sent in the reports
+typedef enum
+{
+   // No update in progress
+   LUNAR_FWUPDATE_STATE_Idle,
+   // The image blocks are being received and programmed
+   LUNAR_FWUPDATE_STATE_Receiving,
+   // The CRC of the staged image is being calculated
+   LUNAR_FWUPDATE_STATE_Verifying,
+   // The staged image matches the image CRC
+   LUNAR_FWUPDATE_STATE_Verified,
+   // The update stopped, the failure is given by the status
+   LUNAR_FWUPDATE_STATE_Failed,
+} Lunar_FwUpdate_State_t;
+
+
+/*******************************************************************************
+// Public Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function initializes the module.  No update is in progress.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_FwUpdate_Init(void);
+
+/** Description:
+  *    This is the scheduled update function.  The staging area is erased one
+  *    sector ahead of the block being received and the received blocks are
+  *    programmed and read back.  The flash is only used while no data frames
+  *    arrive, so the erase and program stalls fall into the pauses the sender
+  *    makes after each block.  Once the last block is programmed the CRC of
+  *    the staged image is checked.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_FwUpdate_Update(void);
+
+
+/*******************************************************************************
+// Message Router Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    Message handler that returns the state and the counters of the update.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_FwUpdate_MessageRouter_GetStatus(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+/** Description:
+  *    Message handler for the start of an image broadcast.  The command holds
+  *    the image size and the CRC-32 of the image.  A repeated start of the
+  *    same image is ignored, so the sender may repeat it for late nodes.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_FwUpdate_MessageRouter_Start(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+/** Description:
+  *    Message handler for the end of a block.  The command holds the block
+  *    number and the CRC-16 of the block.  A node that has the block in full
+  *    stays silent, every other node sends a report with the frames it
+  *    misses.  The sender repeats only those frames and commits again, so
+  *    the time of an update does not grow with the number of nodes.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_FwUpdate_MessageRouter_Commit(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+/** Description:
+  *    Message handler for the end of the image broadcast.  Every node sends
+  *    a report, so the sender finds the nodes that missed the start.  A node
+  *    that is still programming or verifying its image reports once the
+  *    verification is done.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_FwUpdate_MessageRouter_Finish(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+/** Description:
+  *    Message handler that stops the update.  The staged image is left as it
+  *    is and a flash operation in progress is finished.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_FwUpdate_MessageRouter_Abort(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+/** Description:
+  *    Message handler for the image data frames.  Each frame holds 8 bytes
+  *    of the block being received, the sender address holds the low 3 bits
+  *    of the block number and the frame number in the block.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_FwUpdate_MessageRouter_Data(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
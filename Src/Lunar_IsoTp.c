@@ -0,0 +1,710 @@
+/*******************************************************************************
+// Core ISO-TP Module
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Lunar_IsoTp.h"
+#include "Lunar_IsoTp_Config.h"
+// Platform Includes
+#include "Lunar_MessageBufferPool.h"
+#include "Lunar_MessageRouter.h"
+#include "Timebase_Drv.h"
+// Other Includes
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "CAN_Drv.h" // For CAN API
+#include "CAN_Drv_Config.h" // For CAN channel enumeration
+#include "UART_Drv_Config.h" // For the number of serial ports
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The high nibble of the first byte is the frame type (PCI)
+#define PCI_TYPE_MASK (0xF0U)
+// The low nibble of the first byte is the length, sequence number or flow status
+#define PCI_VALUE_MASK (0x0FU)
+
+// Frame types
+#define PCI_TYPE_SINGLE_FRAME (0x00U)
+#define PCI_TYPE_FIRST_FRAME (0x10U)
+#define PCI_TYPE_CONSECUTIVE_FRAME (0x20U)
+#define PCI_TYPE_FLOW_CONTROL (0x30U)
+
+// Flow status of a flow control frame
+#define FLOW_STATUS_CONTINUE_TO_SEND (0x00U)
+#define FLOW_STATUS_WAIT (0x01U)
+#define FLOW_STATUS_OVERFLOW (0x02U)
+
+// The number of data bytes in each frame type
+#define SINGLE_FRAME_MAX_DATA_LENGTH (CAN_DRV_MAX_DATA_LENGTH - 1U)
+#define FIRST_FRAME_DATA_LENGTH (CAN_DRV_MAX_DATA_LENGTH - 2U)
+#define CONSECUTIVE_FRAME_MAX_DATA_LENGTH (CAN_DRV_MAX_DATA_LENGTH - 1U)
+
+// The length of a flow control frame, the frames are not padded
+#define FLOW_CONTROL_LENGTH (3U)
+
+// Sequence numbers count 0-15, the first consecutive frame is 1
+#define SEQUENCE_NUMBER_MASK (0x0FU)
+
+// Separation time values above this are microseconds or reserved
+#define MAX_SEPARATION_TIME_MS (0x7FU)
+// Separation times of 100-900 microseconds
+#define MIN_SEPARATION_TIME_US_VALUE (0xF1U)
+#define MAX_SEPARATION_TIME_US_VALUE (0xF9U)
+
+// Every serial port and every session may hold a pool block at the same time,
+// so at least one more block is needed for single frame CAN requests
+typedef char Lunar_IsoTp_PoolSizeCheck_t[(LUNAR_MESSAGEBUFFERPOOL_NUM_BLOCKS > (LUNAR_ISOTP_NUM_SESSIONS + (uint32_t)UART_DRV_CHANNEL_Count)) ? 1 : -1];
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// The state of a session
+typedef enum
+{
+   // The session is not in use
+   SESSION_STATE_Idle,
+   // Waiting for consecutive frames of a command
+   SESSION_STATE_Receiving,
+   // Waiting to send the single or first frame of the response
+   SESSION_STATE_Responding,
+   // Waiting for a flow control frame from the receiver of the response
+   SESSION_STATE_WaitForFlowControl,
+   // Sending the consecutive frames of the response
+   SESSION_STATE_Transmitting
+} SessionState_t;
+
+// This structure holds the transfer in progress on a single identifier
+typedef struct
+{
+   // State of the transfer
+   SessionState_t state;
+
+   // The channel of the transfer
+   CAN_Drv_Channel_t channel;
+
+   // The identifier of the command and flow control frames from the other node
+   uint32_t rxCanId;
+
+   // The identifier of the response and flow control frames sent by this node
+   uint32_t txCanId;
+
+   // Module and command the command is routed to
+   uint8_t moduleID;
+   uint8_t commandID;
+
+   // Message buffer pool block holding the command and later the response
+   uint8_t *block;
+
+   // The total number of data bytes in the block
+   uint8_t length;
+
+   // The number of data bytes received or sent
+   uint8_t index;
+
+   // Sequence number of the next consecutive frame
+   uint8_t sequenceNumber;
+
+   // Consecutive frames allowed between flow control frames, 0 for no limit
+   uint8_t blockSize;
+
+   // Consecutive frames received or sent since the last flow control frame
+   uint8_t blockCount;
+
+   // Minimum time between consecutive frames sent, in milliseconds
+   uint8_t separationTimeMs;
+
+   // Time of the last frame received or sent, used for the timeout
+   uint32_t lastActivityTime;
+
+   // Time the last consecutive frame was sent, used for the separation time
+   uint32_t lastSendTime;
+} Session_t;
+
+// Holds statistics on the transfers
+typedef struct
+{
+   // Number of complete commands executed
+   uint32_t numMessagesReceived;
+   // Number of responses sent completely
+   uint32_t numMessagesSent;
+   // Number of transfers ended because a frame did not arrive in time
+   uint32_t numTimeouts;
+   // Number of transfers ended by an invalid frame, an overflow or a failed command
+   uint32_t numAborted;
+   // Number of commands dropped because no session or block was free
+   uint32_t numNoSessionFree;
+} TxRxStatistics_t;
+
+// This structure holds the private information for this module
+typedef struct
+{
+   // The sessions, one for each transfer in progress
+   Session_t sessions[LUNAR_ISOTP_NUM_SESSIONS];
+
+   // Stats for the transfers
+   TxRxStatistics_t statistics;
+} Lunar_IsoTp_Status_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The variable used for holding all internal data for this module.
+static Lunar_IsoTp_Status_t status;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function finds the session of the given receive identifier.  When
+  *    no session uses the identifier and a new transfer is to be started, an
+  *    idle session is returned instead with a block allocated for it.
+  * Parameters:
+  *    channel : The channel of the transfer
+  *    rxCanId : The identifier of the frames received by the session
+  *    isNewTransfer : true to start a new transfer, which ends the transfer
+  *                    in progress on the identifier
+  * Returns:
+  *    Session_t * : The session or 0 if none was found or free
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static Session_t *FindSession(const CAN_Drv_Channel_t channel, const uint32_t rxCanId, const bool isNewTransfer);
+
+/** Description:
+  *    This function ends the transfer of the session and returns its block
+  *    to the pool.
+  * Parameters:
+  *    session : The session to be ended
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void EndSession(Session_t *const session) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function executes the complete command of the session via the
+  *    Message Router and prepares the response to be sent.
+  * Parameters:
+  *    session : The session holding the complete command
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void ProcessCommand(Session_t *const session) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function sends a flow control frame.
+  * Parameters:
+  *    channel : The channel of the transfer
+  *    txCanId : The identifier of the frames sent for the transfer
+  *    flowStatus : The flow status to be sent
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void SendFlowControl(const CAN_Drv_Channel_t channel, const uint32_t txCanId, const uint8_t flowStatus);
+
+/** Description:
+  *    This function sends the next frame of the response of the session.
+  * Parameters:
+  *    session : The session that is responding or transmitting
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void SendNextFrame(Session_t *const session) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function handles a received consecutive frame.
+  * Parameters:
+  *    session : The session receiving a command
+  *    frame : The received frame
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void ReceiveConsecutiveFrame(Session_t *const session, const CAN_Drv_Frame_t *const frame) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function handles a received flow control frame.
+  * Parameters:
+  *    session : The session waiting for a flow control frame
+  *    frame : The received frame
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void ReceiveFlowControl(Session_t *const session, const CAN_Drv_Frame_t *const frame) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function converts a received STmin value to milliseconds.
+  * Parameters:
+  *    separationTime : The STmin value of a flow control frame
+  * Returns:
+  *    uint8_t : The separation time in milliseconds
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint8_t DecodeSeparationTime(const uint8_t separationTime);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Find the session of an identifier or a free one
+static Session_t *FindSession(const CAN_Drv_Channel_t channel, const uint32_t rxCanId, const bool isNewTransfer)
+{
+   Session_t *session = 0;
+   Session_t *freeSession = 0;
+
+   for (uint8_t i = 0U; (i < LUNAR_ISOTP_NUM_SESSIONS) && (session == 0); i++)
+   {
+      if (status.sessions[i].state == SESSION_STATE_Idle)
+      {
+         freeSession = (freeSession == 0) ? &status.sessions[i] : freeSession;
+      }
+      else if ((status.sessions[i].channel == channel) && (status.sessions[i].rxCanId == rxCanId))
+      {
+         session = &status.sessions[i];
+      }
+      else
+      {
+         // This session belongs to another identifier
+      }
+   }
+
+   if (isNewTransfer)
+   {
+      if (session != 0)
+      {
+         // A new command replaces the transfer in progress, the block is reused
+         status.statistics.numAborted++;
+      }
+      else if (freeSession != 0)
+      {
+         freeSession->block = Lunar_MessageBufferPool_Allocate();
+         session = (freeSession->block != 0) ? freeSession : 0;
+      }
+      else
+      {
+         // All sessions are in use
+      }
+
+      if (session != 0)
+      {
+         session->channel = channel;
+         session->rxCanId = rxCanId;
+         session->index = 0U;
+         session->blockSize = 0U;
+         session->blockCount = 0U;
+         session->separationTimeMs = 0U;
+         session->lastActivityTime = Timebase_Drv_GetCurrentTickCount();
+         session->lastSendTime = session->lastActivityTime;
+      }
+      else
+      {
+         status.statistics.numNoSessionFree++;
+      }
+   }
+
+   return(session);
+}
+
+
+// End the transfer of a session
+static void EndSession(Session_t *const session)
+{
+   Lunar_MessageBufferPool_Release(session->block);
+   session->block = 0;
+   session->state = SESSION_STATE_Idle;
+}
+
+
+// Execute a complete command
+static void ProcessCommand(Session_t *const session)
+{
+   Lunar_MessageRouter_Message_t message;
+
+   // The command and response use the block of the session
+   Lunar_MessageBufferPool_AttachMessage(&message, session->block, session->length);
+
+   // Init the message to no error
+   message.responseCode = LUNAR_MESSAGEROUTER_RESPONSE_CODE_None;
+
+   // Note where the message came from so that handlers can reply on the same bus
+   message.source.transport = LUNAR_MESSAGEROUTER_TRANSPORT_CAN;
+   message.source.channel = (uint8_t)session->channel;
+   message.source.address = 0U;
+   message.source.timestamp = Timebase_Drv_GetCycleCount();
+
+   // CAN frames do not carry a message ID
+   message.header.moduleID = session->moduleID;
+   message.header.commandID = session->commandID;
+   message.header.messageID = 0U;
+
+   // Process message
+   Lunar_MessageRouter_ProcessMessage(&message);
+   status.statistics.numMessagesReceived++;
+
+   if (message.responseCode == LUNAR_MESSAGEROUTER_RESPONSE_CODE_None)
+   {
+      // The response is sent by the update function
+      session->length = message.responseParams.length;
+      session->index = 0U;
+      session->state = SESSION_STATE_Responding;
+   }
+   else
+   {
+      // As for single frames, failed commands do not have a response
+      status.statistics.numAborted++;
+      EndSession(session);
+   }
+}
+
+
+// Send a flow control frame
+static void SendFlowControl(const CAN_Drv_Channel_t channel, const uint32_t txCanId, const uint8_t flowStatus)
+{
+   uint8_t data[FLOW_CONTROL_LENGTH];
+
+   data[0] = PCI_TYPE_FLOW_CONTROL | flowStatus;
+   data[1] = LUNAR_ISOTP_BLOCK_SIZE;
+   data[2] = LUNAR_ISOTP_SEPARATION_TIME_MS;
+
+   // A lost flow control frame is handled by the timeout of the sender
+   (void)CAN_Drv_StartTransmitFrame(channel, txCanId, data, FLOW_CONTROL_LENGTH);
+}
+
+
+// Send the next frame of a response
+static void SendNextFrame(Session_t *const session)
+{
+   uint8_t data[CAN_DRV_MAX_DATA_LENGTH];
+   uint8_t headerLength;
+   uint8_t dataLength;
+
+   if (session->state == SESSION_STATE_Responding)
+   {
+      if (session->length <= SINGLE_FRAME_MAX_DATA_LENGTH)
+      {
+         // The complete response fits in a single frame
+         data[0] = PCI_TYPE_SINGLE_FRAME | session->length;
+         headerLength = 1U;
+         dataLength = session->length;
+      }
+      else
+      {
+         // The first frame holds the total length, the 12-bit length never exceeds a block
+         data[0] = PCI_TYPE_FIRST_FRAME;
+         data[1] = session->length;
+         headerLength = 2U;
+         dataLength = FIRST_FRAME_DATA_LENGTH;
+      }
+      session->sequenceNumber = 1U;
+   }
+   else
+   {
+      data[0] = PCI_TYPE_CONSECUTIVE_FRAME | session->sequenceNumber;
+      headerLength = 1U;
+      dataLength = PLATFORM_MIN(CONSECUTIVE_FRAME_MAX_DATA_LENGTH, session->length - session->index);
+      session->sequenceNumber = (session->sequenceNumber + 1U) & SEQUENCE_NUMBER_MASK;
+   }
+
+   memcpy(&data[headerLength], &session->block[session->index], dataLength);
+
+   if (CAN_Drv_StartTransmitFrame(session->channel, session->txCanId, data, headerLength + dataLength))
+   {
+      session->index += dataLength;
+      session->lastActivityTime = Timebase_Drv_GetCurrentTickCount();
+      session->lastSendTime = session->lastActivityTime;
+
+      if (session->index >= session->length)
+      {
+         status.statistics.numMessagesSent++;
+         EndSession(session);
+      }
+      else if (session->state == SESSION_STATE_Responding)
+      {
+         session->state = SESSION_STATE_WaitForFlowControl;
+      }
+      else
+      {
+         // Wait for the next flow control frame once the block is complete
+         session->blockCount++;
+         if ((session->blockSize != 0U) && (session->blockCount >= session->blockSize))
+         {
+            session->state = SESSION_STATE_WaitForFlowControl;
+         }
+      }
+   }
+   else
+   {
+      // The transmit queue is full of higher priority frames
+      status.statistics.numAborted++;
+      EndSession(session);
+   }
+}
+
+
+// Handle a consecutive frame of a command
+static void ReceiveConsecutiveFrame(Session_t *const session, const CAN_Drv_Frame_t *const frame)
+{
+   if ((frame->data[0] & PCI_VALUE_MASK) != session->sequenceNumber)
+   {
+      // A frame was lost, the command cannot be completed
+      status.statistics.numAborted++;
+      EndSession(session);
+   }
+   else
+   {
+      uint8_t dataLength = PLATFORM_MIN(frame->length - 1U, session->length - session->index);
+
+      memcpy(&session->block[session->index], &frame->data[1], dataLength);
+      session->index += dataLength;
+      session->sequenceNumber = (session->sequenceNumber + 1U) & SEQUENCE_NUMBER_MASK;
+      session->lastActivityTime = Timebase_Drv_GetCurrentTickCount();
+
+      if (session->index >= session->length)
+      {
+         ProcessCommand(session);
+      }
+      else
+      {
+         // Allow the next block once the block is complete
+         session->blockCount++;
+         if ((LUNAR_ISOTP_BLOCK_SIZE != 0U) && (session->blockCount >= LUNAR_ISOTP_BLOCK_SIZE))
+         {
+            session->blockCount = 0U;
+            SendFlowControl(session->channel, session->txCanId, FLOW_STATUS_CONTINUE_TO_SEND);
+         }
+      }
+   }
+}
+
+
+// Handle a flow control frame for a response
+static void ReceiveFlowControl(Session_t *const session, const CAN_Drv_Frame_t *const frame)
+{
+   uint8_t flowStatus = frame->data[0] & PCI_VALUE_MASK;
+
+   if ((flowStatus == FLOW_STATUS_CONTINUE_TO_SEND) && (frame->length >= FLOW_CONTROL_LENGTH))
+   {
+      session->blockSize = frame->data[1];
+      session->blockCount = 0U;
+      session->separationTimeMs = DecodeSeparationTime(frame->data[2]);
+      session->lastActivityTime = Timebase_Drv_GetCurrentTickCount();
+      session->state = SESSION_STATE_Transmitting;
+   }
+   else if (flowStatus == FLOW_STATUS_WAIT)
+   {
+      // The receiver needs more time, restart the timeout
+      session->lastActivityTime = Timebase_Drv_GetCurrentTickCount();
+   }
+   else
+   {
+      // Overflow or an invalid flow status ends the transfer
+      status.statistics.numAborted++;
+      EndSession(session);
+   }
+}
+
+
+// Convert an STmin value to milliseconds
+static uint8_t DecodeSeparationTime(const uint8_t separationTime)
+{
+   // Reserved values must be handled as the longest separation time
+   uint8_t separationTimeMs = MAX_SEPARATION_TIME_MS;
+
+   if (separationTime <= MAX_SEPARATION_TIME_MS)
+   {
+      separationTimeMs = separationTime;
+   }
+   else if ((separationTime >= MIN_SEPARATION_TIME_US_VALUE) && (separationTime <= MAX_SEPARATION_TIME_US_VALUE))
+   {
+      // The update runs every millisecond, which is the shortest time possible
+      separationTimeMs = 1U;
+   }
+   else
+   {
+      // Reserved value
+   }
+
+   return(separationTimeMs);
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Initialize the ISO-TP sessions
+void Lunar_IsoTp_Init(void)
+{
+   memset(&status, 0, sizeof(status));
+
+   for (uint8_t i = 0U; i < LUNAR_ISOTP_NUM_SESSIONS; i++)
+   {
+      status.sessions[i].state = SESSION_STATE_Idle;
+   }
+}
+
+
+// Scheduled update loop for sending frames and checking timeouts
+void Lunar_IsoTp_Update(void)
+{
+   uint32_t currentTime = Timebase_Drv_GetCurrentTickCount();
+
+   for (uint8_t i = 0U; i < LUNAR_ISOTP_NUM_SESSIONS; i++)
+   {
+      Session_t *const session = &status.sessions[i];
+
+      if (session->state != SESSION_STATE_Idle)
+      {
+         if ((currentTime - session->lastActivityTime) >= (LUNAR_ISOTP_TIMEOUT_MS * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND))
+         {
+            // The other node stopped or the frames could not be sent
+            status.statistics.numTimeouts++;
+            EndSession(session);
+         }
+         // A frame still waiting with the same identifier would be replaced
+         else if (((session->state == SESSION_STATE_Responding) || (session->state == SESSION_STATE_Transmitting)) &&
+                  ((currentTime - session->lastSendTime) >= ((uint32_t)session->separationTimeMs * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND)) &&
+                  (!CAN_Drv_IsTransmitPending(session->channel, session->txCanId)))
+         {
+            SendNextFrame(session);
+         }
+         else
+         {
+            // Waiting for a frame from the other node or for the separation time
+         }
+      }
+   }
+}
+
+
+// Handle a frame received on a segmented route
+void Lunar_IsoTp_ReceiveFrame(const CAN_Drv_Channel_t channel, const CAN_Drv_Frame_t *const frame, const uint32_t txCanId, const uint8_t moduleID, const uint8_t commandID)
+{
+   // Frames without the PCI byte are ignored
+   if (frame->length > 0U)
+   {
+      uint8_t frameType = frame->data[0] & PCI_TYPE_MASK;
+      Session_t *session = 0;
+
+      if (frameType == PCI_TYPE_SINGLE_FRAME)
+      {
+         uint8_t length = frame->data[0] & PCI_VALUE_MASK;
+
+         if ((length > 0U) && (length < frame->length))
+         {
+            session = FindSession(channel, frame->canId, true);
+            if (session != 0)
+            {
+               session->txCanId = txCanId;
+               session->moduleID = moduleID;
+               session->commandID = commandID;
+               session->length = length;
+               memcpy(session->block, &frame->data[1], length);
+               ProcessCommand(session);
+            }
+         }
+      }
+      else if (frameType == PCI_TYPE_FIRST_FRAME)
+      {
+         uint16_t length = ((uint16_t)(frame->data[0] & PCI_VALUE_MASK) << 8U) | frame->data[1];
+
+         // A first frame is always full and holds more than a single frame
+         if ((frame->length == CAN_DRV_MAX_DATA_LENGTH) && (length > SINGLE_FRAME_MAX_DATA_LENGTH))
+         {
+            if (length > LUNAR_MESSAGEBUFFERPOOL_BLOCK_SIZE)
+            {
+               // The command does not fit in a block
+               SendFlowControl(channel, txCanId, FLOW_STATUS_OVERFLOW);
+               status.statistics.numAborted++;
+            }
+            else
+            {
+               session = FindSession(channel, frame->canId, true);
+               if (session != 0)
+               {
+                  session->txCanId = txCanId;
+                  session->moduleID = moduleID;
+                  session->commandID = commandID;
+                  session->length = (uint8_t)length;
+                  memcpy(session->block, &frame->data[2], FIRST_FRAME_DATA_LENGTH);
+                  session->index = FIRST_FRAME_DATA_LENGTH;
+                  session->sequenceNumber = 1U;
+                  session->state = SESSION_STATE_Receiving;
+                  SendFlowControl(channel, txCanId, FLOW_STATUS_CONTINUE_TO_SEND);
+               }
+            }
+         }
+      }
+      else if (frameType == PCI_TYPE_CONSECUTIVE_FRAME)
+      {
+         session = FindSession(channel, frame->canId, false);
+         if ((session != 0) && (session->state == SESSION_STATE_Receiving))
+         {
+            ReceiveConsecutiveFrame(session, frame);
+         }
+      }
+      else if (frameType == PCI_TYPE_FLOW_CONTROL)
+      {
+         session = FindSession(channel, frame->canId, false);
+         if ((session != 0) && (session->state == SESSION_STATE_WaitForFlowControl))
+         {
+            ReceiveFlowControl(session, frame);
+         }
+      }
+      else
+      {
+         // Unknown frame type, ignore it
+      }
+   }
+}
+
+
+// Start sending data segmented
+bool Lunar_IsoTp_StartTransmit(const CAN_Drv_Channel_t channel, const uint32_t rxCanId, const uint32_t txCanId, const uint8_t *const data, const uint8_t length)
+{
+   bool started = false;
+
+   // The data must fit in a block
+   if ((channel < CAN_DRV_CHANNEL_Count) && (length <= LUNAR_MESSAGEBUFFERPOOL_BLOCK_SIZE))
+   {
+      Session_t *session = FindSession(channel, rxCanId, false);
+
+      // Do not interrupt a transfer in progress on the identifier
+      if (session == 0)
+      {
+         session = FindSession(channel, rxCanId, true);
+         if (session != 0)
+         {
+            session->txCanId = txCanId;
+            session->length = length;
+            memcpy(session->block, data, length);
+            session->state = SESSION_STATE_Responding;
+            started = true;
+         }
+      }
+   }
+
+   return(started);
+}
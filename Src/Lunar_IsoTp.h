@@ -0,0 +1,99 @@
+/*******************************************************************************
+// Core ISO-TP Module
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Lunar_IsoTp_Config.h"
+// Platform Includes
+#include "CAN_Drv.h"
+#include "Platform.h"
+// Other Includes
+#include <stdbool.h>
+#include <stdint.h>
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+
+/*******************************************************************************
+// Public Type Declarations
+*******************************************************************************/
+
+
+/*******************************************************************************
+// Public Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function initializes the ISO-TP module and ends all sessions.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_IsoTp_Init(void);
+
+/** Description:
+  *    This is the scheduled update function that sends the next frame of
+  *    each session once the separation time has passed and ends sessions
+  *    that have not seen the expected frame in LUNAR_ISOTP_TIMEOUT_MS.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_IsoTp_Update(void);
+
+/** Description:
+  *    This function handles a frame received on a segmented route.  Single
+  *    and consecutive frames are reassembled into a message buffer pool block.
+  *    When the command is complete it is executed via the Message Router and
+  *    the response is sent segmented from the same block.  Flow control
+  *    frames continue the response of the session.  Each identifier has its
+  *    own session, so requests on different identifiers may be in progress
+  *    at the same time.
+  * Parameters:
+  *    channel - The configured CAN channel the frame was received on
+  *    frame - The received frame
+  *    txCanId - The CAN identifier used for the flow control and response frames
+  *    moduleID - The module ID the command is routed to
+  *    commandID - The command ID the command is routed to
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_IsoTp_ReceiveFrame(const CAN_Drv_Channel_t channel, const CAN_Drv_Frame_t *const frame, const uint32_t txCanId, const uint8_t moduleID, const uint8_t commandID) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function starts sending the given data segmented.  The data is
+  *    copied to a message buffer pool block, so the caller may reuse its
+  *    buffer right away.
+  * Parameters:
+  *    channel - The configured CAN channel used to send the data
+  *    rxCanId - The CAN identifier the receiver sends flow control frames on
+  *    txCanId - The CAN identifier used for the data frames
+  *    data - A pointer to the data that is to be sent
+  *    length - The number of bytes in the data buffer
+  * Returns:
+  *    bool - true if the transfer was started
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+bool Lunar_IsoTp_StartTransmit(const CAN_Drv_Channel_t channel, const uint32_t rxCanId, const uint32_t txCanId, const uint8_t *const data, const uint8_t length) PLATFORM_NON_NULL;
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
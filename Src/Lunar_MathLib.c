@@ -17,6 +17,12 @@
 // Private Constant Definitions
 *******************************************************************************/
 
+// The CRC-16/CCITT generator polynomial
+#define CRC16_POLYNOMIAL (0x1021U)
+
+// The reflected CRC-32 polynomial
+#define CRC32_POLYNOMIAL (0xEDB88320UL)
+
 
 /*******************************************************************************
 // Private Type Declarations
@@ -71,3 +77,82 @@ uint32_t Lunar_MathLib_SubtractSaturateUint32(const uint32_t value1, const uint3
    return(result);
 }
 
+// CRC-16/CCITT calculation
+uint16_t Lunar_MathLib_Crc16(const uint8_t *const data, const uint32_t length, const uint16_t initialCrc)
+{
+   uint16_t crc = initialCrc;
+
+   // A bitwise calculation is used to avoid the 512 byte lookup table
+   for (uint32_t i = 0U; i < length; i++)
+   {
+      crc ^= (uint16_t)((uint16_t)data[i] << 8U);
+
+      for (uint8_t bit = 0U; bit < 8U; bit++)
+      {
+         if ((crc & 0x8000U) != 0U)
+         {
+            crc = (uint16_t)((crc << 1U) ^ CRC16_POLYNOMIAL);
+         }
+         else
+         {
+            crc = (uint16_t)(crc << 1U);
+         }
+      }
+   }
+
+   return(crc);
+}
+
+
+// CRC-32 calculation
+uint32_t Lunar_MathLib_Crc32(const uint8_t *const data, const uint32_t length, const uint32_t initialCrc)
+{
+   // The register is inverted before and after, so a result can be continued
+   uint32_t crc = ~initialCrc;
+
+   // A bitwise calculation is used to avoid the 1 KB lookup table
+   for (uint32_t i = 0U; i < length; i++)
+   {
+      crc ^= data[i];
+
+      for (uint8_t bit = 0U; bit < 8U; bit++)
+      {
+         if ((crc & 1U) != 0U)
+         {
+            crc = (crc >> 1U) ^ CRC32_POLYNOMIAL;
+         }
+         else
+         {
+            crc >>= 1U;
+         }
+      }
+   }
+
+   return(~crc);
+}
+
+// Integer square root
+uint32_t Lunar_MathLib_SqrtUint64(const uint64_t value)
+{
+   uint64_t remainder = value;
+   uint64_t root = 0U;
+   // Start with the highest power of four
+   uint64_t bit = (uint64_t)1U << 62U;
+
+   // One result bit is found per step, from the top
+   while (bit != 0U)
+   {
+      if (remainder >= (root + bit))
+      {
+         remainder -= root + bit;
+         root = (root >> 1U) + bit;
+      }
+      else
+      {
+         root >>= 1U;
+      }
+      bit >>= 2U;
+   }
+
+   return((uint32_t)root);
+}
@@ -23,6 +23,12 @@ extern "C"
 // Public Constant Definitions
 *******************************************************************************/
 
+// The starting value for a new CRC-16/CCITT calculation
+#define LUNAR_MATHLIB_CRC16_INITIAL_VALUE (0xFFFFU)
+
+// The starting value for a new CRC-32 calculation
+#define LUNAR_MATHLIB_CRC32_INITIAL_VALUE (0x00000000UL)
+
 
 /*******************************************************************************
 // Public Type Declarations
@@ -70,6 +76,54 @@ uint32_t Lunar_MathLib_AddSaturateUint32(uint32_t const value1, uint32_t const v
 */
 uint32_t Lunar_MathLib_SubtractSaturateUint32(const uint32_t value1, const uint32_t value2);
 
+/** Description:
+  *    Calculates the CRC-16/CCITT (polynomial 0x1021) of the given data.  The
+  *    CRC may be calculated in pieces by passing the result of the previous
+  *    call as the initial value.
+  * Parameters:
+  *    data :        The data to be checked
+  *    length :      The number of bytes of data
+  *    initialCrc :  The starting value, LUNAR_MATHLIB_CRC16_INITIAL_VALUE
+  *                  for new data
+  * Returns:
+  *    uint16_t - The calculated CRC
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+uint16_t Lunar_MathLib_Crc16(const uint8_t *const data, const uint32_t length, const uint16_t initialCrc);
+
+/** Description:
+  *    Calculates the CRC-32 (reflected polynomial 0xEDB88320, as used by
+  *    zlib and Ethernet) of the given data.  The CRC may be calculated in
+  *    pieces by passing the result of the previous call as the initial value.
+  * Parameters:
+  *    data :        The data to be checked
+  *    length :      The number of bytes of data
+  *    initialCrc :  The starting value, LUNAR_MATHLIB_CRC32_INITIAL_VALUE
+  *                  for new data
+  * Returns:
+  *    uint32_t - The calculated CRC
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+uint32_t Lunar_MathLib_Crc32(const uint8_t *const data, const uint32_t length, const uint32_t initialCrc);
+
+/** Description:
+  *    Calculates the integer square root of the given value, rounded down.
+  *    Only shifts, adds and compares are used, so the time does not depend
+  *    on a hardware divider and is the same for every value.
+  * Parameters:
+  *    value :  The value whose square root is to be calculated
+  * Returns:
+  *    uint32_t - The largest integer whose square is not above value
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+uint32_t Lunar_MathLib_SqrtUint64(const uint64_t value);
+
 
 #ifdef __cplusplus
 extern "C"
@@ -0,0 +1,206 @@
+/*******************************************************************************
+// Core Message Buffer Pool Module
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Lunar_MessageBufferPool.h"
+#include "Lunar_MessageBufferPool_Config.h"
+// Platform Includes
+#include "Lunar_MessageRouter.h"
+// Other Includes
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// A single block in the pool
+// The union guarantees the alignment required by the handler structures.
+typedef union
+{
+   // Forces 32-bit alignment of the data
+   uint32_t alignment;
+   // Block data
+   uint8_t data[LUNAR_MESSAGEBUFFERPOOL_BLOCK_SIZE];
+} Block_t;
+
+// This structure holds the private information for this module
+typedef struct
+{
+   // Storage for all blocks
+   Block_t blocks[LUNAR_MESSAGEBUFFERPOOL_NUM_BLOCKS];
+
+   // Reference count for each block, 0 = free
+   uint8_t refCounts[LUNAR_MESSAGEBUFFERPOOL_NUM_BLOCKS];
+
+   // Number of blocks that are currently free
+   uint8_t numFreeBlocks;
+
+   // Lowest number of free blocks since initialization
+   uint8_t minFreeBlocks;
+} Lunar_MessageBufferPool_Status_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The variable used for holding all internal data for this module.
+static Lunar_MessageBufferPool_Status_t status;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function determines the index of the block that starts at the
+  *    given address.
+  * Parameters:
+  *    block :  Pointer to the start of a block
+  * Returns:
+  *    uint8_t - The index of the block or LUNAR_MESSAGEBUFFERPOOL_NUM_BLOCKS
+  *    if the pointer is not the start of a block in the pool
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint8_t GetBlockIndex(const uint8_t *const block);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Find the index of the given block
+static uint8_t GetBlockIndex(const uint8_t *const block)
+{
+   // Assume the block is not from the pool
+   uint8_t blockIndex = (uint8_t)LUNAR_MESSAGEBUFFERPOOL_NUM_BLOCKS;
+
+   // Make sure the pointer is within the pool
+   if ((block >= status.blocks[0].data) && (block < status.blocks[LUNAR_MESSAGEBUFFERPOOL_NUM_BLOCKS - 1U].data + LUNAR_MESSAGEBUFFERPOOL_BLOCK_SIZE))
+   {
+      uint32_t offset = (uint32_t)(block - status.blocks[0].data);
+
+      // Only the start of a block is valid
+      if ((offset % sizeof(Block_t)) == 0U)
+      {
+         blockIndex = (uint8_t)(offset / sizeof(Block_t));
+      }
+   }
+
+   return(blockIndex);
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Initialize the pool
+void Lunar_MessageBufferPool_Init(void)
+{
+   // All blocks are free
+   memset(status.refCounts, 0, sizeof(status.refCounts));
+   status.numFreeBlocks = (uint8_t)LUNAR_MESSAGEBUFFERPOOL_NUM_BLOCKS;
+   status.minFreeBlocks = (uint8_t)LUNAR_MESSAGEBUFFERPOOL_NUM_BLOCKS;
+}
+
+
+// Allocate a block from the pool
+uint8_t *Lunar_MessageBufferPool_Allocate(void)
+{
+   // Assume no blocks are available
+   uint8_t *block = 0;
+
+   // Find the first free block
+   for (uint8_t i = 0U; i < (uint8_t)LUNAR_MESSAGEBUFFERPOOL_NUM_BLOCKS; i++)
+   {
+      if (status.refCounts[i] == 0U)
+      {
+         // Block is free, take the first reference
+         status.refCounts[i] = 1U;
+         block = status.blocks[i].data;
+
+         // Update the usage
+         status.numFreeBlocks--;
+         status.minFreeBlocks = PLATFORM_MIN(status.minFreeBlocks, status.numFreeBlocks);
+         break;
+      }
+   }
+
+   return(block);
+}
+
+
+// Add a reference to a block
+void Lunar_MessageBufferPool_Retain(uint8_t *const block)
+{
+   uint8_t blockIndex = GetBlockIndex(block);
+
+   // Only blocks that are in use may be retained
+   if ((blockIndex < (uint8_t)LUNAR_MESSAGEBUFFERPOOL_NUM_BLOCKS) && (status.refCounts[blockIndex] > 0U) && (status.refCounts[blockIndex] < UINT8_MAX))
+   {
+      status.refCounts[blockIndex]++;
+   }
+}
+
+
+// Remove a reference from a block
+void Lunar_MessageBufferPool_Release(uint8_t *const block)
+{
+   uint8_t blockIndex = GetBlockIndex(block);
+
+   // Ignore blocks that are not from the pool or were already released
+   if ((blockIndex < (uint8_t)LUNAR_MESSAGEBUFFERPOOL_NUM_BLOCKS) && (status.refCounts[blockIndex] > 0U))
+   {
+      status.refCounts[blockIndex]--;
+
+      // Return the block to the pool when the last reference is released
+      if (status.refCounts[blockIndex] == 0U)
+      {
+         status.numFreeBlocks++;
+      }
+   }
+}
+
+
+// Assign a block to the command and response of a message
+void Lunar_MessageBufferPool_AttachMessage(Lunar_MessageRouter_Message_t *const message, uint8_t *const block, const uint8_t commandLength)
+{
+   // Verify the parameters
+   if ((message != 0) && (block != 0))
+   {
+      // The command parameters have already been placed in the block
+      message->commandParams.data = block;
+      message->commandParams.maxLength = (uint8_t)LUNAR_MESSAGEBUFFERPOOL_BLOCK_SIZE;
+      message->commandParams.length = commandLength;
+
+      // The response is written in place over the command parameters
+      message->responseParams.data = block;
+      message->responseParams.maxLength = (uint8_t)LUNAR_MESSAGEBUFFERPOOL_BLOCK_SIZE;
+      message->responseParams.length = 0U;
+   }
+}
+
+
+// Get the number of free blocks
+uint8_t Lunar_MessageBufferPool_GetNumFreeBlocks(void)
+{
+   return(status.numFreeBlocks);
+}
+
+
+// Get the lowest number of free blocks
+uint8_t Lunar_MessageBufferPool_GetMinFreeBlocks(void)
+{
+   return(status.minFreeBlocks);
+}
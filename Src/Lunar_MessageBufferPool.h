@@ -0,0 +1,117 @@
+/*******************************************************************************
+// Core Message Buffer Pool Module
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Lunar_MessageBufferPool_Config.h"
+// Platform Includes
+#include "Lunar_MessageRouter.h"
+#include "Platform.h"
+// Other Includes
+#include <stdbool.h>
+#include <stdint.h>
+
+
+/*******************************************************************************
+// Public Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function initializes the message buffer pool and marks all blocks
+  *    as free.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_MessageBufferPool_Init(void);
+
+/** Description:
+  *    This function allocates a block from the pool.  The block is returned
+  *    with a reference count of 1 and is aligned for casting to the command
+  *    and response structures used by the message handlers.
+  *    Note that the pool is not protected from interrupts and must only be used
+  *    from scheduled functions.
+  * Returns:
+  *    uint8_t * - Pointer to the LUNAR_MESSAGEBUFFERPOOL_BLOCK_SIZE byte block
+  *    or NULL if all blocks are in use
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+uint8_t *Lunar_MessageBufferPool_Allocate(void);
+
+/** Description:
+  *    This function adds a reference to the given block.  This allows a module
+  *    to hold on to a block (Ex. deferred response) after the transport that
+  *    allocated it has released it.
+  * Parameters:
+  *    block :  Pointer returned by Lunar_MessageBufferPool_Allocate
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_MessageBufferPool_Retain(uint8_t *const block);
+
+/** Description:
+  *    This function removes a reference from the given block.  The block is
+  *    returned to the pool when the last reference is released.
+  * Parameters:
+  *    block :  Pointer returned by Lunar_MessageBufferPool_Allocate.  NULL and
+  *             pointers that are not from the pool are ignored.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_MessageBufferPool_Release(uint8_t *const block);
+
+/** Description:
+  *    This function assigns the given block to both the command and response
+  *    buffers of the given message.  Handlers write the response in place, so
+  *    they must read any command parameters they need before writing the
+  *    response.
+  * Parameters:
+  *    message :        The message object to be populated
+  *    block :          Pointer returned by Lunar_MessageBufferPool_Allocate
+  *    commandLength :  Number of command parameter bytes already in the block
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_MessageBufferPool_AttachMessage(Lunar_MessageRouter_Message_t *const message, uint8_t *const block, const uint8_t commandLength) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function returns the number of blocks that are currently free.
+  * Returns:
+  *    uint8_t - The number of free blocks
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+uint8_t Lunar_MessageBufferPool_GetNumFreeBlocks(void);
+
+/** Description:
+  *    This function returns the lowest number of free blocks since the pool
+  *    was initialized.  This is used to size the pool for each board.
+  * Returns:
+  *    uint8_t - The minimum number of free blocks
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+uint8_t Lunar_MessageBufferPool_GetMinFreeBlocks(void);
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
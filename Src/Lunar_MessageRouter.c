@@ -7,8 +7,13 @@
 *******************************************************************************/
 // Platform Includes
 #include "Lunar_MessageRouter.h"
+#include "Lunar_MessageRouter_Config.h"
 #include "Lunar_MessageRouter_ConfigTable.h"
+#include "Timebase_Drv.h"
 // Other Includes
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
 
 
 /*******************************************************************************
@@ -18,31 +23,343 @@
 // The total number of modules define in the Message Router configuration
 #define NUM_MESSAGEROUTER_MODULES (sizeof(messageRouterConfigTable)/sizeof(Lunar_MessageRouter_ConfigItem_t))
 
+// The maximum value of a response code counter in the command metrics
+#define METRICS_MAX_RESPONSE_CODE_COUNT (UINT16_MAX)
+
 
 /*******************************************************************************
 // Private Type Declarations
 *******************************************************************************/
 
+// This structure holds a single response in the response cache
+typedef struct
+{
+   // Denotes if this entry holds a response
+   bool isValid;
+
+   // Module ID and Command ID of the cached response
+   uint8_t moduleID;
+   uint8_t commandID;
+
+   // Length of the cached response
+   uint8_t length;
+
+   // Tick count when the response was generated by the handler
+   uint32_t timestamp;
+
+   // The cached response parameters
+   uint8_t data[LUNAR_MESSAGEROUTER_CACHE_MAX_RESPONSE_SIZE];
+} CacheEntry_t;
+
+// This structure holds the response cache counters
+typedef struct
+{
+   // Number of messages answered from the cache
+   uint32_t numHits;
+
+   // Number of cacheable messages that called the handler
+   uint32_t numMisses;
+} CacheStatistics_t;
+
+#if LUNAR_MESSAGEROUTER_METRICS_ENABLED
+// This structure holds the metrics for a single command
+typedef struct
+{
+   // Number of times the command was received
+   uint32_t numCalls;
+
+   // Number of times each response code was returned (saturates)
+   uint16_t responseCodeCounts[LUNAR_MESSAGEROUTER_RESPONSE_CODE_Count];
+
+   // Shortest and longest handler execution time in CPU cycles
+   uint32_t minCycles;
+   uint32_t maxCycles;
+
+   // Total handler execution time in CPU cycles
+   uint64_t totalCycles;
+} CommandMetrics_t;
+
+// This structure holds the metrics for all commands
+typedef struct
+{
+   // Metrics for each command, in command table order
+   CommandMetrics_t commands[LUNAR_MESSAGEROUTER_METRICS_MAX_COMMANDS];
+
+   // Index of the metrics for the first command of each module
+   uint16_t moduleMetricsIndex[NUM_MESSAGEROUTER_MODULES];
+
+   // Number of commands with metrics
+   uint16_t numCommands;
+
+   // Number of messages that could not be routed
+   uint32_t numInvalidModuleID;
+   uint32_t numInvalidCommandID;
+} Metrics_t;
+#endif
+
+// This structure holds the private information for this module
+typedef struct
+{
+   // The response cache
+   CacheEntry_t cache[LUNAR_MESSAGEROUTER_CACHE_NUM_ENTRIES];
+
+   // The next cache entry to be replaced when the cache is full
+   uint8_t nextCacheIndex;
+
+   // Cache counters
+   CacheStatistics_t cacheStatistics;
+
+#if LUNAR_MESSAGEROUTER_METRICS_ENABLED
+   // Command metrics
+   Metrics_t metrics;
+#endif
+} Lunar_MessageRouter_Status_t;
+
 
 /*******************************************************************************
 // Private Variable Definitions
 *******************************************************************************/
 
+// The variable used for holding all internal data for this module.
+static Lunar_MessageRouter_Status_t status;
+
 
 /*******************************************************************************
 // Private Function Declarations
 *******************************************************************************/
 
+/** Description:
+  *    This function discards all cached responses and resets the counters.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void ClearCache(void);
+
+/** Description:
+  *    This function finds the cache entry for the given command.
+  * Parameters:
+  *    moduleID :   The Module ID of the command
+  *    commandID :  The Command ID of the command
+  * Returns:
+  *    CacheEntry_t * - The entry holding the response for the command or NULL
+  *    if the response is not cached
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static CacheEntry_t *FindCacheEntry(const uint8_t moduleID, const uint8_t commandID);
+
+/** Description:
+  *    This function attempts to answer the given message from the cache.
+  * Parameters:
+  *    message :      The message to be answered
+  *    maxAgeMs :     The maximum age of a cached response for this command
+  * Returns:
+  *    bool - true if the response was copied from the cache
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool ReadCache(Lunar_MessageRouter_Message_t *const message, const uint16_t maxAgeMs) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function stores the response in the given message in the cache.
+  *    Only successful responses that fit in a cache entry are stored.
+  * Parameters:
+  *    message :  The message holding the response from the handler
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void WriteCache(const Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+#if LUNAR_MESSAGEROUTER_METRICS_ENABLED
+/** Description:
+  *    This function resets the metrics for all commands.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void ResetMetrics(void);
+
+/** Description:
+  *    This function adds a single call of a command to its metrics.
+  * Parameters:
+  *    moduleIndex :   Index of the module in the Message Router configuration
+  *    commandIndex :  Index of the command in the command table of the module
+  *    responseCode :  The response code returned for the command
+  *    cycles :        The number of CPU cycles used to answer the command
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void RecordCommandMetrics(const uint32_t moduleIndex, const uint8_t commandIndex, const Lunar_MessageRouter_ResponseCode_t responseCode, const uint32_t cycles);
+#endif
+
 
 /*******************************************************************************
 // Private Function Implementations
 *******************************************************************************/
 
+// Discard all cached responses
+static void ClearCache(void)
+{
+   memset(status.cache, 0, sizeof(status.cache));
+   status.nextCacheIndex = 0U;
+   status.cacheStatistics.numHits = 0U;
+   status.cacheStatistics.numMisses = 0U;
+}
+
+
+// Find the cache entry for a command
+static CacheEntry_t *FindCacheEntry(const uint8_t moduleID, const uint8_t commandID)
+{
+   CacheEntry_t *entry = 0;
+
+   for (uint8_t i = 0U; i < (uint8_t)LUNAR_MESSAGEROUTER_CACHE_NUM_ENTRIES; i++)
+   {
+      if ((status.cache[i].isValid) && (status.cache[i].moduleID == moduleID) && (status.cache[i].commandID == commandID))
+      {
+         entry = &status.cache[i];
+         break;
+      }
+   }
+
+   return(entry);
+}
+
+
+// Answer a message from the cache
+static bool ReadCache(Lunar_MessageRouter_Message_t *const message, const uint16_t maxAgeMs)
+{
+   bool isHit = false;
+   const CacheEntry_t *entry = FindCacheEntry(message->header.moduleID, message->header.commandID);
+
+   // The cached response must be young enough and fit in the response buffer
+   if ((entry != 0) && (entry->length <= message->responseParams.maxLength))
+   {
+      uint32_t ageMs = (Timebase_Drv_GetCurrentTickCount() - entry->timestamp) / (uint32_t)TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND;
+
+      if ((maxAgeMs == LUNAR_MESSAGEROUTER_CACHE_FOREVER) || (ageMs <= maxAgeMs))
+      {
+         memcpy(message->responseParams.data, entry->data, entry->length);
+         message->responseParams.length = entry->length;
+         isHit = true;
+      }
+   }
+
+   return(isHit);
+}
+
+
+// Store a response in the cache
+static void WriteCache(const Lunar_MessageRouter_Message_t *const message)
+{
+   // Only cache successful responses that fit
+   if ((message->responseCode == LUNAR_MESSAGEROUTER_RESPONSE_CODE_None) && (message->responseParams.length <= LUNAR_MESSAGEROUTER_CACHE_MAX_RESPONSE_SIZE))
+   {
+      // Replace the existing response for this command, if any
+      CacheEntry_t *entry = FindCacheEntry(message->header.moduleID, message->header.commandID);
+
+      if (entry == 0)
+      {
+         // Use a free entry, if available
+         for (uint8_t i = 0U; i < (uint8_t)LUNAR_MESSAGEROUTER_CACHE_NUM_ENTRIES; i++)
+         {
+            if (!status.cache[i].isValid)
+            {
+               entry = &status.cache[i];
+               break;
+            }
+         }
+      }
+
+      if (entry == 0)
+      {
+         // Cache is full, replace the entries in turn
+         entry = &status.cache[status.nextCacheIndex];
+         status.nextCacheIndex = (uint8_t)((status.nextCacheIndex + 1U) % LUNAR_MESSAGEROUTER_CACHE_NUM_ENTRIES);
+      }
+
+      entry->isValid = true;
+      entry->moduleID = message->header.moduleID;
+      entry->commandID = message->header.commandID;
+      entry->length = message->responseParams.length;
+      entry->timestamp = Timebase_Drv_GetCurrentTickCount();
+      memcpy(entry->data, message->responseParams.data, message->responseParams.length);
+   }
+}
+
+
+#if LUNAR_MESSAGEROUTER_METRICS_ENABLED
+// Reset the metrics for all commands
+static void ResetMetrics(void)
+{
+   memset(status.metrics.commands, 0, sizeof(status.metrics.commands));
+
+   for (uint16_t i = 0U; i < (uint16_t)LUNAR_MESSAGEROUTER_METRICS_MAX_COMMANDS; i++)
+   {
+      status.metrics.commands[i].minCycles = UINT32_MAX;
+   }
+
+   status.metrics.numInvalidModuleID = 0U;
+   status.metrics.numInvalidCommandID = 0U;
+}
+
+
+// Record a single call of a command
+static void RecordCommandMetrics(const uint32_t moduleIndex, const uint8_t commandIndex, const Lunar_MessageRouter_ResponseCode_t responseCode, const uint32_t cycles)
+{
+   uint16_t metricsIndex = (uint16_t)(status.metrics.moduleMetricsIndex[moduleIndex] + commandIndex);
+
+   // Commands that did not fit in the metrics table are not recorded
+   if ((metricsIndex < status.metrics.numCommands) && (responseCode < LUNAR_MESSAGEROUTER_RESPONSE_CODE_Count))
+   {
+      CommandMetrics_t *command = &status.metrics.commands[metricsIndex];
+
+      command->numCalls++;
+
+      if (command->responseCodeCounts[responseCode] < METRICS_MAX_RESPONSE_CODE_COUNT)
+      {
+         command->responseCodeCounts[responseCode]++;
+      }
+
+      command->minCycles = PLATFORM_MIN(command->minCycles, cycles);
+      command->maxCycles = PLATFORM_MAX(command->maxCycles, cycles);
+      command->totalCycles += cycles;
+   }
+}
+#endif
+
 
 /*******************************************************************************
 // Public Function Implementations
 *******************************************************************************/
 
+// Initialize the module
+void Lunar_MessageRouter_Init(void)
+{
+   ClearCache();
+
+#if LUNAR_MESSAGEROUTER_METRICS_ENABLED
+   // Assign the metrics for each command in module table order
+   uint16_t numCommands = 0U;
+
+   for (uint32_t i = 0U; i < NUM_MESSAGEROUTER_MODULES; i++)
+   {
+      status.metrics.moduleMetricsIndex[i] = numCommands;
+      numCommands += messageRouterConfigTable[i].numCommands;
+   }
+
+   // Any commands beyond the size of the table are not recorded
+   status.metrics.numCommands = PLATFORM_MIN(numCommands, (uint16_t)LUNAR_MESSAGEROUTER_METRICS_MAX_COMMANDS);
+
+   ResetMetrics();
+#endif
+}
+
+
 // Lookup and execute the correspongin handler for a message
 void Lunar_MessageRouter_ProcessMessage(Lunar_MessageRouter_Message_t *const message)
 {
@@ -70,13 +387,38 @@ void Lunar_MessageRouter_ProcessMessage(Lunar_MessageRouter_Message_t *const mes
                // Command ID found, note that the message is valid up to this point
                message->responseCode = LUNAR_MESSAGEROUTER_RESPONSE_CODE_None;
 
+#if LUNAR_MESSAGEROUTER_METRICS_ENABLED
+               // Measure the time used to answer the command
+               uint32_t startCycles = Timebase_Drv_GetCycleCount();
+#endif
+
+               // Only commands without parameters are cached -- the response depends only on the command
+               const uint16_t cacheMaxAgeMs = messageRouterConfigTable[i].commandTable[j].cacheMaxAgeMs;
+               bool isCacheable = (cacheMaxAgeMs != LUNAR_MESSAGEROUTER_CACHE_NEVER) && (message->commandParams.length == 0U);
+
+               if ((isCacheable) && (ReadCache(message, cacheMaxAgeMs)))
+               {
+                  // Response was served from the cache without calling the handler
+                  status.cacheStatistics.numHits++;
+               }
                // Send the message to the massage handler, if it is not NULL
-               if (messageRouterConfigTable[i].commandTable[j].messageHandler != 0)
+               else if (messageRouterConfigTable[i].commandTable[j].messageHandler != 0)
                {
                   // Function is not NULL, so call it
                   messageRouterConfigTable[i].commandTable[j].messageHandler(message);
+
+                  // Keep the response for the next request
+                  if (isCacheable)
+                  {
+                     status.cacheStatistics.numMisses++;
+                     WriteCache(message);
+                  }
                }
 
+#if LUNAR_MESSAGEROUTER_METRICS_ENABLED
+               RecordCommandMetrics(i, j, message->responseCode, Timebase_Drv_GetCycleCount() - startCycles);
+#endif
+
                // Exit the command loop
                break;
             }
@@ -86,6 +428,18 @@ void Lunar_MessageRouter_ProcessMessage(Lunar_MessageRouter_Message_t *const mes
          break;
       }
    }
+
+#if LUNAR_MESSAGEROUTER_METRICS_ENABLED
+   // Count the messages that could not be routed
+   if (message->responseCode == LUNAR_MESSAGEROUTER_RESPONSE_CODE_InvalidModuleID)
+   {
+      status.metrics.numInvalidModuleID++;
+   }
+   else if (message->responseCode == LUNAR_MESSAGEROUTER_RESPONSE_CODE_InvalidCommandID)
+   {
+      status.metrics.numInvalidCommandID++;
+   }
+#endif
 }
 
 
@@ -190,3 +544,239 @@ void Lunar_MessageRouter_SetResponseSize(Lunar_MessageRouter_Message_t *const me
    }
 }
 
+
+
+/*******************************************************************************
+// Message Router Function Implementations
+*******************************************************************************/
+
+// Get the response cache counters
+void Lunar_MessageRouter_MessageRouter_GetCacheStatistics(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // Items from CacheStatistics_t
+      uint32_t numHits;
+      uint32_t numMisses;
+      // Number of cache entries holding a response
+      uint8_t numEntriesUsed;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   {
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      response->numHits = status.cacheStatistics.numHits;
+      response->numMisses = status.cacheStatistics.numMisses;
+      response->numEntriesUsed = 0U;
+
+      for (uint8_t i = 0U; i < (uint8_t)LUNAR_MESSAGEROUTER_CACHE_NUM_ENTRIES; i++)
+      {
+         if (status.cache[i].isValid)
+         {
+            response->numEntriesUsed++;
+         }
+      }
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+
+// Discard all cached responses
+void Lunar_MessageRouter_MessageRouter_ClearCache(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, 0))
+   {
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      ClearCache();
+   }
+}
+
+
+#if LUNAR_MESSAGEROUTER_METRICS_ENABLED
+// Get the number of commands and the unrouted message counters
+void Lunar_MessageRouter_MessageRouter_GetMetricsSummary(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // Items from Metrics_t
+      uint32_t numInvalidModuleID;
+      uint32_t numInvalidCommandID;
+      uint16_t numCommands;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   {
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      response->numInvalidModuleID = status.metrics.numInvalidModuleID;
+      response->numInvalidCommandID = status.metrics.numInvalidCommandID;
+      response->numCommands = status.metrics.numCommands;
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+
+// Get the metrics of the commands from a start index
+void Lunar_MessageRouter_MessageRouter_GetCommandMetrics(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the command
+   typedef struct
+   {
+      // Index of the first command, in command table order
+      uint16_t startIndex;
+   } Command_t;
+
+   // This structure defines the format of the metrics of one command
+   typedef struct
+   {
+      // Items from CommandMetrics_t
+      uint32_t numCalls;
+      uint32_t minCycles;
+      uint32_t maxCycles;
+      uint32_t averageCycles;
+      uint16_t responseCodeCounts[LUNAR_MESSAGEROUTER_RESPONSE_CODE_Count];
+      // The command the metrics belong to
+      uint8_t moduleID;
+      uint8_t commandID;
+   } Entry_t;
+
+   // This structure defines the format of the response.  It is followed by
+   // the entries of as many commands as fit in the response buffer.
+   typedef struct
+   {
+      // The index to request next, the number of commands once all were read
+      uint16_t nextIndex;
+      // The number of entries that follow
+      uint8_t numEntries;
+      // Keeps the entries aligned
+      uint8_t reserved;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   // and at least one entry
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), sizeof(Response_t) + sizeof(Entry_t)))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+      uint16_t metricsIndex = command->startIndex;
+
+      // Cast the response buffer as the response type, the entries follow it
+      Response_t *response = (Response_t *)message->responseParams.data;
+      Entry_t *entries = (Entry_t *)&message->responseParams.data[sizeof(Response_t)];
+      const uint32_t maxEntries = (message->responseParams.maxLength - sizeof(Response_t)) / sizeof(Entry_t);
+      uint8_t numEntries = 0U;
+      uint32_t moduleIndex = 0U;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      while ((metricsIndex < status.metrics.numCommands) && (numEntries < maxEntries))
+      {
+         const CommandMetrics_t *metrics = &status.metrics.commands[metricsIndex];
+         Entry_t *entry = &entries[numEntries];
+
+         // Find the module that owns the command, the modules are numbered in table order
+         while (metricsIndex >= (status.metrics.moduleMetricsIndex[moduleIndex] + messageRouterConfigTable[moduleIndex].numCommands))
+         {
+            moduleIndex++;
+         }
+
+         memset(entry, 0, sizeof(Entry_t));
+         entry->moduleID = messageRouterConfigTable[moduleIndex].moduleID;
+         entry->commandID = messageRouterConfigTable[moduleIndex].commandTable[metricsIndex - status.metrics.moduleMetricsIndex[moduleIndex]].commandID;
+         entry->numCalls = metrics->numCalls;
+
+         if (metrics->numCalls > 0U)
+         {
+            entry->minCycles = metrics->minCycles;
+            entry->maxCycles = metrics->maxCycles;
+            entry->averageCycles = (uint32_t)(metrics->totalCycles / metrics->numCalls);
+         }
+
+         memcpy(entry->responseCodeCounts, metrics->responseCodeCounts, sizeof(entry->responseCodeCounts));
+
+         numEntries++;
+         metricsIndex++;
+      }
+
+      response->nextIndex = metricsIndex;
+      response->numEntries = numEntries;
+      response->reserved = 0U;
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, (uint8_t)(sizeof(Response_t) + (numEntries * sizeof(Entry_t))));
+   }
+}
+
+
+// Reset all command metrics
+void Lunar_MessageRouter_MessageRouter_ResetMetrics(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, 0))
+   {
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      ResetMetrics();
+   }
+}
+#endif
@@ -24,6 +24,13 @@ extern "C"
 // Public Constant Definitions
 *******************************************************************************/
 
+// Command table cache setting for commands that must always call the handler
+// This is the default for command table items that do not specify a cache age
+#define LUNAR_MESSAGEROUTER_CACHE_NEVER (0U)
+
+// Command table cache setting for commands that always return the same response
+#define LUNAR_MESSAGEROUTER_CACHE_FOREVER (0xFFFFU)
+
 
 /*******************************************************************************
 // Public Type Declarations
@@ -52,11 +59,52 @@ typedef enum
    LUNAR_MESSAGEROUTER_RESPONSE_CODE_InvalidChecksum,
    // Internal Error
    LUNAR_MESSAGEROUTER_RESPONSE_CODE_InternalError,
+   // Command parameter value out of range
+   LUNAR_MESSAGEROUTER_RESPONSE_CODE_InvalidParameter,
    // Number of Response Codes
    LUNAR_MESSAGEROUTER_RESPONSE_CODE_Count
 } Lunar_MessageRouter_ResponseCode_t;
 
 
+//-----------------------------------------------
+// Transport Definitions
+//-----------------------------------------------
+
+/** This enumeration defines the transports that are able to deliver
+  * messages to the Message Router.  It is used to return responses
+  * (solicited or not) on the transport that originated a message.
+*/
+typedef enum
+{
+   // Message was generated internally by the firmware
+   LUNAR_MESSAGEROUTER_TRANSPORT_Internal,
+   // Message was received on a serial protocol port
+   LUNAR_MESSAGEROUTER_TRANSPORT_Serial,
+   // Message was received via the CAN driver
+   LUNAR_MESSAGEROUTER_TRANSPORT_CAN,
+   // Number of Transports
+   LUNAR_MESSAGEROUTER_TRANSPORT_Count
+} Lunar_MessageRouter_Transport_t;
+
+// This type defines the origin of a message
+typedef struct
+{
+   // Transport the message was received on
+   Lunar_MessageRouter_Transport_t transport;
+
+   // Transport-specific channel index (Ex. UART channel)
+   uint8_t channel;
+
+   // Transport-specific address of the sender (Ex. node ID in the CAN identifier), 0 if not used.
+   // On CAN these are the nodeIdMask bits of the route, which some routes use
+   // for other values (Ex. the block and frame numbers of firmware update data).
+   uint8_t address;
+
+   // Timebase_Drv_GetCycleCount value when the message was received
+   uint32_t timestamp;
+} Lunar_MessageRouter_MessageSource_t;
+
+
 //-----------------------------------------------
 // Message Definitions
 //-----------------------------------------------
@@ -102,8 +150,17 @@ typedef struct
 
    // The response for this message
    Lunar_MessageRouter_ResponseCode_t responseCode;
+
+   // The transport and channel that originated this message
+   Lunar_MessageRouter_MessageSource_t source;
 } Lunar_MessageRouter_Message_t;
 
+// This type defines a function pointer used by a transport to send a
+// complete message (header and response parameters) on the given channel.
+// It allows other modules to send unsolicited responses to the originator
+// of a message without knowing the details of the transport.
+typedef void (*Lunar_MessageRouter_TransportSend_t)(const uint8_t channel, Lunar_MessageRouter_Message_t *const message);
+
 
 //-----------------------------------------------
 // Command Table Definitions
@@ -114,6 +171,9 @@ typedef struct
 // Responses (if any) are expected to be set in the passed message structure before 
 // the handler completes.  The message router will handle packetizing the response
 // and sending the response to the sender.
+// Note that transports may use the same buffer for the command and response
+// parameters, so handlers must read all command parameters they need before
+// writing the response.
 typedef void (*Lunar_MessageRouter_MessageHandler_t)(Lunar_MessageRouter_Message_t *const message);
 
 // This is an item in the command table for a module.  This associates a
@@ -126,6 +186,14 @@ typedef struct
 
    // Message Handler Function
    const Lunar_MessageRouter_MessageHandler_t messageHandler;
+
+   /** Maximum age of a cached response in milliseconds.  A cached response is
+     * returned without calling the handler if it is younger than this age.
+     * Only commands without command parameters are cached.
+     * LUNAR_MESSAGEROUTER_CACHE_NEVER - Always call the handler
+     * LUNAR_MESSAGEROUTER_CACHE_FOREVER - Call the handler once (constant data)
+  */
+   uint16_t cacheMaxAgeMs;
 } Lunar_MessageRouter_CommandTableItem_t;
 
 
@@ -151,6 +219,15 @@ typedef struct
 // Public Function Declarations
 *******************************************************************************/
 
+/** Description:
+  *    This function initializes the Message Router, clears the response
+  *    cache and resets the command metrics.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_MessageRouter_Init(void);
+
 /** Description:
   *    This function accepts a Message Router populated with the complete
   *    Message information and a header for the Response.  This information is
@@ -279,6 +356,74 @@ bool Lunar_MessageRouter_VerifyParameterSizes(Lunar_MessageRouter_Message_t *con
 */
 void Lunar_MessageRouter_SetResponseSize(Lunar_MessageRouter_Message_t *const message, const uint8_t responseSize);
 
+/** Description:
+  *    This is the command handler used for reading the response cache hit and
+  *    miss counters.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_MessageRouter_MessageRouter_GetCacheStatistics(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This is the command handler used for discarding all cached responses
+  *    and resetting the cache counters.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_MessageRouter_MessageRouter_ClearCache(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This is the command handler used for reading the number of commands with
+  *    metrics and the counters for messages that could not be routed.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_MessageRouter_MessageRouter_GetMetricsSummary(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This is the command handler used for reading the metrics of the
+  *    commands from a start index.  Commands are numbered in the order of the
+  *    command tables.  The response holds as many commands as fit in the
+  *    response buffer and the index to request next, so all metrics are read
+  *    by requesting from index 0 until a response holds no commands.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *    * 10/19/2026: Returns the commands that fit from a start index (EJH)
+  *
+*/
+void Lunar_MessageRouter_MessageRouter_GetCommandMetrics(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This is the command handler used for resetting all command metrics.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_MessageRouter_MessageRouter_ResetMetrics(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
 
 #ifdef __cplusplus
 extern "C"
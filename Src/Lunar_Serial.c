@@ -10,7 +10,9 @@
 #include "Lunar_Serial.h"
 // Platform Includes
 #include "Lunar_CircularBufferLib.h"
+#include "Lunar_MessageBufferPool.h"
 #include "Lunar_MessageRouter.h"
+#include "Timebase_Drv.h"
 // Other Includes
 #include <stdbool.h>
 #include <stdint.h>
@@ -68,7 +70,8 @@
 #define COMMAND_HEADER_SIZE_HASCII (HEX_CHARS_PER_BYTE * COMMAND_HEADER_SIZE)
 
 // This defines the maximum length of command data in bytes.
-#define COMMAND_DATA_MAX_SIZE (48)
+// Commands are decoded directly into a message buffer pool block.
+#define COMMAND_DATA_MAX_SIZE (LUNAR_MESSAGEBUFFERPOOL_BLOCK_SIZE)
 
 /** This defines the maximum length of command data in
   * ASCII-coded hex.                                  
@@ -119,7 +122,8 @@
 #define RESPONSE_HEADER_SIZE_HASCII (HEX_CHARS_PER_BYTE * RESPONSE_HEADER_SIZE)
 
 // This defines the maximum length of response data in bytes
-#define RESPONSE_DATA_MAX_SIZE (48)
+// Responses are written in place in the message buffer pool block.
+#define RESPONSE_DATA_MAX_SIZE (LUNAR_MESSAGEBUFFERPOOL_BLOCK_SIZE)
 
 /** This defines the maximum length of response data in
   * ASCII-coded hex                                    
@@ -148,17 +152,23 @@
 // Private Type Declarations
 *******************************************************************************/
 
-// Structure to hold the ASCII hex data when retrieving a valid command from the
-// RX circular buffer
+// Structure to hold the state of the command being decoded from the RX circular
+// buffer.  The ASCII hex data is converted to binary as each character arrives.
 typedef struct
 {
    // Denotes if the start byte has been found while searching for a complete message
    bool isStartByteFound;
-   // Size of the data buffer
-   uint16_t dataBufferLen;
-   // Buffer used for storing the complete ASCII command during processing
-   uint8_t data[COMMAND_MAX_SIZE_HASCII];
-} ASCIICommandItem_t;
+   // Number of ASCII characters received since the start byte
+   uint16_t numCharactersReceived;
+   // Value of the high nibble while waiting for the second character of a byte
+   uint8_t highNibble;
+   // Decoded command header
+   uint8_t header[COMMAND_HEADER_SIZE];
+   // Message buffer pool block holding the decoded command data.
+   // The block is taken once the header is complete and held until the
+   // response has been sent or the command is thrown away.
+   uint8_t *block;
+} CommandDecoder_t;
 
 // Holds statistics on TX/RX data and messages
 // Note this structure needs to be packed properly since it is reused in the GetSerialStatistics method
@@ -188,19 +198,9 @@ typedef struct
    // destination software module.
    Lunar_MessageRouter_Message_t currentMessage;
 
-   // This buffer is allocated for command data and is pointed to by the
-   // command proc message structure.
-   uint8_t commandBuffer[COMMAND_DATA_MAX_SIZE];
-
-   // This buffer is allocated for response data and is pointed to by the
-   // command proc message structure.
-   uint8_t responseBuffer[RESPONSE_DATA_MAX_SIZE];
-
    // This is the information for assembling the next command as we
    // dequeue bytes from the UART driver
-   // The data in this buffer is ASCII data that must be converted to binary
-   // before sending on to the command processor.
-   ASCIICommandItem_t asciiCommand;
+   CommandDecoder_t decoder;
 
    /** The address for this device on this port For simplicity in
      * the driver, this initializes to BROADCAST_ADDRESS if
@@ -239,44 +239,49 @@ static Lunar_Serial_Status_t status;
   *    locate a complete message.
   * Parameters: 
   *    channel : The enumerated channel value for which this function will search for a command.
-  *    asciiCommand : The located command in ASCII format
+  *    decoder : The decoder state for the command. The header and data are
+  *              decoded to binary as they are received.
   * Returns: 
   *    bool: The result of the command search
   * Return Value List:
-  *    true: Command found and placed into the ASCII command buffer for
-  *    processing 
+  *    true: Command found and decoded for processing
   *    false: No command found
   * History:
   *    * 6/6/2021: Function created (EJH)
+  *    * 10/19/2026: Decode directly into a message buffer pool block (EJH)
   *                                                                 
 */
-static bool FindNextCommand(const UART_Drv_Channel_t channel, ASCIICommandItem_t *const asciiCommand);
+static bool FindNextCommand(const UART_Drv_Channel_t channel, CommandDecoder_t *const decoder);
 
 /** Description:
-  *    This function packetizes the given message response as ASCII-coded hex data and add the
-  *    data to the outgoing transmit buffer;
+  *    This function stores the next ASCII-coded hex character of a command in
+  *    the decoder.  Each pair of characters is converted to a byte and placed in
+  *    the header or the command data.
   * Parameters: 
-  *    channel : The enumerated channel value used for sending this message.
-  *    message : A pointer to the Message Router object defining the message to be sent.
+  *    decoder : The decoder state for the command
+  *    character : The received ASCII character
+  * Returns: 
+  *    bool: The result of storing the character
+  * Return Value List:
+  *    true: Character was stored
+  *    false: The command is too long to be stored
   * History:
-  *    * 6/6/2021: Function created (EJH)
+  *    * 10/19/2026: Function created (EJH)
   *                                                                 
 */
-static void SendResponseAsciiHex(const UART_Drv_Channel_t channel, Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+static bool DecodeCommandCharacter(CommandDecoder_t *const decoder, const uint8_t character) PLATFORM_NON_NULL;
 
 /** Description:
-  *    This function converts one or two ASCII-coded hex cahracters to a 16-bit
-  *    value.
+  *    This function packetizes the given message response as ASCII-coded hex data and add the
+  *    data to the outgoing transmit buffer;
   * Parameters: 
-  *    hexCharacters    : pointer to the buffer of ASCII character to be converted.
-  *    numHexCharacters : The number of characters in the given buffer.
-  * Returns: 
-  *    uint16_t: The converted numeric value of the given ASCII-coded hex value.
+  *    channel : The enumerated channel value used for sending this message.
+  *    message : A pointer to the Message Router object defining the message to be sent.
   * History:
   *    * 6/6/2021: Function created (EJH)
   *                                                                 
 */
-static uint16_t ConvertAsciiHexStringToNumeric(const uint8_t *const hexCharacters, const uint8_t numHexCharacters);
+static void SendResponseAsciiHex(const UART_Drv_Channel_t channel, Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
 
 /** Description:
   *    This function takes a character '0' - 'F' and converts it to its hex equivalent 
@@ -311,13 +316,13 @@ static void ConvertNumericToAsciiHexString(uint8_t *const destinationBuffer, con
 *******************************************************************************/
 
 // Search circular buffer for the next command
-static bool FindNextCommand(const UART_Drv_Channel_t channel, ASCIICommandItem_t *const asciiCommand)
+static bool FindNextCommand(const UART_Drv_Channel_t channel, CommandDecoder_t *const decoder)
 {
    // Start with no command found
    bool wasCommandFound = false;
 
    // Verify the channel is valid
-   if ((asciiCommand != 0) && (channel < UART_DRV_CHANNEL_Count))
+   if ((decoder != 0) && (channel < UART_DRV_CHANNEL_Count))
    {
       // Init to null char
       uint8_t tmpByte = 0U;
@@ -332,36 +337,39 @@ static bool FindNextCommand(const UART_Drv_Channel_t channel, ASCIICommandItem_t
          // See if the current byte is a command "Start" byte.
          if (tmpByte == COMMAND_START_BYTE)
          {
+            // If the start byte of the next message is received before the stop
+            // byte of the previous message, then the previous message is ignored
+            // and its block is returned to the pool.
+            Lunar_MessageBufferPool_Release(decoder->block);
+            decoder->block = 0;
+
             // Store the flag so if the buffer only contains the first half of the
             // message, we will continue next time.
-            asciiCommand->isStartByteFound = true;
-            // Always reset the size when a start byte is found.  If
-            // the start byte of the next message is received before
-            // the stop byte of the previous message, then the previous
-            // message will be ignored.
-            asciiCommand->dataBufferLen = 0;
+            decoder->isStartByteFound = true;
+            // Always reset the size when a start byte is found.
+            decoder->numCharactersReceived = 0U;
          }
          else if ((tmpByte == COMMAND_STOP_BYTE_1) || (tmpByte == COMMAND_STOP_BYTE_2))
          {
-            // Complete command found: clear start byte flag
-            asciiCommand->isStartByteFound = false;
-            // Mark that we have found a command (which will exit the loop)
-            wasCommandFound = true;
-         }
-         else if (asciiCommand->isStartByteFound)
-         {
-            // If we have room for the next byte of the command...
-            if (asciiCommand->dataBufferLen < (uint16_t)COMMAND_MAX_SIZE_HASCII)
+            // Only a stop byte following a start byte completes a command
+            if (decoder->isStartByteFound)
             {
-               // Add byte to command buffer and increment size
-               asciiCommand->data[asciiCommand->dataBufferLen++] = tmpByte;
+               // Complete command found: clear start byte flag
+               decoder->isStartByteFound = false;
+               // Mark that we have found a command (which will exit the loop)
+               wasCommandFound = true;
             }
-            // Otherwise, clear the command buffer and send an error...
-            else
+         }
+         else if (decoder->isStartByteFound)
+         {
+            // Decode the character, if we have room for it
+            if (!DecodeCommandCharacter(decoder, tmpByte))
             {
-               // Reset command buffer
-               asciiCommand->isStartByteFound = false;
-               asciiCommand->dataBufferLen = 0;
+               // Otherwise, throw away the command and return its block to the pool
+               decoder->isStartByteFound = false;
+               decoder->numCharactersReceived = 0U;
+               Lunar_MessageBufferPool_Release(decoder->block);
+               decoder->block = 0;
             }
          }
          // else, byte is not part of a valid message.  Throw it away
@@ -372,6 +380,59 @@ static bool FindNextCommand(const UART_Drv_Channel_t channel, ASCIICommandItem_t
 }
 
 
+// Decode the next ASCII-coded hex character of a command
+static bool DecodeCommandCharacter(CommandDecoder_t *const decoder, const uint8_t character)
+{
+   // Assume the command is too long
+   bool wasStored = false;
+
+   // Make sure there is room for the next character
+   if (decoder->numCharactersReceived < (uint16_t)COMMAND_MAX_SIZE_HASCII)
+   {
+      // Convert the character from ASCII
+      uint8_t nibble = ConvertAsciiHexCharToNumeric(character);
+
+      if ((decoder->numCharactersReceived % HEX_CHARS_PER_BYTE) == 0U)
+      {
+         // First character of a byte is the high nibble, wait for the second character
+         decoder->highNibble = nibble;
+      }
+      else
+      {
+         // Second character completes the byte
+         uint8_t value = (uint8_t)((decoder->highNibble << 4U) | nibble);
+         uint16_t byteIndex = decoder->numCharactersReceived / HEX_CHARS_PER_BYTE;
+
+         if (byteIndex < COMMAND_HEADER_SIZE)
+         {
+            // Still receiving the header
+            decoder->header[byteIndex] = value;
+
+            // A block is only taken once the header is complete, so start bytes in
+            // idle or garbage traffic do not hold blocks from the pool
+            if (byteIndex == (COMMAND_HEADER_SIZE - 1U))
+            {
+               decoder->block = Lunar_MessageBufferPool_Allocate();
+            }
+         }
+         else if ((byteIndex - COMMAND_HEADER_SIZE) < COMMAND_DATA_MAX_SIZE)
+         {
+            // Command data is decoded directly into the block
+            decoder->block[byteIndex - COMMAND_HEADER_SIZE] = value;
+         }
+         // else, footer (CRC) bytes are not stored
+      }
+
+      decoder->numCharactersReceived++;
+
+      // If no block is available for a complete header, the command is dropped
+      wasStored = ((decoder->block != 0) || (decoder->numCharactersReceived < (uint16_t)COMMAND_HEADER_SIZE_HASCII));
+   }
+
+   return(wasStored);
+}
+
+
 // Send message response using hex encoding
 static void SendResponseAsciiHex(const UART_Drv_Channel_t channel, Lunar_MessageRouter_Message_t *const message)
 {
@@ -416,56 +477,6 @@ static void SendResponseAsciiHex(const UART_Drv_Channel_t channel, Lunar_Message
 }
 
 
-// Convert a series of ASCII-coded hex values to a single 16-bit numeric value
-static uint16_t ConvertAsciiHexStringToNumeric(const uint8_t *const hexCharacters, const uint8_t numHexCharacters)
-{
-   // Default to 0 result
-   uint16_t resultValue = 0U;
-   uint8_t tmpByte = '0';
-   const uint8_t *nextByte;
-
-   // Check for NULL pointer.  If it is NULL return 0 for the hex value.
-   if (hexCharacters != 0)
-   {
-      // Point to the beginning of the data
-      nextByte = hexCharacters;
-
-      // Since this returns a uint16_t, we can only convert a maximum
-      // of 4 characters.  If a length > 4 is specified, only do the
-      // first 4 characters.
-      uint8_t tmpNumHexCharacters = numHexCharacters;
-
-      if (tmpNumHexCharacters > 4)
-      {
-         tmpNumHexCharacters = 4;
-      }
-
-      // Number of bits to shift
-      uint8_t shiftValue = 0U;
-
-      // Loop through each character
-      // Use 1-based indexing
-      for (uint8_t i = 1U; i <= tmpNumHexCharacters; i++)
-      {
-         // Convert next ASCII character to its HEX equivalent
-         tmpByte = ConvertAsciiHexCharToNumeric(*nextByte);
-
-         // We need to shift the HEX character to it's correct position:
-         // (i.e.) 7 in 0xF7FF must be shifted left 8 positions from zero
-         // to be in the right spot.
-         shiftValue = 4 * (tmpNumHexCharacters - i);
-         resultValue += ((uint16_t)tmpByte) << shiftValue;
-
-         // Move to the next byte for the next pass through loop
-         nextByte++;
-      }
-   }
-
-   // Finally, return the converted value
-   return(resultValue);
-}
-
-
 // Convert ASCII-coded hex value to 8-bit numeric representation
 static uint8_t ConvertAsciiHexCharToNumeric(const uint8_t charToConvert)
 {
@@ -585,11 +596,11 @@ void Lunar_Serial_Update(void)
       //-----------------------------------------------
       // Process RX Data
       //-----------------------------------------------
-      // Store the command object for easy access
-      ASCIICommandItem_t *asciiCommand = &(status.portData[channel].asciiCommand);
+      // Store the decoder object for easy access
+      CommandDecoder_t *const decoder = &(status.portData[channel].decoder);
 
       // Look for a valid command in the circular RX buffer
-      if (FindNextCommand((UART_Drv_Channel_t)channel, asciiCommand))
+      if (FindNextCommand((UART_Drv_Channel_t)channel, decoder))
       {
          // A complete command was received, now we need to populate the standard
          // message structure with the data in this command.
@@ -598,13 +609,19 @@ void Lunar_Serial_Update(void)
          Lunar_MessageRouter_Message_t *const message = &(status.portData[channel].currentMessage);
 
          // Make sure the length of the command is at least long enough to
-         // contain a complete HASCII command header.  The data in the Next Command
-         // buffer is HASCII, so compare it to the HASCII length of the command header.
-         if (asciiCommand->dataBufferLen >= ((uint16_t)COMMAND_HEADER_SIZE_HASCII + (uint16_t)COMMAND_FOOTER_SIZE_HASCII))
+         // contain a complete HASCII command header.  The count of received
+         // characters is HASCII, so compare it to the HASCII length of the command header.
+         if (decoder->numCharactersReceived >= ((uint16_t)COMMAND_HEADER_SIZE_HASCII + (uint16_t)COMMAND_FOOTER_SIZE_HASCII))
          {
             // Init the message to no error
             status.portData[channel].currentMessage.responseCode = LUNAR_MESSAGEROUTER_RESPONSE_CODE_None;
 
+            // Note where the message came from so that handlers can reply on the same port
+            message->source.transport = LUNAR_MESSAGEROUTER_TRANSPORT_Serial;
+            message->source.channel = channel;
+            message->source.address = 0U;
+            message->source.timestamp = Timebase_Drv_GetCycleCount();
+
             //-----------------------------------------------
             // Parse Header
             //-----------------------------------------------
@@ -614,16 +631,14 @@ void Lunar_Serial_Update(void)
 
             // We start at the first byte
             uint8_t tmpIndex = (uint8_t)0U;
-            // 2 hex character per byte
-            uint8_t tmpCharacterCount = (uint8_t)HEX_CHARS_PER_BYTE;
 
 #if (NUM_ADDRESS_BYTES > 0)
             // Extract the Destination Address
             // Note size has been verified above to be at least Address +  Message Header + Data Length
-            uint8_t destinationAddress = (uint8_t)AsciiToHex(&(asciiCommand->data[tmpIndex]), tmpCharacterCount);
+            uint8_t destinationAddress = decoder->header[tmpIndex];
 
             // Move to the next byte
-            tmpIndex += tmpCharacterCount;
+            tmpIndex += NUM_ADDRESS_BYTES;
 #else
 
             // Addressing is not used, just set address to the broadcast address (0xFF)
@@ -637,37 +652,21 @@ void Lunar_Serial_Update(void)
                // Extract everything and verify the CRC
 
                // This message is for us, continue and extract the Module ID
-               message->header.moduleID = (uint8_t)ConvertAsciiHexStringToNumeric(&(asciiCommand->data[tmpIndex]), tmpCharacterCount);
+               message->header.moduleID = decoder->header[tmpIndex++];
 
                // Move to the next byte for CMD ID
-               tmpIndex += tmpCharacterCount;
-               message->header.commandID = (uint8_t)ConvertAsciiHexStringToNumeric(&(asciiCommand->data[tmpIndex]), tmpCharacterCount);
+               message->header.commandID = decoder->header[tmpIndex++];
 
                // Move to the next byte for MSG ID
-               tmpIndex += tmpCharacterCount;
-               message->header.messageID = (uint8_t)ConvertAsciiHexStringToNumeric(&(asciiCommand->data[tmpIndex]), tmpCharacterCount);
-
-               //-----------------------------------------------
-               // Initialize Command Buffer
-               //-----------------------------------------------
-
-               // Move to the next byte for DATA LENGTH
-               tmpIndex += tmpCharacterCount;
-               // Assign the command buffer
-               message->commandParams.data = status.portData[channel].commandBuffer;
-               // Set the max size to prevent other modules from overwriting the bounds of the data buffer.
-               message->commandParams.maxLength = (uint8_t)COMMAND_DATA_MAX_SIZE;
-               // Get the length byte
-               message->commandParams.length = (uint8_t)ConvertAsciiHexStringToNumeric(&(asciiCommand->data[tmpIndex]), tmpCharacterCount);
+               message->header.messageID = decoder->header[tmpIndex++];
 
                //-----------------------------------------------
-               // Initialize Response Buffer
+               // Initialize Command and Response Buffers
                //-----------------------------------------------
 
-               // Setup the buffer for the response
-               message->responseParams.data = status.portData[channel].responseBuffer;
-               message->responseParams.maxLength = (uint8_t)RESPONSE_DATA_MAX_SIZE;
-               message->responseParams.length = 0U;
+               // The command data was decoded into the block and the response is written
+               // in place.  The length byte is the last byte of the header.
+               Lunar_MessageBufferPool_AttachMessage(message, decoder->block, decoder->header[tmpIndex]);
 
                //-----------------------------------------------
                // Process Command
@@ -679,37 +678,17 @@ void Lunar_Serial_Update(void)
                // Verify the length
                // The length in the command buffer is what was specified in the command
                // and represents the number of hex bytes are in the data field after converting
-               // from HASCII.  The sNextCommand buffer is still in HASCII, so we need to
+               // from HASCII.  The received character count is still in HASCII, so we need to
                // convert the length in the command buffer to HASCII by multiplying by 2.
-               if (asciiCommand->dataBufferLen == (COMMAND_HEADER_SIZE_HASCII + (HEX_CHARS_PER_BYTE * message->commandParams.length) + COMMAND_FOOTER_SIZE_HASCII))
+               if (decoder->numCharactersReceived == (COMMAND_HEADER_SIZE_HASCII + (HEX_CHARS_PER_BYTE * message->commandParams.length) + COMMAND_FOOTER_SIZE_HASCII))
                {
                   // Length is correct.
-                  // Now ensure the length is within the bounds of the data buffer
-                  // before we convert the HASCII bytes to binary and copy them to the
-                  // buffer.  This will prevent buffer overflow.
-                  if (message->commandParams.length <= message->commandParams.maxLength)
-                  {
-                     // Convert each byte in the data field from HASCII to hex.
-                     for (uint8_t i = 0U; i < message->commandParams.length; i++)
-                     {
-                        // Convert the next data byte from HASCII to hex and store in
-                        // the command data buffer.
-                        status.portData[channel].commandBuffer[i] = (uint8_t)ConvertAsciiHexStringToNumeric(&(asciiCommand->data[(uint8_t)COMMAND_HEADER_SIZE_HASCII + HEX_CHARS_PER_BYTE * i]), HEX_CHARS_PER_BYTE);
-                     }
-
-                     // Process message
-                     Lunar_MessageRouter_ProcessMessage(message);
-                     // Increment the number of messages sent
-                     // Send the response out the serial port.
-                     SendResponseAsciiHex((UART_Drv_Channel_t)channel, message);
-                  }
-                  else
-                  {
-                     // The specified length is longer than our available command buffer size.
-                     // Do not process this command, just send a response with the same
-                     // header, with a length of 0 and no data.
-                     SendResponseAsciiHex((UART_Drv_Channel_t)channel, message);
-                  }
+                  // Note that the command length cannot exceed the bounds of the
+                  // block since the decoder limits the number of characters received.
+                  // Process message
+                  Lunar_MessageRouter_ProcessMessage(message);
+                  // Send the response out the serial port.
+                  SendResponseAsciiHex((UART_Drv_Channel_t)channel, message);
                }
                else
                {
@@ -721,8 +700,10 @@ void Lunar_Serial_Update(void)
             }
          }
 
-         // Command has been processed, remove it.
-         asciiCommand->dataBufferLen = 0U;
+         // Command has been processed, return the block to the pool.
+         Lunar_MessageBufferPool_Release(decoder->block);
+         decoder->block = 0;
+         decoder->numCharactersReceived = 0U;
       }
    }
 }
@@ -783,6 +764,14 @@ void Lunar_Serial_Send(const UART_Drv_Channel_t channel, uint8_t *const data, co
 }
 
 
+// Send a complete message on the given port
+void Lunar_Serial_SendMessage(const uint8_t channel, Lunar_MessageRouter_Message_t *const message)
+{
+   // Channel and message are verified when the response is packetized
+   SendResponseAsciiHex((UART_Drv_Channel_t)channel, message);
+}
+
+
 // Message Router function to reutrn statistics
 void Lunar_Serial_MessageRouter_GetSerialStatistics(Lunar_MessageRouter_Message_t *const message)
 {
@@ -826,11 +815,17 @@ void Lunar_Serial_MessageRouter_GetSerialStatistics(Lunar_MessageRouter_Message_
       // Execute Command
       //-----------------------------------------------
 
+      // Read the channel before the response is written over the command
+      uint8_t channelIndex = command->channelIndex;
+
+      // Statistics are zero for an invalid channel
+      memset(response, 0, sizeof(Response_t));
+
       // Verify the index is valid
-      if (command->channelIndex < UART_DRV_CHANNEL_Count)
+      if (channelIndex < UART_DRV_CHANNEL_Count)
       {
          // Port is valid, store the statistics object for easy access
-         TxRxStatistics_t *tmpStatistics = &(status.portData[command->channelIndex].statistics);
+         TxRxStatistics_t *tmpStatistics = &(status.portData[channelIndex].statistics);
 
          // Just store each of the items for the given port
          response->numBytesSent = tmpStatistics->numBytesSent;
@@ -96,6 +96,20 @@ void Lunar_Serial_ResetStats(const UART_Drv_Channel_t channel);
 */
 void Lunar_Serial_Send(const UART_Drv_Channel_t channel, uint8_t *const data, const uint8_t dataLength, const Lunar_Serial_Encoding_t encoding) PLATFORM_NON_NULL;
 
+/** Description:
+  *    This function packetizes the given message and places it in the transmit
+  *    buffer of the given port using the same format as a response to a
+  *    received command.  This allows other modules to send unsolicited
+  *    responses (Ex. subscriptions) to a host connected to the port.
+  * Parameters:
+  *    channel - The configured UART channel index used to send the message
+  *    message - A pointer to the Message Router object to be sent
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_Serial_SendMessage(const uint8_t channel, Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
 /** Description:
   *    This is the command handler used for querying serial TX/RX statistics for
   *    a given port. 
@@ -0,0 +1,705 @@
+/*******************************************************************************
+// Core Subscription Manager Module
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Lunar_SubscriptionMgr.h"
+#include "Lunar_SubscriptionMgr_Config.h"
+#include "Lunar_SubscriptionMgr_ConfigTable.h"
+// Platform Includes
+#include "Lunar_MathLib.h"
+#include "Lunar_MessageBufferPool.h"
+#include "Lunar_MessageRouter.h"
+#include "Lunar_SoftTimerLib.h"
+#include "Timebase_Drv.h"
+// Other Includes
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The total number of transports that are able to receive subscription responses
+#define NUM_SUBSCRIPTIONMGR_TRANSPORTS (sizeof(Lunar_SubscriptionMgr_transportConfigTable)/sizeof(Lunar_SubscriptionMgr_TransportConfigItem_t))
+
+// Number of bytes counted against the bandwidth cap for each response in
+// addition to the response data (Module ID, Command ID, Message ID, Length)
+#define RESPONSE_OVERHEAD_SIZE (sizeof(Lunar_MessageRouter_MessageItemHeader_t) + 1U)
+
+// The bandwidth credit is kept in thousandths of a byte so that it may be
+// refilled from the elapsed milliseconds without division
+#define BANDWIDTH_CREDIT_PER_BYTE (1000U)
+
+// The maximum bandwidth credit that may be accumulated while idle
+#define BANDWIDTH_CREDIT_MAX (LUNAR_SUBSCRIPTIONMGR_BANDWIDTH_BURST_BYTES * BANDWIDTH_CREDIT_PER_BYTE)
+
+// Elapsed time is limited when refilling credit to prevent overflow after a long delay
+#define BANDWIDTH_MAX_REFILL_MS (1000U)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// This structure holds a single entry in the subscription table
+typedef struct
+{
+   // Denotes if this entry holds an active subscription
+   bool inUse;
+
+   // Denotes if the subscription only sends changed responses
+   bool isOnChange;
+
+   // Denotes if a response has been sent since the subscription was created
+   bool hasSentResponse;
+
+   // Number of bytes in the command parameters
+   uint8_t commandLength;
+
+   // Transport and channel that will receive the responses
+   Lunar_MessageRouter_MessageSource_t source;
+
+   // Module and command executed for this subscription
+   Lunar_MessageRouter_MessageItemHeader_t header;
+
+   // Parameters passed to the handler each time it is executed
+   uint8_t commandParams[LUNAR_SUBSCRIPTIONMGR_MAX_COMMAND_SIZE];
+
+   // Checksum of the last response sent, used for on-change subscriptions
+   uint16_t lastResponseChecksum;
+
+   // Milliseconds between executions of the handler
+   uint16_t intervalMs;
+
+   // Timer used to determine when the subscription is due
+   Lunar_SoftTimerLib_Timer_t timer;
+} Subscription_t;
+
+// Holds statistics on the responses generated by subscriptions
+// Note this structure needs to be packed properly since it is reused in the GetStatistics method
+typedef struct
+{
+   // Number of responses sent to subscribers
+   uint32_t numResponsesSent;
+   // Number of on-change responses that were not sent since nothing changed
+   uint32_t numResponsesSuppressed;
+   // Number of times a response was delayed due to the bandwidth cap
+   uint32_t numResponsesThrottled;
+} Statistics_t;
+
+// This structure holds the private information for this module
+typedef struct
+{
+   // Table of subscriptions
+   Subscription_t subscriptions[LUNAR_SUBSCRIPTIONMGR_MAX_SUBSCRIPTIONS];
+
+   // Message object used when executing subscriptions
+   Lunar_MessageRouter_Message_t message;
+
+   // Index of the subscription that is serviced first during the next update
+   // This prevents a subscription from starving the others when throttled.
+   uint8_t nextSubscriptionIndex;
+
+   // Bandwidth available for responses, see BANDWIDTH_CREDIT_PER_BYTE
+   uint32_t bandwidthCredit;
+
+   // Timer used to measure the time since the bandwidth credit was refilled
+   Lunar_SoftTimerLib_Timer_t bandwidthTimer;
+
+   // Response statistics
+   Statistics_t statistics;
+} Lunar_SubscriptionMgr_Status_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The variable used for holding all internal data for this module.
+static Lunar_SubscriptionMgr_Status_t status;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function searches the transport table for the given transport.
+  * Parameters:
+  *    transport :  The transport to be found
+  * Returns:
+  *    const Lunar_SubscriptionMgr_TransportConfigItem_t * - The transport
+  *    table entry or NULL if the transport cannot send subscription responses
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static const Lunar_SubscriptionMgr_TransportConfigItem_t *FindTransport(const Lunar_MessageRouter_Transport_t transport);
+
+/** Description:
+  *    This function checks if a subscription was created from the given
+  *    transport and channel.
+  * Parameters:
+  *    subscription :  The subscription to be checked
+  *    source :        The transport and channel to be compared
+  * Returns:
+  *    bool - true if the subscription belongs to the source
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool IsOwner(const Subscription_t *const subscription, const Lunar_MessageRouter_MessageSource_t *const source) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function adds the bandwidth credit earned since the last refill,
+  *    limited to the configured burst size.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void RefillBandwidthCredit(void);
+
+/** Description:
+  *    This function executes the handler for the given subscription via the
+  *    Message Router.  The response is placed in the status message object.
+  * Parameters:
+  *    subscription :  The subscription to be executed
+  *    block :         Message buffer pool block used for the command and response
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void ExecuteSubscription(const Subscription_t *const subscription, uint8_t *const block) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function calculates a Fletcher-16 checksum of the response in the
+  *    status message object, including the response code and length.
+  * Returns:
+  *    uint16_t - The calculated checksum
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint16_t CalculateResponseChecksum(void);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Find the transport table entry for the given transport
+static const Lunar_SubscriptionMgr_TransportConfigItem_t *FindTransport(const Lunar_MessageRouter_Transport_t transport)
+{
+   // Assume not found
+   const Lunar_SubscriptionMgr_TransportConfigItem_t *transportConfig = 0;
+
+   // Loop through the transport table
+   for (uint8_t i = 0U; i < NUM_SUBSCRIPTIONMGR_TRANSPORTS; i++)
+   {
+      if ((Lunar_SubscriptionMgr_transportConfigTable[i].transport == transport) && (Lunar_SubscriptionMgr_transportConfigTable[i].sendMessage != 0))
+      {
+         // Found it, exit the loop
+         transportConfig = &Lunar_SubscriptionMgr_transportConfigTable[i];
+         break;
+      }
+   }
+
+   return(transportConfig);
+}
+
+// Check if the subscription was created from the source
+static bool IsOwner(const Subscription_t *const subscription, const Lunar_MessageRouter_MessageSource_t *const source)
+{
+   return((subscription->source.transport == source->transport) && (subscription->source.channel == source->channel));
+}
+
+
+// Add the bandwidth credit earned since the last refill
+static void RefillBandwidthCredit(void)
+{
+   // Determine how much time has passed since the last refill
+   uint32_t elapsedMs = Lunar_SoftTimerLib_GetElapsedTimeMilliseconds(&status.bandwidthTimer);
+
+   // Only restart the measurement once time has passed so that partial milliseconds are not lost
+   if (elapsedMs > 0U)
+   {
+      Lunar_SoftTimerLib_StartTimerMeasurement(&status.bandwidthTimer);
+
+      // Limit the refill to prevent overflow; the credit is capped at the burst size anyway
+      elapsedMs = PLATFORM_MIN(elapsedMs, BANDWIDTH_MAX_REFILL_MS);
+
+      // Bytes per second is equivalent to thousandths of a byte per millisecond
+      status.bandwidthCredit = Lunar_MathLib_AddSaturateUint32(status.bandwidthCredit, elapsedMs * LUNAR_SUBSCRIPTIONMGR_BANDWIDTH_BYTES_PER_SECOND);
+      status.bandwidthCredit = PLATFORM_MIN(status.bandwidthCredit, BANDWIDTH_CREDIT_MAX);
+   }
+}
+
+
+// Execute the handler for the given subscription
+static void ExecuteSubscription(const Subscription_t *const subscription, uint8_t *const block)
+{
+   // Store the message object for easy access
+   Lunar_MessageRouter_Message_t *const message = &status.message;
+
+   // Responses use the header given when the subscription was created
+   message->header = subscription->header;
+   message->responseCode = LUNAR_MESSAGEROUTER_RESPONSE_CODE_None;
+
+   // The subscription is executed by this module rather than a transport
+   message->source.transport = LUNAR_MESSAGEROUTER_TRANSPORT_Internal;
+   message->source.channel = 0U;
+   message->source.address = 0U;
+   message->source.timestamp = Timebase_Drv_GetCycleCount();
+
+   // Copy the parameters to the block since the response is written in place
+   memcpy(block, subscription->commandParams, subscription->commandLength);
+   Lunar_MessageBufferPool_AttachMessage(message, block, subscription->commandLength);
+
+   // Process message
+   Lunar_MessageRouter_ProcessMessage(message);
+}
+
+
+// Calculate the checksum of the current response
+static uint16_t CalculateResponseChecksum(void)
+{
+   // Fletcher-16 sums
+   uint16_t sum1 = (uint16_t)status.message.responseCode;
+   uint16_t sum2 = sum1;
+
+   // Include the length so that a shortened response is detected as a change
+   sum1 = (sum1 + status.message.responseParams.length) % 255U;
+   sum2 = (sum2 + sum1) % 255U;
+
+   // Add each byte of the response
+   for (uint8_t i = 0U; i < status.message.responseParams.length; i++)
+   {
+      sum1 = (sum1 + status.message.responseParams.data[i]) % 255U;
+      sum2 = (sum2 + sum1) % 255U;
+   }
+
+   return((uint16_t)((sum2 << 8U) | sum1));
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Initialize the Subscription Manager
+void Lunar_SubscriptionMgr_Init(void)
+{
+   // Clear all subscriptions and statistics
+   memset(&status, 0, sizeof(status));
+
+   // Start with a full bucket so that the first responses are not delayed
+   status.bandwidthCredit = BANDWIDTH_CREDIT_MAX;
+   Lunar_SoftTimerLib_Init(&status.bandwidthTimer);
+   Lunar_SoftTimerLib_StartTimerMeasurement(&status.bandwidthTimer);
+}
+
+
+// Scheduled update loop for executing subscriptions
+void Lunar_SubscriptionMgr_Update(void)
+{
+   // Add the credit earned since the last update
+   RefillBandwidthCredit();
+
+   // The next subscription is updated as responses are sent, so the loop works from a copy
+   const uint8_t firstSubscriptionIndex = status.nextSubscriptionIndex;
+
+   // Loop through each subscription, starting after the last one serviced
+   for (uint8_t count = 0U; count < (uint8_t)LUNAR_SUBSCRIPTIONMGR_MAX_SUBSCRIPTIONS; count++)
+   {
+      uint8_t subscriptionIndex = (uint8_t)((firstSubscriptionIndex + count) % LUNAR_SUBSCRIPTIONMGR_MAX_SUBSCRIPTIONS);
+      Subscription_t *const subscription = &status.subscriptions[subscriptionIndex];
+
+      // Only execute active subscriptions that are due
+      if ((subscription->inUse) && (Lunar_SoftTimerLib_IsTimerExpired(&subscription->timer)))
+      {
+         // Get a block for the command and response
+         uint8_t *const block = Lunar_MessageBufferPool_Allocate();
+
+         if (block == 0)
+         {
+            // No blocks available, service this subscription first during the next update
+            status.nextSubscriptionIndex = subscriptionIndex;
+            break;
+         }
+
+         // Run the handler to generate the response
+         ExecuteSubscription(subscription, block);
+
+         // Determine if an on-change subscription has anything new to send
+         uint16_t checksum = CalculateResponseChecksum();
+
+         if ((subscription->isOnChange) && (subscription->hasSentResponse) && (checksum == subscription->lastResponseChecksum))
+         {
+            // Nothing changed, check again after the minimum interval
+            status.statistics.numResponsesSuppressed++;
+            Lunar_SoftTimerLib_StartTimer(&subscription->timer, subscription->intervalMs);
+         }
+         else
+         {
+            // Determine the cost of the response against the bandwidth cap
+            uint32_t responseCost = ((uint32_t)RESPONSE_OVERHEAD_SIZE + status.message.responseParams.length) * BANDWIDTH_CREDIT_PER_BYTE;
+
+            if (responseCost > status.bandwidthCredit)
+            {
+               // No bandwidth is left for this update.  The timer is left expired so that
+               // this subscription is serviced first once credit is available.
+               status.statistics.numResponsesThrottled++;
+               status.nextSubscriptionIndex = subscriptionIndex;
+               Lunar_MessageBufferPool_Release(block);
+               break;
+            }
+
+            // Send the response on the transport that created the subscription
+            const Lunar_SubscriptionMgr_TransportConfigItem_t *transportConfig = FindTransport(subscription->source.transport);
+
+            if (transportConfig != 0)
+            {
+               transportConfig->sendMessage(subscription->source.channel, &status.message);
+            }
+
+            // Note the response that was sent
+            status.bandwidthCredit -= responseCost;
+            status.statistics.numResponsesSent++;
+            subscription->lastResponseChecksum = checksum;
+            subscription->hasSentResponse = true;
+
+            // Wait for the next period
+            Lunar_SoftTimerLib_StartTimer(&subscription->timer, subscription->intervalMs);
+
+            // Service the next subscription first during the next update
+            status.nextSubscriptionIndex = (uint8_t)((subscriptionIndex + 1U) % LUNAR_SUBSCRIPTIONMGR_MAX_SUBSCRIPTIONS);
+         }
+
+         // The response has been sent, return the block to the pool
+         Lunar_MessageBufferPool_Release(block);
+      }
+   }
+}
+
+
+// Add or update a subscription
+uint8_t Lunar_SubscriptionMgr_Subscribe(const Lunar_MessageRouter_MessageSource_t *const source, const Lunar_MessageRouter_MessageItemHeader_t *const header, const uint16_t periodMs, const uint16_t minIntervalMs, const uint8_t *const commandParams, const uint8_t commandLength)
+{
+   // Assume the subscription is rejected
+   uint8_t subscriptionIndex = LUNAR_SUBSCRIPTIONMGR_INVALID_INDEX;
+
+   // Verify the parameters and make sure responses can be sent to the source
+   if ((source != 0) && (header != 0) && (commandLength <= (uint8_t)LUNAR_SUBSCRIPTIONMGR_MAX_COMMAND_SIZE) &&
+       ((commandParams != 0) || (commandLength == 0U)) && (FindTransport(source->transport) != 0))
+   {
+      // Look for an existing subscription for the same command, otherwise use the first free entry
+      for (uint8_t i = 0U; i < (uint8_t)LUNAR_SUBSCRIPTIONMGR_MAX_SUBSCRIPTIONS; i++)
+      {
+         const Subscription_t *const subscription = &status.subscriptions[i];
+
+         if (subscription->inUse)
+         {
+            if ((IsOwner(subscription, source)) &&
+                (subscription->header.moduleID == header->moduleID) && (subscription->header.commandID == header->commandID) &&
+                (subscription->commandLength == commandLength) && ((commandLength == 0U) || (memcmp(subscription->commandParams, commandParams, commandLength) == 0)))
+            {
+               // Existing subscription found, no need to keep looking
+               subscriptionIndex = i;
+               break;
+            }
+         }
+         else if (subscriptionIndex == LUNAR_SUBSCRIPTIONMGR_INVALID_INDEX)
+         {
+            // Remember the first free entry
+            subscriptionIndex = i;
+         }
+      }
+
+      // See if an entry is available
+      if (subscriptionIndex != LUNAR_SUBSCRIPTIONMGR_INVALID_INDEX)
+      {
+         Subscription_t *const subscription = &status.subscriptions[subscriptionIndex];
+
+         // Store the subscription
+         subscription->source = *source;
+         subscription->header = *header;
+         subscription->commandLength = commandLength;
+
+         if (commandLength > 0U)
+         {
+            memcpy(subscription->commandParams, commandParams, commandLength);
+         }
+
+         // Periodic subscriptions are rate limited by the larger of the period and the minimum interval
+         subscription->isOnChange = (periodMs == LUNAR_SUBSCRIPTIONMGR_PERIOD_ON_CHANGE);
+         subscription->intervalMs = PLATFORM_MAX(PLATFORM_MAX(periodMs, minIntervalMs), (uint16_t)LUNAR_SUBSCRIPTIONMGR_MIN_INTERVAL_MS);
+
+         // Always send the first response as soon as possible
+         subscription->hasSentResponse = false;
+         Lunar_SoftTimerLib_Init(&subscription->timer);
+         Lunar_SoftTimerLib_StartTimer(&subscription->timer, 0U);
+
+         subscription->inUse = true;
+      }
+   }
+
+   return(subscriptionIndex);
+}
+
+
+// Remove a single subscription
+bool Lunar_SubscriptionMgr_Unsubscribe(const Lunar_MessageRouter_MessageSource_t *const source, const uint8_t subscriptionIndex)
+{
+   // Assume failure
+   bool wasRemoved = false;
+
+   // Verify the index, only the source that created the subscription may remove it
+   if ((source != 0) && (subscriptionIndex < (uint8_t)LUNAR_SUBSCRIPTIONMGR_MAX_SUBSCRIPTIONS) &&
+       (status.subscriptions[subscriptionIndex].inUse) && (IsOwner(&status.subscriptions[subscriptionIndex], source)))
+   {
+      // Free the entry
+      status.subscriptions[subscriptionIndex].inUse = false;
+      wasRemoved = true;
+   }
+
+   return(wasRemoved);
+}
+
+
+// Remove all subscriptions for the given source
+void Lunar_SubscriptionMgr_UnsubscribeAll(const Lunar_MessageRouter_MessageSource_t *const source)
+{
+   // Verify the parameter
+   if (source != 0)
+   {
+      // Free each entry created by the source
+      for (uint8_t i = 0U; i < (uint8_t)LUNAR_SUBSCRIPTIONMGR_MAX_SUBSCRIPTIONS; i++)
+      {
+         if (IsOwner(&status.subscriptions[i], source))
+         {
+            status.subscriptions[i].inUse = false;
+         }
+      }
+   }
+}
+
+
+/*******************************************************************************
+// Message Router Function Implementations
+*******************************************************************************/
+
+// Add a subscription for the sender of the message
+void Lunar_SubscriptionMgr_MessageRouter_Subscribe(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the command
+   // Note that the command parameters are variable length
+   typedef struct
+   {
+      // Module ID of the command to be executed
+      uint8_t moduleID;
+      // Command ID of the command to be executed
+      uint8_t commandID;
+      // Period between responses or 0 to send only when the response changes
+      uint16_t periodMs;
+      // Minimum time between responses
+      uint16_t minIntervalMs;
+      // Parameters for the command to be executed
+      uint8_t commandParams[LUNAR_SUBSCRIPTIONMGR_MAX_COMMAND_SIZE];
+   } Command_t;
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // Index of the subscription or LUNAR_SUBSCRIPTIONMGR_INVALID_INDEX if rejected
+      uint8_t subscriptionIndex;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // The command must contain the fixed portion and no more parameters than can be stored
+   if ((message->commandParams.length < offsetof(Command_t, commandParams)) ||
+       (message->commandParams.length > sizeof(Command_t)))
+   {
+      // Invalid length, set the response code
+      message->responseCode = LUNAR_MESSAGEROUTER_RESPONSE_CODE_InvalidCommandLength;
+   }
+   // Make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   else if (Lunar_MessageRouter_VerifyResponseSize(message, sizeof(Response_t)))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      // Responses are sent with the message ID of this command
+      Lunar_MessageRouter_MessageItemHeader_t header;
+      header.moduleID = command->moduleID;
+      header.commandID = command->commandID;
+      header.messageID = message->header.messageID;
+
+      // Add the subscription for the transport that sent this command
+      response->subscriptionIndex = Lunar_SubscriptionMgr_Subscribe(&message->source, &header, command->periodMs, command->minIntervalMs, command->commandParams,
+                                                                    (uint8_t)(message->commandParams.length - offsetof(Command_t, commandParams)));
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+
+// Remove a single subscription
+void Lunar_SubscriptionMgr_MessageRouter_Unsubscribe(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the command
+   typedef struct
+   {
+      // Index of the subscription to be removed
+      uint8_t subscriptionIndex;
+   } Command_t;
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // Result of removing the subscription
+      bool wasRemoved;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), sizeof(Response_t)))
+   {
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      // A subscription created from another transport or channel cannot be removed from here
+      if ((command->subscriptionIndex < (uint8_t)LUNAR_SUBSCRIPTIONMGR_MAX_SUBSCRIPTIONS) &&
+          (status.subscriptions[command->subscriptionIndex].inUse) &&
+          (!IsOwner(&status.subscriptions[command->subscriptionIndex], &message->source)))
+      {
+         message->responseCode = LUNAR_MESSAGEROUTER_RESPONSE_CODE_InvalidParameter;
+         Lunar_MessageRouter_SetResponseSize(message, 0);
+      }
+      else
+      {
+         response->wasRemoved = Lunar_SubscriptionMgr_Unsubscribe(&message->source, command->subscriptionIndex);
+
+         // Set the response length
+         Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+      }
+   }
+}
+
+
+// Remove all subscriptions for the sender of the message
+void Lunar_SubscriptionMgr_MessageRouter_UnsubscribeAll(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+   // No command or response params for this message.
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, 0))
+   {
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      Lunar_SubscriptionMgr_UnsubscribeAll(&message->source);
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, 0);
+   }
+}
+
+
+// Return the subscription statistics
+void Lunar_SubscriptionMgr_MessageRouter_GetStatistics(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // This structure defines the format of the response
+   typedef struct
+   {
+      // Items from Statistics_t
+      uint32_t numResponsesSent;
+      uint32_t numResponsesSuppressed;
+      uint32_t numResponsesThrottled;
+      // Number of active subscriptions
+      uint8_t numSubscriptions;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   {
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+      response->numResponsesSent = status.statistics.numResponsesSent;
+      response->numResponsesSuppressed = status.statistics.numResponsesSuppressed;
+      response->numResponsesThrottled = status.statistics.numResponsesThrottled;
+
+      // Count the active subscriptions
+      response->numSubscriptions = 0U;
+
+      for (uint8_t i = 0U; i < (uint8_t)LUNAR_SUBSCRIPTIONMGR_MAX_SUBSCRIPTIONS; i++)
+      {
+         if (status.subscriptions[i].inUse)
+         {
+            response->numSubscriptions++;
+         }
+      }
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
@@ -0,0 +1,185 @@
+/*******************************************************************************
+// Core Subscription Manager Module
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Lunar_SubscriptionMgr_Config.h"
+// Platform Includes
+#include "Lunar_MessageRouter.h"
+#include "Platform.h"
+// Other Includes
+#include <stdbool.h>
+#include <stdint.h>
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// Index returned when a subscription could not be created or found
+#define LUNAR_SUBSCRIPTIONMGR_INVALID_INDEX (0xFFU)
+
+// Period used to denote an on-change subscription rather than a periodic one
+#define LUNAR_SUBSCRIPTIONMGR_PERIOD_ON_CHANGE (0U)
+
+
+/*******************************************************************************
+// Public Type Declarations
+*******************************************************************************/
+
+// This is an item in the transport table.  This associates a function that is
+// able to send a complete message with a Message Router transport.
+typedef struct
+{
+   // Transport used to reach the subscriber
+   Lunar_MessageRouter_Transport_t transport;
+
+   // Function used to send a message on the given transport
+   const Lunar_MessageRouter_TransportSend_t sendMessage;
+} Lunar_SubscriptionMgr_TransportConfigItem_t;
+
+
+/*******************************************************************************
+// Public Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function initializes the Subscription Manager and removes all
+  *    subscriptions.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_SubscriptionMgr_Init(void);
+
+/** Description:
+  *    This is the scheduled update function for the Subscription Manager.  The
+  *    handler for each subscription that is due is executed via the Message
+  *    Router and the response is pushed to the transport that created the
+  *    subscription, subject to the per-subscription rate limit and the total
+  *    bandwidth cap.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_SubscriptionMgr_Update(void);
+
+/** Description:
+  *    This function adds a subscription to the subscription table.  If a
+  *    subscription already exists for the given source, module, command and
+  *    parameters, the existing subscription is updated instead.
+  * Parameters:
+  *    source :          The transport and channel where responses will be sent
+  *    header :          The module and command to be executed. The message ID
+  *                      is returned in each response.
+  *    periodMs :        The interval between responses in milliseconds or
+  *                      LUNAR_SUBSCRIPTIONMGR_PERIOD_ON_CHANGE to only send a
+  *                      response when it differs from the last one sent.
+  *    minIntervalMs :   The minimum time between responses in milliseconds.
+  *                      For on-change subscriptions, this is also the rate at
+  *                      which the handler is polled.
+  *    commandParams :   Parameters passed to the handler (may be NULL if the
+  *                      length is 0)
+  *    commandLength :   Number of bytes in the command parameters
+  * Returns:
+  *    uint8_t - The index of the subscription or
+  *    LUNAR_SUBSCRIPTIONMGR_INVALID_INDEX if the subscription was rejected
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+uint8_t Lunar_SubscriptionMgr_Subscribe(const Lunar_MessageRouter_MessageSource_t *const source, const Lunar_MessageRouter_MessageItemHeader_t *const header, const uint16_t periodMs, const uint16_t minIntervalMs, const uint8_t *const commandParams, const uint8_t commandLength);
+
+/** Description:
+  *    This function removes the subscription at the given index.  Only the
+  *    transport and channel that created the subscription can remove it.
+  * Parameters:
+  *    source :             The transport and channel requesting the removal
+  *    subscriptionIndex :  Index returned when the subscription was created
+  * Returns:
+  *    bool - The result of the removal
+  * Return Value List:
+  *    true :   The subscription was removed
+  *    false :  No subscription from the source exists at the given index
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+bool Lunar_SubscriptionMgr_Unsubscribe(const Lunar_MessageRouter_MessageSource_t *const source, const uint8_t subscriptionIndex) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This function removes all subscriptions created from the given source.
+  * Parameters:
+  *    source :  The transport and channel whose subscriptions are removed
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_SubscriptionMgr_UnsubscribeAll(const Lunar_MessageRouter_MessageSource_t *const source) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This is the command handler used for adding a subscription on the
+  *    transport that sent the command.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_SubscriptionMgr_MessageRouter_Subscribe(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This is the command handler used for removing a single subscription.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_SubscriptionMgr_MessageRouter_Unsubscribe(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This is the command handler used for removing all subscriptions that were
+  *    created on the transport that sent the command.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_SubscriptionMgr_MessageRouter_UnsubscribeAll(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+/** Description:
+  *    This is the command handler used for querying the number of responses
+  *    sent, suppressed and throttled by the Subscription Manager.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_SubscriptionMgr_MessageRouter_GetStatistics(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
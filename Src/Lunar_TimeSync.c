@@ -0,0 +1,574 @@
+/*******************************************************************************
+// Core Time Synchronization Module
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+// Module Includes
+#include "Lunar_TimeSync.h"
+#include "Lunar_TimeSync_Config.h"
+// Platform Includes
+#include "CAN_Drv.h"
+#include "Lunar_EventMgr.h"
+#include "Lunar_MessageRouter.h"
+#include "Platform.h"
+#include "Timebase_Drv.h"
+// Other Includes
+#include <stdbool.h>
+#include <stdint.h>
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The drift is a fraction of the local time in units of 2^-24
+#define DRIFT_SHIFT (24)
+#define DRIFT_FRACTION_MASK ((1L << DRIFT_SHIFT) - 1L)
+
+// The number of bytes of the master time in a follow-up frame
+#define NUM_TIME_BYTES (7U)
+
+#if !LUNAR_TIMESYNC_IS_MASTER
+
+// The largest drift that is accepted, in units of 2^-24
+#define MAX_DRIFT ((int32_t)(((int64_t)LUNAR_TIMESYNC_MAX_DRIFT_PPM << DRIFT_SHIFT) / 1000000))
+
+// A new drift measurement moves the drift correction by 1/DRIFT_FILTER_DIVISOR
+#define DRIFT_FILTER_DIVISOR (4)
+
+#endif
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// This structure holds the private information for this module
+typedef struct
+{
+   // The cycle count and the synchronized time of the reference point
+   // The synchronized time is extrapolated from the last reference point
+   uint32_t refCycles;
+   uint64_t refTimeUs;
+
+   // The drift correction and the part of a microsecond carried over
+   // from the last reference point, both in units of 2^-24
+   int32_t drift;
+   int32_t driftFraction;
+
+   // The number of timebase cycles in a microsecond, 0 before initialization
+   uint32_t cyclesPerMicrosecond;
+
+   // The offset found by the last follow-up and the largest offset since
+   // the status was read, in microseconds
+   int32_t lastOffsetUs;
+   uint32_t maxOffsetUs;
+
+   // The number of SYNC frames sent or synchronizations done
+   uint32_t numSyncs;
+
+   // The number of times the drift correction was restarted
+   uint32_t numResets;
+
+   // The number of follow-up frames that were not sent or not received
+   uint32_t numMissedFollowUps;
+
+   // The number of follow-ups dropped because of a too large offset
+   uint32_t numRejectedOffsets;
+
+   // The tick count of the last SYNC frame sent or synchronization done
+   uint32_t lastSyncTime;
+
+#if LUNAR_TIMESYNC_IS_MASTER
+   // true while the follow-up for the last SYNC frame is not sent
+   bool isFollowUpPending;
+#else
+   // The cycle count when the last SYNC frame was received
+   uint32_t syncCycles;
+
+   // The cycle count and the master time of the last synchronization
+   uint32_t lastSampleCycles;
+   uint64_t lastSampleTimeUs;
+
+   // true while the follow-up for the last SYNC frame was not received
+   bool isFollowUpPending;
+
+   // The number of follow-ups dropped in a row because of a too large offset
+   uint8_t numConsecutiveRejects;
+
+   // true once the drift was measured
+   bool isDriftValid;
+
+   // true while the follow-ups arrive within the timeout
+   bool isSynchronized;
+#endif
+
+   // The sequence number of the last SYNC frame
+   uint8_t sequence;
+} Lunar_TimeSync_Status_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The variable used for holding all internal data for this module.
+static Lunar_TimeSync_Status_t status;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function returns the drift correction, in units of 2^-24
+  *    microseconds, for a time since the reference point.  The part of a
+  *    microsecond carried over from the last reference point is included.
+  * Parameters:
+  *    elapsedUs :  The local time since the reference point
+  * Returns:
+  *    int64_t - The correction to be added to the time
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static int64_t GetDriftCorrection(const int32_t elapsedUs);
+
+/** Description:
+  *    This function moves the reference point to the given cycle count, so
+  *    the elapsed cycles used by Lunar_TimeSync_GetTimeUsAt never overflow.
+  *    The synchronized time does not change.
+  * Parameters:
+  *    cycleCount :  The new reference cycle count
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void MoveReference(const uint32_t cycleCount);
+
+#if !LUNAR_TIMESYNC_IS_MASTER
+/** Description:
+  *    This function corrects the local time with the master time at the end
+  *    of a SYNC frame.  The drift is measured from the time the master and
+  *    this node counted since the last synchronization, and the time jumps
+  *    to the master time.  An offset larger than the drift correction
+  *    allows is dropped as a bad timestamp, unless it repeats.
+  * Parameters:
+  *    rxCycles :  The cycle count when the SYNC frame was received
+  *    masterTimeUs :  The master time when the SYNC frame was sent
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void Synchronize(const uint32_t rxCycles, const uint64_t masterTimeUs);
+#endif
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Get the drift correction since the reference point
+static int64_t GetDriftCorrection(const int32_t elapsedUs)
+{
+   return(((int64_t)elapsedUs * status.drift) + status.driftFraction);
+}
+
+
+// Move the reference point without changing the time
+static void MoveReference(const uint32_t cycleCount)
+{
+   // Only whole microseconds are moved, the remaining cycles stay in the next interval
+   int32_t elapsedUs = (int32_t)(cycleCount - status.refCycles) / (int32_t)status.cyclesPerMicrosecond;
+   int64_t correction = GetDriftCorrection(elapsedUs);
+
+   status.refCycles += (uint32_t)elapsedUs * status.cyclesPerMicrosecond;
+   status.refTimeUs += (uint64_t)((int64_t)elapsedUs + (correction >> DRIFT_SHIFT));
+   status.driftFraction = (int32_t)(correction & DRIFT_FRACTION_MASK);
+}
+
+
+#if !LUNAR_TIMESYNC_IS_MASTER
+// Correct the local time with the master time
+static void Synchronize(const uint32_t rxCycles, const uint64_t masterTimeUs)
+{
+   int64_t offsetUs = (int64_t)(masterTimeUs - Lunar_TimeSync_GetTimeUsAt(rxCycles));
+   bool isReset = true;
+
+   // Once the drift is corrected the offset stays small, so a large one is a
+   // receive timestamp or master time that is off.  Only an offset that
+   // repeats is a real jump of the master time.
+   if ((status.isSynchronized) && (status.isDriftValid) &&
+       ((offsetUs > LUNAR_TIMESYNC_MAX_OFFSET_US) || (offsetUs < -(int64_t)LUNAR_TIMESYNC_MAX_OFFSET_US)) &&
+       (status.numConsecutiveRejects < LUNAR_TIMESYNC_MAX_REJECTED_OFFSETS))
+   {
+      // The time and the drift correction are kept, the next follow-up
+      // measures the drift from the last one that was used
+      status.numConsecutiveRejects++;
+      status.numRejectedOffsets++;
+   }
+   else
+   {
+      status.numConsecutiveRejects = 0U;
+
+      // The drift is measured over the interval since the last follow-up, so
+      // it does not depend on the offset that was corrected at its start
+      if (status.isSynchronized)
+      {
+         int64_t masterElapsedUs = (int64_t)(masterTimeUs - status.lastSampleTimeUs);
+         int64_t localElapsedUs = (int64_t)((rxCycles - status.lastSampleCycles) / status.cyclesPerMicrosecond);
+
+         if ((masterElapsedUs > 0) && (localElapsedUs > 0))
+         {
+            int64_t drift = ((masterElapsedUs - localElapsedUs) * (1LL << DRIFT_SHIFT)) / localElapsedUs;
+
+            // A larger drift means the master restarted or a frame was lost
+            if ((drift >= -MAX_DRIFT) && (drift <= MAX_DRIFT))
+            {
+               if (status.isDriftValid)
+               {
+                  status.drift += ((int32_t)drift - status.drift) / DRIFT_FILTER_DIVISOR;
+               }
+               else
+               {
+                  status.drift = (int32_t)drift;
+                  status.isDriftValid = true;
+               }
+
+               isReset = false;
+            }
+         }
+      }
+
+      if (isReset)
+      {
+         status.numResets++;
+      }
+
+      // Clamp the offset reported for the first synchronization
+      if (offsetUs > INT32_MAX)
+      {
+         status.lastOffsetUs = INT32_MAX;
+      }
+      else if (offsetUs < -INT32_MAX)
+      {
+         status.lastOffsetUs = -INT32_MAX;
+      }
+      else
+      {
+         status.lastOffsetUs = (int32_t)offsetUs;
+      }
+
+      // The offset is only meaningful once the drift is corrected
+      if (!isReset)
+      {
+         status.maxOffsetUs = PLATFORM_MAX(status.maxOffsetUs, (uint32_t)((status.lastOffsetUs < 0) ? -status.lastOffsetUs : status.lastOffsetUs));
+      }
+
+      // Jump to the master time
+      status.refCycles = rxCycles;
+      status.refTimeUs = masterTimeUs;
+      status.driftFraction = 0;
+
+      status.lastSampleCycles = rxCycles;
+      status.lastSampleTimeUs = masterTimeUs;
+      status.lastSyncTime = Timebase_Drv_GetCurrentTickCount();
+      status.numSyncs++;
+      status.isSynchronized = true;
+
+      Lunar_EventMgr_HandleEvent(LUNAR_EVENTMGR_CONFIG_EVENT_Time_Synchronized);
+   }
+}
+#endif
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Module initialization
+void Lunar_TimeSync_Init(void)
+{
+   status.cyclesPerMicrosecond = Timebase_Drv_GetCyclesPerSecond() / 1000000U;
+   status.refCycles = Timebase_Drv_GetCycleCount();
+   status.refTimeUs = 0U;
+   status.drift = 0;
+   status.driftFraction = 0;
+   status.lastSyncTime = Timebase_Drv_GetCurrentTickCount();
+}
+
+
+// Send the SYNC and follow-up frames or notice the loss of the master
+void Lunar_TimeSync_Update(void)
+{
+   uint32_t currentTime = Timebase_Drv_GetCurrentTickCount();
+   uint32_t currentCycles = Timebase_Drv_GetCycleCount();
+
+   // The elapsed cycles are kept well below the wrap of the cycle count
+   if ((currentCycles - status.refCycles) >= Timebase_Drv_GetCyclesPerSecond())
+   {
+      MoveReference(currentCycles);
+   }
+
+#if LUNAR_TIMESYNC_IS_MASTER
+   if (status.isFollowUpPending)
+   {
+      uint32_t txCycles;
+
+      if (CAN_Drv_GetTransmitTime(CAN_DRV_CHANNEL_PRIMARY, &txCycles))
+      {
+         uint64_t txTimeUs = Lunar_TimeSync_GetTimeUsAt(txCycles);
+         uint8_t frameData[1U + NUM_TIME_BYTES];
+
+         frameData[0] = status.sequence;
+         for (uint32_t i = 0U; i < NUM_TIME_BYTES; i++)
+         {
+            frameData[1U + i] = (uint8_t)(txTimeUs >> (8U * i));
+         }
+
+         // A follow-up that cannot be queued is tried again on the next call
+         if (CAN_Drv_StartTransmitFrame(CAN_DRV_CHANNEL_PRIMARY, LUNAR_TIMESYNC_FOLLOWUP_CANID | CAN_DRV_EXTENDED_ID, frameData, (uint8_t)sizeof(frameData)))
+         {
+            status.isFollowUpPending = false;
+         }
+      }
+      else if ((currentTime - status.lastSyncTime) >= ((LUNAR_TIMESYNC_PERIOD_MS / 2U) * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND))
+      {
+         // The SYNC frame was not sent, the slaves drop it when the next one arrives
+         status.isFollowUpPending = false;
+         status.numMissedFollowUps++;
+      }
+      else
+      {
+         // Waiting for the SYNC frame to be sent
+      }
+   }
+   else if ((currentTime - status.lastSyncTime) >= (LUNAR_TIMESYNC_PERIOD_MS * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND))
+   {
+      uint8_t sequence = status.sequence + 1U;
+
+      // The capture is armed first, so a frame sent at once is not missed
+      CAN_Drv_StartTransmitTimeCapture(CAN_DRV_CHANNEL_PRIMARY, LUNAR_TIMESYNC_SYNC_CANID | CAN_DRV_EXTENDED_ID);
+
+      if (CAN_Drv_StartTransmitFrame(CAN_DRV_CHANNEL_PRIMARY, LUNAR_TIMESYNC_SYNC_CANID | CAN_DRV_EXTENDED_ID, &sequence, 1U))
+      {
+         status.sequence = sequence;
+         status.lastSyncTime = currentTime;
+         status.numSyncs++;
+         status.isFollowUpPending = true;
+      }
+   }
+   else
+   {
+      // Waiting for the next period
+   }
+#else
+   // The drift correction is kept, it still holds once the master returns
+   if ((status.isSynchronized) &&
+       ((currentTime - status.lastSyncTime) >= (LUNAR_TIMESYNC_TIMEOUT_MS * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND)))
+   {
+      status.isSynchronized = false;
+   }
+#endif
+}
+
+
+// Get the synchronized time
+uint64_t Lunar_TimeSync_GetTimeUs(void)
+{
+   return(Lunar_TimeSync_GetTimeUsAt(Timebase_Drv_GetCycleCount()));
+}
+
+
+// Convert a cycle count into synchronized time
+uint64_t Lunar_TimeSync_GetTimeUsAt(const uint32_t cycleCount)
+{
+   uint64_t timeUs = 0U;
+
+   if (status.cyclesPerMicrosecond != 0U)
+   {
+      int32_t elapsedUs = (int32_t)(cycleCount - status.refCycles) / (int32_t)status.cyclesPerMicrosecond;
+
+      timeUs = status.refTimeUs + (uint64_t)((int64_t)elapsedUs + (GetDriftCorrection(elapsedUs) >> DRIFT_SHIFT));
+   }
+
+   return(timeUs);
+}
+
+
+// Get the synchronized time in milliseconds
+uint32_t Lunar_TimeSync_GetTimeMs(void)
+{
+   return((uint32_t)(Lunar_TimeSync_GetTimeUs() / 1000U));
+}
+
+
+// Tell if the time follows the master
+bool Lunar_TimeSync_IsSynchronized(void)
+{
+#if LUNAR_TIMESYNC_IS_MASTER
+   return(true);
+#else
+   return(status.isSynchronized);
+#endif
+}
+
+
+/*******************************************************************************
+// Message Router Function Implementations
+*******************************************************************************/
+
+// Message handler to get the accuracy of the synchronized time
+void Lunar_TimeSync_MessageRouter_GetStatus(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // Response
+   typedef struct
+   {
+      int32_t lastOffsetUs;
+      uint32_t maxOffsetUs;
+      int32_t driftPpb;
+      uint32_t numSyncs;
+      uint32_t numResets;
+      uint32_t numMissedFollowUps;
+      uint32_t syncAgeMs;
+      uint8_t isMaster;
+      uint8_t isSynchronized;
+      uint8_t sequence;
+      uint8_t reserved;
+      uint32_t numRejectedOffsets;
+   } Response_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, 0, sizeof(Response_t)))
+   {
+      // Cast the response buffer as the response type
+      Response_t *response = (Response_t *)message->responseParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      response->lastOffsetUs = status.lastOffsetUs;
+      response->maxOffsetUs = status.maxOffsetUs;
+      response->driftPpb = (int32_t)(((int64_t)status.drift * 1000000000) >> DRIFT_SHIFT);
+      response->numSyncs = status.numSyncs;
+      response->numResets = status.numResets;
+      response->numMissedFollowUps = status.numMissedFollowUps;
+      response->syncAgeMs = (Timebase_Drv_GetCurrentTickCount() - status.lastSyncTime) / TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND;
+      response->isMaster = LUNAR_TIMESYNC_IS_MASTER;
+      response->isSynchronized = Lunar_TimeSync_IsSynchronized() ? 1U : 0U;
+      response->sequence = status.sequence;
+      response->reserved = 0U;
+      response->numRejectedOffsets = status.numRejectedOffsets;
+
+      // The largest offset covers the time since the last read
+      status.maxOffsetUs = 0U;
+
+      // Set the response length
+      Lunar_MessageRouter_SetResponseSize(message, sizeof(Response_t));
+   }
+}
+
+// Message handler for the SYNC frame of the master
+void Lunar_TimeSync_MessageRouter_Sync(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // Command
+   typedef struct
+   {
+      uint8_t sequence;
+   } Command_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), 0))
+   {
+#if LUNAR_TIMESYNC_IS_MASTER
+      // The master does not follow another master
+#else
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      // A follow-up that did not arrive is replaced by this SYNC frame
+      if (status.isFollowUpPending)
+      {
+         status.numMissedFollowUps++;
+      }
+
+      status.syncCycles = message->source.timestamp;
+      status.sequence = command->sequence;
+      status.isFollowUpPending = true;
+#endif
+   }
+}
+
+// Message handler for the follow-up frame of the master
+void Lunar_TimeSync_MessageRouter_FollowUp(Lunar_MessageRouter_Message_t *const message)
+{
+   //-----------------------------------------------
+   // Command/Response Params
+   //-----------------------------------------------
+
+   // Command
+   typedef struct
+   {
+      uint8_t sequence;
+      uint8_t timeUs[NUM_TIME_BYTES];
+   } Command_t;
+
+   //-----------------------------------------------
+   // Message Processing
+   //-----------------------------------------------
+
+   // Verify the length of the command parameters and make sure we have room for the response
+   //	Note that the error response will be set, if necessary
+   if (Lunar_MessageRouter_VerifyParameterSizes(message, sizeof(Command_t), 0))
+   {
+#if LUNAR_TIMESYNC_IS_MASTER
+      // The master does not follow another master
+#else
+      // Cast the command buffer as the command type
+      Command_t *command = (Command_t *)message->commandParams.data;
+
+      //-----------------------------------------------
+      // Execute Command
+      //-----------------------------------------------
+
+      // Only the follow-up of the last SYNC frame is used
+      if ((status.isFollowUpPending) && (command->sequence == status.sequence))
+      {
+         uint64_t masterTimeUs = 0U;
+
+         for (uint32_t i = 0U; i < NUM_TIME_BYTES; i++)
+         {
+            masterTimeUs |= (uint64_t)command->timeUs[i] << (8U * i);
+         }
+
+         status.isFollowUpPending = false;
+         Synchronize(status.syncCycles, masterTimeUs);
+      }
+#endif
+   }
+}
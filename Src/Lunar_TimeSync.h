@@ -0,0 +1,147 @@
+/*******************************************************************************
+// Core Time Synchronization Module
+*******************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Lunar_TimeSync_Config.h"
+// Platform Includes
+#include "Lunar_MessageRouter.h"
+#include "Platform.h"
+// Other Includes
+#include <stdbool.h>
+#include <stdint.h>
+
+
+/*******************************************************************************
+// Public Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function initializes the synchronized time to the local time.
+  *    It only needs the timebase, so it may run before the other modules
+  *    that log or report with the synchronized time.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_TimeSync_Init(void);
+
+/** Description:
+  *    This is the scheduled update function.  The master sends a SYNC frame
+  *    every period and a follow-up frame with its time at the end of the
+  *    SYNC frame.  A slave notices when the follow-ups stop.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_TimeSync_Update(void);
+
+/** Description:
+  *    This function returns the synchronized time.  The master uses its own
+  *    time.  A slave applies the offset and the drift of its timebase,
+  *    measured with the SYNC and follow-up frames, to its local time.
+  * Returns:
+  *    uint64_t - The synchronized time in microseconds
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+uint64_t Lunar_TimeSync_GetTimeUs(void);
+
+/** Description:
+  *    This function converts a Timebase_Drv_GetCycleCount value, such as the
+  *    time a sample was taken, into synchronized time.  The cycle count must
+  *    be within a few seconds of the current time.
+  * Parameters:
+  *    cycleCount :  The cycle count to be converted
+  * Returns:
+  *    uint64_t - The synchronized time in microseconds
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+uint64_t Lunar_TimeSync_GetTimeUsAt(const uint32_t cycleCount);
+
+/** Description:
+  *    This function returns the synchronized time in milliseconds.
+  * Returns:
+  *    uint32_t - The synchronized time in milliseconds, wraps after 49 days
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+uint32_t Lunar_TimeSync_GetTimeMs(void);
+
+/** Description:
+  *    This function tells if the time follows the master.  The master is
+  *    always synchronized.
+  * Returns:
+  *    bool - true if a follow-up was received within the timeout
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+bool Lunar_TimeSync_IsSynchronized(void);
+
+
+/*******************************************************************************
+// Message Router Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    Message handler that returns the accuracy of the synchronized time:
+  *    the offset found by the last follow-up, the largest offset since the
+  *    status was last read, the drift correction and the number of
+  *    synchronizations.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_TimeSync_MessageRouter_GetStatus(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+/** Description:
+  *    Message handler for the SYNC frame of the master.  The receive time of
+  *    the frame is kept until the follow-up arrives.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_TimeSync_MessageRouter_Sync(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+/** Description:
+  *    Message handler for the follow-up frame of the master, which holds the
+  *    time of the master at the end of the SYNC frame.  The offset and the
+  *    drift of the local time are corrected with it.
+  * Parameters:
+  *    message :  A pointer to a common Message Router message
+  *               object. The response is expected to be placed in
+  *               this object.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Lunar_TimeSync_MessageRouter_FollowUp(Lunar_MessageRouter_Message_t *const message) PLATFORM_NON_NULL;
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
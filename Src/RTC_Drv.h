@@ -210,15 +210,18 @@ void RTC_Drv_GetCurrentTime(RTC_Drv_DateTime_t *const dateTime) PLATFORM_NON_NUL
 
 /** Description:
   *    This function sets the current RTC time using the common format used by
-  *    the RTC diver.
+  *    the RTC diver.  The time is not changed if any field is out of range.
   * Parameters: 
   *     dateTime - Common RTC Date/Time structure containing the current time is
   *     to be set.
+  * Returns:
+  *    bool - true if the time was valid and has been set
   * History: 
   *    * 6/6/2021: Function created (EJH)
+  *    * 10/19/2026: Reject out of range values (EJH)
   *                                                              
 */
-void RTC_Drv_SetCurrentTime(const RTC_Drv_DateTime_t *const dateTime)PLATFORM_NON_NULL;
+bool RTC_Drv_SetCurrentTime(const RTC_Drv_DateTime_t *const dateTime)PLATFORM_NON_NULL;
 
 /** Description:
   *    This function retrieves the current date and time using the formated
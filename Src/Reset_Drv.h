@@ -17,6 +17,7 @@ extern "C"
 // Module Includes
 // Platform Includes
 // Other Includes
+#include "Platform.h"
 #include <stdint.h> // Integer types
 
 
@@ -24,6 +25,9 @@ extern "C"
 // Public Constant Definitions
 *******************************************************************************/
 
+// The length of the unique chip ID in bytes
+#define RESET_DRV_UNIQUE_ID_LENGTH (16U)
+
 
 /*******************************************************************************
 // Public Type Declarations
@@ -64,6 +68,17 @@ void Reset_Drv_Execute(void);
 */
 uint32_t Reset_Drv_GetResetReason(void);
 
+/** Description:
+  *    This function copies the unique ID of the device, which is programmed
+  *    during production and differs for every chip.
+  * Parameters:
+  *    uniqueId : Buffer of RESET_DRV_UNIQUE_ID_LENGTH bytes for the ID
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Reset_Drv_GetUniqueId(uint8_t *const uniqueId) PLATFORM_NON_NULL;
+
 
 #ifdef __cplusplus
 extern "C"
@@ -53,6 +53,32 @@ void Timebase_Drv_Init(void);
 */
 uint32_t Timebase_Drv_GetCurrentTickCount(void);
 
+/** Description:
+  *    This function retrieves a free-running CPU cycle counter used for
+  *    measuring short execution times.  The counter wraps, so only the
+  *    difference between two readings is meaningful.  It may be called from
+  *    interrupt handlers.  On the XMC1 the count is built from the SysTick,
+  *    so an interrupt the SysTick cannot preempt must finish within one tick,
+  *    only a single pending tick is counted.
+  * Returns:
+  *    uint32_t - The current 32-bit cycle count
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+uint32_t Timebase_Drv_GetCycleCount(void);
+
+/** Description:
+  *    This function retrieves the rate of the cycle counter returned by
+  *    Timebase_Drv_GetCycleCount.
+  * Returns:
+  *    uint32_t - The number of cycles per second
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+uint32_t Timebase_Drv_GetCyclesPerSecond(void);
+
 
 #ifdef __cplusplus
 extern "C"
@@ -0,0 +1,308 @@
+/*******************************************************************************
+// ADC Driver Test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Test_Harness.h"
+// Platform Includes
+#include "ADC_Drv.h"
+#include "ADC_Drv_Config.h"
+// Other Includes
+#include <stdlib.h> // malloc
+#include <string.h> // memcmp
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The simulated cycles between two scans and between two buffers
+#define CYCLES_PER_SCAN (HOST_DRV_CYCLES_PER_SECOND / ADC_DRV_SAMPLE_RATE_HZ)
+#define CYCLES_PER_BUFFER (CYCLES_PER_SCAN * ADC_DRV_SAMPLES_PER_BUFFER)
+
+// Scans of the generated waveform, not a whole number of buffers so the
+// waveform repeats part way through a buffer
+#define NUM_GENERATED_SCANS (1234U)
+
+// The bits of a 12-bit result
+#define RESULT_MASK (0x0FFFU)
+
+// Time the acquisition runs with the scheduler on time
+#define RUN_MILLISECONDS (2000U)
+
+// Time the scheduler is stalled, several buffers long
+#define STALL_MILLISECONDS (35U)
+
+// The ADC driver in the Message Router and its status command
+#define ADC_MODULE_ID (0x06U)
+#define ADC_COMMAND_GET_STATUS (0x01U)
+
+// Offsets in the status response
+#define STATUS_NUM_BUFFERS_OFFSET (8U)
+#define STATUS_NUM_OVERRUNS_OFFSET (12U)
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The replayed waveform
+static uint16_t *waveform = NULL;
+static uint32_t waveformNumScans = 0U;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function loads a recorded waveform: little endian 16-bit results,
+  *    ADC_DRV_CHANNEL_Count per scan in channel enumeration order.
+  * Parameters:
+  *    fileName :  The recording
+  * Returns:
+  *    bool - true if at least one scan was loaded
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool LoadWaveform(const char *const fileName);
+
+/** Description:
+  *    This function makes a waveform where every result of a repetition is
+  *    different, so a sample out of order or from the wrong buffer is seen.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void GenerateWaveform(void);
+
+/** Description:
+  *    This function checks that a buffer holds the given scans of the
+  *    waveform in order.
+  * Parameters:
+  *    buffer :     The buffer handed over by the driver
+  *    firstScan :  The index of the first scan in the buffer
+  * Returns:
+  *    bool - true if every sample matches
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool IsBufferInOrder(const ADC_Drv_Buffer_t *const buffer, const uint32_t firstScan);
+
+/** Description:
+  *    This function reads a counter from the acquisition status.
+  * Parameters:
+  *    offset :  The offset of the counter in the response
+  * Returns:
+  *    uint32_t - The counter, UINT32_MAX if there was no response
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint32_t GetStatusCounter(const uint32_t offset);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Load a recorded waveform
+static bool LoadWaveform(const char *const fileName)
+{
+   FILE *const file = fopen(fileName, "rb");
+
+   if (file != NULL)
+   {
+      (void)fseek(file, 0L, SEEK_END);
+      const long size = ftell(file);
+      (void)fseek(file, 0L, SEEK_SET);
+
+      waveformNumScans = (size > 0L) ? ((uint32_t)size / (sizeof(uint16_t) * (uint32_t)ADC_DRV_CHANNEL_Count)) : 0U;
+      waveform = malloc((waveformNumScans * (uint32_t)ADC_DRV_CHANNEL_Count * sizeof(uint16_t)) + 1U);
+
+      if ((waveform == NULL) ||
+          (fread(waveform, sizeof(uint16_t) * (uint32_t)ADC_DRV_CHANNEL_Count, waveformNumScans, file) != waveformNumScans))
+      {
+         waveformNumScans = 0U;
+      }
+
+      fclose(file);
+   }
+
+   return(waveformNumScans > 0U);
+}
+
+// Make a waveform of distinct results
+static void GenerateWaveform(void)
+{
+   waveformNumScans = NUM_GENERATED_SCANS;
+   waveform = malloc(waveformNumScans * (uint32_t)ADC_DRV_CHANNEL_Count * sizeof(uint16_t));
+
+   for (uint32_t i = 0U; (waveform != NULL) && (i < (waveformNumScans * (uint32_t)ADC_DRV_CHANNEL_Count)); i++)
+   {
+      waveform[i] = (uint16_t)(i & RESULT_MASK);
+   }
+}
+
+// Check the samples of a buffer
+static bool IsBufferInOrder(const ADC_Drv_Buffer_t *const buffer, const uint32_t firstScan)
+{
+   bool isInOrder = true;
+
+   for (uint32_t sample = 0U; (sample < ADC_DRV_SAMPLES_PER_BUFFER) && (isInOrder); sample++)
+   {
+      const uint16_t *const expected = &waveform[((firstScan + sample) % waveformNumScans) * (uint32_t)ADC_DRV_CHANNEL_Count];
+
+      for (uint32_t channel = 0U; channel < (uint32_t)ADC_DRV_CHANNEL_Count; channel++)
+      {
+         if (buffer->samples[sample][channel] != (expected[channel] & RESULT_MASK))
+         {
+            printf("scan %u channel %u: %u, expected %u\n", (unsigned)(firstScan + sample), (unsigned)channel,
+                   (unsigned)buffer->samples[sample][channel], (unsigned)(expected[channel] & RESULT_MASK));
+            isInOrder = false;
+            break;
+         }
+      }
+   }
+
+   return(isInOrder);
+}
+
+// Read a counter of the acquisition status
+static uint32_t GetStatusCounter(const uint32_t offset)
+{
+   uint8_t response[255];
+   uint32_t counter = UINT32_MAX;
+
+   if (Test_Harness_SendCommand((UART_Drv_Channel_t)0, ADC_MODULE_ID, ADC_COMMAND_GET_STATUS, NULL, 0U, response, sizeof(response)) >= (int)(offset + sizeof(counter)))
+   {
+      memcpy(&counter, &response[offset], sizeof(counter));
+   }
+
+   return(counter);
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Test entry point
+//   ADC_Drv_Test              replays a generated waveform
+//   ADC_Drv_Test recording    replays a recorded waveform
+int main(int argc, char **argv)
+{
+   static ADC_Drv_Buffer_t handedOver;
+   const ADC_Drv_Buffer_t *buffer = NULL;
+   uint32_t firstReadyTime = 0U;
+   uint32_t lastReadyTime = 0U;
+   uint32_t numBuffersSeen = 0U;
+   uint32_t numOutOfOrder = 0U;
+   uint32_t numChanged = 0U;
+
+   if (argc > 1)
+   {
+      if (!LoadWaveform(argv[1]))
+      {
+         printf("cannot load %s\n", argv[1]);
+         return(EXIT_FAILURE);
+      }
+   }
+   else
+   {
+      GenerateWaveform();
+   }
+
+   Host_Drv_ReplayADC(waveform, waveformNumScans);
+   Test_Harness_Start();
+
+   //-----------------------------------------------
+   // Buffer hand-over and sample order
+   //-----------------------------------------------
+
+   for (uint32_t elapsed = 0U; elapsed < RUN_MILLISECONDS; elapsed++)
+   {
+      Test_Harness_Run(1U);
+
+      const ADC_Drv_Buffer_t *const readyBuffer = ADC_Drv_GetReadyBuffer();
+      const uint32_t readyTime = ADC_Drv_GetReadyBufferTime();
+
+      if ((readyBuffer != NULL) && ((numBuffersSeen == 0U) || (readyTime != lastReadyTime)))
+      {
+         if (numBuffersSeen == 0U)
+         {
+            firstReadyTime = readyTime;
+         }
+         else
+         {
+            // Each buffer is handed over once, none is skipped
+            TEST_CHECK((readyTime - lastReadyTime) == CYCLES_PER_BUFFER);
+            TEST_CHECK(readyBuffer != buffer);
+         }
+
+         // The buffer holds the scans since the previous one, in order
+         if (!IsBufferInOrder(readyBuffer, (readyTime - firstReadyTime) / CYCLES_PER_SCAN))
+         {
+            numOutOfOrder++;
+         }
+
+         buffer = readyBuffer;
+         lastReadyTime = readyTime;
+         memcpy(&handedOver, readyBuffer, sizeof(handedOver));
+         numBuffersSeen++;
+      }
+      else if (buffer != NULL)
+      {
+         // The acquisition fills the other buffer while one is handed over
+         if (memcmp(&handedOver, buffer, sizeof(handedOver)) != 0)
+         {
+            numChanged++;
+         }
+      }
+      else
+      {
+         // No buffer complete yet
+      }
+   }
+
+   TEST_CHECK(numBuffersSeen >= ((RUN_MILLISECONDS * ADC_DRV_SAMPLE_RATE_HZ) / (1000U * ADC_DRV_SAMPLES_PER_BUFFER)) - 1U);
+   TEST_CHECK(numOutOfOrder == 0U);
+   TEST_CHECK(numChanged == 0U);
+   TEST_CHECK(GetStatusCounter(STATUS_NUM_OVERRUNS_OFFSET) == 0U);
+
+   //-----------------------------------------------
+   // Overruns when the scheduler stalls
+   //-----------------------------------------------
+
+   // Reading the status runs the firmware, so take the time of the ready
+   // buffer afterwards
+   const uint32_t numBuffers = GetStatusCounter(STATUS_NUM_BUFFERS_OFFSET);
+   lastReadyTime = ADC_Drv_GetReadyBufferTime();
+
+   // The time passes without the scheduled functions, as in a long interrupt
+   for (uint32_t i = 0U; i < STALL_MILLISECONDS; i++)
+   {
+      Host_Drv_AdvanceTime(1000U);
+   }
+   Test_Harness_Run(1U);
+
+   // Only the newest buffer is handed over, the others count as overruns
+   const uint32_t readyTime = ADC_Drv_GetReadyBufferTime();
+   const uint32_t numSkipped = ((readyTime - lastReadyTime) / CYCLES_PER_BUFFER) - 1U;
+
+   TEST_CHECK(numSkipped >= ((STALL_MILLISECONDS / ((1000U * ADC_DRV_SAMPLES_PER_BUFFER) / ADC_DRV_SAMPLE_RATE_HZ)) - 1U));
+   TEST_CHECK(IsBufferInOrder(ADC_Drv_GetReadyBuffer(), (readyTime - firstReadyTime) / CYCLES_PER_SCAN));
+   TEST_CHECK(GetStatusCounter(STATUS_NUM_OVERRUNS_OFFSET) == numSkipped);
+   TEST_CHECK(GetStatusCounter(STATUS_NUM_BUFFERS_OFFSET) >= (numBuffers + numSkipped + 1U));
+
+   Host_Drv_ReplayADC(NULL, 0U);
+   free(waveform);
+
+   return(Test_Harness_Finish());
+}
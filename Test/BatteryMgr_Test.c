@@ -0,0 +1,440 @@
+/*******************************************************************************
+// Battery Manager Test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Test_Harness.h"
+// Platform Includes
+#include "BatteryMgr.h"
+#include "Lunar_ErrorMgr.h"
+// Other Includes
+#include "Lunar_CANTransport_Config.h"
+#include "ReportMgr_CAN.h"
+#include <stdlib.h> // rand
+#include <string.h> // memset
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The lowest bit of the node ID in the identifier of a battery block report
+#define NODE_ID_SCALE (LUNAR_CANTRANSPORT_BB_NODE_ID_MASK & (~LUNAR_CANTRANSPORT_BB_NODE_ID_MASK + 1U))
+
+// The cycles of the battery block reports
+#define STATUS_PERIOD_MILLISECONDS (100U)
+#define CELL_PERIOD_MILLISECONDS (500U)
+#define ERROR_PERIOD_MILLISECONDS (1000U)
+
+// The number of cell voltage reports of a block and the cells in each
+#define NUM_CELL_REPORTS (3U)
+#define CELLS_PER_REPORT (4U)
+
+// A report is only known to be current or timed out once the 100 ms update
+// ran, so no comparison is made while a report is this close to its timeout
+#define TIMEOUT_MARGIN_MILLISECONDS (100U)
+
+// Timeline of the test
+#define FIRST_DROPOUT_START_MILLISECONDS (10000U)
+#define FIRST_DROPOUT_END_MILLISECONDS (25000U)
+#define FAULT_START_MILLISECONDS (30000U)
+#define FAULT_END_MILLISECONDS (35000U)
+#define SECOND_DROPOUT_START_MILLISECONDS (40000U)
+#define CLEAR_LOST_NODES_MILLISECONDS (50000U)
+#define RUN_MILLISECONDS (52000U)
+
+// The blocks that report a fault for a while
+#define FAULT_STATE_NODE_ID (3U)
+#define ACTIVE_ERRORS_NODE_ID (4U)
+
+// The Battery Manager in the Message Router and its Clear Lost Nodes command
+#define BATTERYMGR_MODULE_ID (0x0DU)
+#define BATTERYMGR_COMMAND_CLEAR_LOST_NODES (0x03U)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// This structure holds what the test sent for a single battery block
+typedef struct
+{
+   // true once the block sent its status, until it is cleared as lost
+   bool hasStatus;
+   uint32_t statusTime;
+   int16_t current;
+   uint16_t soc;
+   uint16_t state;
+
+   uint32_t activeErrors;
+
+   // Bit i is set once cell voltage report i was sent
+   uint8_t cellReports;
+   uint32_t cellReportTime[NUM_CELL_REPORTS];
+   uint16_t cellVoltage[NUM_CELL_REPORTS * CELLS_PER_REPORT];
+} Node_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// What was sent for each battery block, indexed by node ID
+static Node_t nodes[BATTERYMGR_NUM_NODES];
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function returns whether a block is reporting at a time of the
+  *    test.  Blocks drop out for a while and some do not come back.
+  * Parameters:
+  *    nodeId :  The node ID of the block
+  *    time :    Milliseconds since the start of the reports
+  * Returns:
+  *    bool - true if the block sends its reports
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool IsReporting(const uint8_t nodeId, const uint32_t time);
+
+/** Description:
+  *    This function sends the reports of a block that are due.
+  * Parameters:
+  *    nodeId :  The node ID of the block
+  *    time :    Milliseconds since the start of the reports
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void SendReports(const uint8_t nodeId, const uint32_t time);
+
+/** Description:
+  *    This function sends a battery block report with the node ID in the
+  *    identifier.
+  * Parameters:
+  *    canId :   The identifier of the report without the node ID
+  *    nodeId :  The node ID of the block
+  *    data :    The packed signals
+  *    length :  The number of data bytes
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void SendFrame(const uint32_t canId, const uint8_t nodeId, const uint8_t *const data, const uint8_t length);
+
+/** Description:
+  *    This function computes the summary from everything that was sent and
+  *    compares it with the summary of the Battery Manager.
+  * Parameters:
+  *    time :      Milliseconds since the start of the reports
+  *    isCompared : Set to false if a report is too close to its timeout to compare
+  * Returns:
+  *    bool - true if the summaries match
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool CompareSummary(const uint32_t time, bool *const isCompared);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Check whether a block is reporting
+static bool IsReporting(const uint8_t nodeId, const uint32_t time)
+{
+   bool isReporting = true;
+
+   if (((nodeId % 7U) == 0U) && (time >= FIRST_DROPOUT_START_MILLISECONDS) && (time < FIRST_DROPOUT_END_MILLISECONDS))
+   {
+      isReporting = false;
+   }
+   else if (((nodeId % 5U) == 1U) && (time >= SECOND_DROPOUT_START_MILLISECONDS))
+   {
+      isReporting = false;
+   }
+   else
+   {
+      // The block reports
+   }
+
+   return(isReporting);
+}
+
+// Send the reports of a block
+static void SendReports(const uint8_t nodeId, const uint32_t time)
+{
+   Node_t *const node = &nodes[nodeId];
+   const bool isFaultTime = (time >= FAULT_START_MILLISECONDS) && (time < FAULT_END_MILLISECONDS);
+   uint8_t data[CAN_DRV_MAX_DATA_LENGTH];
+
+   // The blocks are spread over the cycle as they start at different times
+   if (((time + (3U * nodeId)) % STATUS_PERIOD_MILLISECONDS) == 0U)
+   {
+      BB_BatteryStatusRSP_t signals;
+
+      signals.BatteryBlockState = ((nodeId == FAULT_STATE_NODE_ID) && isFaultTime) ? (uint16_t)BB_STATE_ENUM_Fault : (uint16_t)BB_STATE_ENUM_Connected;
+      signals.BatteryVoltageV = (uint16_t)(48000 + (rand() % 8000));
+      signals.BatteryCurrentA = (int16_t)((rand() % 4001) - 2000);
+      signals.BatterySOC = (uint16_t)(rand() % 1001);
+
+      BB_BatteryStatusRSP_Pack(data, &signals);
+      SendFrame(BB_BatteryStatusRSP_CANID, nodeId, data, BB_BatteryStatusRSP_DLC);
+
+      node->hasStatus = true;
+      node->statusTime = time;
+      node->current = signals.BatteryCurrentA;
+      node->soc = signals.BatterySOC;
+      node->state = signals.BatteryBlockState;
+   }
+
+   for (uint32_t report = 0U; report < NUM_CELL_REPORTS; report++)
+   {
+      if (((time + (3U * nodeId) + 40U + (20U * report)) % CELL_PERIOD_MILLISECONDS) == 0U)
+      {
+         uint16_t *const cells = &node->cellVoltage[report * CELLS_PER_REPORT];
+
+         for (uint32_t i = 0U; i < CELLS_PER_REPORT; i++)
+         {
+            cells[i] = (uint16_t)(3000 + (rand() % 1201));
+         }
+
+         if (report == 0U)
+         {
+            const BB_CellVoltage1to4RSP_t signals = { cells[0], cells[1], cells[2], cells[3] };
+            BB_CellVoltage1to4RSP_Pack(data, &signals);
+            SendFrame(BB_CellVoltage1to4RSP_CANID, nodeId, data, BB_CellVoltage1to4RSP_DLC);
+         }
+         else if (report == 1U)
+         {
+            const BB_CellVoltage5to8RSP_t signals = { cells[0], cells[1], cells[2], cells[3] };
+            BB_CellVoltage5to8RSP_Pack(data, &signals);
+            SendFrame(BB_CellVoltage5to8RSP_CANID, nodeId, data, BB_CellVoltage5to8RSP_DLC);
+         }
+         else
+         {
+            const BB_CellVoltage9to12RSP_t signals = { cells[0], cells[1], cells[2], cells[3] };
+            BB_CellVoltage9to12RSP_Pack(data, &signals);
+            SendFrame(BB_CellVoltage9to12RSP_CANID, nodeId, data, BB_CellVoltage9to12RSP_DLC);
+         }
+
+         node->cellReports |= (uint8_t)(1U << report);
+         node->cellReportTime[report] = time;
+      }
+   }
+
+   if (((time + (3U * nodeId) + 50U) % ERROR_PERIOD_MILLISECONDS) == 0U)
+   {
+      BB_ErrorStatusRSP_t signals;
+
+      memset(&signals, 0, sizeof(signals));
+      signals.ActiveErrors = ((nodeId == ACTIVE_ERRORS_NODE_ID) && isFaultTime) ? 0x10U : 0U;
+
+      BB_ErrorStatusRSP_Pack(data, &signals);
+      SendFrame(BB_ErrorStatusRSP_CANID, nodeId, data, BB_ErrorStatusRSP_DLC);
+
+      node->activeErrors = signals.ActiveErrors;
+   }
+}
+
+// Send a battery block report
+static void SendFrame(const uint32_t canId, const uint8_t nodeId, const uint8_t *const data, const uint8_t length)
+{
+   CAN_Drv_Frame_t frame;
+
+   memset(&frame, 0, sizeof(frame));
+   frame.canId = (canId + ((uint32_t)nodeId * NODE_ID_SCALE)) | CAN_DRV_EXTENDED_ID;
+   frame.length = length;
+   memcpy(frame.data, data, length);
+
+   TEST_CHECK(Host_Drv_ReceiveCAN(&frame));
+}
+
+// Compare the summary with a full recompute
+static bool CompareSummary(const uint32_t time, bool *const isCompared)
+{
+   BatteryMgr_Summary_t summary;
+   BatteryMgr_Summary_t expected;
+
+   memset(&expected, 0, sizeof(expected));
+   expected.minCellVoltage = UINT16_MAX;
+   expected.worstSoc = UINT16_MAX;
+   *isCompared = true;
+
+   for (uint8_t nodeId = 0U; nodeId < BATTERYMGR_NUM_NODES; nodeId++)
+   {
+      const Node_t *const node = &nodes[nodeId];
+
+      if (node->hasStatus)
+      {
+         const uint32_t age = time - node->statusTime;
+
+         *isCompared = *isCompared && ((age + TIMEOUT_MARGIN_MILLISECONDS) <= BATTERYMGR_STATUS_TIMEOUT_MS ||
+                                       (age >= (BATTERYMGR_STATUS_TIMEOUT_MS + TIMEOUT_MARGIN_MILLISECONDS)));
+
+         if (age < BATTERYMGR_STATUS_TIMEOUT_MS)
+         {
+            expected.numOnlineNodes++;
+            expected.totalCurrent += node->current;
+            expected.worstSoc = (node->soc < expected.worstSoc) ? node->soc : expected.worstSoc;
+         }
+         else
+         {
+            expected.numLostNodes++;
+         }
+      }
+
+      if ((node->state == (uint16_t)BB_STATE_ENUM_Fault) || (node->activeErrors != 0U))
+      {
+         expected.numFaultedNodes++;
+      }
+
+      for (uint32_t report = 0U; report < NUM_CELL_REPORTS; report++)
+      {
+         const uint32_t age = time - node->cellReportTime[report];
+
+         if ((node->cellReports & (1U << report)) != 0U)
+         {
+            *isCompared = *isCompared && ((age + TIMEOUT_MARGIN_MILLISECONDS) <= BATTERYMGR_CELL_TIMEOUT_MS ||
+                                          (age >= (BATTERYMGR_CELL_TIMEOUT_MS + TIMEOUT_MARGIN_MILLISECONDS)));
+         }
+
+         if (((node->cellReports & (1U << report)) != 0U) && (age < BATTERYMGR_CELL_TIMEOUT_MS))
+         {
+            for (uint32_t i = 0U; i < CELLS_PER_REPORT; i++)
+            {
+               const uint16_t voltage = node->cellVoltage[(report * CELLS_PER_REPORT) + i];
+
+               expected.minCellVoltage = (voltage < expected.minCellVoltage) ? voltage : expected.minCellVoltage;
+               expected.maxCellVoltage = (voltage > expected.maxCellVoltage) ? voltage : expected.maxCellVoltage;
+            }
+         }
+      }
+   }
+
+   BatteryMgr_GetSummary(&summary);
+
+   bool isMatch = (summary.totalCurrent == expected.totalCurrent) && (summary.numOnlineNodes == expected.numOnlineNodes) &&
+                  (summary.numLostNodes == expected.numLostNodes) && (summary.numFaultedNodes == expected.numFaultedNodes);
+
+   // The node of a value may be any block that holds it
+   if (expected.numOnlineNodes == 0U)
+   {
+      isMatch = isMatch && (summary.worstSocNodeId == BATTERYMGR_NO_NODE);
+   }
+   else
+   {
+      isMatch = isMatch && (summary.worstSoc == expected.worstSoc) && (summary.worstSocNodeId < BATTERYMGR_NUM_NODES) &&
+                (nodes[summary.worstSocNodeId].soc == expected.worstSoc);
+   }
+
+   if (expected.maxCellVoltage == 0U)
+   {
+      isMatch = isMatch && (summary.minCellNodeId == BATTERYMGR_NO_NODE) && (summary.maxCellNodeId == BATTERYMGR_NO_NODE);
+   }
+   else
+   {
+      isMatch = isMatch && (summary.minCellVoltage == expected.minCellVoltage) && (summary.maxCellVoltage == expected.maxCellVoltage) &&
+                (summary.minCellNodeId < BATTERYMGR_NUM_NODES) && (summary.maxCellNodeId < BATTERYMGR_NUM_NODES);
+   }
+
+   if ((*isCompared) && (!isMatch))
+   {
+      printf("%u ms: current %d/%d online %u/%u lost %u/%u faulted %u/%u soc %u/%u cells %u-%u/%u-%u\n", (unsigned)time,
+             (int)summary.totalCurrent, (int)expected.totalCurrent, summary.numOnlineNodes, expected.numOnlineNodes,
+             summary.numLostNodes, expected.numLostNodes, summary.numFaultedNodes, expected.numFaultedNodes,
+             summary.worstSoc, expected.worstSoc, summary.minCellVoltage, summary.maxCellVoltage,
+             expected.minCellVoltage, expected.maxCellVoltage);
+   }
+
+   return((!*isCompared) || isMatch);
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Test entry point
+int main(void)
+{
+   uint8_t response[8];
+   uint32_t numCompared = 0U;
+   uint32_t numMismatches = 0U;
+
+   srand(1U);
+   memset(nodes, 0, sizeof(nodes));
+   Test_Harness_Start();
+
+   //-----------------------------------------------
+   // The summary matches a full recompute at every step
+   //-----------------------------------------------
+
+   for (uint32_t time = 0U; time < RUN_MILLISECONDS; time++)
+   {
+      bool isCompared = false;
+
+      for (uint8_t nodeId = 0U; nodeId < BATTERYMGR_NUM_NODES; nodeId++)
+      {
+         if (IsReporting(nodeId, time))
+         {
+            SendReports(nodeId, time);
+         }
+      }
+
+      Test_Harness_Run(1U);
+
+      if (!CompareSummary(time, &isCompared))
+      {
+         numMismatches++;
+      }
+      numCompared += (isCompared) ? 1U : 0U;
+
+      // Lost blocks are a battery fault until they report again
+      if ((time == (FIRST_DROPOUT_END_MILLISECONDS - 1U)) || (time == (CLEAR_LOST_NODES_MILLISECONDS - 1U)))
+      {
+         TEST_CHECK(Lunar_ErrorMgr_GetErrorState(LUNAR_ERRORMGR_ERROR_BATTERY_FAULT));
+      }
+      else if ((time == (FAULT_START_MILLISECONDS - 1U)) || (time == (RUN_MILLISECONDS - 1U)))
+      {
+         TEST_CHECK(!Lunar_ErrorMgr_GetErrorState(LUNAR_ERRORMGR_ERROR_BATTERY_FAULT));
+      }
+      else if (time == (FAULT_END_MILLISECONDS - 1U))
+      {
+         TEST_CHECK(Lunar_ErrorMgr_GetErrorState(LUNAR_ERRORMGR_ERROR_BATTERY_FAULT));
+      }
+      else if (time == CLEAR_LOST_NODES_MILLISECONDS)
+      {
+         // The blocks that did not come back are forgotten.  The command runs
+         // the firmware for a few milliseconds, well within the margin.
+         TEST_CHECK(Test_Harness_SendCommand((UART_Drv_Channel_t)0, BATTERYMGR_MODULE_ID, BATTERYMGR_COMMAND_CLEAR_LOST_NODES, NULL, 0U, response, sizeof(response)) == 0);
+
+         for (uint8_t nodeId = 0U; nodeId < BATTERYMGR_NUM_NODES; nodeId++)
+         {
+            if (!IsReporting(nodeId, time))
+            {
+               memset(&nodes[nodeId], 0, sizeof(Node_t));
+            }
+         }
+      }
+      else
+      {
+         // Nothing else to check
+      }
+   }
+
+   printf("%u of %u steps compared\n", (unsigned)numCompared, (unsigned)RUN_MILLISECONDS);
+   TEST_CHECK(numMismatches == 0U);
+   TEST_CHECK(numCompared > (RUN_MILLISECONDS / 2U));
+
+   return(Test_Harness_Finish());
+}
@@ -0,0 +1,782 @@
+/*******************************************************************************
+// CAN Driver Test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Test_Harness.h"
+// Platform Includes
+#include "CAN_Drv_Config.h"
+#include "Lunar_MessageRouter.h"
+#include "Timebase_Drv.h"
+#include "Lunar_CANTransport_Config.h"
+// Other Includes
+#include "Lunar_Main_ConfigTable.h"
+#include <fcntl.h> // fcntl
+#include <linux/can.h> // SocketCAN frames
+#include <net/if.h> // if_nametoindex
+#include <stdlib.h> // EXIT_SUCCESS, qsort
+#include <string.h> // memset
+#include <sys/socket.h> // socket, bind
+#include <unistd.h> // read, write, close
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// Exit code that tells ctest the test was skipped
+#define EXIT_SKIPPED (77)
+
+// Router ID of the Main module's Get Product ID command
+#define GET_PRODUCT_ID_ROUTER_ID (0x0102U)
+
+// A standard identifier none of the board filters accept
+#define UNFILTERED_CANID (0x123U)
+
+// Time to wait for a response
+#define RESPONSE_TIMEOUT_MILLISECONDS (100U)
+
+// Low priority frames that fill the transmit message objects
+#define FILLER_CANID (0x1FFFFFF0U | CAN_DRV_EXTENDED_ID)
+
+// Frames of another node that hold the bus, 111 bits or 222 us each at 500 kbit/s
+#define BUS_HOLD_FRAME_LENGTH (8U)
+#define BUS_HOLD_FRAME_MICROSECONDS (222U)
+
+// Offsets in the response of the traffic statistics handler
+#define TRAFFIC_RX_BITS_PER_SECOND_OFFSET (8U)
+#define TRAFFIC_TX_BITS_PER_SECOND_OFFSET (12U)
+#define TRAFFIC_RX_FRAMES_PER_SECOND_OFFSET (16U)
+#define TRAFFIC_TX_FRAMES_PER_SECOND_OFFSET (18U)
+#define TRAFFIC_BUS_LOAD_OFFSET (20U)
+#define TRAFFIC_PEAK_BUS_LOAD_OFFSET (22U)
+#define TRAFFIC_NUM_TX_REPLACED_OFFSET (36U)
+#define TRAFFIC_NUM_TX_ABORTED_OFFSET (40U)
+
+// Offsets in the response of the latency statistics handler
+#define LATENCY_MEDIAN_OFFSET (0U)
+#define LATENCY_90TH_OFFSET (4U)
+#define LATENCY_99TH_OFFSET (8U)
+#define LATENCY_MAX_OFFSET (12U)
+
+// Offsets in the response of the error statistics handler
+#define ERROR_TRANSMIT_ERROR_COUNT_OFFSET (0U)
+#define ERROR_RECEIVE_ERROR_COUNT_OFFSET (1U)
+#define ERROR_MAX_TRANSMIT_ERROR_COUNT_OFFSET (2U)
+#define ERROR_MAX_RECEIVE_ERROR_COUNT_OFFSET (3U)
+#define ERROR_LAST_ERROR_CODE_OFFSET (4U)
+#define ERROR_IS_BUS_OFF_OFFSET (5U)
+#define ERROR_IS_ERROR_WARNING_OFFSET (6U)
+#define ERROR_NUM_BUS_ERRORS_OFFSET (8U)
+#define ERROR_NUM_ERROR_WARNINGS_OFFSET (12U)
+#define ERROR_NUM_BUS_OFF_EVENTS_OFFSET (16U)
+#define ERROR_NUM_BUS_OFF_RECOVERIES_OFFSET (20U)
+#define ERROR_NUM_TX_ARBITRATION_DELAYS_OFFSET (24U)
+
+// The interval of the frame rates and the bus load
+#define RATE_INTERVAL_MILLISECONDS (1000U)
+
+// A frame the board filters accept and its number of bits, an extended
+// identifier with 8 data bytes
+#define LOAD_RX_CANID (LUNAR_CANTRANSPORT_REQUEST_CANID | 0x0F00U | CAN_DRV_EXTENDED_ID)
+#define LOAD_RX_FRAME_BITS (67U + 64U)
+
+// A sent frame and its number of bits, a standard identifier with 4 data bytes
+#define LOAD_TX_CANID (0x100U)
+#define LOAD_TX_FRAME_LENGTH (4U)
+#define LOAD_TX_FRAME_BITS (47U + 32U)
+
+// The bit rate of the boards
+#define BUS_BITS_PER_SECOND (500000U)
+
+// Frames sent to measure the latency percentiles
+#define NUM_LATENCY_FRAMES (100U)
+
+// The histogram of the driver: the first bucket ends at 4096 cycles, each
+// following one is twice as wide and the last has no upper limit
+#define FIRST_LATENCY_BUCKET_CYCLES (4096U)
+#define NUM_LATENCY_BUCKETS (12U)
+
+// Size of the response buffer used to call the statistics handlers
+#define MAX_RESPONSE_LENGTH (64U)
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The socket of the other node when a SocketCAN interface is tested, -1 for
+// the simulated bus
+static int peerSocket = -1;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function opens a second socket on the interface that acts as the
+  *    other node of the bus.
+  * Parameters:
+  *    interfaceName :  The SocketCAN interface
+  * Returns:
+  *    bool - true if the socket was opened
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool OpenPeer(const char *const interfaceName);
+
+/** Description:
+  *    This function sends a frame from the other node to the firmware.
+  * Parameters:
+  *    frame :  The frame to be sent
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void SendToFirmware(const CAN_Drv_Frame_t *const frame);
+
+/** Description:
+  *    This function receives a frame sent by the firmware at the other node.
+  * Parameters:
+  *    frame :  Destination for the frame
+  * Returns:
+  *    bool - true if a frame was received
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool TakeFromFirmware(CAN_Drv_Frame_t *const frame);
+
+/** Description:
+  *    This function runs the CAN driver alone, without the other modules,
+  *    so no report is queued in between.
+  * Parameters:
+  *    milliseconds :  The time to run, one update per millisecond
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void RunDriver(const uint32_t milliseconds);
+
+/** Description:
+  *    This function sends frames of another node that the board filters do
+  *    not accept, so they only occupy the simulated bus.
+  * Parameters:
+  *    numFrames :  The number of frames, BUS_HOLD_FRAME_MICROSECONDS each
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void SendOtherNodeFrames(const uint32_t numFrames);
+
+/** Description:
+  *    This function occupies the simulated bus with frames of another node
+  *    that the board filters do not accept.
+  * Parameters:
+  *    milliseconds :  The time the bus is busy from now
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void HoldBus(const uint32_t milliseconds);
+
+/** Description:
+  *    This function restarts the driver and loads every transmit message
+  *    object that is not reserved with a low priority frame.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void FillTxObjects(void);
+
+/** Description:
+  *    This function calls a statistics handler of the driver and reads a
+  *    little endian value from the response.
+  * Parameters:
+  *    handler :  The Message Router handler
+  *    offset :   The offset of the value in the response
+  *    size :     The size of the value in bytes, 1 to 4
+  * Returns:
+  *    uint32_t - The value, 0 if the handler failed
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *    * 10/19/2026: Read 8 and 16-bit values (EJH)
+  *
+*/
+static uint32_t ReadStatistic(void (*handler)(Lunar_MessageRouter_Message_t *const message), const uint32_t offset, const uint32_t size);
+
+/** Description:
+  *    This function finds the latency the driver reports for a percentile
+  *    from the exact latencies: the upper limit of the histogram bucket
+  *    holding the percentile, or the largest latency if that is lower.
+  * Parameters:
+  *    latencies :     The latencies in CPU cycles, sorted
+  *    numLatencies :  The number of latencies
+  *    percentile :    The share of the frames in percent (1-100)
+  * Returns:
+  *    uint32_t - The expected latency in microseconds
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint32_t GetExpectedPercentile(const uint32_t *const latencies, const uint32_t numLatencies, const uint32_t percentile);
+
+/** Description:
+  *    This function compares two latencies for qsort.
+  * Parameters:
+  *    a :  The first latency
+  *    b :  The second latency
+  * Returns:
+  *    int - Negative, 0 or positive as for qsort
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static int CompareLatencies(const void *a, const void *b);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Open the socket of the other node
+static bool OpenPeer(const char *const interfaceName)
+{
+   struct sockaddr_can address;
+
+   memset(&address, 0, sizeof(address));
+   address.can_family = AF_CAN;
+   address.can_ifindex = (int)if_nametoindex(interfaceName);
+
+   peerSocket = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+
+   return((peerSocket >= 0) && (fcntl(peerSocket, F_SETFL, O_NONBLOCK) == 0) &&
+          (bind(peerSocket, (struct sockaddr *)&address, sizeof(address)) == 0));
+}
+
+// Send a frame to the firmware
+static void SendToFirmware(const CAN_Drv_Frame_t *const frame)
+{
+   if (peerSocket >= 0)
+   {
+      struct can_frame socketFrame;
+
+      memset(&socketFrame, 0, sizeof(socketFrame));
+      socketFrame.can_id = ((frame->canId & CAN_DRV_EXTENDED_ID) != 0U) ? ((frame->canId & CAN_EFF_MASK) | CAN_EFF_FLAG) : frame->canId;
+      socketFrame.can_dlc = frame->length;
+      memcpy(socketFrame.data, frame->data, frame->length);
+      TEST_CHECK(write(peerSocket, &socketFrame, sizeof(socketFrame)) == (ssize_t)sizeof(socketFrame));
+   }
+   else
+   {
+      (void)Host_Drv_ReceiveCAN(frame);
+   }
+}
+
+// Receive a frame from the firmware
+static bool TakeFromFirmware(CAN_Drv_Frame_t *const frame)
+{
+   bool taken = false;
+
+   if (peerSocket >= 0)
+   {
+      struct can_frame socketFrame;
+
+      if (read(peerSocket, &socketFrame, sizeof(socketFrame)) == (ssize_t)sizeof(socketFrame))
+      {
+         memset(frame, 0, sizeof(*frame));
+         frame->canId = ((socketFrame.can_id & CAN_EFF_FLAG) != 0U) ? ((socketFrame.can_id & CAN_EFF_MASK) | CAN_DRV_EXTENDED_ID) : socketFrame.can_id;
+         frame->length = socketFrame.can_dlc;
+         memcpy(frame->data, socketFrame.data, socketFrame.can_dlc);
+         taken = true;
+      }
+   }
+   else
+   {
+      taken = Host_Drv_TakeCANOutput(frame);
+   }
+
+   return(taken);
+}
+
+// Run the driver without the other modules
+static void RunDriver(const uint32_t milliseconds)
+{
+   for (uint32_t elapsed = 0U; elapsed < milliseconds; elapsed++)
+   {
+      Host_Drv_AdvanceTime(1000U);
+      CAN_Drv_Update();
+   }
+}
+
+// Send frames that only occupy the bus
+static void SendOtherNodeFrames(const uint32_t numFrames)
+{
+   CAN_Drv_Frame_t frame;
+
+   memset(&frame, 0, sizeof(frame));
+   frame.canId = UNFILTERED_CANID;
+   frame.length = BUS_HOLD_FRAME_LENGTH;
+
+   for (uint32_t i = 0U; i < numFrames; i++)
+   {
+      TEST_CHECK(!Host_Drv_ReceiveCAN(&frame));
+   }
+}
+
+// Occupy the bus with frames of another node
+static void HoldBus(const uint32_t milliseconds)
+{
+   SendOtherNodeFrames(((milliseconds * 1000U) + BUS_HOLD_FRAME_MICROSECONDS - 1U) / BUS_HOLD_FRAME_MICROSECONDS);
+}
+
+// Restart the driver and load the objects with low priority frames
+static void FillTxObjects(void)
+{
+   static const uint8_t data[1] = { 0xF0U };
+
+   CAN_Drv_Init();
+   for (uint32_t index = 0U; index < (CAN_DRV_NUM_TX_MSG_OBJS - CAN_DRV_NUM_RESERVED_TX_MSG_OBJS); index++)
+   {
+      TEST_CHECK(CAN_Drv_StartTransmitFrame(CAN_DRV_CHANNEL_PRIMARY, FILLER_CANID + index, data, sizeof(data)));
+   }
+}
+
+// Read a value of a statistics handler
+static uint32_t ReadStatistic(void (*handler)(Lunar_MessageRouter_Message_t *const message), const uint32_t offset, const uint32_t size)
+{
+   uint8_t responseData[MAX_RESPONSE_LENGTH];
+   Lunar_MessageRouter_Message_t message;
+   uint32_t value = 0U;
+
+   memset(&message, 0, sizeof(message));
+   message.responseParams.data = responseData;
+   message.responseParams.maxLength = sizeof(responseData);
+   message.responseCode = LUNAR_MESSAGEROUTER_RESPONSE_CODE_None;
+
+   handler(&message);
+
+   if (TEST_CHECK((message.responseCode == LUNAR_MESSAGEROUTER_RESPONSE_CODE_None) && (message.responseParams.length >= (offset + size))))
+   {
+      for (uint32_t byteIdx = 0U; byteIdx < size; byteIdx++)
+      {
+         value |= (uint32_t)responseData[offset + byteIdx] << (8U * byteIdx);
+      }
+   }
+
+   return(value);
+}
+
+// Find the reported latency of a percentile
+static uint32_t GetExpectedPercentile(const uint32_t *const latencies, const uint32_t numLatencies, const uint32_t percentile)
+{
+   const uint32_t latency = latencies[(((numLatencies * percentile) + 99U) / 100U) - 1U];
+   const uint32_t maxLatency = latencies[numLatencies - 1U];
+   uint32_t bucketLimit = FIRST_LATENCY_BUCKET_CYCLES;
+   uint32_t bucket = 0U;
+
+   while ((bucket < (NUM_LATENCY_BUCKETS - 1U)) && (latency >= bucketLimit))
+   {
+      bucket++;
+      bucketLimit <<= 1U;
+   }
+
+   if ((bucket == (NUM_LATENCY_BUCKETS - 1U)) || (maxLatency < bucketLimit))
+   {
+      bucketLimit = maxLatency;
+   }
+
+   return(bucketLimit / (HOST_DRV_CYCLES_PER_SECOND / 1000000U));
+}
+
+// Compare two latencies
+static int CompareLatencies(const void *a, const void *b)
+{
+   const uint32_t latencyA = *(const uint32_t *)a;
+   const uint32_t latencyB = *(const uint32_t *)b;
+
+   return((latencyA > latencyB) - (latencyA < latencyB));
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Test entry point
+//   CAN_Drv_Test              tests the simulated bus
+//   CAN_Drv_Test interface    tests the SocketCAN backend on the interface, e.g. vcan0
+int main(int argc, char **argv)
+{
+   CAN_Drv_Frame_t frame;
+   CAN_Drv_Frame_t *receivedFrame;
+
+   if (argc > 1)
+   {
+      if ((!Host_Drv_OpenCAN(argv[1])) || (!OpenPeer(argv[1])))
+      {
+         printf("SocketCAN interface %s is not available, test skipped\n", argv[1]);
+         return(EXIT_SKIPPED);
+      }
+   }
+
+   Test_Harness_Start();
+
+   //-----------------------------------------------
+   // Acceptance filters
+   //-----------------------------------------------
+
+   // Frames outside the board filters are not received
+   memset(&frame, 0, sizeof(frame));
+   frame.canId = UNFILTERED_CANID;
+   frame.length = 2U;
+   SendToFirmware(&frame);
+   CAN_Drv_Update();
+   TEST_CHECK(CAN_Drv_PeekFrame(CAN_DRV_CHANNEL_PRIMARY) == 0);
+
+   // Frames that pass a filter are received with their identifier and data
+   frame.canId = LUNAR_CANTRANSPORT_REQUEST_CANID | 0x0F00U | CAN_DRV_EXTENDED_ID;
+   frame.length = 3U;
+   frame.data[0] = 0x11U;
+   frame.data[1] = 0x22U;
+   frame.data[2] = 0x33U;
+   SendToFirmware(&frame);
+   CAN_Drv_Update();
+   receivedFrame = CAN_Drv_PeekFrame(CAN_DRV_CHANNEL_PRIMARY);
+   if (TEST_CHECK(receivedFrame != 0))
+   {
+      TEST_CHECK(receivedFrame->canId == frame.canId);
+      TEST_CHECK(receivedFrame->length == frame.length);
+      TEST_CHECK(memcmp(receivedFrame->data, frame.data, frame.length) == 0);
+      CAN_Drv_ReleaseFrame(CAN_DRV_CHANNEL_PRIMARY);
+   }
+
+   //-----------------------------------------------
+   // Message Router request and response
+   //-----------------------------------------------
+
+   memset(&frame, 0, sizeof(frame));
+   frame.canId = (LUNAR_CANTRANSPORT_REQUEST_CANID + GET_PRODUCT_ID_ROUTER_ID) | CAN_DRV_EXTENDED_ID;
+   SendToFirmware(&frame);
+
+   bool isResponseReceived = false;
+
+   for (uint32_t elapsed = 0U; (elapsed < RESPONSE_TIMEOUT_MILLISECONDS) && (!isResponseReceived); elapsed++)
+   {
+      Test_Harness_Run(1U);
+
+      while ((!isResponseReceived) && TakeFromFirmware(&frame))
+      {
+         isResponseReceived = (frame.canId == ((LUNAR_CANTRANSPORT_RESPONSE_CANID + GET_PRODUCT_ID_ROUTER_ID) | CAN_DRV_EXTENDED_ID));
+      }
+   }
+
+   if (TEST_CHECK(isResponseReceived))
+   {
+      TEST_CHECK(frame.length == 4U);
+      TEST_CHECK((frame.data[0] | ((uint32_t)frame.data[1] << 8) | ((uint32_t)frame.data[2] << 16) | ((uint32_t)frame.data[3] << 24)) == mainConfigTable.productId);
+   }
+
+   //-----------------------------------------------
+   // Transmit
+   //-----------------------------------------------
+
+   // Every queued frame reaches the bus once and is no longer pending
+   static const uint8_t data[1] = { 0x5AU };
+   uint32_t numFrames = 0U;
+
+   while (TakeFromFirmware(&frame))
+   {
+      // Drop the reports sent so far
+   }
+
+   TEST_CHECK(CAN_Drv_StartTransmitFrame(CAN_DRV_CHANNEL_PRIMARY, 0x300U, data, sizeof(data)));
+   TEST_CHECK(CAN_Drv_StartTransmitFrame(CAN_DRV_CHANNEL_PRIMARY, 0x200U, data, sizeof(data)));
+   TEST_CHECK(CAN_Drv_StartTransmitFrame(CAN_DRV_CHANNEL_PRIMARY, 0x100U, data, sizeof(data)));
+   Test_Harness_Run(5U);
+
+   while (TakeFromFirmware(&frame))
+   {
+      if ((frame.canId == 0x100U) || (frame.canId == 0x200U) || (frame.canId == 0x300U))
+      {
+         TEST_CHECK((frame.length == 1U) && (frame.data[0] == data[0]));
+         numFrames++;
+      }
+   }
+   TEST_CHECK(numFrames == 3U);
+   TEST_CHECK(!CAN_Drv_IsTransmitPending(CAN_DRV_CHANNEL_PRIMARY, 0x100U));
+
+   // The scheduling depends on the timing of the simulated bus
+   if (peerSocket < 0)
+   {
+      //-----------------------------------------------
+      // Transmit priority
+      //-----------------------------------------------
+
+      // The queue sends in the order of the arbitration: a standard identifier
+      // before an extended one with the same base bits, and an extended one
+      // before a standard one with higher base bits
+      static const uint32_t priorityOrder[] = { 0x068U, 0x1A00000U | CAN_DRV_EXTENDED_ID, 0x1A10000U | CAN_DRV_EXTENDED_ID, 0x7FFU };
+      uint32_t numInOrder = 0U;
+
+      FillTxObjects();
+      HoldBus(5U);
+      TEST_CHECK(CAN_Drv_StartTransmitFrame(CAN_DRV_CHANNEL_PRIMARY, priorityOrder[3], data, sizeof(data)));
+      TEST_CHECK(CAN_Drv_StartTransmitFrame(CAN_DRV_CHANNEL_PRIMARY, priorityOrder[2], data, sizeof(data)));
+      TEST_CHECK(CAN_Drv_StartTransmitFrame(CAN_DRV_CHANNEL_PRIMARY, priorityOrder[0], data, sizeof(data)));
+      TEST_CHECK(CAN_Drv_StartTransmitFrame(CAN_DRV_CHANNEL_PRIMARY, priorityOrder[1], data, sizeof(data)));
+      RunDriver(10U);
+
+      while (TakeFromFirmware(&frame))
+      {
+         if ((frame.canId & ~0xFU) != (FILLER_CANID & ~0xFU))
+         {
+            TEST_CHECK((numInOrder < (sizeof(priorityOrder) / sizeof(priorityOrder[0]))) && (frame.canId == priorityOrder[numInOrder]));
+            numInOrder++;
+         }
+      }
+      TEST_CHECK(numInOrder == (sizeof(priorityOrder) / sizeof(priorityOrder[0])));
+
+      // A frame that wins against the reserved limit takes the reserved
+      // object and is sent before the frames loaded earlier, a frame that
+      // loses waits for the other objects
+      uint32_t numSent = 0U;
+
+      FillTxObjects();
+      HoldBus(2U);
+      TEST_CHECK(CAN_Drv_StartTransmitFrame(CAN_DRV_CHANNEL_PRIMARY, 0x1A00100U | CAN_DRV_EXTENDED_ID, data, sizeof(data)));
+      TEST_CHECK(CAN_Drv_StartTransmitFrame(CAN_DRV_CHANNEL_PRIMARY, 0xA101U | CAN_DRV_EXTENDED_ID, data, sizeof(data)));
+      RunDriver(10U);
+
+      while (TakeFromFirmware(&frame))
+      {
+         if (numSent == 0U)
+         {
+            TEST_CHECK(frame.canId == (0xA101U | CAN_DRV_EXTENDED_ID));
+         }
+         numSent++;
+      }
+      TEST_CHECK(frame.canId == (0x1A00100U | CAN_DRV_EXTENDED_ID));
+      TEST_CHECK(numSent == (CAN_DRV_NUM_TX_MSG_OBJS + 1U));
+
+      //-----------------------------------------------
+      // Replace a queued frame
+      //-----------------------------------------------
+
+      // Only the newest data of an identifier waiting in the queue is sent
+      static const uint8_t newData[1] = { 0xA5U };
+
+      FillTxObjects();
+      HoldBus(2U);
+      TEST_CHECK(CAN_Drv_StartTransmitFrame(CAN_DRV_CHANNEL_PRIMARY, 0x1A00200U | CAN_DRV_EXTENDED_ID, data, sizeof(data)));
+      TEST_CHECK(CAN_Drv_StartTransmitFrame(CAN_DRV_CHANNEL_PRIMARY, 0x1A00200U | CAN_DRV_EXTENDED_ID, newData, sizeof(newData)));
+      TEST_CHECK(CAN_Drv_IsTransmitPending(CAN_DRV_CHANNEL_PRIMARY, 0x1A00200U | CAN_DRV_EXTENDED_ID));
+      RunDriver(10U);
+
+      numFrames = 0U;
+      while (TakeFromFirmware(&frame))
+      {
+         if (frame.canId == (0x1A00200U | CAN_DRV_EXTENDED_ID))
+         {
+            TEST_CHECK((frame.length == 1U) && (frame.data[0] == newData[0]));
+            numFrames++;
+         }
+      }
+      TEST_CHECK(numFrames == 1U);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetTrafficStatistics, TRAFFIC_NUM_TX_REPLACED_OFFSET, sizeof(uint32_t)) == 1U);
+      TEST_CHECK(!CAN_Drv_IsTransmitPending(CAN_DRV_CHANNEL_PRIMARY, 0x1A00200U | CAN_DRV_EXTENDED_ID));
+
+      //-----------------------------------------------
+      // Abort
+      //-----------------------------------------------
+
+      // A low priority frame that waited CAN_DRV_TX_ABORT_TIME_MS on a busy bus
+      // makes room for a higher priority frame.  The object is loaded with the
+      // next update, once a frame that started before the request would be done.
+      const uint32_t abortedCanId = FILLER_CANID + (CAN_DRV_NUM_TX_MSG_OBJS - CAN_DRV_NUM_RESERVED_TX_MSG_OBJS) - 1U;
+
+      FillTxObjects();
+      HoldBus(CAN_DRV_TX_ABORT_TIME_MS + 20U);
+      RunDriver(CAN_DRV_TX_ABORT_TIME_MS + 1U);
+
+      // Nothing is aborted while no higher priority frame waits
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetTrafficStatistics, TRAFFIC_NUM_TX_ABORTED_OFFSET, sizeof(uint32_t)) == 0U);
+
+      TEST_CHECK(CAN_Drv_StartTransmitFrame(CAN_DRV_CHANNEL_PRIMARY, 0x100U, data, sizeof(data)));
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetTrafficStatistics, TRAFFIC_NUM_TX_ABORTED_OFFSET, sizeof(uint32_t)) == 0U);
+      TEST_CHECK(!CAN_Drv_IsTransmitPending(CAN_DRV_CHANNEL_PRIMARY, abortedCanId));
+      RunDriver(1U);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetTrafficStatistics, TRAFFIC_NUM_TX_ABORTED_OFFSET, sizeof(uint32_t)) == 1U);
+      RunDriver(30U);
+
+      numSent = 0U;
+      while (TakeFromFirmware(&frame))
+      {
+         if (numSent == 0U)
+         {
+            TEST_CHECK(frame.canId == 0x100U);
+         }
+         TEST_CHECK(frame.canId != abortedCanId);
+         numSent++;
+      }
+      TEST_CHECK(numSent == (CAN_DRV_NUM_TX_MSG_OBJS - CAN_DRV_NUM_RESERVED_TX_MSG_OBJS));
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetTrafficStatistics, TRAFFIC_NUM_TX_ABORTED_OFFSET, sizeof(uint32_t)) == 1U);
+
+      //-----------------------------------------------
+      // Bus load
+      //-----------------------------------------------
+
+      // Every millisecond of a rate interval two accepted frames are received
+      // and one frame is sent, so the rates and the load are known exactly
+      static const uint8_t loadData[LOAD_TX_FRAME_LENGTH] = { 0x01U, 0x02U, 0x03U, 0x04U };
+      const uint32_t rxBitsPerSecond = 2U * LOAD_RX_FRAME_BITS * RATE_INTERVAL_MILLISECONDS;
+      const uint32_t txBitsPerSecond = LOAD_TX_FRAME_BITS * RATE_INTERVAL_MILLISECONDS;
+      const uint32_t busLoad = ((rxBitsPerSecond + txBitsPerSecond) * 1000U) / BUS_BITS_PER_SECOND;
+      CAN_Drv_Frame_t loadFrame;
+
+      memset(&loadFrame, 0, sizeof(loadFrame));
+      loadFrame.canId = LOAD_RX_CANID;
+      loadFrame.length = CAN_DRV_MAX_DATA_LENGTH;
+
+      CAN_Drv_Init();
+      numFrames = 0U;
+      for (uint32_t elapsed = 0U; elapsed < RATE_INTERVAL_MILLISECONDS; elapsed++)
+      {
+         Host_Drv_AdvanceTime(1000U);
+         TEST_CHECK(Host_Drv_ReceiveCAN(&loadFrame));
+         TEST_CHECK(Host_Drv_ReceiveCAN(&loadFrame));
+         TEST_CHECK(CAN_Drv_StartTransmitFrame(CAN_DRV_CHANNEL_PRIMARY, LOAD_TX_CANID, loadData, sizeof(loadData)));
+         CAN_Drv_Update();
+
+         while (CAN_Drv_ReceiveFrame(CAN_DRV_CHANNEL_PRIMARY, &frame))
+         {
+            // Keep the receive ring empty
+         }
+         while (TakeFromFirmware(&frame))
+         {
+            numFrames++;
+         }
+      }
+      TEST_CHECK(numFrames == RATE_INTERVAL_MILLISECONDS);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetTrafficStatistics, TRAFFIC_RX_BITS_PER_SECOND_OFFSET, sizeof(uint32_t)) == rxBitsPerSecond);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetTrafficStatistics, TRAFFIC_TX_BITS_PER_SECOND_OFFSET, sizeof(uint32_t)) == txBitsPerSecond);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetTrafficStatistics, TRAFFIC_RX_FRAMES_PER_SECOND_OFFSET, sizeof(uint16_t)) == (2U * RATE_INTERVAL_MILLISECONDS));
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetTrafficStatistics, TRAFFIC_TX_FRAMES_PER_SECOND_OFFSET, sizeof(uint16_t)) == RATE_INTERVAL_MILLISECONDS);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetTrafficStatistics, TRAFFIC_BUS_LOAD_OFFSET, sizeof(uint16_t)) == busLoad);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetTrafficStatistics, TRAFFIC_PEAK_BUS_LOAD_OFFSET, sizeof(uint16_t)) == busLoad);
+
+      // A quiet interval lowers the load but keeps the peak
+      RunDriver(RATE_INTERVAL_MILLISECONDS);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetTrafficStatistics, TRAFFIC_BUS_LOAD_OFFSET, sizeof(uint16_t)) == 0U);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetTrafficStatistics, TRAFFIC_PEAK_BUS_LOAD_OFFSET, sizeof(uint16_t)) == busLoad);
+
+      //-----------------------------------------------
+      // Transmit latency percentiles
+      //-----------------------------------------------
+
+      // Frames of another node delay the sent frames by 0 to 3 frames, so the
+      // median, 90th and 99th percentile fall into different buckets
+      uint32_t latencies[NUM_LATENCY_FRAMES];
+      uint32_t numLatencies = 0U;
+      uint32_t numDelayed = 0U;
+
+      CAN_Drv_Init();
+      for (uint32_t i = 0U; i < NUM_LATENCY_FRAMES; i++)
+      {
+         const uint32_t numOtherFrames = (i < 50U) ? 0U : ((i < 85U) ? 1U : ((i < 98U) ? 2U : 3U));
+         uint32_t queueCycles;
+
+         Host_Drv_AdvanceTime(1000U);
+         SendOtherNodeFrames(numOtherFrames);
+         queueCycles = Timebase_Drv_GetCycleCount();
+         TEST_CHECK(CAN_Drv_StartTransmitFrame(CAN_DRV_CHANNEL_PRIMARY, LOAD_TX_CANID, loadData, sizeof(loadData)));
+         CAN_Drv_Update();
+
+         if (TEST_CHECK(TakeFromFirmware(&frame) && (numLatencies < NUM_LATENCY_FRAMES)))
+         {
+            latencies[numLatencies] = frame.timestamp - queueCycles;
+            numLatencies++;
+         }
+         if (numOtherFrames > 0U)
+         {
+            numDelayed++;
+         }
+      }
+
+      if (TEST_CHECK(numLatencies == NUM_LATENCY_FRAMES))
+      {
+         qsort(latencies, numLatencies, sizeof(latencies[0]), CompareLatencies);
+         TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetLatencyStatistics, LATENCY_MEDIAN_OFFSET, sizeof(uint32_t)) == GetExpectedPercentile(latencies, numLatencies, 50U));
+         TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetLatencyStatistics, LATENCY_90TH_OFFSET, sizeof(uint32_t)) == GetExpectedPercentile(latencies, numLatencies, 90U));
+         TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetLatencyStatistics, LATENCY_99TH_OFFSET, sizeof(uint32_t)) == GetExpectedPercentile(latencies, numLatencies, 99U));
+         TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetLatencyStatistics, LATENCY_MAX_OFFSET, sizeof(uint32_t)) == (latencies[numLatencies - 1U] / (HOST_DRV_CYCLES_PER_SECOND / 1000000U)));
+         printf("Transmit latency median %u us, 90th %u us, 99th %u us\n",
+                (unsigned int)ReadStatistic(CAN_Drv_MessageRouter_GetLatencyStatistics, LATENCY_MEDIAN_OFFSET, sizeof(uint32_t)),
+                (unsigned int)ReadStatistic(CAN_Drv_MessageRouter_GetLatencyStatistics, LATENCY_90TH_OFFSET, sizeof(uint32_t)),
+                (unsigned int)ReadStatistic(CAN_Drv_MessageRouter_GetLatencyStatistics, LATENCY_99TH_OFFSET, sizeof(uint32_t)));
+      }
+
+      // Only the frames that waited for another node count as delayed
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetErrorStatistics, ERROR_NUM_TX_ARBITRATION_DELAYS_OFFSET, sizeof(uint32_t)) == numDelayed);
+
+      //-----------------------------------------------
+      // Error counters
+      //-----------------------------------------------
+
+      CAN_Drv_Init();
+
+      // A bus error is counted once, the error code is cleared when it was read
+      Host_Drv_SetCANNodeState(5U, 0U, 3U, false);
+      RunDriver(2U);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetErrorStatistics, ERROR_TRANSMIT_ERROR_COUNT_OFFSET, sizeof(uint8_t)) == 5U);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetErrorStatistics, ERROR_LAST_ERROR_CODE_OFFSET, sizeof(uint8_t)) == 3U);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetErrorStatistics, ERROR_NUM_BUS_ERRORS_OFFSET, sizeof(uint32_t)) == 1U);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetErrorStatistics, ERROR_IS_ERROR_WARNING_OFFSET, sizeof(uint8_t)) == 0U);
+
+      // A counter at the warning limit sets the warning once
+      Host_Drv_SetCANNodeState(100U, 20U, 1U, false);
+      RunDriver(2U);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetErrorStatistics, ERROR_IS_ERROR_WARNING_OFFSET, sizeof(uint8_t)) == 1U);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetErrorStatistics, ERROR_NUM_ERROR_WARNINGS_OFFSET, sizeof(uint32_t)) == 1U);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetErrorStatistics, ERROR_LAST_ERROR_CODE_OFFSET, sizeof(uint8_t)) == 1U);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetErrorStatistics, ERROR_NUM_BUS_ERRORS_OFFSET, sizeof(uint32_t)) == 2U);
+
+      // A bus-off node counts the event and holds its frames
+      Host_Drv_SetCANNodeState(255U, 20U, 5U, true);
+      TEST_CHECK(CAN_Drv_StartTransmitFrame(CAN_DRV_CHANNEL_PRIMARY, LOAD_TX_CANID, loadData, sizeof(loadData)));
+      RunDriver(5U);
+      TEST_CHECK(!TakeFromFirmware(&frame));
+      TEST_CHECK(CAN_Drv_IsTransmitPending(CAN_DRV_CHANNEL_PRIMARY, LOAD_TX_CANID));
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetErrorStatistics, ERROR_IS_BUS_OFF_OFFSET, sizeof(uint8_t)) == 1U);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetErrorStatistics, ERROR_NUM_BUS_OFF_EVENTS_OFFSET, sizeof(uint32_t)) == 1U);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetErrorStatistics, ERROR_NUM_BUS_ERRORS_OFFSET, sizeof(uint32_t)) == 3U);
+
+      // The recovery clears the state and keeps the highest counts, the
+      // held frame is sent and an error code written by software is not counted
+      Host_Drv_SetCANNodeState(0U, 0U, 7U, false);
+      RunDriver(2U);
+      TEST_CHECK(TakeFromFirmware(&frame) && (frame.canId == LOAD_TX_CANID));
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetErrorStatistics, ERROR_IS_BUS_OFF_OFFSET, sizeof(uint8_t)) == 0U);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetErrorStatistics, ERROR_IS_ERROR_WARNING_OFFSET, sizeof(uint8_t)) == 0U);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetErrorStatistics, ERROR_NUM_BUS_OFF_RECOVERIES_OFFSET, sizeof(uint32_t)) == 1U);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetErrorStatistics, ERROR_TRANSMIT_ERROR_COUNT_OFFSET, sizeof(uint8_t)) == 0U);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetErrorStatistics, ERROR_RECEIVE_ERROR_COUNT_OFFSET, sizeof(uint8_t)) == 0U);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetErrorStatistics, ERROR_MAX_TRANSMIT_ERROR_COUNT_OFFSET, sizeof(uint8_t)) == 255U);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetErrorStatistics, ERROR_MAX_RECEIVE_ERROR_COUNT_OFFSET, sizeof(uint8_t)) == 20U);
+      TEST_CHECK(ReadStatistic(CAN_Drv_MessageRouter_GetErrorStatistics, ERROR_NUM_BUS_ERRORS_OFFSET, sizeof(uint32_t)) == 3U);
+   }
+
+   Host_Drv_CloseCAN();
+   if (peerSocket >= 0)
+   {
+      (void)close(peerSocket);
+   }
+
+   return(Test_Harness_Finish());
+}
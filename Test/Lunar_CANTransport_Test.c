@@ -0,0 +1,471 @@
+/*******************************************************************************
+// CAN Transport Test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Test_Harness.h"
+// Platform Includes
+#include "Host_Drv.h"
+#include "Lunar_CANTransport.h"
+#include "Lunar_CANTransport_ConfigTable.h"
+#include "Lunar_FwUpdate.h"
+#include "Lunar_MessageRouter.h"
+// Other Includes
+#include <string.h> // memcpy
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The number of routes in the route table of the board
+#define NUM_ROUTES (sizeof(Lunar_CANTransport_routeConfigTable) / sizeof(Lunar_CANTransport_RouteConfigItem_t))
+
+// Returned by FindRouteIndex for an identifier without a route
+#define NO_ROUTE (0xFFFFFFFFUL)
+
+// Time to wait for a frame from the firmware, and for a frame that must not come
+#define FRAME_TIMEOUT_MILLISECONDS (20U)
+
+// The transport statistics in the Message Router
+#define CANTRANSPORT_MODULE_ID (0x12U)
+#define CANTRANSPORT_COMMAND_GET_STATISTICS (0x01U)
+#define STATISTICS_LENGTH (20U)
+
+// Commands without parameters that every board has, answered in a single frame
+#define ERRORMGR_DO_ERRORS_EXIST_ROUTER_ID (0x0203U)
+#define ERRORMGR_GET_ALL_ERRORS_ROUTER_ID (0x0205U)
+#define CONTROL_GET_STATE_ROUTER_ID (0x0501U)
+
+// A command that no module has
+#define UNKNOWN_ROUTER_ID (0x02FEU)
+
+// The firmware update and its status command
+#define FWUPDATE_MODULE_ID (0x10U)
+#define FWUPDATE_COMMAND_GET_STATUS (0x01U)
+#define FWUPDATE_COMMAND_DATA (0x06U)
+#define FWUPDATE_START_CANID (LUNAR_FWUPDATE_CONTROL_CANID | CAN_DRV_EXTENDED_ID)
+#define FWUPDATE_ABORT_CANID ((LUNAR_FWUPDATE_CONTROL_CANID + 3U) | CAN_DRV_EXTENDED_ID)
+#define FWUPDATE_WAIT_MILLISECONDS (10U)
+
+// The block and frame numbers in the identifier of a data frame
+#define FRAME_DATA_SIZE (8U)
+#define BLOCK_TAG_SHIFT (5U)
+
+// Offsets in the firmware update status response
+#define STATUS_NUM_DATA_FRAMES_OFFSET (8U)
+#define STATUS_NUM_REPEATED_FRAMES_OFFSET (12U)
+#define STATUS_STATE_OFFSET (26U)
+#define STATUS_LENGTH (28U)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// This structure holds the statistics of the transport
+typedef struct
+{
+   uint32_t numFramesRouted;
+   uint32_t numFramesUnrouted;
+   uint32_t numResponsesSent;
+   uint32_t numResponsesDropped;
+   uint32_t numErrorResponses;
+} Statistics_t;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function finds the route of an identifier with the rules of the
+  *    transport: the first route whose range holds the identifier without
+  *    its node ID bits.
+  * Parameters:
+  *    canId :  The identifier, bit 31 set for an extended identifier
+  * Returns:
+  *    uint32_t - The index of the route, NO_ROUTE if there is none
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint32_t FindRouteIndex(const uint32_t canId);
+
+/** Description:
+  *    This function reads the statistics of the transport via the serial
+  *    port.
+  * Parameters:
+  *    statistics :  Destination for the statistics
+  * Returns:
+  *    bool - true if the statistics were read
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool GetStatistics(Statistics_t *const statistics);
+
+/** Description:
+  *    This function sends a frame to the firmware.
+  * Parameters:
+  *    canId :   The identifier, bit 31 set for an extended identifier
+  *    data :    The frame data, may be NULL if length is 0
+  *    length :  The number of data bytes
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void SendFrame(const uint32_t canId, const uint8_t *const data, const uint8_t length);
+
+/** Description:
+  *    This function runs the firmware until it sends a frame with the given
+  *    identifier.  Other frames are thrown away.
+  * Parameters:
+  *    canId :  The identifier, bit 31 set for an extended identifier
+  *    frame :  Destination for the frame
+  * Returns:
+  *    bool - true if the frame arrived within FRAME_TIMEOUT_MILLISECONDS
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool TakeFrame(const uint32_t canId, CAN_Drv_Frame_t *const frame);
+
+/** Description:
+  *    This function reads the status of the firmware update via the serial
+  *    port.
+  * Parameters:
+  *    numDataFrames :      Set to the number of data frames received
+  *    numRepeatedFrames :  Set to the number of data frames received twice
+  * Returns:
+  *    uint8_t - The state of the update, 0xFF if the status was not read
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint8_t GetFwUpdateStatus(uint32_t *const numDataFrames, uint32_t *const numRepeatedFrames);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Find the route of an identifier
+static uint32_t FindRouteIndex(const uint32_t canId)
+{
+   uint32_t routeIndex = NO_ROUTE;
+
+   for (uint32_t i = 0U; (i < NUM_ROUTES) && (routeIndex == NO_ROUTE); i++)
+   {
+      const Lunar_CANTransport_RouteConfigItem_t *const route = &Lunar_CANTransport_routeConfigTable[i];
+      const uint32_t routedCanId = canId & ~route->nodeIdMask;
+
+      if ((routedCanId >= route->firstCanId) && (routedCanId <= route->lastCanId))
+      {
+         routeIndex = i;
+      }
+   }
+
+   return(routeIndex);
+}
+
+// Read the transport statistics
+static bool GetStatistics(Statistics_t *const statistics)
+{
+   uint8_t response[STATISTICS_LENGTH];
+   bool isRead = false;
+
+   if (Test_Harness_SendCommand((UART_Drv_Channel_t)0, CANTRANSPORT_MODULE_ID, CANTRANSPORT_COMMAND_GET_STATISTICS, NULL, 0U,
+                                response, sizeof(response)) == (int)STATISTICS_LENGTH)
+   {
+      memcpy(statistics, response, sizeof(*statistics));
+      isRead = true;
+   }
+
+   return(isRead);
+}
+
+// Send a frame
+static void SendFrame(const uint32_t canId, const uint8_t *const data, const uint8_t length)
+{
+   CAN_Drv_Frame_t frame;
+
+   memset(&frame, 0, sizeof(frame));
+   frame.canId = canId;
+   frame.length = length;
+   if (length > 0U)
+   {
+      memcpy(frame.data, data, length);
+   }
+
+   TEST_CHECK(Host_Drv_ReceiveCAN(&frame));
+}
+
+// Wait for a frame of the firmware
+static bool TakeFrame(const uint32_t canId, CAN_Drv_Frame_t *const frame)
+{
+   bool isFound = false;
+
+   for (uint32_t elapsed = 0U; (elapsed < FRAME_TIMEOUT_MILLISECONDS) && (!isFound); elapsed++)
+   {
+      Test_Harness_Run(1U);
+      while ((!isFound) && (Host_Drv_TakeCANOutput(frame)))
+      {
+         isFound = (frame->canId == canId);
+      }
+   }
+
+   return(isFound);
+}
+
+// Read the firmware update status
+static uint8_t GetFwUpdateStatus(uint32_t *const numDataFrames, uint32_t *const numRepeatedFrames)
+{
+   uint8_t response[STATUS_LENGTH];
+   uint8_t state = 0xFFU;
+
+   if (Test_Harness_SendCommand((UART_Drv_Channel_t)0, FWUPDATE_MODULE_ID, FWUPDATE_COMMAND_GET_STATUS, NULL, 0U,
+                                response, sizeof(response)) == (int)STATUS_LENGTH)
+   {
+      memcpy(numDataFrames, &response[STATUS_NUM_DATA_FRAMES_OFFSET], sizeof(*numDataFrames));
+      memcpy(numRepeatedFrames, &response[STATUS_NUM_REPEATED_FRAMES_OFFSET], sizeof(*numRepeatedFrames));
+      state = response[STATUS_STATE_OFFSET];
+   }
+
+   return(state);
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Test entry point
+int main(void)
+{
+   CAN_Drv_Frame_t frame;
+   Statistics_t before;
+   Statistics_t after;
+
+   Test_Harness_Start();
+
+   //-----------------------------------------------
+   // Every identifier of a route is routed by that route
+   //-----------------------------------------------
+
+   for (uint32_t i = 0U; i < NUM_ROUTES; i++)
+   {
+      const Lunar_CANTransport_RouteConfigItem_t *const route = &Lunar_CANTransport_routeConfigTable[i];
+      const uint32_t span = route->lastCanId - route->firstCanId;
+      const uint32_t nodeIdScale = route->nodeIdMask & (~route->nodeIdMask + 1U);
+
+      TEST_CHECK(route->firstCanId <= route->lastCanId);
+      TEST_CHECK((route->firstCanId & CAN_DRV_EXTENDED_ID) == (route->lastCanId & CAN_DRV_EXTENDED_ID));
+
+      // The node ID bits are contiguous, outside the range and fit in the source address
+      TEST_CHECK(((route->firstCanId | route->lastCanId) & route->nodeIdMask) == 0U);
+      if (nodeIdScale != 0U)
+      {
+         const uint32_t maxNodeId = route->nodeIdMask / nodeIdScale;
+
+         TEST_CHECK(((maxNodeId & (maxNodeId + 1U)) == 0U) && (maxNodeId <= 0xFFU));
+      }
+
+      // Segmented routes send their flow control frames with the response identifier
+      TEST_CHECK((route->framing != LUNAR_CANTRANSPORT_FRAMING_IsoTp) || (route->firstResponseCanId != LUNAR_CANTRANSPORT_NO_RESPONSE));
+
+      // The commands of the range do not run past the last module
+      TEST_CHECK(((((uint32_t)route->moduleID << 8U) | route->commandID) + span) <= 0xFFFFU);
+
+      // No earlier route takes identifiers of this one, with any node ID
+      TEST_CHECK(FindRouteIndex(route->firstCanId) == i);
+      TEST_CHECK(FindRouteIndex(route->firstCanId + (span / 2U)) == i);
+      TEST_CHECK(FindRouteIndex(route->lastCanId) == i);
+      TEST_CHECK(FindRouteIndex(route->firstCanId | route->nodeIdMask) == i);
+      TEST_CHECK(FindRouteIndex(route->lastCanId | route->nodeIdMask) == i);
+
+      // The node does not route its own responses
+      if (route->firstResponseCanId != LUNAR_CANTRANSPORT_NO_RESPONSE)
+      {
+         TEST_CHECK(FindRouteIndex(route->firstResponseCanId) == NO_ROUTE);
+         TEST_CHECK(FindRouteIndex(route->firstResponseCanId + span) == NO_ROUTE);
+      }
+   }
+
+   //-----------------------------------------------
+   // A request is answered with the response identifier of its command
+   //-----------------------------------------------
+
+   const uint16_t requestRouterIds[] = { ERRORMGR_DO_ERRORS_EXIST_ROUTER_ID, ERRORMGR_GET_ALL_ERRORS_ROUTER_ID, CONTROL_GET_STATE_ROUTER_ID };
+
+   for (uint32_t i = 0U; i < (sizeof(requestRouterIds) / sizeof(requestRouterIds[0])); i++)
+   {
+      const uint16_t routerId = requestRouterIds[i];
+      uint8_t response[CAN_DRV_MAX_DATA_LENGTH];
+
+      // The serial response of the same command gives the expected data
+      const int responseLength = Test_Harness_SendCommand((UART_Drv_Channel_t)0, (uint8_t)(routerId >> 8U), (uint8_t)routerId, NULL, 0U,
+                                                          response, sizeof(response));
+
+      TEST_CHECK((responseLength > 0) && (responseLength <= (int)CAN_DRV_MAX_DATA_LENGTH));
+      TEST_CHECK(GetStatistics(&before));
+      SendFrame((LUNAR_CANTRANSPORT_REQUEST_CANID + routerId) | CAN_DRV_EXTENDED_ID, NULL, 0U);
+      if (TEST_CHECK(TakeFrame((LUNAR_CANTRANSPORT_RESPONSE_CANID + routerId) | CAN_DRV_EXTENDED_ID, &frame)))
+      {
+         TEST_CHECK(frame.length == (uint8_t)responseLength);
+         TEST_CHECK(memcmp(frame.data, response, frame.length) == 0);
+      }
+
+      if (TEST_CHECK(GetStatistics(&after)))
+      {
+         TEST_CHECK(after.numFramesRouted == (before.numFramesRouted + 1U));
+         TEST_CHECK(after.numResponsesSent == (before.numResponsesSent + 1U));
+         TEST_CHECK(after.numErrorResponses == before.numErrorResponses);
+      }
+   }
+
+   //-----------------------------------------------
+   // A failed command is counted and not answered
+   //-----------------------------------------------
+
+   const uint8_t extraParams[] = { 0x01U, 0x02U, 0x03U };
+   const uint16_t failedRouterIds[] = { UNKNOWN_ROUTER_ID, ERRORMGR_DO_ERRORS_EXIST_ROUTER_ID };
+   const uint8_t failedLengths[] = { 0U, sizeof(extraParams) };
+
+   for (uint32_t i = 0U; i < (sizeof(failedRouterIds) / sizeof(failedRouterIds[0])); i++)
+   {
+      const uint16_t routerId = failedRouterIds[i];
+
+      TEST_CHECK(GetStatistics(&before));
+      SendFrame((LUNAR_CANTRANSPORT_REQUEST_CANID + routerId) | CAN_DRV_EXTENDED_ID, extraParams, failedLengths[i]);
+      TEST_CHECK(!TakeFrame((LUNAR_CANTRANSPORT_RESPONSE_CANID + routerId) | CAN_DRV_EXTENDED_ID, &frame));
+      if (TEST_CHECK(GetStatistics(&after)))
+      {
+         TEST_CHECK(after.numFramesRouted == (before.numFramesRouted + 1U));
+         TEST_CHECK(after.numErrorResponses == (before.numErrorResponses + 1U));
+         TEST_CHECK(after.numResponsesSent == before.numResponsesSent);
+      }
+   }
+
+   //-----------------------------------------------
+   // A route without a response identifier is not answered
+   //-----------------------------------------------
+
+   TEST_CHECK(GetStatistics(&before));
+   SendFrame(FWUPDATE_ABORT_CANID, NULL, 0U);
+   Test_Harness_Run(FRAME_TIMEOUT_MILLISECONDS);
+   if (TEST_CHECK(GetStatistics(&after)))
+   {
+      TEST_CHECK(after.numFramesRouted == (before.numFramesRouted + 1U));
+      TEST_CHECK(after.numErrorResponses == before.numErrorResponses);
+      TEST_CHECK(after.numResponsesSent == before.numResponsesSent);
+      TEST_CHECK(after.numResponsesDropped == before.numResponsesDropped);
+   }
+
+   //-----------------------------------------------
+   // Unsolicited responses use the identifier offset of their command
+   //-----------------------------------------------
+
+   // The commands at the start and end of a module and of the whole range
+   const uint16_t sentRouterIds[] = { 0x0000U, 0x02FFU, 0x0300U, 0xB100U, 0xFFFFU };
+   const uint8_t sentData[CAN_DRV_MAX_DATA_LENGTH + 1U] = { 0x11U, 0x22U, 0x33U, 0x44U, 0x55U, 0x66U, 0x77U, 0x88U, 0x99U };
+   uint8_t responseData[sizeof(sentData)];
+   Lunar_MessageRouter_Message_t message;
+
+   memset(&message, 0, sizeof(message));
+   message.responseParams.data = responseData;
+   message.responseParams.maxLength = sizeof(responseData);
+
+   // Throw away the frames sent so far
+   Test_Harness_Run(FRAME_TIMEOUT_MILLISECONDS);
+   while (Host_Drv_TakeCANOutput(&frame))
+   {
+   }
+
+   for (uint32_t i = 0U; i < (sizeof(sentRouterIds) / sizeof(sentRouterIds[0])); i++)
+   {
+      const uint16_t routerId = sentRouterIds[i];
+      // Each response has another length, the data is kept as sent
+      const uint8_t length = (uint8_t)(i + 1U);
+
+      memcpy(responseData, sentData, sizeof(responseData));
+      message.header.moduleID = (uint8_t)(routerId >> 8U);
+      message.header.commandID = (uint8_t)routerId;
+      message.responseParams.length = length;
+
+      TEST_CHECK(GetStatistics(&before));
+      Lunar_CANTransport_SendMessage(0U, &message);
+      if (TEST_CHECK(TakeFrame((LUNAR_CANTRANSPORT_RESPONSE_CANID + routerId) | CAN_DRV_EXTENDED_ID, &frame)))
+      {
+         TEST_CHECK((frame.length == length) && (memcmp(frame.data, sentData, length) == 0));
+      }
+      TEST_CHECK(GetStatistics(&after) && (after.numResponsesSent == (before.numResponsesSent + 1U)));
+   }
+
+   // A response longer than a frame is dropped
+   message.header.moduleID = (uint8_t)(ERRORMGR_DO_ERRORS_EXIST_ROUTER_ID >> 8U);
+   message.header.commandID = (uint8_t)ERRORMGR_DO_ERRORS_EXIST_ROUTER_ID;
+   message.responseParams.length = sizeof(sentData);
+   TEST_CHECK(GetStatistics(&before));
+   Lunar_CANTransport_SendMessage(0U, &message);
+   TEST_CHECK(!TakeFrame((LUNAR_CANTRANSPORT_RESPONSE_CANID + ERRORMGR_DO_ERRORS_EXIST_ROUTER_ID) | CAN_DRV_EXTENDED_ID, &frame));
+   if (TEST_CHECK(GetStatistics(&after)))
+   {
+      TEST_CHECK(after.numResponsesDropped == (before.numResponsesDropped + 1U));
+      TEST_CHECK(after.numResponsesSent == before.numResponsesSent);
+   }
+
+   //-----------------------------------------------
+   // The node ID bits of a route reach the handler as the source address
+   //-----------------------------------------------
+
+   // The firmware update data route uses them for the block and frame numbers
+   const uint32_t dataCanId = LUNAR_FWUPDATE_DATA_CANID | CAN_DRV_EXTENDED_ID;
+   const uint32_t dataRouteIndex = FindRouteIndex(dataCanId);
+   const uint8_t startData[8] = { FRAME_DATA_SIZE, 0U, 0U, 0U, 0U, 0U, 0U, 0U };
+   const uint8_t data[FRAME_DATA_SIZE] = { 0U };
+   uint32_t numDataFrames = 0U;
+   uint32_t numRepeatedFrames = 0U;
+
+   if (TEST_CHECK(dataRouteIndex != NO_ROUTE))
+   {
+      TEST_CHECK(Lunar_CANTransport_routeConfigTable[dataRouteIndex].moduleID == FWUPDATE_MODULE_ID);
+      TEST_CHECK(Lunar_CANTransport_routeConfigTable[dataRouteIndex].commandID == FWUPDATE_COMMAND_DATA);
+      TEST_CHECK(Lunar_CANTransport_routeConfigTable[dataRouteIndex].nodeIdMask != 0U);
+   }
+
+   // Announce a single block image
+   SendFrame(FWUPDATE_START_CANID, startData, sizeof(startData));
+   Test_Harness_Run(FWUPDATE_WAIT_MILLISECONDS);
+   TEST_CHECK(GetFwUpdateStatus(&numDataFrames, &numRepeatedFrames) == (uint8_t)LUNAR_FWUPDATE_STATE_Receiving);
+   TEST_CHECK((numDataFrames == 0U) && (numRepeatedFrames == 0U));
+
+   // Frame 3 twice, then frame 4, then frame 3 of the next block
+   SendFrame(dataCanId | 3U, data, sizeof(data));
+   SendFrame(dataCanId | 3U, data, sizeof(data));
+   SendFrame(dataCanId | 4U, data, sizeof(data));
+   SendFrame(dataCanId | (1U << BLOCK_TAG_SHIFT) | 3U, data, sizeof(data));
+   Test_Harness_Run(FWUPDATE_WAIT_MILLISECONDS);
+
+   // Only the second frame 3 of block 0 is a repeat
+   TEST_CHECK(GetFwUpdateStatus(&numDataFrames, &numRepeatedFrames) == (uint8_t)LUNAR_FWUPDATE_STATE_Receiving);
+   TEST_CHECK((numDataFrames == 4U) && (numRepeatedFrames == 1U));
+
+   SendFrame(dataCanId | 4U, data, sizeof(data));
+   Test_Harness_Run(FWUPDATE_WAIT_MILLISECONDS);
+   TEST_CHECK(GetFwUpdateStatus(&numDataFrames, &numRepeatedFrames) == (uint8_t)LUNAR_FWUPDATE_STATE_Receiving);
+   TEST_CHECK((numDataFrames == 5U) && (numRepeatedFrames == 2U));
+
+   SendFrame(FWUPDATE_ABORT_CANID, NULL, 0U);
+   Test_Harness_Run(FWUPDATE_WAIT_MILLISECONDS);
+   TEST_CHECK(GetFwUpdateStatus(&numDataFrames, &numRepeatedFrames) == (uint8_t)LUNAR_FWUPDATE_STATE_Idle);
+
+   // Every frame the filters accepted had a route
+   TEST_CHECK(GetStatistics(&after) && (after.numFramesUnrouted == 0U));
+
+   return(Test_Harness_Finish());
+}
@@ -0,0 +1,433 @@
+/*******************************************************************************
+// Error Log Test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Test_Harness.h"
+// Platform Includes
+#include "Flash_Drv.h"
+#include "Lunar_ErrorLog.h"
+#include "Lunar_ErrorMgr.h"
+#include "Lunar_MathLib.h"
+// Other Includes
+#include <string.h> // memcpy
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The page format written by the error log:
+//   magic, sequence number, boot number, number of records, error words,
+//   CRC-16, reserved, then the records
+#define PAGE_MAGIC (0x474F4C45UL)
+#define PAGE_CHECKSUM_OFFSET (12U + (4U * LUNAR_ERRORMGR_NUM_ERROR_WORDS))
+#define PAGE_HEADER_SIZE (PAGE_CHECKSUM_OFFSET + 4U)
+#define NUM_RECORDS_PER_PAGE ((FLASH_DRV_PAGE_SIZE - PAGE_HEADER_SIZE) / sizeof(Lunar_ErrorLog_Record_t))
+
+// Size of the log
+#define NUM_PAGES_PER_SECTOR (FLASH_DRV_SECTOR_SIZE / FLASH_DRV_PAGE_SIZE)
+#define NUM_PAGES (NUM_PAGES_PER_SECTOR * LUNAR_ERRORLOG_NUM_SECTORS)
+
+// An error that is toggled to add records, and an error that is restored
+// after a reset
+#define TOGGLED_ERROR (LUNAR_ERRORMGR_ERROR_VOLTAGE_LOW)
+#define PERSISTENT_ERROR (LUNAR_ERRORMGR_ERROR_RAM_CHECK_FAILED)
+
+// Longest time an error takes to qualify
+#define MAX_QUALIFY_MILLISECONDS (5000U)
+
+// Time for the pending records to be written
+#define FLUSH_MILLISECONDS (LUNAR_ERRORLOG_FLUSH_DELAY_MS + 50U)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// A page of the log as read from the flash
+typedef struct
+{
+   // true if the page was never programmed since its sector was erased
+   bool isBlank;
+
+   // true if the page holds a complete, valid set of records
+   bool isValid;
+
+   // The header of the page
+   uint32_t sequenceNumber;
+   uint16_t bootNumber;
+   uint16_t numRecords;
+   uint32_t errorWords[LUNAR_ERRORMGR_NUM_ERROR_WORDS];
+
+   // The records of the page
+   Lunar_ErrorLog_Record_t records[NUM_RECORDS_PER_PAGE];
+} LogPage_t;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function reads and decodes a page of the log from the flash.
+  * Parameters:
+  *    pageIndex :  Index of the page, 0 is the first page of the first sector
+  *    page :       Destination for the decoded page
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void ReadLogPage(const uint32_t pageIndex, LogPage_t *const page);
+
+/** Description:
+  *    This function finds the valid page with the highest sequence number.
+  * Parameters:
+  *    pageIndex :  Set to the index of the newest page
+  *    page :       Set to the newest page
+  * Returns:
+  *    bool - false if the log holds no valid page
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool FindNewestPage(uint32_t *const pageIndex, LogPage_t *const page);
+
+/** Description:
+  *    This function changes the state of an error, requesting the change
+  *    until it has qualified, so the error manager adds a record.
+  * Parameters:
+  *    error :  The error to be changed
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void ToggleError(const Lunar_ErrorMgr_Error_t error);
+
+/** Description:
+  *    This function adds records for the given number of full pages and
+  *    writes the pending records.
+  * Parameters:
+  *    numPages :  The number of pages to be filled
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void WritePages(const uint32_t numPages);
+
+/** Description:
+  *    This function returns the first flash address of the given sector of
+  *    the log.
+  * Parameters:
+  *    sector :  Index of the sector in the log
+  * Returns:
+  *    uint32_t - The address of the sector
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static inline uint32_t GetSectorAddress(const uint32_t sector);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Read a page of the log
+static void ReadLogPage(const uint32_t pageIndex, LogPage_t *const page)
+{
+   uint8_t data[FLASH_DRV_PAGE_SIZE];
+   uint32_t magic;
+   uint16_t checksum;
+   uint16_t crc;
+
+   Flash_Drv_Read(LUNAR_ERRORLOG_FLASH_START_ADDRESS + (pageIndex * FLASH_DRV_PAGE_SIZE), data, sizeof(data));
+
+   memcpy(&magic, &data[0], sizeof(magic));
+   memcpy(&page->sequenceNumber, &data[4], sizeof(page->sequenceNumber));
+   memcpy(&page->bootNumber, &data[8], sizeof(page->bootNumber));
+   memcpy(&page->numRecords, &data[10], sizeof(page->numRecords));
+   memcpy(page->errorWords, &data[12], sizeof(page->errorWords));
+   memcpy(&checksum, &data[PAGE_CHECKSUM_OFFSET], sizeof(checksum));
+   memcpy(page->records, &data[PAGE_HEADER_SIZE], sizeof(page->records));
+
+   // The checksum covers the page except its own field
+   crc = Lunar_MathLib_Crc16(data, PAGE_CHECKSUM_OFFSET, LUNAR_MATHLIB_CRC16_INITIAL_VALUE);
+   crc = Lunar_MathLib_Crc16(&data[PAGE_CHECKSUM_OFFSET + 2U], FLASH_DRV_PAGE_SIZE - (PAGE_CHECKSUM_OFFSET + 2U), crc);
+
+   page->isBlank = (magic == FLASH_DRV_ERASED_WORD);
+   page->isValid = (magic == PAGE_MAGIC) && (page->numRecords <= NUM_RECORDS_PER_PAGE) && (checksum == crc);
+}
+
+// Find the newest page of the log
+static bool FindNewestPage(uint32_t *const pageIndex, LogPage_t *const page)
+{
+   bool isFound = false;
+   LogPage_t candidate;
+
+   for (uint32_t i = 0U; i < NUM_PAGES; i++)
+   {
+      ReadLogPage(i, &candidate);
+
+      if ((candidate.isValid) && ((!isFound) || ((int32_t)(candidate.sequenceNumber - page->sequenceNumber) > 0)))
+      {
+         *pageIndex = i;
+         *page = candidate;
+         isFound = true;
+      }
+   }
+
+   return(isFound);
+}
+
+// Change the state of an error
+static void ToggleError(const Lunar_ErrorMgr_Error_t error)
+{
+   const bool errorState = !Lunar_ErrorMgr_GetErrorState(error);
+
+   for (uint32_t elapsed = 0U; (elapsed < MAX_QUALIFY_MILLISECONDS) && (Lunar_ErrorMgr_GetErrorState(error) != errorState); elapsed++)
+   {
+      Lunar_ErrorMgr_SetErrorState(error, errorState);
+      Test_Harness_Run(1U);
+   }
+
+   TEST_CHECK(Lunar_ErrorMgr_GetErrorState(error) == errorState);
+}
+
+// Fill pages of the log
+static void WritePages(const uint32_t numPages)
+{
+   for (uint32_t i = 0U; i < (numPages * NUM_RECORDS_PER_PAGE); i++)
+   {
+      ToggleError(TOGGLED_ERROR);
+   }
+
+   Test_Harness_Run(FLUSH_MILLISECONDS);
+}
+
+// Get the address of a sector of the log
+static inline uint32_t GetSectorAddress(const uint32_t sector)
+{
+   return(LUNAR_ERRORLOG_FLASH_START_ADDRESS + (sector * FLASH_DRV_SECTOR_SIZE));
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Test entry point
+int main(void)
+{
+   LogPage_t page;
+   LogPage_t newestPage;
+   uint32_t newestIndex = 0U;
+   const uint32_t persistentBit = 1UL << ((uint32_t)PERSISTENT_ERROR % 32U);
+
+   Test_Harness_Start();
+   TEST_CHECK(!FindNewestPage(&newestIndex, &newestPage));
+
+   //-----------------------------------------------
+   // Records are written as a page after the flush delay
+   //-----------------------------------------------
+
+   Lunar_ErrorMgr_SetErrorState(PERSISTENT_ERROR, true);
+   TEST_CHECK(Lunar_ErrorMgr_GetErrorState(PERSISTENT_ERROR));
+   Test_Harness_Run(FLUSH_MILLISECONDS);
+
+   if (TEST_CHECK(FindNewestPage(&newestIndex, &newestPage)))
+   {
+      TEST_CHECK(newestIndex == 0U);
+      TEST_CHECK(newestPage.sequenceNumber == 1U);
+      TEST_CHECK((newestPage.numRecords > 1U) && (newestPage.numRecords <= NUM_RECORDS_PER_PAGE));
+      TEST_CHECK(newestPage.records[newestPage.numRecords - 2U].error == (uint16_t)PERSISTENT_ERROR);
+      TEST_CHECK(newestPage.records[newestPage.numRecords - 2U].errorState == 1U);
+
+      // The error is critical, so the control stops and sets its fault next
+      TEST_CHECK(newestPage.records[newestPage.numRecords - 1U].error == (uint16_t)LUNAR_ERRORMGR_ERROR_CONTROL_FAULT);
+      TEST_CHECK(newestPage.records[newestPage.numRecords - 1U].errorState == 1U);
+      TEST_CHECK((newestPage.errorWords[(uint32_t)PERSISTENT_ERROR / 32U] & persistentBit) != 0U);
+   }
+
+   //-----------------------------------------------
+   // Wear leveling and wrapping
+   //-----------------------------------------------
+
+   // Go around the log twice
+   WritePages((2U * NUM_PAGES) + (NUM_PAGES_PER_SECTOR / 2U));
+
+   uint32_t minErases = UINT32_MAX;
+   uint32_t maxErases = 0U;
+
+   // Each sector is erased in turn, and only the sectors of the log
+   for (uint32_t sector = 0U; sector < LUNAR_ERRORLOG_NUM_SECTORS; sector++)
+   {
+      const uint32_t numErases = Host_Drv_GetFlashEraseCount(GetSectorAddress(sector));
+
+      minErases = PLATFORM_MIN(minErases, numErases);
+      maxErases = PLATFORM_MAX(maxErases, numErases);
+   }
+   TEST_CHECK(minErases >= 2U);
+   TEST_CHECK((maxErases - minErases) <= 1U);
+   TEST_CHECK(Host_Drv_GetFlashEraseCount(LUNAR_ERRORLOG_FLASH_START_ADDRESS - FLASH_DRV_SECTOR_SIZE) == 0U);
+   TEST_CHECK(Host_Drv_GetFlashEraseCount(GetSectorAddress(LUNAR_ERRORLOG_NUM_SECTORS)) == 0U);
+
+   // Going back from the newest page, the sequence numbers count down
+   // without gaps until the pages left blank by the last erase
+   if (TEST_CHECK(FindNewestPage(&newestIndex, &newestPage)))
+   {
+      uint32_t numValidPages = 0U;
+      uint32_t numBlankPages = 0U;
+
+      for (uint32_t i = 0U; i < NUM_PAGES; i++)
+      {
+         ReadLogPage((newestIndex + NUM_PAGES - i) % NUM_PAGES, &page);
+
+         if ((page.isValid) && (numBlankPages == 0U))
+         {
+            TEST_CHECK(page.sequenceNumber == (newestPage.sequenceNumber - i));
+            numValidPages++;
+         }
+         else
+         {
+            TEST_CHECK(page.isBlank);
+            numBlankPages++;
+         }
+      }
+
+      TEST_CHECK(numBlankPages == (NUM_PAGES_PER_SECTOR - 1U - (newestIndex % NUM_PAGES_PER_SECTOR)));
+      TEST_CHECK(numValidPages == (NUM_PAGES - numBlankPages));
+      TEST_CHECK((newestPage.errorWords[(uint32_t)PERSISTENT_ERROR / 32U] & persistentBit) != 0U);
+   }
+
+   //-----------------------------------------------
+   // Recovery after a reset
+   //-----------------------------------------------
+
+   // The persistent errors come back and the log continues after the
+   // newest page with the next boot number
+   LogPage_t previousPage = newestPage;
+   uint32_t previousIndex = newestIndex;
+
+   Test_Harness_Start();
+   TEST_CHECK(Lunar_ErrorMgr_GetErrorState(PERSISTENT_ERROR));
+   TEST_CHECK(!Lunar_ErrorMgr_GetErrorState(TOGGLED_ERROR));
+
+   // The restored errors were logged before the reset, so no record is
+   // pending and no page is written
+   Test_Harness_Run(FLUSH_MILLISECONDS);
+
+   if (TEST_CHECK(FindNewestPage(&newestIndex, &newestPage)))
+   {
+      TEST_CHECK(newestIndex == previousIndex);
+      TEST_CHECK(newestPage.sequenceNumber == previousPage.sequenceNumber);
+   }
+
+   ToggleError(TOGGLED_ERROR);
+   Test_Harness_Run(FLUSH_MILLISECONDS);
+
+   // The next page only holds the records of the toggled error and of the
+   // control fault it caused, which was not kept over the reset
+   if (TEST_CHECK(FindNewestPage(&newestIndex, &newestPage)))
+   {
+      TEST_CHECK(newestIndex == ((previousIndex + 1U) % NUM_PAGES));
+      TEST_CHECK(newestPage.sequenceNumber == (previousPage.sequenceNumber + 1U));
+      TEST_CHECK(newestPage.bootNumber == (previousPage.bootNumber + 1U));
+      TEST_CHECK(newestPage.numRecords == 2U);
+      TEST_CHECK(newestPage.records[0].error == (uint16_t)TOGGLED_ERROR);
+      TEST_CHECK(newestPage.records[1].error == (uint16_t)LUNAR_ERRORMGR_ERROR_CONTROL_FAULT);
+      TEST_CHECK((newestPage.errorWords[(uint32_t)PERSISTENT_ERROR / 32U] & persistentBit) != 0U);
+   }
+
+   //-----------------------------------------------
+   // Power loss while a page is programmed
+   //-----------------------------------------------
+
+   // Keep the next page inside the sector, so it is programmed without an erase
+   if (((newestIndex + 1U) % NUM_PAGES_PER_SECTOR) == 0U)
+   {
+      ToggleError(TOGGLED_ERROR);
+      Test_Harness_Run(FLUSH_MILLISECONDS);
+      (void)FindNewestPage(&newestIndex, &newestPage);
+   }
+
+   const uint32_t tornIndex = (newestIndex + 1U) % NUM_PAGES;
+
+   // Only the magic and the sequence number reach the flash, the few
+   // records of the page would fit in half of it
+   previousPage = newestPage;
+   Host_Drv_InterruptFlash(2U * sizeof(uint32_t));
+   ToggleError(TOGGLED_ERROR);
+   Test_Harness_Run(FLUSH_MILLISECONDS);
+
+   // A partly programmed page is not valid
+   ReadLogPage(tornIndex, &page);
+   TEST_CHECK((!page.isBlank) && (!page.isValid));
+
+   Test_Harness_Start();
+   TEST_CHECK(Lunar_ErrorMgr_GetErrorState(PERSISTENT_ERROR));
+
+   ToggleError(TOGGLED_ERROR);
+   Test_Harness_Run(FLUSH_MILLISECONDS);
+
+   // The torn page is skipped, never programmed again
+   if (TEST_CHECK(FindNewestPage(&newestIndex, &newestPage)))
+   {
+      TEST_CHECK(newestIndex == ((tornIndex + 1U) % NUM_PAGES));
+      TEST_CHECK(newestPage.sequenceNumber == (previousPage.sequenceNumber + 1U));
+      TEST_CHECK((newestPage.errorWords[(uint32_t)PERSISTENT_ERROR / 32U] & persistentBit) != 0U);
+   }
+
+   //-----------------------------------------------
+   // Power loss while a sector is erased
+   //-----------------------------------------------
+
+   // Fill the sector, a page at a time
+   for (uint32_t i = 0U; (i < NUM_PAGES_PER_SECTOR) && (((newestIndex + 1U) % NUM_PAGES_PER_SECTOR) != 0U); i++)
+   {
+      ToggleError(TOGGLED_ERROR);
+      Test_Harness_Run(FLUSH_MILLISECONDS);
+      (void)FindNewestPage(&newestIndex, &newestPage);
+   }
+
+   const uint32_t erasedIndex = (newestIndex + 1U) % NUM_PAGES;
+   const uint32_t erasedSector = erasedIndex / NUM_PAGES_PER_SECTOR;
+   const uint32_t numErases = Host_Drv_GetFlashEraseCount(GetSectorAddress(erasedSector));
+
+   TEST_CHECK((erasedIndex % NUM_PAGES_PER_SECTOR) == 0U);
+   previousPage = newestPage;
+   Host_Drv_InterruptFlash(FLASH_DRV_SECTOR_SIZE / 2U);
+   ToggleError(TOGGLED_ERROR);
+   Test_Harness_Run(FLUSH_MILLISECONDS);
+
+   // The sector is only half erased
+   TEST_CHECK(Host_Drv_GetFlashEraseCount(GetSectorAddress(erasedSector)) == (numErases + 1U));
+   ReadLogPage(erasedIndex, &page);
+   TEST_CHECK(page.isBlank);
+   ReadLogPage(erasedIndex + NUM_PAGES_PER_SECTOR - 1U, &page);
+   TEST_CHECK(!page.isBlank);
+
+   Test_Harness_Start();
+   TEST_CHECK(Lunar_ErrorMgr_GetErrorState(PERSISTENT_ERROR));
+
+   ToggleError(TOGGLED_ERROR);
+   Test_Harness_Run(FLUSH_MILLISECONDS);
+
+   // The sector is erased again before its first page is written
+   TEST_CHECK(Host_Drv_GetFlashEraseCount(GetSectorAddress(erasedSector)) == (numErases + 2U));
+   ReadLogPage(erasedIndex + NUM_PAGES_PER_SECTOR - 1U, &page);
+   TEST_CHECK(page.isBlank);
+
+   if (TEST_CHECK(FindNewestPage(&newestIndex, &newestPage)))
+   {
+      TEST_CHECK(newestIndex == erasedIndex);
+      TEST_CHECK(newestPage.sequenceNumber == (previousPage.sequenceNumber + 1U));
+      TEST_CHECK((newestPage.errorWords[(uint32_t)PERSISTENT_ERROR / 32U] & persistentBit) != 0U);
+   }
+
+   return(Test_Harness_Finish());
+}
@@ -0,0 +1,391 @@
+/*******************************************************************************
+// Error Manager Test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Test_Harness.h"
+// Platform Includes
+#include "Control.h"
+#include "Control_Config.h"
+#include "Lunar_ErrorMgr.h"
+#include "Lunar_ErrorMgr_ConfigTable.h"
+#include "Lunar_EventMgr.h"
+#include "Timebase_Drv.h"
+// Other Includes
+#include <string.h> // memcpy
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// An error that is qualified before it changes
+#define QUALIFIED_ERROR (LUNAR_ERRORMGR_ERROR_VOLTAGE_LOW)
+
+// The periods the error is requested at, the qualification must not depend on them
+#define FAST_REQUEST_MILLISECONDS (1U)
+#define SLOW_REQUEST_MILLISECONDS (10U)
+
+// An error without a qualification time, toggled to fill the transition ring
+#define TOGGLED_ERROR (LUNAR_ERRORMGR_ERROR_WATCHDOG_TIMEOUT)
+// A persistent error that is restored after a reset
+#define PERSISTENT_ERROR (LUNAR_ERRORMGR_ERROR_RAM_CHECK_FAILED)
+
+// The transitions recorded to wrap the ring, an even number leaves the error clear
+#define NUM_TOGGLES (LUNAR_ERRORMGR_NUM_HISTORY_TRANSITIONS + 4U)
+
+// The retrigger intervals a flickering critical error is toggled for
+#define NUM_RETRIGGER_INTERVALS (3U)
+
+// Error Manager commands
+#define ERRORMGR_MODULE_ID (0x02U)
+#define ERRORMGR_COMMAND_GET_ERROR_HISTORY (0x06U)
+#define ERRORMGR_COMMAND_GET_ALL_ERROR_COUNTS (0x07U)
+#define ERRORMGR_COMMAND_GET_RECENT_TRANSITIONS (0x08U)
+#define ERRORMGR_COMMAND_CLEAR_ERROR_HISTORY (0x09U)
+
+// GetErrorHistory response layout
+#define HISTORY_FIRST_SEEN_OFFSET (0U)
+#define HISTORY_LAST_SEEN_OFFSET (4U)
+#define HISTORY_NUM_OCCURRENCES_OFFSET (8U)
+
+// GetRecentTransitions response layout, the entries are split into arrays
+#define TRANSITIONS_PER_READ (6U)
+#define TRANSITIONS_NUM_TRANSITIONS_OFFSET (0U)
+#define TRANSITIONS_NUM_ENTRIES_OFFSET (4U)
+#define TRANSITIONS_ERROR_STATES_OFFSET (5U)
+#define TRANSITIONS_ERRORS_OFFSET (6U)
+#define TRANSITIONS_TIMESTAMPS_OFFSET (12U)
+#define TRANSITIONS_LENGTH (TRANSITIONS_TIMESTAMPS_OFFSET + (TRANSITIONS_PER_READ * 4U))
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function requests a state of an error periodically until it
+  *    changes or twice the qualification time passed.
+  * Parameters:
+  *    errorState :          The requested state
+  *    periodMilliseconds :  The time between two requests
+  * Returns:
+  *    uint32_t - The milliseconds from the first request to the change
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint32_t RequestUntilChanged(const bool errorState, const uint32_t periodMilliseconds);
+
+/** Description:
+  *    This function reads the occurrence count of an error with the
+  *    GetErrorHistory command and checks it against the GetAllErrorCounts
+  *    command.
+  * Parameters:
+  *    error :          The error to read
+  *    firstSeenTime :  Set to the tick count when the error was first set
+  *    lastSeenTime :   Set to the tick count when the error was last set
+  * Returns:
+  *    uint32_t - The number of occurrences, UINT32_MAX if the commands disagree
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint32_t GetOccurrences(const Lunar_ErrorMgr_Error_t error, uint32_t *const firstSeenTime, uint32_t *const lastSeenTime);
+
+/** Description:
+  *    This function reads a page of the recent transitions.
+  * Parameters:
+  *    startIndex :  The number of newest transitions to skip
+  *    response :    Buffer of TRANSITIONS_LENGTH bytes for the response
+  * Returns:
+  *    bool - true if a response of TRANSITIONS_LENGTH bytes arrived
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool GetRecentTransitions(const uint8_t startIndex, uint8_t *const response);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Request a state until it changes
+static uint32_t RequestUntilChanged(const bool errorState, const uint32_t periodMilliseconds)
+{
+   const Lunar_ErrorMgr_QualificationConfigItem_t *const config = &Lunar_ErrorMgr_qualificationConfigTable[QUALIFIED_ERROR];
+   const uint32_t maxMilliseconds = 2U * (uint32_t)(errorState ? config->setTimeMs : config->clearTimeMs);
+   const uint32_t startTime = Timebase_Drv_GetCurrentTickCount();
+   uint32_t elapsedMilliseconds = 0U;
+
+   Lunar_ErrorMgr_SetErrorState(QUALIFIED_ERROR, errorState);
+
+   while ((Lunar_ErrorMgr_GetErrorState(QUALIFIED_ERROR) != errorState) && (elapsedMilliseconds <= maxMilliseconds))
+   {
+      Test_Harness_Run(periodMilliseconds);
+      elapsedMilliseconds = (Timebase_Drv_GetCurrentTickCount() - startTime) / TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND;
+      Lunar_ErrorMgr_SetErrorState(QUALIFIED_ERROR, errorState);
+   }
+
+   return(elapsedMilliseconds);
+}
+
+// Read the occurrences of an error
+static uint32_t GetOccurrences(const Lunar_ErrorMgr_Error_t error, uint32_t *const firstSeenTime, uint32_t *const lastSeenTime)
+{
+   uint8_t response[64];
+   uint16_t numOccurrences = 0U;
+   uint16_t counts[LUNAR_ERRORMGR_ERROR_Count];
+   uint32_t result = UINT32_MAX;
+
+   if (Test_Harness_SendCommand((UART_Drv_Channel_t)0, ERRORMGR_MODULE_ID, ERRORMGR_COMMAND_GET_ERROR_HISTORY, (const uint8_t *)&error, sizeof(error),
+                                response, sizeof(response)) > (int)HISTORY_NUM_OCCURRENCES_OFFSET)
+   {
+      memcpy(firstSeenTime, &response[HISTORY_FIRST_SEEN_OFFSET], sizeof(*firstSeenTime));
+      memcpy(lastSeenTime, &response[HISTORY_LAST_SEEN_OFFSET], sizeof(*lastSeenTime));
+      memcpy(&numOccurrences, &response[HISTORY_NUM_OCCURRENCES_OFFSET], sizeof(numOccurrences));
+
+      if (Test_Harness_SendCommand((UART_Drv_Channel_t)0, ERRORMGR_MODULE_ID, ERRORMGR_COMMAND_GET_ALL_ERROR_COUNTS, NULL, 0U,
+                                   response, sizeof(response)) == (int)sizeof(counts))
+      {
+         memcpy(counts, response, sizeof(counts));
+         if (counts[error] == numOccurrences)
+         {
+            result = numOccurrences;
+         }
+      }
+   }
+
+   return(result);
+}
+
+// Read a page of the recent transitions
+static bool GetRecentTransitions(const uint8_t startIndex, uint8_t *const response)
+{
+   return(Test_Harness_SendCommand((UART_Drv_Channel_t)0, ERRORMGR_MODULE_ID, ERRORMGR_COMMAND_GET_RECENT_TRANSITIONS, &startIndex, sizeof(startIndex),
+                                   response, TRANSITIONS_LENGTH) == (int)TRANSITIONS_LENGTH);
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Test entry point
+int main(void)
+{
+   const Lunar_ErrorMgr_QualificationConfigItem_t *const config = &Lunar_ErrorMgr_qualificationConfigTable[QUALIFIED_ERROR];
+
+   Test_Harness_Start();
+   TEST_CHECK(config->setTimeMs > SLOW_REQUEST_MILLISECONDS);
+   TEST_CHECK(!Lunar_ErrorMgr_GetErrorState(QUALIFIED_ERROR));
+
+   //-----------------------------------------------
+   // The qualification time does not depend on the request rate
+   //-----------------------------------------------
+
+   TEST_CHECK(RequestUntilChanged(true, FAST_REQUEST_MILLISECONDS) == config->setTimeMs);
+   TEST_CHECK(RequestUntilChanged(false, FAST_REQUEST_MILLISECONDS) == config->clearTimeMs);
+
+   // A slow requester sees the change at its first request after the time
+   uint32_t elapsedMilliseconds = RequestUntilChanged(true, SLOW_REQUEST_MILLISECONDS);
+
+   TEST_CHECK((elapsedMilliseconds >= config->setTimeMs) && (elapsedMilliseconds < (config->setTimeMs + SLOW_REQUEST_MILLISECONDS)));
+   elapsedMilliseconds = RequestUntilChanged(false, SLOW_REQUEST_MILLISECONDS);
+   TEST_CHECK((elapsedMilliseconds >= config->clearTimeMs) && (elapsedMilliseconds < (config->clearTimeMs + SLOW_REQUEST_MILLISECONDS)));
+
+   //-----------------------------------------------
+   // A request for the current state restarts the qualification
+   //-----------------------------------------------
+
+   for (uint32_t i = 0U; i < 4U; i++)
+   {
+      for (uint32_t elapsed = 0U; elapsed < (config->setTimeMs - 1U); elapsed++)
+      {
+         Lunar_ErrorMgr_SetErrorState(QUALIFIED_ERROR, true);
+         Test_Harness_Run(1U);
+      }
+
+      Lunar_ErrorMgr_SetErrorState(QUALIFIED_ERROR, false);
+   }
+
+   TEST_CHECK(!Lunar_ErrorMgr_GetErrorState(QUALIFIED_ERROR));
+
+   // Errors without a qualification time change on the first request
+   Lunar_ErrorMgr_SetErrorState(LUNAR_ERRORMGR_ERROR_WATCHDOG_TIMEOUT, true);
+   TEST_CHECK(Lunar_ErrorMgr_GetErrorState(LUNAR_ERRORMGR_ERROR_WATCHDOG_TIMEOUT));
+   Lunar_ErrorMgr_SetErrorState(LUNAR_ERRORMGR_ERROR_WATCHDOG_TIMEOUT, false);
+   TEST_CHECK(!Lunar_ErrorMgr_GetErrorState(LUNAR_ERRORMGR_ERROR_WATCHDOG_TIMEOUT));
+
+   //-----------------------------------------------
+   // Only setting an error counts as an occurrence
+   //-----------------------------------------------
+
+   uint8_t response[TRANSITIONS_LENGTH];
+   uint32_t transitionTimes[NUM_TOGGLES];
+   uint32_t numTransitions = 0U;
+   uint32_t firstSeenTime = 0U;
+   uint32_t lastSeenTime = 0U;
+
+   TEST_CHECK(Test_Harness_SendCommand((UART_Drv_Channel_t)0, ERRORMGR_MODULE_ID, ERRORMGR_COMMAND_CLEAR_ERROR_HISTORY, NULL, 0U, response, sizeof(response)) == 0);
+   TEST_CHECK(GetOccurrences(TOGGLED_ERROR, &firstSeenTime, &lastSeenTime) == 0U);
+   if (TEST_CHECK(GetRecentTransitions(0U, response)))
+   {
+      memcpy(&numTransitions, &response[TRANSITIONS_NUM_TRANSITIONS_OFFSET], sizeof(numTransitions));
+      TEST_CHECK((numTransitions == 0U) && (response[TRANSITIONS_NUM_ENTRIES_OFFSET] == 0U));
+   }
+
+   // Each toggle is one transition, 1 ms after the previous one
+   for (uint32_t i = 0U; i < NUM_TOGGLES; i++)
+   {
+      transitionTimes[i] = Timebase_Drv_GetCurrentTickCount();
+      Lunar_ErrorMgr_SetErrorState(TOGGLED_ERROR, (i % 2U) == 0U);
+      Test_Harness_Run(1U);
+   }
+
+   TEST_CHECK(!Lunar_ErrorMgr_GetErrorState(TOGGLED_ERROR));
+   TEST_CHECK(GetOccurrences(TOGGLED_ERROR, &firstSeenTime, &lastSeenTime) == (NUM_TOGGLES / 2U));
+   TEST_CHECK(firstSeenTime == transitionTimes[0]);
+   TEST_CHECK(lastSeenTime == transitionTimes[NUM_TOGGLES - 2U]);
+
+   //-----------------------------------------------
+   // The paged read returns the wrapped ring newest first
+   //-----------------------------------------------
+
+   for (uint32_t startIndex = 0U; startIndex <= LUNAR_ERRORMGR_NUM_HISTORY_TRANSITIONS; startIndex += TRANSITIONS_PER_READ)
+   {
+      if (TEST_CHECK(GetRecentTransitions((uint8_t)startIndex, response)))
+      {
+         // The ring holds the newest LUNAR_ERRORMGR_NUM_HISTORY_TRANSITIONS of them
+         uint32_t expectedEntries = PLATFORM_MIN(TRANSITIONS_PER_READ, LUNAR_ERRORMGR_NUM_HISTORY_TRANSITIONS - startIndex);
+
+         memcpy(&numTransitions, &response[TRANSITIONS_NUM_TRANSITIONS_OFFSET], sizeof(numTransitions));
+         TEST_CHECK(numTransitions == NUM_TOGGLES);
+         TEST_CHECK(response[TRANSITIONS_NUM_ENTRIES_OFFSET] == expectedEntries);
+
+         for (uint32_t i = 0U; i < TRANSITIONS_PER_READ; i++)
+         {
+            uint32_t timestamp = 0U;
+            bool errorState = (response[TRANSITIONS_ERROR_STATES_OFFSET] & (1U << i)) != 0U;
+
+            memcpy(&timestamp, &response[TRANSITIONS_TIMESTAMPS_OFFSET + (i * sizeof(timestamp))], sizeof(timestamp));
+            if (i < expectedEntries)
+            {
+               uint32_t transition = NUM_TOGGLES - (startIndex + i + 1U);
+
+               TEST_CHECK(response[TRANSITIONS_ERRORS_OFFSET + i] == (uint8_t)TOGGLED_ERROR);
+               TEST_CHECK(errorState == ((transition % 2U) == 0U));
+               TEST_CHECK(timestamp == transitionTimes[transition]);
+            }
+            else
+            {
+               // Unused entries are zero
+               TEST_CHECK((response[TRANSITIONS_ERRORS_OFFSET + i] == 0U) && !errorState && (timestamp == 0U));
+            }
+         }
+      }
+   }
+
+   //-----------------------------------------------
+   // Restoring a persistent error adds no history
+   //-----------------------------------------------
+
+   uint32_t errorWords[LUNAR_ERRORMGR_NUM_ERROR_WORDS];
+
+   Lunar_ErrorMgr_SetErrorState(PERSISTENT_ERROR, true);
+   Lunar_ErrorMgr_GetErrorWords(errorWords);
+   Lunar_ErrorMgr_ClearAllErrors();
+   TEST_CHECK(!Lunar_ErrorMgr_GetErrorState(PERSISTENT_ERROR));
+   TEST_CHECK(GetOccurrences(PERSISTENT_ERROR, &firstSeenTime, &lastSeenTime) == 1U);
+
+   // The error is set again as if it had been read from flash after a reset
+   uint8_t transitionsBeforeRestore[TRANSITIONS_LENGTH];
+
+   Test_Harness_Run(1U);
+   TEST_CHECK(GetRecentTransitions(0U, transitionsBeforeRestore));
+   Lunar_ErrorMgr_RestorePersistentErrors(errorWords);
+   TEST_CHECK(Lunar_ErrorMgr_GetErrorState(PERSISTENT_ERROR));
+
+   uint32_t restoredFirstSeenTime = 0U;
+   uint32_t restoredLastSeenTime = 0U;
+
+   TEST_CHECK(GetOccurrences(PERSISTENT_ERROR, &restoredFirstSeenTime, &restoredLastSeenTime) == 1U);
+   TEST_CHECK((restoredFirstSeenTime == firstSeenTime) && (restoredLastSeenTime == lastSeenTime));
+   if (TEST_CHECK(GetRecentTransitions(0U, response)))
+   {
+      // The newest transitions are still the ones of ClearAllErrors
+      TEST_CHECK(memcmp(response, transitionsBeforeRestore, TRANSITIONS_LENGTH) == 0);
+      TEST_CHECK((response[TRANSITIONS_ERROR_STATES_OFFSET] & 1U) == 0U);
+   }
+
+   //-----------------------------------------------
+   // A flickering critical error raises one event per retrigger interval
+   //-----------------------------------------------
+
+   const uint32_t minRetriggerMs = Lunar_ErrorMgr_qualificationConfigTable[TOGGLED_ERROR].minRetriggerMs;
+
+   Lunar_ErrorMgr_ClearAllErrors();
+   TEST_CHECK(minRetriggerMs > 1U);
+
+   // Let the events of the toggles above expire
+   Test_Harness_Run(minRetriggerMs);
+
+   uint32_t startEventCount = Lunar_EventMgr_GetEventCount(LUNAR_EVENTMGR_CONFIG_EVENT_Critical_Error);
+
+   for (uint32_t interval = 0U; interval < NUM_RETRIGGER_INTERVALS; interval++)
+   {
+      // Set and clear the error every millisecond of the interval
+      for (uint32_t elapsed = 0U; elapsed < minRetriggerMs; elapsed++)
+      {
+         Lunar_ErrorMgr_SetErrorState(TOGGLED_ERROR, true);
+         Lunar_ErrorMgr_SetErrorState(TOGGLED_ERROR, false);
+         Test_Harness_Run(1U);
+      }
+
+      // Only the first set of the interval raised the event
+      TEST_CHECK(Lunar_EventMgr_GetEventCount(LUNAR_EVENTMGR_CONFIG_EVENT_Critical_Error) == (startEventCount + interval + 1U));
+   }
+
+   // The next set after the last interval raises the event again
+   Lunar_ErrorMgr_SetErrorState(TOGGLED_ERROR, true);
+   TEST_CHECK(Lunar_EventMgr_GetEventCount(LUNAR_EVENTMGR_CONFIG_EVENT_Critical_Error) == (startEventCount + NUM_RETRIGGER_INTERVALS + 1U));
+   Lunar_ErrorMgr_SetErrorState(TOGGLED_ERROR, false);
+
+   //-----------------------------------------------
+   // A critical error stops the control until the errors are cleared
+   //-----------------------------------------------
+
+   Lunar_ErrorMgr_ClearAllErrors();
+   Test_Harness_Run(minRetriggerMs);
+   Control_SetState(CONTROL_ACTIVE_STATE);
+   TEST_CHECK(Control_GetState() == CONTROL_ACTIVE_STATE);
+
+   startEventCount = Lunar_EventMgr_GetEventCount(LUNAR_EVENTMGR_CONFIG_EVENT_Critical_Error);
+   const uint32_t startDisabledCount = Lunar_EventMgr_GetEventCount(LUNAR_EVENTMGR_CONFIG_EVENT_Control_Disabled);
+
+   // The control fault is not critical, so the handler runs once
+   Lunar_ErrorMgr_SetErrorState(TOGGLED_ERROR, true);
+   TEST_CHECK(Lunar_ErrorMgr_GetErrorState(LUNAR_ERRORMGR_ERROR_CONTROL_FAULT));
+   TEST_CHECK(Lunar_EventMgr_GetEventCount(LUNAR_EVENTMGR_CONFIG_EVENT_Critical_Error) == (startEventCount + 1U));
+   TEST_CHECK(Lunar_EventMgr_GetEventCount(LUNAR_EVENTMGR_CONFIG_EVENT_Control_Disabled) == (startDisabledCount + 1U));
+   TEST_CHECK(Control_GetState() == CONTROL_STATE_FAULT);
+
+   // The control fault outlasts the critical error
+   Lunar_ErrorMgr_SetErrorState(TOGGLED_ERROR, false);
+   Test_Harness_Run(1U);
+   TEST_CHECK(Lunar_ErrorMgr_GetErrorState(LUNAR_ERRORMGR_ERROR_CONTROL_FAULT));
+   TEST_CHECK(Control_GetState() == CONTROL_STATE_FAULT);
+
+   // Once cleared, the control waits in standby to be enabled again
+   Lunar_ErrorMgr_ClearAllErrors();
+   TEST_CHECK(Control_GetState() == CONTROL_STATE_STANDBY);
+   Control_SetState(CONTROL_ACTIVE_STATE);
+   TEST_CHECK(Control_GetState() == CONTROL_ACTIVE_STATE);
+
+   return(Test_Harness_Finish());
+}
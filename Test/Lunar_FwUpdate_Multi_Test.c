@@ -0,0 +1,650 @@
+/*******************************************************************************
+// Firmware Update Multiple Receiver Test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Test_Harness.h"
+// Platform Includes
+#include "Flash_Drv.h"
+#include "Lunar_FwUpdate.h"
+#include "Lunar_MathLib.h"
+#include "Timebase_Drv.h"
+// Other Includes
+#include <stdlib.h> // rand
+#include <string.h> // memset
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The size of the broadcast image, not a whole number of blocks
+#define IMAGE_SIZE (20000U)
+
+// A block of the image is one flash page, sent as 8 byte data frames
+#define BLOCK_SIZE (FLASH_DRV_PAGE_SIZE)
+#define FRAME_DATA_SIZE (8U)
+#define FRAMES_PER_BLOCK (BLOCK_SIZE / FRAME_DATA_SIZE)
+#define ALL_FRAMES (0xFFFFFFFFUL)
+#define NUM_BLOCKS ((IMAGE_SIZE + (BLOCK_SIZE - 1U)) / BLOCK_SIZE)
+
+// The low 8 bits of a data frame identifier hold the low block bits and the
+// frame number
+#define FRAME_NUMBER_MASK (0x1FU)
+#define BLOCK_TAG_SHIFT (5U)
+#define BLOCK_TAG_MASK (0x07U)
+
+// The control frames, in the order of their commands
+#define START_CANID (LUNAR_FWUPDATE_CONTROL_CANID | CAN_DRV_EXTENDED_ID)
+#define COMMIT_CANID ((LUNAR_FWUPDATE_CONTROL_CANID + 1U) | CAN_DRV_EXTENDED_ID)
+#define FINISH_CANID ((LUNAR_FWUPDATE_CONTROL_CANID + 2U) | CAN_DRV_EXTENDED_ID)
+#define ABORT_CANID ((LUNAR_FWUPDATE_CONTROL_CANID + 3U) | CAN_DRV_EXTENDED_ID)
+
+// The reports carry a tag of the unique chip ID in the low 16 bits
+#define REPORT_TAG_MASK (0xFFFFU)
+
+// The flags of a report
+#define REPORT_FLAG_BUSY (0x01U)
+#define REPORT_FLAG_CRC_ERROR (0x02U)
+
+// The share of the data and commit frames each receiver loses
+#define FRAME_LOSS_PERCENT (1)
+
+// Data frames sent each millisecond, below the 500 kbit/s of the bus
+#define DATA_FRAMES_PER_MILLISECOND (3U)
+
+// Time the sender waits for reports after a commit, and before it commits a
+// block again for a node that was busy
+#define COMMIT_WAIT_MILLISECONDS (12U)
+#define BUSY_WAIT_MILLISECONDS (10U)
+
+// Time the sender waits for the reports after a finish, and how often the
+// finish is sent
+#define FINISH_WAIT_MILLISECONDS (100U)
+#define MAX_FINISHES (10U)
+
+// The number of receivers of the largest update, the firmware is one of them
+#define MAX_RECEIVERS (32U)
+#define MAX_MODEL_RECEIVERS (MAX_RECEIVERS - 1U)
+
+// The update is given up after this many commits
+#define MAX_COMMITS (8U * NUM_BLOCKS)
+
+// The firmware update in the Message Router and its status command
+#define FWUPDATE_MODULE_ID (0x10U)
+#define FWUPDATE_COMMAND_GET_STATUS (0x01U)
+
+// Offsets in the status response
+#define STATUS_IMAGE_CRC_OFFSET (4U)
+#define STATUS_REPORT_TAG_OFFSET (24U)
+#define STATUS_STATE_OFFSET (26U)
+#define STATUS_LENGTH (28U)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// This structure holds the reports received after a control frame
+typedef struct
+{
+   uint32_t numReports;
+   uint32_t numVerified;
+   uint8_t flags;
+   // The lowest block any node is receiving, and the frames missing from it
+   uint16_t block;
+   uint32_t missingFrames;
+} Reports_t;
+
+// This structure models the update of another receiver.  It follows the
+// rules of Lunar_FwUpdate.c, but a committed block is staged at once, so it
+// is never busy.
+typedef struct
+{
+   // The staged image and the block being received
+   uint8_t staged[NUM_BLOCKS * BLOCK_SIZE];
+   uint8_t receive[BLOCK_SIZE];
+
+   // The state of the random number generator for the lost frames
+   uint32_t randomState;
+
+   // One bit for each frame of the block being received
+   uint32_t receivedFrames;
+
+   uint16_t nextBlock;
+   uint16_t reportTag;
+   Lunar_FwUpdate_State_t state;
+} ModelReceiver_t;
+
+// This structure holds the frames sent for one update
+typedef struct
+{
+   uint32_t numReceivers;
+   uint32_t numDataFrames;
+   uint32_t numCommits;
+   uint32_t numLostFrames;
+   uint32_t elapsedMilliseconds;
+} Result_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The broadcast image
+static uint8_t image[IMAGE_SIZE];
+
+// The modelled receivers and the number taking part in the update
+static ModelReceiver_t models[MAX_MODEL_RECEIVERS];
+static uint32_t numModels = 0U;
+
+// The reports of the modelled receivers since the last collection
+static Reports_t modelReports;
+
+// The frames the sender sent and the receivers lost
+static Result_t result;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function decides if a receiver loses a frame.  The firmware
+  *    draws from rand, each modelled receiver from its own generator, so
+  *    the losses of the receivers are independent.
+  * Parameters:
+  *    model :  The modelled receiver, NULL for the firmware
+  * Returns:
+  *    bool - true if the frame is lost
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool IsLost(ModelReceiver_t *const model);
+
+/** Description:
+  *    This function adds a report to the collected reports, as the sender
+  *    merges them.
+  * Parameters:
+  *    reports :        The collected reports
+  *    state :          The state of the receiver
+  *    flags :          The report flags
+  *    block :          The block the receiver is receiving
+  *    missingFrames :  The frames missing from the block
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void AddReport(Reports_t *const reports, const uint8_t state, const uint8_t flags, const uint16_t block, const uint32_t missingFrames);
+
+/** Description:
+  *    This function passes a frame of the sender to a modelled receiver.
+  * Parameters:
+  *    model :  The modelled receiver
+  *    canId :  The identifier of the frame
+  *    data :   The data of the frame
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void ReceiveModelFrame(ModelReceiver_t *const model, const uint32_t canId, const uint8_t *const data);
+
+/** Description:
+  *    This function sends a frame to every receiver.
+  * Parameters:
+  *    canId :     The identifier of the frame
+  *    data :      The data of the frame
+  *    length :    The number of data bytes
+  *    isLossy :   true if each receiver loses the frame at FRAME_LOSS_PERCENT
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void SendFrame(const uint32_t canId, const uint8_t *const data, const uint8_t length, const bool isLossy);
+
+/** Description:
+  *    This function sends the data frames of a block.
+  * Parameters:
+  *    block :   The block number
+  *    frames :  One bit for each frame to send
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void SendBlock(const uint32_t block, const uint32_t frames);
+
+/** Description:
+  *    This function runs the firmware and collects the reports of every
+  *    receiver.
+  * Parameters:
+  *    milliseconds :  The time to run
+  *    reports :       Filled with the collected reports
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void CollectReports(const uint32_t milliseconds, Reports_t *const reports);
+
+/** Description:
+  *    This function broadcasts a new image to the firmware and a number of
+  *    modelled receivers, with the sender of Lunar_FwUpdate_Test.  A node
+  *    that reports a lower block after the finish is sent that block again.
+  * Parameters:
+  *    numReceivers :  The number of receivers, the firmware included
+  *    firmwareTag :   The report tag of the firmware
+  * Returns:
+  *    uint32_t - The number of receivers that reported the image verified
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint32_t RunUpdate(const uint32_t numReceivers, const uint16_t firmwareTag);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Decide if a receiver loses a frame
+static bool IsLost(ModelReceiver_t *const model)
+{
+   uint32_t random;
+
+   if (model == NULL)
+   {
+      random = (uint32_t)rand();
+   }
+   else
+   {
+      uint32_t x = model->randomState;
+
+      x ^= x << 13U;
+      x ^= x >> 17U;
+      x ^= x << 5U;
+      model->randomState = x;
+      random = x;
+   }
+
+   return((random % 100U) < (uint32_t)FRAME_LOSS_PERCENT);
+}
+
+// Add a report
+static void AddReport(Reports_t *const reports, const uint8_t state, const uint8_t flags, const uint16_t block, const uint32_t missingFrames)
+{
+   // The sender repeats the union of the frames missing from the lowest block
+   if ((reports->numReports == 0U) || (block < reports->block))
+   {
+      reports->block = block;
+      reports->missingFrames = missingFrames;
+   }
+   else if (block == reports->block)
+   {
+      reports->missingFrames |= missingFrames;
+   }
+   else
+   {
+      // The node is ahead of another one
+   }
+
+   if (state == (uint8_t)LUNAR_FWUPDATE_STATE_Verified)
+   {
+      reports->numVerified++;
+   }
+
+   reports->flags |= flags;
+   reports->numReports++;
+}
+
+// Pass a frame to a modelled receiver
+static void ReceiveModelFrame(ModelReceiver_t *const model, const uint32_t canId, const uint8_t *const data)
+{
+   if (canId == START_CANID)
+   {
+      model->nextBlock = 0U;
+      model->receivedFrames = 0U;
+      model->state = LUNAR_FWUPDATE_STATE_Receiving;
+   }
+   else if (canId == ABORT_CANID)
+   {
+      model->state = LUNAR_FWUPDATE_STATE_Idle;
+   }
+   else if (canId == FINISH_CANID)
+   {
+      if ((model->state == LUNAR_FWUPDATE_STATE_Receiving) && (model->nextBlock == NUM_BLOCKS))
+      {
+         model->state = (Lunar_MathLib_Crc32(model->staged, IMAGE_SIZE, LUNAR_MATHLIB_CRC32_INITIAL_VALUE) ==
+                         Lunar_MathLib_Crc32(image, IMAGE_SIZE, LUNAR_MATHLIB_CRC32_INITIAL_VALUE)) ?
+                        LUNAR_FWUPDATE_STATE_Verified : LUNAR_FWUPDATE_STATE_Failed;
+      }
+
+      AddReport(&modelReports, (uint8_t)model->state, 0U, model->nextBlock,
+                (model->state == LUNAR_FWUPDATE_STATE_Receiving) ? ~model->receivedFrames : 0U);
+   }
+   else if (canId == COMMIT_CANID)
+   {
+      const uint16_t block = (uint16_t)(data[0] | ((uint16_t)data[1] << 8U));
+      const uint16_t blockCrc = (uint16_t)(data[2] | ((uint16_t)data[3] << 8U));
+
+      if ((model->state != LUNAR_FWUPDATE_STATE_Receiving) || (block < model->nextBlock))
+      {
+         // The block is not needed, the silence is taken as an acknowledge
+      }
+      else if ((block > model->nextBlock) || (model->receivedFrames != ALL_FRAMES))
+      {
+         AddReport(&modelReports, (uint8_t)model->state, 0U, model->nextBlock, ~model->receivedFrames);
+      }
+      else if (Lunar_MathLib_Crc16(model->receive, BLOCK_SIZE, LUNAR_MATHLIB_CRC16_INITIAL_VALUE) != blockCrc)
+      {
+         model->receivedFrames = 0U;
+         AddReport(&modelReports, (uint8_t)model->state, REPORT_FLAG_CRC_ERROR, model->nextBlock, ALL_FRAMES);
+      }
+      else
+      {
+         memcpy(&model->staged[model->nextBlock * BLOCK_SIZE], model->receive, BLOCK_SIZE);
+         model->nextBlock++;
+         model->receivedFrames = 0U;
+      }
+   }
+   else
+   {
+      const uint32_t frameNumber = canId & FRAME_NUMBER_MASK;
+      const uint32_t blockTag = (canId >> BLOCK_TAG_SHIFT) & BLOCK_TAG_MASK;
+
+      if ((model->state == LUNAR_FWUPDATE_STATE_Receiving) && (model->nextBlock < NUM_BLOCKS) &&
+          (blockTag == (model->nextBlock & BLOCK_TAG_MASK)))
+      {
+         memcpy(&model->receive[frameNumber * FRAME_DATA_SIZE], data, FRAME_DATA_SIZE);
+         model->receivedFrames |= (1UL << frameNumber);
+      }
+   }
+}
+
+// Send a frame to every receiver
+static void SendFrame(const uint32_t canId, const uint8_t *const data, const uint8_t length, const bool isLossy)
+{
+   CAN_Drv_Frame_t frame;
+
+   if ((isLossy) && (IsLost(NULL)))
+   {
+      result.numLostFrames++;
+   }
+   else
+   {
+      memset(&frame, 0, sizeof(frame));
+      frame.canId = canId;
+      frame.length = length;
+      memcpy(frame.data, data, length);
+
+      TEST_CHECK(Host_Drv_ReceiveCAN(&frame));
+   }
+
+   for (uint32_t i = 0U; i < numModels; i++)
+   {
+      if ((isLossy) && (IsLost(&models[i])))
+      {
+         result.numLostFrames++;
+      }
+      else
+      {
+         ReceiveModelFrame(&models[i], canId, data);
+      }
+   }
+}
+
+// Send the data frames of a block
+static void SendBlock(const uint32_t block, const uint32_t frames)
+{
+   uint8_t data[FRAME_DATA_SIZE];
+   uint32_t numSent = 0U;
+
+   for (uint32_t frameNumber = 0U; frameNumber < FRAMES_PER_BLOCK; frameNumber++)
+   {
+      if ((frames & (1UL << frameNumber)) != 0U)
+      {
+         const uint32_t offset = (block * BLOCK_SIZE) + (frameNumber * FRAME_DATA_SIZE);
+
+         // The last block is padded
+         memset(data, 0, sizeof(data));
+         if (offset < IMAGE_SIZE)
+         {
+            memcpy(data, &image[offset], PLATFORM_MIN(FRAME_DATA_SIZE, IMAGE_SIZE - offset));
+         }
+
+         SendFrame((LUNAR_FWUPDATE_DATA_CANID | ((block & BLOCK_TAG_MASK) << BLOCK_TAG_SHIFT) | frameNumber) | CAN_DRV_EXTENDED_ID, data, FRAME_DATA_SIZE, true);
+         result.numDataFrames++;
+         numSent++;
+
+         if ((numSent % DATA_FRAMES_PER_MILLISECOND) == 0U)
+         {
+            Test_Harness_Run(1U);
+         }
+      }
+   }
+}
+
+// Collect the reports
+static void CollectReports(const uint32_t milliseconds, Reports_t *const reports)
+{
+   CAN_Drv_Frame_t frame;
+
+   // The modelled receivers reported when they took the control frame
+   *reports = modelReports;
+   memset(&modelReports, 0, sizeof(modelReports));
+
+   for (uint32_t elapsed = 0U; elapsed < milliseconds; elapsed++)
+   {
+      Test_Harness_Run(1U);
+
+      while (Host_Drv_TakeCANOutput(&frame))
+      {
+         if ((frame.canId & ~REPORT_TAG_MASK) == (LUNAR_FWUPDATE_REPORT_CANID | CAN_DRV_EXTENDED_ID))
+         {
+            const uint16_t block = (uint16_t)(frame.data[2] | ((uint16_t)frame.data[3] << 8U));
+            const uint32_t missingFrames = (uint32_t)frame.data[4] | ((uint32_t)frame.data[5] << 8U) |
+                                           ((uint32_t)frame.data[6] << 16U) | ((uint32_t)frame.data[7] << 24U);
+
+            AddReport(reports, frame.data[0], frame.data[1], block, missingFrames);
+         }
+      }
+   }
+}
+
+// Broadcast an image to the receivers
+static uint32_t RunUpdate(const uint32_t numReceivers, const uint16_t firmwareTag)
+{
+   uint8_t frameData[8];
+   uint8_t blockData[BLOCK_SIZE];
+   Reports_t reports;
+   uint16_t reportTag = 0U;
+
+   memset(&result, 0, sizeof(result));
+   memset(&modelReports, 0, sizeof(modelReports));
+   result.numReceivers = numReceivers;
+   numModels = numReceivers - 1U;
+
+   // Every update sends a new image
+   for (uint32_t i = 0U; i < IMAGE_SIZE; i++)
+   {
+      image[i] = (uint8_t)rand();
+   }
+
+   for (uint32_t i = 0U; i < numModels; i++)
+   {
+      // The tags of the receivers differ from each other and the firmware
+      reportTag++;
+      reportTag = (reportTag == firmwareTag) ? (uint16_t)(reportTag + 1U) : reportTag;
+
+      memset(&models[i], 0, sizeof(models[i]));
+      models[i].randomState = ((i + 1U) * 0x9E3779B9UL) ^ (numReceivers << 16U);
+      models[i].reportTag = reportTag;
+      models[i].state = LUNAR_FWUPDATE_STATE_Idle;
+   }
+
+   const uint32_t imageCrc = Lunar_MathLib_Crc32(image, IMAGE_SIZE, LUNAR_MATHLIB_CRC32_INITIAL_VALUE);
+   const uint32_t imageSize = IMAGE_SIZE;
+   const uint32_t startTime = Timebase_Drv_GetCurrentTickCount();
+
+   // The update of the last image is stopped first
+   SendFrame(ABORT_CANID, frameData, 0U, false);
+   memcpy(&frameData[0], &imageSize, sizeof(imageSize));
+   memcpy(&frameData[4], &imageCrc, sizeof(imageCrc));
+   SendFrame(START_CANID, frameData, 8U, false);
+   Test_Harness_Run(BUSY_WAIT_MILLISECONDS);
+
+   uint32_t block = 0U;
+   uint32_t frames = ALL_FRAMES;
+   uint32_t numVerified = 0U;
+
+   for (uint32_t numFinishes = 0U; (numFinishes < MAX_FINISHES) && (numVerified < numReceivers); numFinishes++)
+   {
+      while ((block < NUM_BLOCKS) && (result.numCommits < MAX_COMMITS))
+      {
+         SendBlock(block, frames);
+
+         memset(blockData, 0, sizeof(blockData));
+         memcpy(blockData, &image[block * BLOCK_SIZE], PLATFORM_MIN(BLOCK_SIZE, IMAGE_SIZE - (block * BLOCK_SIZE)));
+
+         const uint16_t blockNumber = (uint16_t)block;
+         const uint16_t blockCrc = Lunar_MathLib_Crc16(blockData, BLOCK_SIZE, LUNAR_MATHLIB_CRC16_INITIAL_VALUE);
+
+         memcpy(&frameData[0], &blockNumber, sizeof(blockNumber));
+         memcpy(&frameData[2], &blockCrc, sizeof(blockCrc));
+         SendFrame(COMMIT_CANID, frameData, 4U, true);
+         result.numCommits++;
+
+         CollectReports(COMMIT_WAIT_MILLISECONDS, &reports);
+
+         if (reports.numReports == 0U)
+         {
+            // Silence acknowledges the block
+            block++;
+            frames = ALL_FRAMES;
+         }
+         else if ((reports.block == block) && ((reports.flags & REPORT_FLAG_BUSY) != 0U) && (reports.missingFrames == 0U))
+         {
+            // The block is committed again once the node programmed the last one
+            Test_Harness_Run(BUSY_WAIT_MILLISECONDS);
+            frames = 0U;
+         }
+         else
+         {
+            // Only the missing frames are sent again, from the lowest block
+            // a node is receiving
+            block = reports.block;
+            frames = reports.missingFrames;
+         }
+      }
+
+      // Every node reports after the finish, a node that missed the last
+      // commits reports the block it is receiving
+      SendFrame(FINISH_CANID, frameData, 0U, false);
+      CollectReports(FINISH_WAIT_MILLISECONDS, &reports);
+      numVerified = reports.numVerified;
+
+      if ((reports.numReports > 0U) && (reports.block < NUM_BLOCKS) && (reports.missingFrames != 0U))
+      {
+         block = reports.block;
+         frames = reports.missingFrames;
+      }
+   }
+
+   result.elapsedMilliseconds = (Timebase_Drv_GetCurrentTickCount() - startTime) / TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND;
+
+   return(numVerified);
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Test entry point
+int main(void)
+{
+   uint8_t response[STATUS_LENGTH];
+   uint8_t blockData[BLOCK_SIZE];
+   Result_t results[6];
+   uint32_t numResults = 0U;
+   uint16_t firmwareTag = 0U;
+
+   Test_Harness_Start();
+   srand(1U);
+
+   memset(response, 0, sizeof(response));
+   if (TEST_CHECK(Test_Harness_SendCommand((UART_Drv_Channel_t)0, FWUPDATE_MODULE_ID, FWUPDATE_COMMAND_GET_STATUS, NULL, 0U, response, sizeof(response)) == (int)STATUS_LENGTH))
+   {
+      memcpy(&firmwareTag, &response[STATUS_REPORT_TAG_OFFSET], sizeof(firmwareTag));
+   }
+
+   //-----------------------------------------------
+   // Every receiver verifies the image
+   //-----------------------------------------------
+
+   for (uint32_t numReceivers = 1U; numReceivers <= MAX_RECEIVERS; numReceivers *= 2U)
+   {
+      const uint32_t numVerified = RunUpdate(numReceivers, firmwareTag);
+
+      printf("%2u receivers: %u byte image in %u ms, %u data frames for %u, %u commits for %u blocks, %u frames lost\n",
+             (unsigned)numReceivers, (unsigned)IMAGE_SIZE, (unsigned)result.elapsedMilliseconds, (unsigned)result.numDataFrames,
+             (unsigned)(NUM_BLOCKS * FRAMES_PER_BLOCK), (unsigned)result.numCommits, (unsigned)NUM_BLOCKS, (unsigned)result.numLostFrames);
+
+      TEST_CHECK(numVerified == numReceivers);
+
+      // The firmware staged the image
+      uint32_t imageCrc;
+      bool isStaged = true;
+
+      memset(response, 0, sizeof(response));
+      TEST_CHECK(Test_Harness_SendCommand((UART_Drv_Channel_t)0, FWUPDATE_MODULE_ID, FWUPDATE_COMMAND_GET_STATUS, NULL, 0U, response, sizeof(response)) == (int)STATUS_LENGTH);
+      memcpy(&imageCrc, &response[STATUS_IMAGE_CRC_OFFSET], sizeof(imageCrc));
+      TEST_CHECK(imageCrc == Lunar_MathLib_Crc32(image, IMAGE_SIZE, LUNAR_MATHLIB_CRC32_INITIAL_VALUE));
+      TEST_CHECK(response[STATUS_STATE_OFFSET] == (uint8_t)LUNAR_FWUPDATE_STATE_Verified);
+
+      for (uint32_t offset = 0U; offset < IMAGE_SIZE; offset += BLOCK_SIZE)
+      {
+         const uint32_t length = PLATFORM_MIN(BLOCK_SIZE, IMAGE_SIZE - offset);
+
+         Flash_Drv_Read(LUNAR_FWUPDATE_STAGING_ADDRESS + offset, blockData, length);
+         isStaged = isStaged && (memcmp(blockData, &image[offset], length) == 0);
+      }
+      TEST_CHECK(isStaged);
+
+      // And so did every modelled receiver
+      for (uint32_t i = 0U; i < numModels; i++)
+      {
+         TEST_CHECK(models[i].state == LUNAR_FWUPDATE_STATE_Verified);
+         TEST_CHECK(memcmp(models[i].staged, image, IMAGE_SIZE) == 0);
+      }
+
+      results[numResults] = result;
+      numResults++;
+   }
+
+   //-----------------------------------------------
+   // The frames sent grow sub-linearly
+   //-----------------------------------------------
+
+   // The receivers lose different frames, so the repeated frames and blocks
+   // grow with the number of receivers, but far less than one update each
+   for (uint32_t i = 1U; i < numResults; i++)
+   {
+      const uint32_t lastFrames = results[i - 1U].numDataFrames + results[i - 1U].numCommits;
+      const uint32_t frames = results[i].numDataFrames + results[i].numCommits;
+
+      // Doubling the receivers adds less than half of the frames again
+      TEST_CHECK((2U * frames) < (3U * lastFrames));
+   }
+
+   const uint32_t singleFrames = results[0].numDataFrames + results[0].numCommits;
+   const uint32_t maxFrames = results[numResults - 1U].numDataFrames + results[numResults - 1U].numCommits;
+
+   // 32 receivers need less than 1.5 times the frames of one
+   TEST_CHECK((2U * maxFrames) < (3U * singleFrames));
+
+   return(Test_Harness_Finish());
+}
@@ -0,0 +1,409 @@
+/*******************************************************************************
+// Firmware Update Test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Test_Harness.h"
+// Platform Includes
+#include "Flash_Drv.h"
+#include "Lunar_FwUpdate.h"
+#include "Lunar_MathLib.h"
+#include "Timebase_Drv.h"
+// Other Includes
+#include <stdlib.h> // rand
+#include <string.h> // memset
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The size of the broadcast image, not a whole number of blocks
+#define IMAGE_SIZE (40000U)
+
+// A block of the image is one flash page, sent as 8 byte data frames
+#define BLOCK_SIZE (FLASH_DRV_PAGE_SIZE)
+#define FRAME_DATA_SIZE (8U)
+#define FRAMES_PER_BLOCK (BLOCK_SIZE / FRAME_DATA_SIZE)
+#define ALL_FRAMES (0xFFFFFFFFUL)
+#define NUM_BLOCKS ((IMAGE_SIZE + (BLOCK_SIZE - 1U)) / BLOCK_SIZE)
+
+// The low 8 bits of a data frame identifier hold the low block bits and the
+// frame number
+#define BLOCK_TAG_SHIFT (5U)
+#define BLOCK_TAG_MASK (0x07U)
+
+// The control frames, in the order of their commands
+#define START_CANID (LUNAR_FWUPDATE_CONTROL_CANID | CAN_DRV_EXTENDED_ID)
+#define COMMIT_CANID ((LUNAR_FWUPDATE_CONTROL_CANID + 1U) | CAN_DRV_EXTENDED_ID)
+#define FINISH_CANID ((LUNAR_FWUPDATE_CONTROL_CANID + 2U) | CAN_DRV_EXTENDED_ID)
+
+// The reports carry a tag of the unique chip ID in the low 16 bits
+#define REPORT_TAG_MASK (0xFFFFU)
+
+// The flags of a report
+#define REPORT_FLAG_BUSY (0x01U)
+#define REPORT_FLAG_CRC_ERROR (0x02U)
+
+// The share of the data and commit frames that is lost
+#define FRAME_LOSS_PERCENT (1)
+
+// Data frames sent each millisecond, below the 500 kbit/s of the bus
+#define DATA_FRAMES_PER_MILLISECOND (3U)
+
+// Time the sender waits for reports after a commit, and before it commits a
+// block again for a node that was busy
+#define COMMIT_WAIT_MILLISECONDS (12U)
+#define BUSY_WAIT_MILLISECONDS (10U)
+
+// Time the sender waits for the reports after a finish, and how often the
+// finish is sent
+#define FINISH_WAIT_MILLISECONDS (100U)
+#define MAX_FINISHES (10U)
+
+// The block that is corrupted once, the node has to receive it again
+#define CORRUPTED_BLOCK (3U)
+
+// The update is given up after this many commits
+#define MAX_COMMITS (4U * NUM_BLOCKS)
+
+// The firmware update in the Message Router and its status command
+#define FWUPDATE_MODULE_ID (0x10U)
+#define FWUPDATE_COMMAND_GET_STATUS (0x01U)
+
+// Offsets in the status response
+#define STATUS_IMAGE_SIZE_OFFSET (0U)
+#define STATUS_IMAGE_CRC_OFFSET (4U)
+#define STATUS_NUM_BLOCK_CRC_ERRORS_OFFSET (20U)
+#define STATUS_REPORT_TAG_OFFSET (24U)
+#define STATUS_STATE_OFFSET (26U)
+#define STATUS_FAILURE_OFFSET (27U)
+#define STATUS_LENGTH (28U)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// This structure holds the reports received after a control frame
+typedef struct
+{
+   uint32_t numReports;
+   uint32_t reportTag;
+   uint8_t state;
+   uint8_t flags;
+   // The lowest block any node is receiving, and the frames missing from it
+   uint16_t block;
+   uint32_t missingFrames;
+} Reports_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The broadcast image
+static uint8_t image[IMAGE_SIZE];
+
+// The number of frames the sender sent and lost
+static uint32_t numDataFrames = 0U;
+static uint32_t numCommits = 0U;
+static uint32_t numLostFrames = 0U;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function sends a frame to the node.
+  * Parameters:
+  *    canId :     The identifier of the frame
+  *    data :      The data of the frame
+  *    length :    The number of data bytes
+  *    isLossy :   true if the frame is lost at FRAME_LOSS_PERCENT
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void SendFrame(const uint32_t canId, const uint8_t *const data, const uint8_t length, const bool isLossy);
+
+/** Description:
+  *    This function sends the data frames of a block.
+  * Parameters:
+  *    block :          The block number
+  *    frames :         One bit for each frame to send
+  *    isCorrupted :    true to change a byte of the first frame
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void SendBlock(const uint32_t block, const uint32_t frames, const bool isCorrupted);
+
+/** Description:
+  *    This function runs the firmware and collects the reports it sends.
+  * Parameters:
+  *    milliseconds :  The time to run
+  *    reports :       Filled with the collected reports
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void CollectReports(const uint32_t milliseconds, Reports_t *const reports);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Send a frame
+static void SendFrame(const uint32_t canId, const uint8_t *const data, const uint8_t length, const bool isLossy)
+{
+   CAN_Drv_Frame_t frame;
+
+   if ((isLossy) && ((rand() % 100) < FRAME_LOSS_PERCENT))
+   {
+      numLostFrames++;
+   }
+   else
+   {
+      memset(&frame, 0, sizeof(frame));
+      frame.canId = canId;
+      frame.length = length;
+      memcpy(frame.data, data, length);
+
+      TEST_CHECK(Host_Drv_ReceiveCAN(&frame));
+   }
+}
+
+// Send the data frames of a block
+static void SendBlock(const uint32_t block, const uint32_t frames, const bool isCorrupted)
+{
+   uint8_t data[FRAME_DATA_SIZE];
+   uint32_t numSent = 0U;
+
+   for (uint32_t frameNumber = 0U; frameNumber < FRAMES_PER_BLOCK; frameNumber++)
+   {
+      if ((frames & (1UL << frameNumber)) != 0U)
+      {
+         const uint32_t offset = (block * BLOCK_SIZE) + (frameNumber * FRAME_DATA_SIZE);
+
+         // The last block is padded
+         memset(data, 0, sizeof(data));
+         if (offset < IMAGE_SIZE)
+         {
+            memcpy(data, &image[offset], PLATFORM_MIN(FRAME_DATA_SIZE, IMAGE_SIZE - offset));
+         }
+
+         if ((isCorrupted) && (frameNumber == 0U))
+         {
+            data[0] ^= 0xFFU;
+         }
+
+         SendFrame((LUNAR_FWUPDATE_DATA_CANID | ((block & BLOCK_TAG_MASK) << BLOCK_TAG_SHIFT) | frameNumber) | CAN_DRV_EXTENDED_ID, data, FRAME_DATA_SIZE, true);
+         numDataFrames++;
+         numSent++;
+
+         if ((numSent % DATA_FRAMES_PER_MILLISECOND) == 0U)
+         {
+            Test_Harness_Run(1U);
+         }
+      }
+   }
+}
+
+// Collect the reports
+static void CollectReports(const uint32_t milliseconds, Reports_t *const reports)
+{
+   CAN_Drv_Frame_t frame;
+
+   memset(reports, 0, sizeof(*reports));
+
+   for (uint32_t elapsed = 0U; elapsed < milliseconds; elapsed++)
+   {
+      Test_Harness_Run(1U);
+
+      while (Host_Drv_TakeCANOutput(&frame))
+      {
+         if ((frame.canId & ~REPORT_TAG_MASK) == (LUNAR_FWUPDATE_REPORT_CANID | CAN_DRV_EXTENDED_ID))
+         {
+            const uint16_t block = (uint16_t)(frame.data[2] | ((uint16_t)frame.data[3] << 8U));
+            const uint32_t missingFrames = (uint32_t)frame.data[4] | ((uint32_t)frame.data[5] << 8U) |
+                                           ((uint32_t)frame.data[6] << 16U) | ((uint32_t)frame.data[7] << 24U);
+
+            // The sender repeats the union of the frames missing from the
+            // lowest block
+            if ((reports->numReports == 0U) || (block < reports->block))
+            {
+               reports->block = block;
+               reports->missingFrames = missingFrames;
+            }
+            else if (block == reports->block)
+            {
+               reports->missingFrames |= missingFrames;
+            }
+            else
+            {
+               // The node is ahead of another one
+            }
+
+            reports->reportTag = frame.canId & REPORT_TAG_MASK;
+            reports->state = frame.data[0];
+            reports->flags |= frame.data[1];
+            reports->numReports++;
+         }
+      }
+   }
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Test entry point
+int main(void)
+{
+   uint8_t frameData[8];
+   uint8_t response[STATUS_LENGTH];
+   uint8_t blockData[BLOCK_SIZE];
+   Reports_t reports;
+
+   Test_Harness_Start();
+   srand(1U);
+
+   for (uint32_t i = 0U; i < IMAGE_SIZE; i++)
+   {
+      image[i] = (uint8_t)rand();
+   }
+
+   const uint32_t imageCrc = Lunar_MathLib_Crc32(image, IMAGE_SIZE, LUNAR_MATHLIB_CRC32_INITIAL_VALUE);
+   const uint32_t startTime = Timebase_Drv_GetCurrentTickCount();
+
+   //-----------------------------------------------
+   // The image is broadcast with lost frames
+   //-----------------------------------------------
+
+   const uint32_t imageSize = IMAGE_SIZE;
+
+   memcpy(&frameData[0], &imageSize, sizeof(imageSize));
+   memcpy(&frameData[4], &imageCrc, sizeof(imageCrc));
+   SendFrame(START_CANID, frameData, 8U, false);
+   Test_Harness_Run(BUSY_WAIT_MILLISECONDS);
+
+   uint32_t block = 0U;
+   uint32_t frames = ALL_FRAMES;
+   bool isCorrupted = false;
+
+   while ((block < NUM_BLOCKS) && (numCommits < MAX_COMMITS))
+   {
+      // The corrupted frame is only sent once
+      const bool isCorruptedNow = ((block == CORRUPTED_BLOCK) && (!isCorrupted));
+
+      // The sector of a block is erased while the blocks before it arrive
+      TEST_CHECK(Host_Drv_GetFlashEraseCount(LUNAR_FWUPDATE_STAGING_ADDRESS + (block * BLOCK_SIZE)) > 0U);
+      SendBlock(block, frames, isCorruptedNow);
+      isCorrupted = isCorrupted || isCorruptedNow;
+
+      // Only the blocks of the image are checked, the padding of the last
+      // one is part of its CRC
+      memset(blockData, 0, sizeof(blockData));
+      memcpy(blockData, &image[block * BLOCK_SIZE], PLATFORM_MIN(BLOCK_SIZE, IMAGE_SIZE - (block * BLOCK_SIZE)));
+
+      const uint16_t blockNumber = (uint16_t)block;
+      const uint16_t blockCrc = Lunar_MathLib_Crc16(blockData, BLOCK_SIZE, LUNAR_MATHLIB_CRC16_INITIAL_VALUE);
+
+      memcpy(&frameData[0], &blockNumber, sizeof(blockNumber));
+      memcpy(&frameData[2], &blockCrc, sizeof(blockCrc));
+      SendFrame(COMMIT_CANID, frameData, 4U, true);
+      numCommits++;
+
+      CollectReports(COMMIT_WAIT_MILLISECONDS, &reports);
+
+      if (reports.numReports == 0U)
+      {
+         // Silence acknowledges the block
+         block++;
+         frames = ALL_FRAMES;
+      }
+      else if ((reports.block == block) && ((reports.flags & REPORT_FLAG_BUSY) != 0U) && (reports.missingFrames == 0U))
+      {
+         // The block is committed again once the node programmed the last one
+         Test_Harness_Run(BUSY_WAIT_MILLISECONDS);
+         frames = 0U;
+      }
+      else
+      {
+         // Only the missing frames are sent again, from the block the node
+         // is receiving
+         block = reports.block;
+         frames = reports.missingFrames;
+      }
+   }
+
+   TEST_CHECK(block == NUM_BLOCKS);
+
+   //-----------------------------------------------
+   // The staged image is verified
+   //-----------------------------------------------
+
+   memset(&reports, 0, sizeof(reports));
+
+   for (uint32_t i = 0U; (i < MAX_FINISHES) && (reports.numReports == 0U); i++)
+   {
+      SendFrame(FINISH_CANID, frameData, 0U, false);
+      CollectReports(FINISH_WAIT_MILLISECONDS, &reports);
+   }
+
+   const uint32_t elapsedMilliseconds = (Timebase_Drv_GetCurrentTickCount() - startTime) / TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND;
+
+   printf("%u byte image in %u ms: %u data frames for %u, %u commits for %u blocks, %u frames lost\n",
+          (unsigned)IMAGE_SIZE, (unsigned)elapsedMilliseconds, (unsigned)numDataFrames, (unsigned)(NUM_BLOCKS * FRAMES_PER_BLOCK),
+          (unsigned)numCommits, (unsigned)NUM_BLOCKS, (unsigned)numLostFrames);
+
+   TEST_CHECK(reports.state == (uint8_t)LUNAR_FWUPDATE_STATE_Verified);
+   TEST_CHECK(numLostFrames > 0U);
+
+   // Lost frames are sent again, the corrupted block once more, and a lost
+   // commit costs the frames of one block
+   TEST_CHECK(numDataFrames <= ((NUM_BLOCKS + 1U) * FRAMES_PER_BLOCK) + ((2U * numLostFrames) * FRAMES_PER_BLOCK));
+
+   memset(response, 0, sizeof(response));
+   TEST_CHECK(Test_Harness_SendCommand((UART_Drv_Channel_t)0, FWUPDATE_MODULE_ID, FWUPDATE_COMMAND_GET_STATUS, NULL, 0U, response, sizeof(response)) == (int)STATUS_LENGTH);
+
+   uint32_t statusImageSize;
+   uint32_t statusImageCrc;
+   uint16_t numBlockCrcErrors;
+   uint16_t reportTag;
+
+   memcpy(&statusImageSize, &response[STATUS_IMAGE_SIZE_OFFSET], sizeof(statusImageSize));
+   memcpy(&statusImageCrc, &response[STATUS_IMAGE_CRC_OFFSET], sizeof(statusImageCrc));
+   memcpy(&numBlockCrcErrors, &response[STATUS_NUM_BLOCK_CRC_ERRORS_OFFSET], sizeof(numBlockCrcErrors));
+   memcpy(&reportTag, &response[STATUS_REPORT_TAG_OFFSET], sizeof(reportTag));
+
+   TEST_CHECK(statusImageSize == IMAGE_SIZE);
+   TEST_CHECK(statusImageCrc == imageCrc);
+   TEST_CHECK(numBlockCrcErrors == 1U);
+   TEST_CHECK(reportTag == reports.reportTag);
+   TEST_CHECK(response[STATUS_STATE_OFFSET] == (uint8_t)LUNAR_FWUPDATE_STATE_Verified);
+   TEST_CHECK(response[STATUS_FAILURE_OFFSET] == 0U);
+
+   // The staging area holds the image
+   bool isStaged = true;
+
+   for (uint32_t offset = 0U; offset < IMAGE_SIZE; offset += BLOCK_SIZE)
+   {
+      const uint32_t length = PLATFORM_MIN(BLOCK_SIZE, IMAGE_SIZE - offset);
+
+      Flash_Drv_Read(LUNAR_FWUPDATE_STAGING_ADDRESS + offset, blockData, length);
+      isStaged = isStaged && (memcmp(blockData, &image[offset], length) == 0);
+   }
+
+   TEST_CHECK(isStaged);
+
+   return(Test_Harness_Finish());
+}
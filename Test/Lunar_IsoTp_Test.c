@@ -0,0 +1,464 @@
+/*******************************************************************************
+// ISO-TP Test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Test_Harness.h"
+// Platform Includes
+#include "Lunar_IsoTp_Config.h"
+#include "Lunar_MessageBufferPool.h"
+#include "Lunar_MessageRouter.h"
+// Other Includes
+#include "Lunar_CANTransport_Config.h"
+#include <string.h> // memcmp
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// Frame types and flow status of the protocol control information
+#define PCI_TYPE_MASK (0xF0U)
+#define PCI_VALUE_MASK (0x0FU)
+#define PCI_TYPE_SINGLE_FRAME (0x00U)
+#define PCI_TYPE_FIRST_FRAME (0x10U)
+#define PCI_TYPE_CONSECUTIVE_FRAME (0x20U)
+#define PCI_TYPE_FLOW_CONTROL (0x30U)
+#define FLOW_STATUS_CONTINUE_TO_SEND (0x00U)
+#define FLOW_STATUS_OVERFLOW (0x02U)
+
+// Data bytes in a first and a consecutive frame
+#define FIRST_FRAME_DATA_LENGTH (6U)
+#define CONSECUTIVE_FRAME_DATA_LENGTH (7U)
+
+// The flow control of the test when it receives a response
+#define RESPONSE_BLOCK_SIZE (2U)
+#define RESPONSE_SEPARATION_TIME_MS (5U)
+
+// Time to wait for a frame from the firmware
+#define FRAME_TIMEOUT_MILLISECONDS (50U)
+
+// Commands of the test: the Subscribe command takes at most 14 bytes, so
+// longer commands are complete transfers that the command rejects
+#define SUBSCRIBE_ROUTER_ID (0x0A01U)
+#define GET_RECENT_TRANSITIONS_ROUTER_ID (0x0208U)
+#define GET_COMMAND_METRICS_ROUTER_ID (0x0B04U)
+#define FWUPDATE_START_ROUTER_ID (0x1002U)
+#define FWUPDATE_GET_STATUS_ROUTER_ID (0x1001U)
+#define FWUPDATE_ABORT_ROUTER_ID (0x1005U)
+
+// Offsets in the Get Command Metrics response, a header followed by the
+// entries of the commands that fit.  A serial response holds one entry.
+#define METRICS_NUM_ENTRIES_OFFSET (2U)
+#define METRICS_HEADER_LENGTH (4U)
+#define METRICS_NUM_CALLS_OFFSET (METRICS_HEADER_LENGTH + 0U)
+#define METRICS_RESPONSE_CODE_COUNTS_OFFSET (METRICS_HEADER_LENGTH + 16U)
+#define METRICS_MODULE_ID_OFFSET (METRICS_RESPONSE_CODE_COUNTS_OFFSET + (2U * (uint32_t)LUNAR_MESSAGEROUTER_RESPONSE_CODE_Count))
+#define METRICS_RESPONSE_LENGTH (((METRICS_MODULE_ID_OFFSET + 2U) + 3U) & ~3U)
+
+// The Get Recent Transitions response, six transitions
+#define TRANSITIONS_RESPONSE_LENGTH (36U)
+
+// The image announced by the Start command
+#define IMAGE_SIZE (1000U)
+#define IMAGE_CRC (0x89ABCDEFU)
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function sends a frame to the segmented request identifier of
+  *    a command.
+  * Parameters:
+  *    routerId :  The module ID and command ID of the command
+  *    data :      The frame data
+  *    length :    The number of data bytes
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void SendFrame(const uint16_t routerId, const uint8_t *const data, const uint8_t length);
+
+/** Description:
+  *    This function runs the firmware until it sends a frame on the
+  *    segmented response identifier of a command.
+  * Parameters:
+  *    routerId :  The module ID and command ID of the command
+  *    frame :     Destination for the frame
+  * Returns:
+  *    bool - true if a frame arrived within FRAME_TIMEOUT_MILLISECONDS
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool TakeFrame(const uint16_t routerId, CAN_Drv_Frame_t *const frame);
+
+/** Description:
+  *    This function sends a command segmented and checks the flow control of
+  *    the firmware: a frame that continues the transfer after the first frame
+  *    and after every LUNAR_ISOTP_BLOCK_SIZE consecutive frames.
+  * Parameters:
+  *    routerId :  The module ID and command ID of the command
+  *    params :    The command parameters
+  *    length :    The number of command parameter bytes, more than a single frame holds
+  * Returns:
+  *    bool - true if every flow control frame arrived as expected
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool SendCommand(const uint16_t routerId, const uint8_t *const params, const uint8_t length);
+
+/** Description:
+  *    This function receives a segmented response with the flow control of
+  *    RESPONSE_BLOCK_SIZE and RESPONSE_SEPARATION_TIME_MS.  It checks the
+  *    sequence numbers, the separation time and that the firmware waits for
+  *    the flow control after each block.
+  * Parameters:
+  *    routerId :   The module ID and command ID of the command
+  *    response :   Buffer for the response parameters
+  *    maxLength :  The size of response
+  * Returns:
+  *    int - The number of response bytes, -1 if the response was not valid
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static int ReceiveResponse(const uint16_t routerId, uint8_t *const response, const uint32_t maxLength);
+
+#if LUNAR_MESSAGEROUTER_METRICS_ENABLED
+/** Description:
+  *    This function reads the metrics of a command via the serial port.
+  * Parameters:
+  *    metricsIndex :  The index of the command, the start index of the request
+  *    response :      Buffer of METRICS_RESPONSE_LENGTH bytes for the metrics
+  * Returns:
+  *    bool - true if the metrics were read
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool GetCommandMetrics(const uint16_t metricsIndex, uint8_t *const response);
+
+/** Description:
+  *    This function reads a 16-bit value from a response.
+  * Parameters:
+  *    data :  The first byte of the value
+  * Returns:
+  *    uint16_t - The value
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint16_t GetUint16(const uint8_t *const data);
+#endif
+
+/** Description:
+  *    This function reads a 32-bit value from a response.
+  * Parameters:
+  *    data :  The first byte of the value
+  * Returns:
+  *    uint32_t - The value
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint32_t GetUint32(const uint8_t *const data);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Send a frame to the firmware
+static void SendFrame(const uint16_t routerId, const uint8_t *const data, const uint8_t length)
+{
+   CAN_Drv_Frame_t frame;
+
+   memset(&frame, 0, sizeof(frame));
+   frame.canId = (LUNAR_CANTRANSPORT_ISOTP_REQUEST_CANID + routerId) | CAN_DRV_EXTENDED_ID;
+   frame.length = length;
+   memcpy(frame.data, data, length);
+
+   TEST_CHECK(Host_Drv_ReceiveCAN(&frame));
+}
+
+// Take a frame of a segmented response
+static bool TakeFrame(const uint16_t routerId, CAN_Drv_Frame_t *const frame)
+{
+   const uint32_t canId = (LUNAR_CANTRANSPORT_ISOTP_RESPONSE_CANID + routerId) | CAN_DRV_EXTENDED_ID;
+   bool isTaken = false;
+
+   for (uint32_t elapsed = 0U; (elapsed < FRAME_TIMEOUT_MILLISECONDS) && (!isTaken); elapsed++)
+   {
+      Test_Harness_Run(1U);
+
+      while ((!isTaken) && Host_Drv_TakeCANOutput(frame))
+      {
+         isTaken = (frame->canId == canId);
+      }
+   }
+
+   return(isTaken);
+}
+
+// Send a segmented command
+static bool SendCommand(const uint16_t routerId, const uint8_t *const params, const uint8_t length)
+{
+   CAN_Drv_Frame_t frame;
+   uint8_t data[CAN_DRV_MAX_DATA_LENGTH];
+   uint32_t index = FIRST_FRAME_DATA_LENGTH;
+   uint8_t sequenceNumber = 1U;
+   uint32_t blockCount = LUNAR_ISOTP_BLOCK_SIZE;
+   bool isFlowControlled = true;
+
+   data[0] = PCI_TYPE_FIRST_FRAME;
+   data[1] = length;
+   memcpy(&data[2], params, FIRST_FRAME_DATA_LENGTH);
+   SendFrame(routerId, data, CAN_DRV_MAX_DATA_LENGTH);
+
+   while ((index < length) && (isFlowControlled))
+   {
+      // The firmware allows a block after the first frame and after each block
+      if (blockCount >= LUNAR_ISOTP_BLOCK_SIZE)
+      {
+         isFlowControlled = TakeFrame(routerId, &frame) && (frame.length == 3U) &&
+                            (frame.data[0] == (PCI_TYPE_FLOW_CONTROL | FLOW_STATUS_CONTINUE_TO_SEND)) && (frame.data[1] == LUNAR_ISOTP_BLOCK_SIZE);
+         blockCount = 0U;
+      }
+
+      const uint32_t dataLength = ((length - index) < CONSECUTIVE_FRAME_DATA_LENGTH) ? (length - index) : CONSECUTIVE_FRAME_DATA_LENGTH;
+
+      data[0] = PCI_TYPE_CONSECUTIVE_FRAME | sequenceNumber;
+      memcpy(&data[1], &params[index], dataLength);
+      SendFrame(routerId, data, (uint8_t)(1U + dataLength));
+      Test_Harness_Run(1U);
+
+      index += dataLength;
+      sequenceNumber = (sequenceNumber + 1U) & PCI_VALUE_MASK;
+      blockCount++;
+   }
+
+   return(isFlowControlled);
+}
+
+// Receive a segmented response
+static int ReceiveResponse(const uint16_t routerId, uint8_t *const response, const uint32_t maxLength)
+{
+   static const uint8_t flowControl[3] = { PCI_TYPE_FLOW_CONTROL | FLOW_STATUS_CONTINUE_TO_SEND, RESPONSE_BLOCK_SIZE, RESPONSE_SEPARATION_TIME_MS };
+   CAN_Drv_Frame_t frame;
+   int length = -1;
+
+   if (TakeFrame(routerId, &frame))
+   {
+      if (((frame.data[0] & PCI_TYPE_MASK) == PCI_TYPE_SINGLE_FRAME) && ((frame.data[0] & PCI_VALUE_MASK) < frame.length) &&
+          ((uint32_t)(frame.data[0] & PCI_VALUE_MASK) <= maxLength))
+      {
+         length = frame.data[0] & PCI_VALUE_MASK;
+         memcpy(response, &frame.data[1], (uint32_t)length);
+      }
+      else if ((frame.data[0] == PCI_TYPE_FIRST_FRAME) && (frame.length == CAN_DRV_MAX_DATA_LENGTH) && (frame.data[1] <= maxLength))
+      {
+         const uint32_t totalLength = frame.data[1];
+         uint32_t index = FIRST_FRAME_DATA_LENGTH;
+         uint32_t lastTime = frame.timestamp;
+         uint8_t sequenceNumber = 1U;
+         bool isValid = true;
+
+         memcpy(response, &frame.data[2], FIRST_FRAME_DATA_LENGTH);
+
+         while ((index < totalLength) && (isValid))
+         {
+            // Nothing more is sent until the flow control frame arrives
+            isValid = !TakeFrame(routerId, &frame);
+            SendFrame(routerId, flowControl, sizeof(flowControl));
+
+            for (uint32_t i = 0U; (i < RESPONSE_BLOCK_SIZE) && (index < totalLength) && (isValid); i++)
+            {
+               const uint32_t dataLength = ((totalLength - index) < CONSECUTIVE_FRAME_DATA_LENGTH) ? (totalLength - index) : CONSECUTIVE_FRAME_DATA_LENGTH;
+
+               isValid = TakeFrame(routerId, &frame) && (frame.data[0] == (PCI_TYPE_CONSECUTIVE_FRAME | sequenceNumber)) &&
+                         (frame.length == (1U + dataLength));
+
+               // The first frame of a block only waits for the flow control
+               if ((isValid) && (i > 0U))
+               {
+                  isValid = ((frame.timestamp - lastTime) >= (RESPONSE_SEPARATION_TIME_MS * (HOST_DRV_CYCLES_PER_SECOND / 1000U)));
+               }
+
+               if (isValid)
+               {
+                  memcpy(&response[index], &frame.data[1], dataLength);
+                  index += dataLength;
+                  lastTime = frame.timestamp;
+                  sequenceNumber = (sequenceNumber + 1U) & PCI_VALUE_MASK;
+               }
+            }
+         }
+
+         length = (isValid) ? (int)totalLength : -1;
+      }
+      else
+      {
+         // Not the start of a response
+      }
+   }
+
+   return(length);
+}
+
+#if LUNAR_MESSAGEROUTER_METRICS_ENABLED
+// Read the metrics of a command
+static bool GetCommandMetrics(const uint16_t metricsIndex, uint8_t *const response)
+{
+   const uint8_t params[2] = { (uint8_t)metricsIndex, (uint8_t)(metricsIndex >> 8) };
+
+   return(Test_Harness_SendCommand((UART_Drv_Channel_t)0, (uint8_t)(GET_COMMAND_METRICS_ROUTER_ID >> 8), (uint8_t)GET_COMMAND_METRICS_ROUTER_ID,
+                                   params, sizeof(params), response, METRICS_RESPONSE_LENGTH) == (int)METRICS_RESPONSE_LENGTH);
+}
+
+// Read a 16-bit value
+static uint16_t GetUint16(const uint8_t *const data)
+{
+   return((uint16_t)(data[0] | ((uint16_t)data[1] << 8)));
+}
+#endif
+
+// Read a 32-bit value
+static uint32_t GetUint32(const uint8_t *const data)
+{
+   return(data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24));
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Test entry point
+int main(void)
+{
+   uint8_t params[LUNAR_MESSAGEBUFFERPOOL_BLOCK_SIZE];
+   uint8_t response[LUNAR_MESSAGEBUFFERPOOL_BLOCK_SIZE];
+   uint8_t expected[LUNAR_MESSAGEBUFFERPOOL_BLOCK_SIZE];
+   CAN_Drv_Frame_t frame;
+
+   Test_Harness_Start();
+
+   for (uint32_t i = 0U; i < sizeof(params); i++)
+   {
+      params[i] = (uint8_t)(0xA0U + i);
+   }
+
+#if LUNAR_MESSAGEROUTER_METRICS_ENABLED
+   uint8_t before[METRICS_RESPONSE_LENGTH];
+   uint8_t after[METRICS_RESPONSE_LENGTH];
+   uint16_t metricsIndex = 0U;
+   bool isFound = false;
+
+   // Find the metrics of the Subscribe command
+   while ((!isFound) && GetCommandMetrics(metricsIndex, before) && (before[METRICS_NUM_ENTRIES_OFFSET] == 1U))
+   {
+      isFound = (before[METRICS_MODULE_ID_OFFSET] == (uint8_t)(SUBSCRIBE_ROUTER_ID >> 8)) && (before[METRICS_MODULE_ID_OFFSET + 1U] == (uint8_t)SUBSCRIBE_ROUTER_ID);
+      metricsIndex = (isFound) ? metricsIndex : (uint16_t)(metricsIndex + 1U);
+   }
+   TEST_CHECK(isFound);
+#endif
+
+   //-----------------------------------------------
+   // 20 and 48 byte commands with block size flow control
+   //-----------------------------------------------
+
+   // The block is returned once the command was executed
+   TEST_CHECK(SendCommand(SUBSCRIBE_ROUTER_ID, params, 20U));
+   TEST_CHECK(Lunar_MessageBufferPool_GetNumFreeBlocks() == LUNAR_MESSAGEBUFFERPOOL_NUM_BLOCKS);
+   TEST_CHECK(SendCommand(SUBSCRIBE_ROUTER_ID, params, LUNAR_MESSAGEBUFFERPOOL_BLOCK_SIZE));
+   TEST_CHECK(Lunar_MessageBufferPool_GetNumFreeBlocks() == LUNAR_MESSAGEBUFFERPOOL_NUM_BLOCKS);
+
+   // The command rejects both, so there is no response
+   TEST_CHECK(!TakeFrame(SUBSCRIBE_ROUTER_ID, &frame));
+#if LUNAR_MESSAGEROUTER_METRICS_ENABLED
+   TEST_CHECK(GetCommandMetrics(metricsIndex, after));
+   TEST_CHECK(GetUint32(&after[METRICS_NUM_CALLS_OFFSET]) == (GetUint32(&before[METRICS_NUM_CALLS_OFFSET]) + 2U));
+   TEST_CHECK(GetUint16(&after[METRICS_RESPONSE_CODE_COUNTS_OFFSET + (2U * (uint32_t)LUNAR_MESSAGEROUTER_RESPONSE_CODE_InvalidCommandLength)]) ==
+              (GetUint16(&before[METRICS_RESPONSE_CODE_COUNTS_OFFSET + (2U * (uint32_t)LUNAR_MESSAGEROUTER_RESPONSE_CODE_InvalidCommandLength)]) + 2U));
+#endif
+
+   //-----------------------------------------------
+   // The parameters are reassembled in order
+   //-----------------------------------------------
+
+   const uint8_t startParams[8] =
+   {
+      (uint8_t)IMAGE_SIZE, (uint8_t)(IMAGE_SIZE >> 8), (uint8_t)(IMAGE_SIZE >> 16), (uint8_t)(IMAGE_SIZE >> 24),
+      (uint8_t)IMAGE_CRC, (uint8_t)(IMAGE_CRC >> 8), (uint8_t)(IMAGE_CRC >> 16), (uint8_t)(IMAGE_CRC >> 24)
+   };
+
+   TEST_CHECK(SendCommand(FWUPDATE_START_ROUTER_ID, startParams, sizeof(startParams)));
+
+   // An empty response is a single frame
+   TEST_CHECK(ReceiveResponse(FWUPDATE_START_ROUTER_ID, response, sizeof(response)) == 0);
+   TEST_CHECK(Test_Harness_SendCommand((UART_Drv_Channel_t)0, (uint8_t)(FWUPDATE_GET_STATUS_ROUTER_ID >> 8), (uint8_t)FWUPDATE_GET_STATUS_ROUTER_ID,
+                                       NULL, 0U, response, sizeof(response)) >= 8);
+   TEST_CHECK(GetUint32(&response[0]) == IMAGE_SIZE);
+   TEST_CHECK(GetUint32(&response[4]) == IMAGE_CRC);
+   TEST_CHECK(Test_Harness_SendCommand((UART_Drv_Channel_t)0, (uint8_t)(FWUPDATE_ABORT_ROUTER_ID >> 8), (uint8_t)FWUPDATE_ABORT_ROUTER_ID,
+                                       NULL, 0U, response, sizeof(response)) == 0);
+
+   //-----------------------------------------------
+   // A segmented response follows the flow control of the receiver
+   //-----------------------------------------------
+
+   // The newest transitions, the same as read via the serial port
+   const uint8_t transitionsFrame[2] = { PCI_TYPE_SINGLE_FRAME | 1U, 0U };
+
+   SendFrame(GET_RECENT_TRANSITIONS_ROUTER_ID, transitionsFrame, sizeof(transitionsFrame));
+   TEST_CHECK(ReceiveResponse(GET_RECENT_TRANSITIONS_ROUTER_ID, response, sizeof(response)) == (int)TRANSITIONS_RESPONSE_LENGTH);
+   TEST_CHECK(Test_Harness_SendCommand((UART_Drv_Channel_t)0, (uint8_t)(GET_RECENT_TRANSITIONS_ROUTER_ID >> 8), (uint8_t)GET_RECENT_TRANSITIONS_ROUTER_ID,
+                                       &transitionsFrame[1], 1U, expected, sizeof(expected)) == (int)TRANSITIONS_RESPONSE_LENGTH);
+   TEST_CHECK(memcmp(response, expected, TRANSITIONS_RESPONSE_LENGTH) == 0);
+
+   //-----------------------------------------------
+   // Transfers that cannot be completed
+   //-----------------------------------------------
+
+   // A command longer than a block is refused
+   uint8_t data[CAN_DRV_MAX_DATA_LENGTH] = { PCI_TYPE_FIRST_FRAME, LUNAR_MESSAGEBUFFERPOOL_BLOCK_SIZE + 1U };
+
+   SendFrame(SUBSCRIBE_ROUTER_ID, data, sizeof(data));
+   TEST_CHECK(TakeFrame(SUBSCRIBE_ROUTER_ID, &frame) && (frame.data[0] == (PCI_TYPE_FLOW_CONTROL | FLOW_STATUS_OVERFLOW)));
+   TEST_CHECK(Lunar_MessageBufferPool_GetNumFreeBlocks() == LUNAR_MESSAGEBUFFERPOOL_NUM_BLOCKS);
+
+   // A lost consecutive frame ends the transfer
+   data[1] = 20U;
+   SendFrame(SUBSCRIBE_ROUTER_ID, data, sizeof(data));
+   TEST_CHECK(TakeFrame(SUBSCRIBE_ROUTER_ID, &frame));
+   TEST_CHECK(Lunar_MessageBufferPool_GetNumFreeBlocks() == (LUNAR_MESSAGEBUFFERPOOL_NUM_BLOCKS - 1U));
+   data[0] = PCI_TYPE_CONSECUTIVE_FRAME | 2U;
+   SendFrame(SUBSCRIBE_ROUTER_ID, data, sizeof(data));
+   Test_Harness_Run(1U);
+   TEST_CHECK(Lunar_MessageBufferPool_GetNumFreeBlocks() == LUNAR_MESSAGEBUFFERPOOL_NUM_BLOCKS);
+
+   // A sender that stops is timed out
+   data[0] = PCI_TYPE_FIRST_FRAME;
+   SendFrame(SUBSCRIBE_ROUTER_ID, data, sizeof(data));
+   Test_Harness_Run(LUNAR_ISOTP_TIMEOUT_MS - 10U);
+   TEST_CHECK(Lunar_MessageBufferPool_GetNumFreeBlocks() == (LUNAR_MESSAGEBUFFERPOOL_NUM_BLOCKS - 1U));
+   Test_Harness_Run(20U);
+   TEST_CHECK(Lunar_MessageBufferPool_GetNumFreeBlocks() == LUNAR_MESSAGEBUFFERPOOL_NUM_BLOCKS);
+
+   // So is a receiver that does not send the flow control
+   SendFrame(GET_RECENT_TRANSITIONS_ROUTER_ID, transitionsFrame, sizeof(transitionsFrame));
+   TEST_CHECK(TakeFrame(GET_RECENT_TRANSITIONS_ROUTER_ID, &frame) && (frame.data[0] == PCI_TYPE_FIRST_FRAME));
+   Test_Harness_Run(LUNAR_ISOTP_TIMEOUT_MS);
+   TEST_CHECK(Lunar_MessageBufferPool_GetNumFreeBlocks() == LUNAR_MESSAGEBUFFERPOOL_NUM_BLOCKS);
+   TEST_CHECK(!TakeFrame(GET_RECENT_TRANSITIONS_ROUTER_ID, &frame));
+
+   return(Test_Harness_Finish());
+}
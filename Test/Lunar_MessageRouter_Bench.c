@@ -0,0 +1,147 @@
+/*******************************************************************************
+// Serial and Message Router Throughput Benchmark
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Test_Harness.h"
+// Platform Includes
+#include "Lunar_MessageBufferPool.h"
+#include "Lunar_Serial.h"
+// Other Includes
+#include <stdlib.h> // atol
+#include <string.h> // strlen
+#include <time.h> // clock_gettime
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// Number of commands when none is given on the command line
+#define DEFAULT_NUM_MESSAGES (200000L)
+
+// Serial port the commands are sent on
+#define BENCH_CHANNEL ((UART_Drv_Channel_t)0)
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The commands sent in turn, in the serial format
+static const char *const benchCommands[] =
+{
+   // Main: Get Product ID
+   "<01020000\r\n",
+   // Main: Get Uptime
+   "<01060100\r\n",
+   // Main: Get Application Version
+   "<01010200\r\n",
+   // Unknown module, answered by the router without a handler
+   "<FE010300\r\n",
+};
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function reads the host cycle counter, or 0 where there is none.
+  * Returns:
+  *    uint64_t - The cycle count
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint64_t ReadCycleCounter(void);
+
+/** Description:
+  *    This function reads a monotonic clock.
+  * Returns:
+  *    double - The time in seconds
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static double ReadSeconds(void);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Read the cycle counter of the host
+static uint64_t ReadCycleCounter(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+   // The builtin avoids x86intrin.h, its names clash with the CMSIS qualifiers
+   return(__builtin_ia32_rdtsc());
+#else
+   return(0U);
+#endif
+}
+
+// Read a monotonic clock
+static double ReadSeconds(void)
+{
+   struct timespec now;
+
+   clock_gettime(CLOCK_MONOTONIC, &now);
+
+   return((double)now.tv_sec + ((double)now.tv_nsec * 1e-9));
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Benchmark entry point
+//   Lunar_MessageRouter_Bench [messages]
+int main(int argc, char **argv)
+{
+   const long numMessages = (argc > 1) ? atol(argv[1]) : DEFAULT_NUM_MESSAGES;
+   const size_t numCommands = sizeof(benchCommands) / sizeof(benchCommands[0]);
+   uint8_t output[256];
+   uint64_t numOutputBytes = 0U;
+
+   Test_Harness_Start();
+
+   const double startSeconds = ReadSeconds();
+   const uint64_t startCycles = ReadCycleCounter();
+
+   // Each command is received, decoded, routed, handled and answered in one
+   // update of the serial module, as with a command per scheduler pass
+   for (long i = 0; i < numMessages; i++)
+   {
+      const char *const command = benchCommands[(size_t)i % numCommands];
+
+      (void)Host_Drv_ReceiveUART(BENCH_CHANNEL, (const uint8_t *)command, (uint32_t)strlen(command));
+      Lunar_Serial_Update();
+      numOutputBytes += Host_Drv_TakeUARTOutput(BENCH_CHANNEL, output, sizeof(output));
+   }
+
+   const uint64_t elapsedCycles = ReadCycleCounter() - startCycles;
+   const double elapsedSeconds = ReadSeconds() - startSeconds;
+
+   printf("%ld messages in %.3f s\n", numMessages, elapsedSeconds);
+   printf("%.0f msgs/s, %.1f ns/msg", (double)numMessages / elapsedSeconds, (elapsedSeconds * 1e9) / (double)numMessages);
+
+   if (elapsedCycles > 0U)
+   {
+      printf(", %.0f cycles/msg", (double)elapsedCycles / (double)numMessages);
+   }
+
+   printf("\n%.1f response bytes/msg\n", (double)numOutputBytes / (double)numMessages);
+
+   // Every command must have been answered and every block returned
+   TEST_CHECK(numOutputBytes > 0U);
+   TEST_CHECK(Lunar_MessageBufferPool_GetNumFreeBlocks() == LUNAR_MESSAGEBUFFERPOOL_NUM_BLOCKS);
+
+   return(Test_Harness_Finish());
+}
@@ -0,0 +1,373 @@
+/*******************************************************************************
+// Message Router Response Cache Test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Test_Harness.h"
+// Platform Includes
+#include "Lunar_MessageRouter.h"
+#include "Lunar_MessageRouter_Config.h"
+#include "Lunar_MessageRouter_ConfigTable.h"
+// Other Includes
+#include <string.h> // memcmp, memcpy, memset
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The number of modules in the Message Router table of the board
+#define NUM_MODULES (sizeof(messageRouterConfigTable) / sizeof(Lunar_MessageRouter_ConfigItem_t))
+
+// The most cacheable commands a board may have
+#define MAX_CACHEABLE_COMMANDS (32U)
+
+// The cache commands of the Message Router
+#define MESSAGEROUTER_MODULE_ID (0x0BU)
+#define MESSAGEROUTER_COMMAND_GET_CACHE_STATISTICS (0x01U)
+#define MESSAGEROUTER_COMMAND_CLEAR_CACHE (0x02U)
+
+// Offsets in the cache statistics response
+#define STATISTICS_NUM_HITS_OFFSET (0U)
+#define STATISTICS_NUM_MISSES_OFFSET (4U)
+#define STATISTICS_NUM_ENTRIES_USED_OFFSET (8U)
+#define STATISTICS_MIN_LENGTH (9U)
+
+// The size of the response buffer given to the Message Router
+#define RESPONSE_BUFFER_SIZE (255U)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// This structure holds a command with a cache max age
+typedef struct
+{
+   uint8_t moduleID;
+   uint8_t commandID;
+   uint16_t cacheMaxAgeMs;
+} CacheableCommand_t;
+
+// This structure holds the cache counters
+typedef struct
+{
+   uint32_t numHits;
+   uint32_t numMisses;
+   uint8_t numEntriesUsed;
+} Statistics_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The commands of the board with a cache max age
+static CacheableCommand_t cacheableCommands[MAX_CACHEABLE_COMMANDS];
+static uint32_t numCacheableCommands;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function passes a command without parameters to the Message Router.
+  *    No time passes while it is processed.
+  * Parameters:
+  *    moduleID :   The module of the command
+  *    commandID :  The command
+  *    response :   Destination for the response, RESPONSE_BUFFER_SIZE bytes
+  * Returns:
+  *    int - The length of the response, or -1 for an error response
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static int Process(const uint8_t moduleID, const uint8_t commandID, uint8_t *const response);
+
+/** Description:
+  *    This function reads the cache counters.
+  * Parameters:
+  *    statistics :  Destination for the counters
+  * Returns:
+  *    bool - true if the counters were read
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool GetStatistics(Statistics_t *const statistics);
+
+/** Description:
+  *    This function discards the cached responses and the counters.
+  * Returns:
+  *    bool - true if the cache was cleared
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool ClearCache(void);
+
+/** Description:
+  *    This function passes a cacheable command to the Message Router and
+  *    determines if it was answered from the cache.
+  * Parameters:
+  *    index :  The index of the command in cacheableCommands
+  * Returns:
+  *    bool - true if the response came from the cache
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool IsHit(const uint32_t index);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Process a command
+static int Process(const uint8_t moduleID, const uint8_t commandID, uint8_t *const response)
+{
+   uint8_t command[1] = { 0U };
+   Lunar_MessageRouter_Message_t message;
+   int length = -1;
+
+   memset(&message, 0, sizeof(message));
+   message.header.moduleID = moduleID;
+   message.header.commandID = commandID;
+   message.commandParams.data = command;
+   message.commandParams.maxLength = sizeof(command);
+   message.responseParams.data = response;
+   message.responseParams.maxLength = RESPONSE_BUFFER_SIZE;
+   message.source.transport = LUNAR_MESSAGEROUTER_TRANSPORT_Serial;
+
+   Lunar_MessageRouter_ProcessMessage(&message);
+   if (message.responseCode == LUNAR_MESSAGEROUTER_RESPONSE_CODE_None)
+   {
+      length = (int)message.responseParams.length;
+   }
+
+   return(length);
+}
+
+// Read the counters
+static bool GetStatistics(Statistics_t *const statistics)
+{
+   uint8_t response[RESPONSE_BUFFER_SIZE];
+   bool isRead = false;
+
+   if (Process(MESSAGEROUTER_MODULE_ID, MESSAGEROUTER_COMMAND_GET_CACHE_STATISTICS, response) >= (int)STATISTICS_MIN_LENGTH)
+   {
+      memcpy(&statistics->numHits, &response[STATISTICS_NUM_HITS_OFFSET], sizeof(statistics->numHits));
+      memcpy(&statistics->numMisses, &response[STATISTICS_NUM_MISSES_OFFSET], sizeof(statistics->numMisses));
+      statistics->numEntriesUsed = response[STATISTICS_NUM_ENTRIES_USED_OFFSET];
+      isRead = true;
+   }
+
+   return(isRead);
+}
+
+// Clear the cache
+static bool ClearCache(void)
+{
+   uint8_t response[RESPONSE_BUFFER_SIZE];
+
+   return(Process(MESSAGEROUTER_MODULE_ID, MESSAGEROUTER_COMMAND_CLEAR_CACHE, response) == 0);
+}
+
+// Process a cacheable command and check where the response came from
+static bool IsHit(const uint32_t index)
+{
+   uint8_t response[RESPONSE_BUFFER_SIZE];
+   Statistics_t before = { 0U, 0U, 0U };
+   Statistics_t after = { 0U, 0U, 0U };
+
+   TEST_CHECK(GetStatistics(&before));
+   TEST_CHECK(Process(cacheableCommands[index].moduleID, cacheableCommands[index].commandID, response) >= 0);
+   TEST_CHECK(GetStatistics(&after));
+
+   // Every cacheable command is either a hit or a miss
+   TEST_CHECK(((after.numHits - before.numHits) + (after.numMisses - before.numMisses)) == 1U);
+
+   return(after.numHits != before.numHits);
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Test entry point
+int main(void)
+{
+   uint8_t response[RESPONSE_BUFFER_SIZE];
+   uint8_t cachedResponse[RESPONSE_BUFFER_SIZE];
+   Statistics_t statistics;
+
+   Test_Harness_Start();
+
+   //-----------------------------------------------
+   // Every cacheable command of the board fits in a cache entry
+   //-----------------------------------------------
+
+   uint32_t numForever = 0U;
+   uint32_t finiteIndex = MAX_CACHEABLE_COMMANDS;
+
+   for (uint32_t i = 0U; i < NUM_MODULES; i++)
+   {
+      for (uint32_t j = 0U; j < messageRouterConfigTable[i].numCommands; j++)
+      {
+         const Lunar_MessageRouter_CommandTableItem_t *const item = &messageRouterConfigTable[i].commandTable[j];
+
+         if ((item->cacheMaxAgeMs != LUNAR_MESSAGEROUTER_CACHE_NEVER) && TEST_CHECK(numCacheableCommands < MAX_CACHEABLE_COMMANDS))
+         {
+            const int length = Process(messageRouterConfigTable[i].moduleID, item->commandID, response);
+
+            // A response that is not stored would call the handler every time
+            TEST_CHECK((length >= 0) && (length <= (int)LUNAR_MESSAGEROUTER_CACHE_MAX_RESPONSE_SIZE));
+
+            if (item->cacheMaxAgeMs == LUNAR_MESSAGEROUTER_CACHE_FOREVER)
+            {
+               numForever++;
+            }
+            else if (finiteIndex == MAX_CACHEABLE_COMMANDS)
+            {
+               finiteIndex = numCacheableCommands;
+            }
+            else
+            {
+               // Only the first command with a max age is checked for expiry
+            }
+
+            cacheableCommands[numCacheableCommands].moduleID = messageRouterConfigTable[i].moduleID;
+            cacheableCommands[numCacheableCommands].commandID = item->commandID;
+            cacheableCommands[numCacheableCommands].cacheMaxAgeMs = item->cacheMaxAgeMs;
+            numCacheableCommands++;
+         }
+      }
+   }
+
+   // Every board has constant identification and telemetry that may be a little old
+   TEST_CHECK(numForever > 0U);
+   TEST_CHECK(finiteIndex < numCacheableCommands);
+
+   //-----------------------------------------------
+   // A second read is answered from the cache with the same response
+   //-----------------------------------------------
+
+   TEST_CHECK(ClearCache());
+   if (TEST_CHECK(GetStatistics(&statistics)))
+   {
+      TEST_CHECK((statistics.numHits == 0U) && (statistics.numMisses == 0U) && (statistics.numEntriesUsed == 0U));
+   }
+
+   const int length = Process(cacheableCommands[0].moduleID, cacheableCommands[0].commandID, cachedResponse);
+
+   TEST_CHECK(Process(cacheableCommands[0].moduleID, cacheableCommands[0].commandID, response) == length);
+   TEST_CHECK((length >= 0) && (memcmp(response, cachedResponse, (size_t)length) == 0));
+   if (TEST_CHECK(GetStatistics(&statistics)))
+   {
+      TEST_CHECK((statistics.numHits == 1U) && (statistics.numMisses == 1U) && (statistics.numEntriesUsed == 1U));
+   }
+
+   // Commands with parameters always call the handler
+   Lunar_MessageRouter_Message_t message;
+   uint8_t command[1] = { 0U };
+
+   memset(&message, 0, sizeof(message));
+   message.header.moduleID = cacheableCommands[0].moduleID;
+   message.header.commandID = cacheableCommands[0].commandID;
+   message.commandParams.data = command;
+   message.commandParams.maxLength = sizeof(command);
+   message.commandParams.length = sizeof(command);
+   message.responseParams.data = response;
+   message.responseParams.maxLength = RESPONSE_BUFFER_SIZE;
+   Lunar_MessageRouter_ProcessMessage(&message);
+   TEST_CHECK(message.responseCode != LUNAR_MESSAGEROUTER_RESPONSE_CODE_None);
+   if (TEST_CHECK(GetStatistics(&statistics)))
+   {
+      TEST_CHECK((statistics.numHits == 1U) && (statistics.numMisses == 1U));
+   }
+
+   //-----------------------------------------------
+   // A response is served up to its max age and then read again
+   //-----------------------------------------------
+
+   const uint32_t maxAgeMs = cacheableCommands[finiteIndex].cacheMaxAgeMs;
+
+   TEST_CHECK(ClearCache());
+   TEST_CHECK(!IsHit(finiteIndex));
+   Test_Harness_Run(maxAgeMs);
+   TEST_CHECK(IsHit(finiteIndex));
+   Test_Harness_Run(1U);
+   TEST_CHECK(!IsHit(finiteIndex));
+
+   // The new response is served for another max age
+   TEST_CHECK(IsHit(finiteIndex));
+   if (TEST_CHECK(GetStatistics(&statistics)))
+   {
+      TEST_CHECK(statistics.numEntriesUsed == 1U);
+   }
+
+   // Constant responses do not expire
+   TEST_CHECK(!IsHit(0U));
+   Test_Harness_Run(1000U);
+   TEST_CHECK(IsHit(0U));
+
+   //-----------------------------------------------
+   // A full cache replaces its entries in turn
+   //-----------------------------------------------
+
+   // No time passes from here on, so no response expires
+   TEST_CHECK(ClearCache());
+   for (uint32_t i = 0U; (i < numCacheableCommands) && (i < LUNAR_MESSAGEROUTER_CACHE_NUM_ENTRIES); i++)
+   {
+      TEST_CHECK(!IsHit(i));
+   }
+
+   if (numCacheableCommands > LUNAR_MESSAGEROUTER_CACHE_NUM_ENTRIES)
+   {
+      const uint32_t newIndex = LUNAR_MESSAGEROUTER_CACHE_NUM_ENTRIES;
+
+      // The first entry is replaced, whether or not it was read since
+      TEST_CHECK(IsHit(0U));
+      TEST_CHECK(!IsHit(newIndex));
+      TEST_CHECK(IsHit(newIndex));
+      for (uint32_t i = 1U; i < LUNAR_MESSAGEROUTER_CACHE_NUM_ENTRIES; i++)
+      {
+         TEST_CHECK(IsHit(i));
+      }
+
+      // Reading the first command again replaces the second entry, and the
+      // second command then replaces the third
+      TEST_CHECK(!IsHit(0U));
+      TEST_CHECK(IsHit(newIndex));
+      TEST_CHECK(IsHit(0U));
+      TEST_CHECK(!IsHit(1U));
+      TEST_CHECK(IsHit(1U));
+      if (LUNAR_MESSAGEROUTER_CACHE_NUM_ENTRIES > 3U)
+      {
+         TEST_CHECK(IsHit(LUNAR_MESSAGEROUTER_CACHE_NUM_ENTRIES - 1U));
+      }
+   }
+   else
+   {
+      // Every cacheable command has its own entry
+      for (uint32_t i = 0U; i < numCacheableCommands; i++)
+      {
+         TEST_CHECK(IsHit(i));
+      }
+   }
+
+   if (TEST_CHECK(GetStatistics(&statistics)))
+   {
+      TEST_CHECK(statistics.numEntriesUsed == (uint8_t)PLATFORM_MIN(numCacheableCommands, (uint32_t)LUNAR_MESSAGEROUTER_CACHE_NUM_ENTRIES));
+   }
+
+   return(Test_Harness_Finish());
+}
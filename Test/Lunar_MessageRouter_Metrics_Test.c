@@ -0,0 +1,311 @@
+/*******************************************************************************
+// Message Router Command Metrics Test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Test_Harness.h"
+// Platform Includes
+#include "Lunar_MessageRouter.h"
+#include "Lunar_MessageRouter_Config.h"
+#include "Lunar_MessageRouter_ConfigTable.h"
+// Other Includes
+#include <string.h> // memcpy, memset
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The number of modules in the Message Router table of the board
+#define NUM_MODULES (sizeof(messageRouterConfigTable) / sizeof(Lunar_MessageRouter_ConfigItem_t))
+
+// The most commands a board may have
+#define MAX_COMMANDS (128U)
+
+// The metrics commands of the Message Router
+#define MESSAGEROUTER_MODULE_ID (0x0BU)
+#define MESSAGEROUTER_COMMAND_GET_METRICS_SUMMARY (0x03U)
+#define MESSAGEROUTER_COMMAND_GET_COMMAND_METRICS (0x04U)
+
+// Offset of the number of commands in the Get Metrics Summary response
+#define SUMMARY_NUM_COMMANDS_OFFSET (8U)
+
+// Offsets in the Get Command Metrics response, a header followed by the
+// entries of the commands that fit
+#define METRICS_NEXT_INDEX_OFFSET (0U)
+#define METRICS_NUM_ENTRIES_OFFSET (2U)
+#define METRICS_HEADER_LENGTH (4U)
+
+// Offsets in an entry of the response
+#define ENTRY_NUM_CALLS_OFFSET (0U)
+#define ENTRY_RESPONSE_CODE_COUNTS_OFFSET (16U)
+#define ENTRY_MODULE_ID_OFFSET (ENTRY_RESPONSE_CODE_COUNTS_OFFSET + (2U * (uint32_t)LUNAR_MESSAGEROUTER_RESPONSE_CODE_Count))
+#define ENTRY_COMMAND_ID_OFFSET (ENTRY_MODULE_ID_OFFSET + 1U)
+#define ENTRY_LENGTH (((ENTRY_MODULE_ID_OFFSET + 2U) + 3U) & ~3U)
+
+// The size of the largest response buffer given to the Message Router
+#define RESPONSE_BUFFER_SIZE (255U)
+
+// The number of times the summary is read between two reads of its metrics
+#define NUM_SUMMARY_READS (3U)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// This structure holds a command of the Message Router table
+typedef struct
+{
+   uint8_t moduleID;
+   uint8_t commandID;
+} TableCommand_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The commands of the board, in table order
+static TableCommand_t tableCommands[MAX_COMMANDS];
+static uint32_t numTableCommands;
+
+// The number of commands with metrics, the first in table order
+static uint32_t numMetricsCommands;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function passes a command to the Message Router.  No time passes
+  *    while it is processed.
+  * Parameters:
+  *    commandID :       The Message Router command
+  *    params :          The command parameters
+  *    paramsLength :    The number of bytes in params
+  *    response :        Destination for the response, RESPONSE_BUFFER_SIZE bytes
+  *    maxLength :       The size of the response buffer given to the Message Router
+  * Returns:
+  *    int - The length of the response, or -1 for an error response
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static int Process(const uint8_t commandID, uint8_t *const params, const uint8_t paramsLength, uint8_t *const response, const uint8_t maxLength);
+
+/** Description:
+  *    This function reads the metrics of the commands from a start index.
+  * Parameters:
+  *    startIndex :  The index of the first command
+  *    response :    Destination for the response, RESPONSE_BUFFER_SIZE bytes
+  *    maxLength :   The size of the response buffer given to the Message Router
+  * Returns:
+  *    int - The length of the response, or -1 for an error response
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static int GetCommandMetrics(const uint16_t startIndex, uint8_t *const response, const uint8_t maxLength);
+
+/** Description:
+  *    This function reads all metrics from index 0 with a response buffer
+  *    of the given size and checks that every response holds the commands
+  *    that fit, in table order.
+  * Parameters:
+  *    maxLength :  The size of the response buffer given to the Message Router
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void CheckWalk(const uint8_t maxLength);
+
+/** Description:
+  *    This function reads the number of calls of a command.
+  * Parameters:
+  *    index :  The index of the command, in table order
+  * Returns:
+  *    uint32_t - The number of calls, 0 if the metrics could not be read
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint32_t GetNumCalls(const uint16_t index);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Process a command
+static int Process(const uint8_t commandID, uint8_t *const params, const uint8_t paramsLength, uint8_t *const response, const uint8_t maxLength)
+{
+   Lunar_MessageRouter_Message_t message;
+   int length = -1;
+
+   memset(&message, 0, sizeof(message));
+   message.header.moduleID = MESSAGEROUTER_MODULE_ID;
+   message.header.commandID = commandID;
+   message.commandParams.data = params;
+   message.commandParams.maxLength = paramsLength;
+   message.commandParams.length = paramsLength;
+   message.responseParams.data = response;
+   message.responseParams.maxLength = maxLength;
+   message.source.transport = LUNAR_MESSAGEROUTER_TRANSPORT_Serial;
+
+   Lunar_MessageRouter_ProcessMessage(&message);
+   if (message.responseCode == LUNAR_MESSAGEROUTER_RESPONSE_CODE_None)
+   {
+      length = (int)message.responseParams.length;
+   }
+
+   return(length);
+}
+
+// Read the metrics from a start index
+static int GetCommandMetrics(const uint16_t startIndex, uint8_t *const response, const uint8_t maxLength)
+{
+   uint8_t params[2] = { (uint8_t)startIndex, (uint8_t)(startIndex >> 8) };
+
+   return(Process(MESSAGEROUTER_COMMAND_GET_COMMAND_METRICS, params, sizeof(params), response, maxLength));
+}
+
+// Read all metrics and check the pages
+static void CheckWalk(const uint8_t maxLength)
+{
+   uint8_t response[RESPONSE_BUFFER_SIZE];
+   const uint32_t maxEntries = (maxLength - METRICS_HEADER_LENGTH) / ENTRY_LENGTH;
+   uint32_t index = 0U;
+   uint32_t numEntries = 1U;
+
+   // Every response but the last holds at least one command
+   while ((numEntries > 0U) && TEST_CHECK(index <= numMetricsCommands))
+   {
+      const int length = GetCommandMetrics((uint16_t)index, response, maxLength);
+      const uint32_t expectedEntries = PLATFORM_MIN(maxEntries, numMetricsCommands - index);
+      uint16_t nextIndex = 0U;
+
+      numEntries = response[METRICS_NUM_ENTRIES_OFFSET];
+      memcpy(&nextIndex, &response[METRICS_NEXT_INDEX_OFFSET], sizeof(nextIndex));
+
+      TEST_CHECK(length == (int)(METRICS_HEADER_LENGTH + (expectedEntries * ENTRY_LENGTH)));
+      if (TEST_CHECK((numEntries == expectedEntries) && (nextIndex == (index + numEntries))))
+      {
+         for (uint32_t i = 0U; i < numEntries; i++)
+         {
+            const uint8_t *const entry = &response[METRICS_HEADER_LENGTH + (i * ENTRY_LENGTH)];
+
+            TEST_CHECK((entry[ENTRY_MODULE_ID_OFFSET] == tableCommands[index + i].moduleID) &&
+                       (entry[ENTRY_COMMAND_ID_OFFSET] == tableCommands[index + i].commandID));
+         }
+      }
+      else
+      {
+         // Stop at a bad response
+         numEntries = 0U;
+      }
+
+      index += numEntries;
+   }
+
+   TEST_CHECK(index == numMetricsCommands);
+}
+
+// Read the number of calls of a command
+static uint32_t GetNumCalls(const uint16_t index)
+{
+   uint8_t response[RESPONSE_BUFFER_SIZE];
+   uint32_t numCalls = 0U;
+
+   if (TEST_CHECK(GetCommandMetrics(index, response, (uint8_t)(METRICS_HEADER_LENGTH + ENTRY_LENGTH)) == (int)(METRICS_HEADER_LENGTH + ENTRY_LENGTH)))
+   {
+      memcpy(&numCalls, &response[METRICS_HEADER_LENGTH + ENTRY_NUM_CALLS_OFFSET], sizeof(numCalls));
+   }
+
+   return(numCalls);
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Test entry point
+int main(void)
+{
+   uint8_t response[RESPONSE_BUFFER_SIZE];
+   uint16_t summaryIndex = 0U;
+   uint16_t nextIndex = 0U;
+
+   Test_Harness_Start();
+
+   for (uint32_t i = 0U; i < NUM_MODULES; i++)
+   {
+      for (uint32_t j = 0U; (j < messageRouterConfigTable[i].numCommands) && TEST_CHECK(numTableCommands < MAX_COMMANDS); j++)
+      {
+         tableCommands[numTableCommands].moduleID = messageRouterConfigTable[i].moduleID;
+         tableCommands[numTableCommands].commandID = messageRouterConfigTable[i].commandTable[j].commandID;
+         if ((tableCommands[numTableCommands].moduleID == MESSAGEROUTER_MODULE_ID) &&
+             (tableCommands[numTableCommands].commandID == MESSAGEROUTER_COMMAND_GET_METRICS_SUMMARY))
+         {
+            summaryIndex = (uint16_t)numTableCommands;
+         }
+         numTableCommands++;
+      }
+   }
+   numMetricsCommands = PLATFORM_MIN(numTableCommands, (uint32_t)LUNAR_MESSAGEROUTER_METRICS_MAX_COMMANDS);
+
+   // The summary gives the number of commands to read
+   uint16_t numCommands = 0U;
+
+   TEST_CHECK(Process(MESSAGEROUTER_COMMAND_GET_METRICS_SUMMARY, response, 0U, response, RESPONSE_BUFFER_SIZE) > (int)SUMMARY_NUM_COMMANDS_OFFSET);
+   memcpy(&numCommands, &response[SUMMARY_NUM_COMMANDS_OFFSET], sizeof(numCommands));
+   TEST_CHECK(numCommands == numMetricsCommands);
+
+   //-----------------------------------------------
+   // Each response holds as many commands as fit, in table order
+   //-----------------------------------------------
+
+   // One command, one that does not quite fit a second, two and the most the
+   // Message Router can answer
+   CheckWalk((uint8_t)(METRICS_HEADER_LENGTH + ENTRY_LENGTH));
+   CheckWalk((uint8_t)((METRICS_HEADER_LENGTH + (2U * ENTRY_LENGTH)) - 1U));
+   CheckWalk((uint8_t)(METRICS_HEADER_LENGTH + (2U * ENTRY_LENGTH)));
+   CheckWalk((uint8_t)RESPONSE_BUFFER_SIZE);
+
+   // A start index in the table begins with that command
+   const uint16_t lastIndex = (uint16_t)(numMetricsCommands - 1U);
+
+   if (TEST_CHECK(GetCommandMetrics(lastIndex, response, RESPONSE_BUFFER_SIZE) == (int)(METRICS_HEADER_LENGTH + ENTRY_LENGTH)))
+   {
+      TEST_CHECK((response[METRICS_HEADER_LENGTH + ENTRY_MODULE_ID_OFFSET] == tableCommands[lastIndex].moduleID) &&
+                 (response[METRICS_HEADER_LENGTH + ENTRY_COMMAND_ID_OFFSET] == tableCommands[lastIndex].commandID));
+   }
+
+   // A start index past the commands with metrics holds no commands
+   TEST_CHECK(GetCommandMetrics((uint16_t)(numMetricsCommands + 1U), response, RESPONSE_BUFFER_SIZE) == (int)METRICS_HEADER_LENGTH);
+   memcpy(&nextIndex, &response[METRICS_NEXT_INDEX_OFFSET], sizeof(nextIndex));
+   TEST_CHECK((response[METRICS_NUM_ENTRIES_OFFSET] == 0U) && (nextIndex == (numMetricsCommands + 1U)));
+
+   // A response buffer without room for one command is an error
+   TEST_CHECK(GetCommandMetrics(0U, response, (uint8_t)((METRICS_HEADER_LENGTH + ENTRY_LENGTH) - 1U)) < 0);
+
+   //-----------------------------------------------
+   // The entry of a command counts its calls
+   //-----------------------------------------------
+
+   const uint32_t numCalls = GetNumCalls(summaryIndex);
+
+   for (uint32_t i = 0U; i < NUM_SUMMARY_READS; i++)
+   {
+      TEST_CHECK(Process(MESSAGEROUTER_COMMAND_GET_METRICS_SUMMARY, response, 0U, response, RESPONSE_BUFFER_SIZE) > 0);
+   }
+   TEST_CHECK(GetNumCalls(summaryIndex) == (numCalls + NUM_SUMMARY_READS));
+
+   return(Test_Harness_Finish());
+}
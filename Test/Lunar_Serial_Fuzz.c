@@ -0,0 +1,341 @@
+/*******************************************************************************
+// Serial and Message Router Fuzz Target
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Test_Harness.h"
+// Platform Includes
+#include "Lunar_CANTransport_Config.h"
+#include "Lunar_MessageBufferPool.h"
+// Other Includes
+#include <stddef.h> // size_t
+#include <stdlib.h> // abort, rand
+#include <string.h> // memcpy
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The input is a stream of records.  The first byte of a record selects what
+// happens next:
+//   RECORD_Serial:  channel, length, bytes received on the UART
+//   RECORD_CAN:     4 byte CAN ID (little endian), length, data bytes received on the bus
+//   RECORD_Time:    the number of milliseconds to run the firmware
+enum
+{
+   RECORD_Serial,
+   RECORD_CAN,
+   RECORD_Time,
+   RECORD_Count
+};
+
+// Time for the firmware to finish every command and time out every partial
+// transfer at the end of an input
+#define IDLE_TIME_MILLISECONDS (2000U)
+
+// Size of the inputs made by the random generator
+#define MAX_GENERATED_SIZE (4096U)
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function drops the output of the firmware, so full transmit
+  *    buffers do not change the behavior between inputs.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void DiscardOutput(void);
+
+#ifndef TEST_LIBFUZZER
+/** Description:
+  *    This function makes an input of mostly well-formed serial commands and
+  *    CAN requests, so the random mode reaches the message handlers.
+  * Parameters:
+  *    data :  Buffer for the input, MAX_GENERATED_SIZE bytes
+  * Returns:
+  *    size_t - The size of the input
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static size_t GenerateInput(uint8_t *const data);
+#endif
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Drop the output of the firmware
+static void DiscardOutput(void)
+{
+   uint8_t buffer[256];
+   CAN_Drv_Frame_t frame;
+
+   for (uint8_t channel = 0U; channel < UART_DRV_CHANNEL_Count; channel++)
+   {
+      while (Host_Drv_TakeUARTOutput((UART_Drv_Channel_t)channel, buffer, sizeof(buffer)) > 0U)
+      {
+         // Keep taking
+      }
+   }
+
+   while (Host_Drv_TakeCANOutput(&frame))
+   {
+      // Keep taking
+   }
+}
+
+#ifndef TEST_LIBFUZZER
+// Make a random input
+static size_t GenerateInput(uint8_t *const data)
+{
+   static const char hexDigits[] = "0123456789ABCDEF";
+   size_t size = 0U;
+   const int numRecords = 1 + (rand() % 8);
+
+   for (int record = 0; (record < numRecords) && (size < (MAX_GENERATED_SIZE - 300U)); record++)
+   {
+      const int type = rand() % 8;
+
+      if (type == 0)
+      {
+         // Noise
+         const int length = rand() % 120;
+
+         data[size++] = RECORD_Serial;
+         data[size++] = (uint8_t)rand();
+         data[size++] = (uint8_t)length;
+
+         for (int i = 0; i < length; i++)
+         {
+            data[size++] = (uint8_t)rand();
+         }
+      }
+      else if (type < 5)
+      {
+         // A serial command, sometimes with a wrong length or a damaged character
+         uint8_t bytes[80];
+         uint8_t numBytes = 0U;
+         const uint8_t paramsLength = (uint8_t)(((rand() % 3) != 0) ? (rand() % 12) : (rand() % 60));
+         uint8_t *const length = &data[size + 2U];
+
+         bytes[numBytes++] = ((rand() % 3) != 0) ? (uint8_t)(rand() % 18) : (uint8_t)(0xA0 + (rand() % 2));
+         bytes[numBytes++] = ((rand() % 5) != 0) ? (uint8_t)(rand() % 10) : (uint8_t)rand();
+         bytes[numBytes++] = (uint8_t)rand();
+         bytes[numBytes++] = ((rand() % 4) != 0) ? paramsLength : (uint8_t)rand();
+
+         for (uint8_t i = 0U; i < paramsLength; i++)
+         {
+            bytes[numBytes++] = (uint8_t)rand();
+         }
+
+         data[size++] = RECORD_Serial;
+         data[size++] = (uint8_t)(rand() % 2);
+         size++;
+         *length = 0U;
+
+         data[size++] = '<';
+         (*length)++;
+
+         for (uint8_t i = 0U; i < numBytes; i++)
+         {
+            data[size++] = (uint8_t)hexDigits[bytes[i] >> 4];
+            data[size++] = (uint8_t)hexDigits[bytes[i] & 0x0FU];
+            *length += 2U;
+
+            if ((rand() % 50) == 0)
+            {
+               data[size++] = (uint8_t)rand();
+               (*length)++;
+            }
+         }
+
+         if ((rand() % 10) != 0)
+         {
+            data[size++] = '\r';
+            data[size++] = '\n';
+            *length += 2U;
+         }
+      }
+      else if (type < 7)
+      {
+         // A single frame or ISO-TP request on CAN, sometimes with any ID
+         uint32_t canId = 0U;
+         const uint8_t length = (uint8_t)(rand() % 9);
+
+         switch (rand() % 4)
+         {
+            case 0:
+               canId = LUNAR_CANTRANSPORT_REQUEST_CANID | ((uint32_t)rand() & 0xFFFFU) | CAN_DRV_EXTENDED_ID;
+               break;
+            case 1:
+               canId = LUNAR_CANTRANSPORT_ISOTP_REQUEST_CANID | ((uint32_t)rand() & 0xFFFFU) | CAN_DRV_EXTENDED_ID;
+               break;
+            case 2:
+               canId = LUNAR_CANTRANSPORT_REQUEST_CANID | ((uint32_t)(rand() % 18) << 8) | ((uint32_t)rand() & 0x0FU) | CAN_DRV_EXTENDED_ID;
+               break;
+            default:
+               canId = ((uint32_t)rand() << 1) ^ (uint32_t)rand();
+               break;
+         }
+
+         data[size++] = RECORD_CAN;
+         data[size++] = (uint8_t)canId;
+         data[size++] = (uint8_t)(canId >> 8);
+         data[size++] = (uint8_t)(canId >> 16);
+         data[size++] = (uint8_t)(canId >> 24);
+         data[size++] = length;
+
+         for (uint8_t i = 0U; i < length; i++)
+         {
+            data[size++] = (uint8_t)rand();
+         }
+      }
+      else
+      {
+         data[size++] = RECORD_Time;
+         data[size++] = (uint8_t)(rand() % 50);
+      }
+   }
+
+   return(size);
+}
+#endif
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// libFuzzer entry point, also used by the standalone runner
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+   size_t index = 0U;
+
+   Test_Harness_Start();
+
+   while (index < size)
+   {
+      const uint8_t type = (uint8_t)(data[index++] % RECORD_Count);
+
+      if ((type == RECORD_Serial) && ((index + 2U) <= size))
+      {
+         const UART_Drv_Channel_t channel = (UART_Drv_Channel_t)(data[index] % UART_DRV_CHANNEL_Count);
+         size_t length = data[index + 1U];
+
+         index += 2U;
+         length = ((index + length) <= size) ? length : (size - index);
+
+         (void)Host_Drv_ReceiveUART(channel, &data[index], (uint32_t)length);
+         index += length;
+      }
+      else if ((type == RECORD_CAN) && ((index + 5U) <= size))
+      {
+         CAN_Drv_Frame_t frame;
+
+         memset(&frame, 0, sizeof(frame));
+         frame.canId = (uint32_t)data[index] | ((uint32_t)data[index + 1U] << 8) |
+                       ((uint32_t)data[index + 2U] << 16) | ((uint32_t)data[index + 3U] << 24);
+         frame.length = (uint8_t)(data[index + 4U] % (CAN_DRV_MAX_DATA_LENGTH + 1U));
+         index += 5U;
+         frame.length = ((index + frame.length) <= size) ? frame.length : (uint8_t)(size - index);
+         memcpy(frame.data, &data[index], frame.length);
+         index += frame.length;
+
+         (void)Host_Drv_ReceiveCAN(&frame);
+      }
+      else if ((type == RECORD_Time) && (index < size))
+      {
+         Test_Harness_Run(data[index++]);
+      }
+      else
+      {
+         // Incomplete record at the end of the input
+         index = size;
+      }
+
+      Test_Harness_Run(1U);
+      DiscardOutput();
+   }
+
+   // A partial serial command keeps its block until the line is complete,
+   // so end the line on every port
+   for (uint8_t channel = 0U; channel < UART_DRV_CHANNEL_Count; channel++)
+   {
+      static const uint8_t endOfLine[] = { '\r', '\n' };
+
+      (void)Host_Drv_ReceiveUART((UART_Drv_Channel_t)channel, endOfLine, sizeof(endOfLine));
+   }
+
+   // Every command must be answered or dropped and every block returned
+   for (uint32_t i = 0U; i < (IDLE_TIME_MILLISECONDS / 100U); i++)
+   {
+      Test_Harness_Run(100U);
+      DiscardOutput();
+   }
+
+   if (Lunar_MessageBufferPool_GetNumFreeBlocks() != LUNAR_MESSAGEBUFFERPOOL_NUM_BLOCKS)
+   {
+      fprintf(stderr, "message buffer pool leaked %u blocks\n",
+             (unsigned)(LUNAR_MESSAGEBUFFERPOOL_NUM_BLOCKS - Lunar_MessageBufferPool_GetNumFreeBlocks()));
+      abort();
+   }
+
+   return(0);
+}
+
+#ifndef TEST_LIBFUZZER
+// Standalone runner
+//   Lunar_Serial_Fuzz file...                 runs each file as an input (AFL: @@)
+//   Lunar_Serial_Fuzz -r seed iterations      runs random inputs
+int main(int argc, char **argv)
+{
+   static uint8_t data[MAX_GENERATED_SIZE];
+
+   if ((argc == 4) && (strcmp(argv[1], "-r") == 0))
+   {
+      const long numIterations = atol(argv[3]);
+
+      srand((unsigned)atoi(argv[2]));
+
+      for (long i = 0; i < numIterations; i++)
+      {
+         (void)LLVMFuzzerTestOneInput(data, GenerateInput(data));
+      }
+
+      printf("%ld random inputs\n", numIterations);
+   }
+   else
+   {
+      for (int i = 1; i < argc; i++)
+      {
+         FILE *const file = fopen(argv[i], "rb");
+
+         if (file == NULL)
+         {
+            printf("cannot open %s\n", argv[i]);
+            return(EXIT_FAILURE);
+         }
+
+         const size_t size = fread(data, 1U, sizeof(data), file);
+         fclose(file);
+
+         (void)LLVMFuzzerTestOneInput(data, size);
+      }
+   }
+
+   return(EXIT_SUCCESS);
+}
+#endif
@@ -0,0 +1,79 @@
+/*******************************************************************************
+// Serial and Message Router Test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Test_Harness.h"
+// Platform Includes
+#include "Lunar_MessageBufferPool.h"
+// Other Includes
+#include "Lunar_Main_ConfigTable.h"
+#include <string.h> // memcmp
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// Main module and its commands
+#define MAIN_MODULE_ID (0x01U)
+#define MAIN_COMMAND_GET_APPLICATION_VERSION (0x01U)
+#define MAIN_COMMAND_GET_PRODUCT_ID (0x02U)
+#define MAIN_COMMAND_GET_PRODUCT_NAME (0x03U)
+
+// A module ID no board uses
+#define UNUSED_MODULE_ID (0xFEU)
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Test entry point
+int main(void)
+{
+   uint8_t response[255];
+   int responseLength = 0;
+
+   Test_Harness_Start();
+
+   for (uint8_t channel = 0U; channel < UART_DRV_CHANNEL_Count; channel++)
+   {
+      // A command is answered on the port it was received on
+      responseLength = Test_Harness_SendCommand((UART_Drv_Channel_t)channel, MAIN_MODULE_ID, MAIN_COMMAND_GET_PRODUCT_ID, NULL, 0U, response, sizeof(response));
+      TEST_CHECK(responseLength == 4);
+      TEST_CHECK((response[0] | ((uint32_t)response[1] << 8) | ((uint32_t)response[2] << 16) | ((uint32_t)response[3] << 24)) == mainConfigTable.productId);
+
+      responseLength = Test_Harness_SendCommand((UART_Drv_Channel_t)channel, MAIN_MODULE_ID, MAIN_COMMAND_GET_PRODUCT_NAME, NULL, 0U, response, sizeof(response));
+      TEST_CHECK(responseLength > 0);
+      TEST_CHECK(memcmp(response, mainConfigTable.productName.stringValue, (size_t)responseLength) == 0);
+
+      responseLength = Test_Harness_SendCommand((UART_Drv_Channel_t)channel, MAIN_MODULE_ID, MAIN_COMMAND_GET_APPLICATION_VERSION, NULL, 0U, response, sizeof(response));
+      TEST_CHECK(responseLength == 4);
+      TEST_CHECK((response[2] | ((uint16_t)response[3] << 8)) == mainConfigTable.version.build);
+   }
+
+   // Rejected commands are answered without response parameters
+   const uint8_t unexpectedParams[3] = { 1U, 2U, 3U };
+
+   responseLength = Test_Harness_SendCommand((UART_Drv_Channel_t)0, UNUSED_MODULE_ID, 0x01U, NULL, 0U, response, sizeof(response));
+   TEST_CHECK(responseLength == 0);
+   responseLength = Test_Harness_SendCommand((UART_Drv_Channel_t)0, MAIN_MODULE_ID, MAIN_COMMAND_GET_PRODUCT_ID, unexpectedParams, sizeof(unexpectedParams), response, sizeof(response));
+   TEST_CHECK(responseLength == 0);
+
+   // A command that is cut off by the next one is dropped and its block returned
+   const uint8_t partialCommand[] = "<0102";
+
+   TEST_CHECK(Host_Drv_ReceiveUART((UART_Drv_Channel_t)0, partialCommand, sizeof(partialCommand) - 1U) == (sizeof(partialCommand) - 1U));
+   responseLength = Test_Harness_SendCommand((UART_Drv_Channel_t)0, MAIN_MODULE_ID, MAIN_COMMAND_GET_PRODUCT_ID, NULL, 0U, response, sizeof(response));
+   TEST_CHECK(responseLength == 4);
+
+   Test_Harness_Run(100U);
+   TEST_CHECK(Lunar_MessageBufferPool_GetNumFreeBlocks() == LUNAR_MESSAGEBUFFERPOOL_NUM_BLOCKS);
+
+   return(Test_Harness_Finish());
+}
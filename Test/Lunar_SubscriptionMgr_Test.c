@@ -0,0 +1,376 @@
+/*******************************************************************************
+// Subscription Manager Test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Test_Harness.h"
+// Platform Includes
+#include "Host_Drv.h"
+#include "Lunar_ErrorMgr.h"
+#include "Lunar_SubscriptionMgr.h"
+// Other Includes
+#include <stdlib.h> // strtoul
+#include <string.h> // memcpy
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The serial channel the subscriptions are created from
+#define SERIAL_CHANNEL ((UART_Drv_Channel_t)0)
+
+// The Subscription Manager commands
+#define SUBSCRIPTIONMGR_MODULE_ID (0x0AU)
+#define SUBSCRIPTIONMGR_COMMAND_UNSUBSCRIBE (0x02U)
+#define SUBSCRIPTIONMGR_COMMAND_GET_STATISTICS (0x04U)
+
+// Offsets in the statistics response
+#define STATISTICS_NUM_SENT_OFFSET (0U)
+#define STATISTICS_NUM_SUPPRESSED_OFFSET (4U)
+#define STATISTICS_NUM_THROTTLED_OFFSET (8U)
+#define STATISTICS_NUM_SUBSCRIPTIONS_OFFSET (12U)
+#define STATISTICS_MIN_LENGTH (13U)
+
+// The commands the subscriptions execute
+#define ERRORMGR_MODULE_ID (0x02U)
+#define ERRORMGR_COMMAND_GET_ALL_ERRORS (0x05U)
+#define ERRORMGR_COMMAND_GET_RECENT_TRANSITIONS (0x08U)
+
+// The length of a GetRecentTransitions response and its cost against the
+// bandwidth cap with the module, command, message ID and length bytes
+#define TRANSITIONS_RESPONSE_LENGTH (36U)
+#define TRANSITIONS_RESPONSE_COST (TRANSITIONS_RESPONSE_LENGTH + 4U)
+
+// The message IDs of the subscriptions tell their responses apart
+#define FIRST_MESSAGE_ID (0x40U)
+#define ON_CHANGE_MESSAGE_ID (0x80U)
+
+// The time the bandwidth cap is measured over
+#define BANDWIDTH_RUN_MILLISECONDS (5000U)
+
+// The time an on-change subscription is watched without a change
+#define ON_CHANGE_RUN_MILLISECONDS (1000U)
+
+// An error without a qualification time that changes the GetAllErrors response
+#define TOGGLED_ERROR (LUNAR_ERRORMGR_ERROR_WATCHDOG_TIMEOUT)
+
+// Serial protocol framing of a response
+#define RESPONSE_START_BYTE ('>')
+#define RESPONSE_STOP_BYTE ('\r')
+#define HEADER_SIZE (4U)
+#define MAX_FRAME_SIZE (1U + (2U * (HEADER_SIZE + 255U)))
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// This structure holds the subscription responses taken from the serial port
+typedef struct
+{
+   // Number of responses for each message ID
+   uint32_t numResponses[256];
+   // The data of the last response
+   uint8_t lastData[255];
+   uint8_t lastLength;
+   // A response being received
+   uint8_t frame[MAX_FRAME_SIZE];
+   uint32_t frameLength;
+} Responses_t;
+
+// This structure holds the statistics of the Subscription Manager
+typedef struct
+{
+   uint32_t numResponsesSent;
+   uint32_t numResponsesSuppressed;
+   uint32_t numResponsesThrottled;
+   uint8_t numSubscriptions;
+} Statistics_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The responses taken from the serial port
+static Responses_t responses;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function runs the firmware and takes the subscription responses it
+  *    sends on the serial port every millisecond.
+  * Parameters:
+  *    milliseconds :  The time to run
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void RunAndTakeResponses(const uint32_t milliseconds);
+
+/** Description:
+  *    This function reads the Subscription Manager statistics via the serial
+  *    port.  Responses sent before are taken first.
+  * Parameters:
+  *    statistics :  Destination for the statistics
+  * Returns:
+  *    bool - true if the statistics were read
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool GetStatistics(Statistics_t *const statistics);
+
+/** Description:
+  *    This function subscribes the serial port to a command.
+  * Parameters:
+  *    commandId :  The ErrorMgr command to execute
+  *    messageId :  The message ID of the responses
+  *    periodMs :   The period or LUNAR_SUBSCRIPTIONMGR_PERIOD_ON_CHANGE
+  *    param :      The command parameter, none if commandId takes none
+  * Returns:
+  *    uint8_t - The index of the subscription
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint8_t Subscribe(const uint8_t commandId, const uint8_t messageId, const uint16_t periodMs, const uint8_t param);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Run and take the responses
+static void RunAndTakeResponses(const uint32_t milliseconds)
+{
+   for (uint32_t elapsed = 0U; elapsed < milliseconds; elapsed++)
+   {
+      uint8_t byte = 0U;
+
+      Test_Harness_Run(1U);
+      while (Host_Drv_TakeUARTOutput(SERIAL_CHANNEL, &byte, 1U) == 1U)
+      {
+         if (byte == (uint8_t)RESPONSE_START_BYTE)
+         {
+            responses.frameLength = 0U;
+         }
+         else if ((byte == (uint8_t)RESPONSE_STOP_BYTE) && (responses.frameLength >= (2U * HEADER_SIZE)))
+         {
+            uint8_t decoded[HEADER_SIZE + 255U];
+            const uint32_t numBytes = responses.frameLength / 2U;
+
+            // Hex pairs, the framing was checked by the serial test
+            for (uint32_t i = 0U; i < numBytes; i++)
+            {
+               char hex[3] = { (char)responses.frame[2U * i], (char)responses.frame[(2U * i) + 1U], '\0' };
+
+               decoded[i] = (uint8_t)strtoul(hex, NULL, 16);
+            }
+
+            if ((decoded[0] == ERRORMGR_MODULE_ID) && (numBytes == (HEADER_SIZE + (uint32_t)decoded[3])))
+            {
+               responses.numResponses[decoded[2]]++;
+               responses.lastLength = decoded[3];
+               memcpy(responses.lastData, &decoded[HEADER_SIZE], decoded[3]);
+            }
+            responses.frameLength = 0U;
+         }
+         else if (responses.frameLength < sizeof(responses.frame))
+         {
+            responses.frame[responses.frameLength++] = byte;
+         }
+         else
+         {
+            // Not part of a response
+         }
+      }
+   }
+}
+
+// Read the statistics
+static bool GetStatistics(Statistics_t *const statistics)
+{
+   uint8_t response[32];
+   bool isRead = false;
+
+   // The command throws away the output that was not taken
+   RunAndTakeResponses(0U);
+   if (Test_Harness_SendCommand(SERIAL_CHANNEL, SUBSCRIPTIONMGR_MODULE_ID, SUBSCRIPTIONMGR_COMMAND_GET_STATISTICS, NULL, 0U,
+                                response, sizeof(response)) >= (int)STATISTICS_MIN_LENGTH)
+   {
+      memcpy(&statistics->numResponsesSent, &response[STATISTICS_NUM_SENT_OFFSET], sizeof(statistics->numResponsesSent));
+      memcpy(&statistics->numResponsesSuppressed, &response[STATISTICS_NUM_SUPPRESSED_OFFSET], sizeof(statistics->numResponsesSuppressed));
+      memcpy(&statistics->numResponsesThrottled, &response[STATISTICS_NUM_THROTTLED_OFFSET], sizeof(statistics->numResponsesThrottled));
+      statistics->numSubscriptions = response[STATISTICS_NUM_SUBSCRIPTIONS_OFFSET];
+      isRead = true;
+   }
+
+   return(isRead);
+}
+
+// Subscribe the serial port
+static uint8_t Subscribe(const uint8_t commandId, const uint8_t messageId, const uint16_t periodMs, const uint8_t param)
+{
+   const Lunar_MessageRouter_MessageSource_t source = { LUNAR_MESSAGEROUTER_TRANSPORT_Serial, (uint8_t)SERIAL_CHANNEL, 0U, 0U };
+   const Lunar_MessageRouter_MessageItemHeader_t header = { ERRORMGR_MODULE_ID, commandId, messageId };
+   const uint8_t paramLength = (commandId == ERRORMGR_COMMAND_GET_RECENT_TRANSITIONS) ? 1U : 0U;
+
+   return(Lunar_SubscriptionMgr_Subscribe(&source, &header, periodMs, 0U, &param, paramLength));
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Test entry point
+int main(void)
+{
+   const Lunar_MessageRouter_MessageSource_t serialSource = { LUNAR_MESSAGEROUTER_TRANSPORT_Serial, (uint8_t)SERIAL_CHANNEL, 0U, 0U };
+   Statistics_t before;
+   Statistics_t after;
+
+   Test_Harness_Start();
+
+   //-----------------------------------------------
+   // The bandwidth cap limits the bytes sent and shares them round robin
+   //-----------------------------------------------
+
+   // Every subscription is due as often as allowed, together far more than the cap
+   TEST_CHECK(((uint32_t)LUNAR_SUBSCRIPTIONMGR_MAX_SUBSCRIPTIONS * (1000U / LUNAR_SUBSCRIPTIONMGR_MIN_INTERVAL_MS) * TRANSITIONS_RESPONSE_COST) >
+              (uint32_t)LUNAR_SUBSCRIPTIONMGR_BANDWIDTH_BYTES_PER_SECOND);
+   TEST_CHECK(GetStatistics(&before));
+
+   for (uint32_t i = 0U; i < LUNAR_SUBSCRIPTIONMGR_MAX_SUBSCRIPTIONS; i++)
+   {
+      TEST_CHECK(Subscribe(ERRORMGR_COMMAND_GET_RECENT_TRANSITIONS, (uint8_t)(FIRST_MESSAGE_ID + i), LUNAR_SUBSCRIPTIONMGR_MIN_INTERVAL_MS, (uint8_t)i) == (uint8_t)i);
+   }
+
+   // A full bucket sends the responses that fit in the burst at once
+   const uint32_t burstResponses = PLATFORM_MIN((uint32_t)LUNAR_SUBSCRIPTIONMGR_MAX_SUBSCRIPTIONS,
+                                                (uint32_t)LUNAR_SUBSCRIPTIONMGR_BANDWIDTH_BURST_BYTES / TRANSITIONS_RESPONSE_COST);
+   uint32_t numResponses = 0U;
+
+   for (uint32_t elapsed = 0U; (elapsed < LUNAR_SUBSCRIPTIONMGR_MIN_INTERVAL_MS) && (numResponses == 0U); elapsed++)
+   {
+      RunAndTakeResponses(1U);
+      for (uint32_t i = 0U; i < LUNAR_SUBSCRIPTIONMGR_MAX_SUBSCRIPTIONS; i++)
+      {
+         numResponses += responses.numResponses[FIRST_MESSAGE_ID + i];
+      }
+   }
+   TEST_CHECK(numResponses == burstResponses);
+
+   // Then the bucket refills at the configured rate
+   RunAndTakeResponses(BANDWIDTH_RUN_MILLISECONDS);
+
+   uint32_t minResponses = UINT32_MAX;
+   uint32_t maxResponses = 0U;
+
+   numResponses = 0U;
+   for (uint32_t i = 0U; i < LUNAR_SUBSCRIPTIONMGR_MAX_SUBSCRIPTIONS; i++)
+   {
+      const uint32_t count = responses.numResponses[FIRST_MESSAGE_ID + i];
+
+      numResponses += count;
+      minResponses = PLATFORM_MIN(minResponses, count);
+      maxResponses = PLATFORM_MAX(maxResponses, count);
+   }
+
+   const uint32_t refillBytes = ((uint32_t)LUNAR_SUBSCRIPTIONMGR_BANDWIDTH_BYTES_PER_SECOND * BANDWIDTH_RUN_MILLISECONDS) / 1000U;
+
+   TEST_CHECK((numResponses * TRANSITIONS_RESPONSE_COST) <= (refillBytes + (uint32_t)LUNAR_SUBSCRIPTIONMGR_BANDWIDTH_BURST_BYTES + TRANSITIONS_RESPONSE_COST));
+   TEST_CHECK((numResponses * TRANSITIONS_RESPONSE_COST) >= (refillBytes - TRANSITIONS_RESPONSE_COST));
+
+   // A throttled subscription is served first once there is credit
+   TEST_CHECK((maxResponses - minResponses) <= 1U);
+
+   if (TEST_CHECK(GetStatistics(&after)))
+   {
+      TEST_CHECK((after.numResponsesSent - before.numResponsesSent) == numResponses);
+      TEST_CHECK(after.numResponsesThrottled > before.numResponsesThrottled);
+      TEST_CHECK(after.numSubscriptions == (uint8_t)LUNAR_SUBSCRIPTIONMGR_MAX_SUBSCRIPTIONS);
+   }
+
+   Lunar_SubscriptionMgr_UnsubscribeAll(&serialSource);
+   TEST_CHECK(GetStatistics(&after) && (after.numSubscriptions == 0U));
+
+   //-----------------------------------------------
+   // An on-change subscription only sends a response that changed
+   //-----------------------------------------------
+
+   // Let the bucket fill up again
+   RunAndTakeResponses(1000U);
+   TEST_CHECK(GetStatistics(&before));
+   TEST_CHECK(Subscribe(ERRORMGR_COMMAND_GET_ALL_ERRORS, ON_CHANGE_MESSAGE_ID, LUNAR_SUBSCRIPTIONMGR_PERIOD_ON_CHANGE, 0U) != LUNAR_SUBSCRIPTIONMGR_INVALID_INDEX);
+
+   // The first response is always sent, the same response is then suppressed
+   RunAndTakeResponses(ON_CHANGE_RUN_MILLISECONDS);
+   TEST_CHECK(responses.numResponses[ON_CHANGE_MESSAGE_ID] == 1U);
+   TEST_CHECK((responses.lastLength > 0U) && ((responses.lastData[0] & (1U << (uint32_t)TOGGLED_ERROR)) == 0U));
+   if (TEST_CHECK(GetStatistics(&after)))
+   {
+      // The handler is polled every minimum interval
+      const uint32_t numPolls = ON_CHANGE_RUN_MILLISECONDS / LUNAR_SUBSCRIPTIONMGR_MIN_INTERVAL_MS;
+      const uint32_t numSuppressed = after.numResponsesSuppressed - before.numResponsesSuppressed;
+
+      TEST_CHECK((numSuppressed >= (numPolls - 2U)) && (numSuppressed <= numPolls));
+      TEST_CHECK((after.numResponsesSent - before.numResponsesSent) == 1U);
+   }
+
+   // Each change is sent once, within one poll
+   Lunar_ErrorMgr_SetErrorState(TOGGLED_ERROR, true);
+   RunAndTakeResponses(LUNAR_SUBSCRIPTIONMGR_MIN_INTERVAL_MS + 10U);
+   TEST_CHECK(responses.numResponses[ON_CHANGE_MESSAGE_ID] == 2U);
+   TEST_CHECK((responses.lastData[0] & (1U << (uint32_t)TOGGLED_ERROR)) != 0U);
+
+   Lunar_ErrorMgr_SetErrorState(TOGGLED_ERROR, false);
+   RunAndTakeResponses(LUNAR_SUBSCRIPTIONMGR_MIN_INTERVAL_MS + 10U);
+   TEST_CHECK(responses.numResponses[ON_CHANGE_MESSAGE_ID] == 3U);
+   TEST_CHECK((responses.lastData[0] & (1U << (uint32_t)TOGGLED_ERROR)) == 0U);
+
+   RunAndTakeResponses(ON_CHANGE_RUN_MILLISECONDS);
+   TEST_CHECK(responses.numResponses[ON_CHANGE_MESSAGE_ID] == 3U);
+
+   Lunar_SubscriptionMgr_UnsubscribeAll(&serialSource);
+
+   //-----------------------------------------------
+   // Only the creator of a subscription can remove it
+   //-----------------------------------------------
+
+   const Lunar_MessageRouter_MessageSource_t canSource = { LUNAR_MESSAGEROUTER_TRANSPORT_CAN, 0U, 0U, 0U };
+   const Lunar_MessageRouter_MessageSource_t otherChannelSource = { LUNAR_MESSAGEROUTER_TRANSPORT_CAN, 1U, 0U, 0U };
+   const Lunar_MessageRouter_MessageItemHeader_t header = { ERRORMGR_MODULE_ID, ERRORMGR_COMMAND_GET_ALL_ERRORS, 0U };
+   const uint8_t canIndex = Lunar_SubscriptionMgr_Subscribe(&canSource, &header, ON_CHANGE_RUN_MILLISECONDS, 0U, NULL, 0U);
+   uint8_t response[4];
+
+   TEST_CHECK(canIndex != LUNAR_SUBSCRIPTIONMGR_INVALID_INDEX);
+
+   // Another transport or channel cannot remove it
+   TEST_CHECK(!Lunar_SubscriptionMgr_Unsubscribe(&serialSource, canIndex));
+   TEST_CHECK(!Lunar_SubscriptionMgr_Unsubscribe(&otherChannelSource, canIndex));
+   Lunar_SubscriptionMgr_UnsubscribeAll(&serialSource);
+   Lunar_SubscriptionMgr_UnsubscribeAll(&otherChannelSource);
+   TEST_CHECK(GetStatistics(&after) && (after.numSubscriptions == 1U));
+
+   // The Unsubscribe command from the serial port is rejected without a response
+   TEST_CHECK(Test_Harness_SendCommand(SERIAL_CHANNEL, SUBSCRIPTIONMGR_MODULE_ID, SUBSCRIPTIONMGR_COMMAND_UNSUBSCRIBE, &canIndex, sizeof(canIndex),
+                                       response, sizeof(response)) == 0);
+   TEST_CHECK(GetStatistics(&after) && (after.numSubscriptions == 1U));
+
+   // The creator removes it once
+   TEST_CHECK(Lunar_SubscriptionMgr_Unsubscribe(&canSource, canIndex));
+   TEST_CHECK(!Lunar_SubscriptionMgr_Unsubscribe(&canSource, canIndex));
+   TEST_CHECK(GetStatistics(&after) && (after.numSubscriptions == 0U));
+
+   return(Test_Harness_Finish());
+}
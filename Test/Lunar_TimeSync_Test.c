@@ -0,0 +1,255 @@
+/*******************************************************************************
+// Time Synchronization Test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Test_Harness.h"
+// Platform Includes
+#include "Lunar_TimeSync.h"
+#include "Lunar_TimeSync_Config.h"
+#include "Timebase_Drv.h"
+// Other Includes
+#include <stdlib.h> // llabs
+#include <string.h> // memcpy
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// Time between two SYNC frames and between a SYNC frame and its follow-up
+#define SYNC_PERIOD_MILLISECONDS (1000U)
+#define FOLLOWUP_DELAY_MILLISECONDS (1U)
+
+// The drift of the master against the simulated timebase in parts per million
+#define MASTER_DRIFT_PPM (200)
+
+// The largest difference of the synchronized time from the master time
+#define MAX_ERROR_US (20)
+
+// A bad receive timestamp, one tick of the SysTick, and a real jump of the
+// master time
+#define TIMESTAMP_ERROR_US (1000)
+#define MASTER_JUMP_US (1000000)
+
+// The time synchronization in the Message Router and its status command
+#define TIMESYNC_MODULE_ID (0x0FU)
+#define TIMESYNC_COMMAND_GET_STATUS (0x01U)
+
+// Offsets in the status response
+#define STATUS_NUM_RESETS_OFFSET (16U)
+#define STATUS_NUM_REJECTED_OFFSETS_OFFSET (32U)
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The simulated cycles counted so far, without the wrap of the cycle count
+static uint64_t elapsedCycles = 0U;
+static uint32_t lastCycles = 0U;
+
+// The master time at the start of the test
+static int64_t masterStartUs = 0;
+
+// The sequence number of the last SYNC frame
+static uint8_t sequence = 0U;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function returns the master time at a cycle count of this node.
+  *    The master clock runs MASTER_DRIFT_PPM faster than the timebase.
+  * Parameters:
+  *    cycleCount :  A cycle count at or after the last call
+  * Returns:
+  *    int64_t - The master time in microseconds
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static int64_t GetMasterTimeUs(const uint32_t cycleCount);
+
+/** Description:
+  *    This function sends a SYNC frame and its follow-up as the master does
+  *    and runs the firmware until the next SYNC frame is due.
+  * Parameters:
+  *    errorUs :  Added to the master time of the follow-up
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void SendSync(const int64_t errorUs);
+
+/** Description:
+  *    This function returns the difference of the synchronized time from
+  *    the master time.
+  * Returns:
+  *    int64_t - The difference in microseconds
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static int64_t GetErrorUs(void);
+
+/** Description:
+  *    This function reads a counter from the synchronization status.
+  * Parameters:
+  *    offset :  The offset of the counter in the response
+  * Returns:
+  *    uint32_t - The counter, UINT32_MAX if there was no response
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint32_t GetStatusCounter(const uint32_t offset);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Get the master time
+static int64_t GetMasterTimeUs(const uint32_t cycleCount)
+{
+   elapsedCycles += cycleCount - lastCycles;
+   lastCycles = cycleCount;
+
+   const int64_t elapsedUs = (int64_t)(elapsedCycles / (HOST_DRV_CYCLES_PER_SECOND / 1000000U));
+
+   return(masterStartUs + elapsedUs + ((elapsedUs * MASTER_DRIFT_PPM) / 1000000));
+}
+
+// Send a SYNC frame and its follow-up
+static void SendSync(const int64_t errorUs)
+{
+   CAN_Drv_Frame_t frame;
+
+   sequence++;
+
+   // The frame is timestamped when it is received
+   memset(&frame, 0, sizeof(frame));
+   frame.canId = LUNAR_TIMESYNC_SYNC_CANID | CAN_DRV_EXTENDED_ID;
+   frame.length = 1U;
+   frame.data[0] = sequence;
+
+   const uint64_t masterTimeUs = (uint64_t)(GetMasterTimeUs(Timebase_Drv_GetCycleCount()) + errorUs);
+
+   TEST_CHECK(Host_Drv_ReceiveCAN(&frame));
+   Test_Harness_Run(FOLLOWUP_DELAY_MILLISECONDS);
+
+   frame.canId = LUNAR_TIMESYNC_FOLLOWUP_CANID | CAN_DRV_EXTENDED_ID;
+   frame.length = 8U;
+   for (uint32_t i = 0U; i < 7U; i++)
+   {
+      frame.data[1U + i] = (uint8_t)(masterTimeUs >> (8U * i));
+   }
+
+   TEST_CHECK(Host_Drv_ReceiveCAN(&frame));
+   Test_Harness_Run(SYNC_PERIOD_MILLISECONDS - FOLLOWUP_DELAY_MILLISECONDS);
+}
+
+// Get the difference from the master time
+static int64_t GetErrorUs(void)
+{
+   const uint32_t cycleCount = Timebase_Drv_GetCycleCount();
+
+   return((int64_t)Lunar_TimeSync_GetTimeUsAt(cycleCount) - GetMasterTimeUs(cycleCount));
+}
+
+// Read a counter of the synchronization status
+static uint32_t GetStatusCounter(const uint32_t offset)
+{
+   uint8_t response[255];
+   uint32_t counter = UINT32_MAX;
+
+   if (Test_Harness_SendCommand((UART_Drv_Channel_t)0, TIMESYNC_MODULE_ID, TIMESYNC_COMMAND_GET_STATUS, NULL, 0U, response, sizeof(response)) >= (int)(offset + sizeof(counter)))
+   {
+      memcpy(&counter, &response[offset], sizeof(counter));
+   }
+
+   return(counter);
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Test entry point
+int main(void)
+{
+   Test_Harness_Start();
+
+   lastCycles = Timebase_Drv_GetCycleCount();
+   masterStartUs = 12345678;
+
+   //-----------------------------------------------
+   // Synchronization to a drifting master
+   //-----------------------------------------------
+
+   for (uint32_t i = 0U; i < 10U; i++)
+   {
+      SendSync(0);
+   }
+
+   const uint32_t numResets = GetStatusCounter(STATUS_NUM_RESETS_OFFSET);
+
+   TEST_CHECK(Lunar_TimeSync_IsSynchronized());
+   TEST_CHECK(llabs(GetErrorUs()) <= MAX_ERROR_US);
+   TEST_CHECK(GetStatusCounter(STATUS_NUM_REJECTED_OFFSETS_OFFSET) == 0U);
+
+   //-----------------------------------------------
+   // A single bad timestamp is dropped
+   //-----------------------------------------------
+
+   SendSync(TIMESTAMP_ERROR_US);
+   TEST_CHECK(Lunar_TimeSync_IsSynchronized());
+   TEST_CHECK(llabs(GetErrorUs()) <= MAX_ERROR_US);
+   TEST_CHECK(GetStatusCounter(STATUS_NUM_REJECTED_OFFSETS_OFFSET) == 1U);
+
+   SendSync(-TIMESTAMP_ERROR_US);
+   TEST_CHECK(llabs(GetErrorUs()) <= MAX_ERROR_US);
+   TEST_CHECK(GetStatusCounter(STATUS_NUM_REJECTED_OFFSETS_OFFSET) == 2U);
+
+   // The next follow-up is used and the drift correction holds
+   SendSync(0);
+   TEST_CHECK(llabs(GetErrorUs()) <= MAX_ERROR_US);
+   TEST_CHECK(GetStatusCounter(STATUS_NUM_REJECTED_OFFSETS_OFFSET) == 2U);
+   TEST_CHECK(GetStatusCounter(STATUS_NUM_RESETS_OFFSET) == numResets);
+
+   //-----------------------------------------------
+   // A jump of the master time is followed
+   //-----------------------------------------------
+
+   masterStartUs += MASTER_JUMP_US;
+
+   for (uint32_t i = 0U; i < LUNAR_TIMESYNC_MAX_REJECTED_OFFSETS; i++)
+   {
+      SendSync(0);
+      TEST_CHECK(llabs(GetErrorUs() + MASTER_JUMP_US) <= MAX_ERROR_US);
+   }
+
+   SendSync(0);
+   TEST_CHECK(Lunar_TimeSync_IsSynchronized());
+   TEST_CHECK(llabs(GetErrorUs()) <= MAX_ERROR_US);
+   TEST_CHECK(GetStatusCounter(STATUS_NUM_REJECTED_OFFSETS_OFFSET) == (2U + LUNAR_TIMESYNC_MAX_REJECTED_OFFSETS));
+   TEST_CHECK(GetStatusCounter(STATUS_NUM_RESETS_OFFSET) == (numResets + 1U));
+
+   // The drift is measured again from the new master time
+   for (uint32_t i = 0U; i < 3U; i++)
+   {
+      SendSync(0);
+   }
+   TEST_CHECK(llabs(GetErrorUs()) <= MAX_ERROR_US);
+   TEST_CHECK(GetStatusCounter(STATUS_NUM_RESETS_OFFSET) == (numResets + 1U));
+
+   return(Test_Harness_Finish());
+}
@@ -0,0 +1,712 @@
+/*******************************************************************************
+// Node Address Manager Bus Test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Test_Harness.h"
+// Platform Includes
+#include "CAN_Drv_Core.h"
+#include "Lunar_TimeSync.h"
+#include "NodeAddrMgr.h"
+#include "NodeAddrMgr_Config.h"
+#include "ReportMgr_CAN.h"
+#include "ReportMgr_ConfigTable.h"
+#include "Timebase_Drv.h"
+// Other Includes
+#include <string.h> // memset
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The firmware is one node of the bus, the test models the others
+#define NUM_MODEL_NODES (NODEADDRMGR_NUM_NODES - 1U)
+
+// The number of messages in the transmit schedule
+#define NUM_TX_SCHEDULE_ITEMS (sizeof(ReportMgr_txScheduleTable) / sizeof(ReportMgr_TxScheduleItem_t))
+
+// The value of the lowest node ID bit in a CAN identifier
+#define NODE_ID_SCALE (NODEADDRMGR_CANID_NODE_ID_MASK & (~NODEADDRMGR_CANID_NODE_ID_MASK + 1U))
+
+// Flag in the node ID byte of a claim, set when the sender already uses the ID
+#define CLAIMED_FLAG (0x80U)
+
+// The claim identifier without the top byte of the name
+#define CLAIM_CANID_MASK (0xFFFFFF00U)
+
+// The error status frame, repeated every second in the report slot
+#define ERROR_STATUS_CANID (BB_ErrorStatusRSP_CANID | CAN_DRV_EXTENDED_ID)
+#define ERROR_STATUS_REPEAT_MILLISECONDS (1000U)
+
+// The time every node must have claimed its node ID within
+#define CLAIM_SETTLE_MILLISECONDS (3000U)
+
+// Time the reports of all nodes are measured, a multiple of every cycle
+#define MEASURE_MILLISECONDS (5000U)
+
+// The bit rate of the bus and the simulated cycles per bit and millisecond
+#define BUS_BITS_PER_SECOND (500000U)
+#define CYCLES_PER_BIT (HOST_DRV_CYCLES_PER_SECOND / BUS_BITS_PER_SECOND)
+#define CYCLES_PER_MILLISECOND (HOST_DRV_CYCLES_PER_SECOND / 1000U)
+
+// The largest bus load of 64 reporting nodes, in tenths of a percent
+#define MAX_BUS_LOAD (500U)
+
+// The longest time from the start of a report slot until the frame is
+// complete on the bus: the schedule runs in whole milliseconds and the frame
+// may wait for the frames of the nodes in the slots before it
+#define MAX_REPORT_LATENCY_MICROSECONDS (2000U)
+
+// The number of frames the modelled nodes may have waiting for the bus
+#define MAX_PENDING_FRAMES (4U * NODEADDRMGR_NUM_NODES)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// The states of the claim protocol, as in NodeAddrMgr.c
+typedef enum
+{
+   STATE_Holdoff,
+   STATE_Claiming,
+   STATE_Claimed,
+   STATE_NoAddress
+} State_t;
+
+// This structure models the node address and report managers of another node
+typedef struct
+{
+   // The name of the node, the top byte differs between all nodes
+   uint64_t name;
+
+   // The state of the random number generator for the claim delay
+   uint32_t randomState;
+
+   // The claim protocol
+   State_t state;
+   uint32_t stateTime;
+   uint32_t holdoffTime;
+   uint64_t takenNodes;
+   uint8_t candidateId;
+   uint8_t nodeId;
+   bool isClaimPending;
+
+   // Bit i is set while report i of the schedule waits for the bus
+   uint32_t pendingReports;
+} ModelNode_t;
+
+// This structure holds a frame of a modelled node waiting for the bus
+typedef struct
+{
+   CAN_Drv_Frame_t frame;
+
+   // The node that sends the frame
+   uint8_t nodeIndex;
+} PendingFrame_t;
+
+// This structure holds the measurements of the report phase
+typedef struct
+{
+   uint64_t numBits;
+   uint32_t numReports;
+   uint32_t maxLatencyUs;
+   uint32_t maxFirmwareLatencyUs;
+} Measurement_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The modelled nodes
+static ModelNode_t nodes[NUM_MODEL_NODES];
+
+// The frames of the modelled nodes waiting for the bus
+static PendingFrame_t pendingFrames[MAX_PENDING_FRAMES];
+static uint32_t numPendingFrames;
+
+// Cycle count when the bus is idle again, as seen by the test
+static uint32_t busIdleCycles;
+
+// The measurements of the report phase and true while they are taken
+static Measurement_t measurement;
+static bool isMeasuring;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function returns the next value of the xorshift generator of a
+  *    node, as NodeAddrMgr.c does.
+  * Parameters:
+  *    node :  The modelled node
+  * Returns:
+  *    uint32_t - The random value
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint32_t GetRandom(ModelNode_t *const node);
+
+/** Description:
+  *    This function starts the claim of the first free node ID of a node.
+  * Parameters:
+  *    node :         The modelled node
+  *    firstNodeId :  The first node ID to be tried
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void StartClaim(ModelNode_t *const node, const uint8_t firstNodeId);
+
+/** Description:
+  *    This function queues the claim of a node for the bus.
+  * Parameters:
+  *    node :  The modelled node
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void QueueClaim(ModelNode_t *const node);
+
+/** Description:
+  *    This function passes a claim seen on the bus to a node, with the rules
+  *    of NodeAddrMgr_MessageRouter_Claim.
+  * Parameters:
+  *    node :   The modelled node
+  *    claim :  The claim frame
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void HandleClaim(ModelNode_t *const node, const CAN_Drv_Frame_t *const claim);
+
+/** Description:
+  *    This function runs the claim protocol and the report schedule of
+  *    every modelled node for the current millisecond.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void UpdateModelNodes(void);
+
+/** Description:
+  *    This function sends the waiting frames of the modelled nodes that
+  *    start on the bus before the next millisecond, highest priority first.
+  *    Each frame occupies the simulated bus of the firmware, so the frames
+  *    of the firmware wait for it.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void RunModelBus(void);
+
+/** Description:
+  *    This function takes the frames sent by the firmware, passes its claims
+  *    to the modelled nodes and measures its reports.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void TakeFirmwareFrames(void);
+
+/** Description:
+  *    This function counts a frame on the bus and, for a scheduled report,
+  *    the time from the start of its report slot until it was complete.
+  * Parameters:
+  *    frame :           The frame, with the node ID in the identifier
+  *    completeCycles :  Cycle count when the frame was complete on the bus
+  *    isFirmware :      true for a frame of the firmware
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void MeasureFrame(const CAN_Drv_Frame_t *const frame, const uint32_t completeCycles, const bool isFirmware);
+
+/** Description:
+  *    This function finds the data length of a report.
+  * Parameters:
+  *    canId :  The identifier of the report without the node ID
+  * Returns:
+  *    uint8_t - The data length of the DBC message
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint8_t GetReportLength(const uint32_t canId);
+
+/** Description:
+  *    This function returns the synchronized time of the firmware in
+  *    milliseconds, which all nodes follow.
+  * Returns:
+  *    uint32_t - The synchronized time
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint32_t GetSyncTimeMs(void);
+
+/** Description:
+  *    This function runs the bus and every node for a time.
+  * Parameters:
+  *    milliseconds :  The time to run
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void RunBus(const uint32_t milliseconds);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Get the next random value of a node
+static uint32_t GetRandom(ModelNode_t *const node)
+{
+   uint32_t x = node->randomState;
+
+   x ^= x << 13U;
+   x ^= x >> 17U;
+   x ^= x << 5U;
+   node->randomState = x;
+
+   return(x);
+}
+
+// Claim the first free node ID
+static void StartClaim(ModelNode_t *const node, const uint8_t firstNodeId)
+{
+   uint8_t nodeId = firstNodeId;
+   bool isFound = false;
+
+   for (uint32_t i = 0U; (i < NODEADDRMGR_NUM_NODES) && (!isFound); i++)
+   {
+      if ((node->takenNodes & (1ULL << nodeId)) == 0U)
+      {
+         isFound = true;
+      }
+      else
+      {
+         nodeId = (uint8_t)((nodeId + 1U) % NODEADDRMGR_NUM_NODES);
+      }
+   }
+
+   node->stateTime = Timebase_Drv_GetCurrentTickCount();
+   node->isClaimPending = false;
+
+   if (isFound)
+   {
+      node->candidateId = nodeId;
+      node->holdoffTime = GetRandom(node) % ((NODEADDRMGR_CLAIM_HOLDOFF_MS * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND) + 1U);
+      node->state = STATE_Holdoff;
+   }
+   else
+   {
+      node->state = STATE_NoAddress;
+   }
+}
+
+// Queue the claim of a node
+static void QueueClaim(ModelNode_t *const node)
+{
+   if (TEST_CHECK(numPendingFrames < MAX_PENDING_FRAMES))
+   {
+      PendingFrame_t *pending = &pendingFrames[numPendingFrames];
+
+      memset(pending, 0, sizeof(*pending));
+      pending->nodeIndex = (uint8_t)(node - nodes);
+      pending->frame.canId = NODEADDRMGR_CLAIM_CANID | (uint32_t)(node->name >> 56U) | CAN_DRV_EXTENDED_ID;
+      pending->frame.length = 8U;
+      pending->frame.data[0] = node->candidateId | ((node->state == STATE_Claimed) ? CLAIMED_FLAG : 0U);
+      for (uint32_t i = 0U; i < 7U; i++)
+      {
+         pending->frame.data[1U + i] = (uint8_t)(node->name >> (8U * i));
+      }
+      numPendingFrames++;
+   }
+}
+
+// Pass a claim to a node
+static void HandleClaim(ModelNode_t *const node, const CAN_Drv_Frame_t *const claim)
+{
+   uint64_t otherName = (uint64_t)(claim->canId & 0xFFU) << 56U;
+   const uint8_t otherNodeId = claim->data[0] & (uint8_t)~CLAIMED_FLAG;
+   const bool isOtherClaimed = ((claim->data[0] & CLAIMED_FLAG) != 0U);
+
+   for (uint32_t i = 0U; i < 7U; i++)
+   {
+      otherName |= (uint64_t)claim->data[1U + i] << (8U * i);
+   }
+
+   if ((otherName != node->name) && (otherNodeId < NODEADDRMGR_NUM_NODES))
+   {
+      node->takenNodes |= (1ULL << otherNodeId);
+
+      if ((otherNodeId == node->candidateId) && (node->state != STATE_NoAddress))
+      {
+         const bool isClaimed = (node->state == STATE_Claimed);
+
+         // A node using the ID keeps it, otherwise the lower name wins
+         if ((isOtherClaimed && (!isClaimed)) || ((isOtherClaimed == isClaimed) && (otherName < node->name)))
+         {
+            node->nodeId = NODEADDRMGR_NO_NODE;
+            StartClaim(node, (uint8_t)((otherNodeId + 1U) % NODEADDRMGR_NUM_NODES));
+         }
+         else if (node->state != STATE_Holdoff)
+         {
+            node->isClaimPending = true;
+         }
+         else
+         {
+            // The claim is sent after the holdoff
+         }
+      }
+   }
+}
+
+// Run the claim protocol and the report schedule of the modelled nodes
+static void UpdateModelNodes(void)
+{
+   const uint32_t currentTime = Timebase_Drv_GetCurrentTickCount();
+   const uint32_t syncTime = GetSyncTimeMs();
+
+   for (uint32_t index = 0U; index < NUM_MODEL_NODES; index++)
+   {
+      ModelNode_t *node = &nodes[index];
+      const uint32_t elapsedTime = currentTime - node->stateTime;
+
+      if ((node->state == STATE_Holdoff) && (elapsedTime >= node->holdoffTime))
+      {
+         QueueClaim(node);
+         node->stateTime = currentTime;
+         node->state = STATE_Claiming;
+      }
+      else if ((node->state == STATE_Claiming) && (elapsedTime >= (NODEADDRMGR_CLAIM_TIMEOUT_MS * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND)))
+      {
+         node->nodeId = node->candidateId;
+         node->state = STATE_Claimed;
+      }
+      else if ((node->state == STATE_NoAddress) && (elapsedTime >= (NODEADDRMGR_RETRY_TIME_MS * TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND)))
+      {
+         node->takenNodes = 0U;
+         StartClaim(node, (uint8_t)(node->name % NODEADDRMGR_NUM_NODES));
+      }
+      else
+      {
+         // Nothing changes this millisecond
+      }
+
+      if (node->isClaimPending)
+      {
+         QueueClaim(node);
+         node->isClaimPending = false;
+      }
+
+      // The reports start in the slot of the node ID, a report still waiting
+      // for the bus is not queued twice
+      if ((node->nodeId != NODEADDRMGR_NO_NODE) && TEST_CHECK((numPendingFrames + NUM_TX_SCHEDULE_ITEMS + 1U) <= MAX_PENDING_FRAMES))
+      {
+         for (uint32_t i = 0U; i <= NUM_TX_SCHEDULE_ITEMS; i++)
+         {
+            const bool isErrorStatus = (i == NUM_TX_SCHEDULE_ITEMS);
+            const uint32_t canId = isErrorStatus ? ERROR_STATUS_CANID : ReportMgr_txScheduleTable[i].canId;
+            const uint32_t cycleTime = isErrorStatus ? ERROR_STATUS_REPEAT_MILLISECONDS : ReportMgr_txScheduleTable[i].cycleTimeMs;
+            const uint32_t phaseOffset = isErrorStatus ? 0U : ReportMgr_txScheduleTable[i].phaseOffsetMs;
+            const uint32_t slotOffset = ((uint32_t)node->nodeId * cycleTime) / NODEADDRMGR_NUM_NODES;
+
+            if ((((syncTime - phaseOffset - slotOffset) % cycleTime) == 0U) && ((node->pendingReports & (1UL << i)) == 0U))
+            {
+               PendingFrame_t *pending = &pendingFrames[numPendingFrames];
+
+               memset(pending, 0, sizeof(*pending));
+               pending->nodeIndex = (uint8_t)index;
+               pending->frame.canId = (canId & ~NODEADDRMGR_CANID_NODE_ID_MASK) | ((uint32_t)node->nodeId * NODE_ID_SCALE);
+               pending->frame.length = GetReportLength(canId);
+               node->pendingReports |= (1UL << i);
+               numPendingFrames++;
+            }
+         }
+      }
+   }
+}
+
+// Send the frames of the modelled nodes
+static void RunModelBus(void)
+{
+   const uint32_t currentCycles = Timebase_Drv_GetCycleCount();
+   bool isBusFree = true;
+
+   if ((int32_t)(busIdleCycles - currentCycles) < 0)
+   {
+      busIdleCycles = currentCycles;
+   }
+
+   while ((numPendingFrames > 0U) && isBusFree)
+   {
+      uint32_t best = 0U;
+
+      for (uint32_t i = 1U; i < numPendingFrames; i++)
+      {
+         if (CAN_Drv_Core_GetPriorityKey(pendingFrames[i].frame.canId) < CAN_Drv_Core_GetPriorityKey(pendingFrames[best].frame.canId))
+         {
+            best = i;
+         }
+      }
+
+      isBusFree = ((busIdleCycles - currentCycles) < CYCLES_PER_MILLISECOND);
+      if (isBusFree)
+      {
+         const PendingFrame_t pending = pendingFrames[best];
+         ModelNode_t *sender = &nodes[pending.nodeIndex];
+
+         pendingFrames[best] = pendingFrames[numPendingFrames - 1U];
+         numPendingFrames--;
+
+         busIdleCycles += CAN_Drv_Core_GetFrameBits(pending.frame.canId, pending.frame.length) * CYCLES_PER_BIT;
+         (void)Host_Drv_ReceiveCAN(&pending.frame);
+         MeasureFrame(&pending.frame, busIdleCycles, false);
+
+         if ((pending.frame.canId & CLAIM_CANID_MASK) == (NODEADDRMGR_CLAIM_CANID | CAN_DRV_EXTENDED_ID))
+         {
+            // Every other node sees the claim
+            for (uint32_t index = 0U; index < NUM_MODEL_NODES; index++)
+            {
+               if (index != pending.nodeIndex)
+               {
+                  HandleClaim(&nodes[index], &pending.frame);
+               }
+            }
+         }
+         else
+         {
+            for (uint32_t i = 0U; i <= NUM_TX_SCHEDULE_ITEMS; i++)
+            {
+               const uint32_t canId = (i == NUM_TX_SCHEDULE_ITEMS) ? ERROR_STATUS_CANID : ReportMgr_txScheduleTable[i].canId;
+
+               if ((pending.frame.canId & ~NODEADDRMGR_CANID_NODE_ID_MASK) == canId)
+               {
+                  sender->pendingReports &= ~(1UL << i);
+               }
+            }
+         }
+      }
+   }
+}
+
+// Take the frames of the firmware
+static void TakeFirmwareFrames(void)
+{
+   CAN_Drv_Frame_t frame;
+
+   while (Host_Drv_TakeCANOutput(&frame))
+   {
+      if ((int32_t)(frame.timestamp - busIdleCycles) > 0)
+      {
+         busIdleCycles = frame.timestamp;
+      }
+
+      MeasureFrame(&frame, frame.timestamp, true);
+
+      if ((frame.canId & CLAIM_CANID_MASK) == (NODEADDRMGR_CLAIM_CANID | CAN_DRV_EXTENDED_ID))
+      {
+         for (uint32_t index = 0U; index < NUM_MODEL_NODES; index++)
+         {
+            HandleClaim(&nodes[index], &frame);
+         }
+      }
+   }
+}
+
+// Measure a frame on the bus
+static void MeasureFrame(const CAN_Drv_Frame_t *const frame, const uint32_t completeCycles, const bool isFirmware)
+{
+   if (isMeasuring)
+   {
+      const uint32_t nodeId = (frame->canId & NODEADDRMGR_CANID_NODE_ID_MASK) / NODE_ID_SCALE;
+
+      measurement.numBits += CAN_Drv_Core_GetFrameBits(frame->canId, frame->length);
+
+      for (uint32_t i = 0U; i < NUM_TX_SCHEDULE_ITEMS; i++)
+      {
+         const ReportMgr_TxScheduleItem_t *const item = &ReportMgr_txScheduleTable[i];
+
+         if ((frame->canId & ~NODEADDRMGR_CANID_NODE_ID_MASK) == item->canId)
+         {
+            // The synchronized time when the frame was complete
+            const uint64_t completeUs = Lunar_TimeSync_GetTimeUsAt(completeCycles);
+            const uint64_t slotUs = (uint64_t)(item->phaseOffsetMs + ((nodeId * item->cycleTimeMs) / NODEADDRMGR_NUM_NODES)) * 1000U;
+            const uint32_t latencyUs = (uint32_t)((completeUs + ((uint64_t)item->cycleTimeMs * 1000U) - slotUs) % ((uint64_t)item->cycleTimeMs * 1000U));
+
+            measurement.numReports++;
+            measurement.maxLatencyUs = (latencyUs > measurement.maxLatencyUs) ? latencyUs : measurement.maxLatencyUs;
+            if (isFirmware)
+            {
+               measurement.maxFirmwareLatencyUs = (latencyUs > measurement.maxFirmwareLatencyUs) ? latencyUs : measurement.maxFirmwareLatencyUs;
+            }
+         }
+      }
+   }
+}
+
+// Find the data length of a report
+static uint8_t GetReportLength(const uint32_t canId)
+{
+   uint8_t length = 8U;
+
+   switch (canId & ~CAN_DRV_EXTENDED_ID)
+   {
+      case BB_BatteryStatusRSP_CANID: length = BB_BatteryStatusRSP_DLC; break;
+      case BB_DCDCStatusRSP_CANID: length = BB_DCDCStatusRSP_DLC; break;
+      case BB_CellVoltage1to4RSP_CANID: length = BB_CellVoltage1to4RSP_DLC; break;
+      case BB_CellVoltage5to8RSP_CANID: length = BB_CellVoltage5to8RSP_DLC; break;
+      case BB_CellVoltage9to12RSP_CANID: length = BB_CellVoltage9to12RSP_DLC; break;
+      case BB_CellTempRSP_CANID: length = BB_CellTempRSP_DLC; break;
+      case BB_DCDCTemperaturesRSP_CANID: length = BB_DCDCTemperaturesRSP_DLC; break;
+      case BB_ErrorStatusRSP_CANID: length = BB_ErrorStatusRSP_DLC; break;
+      default: TEST_CHECK(false); break;
+   }
+
+   return(length);
+}
+
+// Get the synchronized time in milliseconds
+static uint32_t GetSyncTimeMs(void)
+{
+   return((uint32_t)(Lunar_TimeSync_GetTimeUs() / 1000U));
+}
+
+// Run the bus and the nodes
+static void RunBus(const uint32_t milliseconds)
+{
+   for (uint32_t elapsed = 0U; elapsed < milliseconds; elapsed++)
+   {
+      Test_Harness_Run(1U);
+      TakeFirmwareFrames();
+      UpdateModelNodes();
+      RunModelBus();
+   }
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Test entry point
+int main(void)
+{
+   uint8_t firmwareStatus[20];
+   uint64_t firmwareName = 0U;
+   uint64_t nameState = 0x9E3779B97F4A7C15ULL;
+   uint32_t nextTopByte = 0U;
+   Lunar_MessageRouter_Message_t message;
+
+   Test_Harness_Start();
+
+   // The name of the firmware node, the modelled nodes must not share its top byte
+   memset(&message, 0, sizeof(message));
+   message.responseParams.data = firmwareStatus;
+   message.responseParams.maxLength = sizeof(firmwareStatus);
+   NodeAddrMgr_MessageRouter_GetStatus(&message);
+   if (TEST_CHECK(message.responseParams.length == sizeof(firmwareStatus)))
+   {
+      memcpy(&firmwareName, firmwareStatus, sizeof(firmwareName));
+   }
+
+   // Every node starts at the same time with a random name
+   for (uint32_t index = 0U; index < NUM_MODEL_NODES; index++)
+   {
+      ModelNode_t *node = &nodes[index];
+
+      if (nextTopByte == (uint32_t)(firmwareName >> 56U))
+      {
+         nextTopByte++;
+      }
+
+      nameState ^= nameState << 13U;
+      nameState ^= nameState >> 7U;
+      nameState ^= nameState << 17U;
+
+      memset(node, 0, sizeof(*node));
+      node->name = ((uint64_t)nextTopByte << 56U) | (nameState & 0x00FFFFFFFFFFFFFFULL);
+      node->randomState = (uint32_t)nameState | 1U;
+      node->nodeId = NODEADDRMGR_NO_NODE;
+      StartClaim(node, (uint8_t)(node->name % NODEADDRMGR_NUM_NODES));
+
+      // Spread the top bytes over the range, so the order of the names is mixed
+      nextTopByte += 3U;
+   }
+
+   //-----------------------------------------------
+   // Every node claims a different node ID
+   //-----------------------------------------------
+
+   RunBus(CLAIM_SETTLE_MILLISECONDS);
+
+   uint64_t usedNodeIds = 0U;
+   uint32_t numClaimed = 0U;
+
+   if (TEST_CHECK(NodeAddrMgr_GetNodeId() < NODEADDRMGR_NUM_NODES))
+   {
+      usedNodeIds |= (1ULL << NodeAddrMgr_GetNodeId());
+      numClaimed++;
+   }
+
+   for (uint32_t index = 0U; index < NUM_MODEL_NODES; index++)
+   {
+      if (TEST_CHECK((nodes[index].state == STATE_Claimed) && (nodes[index].nodeId < NODEADDRMGR_NUM_NODES)) &&
+          TEST_CHECK((usedNodeIds & (1ULL << nodes[index].nodeId)) == 0U))
+      {
+         usedNodeIds |= (1ULL << nodes[index].nodeId);
+         numClaimed++;
+      }
+   }
+   TEST_CHECK(numClaimed == NODEADDRMGR_NUM_NODES);
+
+   //-----------------------------------------------
+   // Bus load and report latency of all nodes
+   //-----------------------------------------------
+
+   // The expected load from the schedule: every node sends each report once
+   // per cycle and repeats the error status every second
+   uint64_t expectedBits = (uint64_t)CAN_Drv_Core_GetFrameBits(ERROR_STATUS_CANID, BB_ErrorStatusRSP_DLC) * (MEASURE_MILLISECONDS / ERROR_STATUS_REPEAT_MILLISECONDS);
+
+   for (uint32_t i = 0U; i < NUM_TX_SCHEDULE_ITEMS; i++)
+   {
+      expectedBits += (uint64_t)CAN_Drv_Core_GetFrameBits(ReportMgr_txScheduleTable[i].canId, GetReportLength(ReportMgr_txScheduleTable[i].canId)) *
+                      (MEASURE_MILLISECONDS / ReportMgr_txScheduleTable[i].cycleTimeMs);
+   }
+   expectedBits *= NODEADDRMGR_NUM_NODES;
+
+   memset(&measurement, 0, sizeof(measurement));
+   isMeasuring = true;
+   RunBus(MEASURE_MILLISECONDS);
+   isMeasuring = false;
+
+   const uint32_t busLoad = (uint32_t)((measurement.numBits * 1000U) / ((uint64_t)BUS_BITS_PER_SECOND * (MEASURE_MILLISECONDS / 1000U)));
+   const uint32_t expectedBusLoad = (uint32_t)((expectedBits * 1000U) / ((uint64_t)BUS_BITS_PER_SECOND * (MEASURE_MILLISECONDS / 1000U)));
+
+   printf("%u nodes: bus load %u.%u%% (schedule %u.%u%%), %u reports, worst report latency %u us (firmware node %u us)\n",
+          (unsigned)NODEADDRMGR_NUM_NODES, (unsigned)(busLoad / 10U), (unsigned)(busLoad % 10U),
+          (unsigned)(expectedBusLoad / 10U), (unsigned)(expectedBusLoad % 10U), (unsigned)measurement.numReports,
+          (unsigned)measurement.maxLatencyUs, (unsigned)measurement.maxFirmwareLatencyUs);
+
+   // Frames of the cycles cut at the start and end of the measurement
+   // change the load by less than 0.2%
+   TEST_CHECK((busLoad + 2U) >= expectedBusLoad);
+   TEST_CHECK(busLoad <= (expectedBusLoad + 2U));
+   TEST_CHECK(busLoad <= MAX_BUS_LOAD);
+   TEST_CHECK(measurement.maxLatencyUs <= MAX_REPORT_LATENCY_MICROSECONDS);
+   TEST_CHECK(measurement.maxFirmwareLatencyUs <= MAX_REPORT_LATENCY_MICROSECONDS);
+
+   return(Test_Harness_Finish());
+}
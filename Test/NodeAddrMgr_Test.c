@@ -0,0 +1,436 @@
+/*******************************************************************************
+// Node Address Manager Test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Test_Harness.h"
+// Platform Includes
+#include "Lunar_TimeSync.h"
+#include "NodeAddrMgr.h"
+#include "NodeAddrMgr_Config.h"
+#include "ReportMgr_CAN.h"
+#include "ReportMgr_ConfigTable.h"
+#include "Timebase_Drv.h"
+// Other Includes
+#include <string.h> // memset
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The number of messages in the transmit schedule
+#define NUM_TX_SCHEDULE_ITEMS (sizeof(ReportMgr_txScheduleTable) / sizeof(ReportMgr_TxScheduleItem_t))
+
+// The value of the lowest node ID bit in a CAN identifier
+#define NODE_ID_SCALE (NODEADDRMGR_CANID_NODE_ID_MASK & (~NODEADDRMGR_CANID_NODE_ID_MASK + 1U))
+
+// Flag in the node ID byte of a claim, set when the sender already uses the ID
+#define CLAIMED_FLAG (0x80U)
+
+// The claim identifier without the top byte of the name
+#define CLAIM_CANID_MASK (0xFFFFFF00U)
+
+// The error status frame, sent on changes and repeated every second
+#define ERROR_STATUS_CANID (BB_ErrorStatusRSP_CANID | CAN_DRV_EXTENDED_ID)
+
+// The node address manager in the Message Router and its status command
+#define NODEADDRMGR_MODULE_ID (0x0EU)
+#define NODEADDRMGR_COMMAND_GET_STATUS (0x01U)
+
+// Offsets in the status response
+#define STATUS_NAME_OFFSET (0U)
+#define STATUS_NUM_CLAIMS_LOST_OFFSET (12U)
+#define STATUS_NUM_CLAIMS_REJECTED_OFFSET (14U)
+#define STATUS_NODE_ID_OFFSET (16U)
+#define STATUS_CANDIDATE_ID_OFFSET (17U)
+#define STATUS_LENGTH (20U)
+
+// The time a claim is sent within, the holdoff and one NodeAddrMgr_Update
+// period
+#define MAX_CLAIM_DELAY_MILLISECONDS (NODEADDRMGR_CLAIM_HOLDOFF_MS + 10U)
+
+// The time a claimed node ID is used within, after the claim timeout
+#define MAX_CLAIMED_DELAY_MILLISECONDS (10U)
+
+// Time the report slots are measured
+#define MEASURE_MILLISECONDS (3000U)
+
+// The largest delay of a report after the start of its slot, two
+// ReportMgr_Update periods
+#define MAX_SLOT_DELAY_MILLISECONDS (2U)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// This structure holds the parts of the status response the test uses
+typedef struct
+{
+   uint64_t name;
+   uint16_t numClaimsLost;
+   uint16_t numClaimsRejected;
+   uint8_t nodeId;
+   uint8_t candidateId;
+} NodeStatus_t;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function reads the status of the node address manager over the
+  *    serial port.
+  * Parameters:
+  *    nodeStatus :  Filled with the status
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void GetNodeStatus(NodeStatus_t *const nodeStatus);
+
+/** Description:
+  *    This function sends the claim of another node.
+  * Parameters:
+  *    name :     The name of the other node
+  *    nodeId :   The claimed node ID, with CLAIMED_FLAG if the other node
+  *               already uses it
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void SendClaim(const uint64_t name, const uint8_t nodeId);
+
+/** Description:
+  *    This function runs the firmware until it sends a claim, and checks
+  *    that no report is sent meanwhile unless the node uses a node ID.
+  * Parameters:
+  *    maxMilliseconds :  The longest time to wait
+  *    isReporting :      true if the node uses a node ID and reports
+  *    claim :            Filled with the claim frame
+  * Returns:
+  *    uint32_t - The milliseconds waited, more than maxMilliseconds if no
+  *               claim was sent
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint32_t WaitForClaim(const uint32_t maxMilliseconds, const bool isReporting, CAN_Drv_Frame_t *const claim);
+
+/** Description:
+  *    This function checks a claim frame sent by the node.
+  * Parameters:
+  *    claim :   The claim frame
+  *    name :    The name of the node
+  *    nodeId :  The expected node ID byte
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void CheckClaim(const CAN_Drv_Frame_t *const claim, const uint64_t name, const uint8_t nodeId);
+
+/** Description:
+  *    This function runs the firmware through the claim timeout and checks
+  *    that the node reports only once the node ID is claimed.
+  * Parameters:
+  *    nodeId :  The claimed node ID
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void CheckClaimTimeout(const uint8_t nodeId);
+
+/** Description:
+  *    This function checks that every report carries the node ID and is
+  *    sent in the report slot of the node ID.
+  * Parameters:
+  *    nodeId :  The claimed node ID
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void CheckReportSlots(const uint8_t nodeId);
+
+/** Description:
+  *    This function tells if a frame is a report.
+  * Parameters:
+  *    canId :  The identifier of the frame
+  * Returns:
+  *    bool - true for a scheduled message or the error status
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool IsReport(const uint32_t canId);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Read the status over the serial port
+static void GetNodeStatus(NodeStatus_t *const nodeStatus)
+{
+   uint8_t response[STATUS_LENGTH];
+
+   memset(response, 0, sizeof(response));
+   TEST_CHECK(Test_Harness_SendCommand((UART_Drv_Channel_t)0, NODEADDRMGR_MODULE_ID, NODEADDRMGR_COMMAND_GET_STATUS, NULL, 0U, response, sizeof(response)) == (int)STATUS_LENGTH);
+
+   memcpy(&nodeStatus->name, &response[STATUS_NAME_OFFSET], sizeof(nodeStatus->name));
+   memcpy(&nodeStatus->numClaimsLost, &response[STATUS_NUM_CLAIMS_LOST_OFFSET], sizeof(nodeStatus->numClaimsLost));
+   memcpy(&nodeStatus->numClaimsRejected, &response[STATUS_NUM_CLAIMS_REJECTED_OFFSET], sizeof(nodeStatus->numClaimsRejected));
+   nodeStatus->nodeId = response[STATUS_NODE_ID_OFFSET];
+   nodeStatus->candidateId = response[STATUS_CANDIDATE_ID_OFFSET];
+}
+
+// Send the claim of another node
+static void SendClaim(const uint64_t name, const uint8_t nodeId)
+{
+   CAN_Drv_Frame_t frame;
+
+   memset(&frame, 0, sizeof(frame));
+   frame.canId = NODEADDRMGR_CLAIM_CANID | (uint32_t)(name >> 56U) | CAN_DRV_EXTENDED_ID;
+   frame.length = 8U;
+   frame.data[0] = nodeId;
+   for (uint32_t i = 0U; i < 7U; i++)
+   {
+      frame.data[1U + i] = (uint8_t)(name >> (8U * i));
+   }
+
+   TEST_CHECK(Host_Drv_ReceiveCAN(&frame));
+}
+
+// Wait for a claim of the node
+static uint32_t WaitForClaim(const uint32_t maxMilliseconds, const bool isReporting, CAN_Drv_Frame_t *const claim)
+{
+   CAN_Drv_Frame_t frame;
+   uint32_t elapsed = 0U;
+   bool isFound = false;
+
+   while ((!isFound) && (elapsed <= maxMilliseconds))
+   {
+      Test_Harness_Run(1U);
+      elapsed++;
+
+      while (Host_Drv_TakeCANOutput(&frame))
+      {
+         TEST_CHECK(isReporting || (!IsReport(frame.canId)));
+
+         if ((!isFound) && ((frame.canId & CLAIM_CANID_MASK) == (NODEADDRMGR_CLAIM_CANID | CAN_DRV_EXTENDED_ID)))
+         {
+            *claim = frame;
+            isFound = true;
+         }
+      }
+   }
+
+   return(elapsed);
+}
+
+// Check a claim of the node
+static void CheckClaim(const CAN_Drv_Frame_t *const claim, const uint64_t name, const uint8_t nodeId)
+{
+   // The top byte of the name is in the identifier, the others in the data
+   TEST_CHECK(claim->canId == (NODEADDRMGR_CLAIM_CANID | (uint32_t)(name >> 56U) | CAN_DRV_EXTENDED_ID));
+   TEST_CHECK(claim->length == 8U);
+   TEST_CHECK(claim->data[0] == nodeId);
+
+   for (uint32_t i = 0U; i < 7U; i++)
+   {
+      TEST_CHECK(claim->data[1U + i] == (uint8_t)(name >> (8U * i)));
+   }
+}
+
+// Run through the claim timeout
+static void CheckClaimTimeout(const uint8_t nodeId)
+{
+   CAN_Drv_Frame_t frame;
+   uint32_t elapsed = 0U;
+
+   // The claim was sent in the last millisecond, nothing is reported until
+   // the timeout
+   while (elapsed < (NODEADDRMGR_CLAIM_TIMEOUT_MS - 1U))
+   {
+      Test_Harness_Run(1U);
+      elapsed++;
+
+      while (Host_Drv_TakeCANOutput(&frame))
+      {
+         TEST_CHECK(!IsReport(frame.canId));
+      }
+   }
+
+   TEST_CHECK(NodeAddrMgr_GetNodeId() == NODEADDRMGR_NO_NODE);
+
+   while ((NodeAddrMgr_GetNodeId() == NODEADDRMGR_NO_NODE) && (elapsed < (NODEADDRMGR_CLAIM_TIMEOUT_MS + MAX_CLAIMED_DELAY_MILLISECONDS)))
+   {
+      Test_Harness_Run(1U);
+      elapsed++;
+   }
+
+   TEST_CHECK(NodeAddrMgr_GetNodeId() == nodeId);
+}
+
+// Check the report slots of a node ID
+static void CheckReportSlots(const uint8_t nodeId)
+{
+   CAN_Drv_Frame_t frame;
+   uint32_t numFrames[NUM_TX_SCHEDULE_ITEMS];
+   uint32_t maxDelay = 0U;
+
+   memset(numFrames, 0, sizeof(numFrames));
+
+   for (uint32_t elapsed = 0U; elapsed < MEASURE_MILLISECONDS; elapsed++)
+   {
+      Test_Harness_Run(1U);
+
+      // The schedule counts the synchronized time in whole milliseconds
+      const uint32_t syncTime = (uint32_t)(Lunar_TimeSync_GetTimeUs() / 1000U);
+      const uint32_t currentTime = Timebase_Drv_GetCurrentTickCount() / TIMEBASE_DRV_NUM_TICKS_PER_MILLISECOND;
+
+      while (Host_Drv_TakeCANOutput(&frame))
+      {
+         // Frames left from the status command are taken late
+         const uint32_t frameTime = syncTime - (currentTime - (frame.timestamp / (HOST_DRV_CYCLES_PER_SECOND / 1000U)));
+
+         if (IsReport(frame.canId))
+         {
+            TEST_CHECK((frame.canId & NODEADDRMGR_CANID_NODE_ID_MASK) == ((uint32_t)nodeId * NODE_ID_SCALE));
+         }
+
+         for (uint32_t i = 0U; i < NUM_TX_SCHEDULE_ITEMS; i++)
+         {
+            const ReportMgr_TxScheduleItem_t *const item = &ReportMgr_txScheduleTable[i];
+
+            if ((frame.canId & ~NODEADDRMGR_CANID_NODE_ID_MASK) == item->canId)
+            {
+               // The slot of each node ID is its share of the cycle
+               const uint32_t slotOffset = ((uint32_t)nodeId * item->cycleTimeMs) / NODEADDRMGR_NUM_NODES;
+               const uint32_t delay = (frameTime - item->phaseOffsetMs - slotOffset) % item->cycleTimeMs;
+
+               maxDelay = (delay > maxDelay) ? delay : maxDelay;
+               numFrames[i]++;
+            }
+         }
+      }
+   }
+
+   printf("Node ID %u: reports at most %u ms after the start of their slot\n", (unsigned)nodeId, (unsigned)maxDelay);
+   TEST_CHECK(maxDelay <= MAX_SLOT_DELAY_MILLISECONDS);
+
+   for (uint32_t i = 0U; i < NUM_TX_SCHEDULE_ITEMS; i++)
+   {
+      TEST_CHECK((numFrames[i] + 1U) >= (MEASURE_MILLISECONDS / ReportMgr_txScheduleTable[i].cycleTimeMs));
+   }
+}
+
+// Tell if a frame is a report
+static bool IsReport(const uint32_t canId)
+{
+   bool isReport = ((canId & ~NODEADDRMGR_CANID_NODE_ID_MASK) == ERROR_STATUS_CANID);
+
+   for (uint32_t i = 0U; i < NUM_TX_SCHEDULE_ITEMS; i++)
+   {
+      isReport = isReport || ((canId & ~NODEADDRMGR_CANID_NODE_ID_MASK) == ReportMgr_txScheduleTable[i].canId);
+   }
+
+   return(isReport);
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Test entry point
+int main(void)
+{
+   CAN_Drv_Frame_t claim;
+   NodeStatus_t nodeStatus;
+
+   Test_Harness_Start();
+   TEST_CHECK(NodeAddrMgr_GetNodeId() == NODEADDRMGR_NO_NODE);
+
+   //-----------------------------------------------
+   // The first claim is sent after the holdoff
+   //-----------------------------------------------
+
+   TEST_CHECK(WaitForClaim(MAX_CLAIM_DELAY_MILLISECONDS, false, &claim) <= MAX_CLAIM_DELAY_MILLISECONDS);
+
+   GetNodeStatus(&nodeStatus);
+   const uint64_t name = nodeStatus.name;
+   const uint8_t firstNodeId = (uint8_t)(name % NODEADDRMGR_NUM_NODES);
+
+   TEST_CHECK(nodeStatus.candidateId == firstNodeId);
+   TEST_CHECK(nodeStatus.nodeId == NODEADDRMGR_NO_NODE);
+   CheckClaim(&claim, name, firstNodeId);
+
+   //-----------------------------------------------
+   // A lower name wins the node ID, the node claims the next one
+   //-----------------------------------------------
+
+   SendClaim(name - 1U, firstNodeId);
+   TEST_CHECK(WaitForClaim(MAX_CLAIM_DELAY_MILLISECONDS, false, &claim) <= MAX_CLAIM_DELAY_MILLISECONDS);
+
+   const uint8_t secondNodeId = (uint8_t)((firstNodeId + 1U) % NODEADDRMGR_NUM_NODES);
+
+   CheckClaim(&claim, name, secondNodeId);
+   CheckClaimTimeout(secondNodeId);
+
+   GetNodeStatus(&nodeStatus);
+   TEST_CHECK(nodeStatus.numClaimsLost == 1U);
+   TEST_CHECK(nodeStatus.nodeId == secondNodeId);
+
+   //-----------------------------------------------
+   // The reports carry the node ID and use its slots
+   //-----------------------------------------------
+
+   CheckReportSlots(secondNodeId);
+
+   //-----------------------------------------------
+   // A node using the ID keeps it against a new claim
+   //-----------------------------------------------
+
+   SendClaim(name - 1U, secondNodeId);
+   TEST_CHECK(WaitForClaim(MAX_CLAIM_DELAY_MILLISECONDS, true, &claim) <= MAX_CLAIM_DELAY_MILLISECONDS);
+   CheckClaim(&claim, name, secondNodeId | CLAIMED_FLAG);
+
+   GetNodeStatus(&nodeStatus);
+   TEST_CHECK(nodeStatus.numClaimsRejected == 1U);
+   TEST_CHECK(nodeStatus.numClaimsLost == 1U);
+   TEST_CHECK(nodeStatus.nodeId == secondNodeId);
+
+   //-----------------------------------------------
+   // Between two nodes using the ID the lower name keeps it
+   //-----------------------------------------------
+
+   SendClaim(name - 1U, secondNodeId | CLAIMED_FLAG);
+   Test_Harness_Run(1U);
+   TEST_CHECK(NodeAddrMgr_GetNodeId() == NODEADDRMGR_NO_NODE);
+
+   while (Host_Drv_TakeCANOutput(&claim))
+   {
+      // Drop the reports sent before the claim was received
+   }
+
+   TEST_CHECK(WaitForClaim(MAX_CLAIM_DELAY_MILLISECONDS, false, &claim) <= MAX_CLAIM_DELAY_MILLISECONDS);
+
+   const uint8_t thirdNodeId = (uint8_t)((secondNodeId + 1U) % NODEADDRMGR_NUM_NODES);
+
+   CheckClaim(&claim, name, thirdNodeId);
+   CheckClaimTimeout(thirdNodeId);
+
+   GetNodeStatus(&nodeStatus);
+   TEST_CHECK(nodeStatus.numClaimsLost == 2U);
+
+   // The schedule moves to the slots of the new node ID
+   CheckReportSlots(thirdNodeId);
+
+   return(Test_Harness_Finish());
+}
@@ -0,0 +1,368 @@
+/*******************************************************************************
+// Power Calculation Test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Test_Harness.h"
+// Platform Includes
+#include "ADC_Drv_Config.h"
+#include "Lunar_MathLib.h"
+#include "PowerCalc.h"
+#include "PowerCalc_ConfigTable.h"
+#include "Timebase_Drv.h"
+// Other Includes
+#include <math.h> // sin
+#include <stdlib.h> // rand
+#include <string.h> // memcpy
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// Timeline of the test, the grid frequency changes and the grid is lost
+#define HIGH_FREQUENCY_START_MILLISECONDS (4000U)
+#define NO_GRID_START_MILLISECONDS (8000U)
+#define RUN_MILLISECONDS (9000U)
+
+// The scheduler is stalled for more than a buffer once
+#define STALL_START_MILLISECONDS (2000U)
+#define STALL_MILLISECONDS (25U)
+
+// Results are not checked this long after the start and after a change of
+// the waveform, the cycle in progress holds both
+#define SETTLE_MILLISECONDS (100U)
+
+// The replayed waveform covers the whole test, so it does not repeat
+#define NUM_SCANS ((RUN_MILLISECONDS * ADC_DRV_SAMPLE_RATE_HZ) / 1000U)
+
+// The grid frequencies
+#define LOW_FREQUENCY_HZ (50.0)
+#define HIGH_FREQUENCY_HZ (59.93)
+
+// The grid: L2-N is opposite to L1-N, the currents lag the voltages
+#define L1N_VOLTAGE_RMS (240.0)
+#define L2N_VOLTAGE_RMS (239.0)
+#define L1_CURRENT_RMS (25.0)
+#define L2_CURRENT_RMS (24.0)
+#define CURRENT_PHASE_RADIANS (M_PI / 6.0)
+
+// The bus
+#define POSBUS_VOLTAGE (390.0)
+#define NEGBUS_VOLTAGE (385.0)
+#define BUS_CURRENT (12.3)
+
+// The noise added to the L1 signals, in counts either way
+#define NOISE_COUNTS (2)
+
+// The largest errors of the results.  A cycle sums whole samples but is
+// divided by the interpolated period, so one sample at each end is counted or
+// missed.  The voltages are near zero there, but the lagging currents are
+// not, so the currents and the apparent powers are only within about 0.2%.
+// The real powers are relative to the apparent power.  The bus values are
+// averaged over the cycle, so they are within one count.
+#define MAX_VOLTAGE_ERROR_PERCENT (0.1)
+#define MAX_CURRENT_ERROR_PERCENT (0.25)
+#define MAX_REAL_POWER_ERROR_PERCENT (0.15)
+#define MAX_APPARENT_POWER_ERROR_PERCENT (0.25)
+#define MAX_FREQUENCY_ERROR_HZ (0.05)
+
+// The number of random values the square root is checked with
+#define NUM_SQRT_VALUES (100000U)
+
+// The power calculation in the Message Router and its results command
+#define POWERCALC_MODULE_ID (0x11U)
+#define POWERCALC_COMMAND_GET_RESULTS (0x01U)
+
+// Offset of the gap count in the results response
+#define RESULTS_NUM_GAPS_OFFSET (sizeof(PowerCalc_Results_t))
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// This structure holds the largest errors seen
+typedef struct
+{
+   double voltagePercent;
+   double currentPercent;
+   double realPowerPercent;
+   double apparentPowerPercent;
+   double frequencyHz;
+   double busCounts;
+} Errors_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// The replayed waveform
+static uint16_t waveform[NUM_SCANS * (uint32_t)ADC_DRV_CHANNEL_Count];
+
+// The largest errors seen
+static Errors_t errors;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function converts a signal to an ADC result with the offset and
+  *    scale of its channel.
+  * Parameters:
+  *    channel :  The channel
+  *    value :    The signal, V or A
+  * Returns:
+  *    uint16_t - The 12-bit result
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint16_t Convert(const ADC_Drv_Channel_t channel, const double value);
+
+/** Description:
+  *    This function makes the waveform of the whole test.  The phase of the
+  *    grid is kept over the change of the frequency.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void GenerateWaveform(void);
+
+/** Description:
+  *    This function records the error of a result.
+  * Parameters:
+  *    maxError :  The largest error, updated
+  *    error :     The error of the result
+  * Returns:
+  *    double - The error
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static double Record(double *const maxError, const double error);
+
+/** Description:
+  *    This function checks the results of a cycle against the signals of the
+  *    waveform.
+  * Parameters:
+  *    results :     The results of the cycle
+  *    frequency :   The grid frequency, 0 without a grid
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void CheckResults(const PowerCalc_Results_t *const results, const double frequency);
+
+/** Description:
+  *    This function checks the integer square root against its definition.
+  * Parameters:
+  *    value :  The value
+  * Returns:
+  *    bool - true if the root is the largest integer whose square is not
+  *           above the value
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool IsSqrtCorrect(const uint64_t value);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Convert a signal to an ADC result
+static uint16_t Convert(const ADC_Drv_Channel_t channel, const double value)
+{
+   const PowerCalc_ChannelConfigItem_t *const config = &powerCalcChannelConfigTable[channel];
+   double result = floor((double)config->offset + ((value * 1000000.0) / (double)config->scale) + 0.5);
+
+   result = (result < 0.0) ? 0.0 : result;
+   result = (result > 4095.0) ? 4095.0 : result;
+
+   return((uint16_t)result);
+}
+
+// Make the waveform
+static void GenerateWaveform(void)
+{
+   double phase = 0.0;
+
+   for (uint32_t scan = 0U; scan < NUM_SCANS; scan++)
+   {
+      const uint32_t scanTime = (scan * 1000U) / ADC_DRV_SAMPLE_RATE_HZ;
+      const double frequency = (scanTime < HIGH_FREQUENCY_START_MILLISECONDS) ? LOW_FREQUENCY_HZ : HIGH_FREQUENCY_HZ;
+      const double grid = (scanTime < NO_GRID_START_MILLISECONDS) ? sqrt(2.0) : 0.0;
+      uint16_t *const samples = &waveform[scan * (uint32_t)ADC_DRV_CHANNEL_Count];
+
+      samples[ADC_DRV_CHANNEL_L1N_Voltage] = (uint16_t)(Convert(ADC_DRV_CHANNEL_L1N_Voltage, grid * L1N_VOLTAGE_RMS * sin(phase)) + ((rand() % ((2 * NOISE_COUNTS) + 1)) - NOISE_COUNTS));
+      samples[ADC_DRV_CHANNEL_L2N_Voltage] = Convert(ADC_DRV_CHANNEL_L2N_Voltage, -grid * L2N_VOLTAGE_RMS * sin(phase));
+      samples[ADC_DRV_CHANNEL_L1_Current] = (uint16_t)(Convert(ADC_DRV_CHANNEL_L1_Current, grid * L1_CURRENT_RMS * sin(phase - CURRENT_PHASE_RADIANS)) + ((rand() % ((2 * NOISE_COUNTS) + 1)) - NOISE_COUNTS));
+      samples[ADC_DRV_CHANNEL_L2_Current] = Convert(ADC_DRV_CHANNEL_L2_Current, -grid * L2_CURRENT_RMS * sin(phase - CURRENT_PHASE_RADIANS));
+      samples[ADC_DRV_CHANNEL_PosBus_Voltage] = Convert(ADC_DRV_CHANNEL_PosBus_Voltage, POSBUS_VOLTAGE);
+      samples[ADC_DRV_CHANNEL_NegBus_Voltage] = Convert(ADC_DRV_CHANNEL_NegBus_Voltage, NEGBUS_VOLTAGE);
+      samples[ADC_DRV_CHANNEL_Bus_Current] = Convert(ADC_DRV_CHANNEL_Bus_Current, BUS_CURRENT);
+
+      phase = fmod(phase + ((2.0 * M_PI * frequency) / (double)ADC_DRV_SAMPLE_RATE_HZ), 2.0 * M_PI);
+   }
+}
+
+// Record the error of a result
+static double Record(double *const maxError, const double error)
+{
+   const double absoluteError = fabs(error);
+
+   *maxError = (absoluteError > *maxError) ? absoluteError : *maxError;
+
+   return(absoluteError);
+}
+
+// Check the results of a cycle
+static void CheckResults(const PowerCalc_Results_t *const results, const double frequency)
+{
+   const double cosine = cos(CURRENT_PHASE_RADIANS);
+
+   if (frequency > 0.0)
+   {
+      // The errors are relative to the values of the grid
+      TEST_CHECK(Record(&errors.voltagePercent, ((results->l1nVoltageRms / 1000.0) - L1N_VOLTAGE_RMS) * 100.0 / L1N_VOLTAGE_RMS) <= MAX_VOLTAGE_ERROR_PERCENT);
+      TEST_CHECK(Record(&errors.voltagePercent, ((results->l2nVoltageRms / 1000.0) - L2N_VOLTAGE_RMS) * 100.0 / L2N_VOLTAGE_RMS) <= MAX_VOLTAGE_ERROR_PERCENT);
+      TEST_CHECK(Record(&errors.voltagePercent, ((results->l1l2VoltageRms / 1000.0) - (L1N_VOLTAGE_RMS + L2N_VOLTAGE_RMS)) * 100.0 / (L1N_VOLTAGE_RMS + L2N_VOLTAGE_RMS)) <= MAX_VOLTAGE_ERROR_PERCENT);
+
+      TEST_CHECK(Record(&errors.currentPercent, ((results->l1CurrentRms / 1000.0) - L1_CURRENT_RMS) * 100.0 / L1_CURRENT_RMS) <= MAX_CURRENT_ERROR_PERCENT);
+      TEST_CHECK(Record(&errors.currentPercent, ((results->l2CurrentRms / 1000.0) - L2_CURRENT_RMS) * 100.0 / L2_CURRENT_RMS) <= MAX_CURRENT_ERROR_PERCENT);
+      TEST_CHECK(Record(&errors.currentPercent, ((results->l1l2CurrentRms / 1000.0) - ((L1_CURRENT_RMS + L2_CURRENT_RMS) / 2.0)) * 200.0 / (L1_CURRENT_RMS + L2_CURRENT_RMS)) <= MAX_CURRENT_ERROR_PERCENT);
+
+      TEST_CHECK(Record(&errors.realPowerPercent, ((results->l1RealPower / 1000.0) - (L1N_VOLTAGE_RMS * L1_CURRENT_RMS * cosine)) * 100.0 / (L1N_VOLTAGE_RMS * L1_CURRENT_RMS)) <= MAX_REAL_POWER_ERROR_PERCENT);
+      TEST_CHECK(Record(&errors.realPowerPercent, ((results->l2RealPower / 1000.0) - (L2N_VOLTAGE_RMS * L2_CURRENT_RMS * cosine)) * 100.0 / (L2N_VOLTAGE_RMS * L2_CURRENT_RMS)) <= MAX_REAL_POWER_ERROR_PERCENT);
+      TEST_CHECK(Record(&errors.apparentPowerPercent, ((results->l1ApparentPower / 1000.0) - (L1N_VOLTAGE_RMS * L1_CURRENT_RMS)) * 100.0 / (L1N_VOLTAGE_RMS * L1_CURRENT_RMS)) <= MAX_APPARENT_POWER_ERROR_PERCENT);
+      TEST_CHECK(Record(&errors.apparentPowerPercent, ((results->l2ApparentPower / 1000.0) - (L2N_VOLTAGE_RMS * L2_CURRENT_RMS)) * 100.0 / (L2N_VOLTAGE_RMS * L2_CURRENT_RMS)) <= MAX_APPARENT_POWER_ERROR_PERCENT);
+
+      TEST_CHECK(Record(&errors.frequencyHz, (results->frequency / 1000.0) - frequency) <= MAX_FREQUENCY_ERROR_HZ);
+   }
+   else
+   {
+      // Without a grid the values are taken over a window, the AC signals
+      // are the noise of L1
+      TEST_CHECK(results->frequency == 0U);
+      TEST_CHECK(results->l2nVoltageRms == 0U);
+      TEST_CHECK((results->l1nVoltageRms / 1000.0) <= ((NOISE_COUNTS * powerCalcChannelConfigTable[ADC_DRV_CHANNEL_L1N_Voltage].scale) / 1000000.0));
+   }
+
+   TEST_CHECK(Record(&errors.busCounts, ((results->posBusVoltage / 1000.0) - POSBUS_VOLTAGE) * 1000000.0 / powerCalcChannelConfigTable[ADC_DRV_CHANNEL_PosBus_Voltage].scale) <= 1.0);
+   TEST_CHECK(Record(&errors.busCounts, ((results->negBusVoltage / 1000.0) - NEGBUS_VOLTAGE) * 1000000.0 / powerCalcChannelConfigTable[ADC_DRV_CHANNEL_NegBus_Voltage].scale) <= 1.0);
+   TEST_CHECK(Record(&errors.busCounts, ((results->busCurrent / 1000.0) - BUS_CURRENT) * 1000000.0 / powerCalcChannelConfigTable[ADC_DRV_CHANNEL_Bus_Current].scale) <= 1.0);
+}
+
+// Check the square root of a value
+static bool IsSqrtCorrect(const uint64_t value)
+{
+   const uint64_t root = Lunar_MathLib_SqrtUint64(value);
+
+   // The square of the next integer is above every 64-bit value once the
+   // root is the largest 32-bit value
+   return(((root * root) <= value) && ((root == UINT32_MAX) || (((root + 1U) * (root + 1U)) > value)));
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Test entry point
+int main(void)
+{
+   PowerCalc_Results_t results;
+   uint8_t response[sizeof(PowerCalc_Results_t) + sizeof(uint32_t)];
+   uint32_t numGaps = 0U;
+   uint32_t lastNumCycles = 0U;
+   uint32_t numChecked = 0U;
+
+   //-----------------------------------------------
+   // The square root is rounded down for every value
+   //-----------------------------------------------
+
+   TEST_CHECK(Lunar_MathLib_SqrtUint64(0U) == 0U);
+   TEST_CHECK(Lunar_MathLib_SqrtUint64(UINT64_MAX) == UINT32_MAX);
+   srand(1U);
+
+   for (uint32_t i = 0U; i < NUM_SQRT_VALUES; i++)
+   {
+      uint64_t value = 0U;
+
+      for (uint32_t j = 0U; j < 4U; j++)
+      {
+         value = (value << 16U) | (uint64_t)(rand() & 0xFFFF);
+      }
+
+      // Values of every magnitude, and each side of a square
+      value >>= (uint32_t)(rand() % 64);
+      const uint64_t square = (value >> 32U) * (value >> 32U);
+
+      TEST_CHECK(IsSqrtCorrect(value));
+      TEST_CHECK(IsSqrtCorrect(square));
+      TEST_CHECK(IsSqrtCorrect(square - 1U));
+   }
+
+   //-----------------------------------------------
+   // The results of each cycle match the grid
+   //-----------------------------------------------
+
+   GenerateWaveform();
+   Host_Drv_ReplayADC(waveform, NUM_SCANS);
+   Test_Harness_Start();
+
+   for (uint32_t elapsed = 0U; elapsed < RUN_MILLISECONDS; elapsed++)
+   {
+      if (elapsed == STALL_START_MILLISECONDS)
+      {
+         // The time passes without the scheduled functions, a buffer is missed
+         for (uint32_t i = 0U; i < STALL_MILLISECONDS; i++)
+         {
+            Host_Drv_AdvanceTime(1000U);
+         }
+
+         elapsed += STALL_MILLISECONDS;
+      }
+
+      Test_Harness_Run(1U);
+      PowerCalc_GetResults(&results);
+
+      const bool isSettled = ((elapsed >= SETTLE_MILLISECONDS) &&
+                              ((elapsed < HIGH_FREQUENCY_START_MILLISECONDS) || (elapsed >= (HIGH_FREQUENCY_START_MILLISECONDS + SETTLE_MILLISECONDS))) &&
+                              ((elapsed < NO_GRID_START_MILLISECONDS) || (elapsed >= (NO_GRID_START_MILLISECONDS + SETTLE_MILLISECONDS))));
+
+      if ((results.numCycles != lastNumCycles) && (isSettled))
+      {
+         const double frequency = (elapsed < HIGH_FREQUENCY_START_MILLISECONDS) ? LOW_FREQUENCY_HZ :
+                                  (elapsed < NO_GRID_START_MILLISECONDS) ? HIGH_FREQUENCY_HZ : 0.0;
+
+         CheckResults(&results, frequency);
+         numChecked++;
+      }
+
+      lastNumCycles = results.numCycles;
+   }
+
+   printf("%u cycles checked, largest errors: voltage %.4f%%, current %.4f%%, real power %.4f%%, apparent power %.4f%%, frequency %.4f Hz, bus %.2f counts\n",
+          (unsigned)numChecked, errors.voltagePercent, errors.currentPercent, errors.realPowerPercent, errors.apparentPowerPercent, errors.frequencyHz, errors.busCounts);
+
+   // Every grid cycle and every window without a grid is checked, except
+   // around the changes of the waveform
+   TEST_CHECK(numChecked >= (uint32_t)(((HIGH_FREQUENCY_START_MILLISECONDS - (2U * SETTLE_MILLISECONDS) - STALL_MILLISECONDS) * LOW_FREQUENCY_HZ) / 1000.0));
+
+   // The cycle with the missed buffer was dropped
+   TEST_CHECK(Test_Harness_SendCommand((UART_Drv_Channel_t)0, POWERCALC_MODULE_ID, POWERCALC_COMMAND_GET_RESULTS, NULL, 0U, response, sizeof(response)) == (int)sizeof(response));
+   memcpy(&numGaps, &response[RESULTS_NUM_GAPS_OFFSET], sizeof(numGaps));
+   TEST_CHECK(numGaps == 1U);
+
+   return(Test_Harness_Finish());
+}
@@ -0,0 +1,250 @@
+/*******************************************************************************
+// Report Manager Transmit Schedule Test
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Test_Harness.h"
+// Platform Includes
+#include "ReportMgr_CAN.h"
+#include "ReportMgr_ConfigTable.h"
+// Other Includes
+#include <string.h> // memset
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// The number of messages in the transmit schedule
+#define NUM_TX_SCHEDULE_ITEMS (sizeof(ReportMgr_txScheduleTable) / sizeof(ReportMgr_TxScheduleItem_t))
+
+// Identifier bits that carry the node ID of a battery block or optimizer
+#define NODE_ID_MASK (0x3FUL << 17)
+
+// The error status frames, repeated every second
+#define INV_ERROR_STATUS_CANID (INV_ErrorStatusRSP_CANID | CAN_DRV_EXTENDED_ID)
+#define BB_ERROR_STATUS_CANID (BB_ErrorStatusRSP_CANID | CAN_DRV_EXTENDED_ID)
+
+// Time for the node to start reporting, a node ID is claimed first where
+// the board uses one
+#define STARTUP_MILLISECONDS (2000U)
+
+// Time the schedule is measured
+#define MEASURE_MILLISECONDS (10000U)
+
+// The largest deviation of the time between two frames of a message from
+// its cycle, two ReportMgr_Update periods
+#define MAX_JITTER_MILLISECONDS (10U)
+
+// Time the scheduler is stalled, several cycles of the fastest message
+#define STALL_MILLISECONDS (350U)
+
+// The bit rate of the bus and the largest share of it the reports may use
+#define BUS_BITS_PER_SECOND (500000U)
+#define MAX_BUS_LOAD_PERCENT (2U)
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// This structure holds what was seen of one scheduled message
+typedef struct
+{
+   uint32_t numFrames;
+   uint32_t lastTime;
+   uint32_t minGap;
+   uint32_t maxGap;
+} Seen_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+// What was seen of each scheduled message
+static Seen_t seen[NUM_TX_SCHEDULE_ITEMS];
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function returns the index of a frame in the transmit schedule.
+  * Parameters:
+  *    canId :  The identifier of the frame
+  * Returns:
+  *    uint32_t - The index, NUM_TX_SCHEDULE_ITEMS if it is not scheduled
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint32_t FindScheduleItem(const uint32_t canId);
+
+/** Description:
+  *    This function returns the worst case number of bits of an extended
+  *    frame on the bus, with every possible stuff bit.
+  * Parameters:
+  *    length :  The number of data bytes
+  * Returns:
+  *    uint32_t - The number of bits, interframe space included
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static uint32_t GetFrameBits(const uint8_t length);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Find a frame in the transmit schedule
+static uint32_t FindScheduleItem(const uint32_t canId)
+{
+   uint32_t index = 0U;
+
+   while ((index < NUM_TX_SCHEDULE_ITEMS) && ((canId & ~NODE_ID_MASK) != ReportMgr_txScheduleTable[index].canId))
+   {
+      index++;
+   }
+
+   return(index);
+}
+
+// Get the worst case bits of an extended frame
+static uint32_t GetFrameBits(const uint8_t length)
+{
+   // 54 bits from the start of frame to the CRC can be stuffed, then the
+   // CRC delimiter, acknowledge, end of frame and interframe space
+   const uint32_t stuffedBits = 54U + (8U * (uint32_t)length);
+
+   return(stuffedBits + ((stuffedBits - 1U) / 4U) + 13U);
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Test entry point
+int main(void)
+{
+   CAN_Drv_Frame_t frame;
+   uint32_t expectedFramesPerSecond = 0U;
+   uint32_t numReportFrames = 0U;
+   uint32_t numReportBits = 0U;
+
+   Test_Harness_Start();
+   Test_Harness_Run(STARTUP_MILLISECONDS);
+
+   while (Host_Drv_TakeCANOutput(&frame))
+   {
+      // Drop the frames sent while starting
+   }
+
+   //-----------------------------------------------
+   // Every message is sent once per cycle
+   //-----------------------------------------------
+
+   memset(seen, 0, sizeof(seen));
+
+   for (uint32_t elapsed = 0U; elapsed < MEASURE_MILLISECONDS; elapsed++)
+   {
+      Test_Harness_Run(1U);
+
+      while (Host_Drv_TakeCANOutput(&frame))
+      {
+         const uint32_t index = FindScheduleItem(frame.canId);
+         const uint32_t frameTime = frame.timestamp / (HOST_DRV_CYCLES_PER_SECOND / 1000U);
+
+         if (index < NUM_TX_SCHEDULE_ITEMS)
+         {
+            Seen_t *const item = &seen[index];
+            const uint32_t gap = frameTime - item->lastTime;
+
+            if (item->numFrames == 0U)
+            {
+               item->minGap = UINT32_MAX;
+            }
+            else
+            {
+               item->minGap = (gap < item->minGap) ? gap : item->minGap;
+               item->maxGap = (gap > item->maxGap) ? gap : item->maxGap;
+            }
+
+            item->lastTime = frameTime;
+            item->numFrames++;
+         }
+
+         if ((index < NUM_TX_SCHEDULE_ITEMS) ||
+             ((frame.canId & ~NODE_ID_MASK) == INV_ERROR_STATUS_CANID) || ((frame.canId & ~NODE_ID_MASK) == BB_ERROR_STATUS_CANID))
+         {
+            numReportFrames++;
+            numReportBits += GetFrameBits(frame.length);
+         }
+      }
+   }
+
+   for (uint32_t i = 0U; i < NUM_TX_SCHEDULE_ITEMS; i++)
+   {
+      const uint32_t cycleTime = ReportMgr_txScheduleTable[i].cycleTimeMs;
+
+      expectedFramesPerSecond += 1000U / cycleTime;
+
+      TEST_CHECK((seen[i].numFrames + 1U) >= (MEASURE_MILLISECONDS / cycleTime));
+      TEST_CHECK(seen[i].numFrames <= ((MEASURE_MILLISECONDS / cycleTime) + 1U));
+      TEST_CHECK((seen[i].minGap + MAX_JITTER_MILLISECONDS) >= cycleTime);
+      TEST_CHECK(seen[i].maxGap <= (cycleTime + MAX_JITTER_MILLISECONDS));
+   }
+
+   // The scheduled messages and the repeated error status
+   const uint32_t framesPerSecond = (numReportFrames * 1000U) / MEASURE_MILLISECONDS;
+   const uint32_t bitsPerSecond = (numReportBits * 1000U) / MEASURE_MILLISECONDS;
+
+   printf("%u report frames/s, %u.%02u%% of %u bit/s\n", (unsigned)framesPerSecond,
+          (unsigned)((bitsPerSecond * 100U) / BUS_BITS_PER_SECOND), (unsigned)(((bitsPerSecond * 10000U) / BUS_BITS_PER_SECOND) % 100U),
+          (unsigned)BUS_BITS_PER_SECOND);
+   TEST_CHECK((framesPerSecond >= expectedFramesPerSecond) && (framesPerSecond <= (expectedFramesPerSecond + 1U)));
+   TEST_CHECK((bitsPerSecond * 100U) <= (BUS_BITS_PER_SECOND * MAX_BUS_LOAD_PERCENT));
+
+   //-----------------------------------------------
+   // Missed frames are not sent in a burst
+   //-----------------------------------------------
+
+   // The time passes without the scheduled functions
+   for (uint32_t i = 0U; i < STALL_MILLISECONDS; i++)
+   {
+      Host_Drv_AdvanceTime(1000U);
+   }
+
+   memset(seen, 0, sizeof(seen));
+
+   // Within less than the fastest cycle each message is sent at most once
+   for (uint32_t elapsed = 0U; elapsed < (ReportMgr_txScheduleTable[0].cycleTimeMs - MAX_JITTER_MILLISECONDS); elapsed++)
+   {
+      Test_Harness_Run(1U);
+
+      while (Host_Drv_TakeCANOutput(&frame))
+      {
+         const uint32_t index = FindScheduleItem(frame.canId);
+
+         if (index < NUM_TX_SCHEDULE_ITEMS)
+         {
+            seen[index].numFrames++;
+         }
+      }
+   }
+
+   for (uint32_t i = 0U; i < NUM_TX_SCHEDULE_ITEMS; i++)
+   {
+      TEST_CHECK(seen[i].numFrames <= 1U);
+   }
+
+   return(Test_Harness_Finish());
+}
@@ -0,0 +1,314 @@
+/*******************************************************************************
+// Host Test Harness
+*******************************************************************************/
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+#include "Test_Harness.h"
+// Platform Includes
+#include "Lunar_InitMgr.h"
+#include "Lunar_SoftTimerLib.h"
+// Other Includes
+#include "Lunar_Scheduler_ConfigTable.h"
+#include <stdlib.h> // EXIT_SUCCESS
+
+
+/*******************************************************************************
+// Private Constant Definitions
+*******************************************************************************/
+
+// Number of scheduled functions in the board table
+#define NUM_SCHEDULED_FUNCTIONS (sizeof(schedulerConfigTable) / sizeof(Lunar_Scheduler_ConfigItem_t))
+
+// Length of a simulated step of the scheduler
+#define STEP_MICROSECONDS (1000U)
+
+// Time to wait for the response to a command
+#define RESPONSE_TIMEOUT_MILLISECONDS (200U)
+
+// Serial protocol framing
+#define COMMAND_START_BYTE ('<')
+#define RESPONSE_START_BYTE ('>')
+#define RESPONSE_STOP_BYTE ('\r')
+
+// Module ID, Command ID, Message ID and length
+#define HEADER_SIZE (4U)
+
+// Largest frame of the serial protocol, in ASCII-coded hex
+#define MAX_FRAME_SIZE (2U + (2U * (HEADER_SIZE + 255U)))
+
+
+/*******************************************************************************
+// Private Type Declarations
+*******************************************************************************/
+
+// Structure for the status of the harness
+typedef struct
+{
+   // A timer for each scheduled function, as the scheduler keeps them
+   Lunar_SoftTimerLib_Timer_t schedulerItemTimer[NUM_SCHEDULED_FUNCTIONS];
+   // The message ID of the next command, so responses can be matched
+   uint8_t nextMessageId;
+   // Number of checks run and failed
+   uint32_t numChecks;
+   uint32_t numFailedChecks;
+} Status_t;
+
+
+/*******************************************************************************
+// Private Variable Definitions
+*******************************************************************************/
+
+static Status_t status;
+
+
+/*******************************************************************************
+// Private Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function converts a byte to two ASCII-coded hex characters.
+  * Parameters:
+  *    destination :  Buffer for the two characters
+  *    value :        The byte to be converted
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static void EncodeByte(uint8_t *const destination, const uint8_t value);
+
+/** Description:
+  *    This function converts two ASCII-coded hex characters to a byte.
+  * Parameters:
+  *    source :  The two characters
+  *    value :   Destination for the byte
+  * Returns:
+  *    bool - false if a character is not a hex digit
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+static bool DecodeByte(const uint8_t *const source, uint8_t *const value);
+
+
+/*******************************************************************************
+// Private Function Implementations
+*******************************************************************************/
+
+// Convert a byte to ASCII-coded hex
+static void EncodeByte(uint8_t *const destination, const uint8_t value)
+{
+   static const char hexDigits[] = "0123456789ABCDEF";
+
+   destination[0] = (uint8_t)hexDigits[value >> 4];
+   destination[1] = (uint8_t)hexDigits[value & 0x0FU];
+}
+
+// Convert ASCII-coded hex to a byte
+static bool DecodeByte(const uint8_t *const source, uint8_t *const value)
+{
+   bool isValid = true;
+   uint8_t result = 0U;
+
+   for (uint8_t i = 0U; i < 2U; i++)
+   {
+      const uint8_t character = source[i];
+      uint8_t nibble = 0U;
+
+      if ((character >= '0') && (character <= '9'))
+      {
+         nibble = (uint8_t)(character - '0');
+      }
+      else if ((character >= 'A') && (character <= 'F'))
+      {
+         nibble = (uint8_t)(character - 'A' + 10);
+      }
+      else if ((character >= 'a') && (character <= 'f'))
+      {
+         nibble = (uint8_t)(character - 'a' + 10);
+      }
+      else
+      {
+         isValid = false;
+      }
+
+      result = (uint8_t)((result << 4) | nibble);
+   }
+
+   *value = result;
+
+   return(isValid);
+}
+
+
+/*******************************************************************************
+// Public Function Implementations
+*******************************************************************************/
+
+// Start the firmware
+void Test_Harness_Start(void)
+{
+   // Initialize every module of the board
+   Lunar_InitMgr_Execute();
+
+   // Start the scheduled functions, as the scheduler does when it is executed
+   for (uint32_t i = 0U; i < NUM_SCHEDULED_FUNCTIONS; i++)
+   {
+      Lunar_SoftTimerLib_Init(&status.schedulerItemTimer[i]);
+      Lunar_SoftTimerLib_StartTimer(&status.schedulerItemTimer[i],
+                                    ((uint32_t)schedulerConfigTable[i].intervalSeconds * 1000U) + (uint32_t)schedulerConfigTable[i].intervalMilliseconds);
+   }
+}
+
+// Run the firmware for the given time
+void Test_Harness_Run(const uint32_t milliseconds)
+{
+   for (uint32_t step = 0U; step < milliseconds; step++)
+   {
+      Host_Drv_AdvanceTime(STEP_MICROSECONDS);
+
+      // Call the expired functions in table order, like one pass of the
+      // scheduler loop
+      for (uint32_t i = 0U; i < NUM_SCHEDULED_FUNCTIONS; i++)
+      {
+         if (Lunar_SoftTimerLib_IsTimerExpired(&status.schedulerItemTimer[i]))
+         {
+            Lunar_SoftTimerLib_StartTimer(&status.schedulerItemTimer[i],
+                                          ((uint32_t)schedulerConfigTable[i].intervalSeconds * 1000U) + (uint32_t)schedulerConfigTable[i].intervalMilliseconds);
+            schedulerConfigTable[i].scheduledFunction();
+         }
+      }
+   }
+}
+
+// Send a command and wait for the response
+int Test_Harness_SendCommand(const UART_Drv_Channel_t channel, const uint8_t moduleId, const uint8_t commandId,
+                             const uint8_t *const params, const uint8_t paramsLength,
+                             uint8_t *const response, const uint8_t maxResponseLength)
+{
+   int result = -1;
+   uint8_t frame[MAX_FRAME_SIZE];
+   uint32_t frameLength = 0U;
+   const uint8_t messageId = status.nextMessageId++;
+   const uint8_t header[HEADER_SIZE] = { moduleId, commandId, messageId, paramsLength };
+
+   // Discard anything the firmware sent before
+   while (Host_Drv_TakeUARTOutput(channel, frame, sizeof(frame)) > 0U)
+   {
+      // Keep taking
+   }
+
+   // Build the command
+   frame[frameLength++] = (uint8_t)COMMAND_START_BYTE;
+
+   for (uint32_t i = 0U; i < HEADER_SIZE; i++)
+   {
+      EncodeByte(&frame[frameLength], header[i]);
+      frameLength += 2U;
+   }
+
+   for (uint32_t i = 0U; i < paramsLength; i++)
+   {
+      EncodeByte(&frame[frameLength], params[i]);
+      frameLength += 2U;
+   }
+
+   frame[frameLength++] = '\r';
+   frame[frameLength++] = '\n';
+
+   (void)Host_Drv_ReceiveUART(channel, frame, frameLength);
+
+   // Collect the output until the response to this command is complete
+   frameLength = 0U;
+
+   for (uint32_t elapsed = 0U; (result < 0) && (elapsed < RESPONSE_TIMEOUT_MILLISECONDS); elapsed++)
+   {
+      Test_Harness_Run(1U);
+
+      uint8_t byte = 0U;
+
+      while ((result < 0) && (Host_Drv_TakeUARTOutput(channel, &byte, 1U) == 1U))
+      {
+         if (byte == (uint8_t)RESPONSE_START_BYTE)
+         {
+            frameLength = 0U;
+            frame[frameLength++] = byte;
+         }
+         else if ((byte == (uint8_t)RESPONSE_STOP_BYTE) && (frameLength > 0U))
+         {
+            uint8_t responseHeader[HEADER_SIZE];
+            bool isValid = (frameLength >= (1U + (2U * HEADER_SIZE)));
+
+            for (uint32_t i = 0U; isValid && (i < HEADER_SIZE); i++)
+            {
+               isValid = DecodeByte(&frame[1U + (2U * i)], &responseHeader[i]);
+            }
+
+            // Only the response to this command is accepted
+            isValid = isValid && (responseHeader[0] == moduleId) && (responseHeader[1] == commandId) &&
+                      (responseHeader[2] == messageId) &&
+                      (frameLength == (1U + (2U * (HEADER_SIZE + (uint32_t)responseHeader[3]))));
+
+            if (isValid)
+            {
+               const uint8_t *const data = &frame[1U + (2U * HEADER_SIZE)];
+
+               for (uint32_t i = 0U; isValid && (i < responseHeader[3]); i++)
+               {
+                  uint8_t value = 0U;
+
+                  isValid = DecodeByte(&data[2U * i], &value);
+
+                  if (i < maxResponseLength)
+                  {
+                     response[i] = value;
+                  }
+               }
+
+               if (isValid)
+               {
+                  result = (int)responseHeader[3];
+               }
+            }
+
+            frameLength = 0U;
+         }
+         else if ((frameLength > 0U) && (frameLength < sizeof(frame)))
+         {
+            frame[frameLength++] = byte;
+         }
+         else
+         {
+            // Not part of a response
+            frameLength = 0U;
+         }
+      }
+   }
+
+   return(result);
+}
+
+// Record the result of a check
+bool Test_Harness_Check(const bool condition, const char *const text, const char *const file, const int line)
+{
+   status.numChecks++;
+
+   if (!condition)
+   {
+      status.numFailedChecks++;
+      printf("%s:%d: check failed: %s\n", file, line, text);
+   }
+
+   return(condition);
+}
+
+// Report the result of the test
+int Test_Harness_Finish(void)
+{
+   printf("%u checks, %u failed\n", (unsigned)status.numChecks, (unsigned)status.numFailedChecks);
+
+   return((status.numFailedChecks == 0U) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,119 @@
+/*******************************************************************************
+// Host Test Harness
+*******************************************************************************/
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+// Includes
+*******************************************************************************/
+
+// Module Includes
+// Platform Includes
+#include "Host_Drv.h"
+// Other Includes
+#include <stdbool.h> // Boolean types
+#include <stdint.h> // Integer types
+#include <stdio.h> // printf
+
+
+/*******************************************************************************
+// Public Constant Definitions
+*******************************************************************************/
+
+// Checks a condition and reports the file and line when it does not hold.
+// The test continues, so one run reports every failed check.
+#define TEST_CHECK(condition) Test_Harness_Check((condition), #condition, __FILE__, __LINE__)
+
+
+/*******************************************************************************
+// Public Type Declarations
+*******************************************************************************/
+
+
+/*******************************************************************************
+// Public Function Declarations
+*******************************************************************************/
+
+/** Description:
+  *    This function starts the firmware like a reset of the device.  All
+  *    modules of the board are initialized through the init table and the
+  *    scheduled functions start over.  The simulated flash keeps its
+  *    contents, so calling it again simulates a restart.
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Test_Harness_Start(void);
+
+/** Description:
+  *    This function runs the firmware for a simulated time.  The time is
+  *    advanced in 1 ms steps and the scheduled functions of the board are
+  *    called at their configured intervals, as the scheduler would.
+  * Parameters:
+  *    milliseconds :  The time to run
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+void Test_Harness_Run(const uint32_t milliseconds);
+
+/** Description:
+  *    This function sends a Message Router command on a serial port in the
+  *    ASCII-coded hex format, runs the firmware until the response arrived
+  *    and decodes it.  The serial protocol has no response code, a command
+  *    that was rejected is answered with no response parameters.
+  * Parameters:
+  *    channel :         The UART the command is sent on
+  *    moduleId :        The module of the command
+  *    commandId :       The command
+  *    params :          The command parameters, may be NULL if paramsLength is 0
+  *    paramsLength :    The number of command parameter bytes
+  *    response :        Buffer for the response parameters
+  *    maxResponseLength : The size of response
+  * Returns:
+  *    int - The number of response parameter bytes, -1 if no response with
+  *          the header of the command arrived
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+int Test_Harness_SendCommand(const UART_Drv_Channel_t channel, const uint8_t moduleId, const uint8_t commandId,
+                             const uint8_t *const params, const uint8_t paramsLength,
+                             uint8_t *const response, const uint8_t maxResponseLength);
+
+/** Description:
+  *    This function records the result of a check.  Use the TEST_CHECK macro.
+  * Parameters:
+  *    condition :  The result of the check
+  *    text :       The checked expression
+  *    file :       The source file of the check
+  *    line :       The source line of the check
+  * Returns:
+  *    bool - The condition
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+bool Test_Harness_Check(const bool condition, const char *const text, const char *const file, const int line);
+
+/** Description:
+  *    This function prints the number of failed checks.
+  * Returns:
+  *    int - The exit code for the test, EXIT_SUCCESS if every check passed
+  * History:
+  *    * 10/19/2026: Function created (EJH)
+  *
+*/
+int Test_Harness_Finish(void);
+
+
+#ifdef __cplusplus
+extern "C"
+}
+#endif
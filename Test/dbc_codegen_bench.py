@@ -0,0 +1,292 @@
+#!/usr/bin/env python3
+"""Benchmark the code generated by DBC/dbc_codegen.py on the host.
+
+Every message of DBC/Lunar_CAN_Messages.dbc is filled from physical values
+and packed with the generated pack function.  The scaled signals are
+converted in three ways: with the double-precision macros the generator
+replaced, (type)((x - offset) / factor), with the generated single-precision
+_toS functions and with the generated integer _toS_Milli functions.
+
+The generated pack and unpack functions are also timed on their own, against
+copying the structure to and from the frame as the message handlers did
+before.  The copy only matches the DBC where the structure has the layout of
+the frame, it is the cost the bit-exact functions are compared with.
+
+The program is compiled with the host C compiler and prints the time and, on
+x86, the cycles per message of each variant.
+
+The host has a double-precision FPU, the XMC1400 has no FPU at all, so the
+gap between the variants is far larger on the target.
+
+Usage:
+    python3 Test/dbc_codegen_bench.py <C compiler> [iterations]
+"""
+
+import os
+import random
+import subprocess
+import sys
+import tempfile
+
+REPO_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+sys.path.insert(0, os.path.join(REPO_DIR, "DBC"))
+
+import dbc_codegen  # noqa: E402
+
+DBC_PATH = os.path.join(REPO_DIR, "DBC", "Lunar_CAN_Messages.dbc")
+BOARD_DIR = os.path.join(REPO_DIR, "Src", "Boards", "XMC4800_AWS")
+
+# Passes over all messages when none is given on the command line
+DEFAULT_ITERATIONS = 200000
+
+# Input values of each signal, used in turn so nothing is folded at compile time
+NUM_INPUTS = 64
+
+# The conversions of the scaled signals, (label, input table, conversion)
+VARIANTS = (
+    ("double macros", "Value", "%s_Double_toS"),
+    ("float _toS", "Value", "%s_toS"),
+    ("milli _toS_Milli", "Milli", "%s_toS_Milli"),
+)
+
+# The variant the others are compared with
+BASELINE = 0
+
+# The packing and unpacking of the messages, (label, function)
+PACKINGS = (
+    ("structure copy", "Copy"),
+    ("generated", "Generated"),
+)
+
+
+def emit_inputs(lines, message, signal, rng):
+    """Emit the input tables of a signal, values within its DBC range."""
+    prefix = "%s_%s" % (message.name, signal.name)
+    raw_min, raw_max = signal.raw_range()
+    raws = [rng.randint(raw_min, raw_max) for _ in range(NUM_INPUTS)]
+
+    if signal.is_scaled():
+        values = [raw * signal.factor + signal.offset for raw in raws]
+        lines.append("static const float %s_Value[%d] = { %s };" % (
+            prefix, NUM_INPUTS, ", ".join(dbc_codegen.format_float(value) for value in values)))
+        lines.append("static const int32_t %s_Milli[%d] = { %s };" % (
+            prefix, NUM_INPUTS, ", ".join("%d" % int(value * dbc_codegen.MILLI_SCALE) for value in values)))
+        # The replaced macros divided by the factor in double precision and truncated
+        lines.append("#define %s_Double_toS(x) ((%s)(((double)(x) - %r) / %r))" % (
+            prefix, signal.c_type(), float(signal.offset), float(signal.factor)))
+    else:
+        lines.append("static const %s %s_Raw[%d] = { %s };" % (
+            signal.c_type(), prefix, NUM_INPUTS, ", ".join(dbc_codegen.format_int(raw) for raw in raws)))
+
+
+def emit_fill(lines, message, table, conversion):
+    """Emit the statements that fill the structure of a message."""
+    for signal in message.signals:
+        prefix = "%s_%s" % (message.name, signal.name)
+        if signal.is_scaled():
+            lines.append("      signals.%s = %s(%s_%s[index]);" % (signal.name, conversion % prefix, prefix, table))
+        else:
+            lines.append("      signals.%s = %s_Raw[index];" % (signal.name, prefix))
+
+
+def generate_source(messages, iterations, rng):
+    """Build the benchmark program."""
+    lines = [
+        "#include <stdint.h>",
+        "#include <stdio.h>",
+        "#include <string.h>",
+        "#include <time.h>",
+        "#include \"ReportMgr_CAN.h\"",
+        "",
+        "#define NUM_INPUTS %dU" % NUM_INPUTS,
+        "#define NUM_ITERATIONS %dUL" % iterations,
+        "#define NUM_MESSAGES %dU" % len(messages),
+        "",
+    ]
+
+    for message in messages:
+        for signal in message.signals:
+            emit_inputs(lines, message, signal, rng)
+    lines.append("")
+
+    lines += [
+        "static uint64_t ReadCycleCounter(void)",
+        "{",
+        "#if defined(__x86_64__) || defined(__i386__)",
+        "   return(__builtin_ia32_rdtsc());",
+        "#else",
+        "   return(0U);",
+        "#endif",
+        "}",
+        "",
+        "static double ReadSeconds(void)",
+        "{",
+        "   struct timespec now;",
+        "",
+        "   clock_gettime(CLOCK_MONOTONIC, &now);",
+        "   return((double)now.tv_sec + ((double)now.tv_nsec * 1e-9));",
+        "}",
+        "",
+    ]
+
+    # One function per variant converts and packs every message
+    for number, (_, table, conversion) in enumerate(VARIANTS):
+        lines.append("__attribute__((noinline)) static uint32_t PackAll%d(const uint32_t index)" % number)
+        lines.append("{")
+        lines.append("   uint8_t data[8];")
+        lines.append("   uint32_t sum = 0U;")
+        lines.append("")
+        for message in messages:
+            lines.append("   {")
+            lines.append("      %s_t signals;" % message.name)
+            lines.append("")
+            lines.append("      memset(&signals, 0, sizeof(signals));")
+            emit_fill(lines, message, table, conversion)
+            lines.append("      %s_Pack(data, &signals);" % message.name)
+            lines.append("      sum += data[0] ^ data[%d];" % (message.dlc - 1))
+            lines.append("   }")
+        lines.append("   return(sum);")
+        lines.append("}")
+        lines.append("")
+
+    # Random frames of each message, unpacked into the structures to be packed
+    for message in messages:
+        frames = [[rng.getrandbits(8) for _ in range(message.dlc)] for _ in range(NUM_INPUTS)]
+        lines.append("static const uint8_t %s_Frames[%d][%d] =" % (message.name, NUM_INPUTS, message.dlc))
+        lines.append("{")
+        for frame in frames:
+            lines.append("   { %s }," % ", ".join("0x%02XU" % byte for byte in frame))
+        lines.append("};")
+        lines.append("static %s_t %s_Signals[%d];" % (message.name, message.name, NUM_INPUTS))
+    lines.append("")
+
+    lines.append("static void InitSignals(void)")
+    lines.append("{")
+    lines.append("   for (uint32_t i = 0U; i < NUM_INPUTS; i++)")
+    lines.append("   {")
+    for message in messages:
+        lines.append("      %s_Unpack(&%s_Signals[i], %s_Frames[i]);" % (message.name, message.name, message.name))
+    lines.append("   }")
+    lines.append("}")
+    lines.append("")
+
+    for _, function in PACKINGS:
+        lines.append("__attribute__((noinline)) static uint32_t Pack%s(const uint32_t index)" % function)
+        lines.append("{")
+        lines.append("   uint8_t data[8];")
+        lines.append("   uint32_t sum = 0U;")
+        lines.append("")
+        for message in messages:
+            if function == "Copy":
+                length = "(sizeof(%s_t) < %dU) ? sizeof(%s_t) : %dU" % (message.name, message.dlc, message.name, message.dlc)
+                lines.append("   memcpy(data, &%s_Signals[index], %s);" % (message.name, length))
+            else:
+                lines.append("   %s_Pack(data, &%s_Signals[index]);" % (message.name, message.name))
+            lines.append("   sum += data[0] ^ data[%d];" % (message.dlc - 1))
+        lines.append("   return(sum);")
+        lines.append("}")
+        lines.append("")
+
+        lines.append("__attribute__((noinline)) static uint32_t Unpack%s(const uint32_t index)" % function)
+        lines.append("{")
+        lines.append("   uint32_t sum = 0U;")
+        lines.append("")
+        for message in messages:
+            lines.append("   {")
+            lines.append("      %s_t signals;" % message.name)
+            lines.append("")
+            if function == "Copy":
+                length = "(sizeof(%s_t) < %dU) ? sizeof(%s_t) : %dU" % (message.name, message.dlc, message.name, message.dlc)
+                lines.append("      memset(&signals, 0, sizeof(signals));")
+                lines.append("      memcpy(&signals, %s_Frames[index], %s);" % (message.name, length))
+            else:
+                lines.append("      %s_Unpack(&signals, %s_Frames[index]);" % (message.name, message.name))
+            if message.signals:
+                lines.append("      sum += (uint32_t)signals.%s ^ (uint32_t)signals.%s;" % (message.signals[0].name, message.signals[-1].name))
+            else:
+                lines.append("      (void)signals;")
+            lines.append("   }")
+        lines.append("   return(sum);")
+        lines.append("}")
+        lines.append("")
+
+    lines += [
+        "static void Run(const char *const name, uint32_t (*const packAll)(const uint32_t))",
+        "{",
+        "   uint32_t sum = 0U;",
+        "   const double startSeconds = ReadSeconds();",
+        "   const uint64_t startCycles = ReadCycleCounter();",
+        "",
+        "   for (uint32_t i = 0U; i < NUM_ITERATIONS; i++)",
+        "   {",
+        "      sum += packAll(i % NUM_INPUTS);",
+        "   }",
+        "",
+        "   const uint64_t elapsedCycles = ReadCycleCounter() - startCycles;",
+        "   const double elapsedSeconds = ReadSeconds() - startSeconds;",
+        "   const double numMessages = (double)NUM_ITERATIONS * (double)NUM_MESSAGES;",
+        "",
+        "   printf(\"%s %.2f %.1f %u\\n\", name, (elapsedSeconds * 1e9) / numMessages, (double)elapsedCycles / numMessages, (unsigned)sum);",
+        "}",
+        "",
+        "int main(void)",
+        "{",
+    ]
+    lines.append("   InitSignals();")
+    for number in range(len(VARIANTS)):
+        lines.append("   Run(\"convert%d\", PackAll%d);" % (number, number))
+    for number, (_, function) in enumerate(PACKINGS):
+        lines.append("   Run(\"pack%d\", Pack%s);" % (number, function))
+        lines.append("   Run(\"unpack%d\", Unpack%s);" % (number, function))
+    lines += ["   return(0);", "}", ""]
+    return "\n".join(lines)
+
+
+def main(argv):
+    if len(argv) < 2:
+        print(__doc__)
+        return 1
+
+    compiler = argv[1]
+    iterations = int(argv[2]) if len(argv) > 2 else DEFAULT_ITERATIONS
+    messages, _ = dbc_codegen.parse_dbc(DBC_PATH)
+    source = generate_source(messages, iterations, random.Random(1))
+
+    with tempfile.TemporaryDirectory() as build_dir:
+        source_path = os.path.join(build_dir, "bench.c")
+        program_path = os.path.join(build_dir, "bench")
+        with open(source_path, "w", encoding="ascii") as source_file:
+            source_file.write(source)
+        subprocess.run([compiler, "-std=gnu99", "-O2", "-Wall", "-Werror", "-I" + BOARD_DIR,
+                        "-o", program_path, source_path], check=True)
+        output = subprocess.run([program_path], check=True, stdout=subprocess.PIPE, universal_newlines=True)
+
+    num_signals = sum(len(message.signals) for message in messages)
+    num_scaled = sum(1 for message in messages for signal in message.signals if signal.is_scaled())
+    print("%d messages, %d signals, %d scaled, %d passes" % (len(messages), num_signals, num_scaled, iterations))
+
+    results = {}
+    for line in output.stdout.splitlines():
+        name, nanoseconds, cycles, _ = line.split()
+        results[name] = (nanoseconds, cycles if float(cycles) > 0 else "-")
+
+    sections = (
+        ("conversion and pack", "convert", [label for label, _, _ in VARIANTS]),
+        ("pack", "pack", [label for label, _ in PACKINGS]),
+        ("unpack", "unpack", [label for label, _ in PACKINGS]),
+    )
+    for title, key, labels in sections:
+        print("")
+        print("%-22s %10s %12s" % (title, "ns/msg", "cycles/msg"))
+        for number, label in enumerate(labels):
+            print("%-22s %10s %12s" % (label, results["%s%d" % (key, number)][0], results["%s%d" % (key, number)][1]))
+        baseline = float(results["%s%d" % (key, BASELINE)][0])
+        for number, label in enumerate(labels):
+            nanoseconds = float(results["%s%d" % (key, number)][0])
+            if (number != BASELINE) and (baseline > 0):
+                print("%s: %.2fx the time of the %s" % (label, nanoseconds / baseline, labels[BASELINE]))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,329 @@
+#!/usr/bin/env python3
+"""Check the code generated by DBC/dbc_codegen.py.
+
+The generated headers of the boards must match DBC/Lunar_CAN_Messages.dbc, and
+every signal conversion is compiled with the host C compiler and compared
+against exact arithmetic on the DBC factor and offset.  The pack and unpack
+functions of the DBC messages, and of a test DBC with Motorola, signed and
+unaligned signals, are run on random frames and compared against a bit by bit
+reference decoder.
+
+Usage:
+    python3 Test/dbc_codegen_test.py <C compiler>
+"""
+
+import os
+import random
+import subprocess
+import sys
+import tempfile
+from fractions import Fraction
+
+REPO_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+sys.path.insert(0, os.path.join(REPO_DIR, "DBC"))
+
+import dbc_codegen  # noqa: E402
+
+DBC_PATH = os.path.join(REPO_DIR, "DBC", "Lunar_CAN_Messages.dbc")
+BOARDS = ("XMC4800_AWS", "XMC4400_Platform2Go", "XMC1400_Boot_Kit")
+
+# Raw values of a float conversion stay exact in single precision below this
+MAX_EXACT_FLOAT_RAW = 1 << 22
+
+# Largest relative error of a float conversion from a raw value
+MAX_FLOAT_ERROR = Fraction(1, 1 << 20)
+
+# Random raw values checked for each signal, in addition to the limits
+NUM_RANDOM_VALUES = 40
+
+# Random frames unpacked and packed again for each message
+NUM_RANDOM_FRAMES = 500
+
+# Signals the DBC of the boards does not use: Motorola byte order, signed and
+# unaligned signals, signals across several bytes and 32-bit signals
+TEST_DBC = """
+BO_ 2147483905 IntelMsg: 8 Vector__XXX
+ SG_ A : 3|5@1+ (1,0) [0|31] "" Vector__XXX
+ SG_ B : 8|12@1- (1,0) [-2048|2047] "" Vector__XXX
+ SG_ C : 20|20@1+ (1,0) [0|1048575] "" Vector__XXX
+ SG_ D : 47|11@0- (1,0) [-1024|1023] "" Vector__XXX
+ SG_ E : 53|9@0+ (1,0) [0|511] "" Vector__XXX
+ SG_ F : 60|4@1+ (1,0) [0|15] "" Vector__XXX
+
+BO_ 2147483906 MotorolaMsg: 8 Vector__XXX
+ SG_ G : 7|32@0+ (1,0) [0|4294967295] "" Vector__XXX
+ SG_ H : 39|32@0- (1,0) [-2147483648|2147483647] "" Vector__XXX
+
+BO_ 2147483907 ShortMsg: 3 Vector__XXX
+ SG_ I : 1|3@1- (1,0) [-4|3] "" Vector__XXX
+ SG_ J : 12|10@0+ (1,0) [0|1023] "" Vector__XXX
+ SG_ K : 16|1@1+ (1,0) [0|1] "" Vector__XXX
+"""
+
+
+def round_half_away(value):
+    """Round an exact fraction to the nearest integer, halves away from zero."""
+    magnitude = (abs(value.numerator) * 2 + value.denominator) // (2 * value.denominator)
+    return magnitude if value >= 0 else -magnitude
+
+
+def clamp(value, low, high):
+    return max(low, min(high, value))
+
+
+def compile_and_run(compiler, source, include_dirs):
+    """Build a C program and return the lines it prints."""
+    with tempfile.TemporaryDirectory() as build_dir:
+        source_path = os.path.join(build_dir, "check.c")
+        program_path = os.path.join(build_dir, "check")
+        with open(source_path, "w", encoding="ascii") as source_file:
+            source_file.write(source)
+        command = [compiler, "-std=c99", "-O1", "-Wall", "-Werror", "-o", program_path, source_path, "-lm"]
+        command += ["-I" + include_dir for include_dir in include_dirs]
+        subprocess.run(command, check=True)
+        output = subprocess.run([program_path], check=True, stdout=subprocess.PIPE, universal_newlines=True)
+    return output.stdout.splitlines()
+
+
+class Checker:
+    """Collects C expressions and what they must print."""
+
+    def __init__(self):
+        self.calls = []
+        self.num_failed = 0
+
+    def integer(self, expression, expected):
+        self.calls.append(("printf(\"%%ld\\n\", (long)(%s));" % expression, expression,
+                           lambda text, expected=expected: int(text) == expected, expected))
+
+    def real(self, expression, expected):
+        def matches(text, expected=expected):
+            error = abs(Fraction(text) - expected)
+            return error <= max(abs(expected), Fraction(1)) * MAX_FLOAT_ERROR
+        self.calls.append(("printf(\"%%.9g\\n\", (double)(%s));" % expression, expression, matches, float(expected)))
+
+    def source(self, header):
+        lines = ["#include <stdio.h>", "#include <string.h>", header, "", "int main(void)", "{"]
+        lines += ["   " + call[0] for call in self.calls]
+        lines += ["   return(0);", "}", ""]
+        return "\n".join(lines)
+
+    def check(self, output):
+        checked = [call for call in self.calls if call[1] is not None]
+        if len(output) != len(checked):
+            print("expected %d results, got %d" % (len(checked), len(output)))
+            self.num_failed += 1
+            return
+        for (_, expression, matches, expected), text in zip(checked, output):
+            if not matches(text):
+                print("%s: %s, expected %s" % (expression, text, expected))
+                self.num_failed += 1
+        print("%d conversions checked" % len(checked))
+
+
+def reference_bits(signal):
+    """The frame bits of a signal, most significant bit first.
+
+    Bits are numbered byte * 8 + bit.  A Motorola signal is counted in the
+    big endian numbering, where bit 0 is the most significant bit of byte 0,
+    and its start bit is its most significant bit.
+    """
+    if signal.little_endian:
+        return [signal.start_bit + index for index in range(signal.length - 1, -1, -1)]
+    start = (signal.start_bit // 8) * 8 + (7 - (signal.start_bit % 8))
+    big_endian = range(start, start + signal.length)
+    return [(index // 8) * 8 + (7 - (index % 8)) for index in big_endian]
+
+
+def reference_decode(signal, frame):
+    """Read a signal from the frame one bit at a time."""
+    raw = 0
+    for position in reference_bits(signal):
+        raw = (raw << 1) | ((frame[position // 8] >> (position % 8)) & 1)
+    if signal.is_signed and (raw >> (signal.length - 1)):
+        raw -= 1 << signal.length
+    return raw
+
+
+def reference_encode(signal, frame, raw):
+    """Write a signal into the frame one bit at a time."""
+    raw &= (1 << signal.length) - 1
+    for index, position in enumerate(reversed(reference_bits(signal))):
+        frame[position // 8] &= ~(1 << (position % 8)) & 0xFF
+        frame[position // 8] |= ((raw >> index) & 1) << (position % 8)
+
+
+def random_frame(message, rng):
+    """A frame of random bytes and random signals within their DBC range.
+
+    The structure fields only hold the range of the DBC, so the raw values
+    of the signals are drawn from it.
+    """
+    frame = bytearray(rng.getrandbits(8) for _ in range(message.dlc))
+    for signal in message.signals:
+        raw_min, raw_max = signal.raw_range()
+        reference_encode(signal, frame, rng.choice((raw_min, raw_max, rng.randint(raw_min, raw_max))))
+    return bytes(frame)
+
+
+def check_packing(compiler, messages, preamble, include_dirs, rng):
+    """Unpack random frames, pack them again and compare with the reference.
+
+    A packed frame must hold the bits of every signal and zero elsewhere.
+    """
+    lines = ["#include <stdint.h>", "#include <stdio.h>", "#include <string.h>", preamble, "", "int main(void)", "{"]
+    expected = []
+
+    for message in messages:
+        frames = [random_frame(message, rng) for _ in range(NUM_RANDOM_FRAMES)]
+        used = [0] * message.dlc
+        for signal in message.signals:
+            for position in reference_bits(signal):
+                used[position // 8] |= 1 << (position % 8)
+
+        lines.append("   {")
+        lines.append("      static const uint8_t frames[%d][%d] =" % (len(frames), message.dlc))
+        lines.append("      {")
+        for frame in frames:
+            lines.append("         { %s }," % ", ".join("0x%02XU" % byte for byte in frame))
+        lines.append("      };")
+        lines.append("")
+        lines.append("      for (int i = 0; i < %d; i++)" % len(frames))
+        lines.append("      {")
+        lines.append("         %s_t signals;" % message.name)
+        lines.append("         uint8_t data[%d];" % message.dlc)
+        lines.append("")
+        lines.append("         memset(&signals, 0, sizeof(signals));")
+        lines.append("         %s_Unpack(&signals, frames[i]);" % message.name)
+        for signal in message.signals:
+            lines.append("         printf(\"%%lld\\n\", (long long)signals.%s);" % signal.name)
+        lines.append("         %s_Pack(data, &signals);" % message.name)
+        lines.append("         for (int j = 0; j < %d; j++)" % message.dlc)
+        lines.append("         {")
+        lines.append("            printf(\"%02x\", data[j]);")
+        lines.append("         }")
+        lines.append("         printf(\"\\n\");")
+        lines.append("      }")
+        lines.append("   }")
+
+        for frame in frames:
+            for signal in message.signals:
+                expected.append(("%s.%s of %s" % (message.name, signal.name, frame.hex()), str(reference_decode(signal, frame))))
+            packed = bytes(byte & mask for byte, mask in zip(frame, used))
+            expected.append(("%s packed from %s" % (message.name, frame.hex()), packed.hex()))
+
+    lines += ["   return(0);", "}", ""]
+    output = compile_and_run(compiler, "\n".join(lines), include_dirs)
+
+    num_failed = 0
+    if len(output) != len(expected):
+        print("expected %d results, got %d" % (len(expected), len(output)))
+        return 1
+    for (label, value), text in zip(expected, output):
+        if text != value:
+            print("%s: %s, expected %s" % (label, text, value))
+            num_failed += 1
+    print("%d frames of %d messages unpacked and packed" % (NUM_RANDOM_FRAMES * len(messages), len(messages)))
+    return num_failed
+
+
+def check_generated_headers(messages, value_tables):
+    """The headers in the tree must be what the generator makes of the DBC."""
+    header = dbc_codegen.generate_header(messages, value_tables, "DBC/Lunar_CAN_Messages.dbc")
+    num_failed = 0
+    for board in BOARDS:
+        path = os.path.join(REPO_DIR, "Src", "Boards", board, "ReportMgr_CANSignals.h")
+        with open(path, "r", encoding="ascii") as header_file:
+            if header_file.read() != header:
+                print("%s is not generated from the DBC, run DBC/dbc_codegen.py" % path)
+                num_failed += 1
+    return num_failed
+
+
+def add_conversion_checks(checker, message, signal, rng):
+    """Check the conversions of a scaled signal at its limits and random values."""
+    prefix = "%s_%s" % (message.name, signal.name)
+    raw_min, raw_max = signal.raw_range()
+    milli_per_raw = signal.factor * dbc_codegen.MILLI_SCALE
+    offset_milli = signal.offset * dbc_codegen.MILLI_SCALE
+
+    # The limits, zero and 3.01 units, which used to truncate to one step below
+    raws = {raw_min, raw_max, clamp(0, raw_min, raw_max)}
+    raws.add(clamp(round_half_away((Fraction("3.01") - signal.offset) / signal.factor), raw_min, raw_max))
+    raws |= {rng.randint(raw_min, raw_max) for _ in range(NUM_RANDOM_VALUES)}
+
+    for raw in sorted(raws):
+        value = raw * signal.factor + signal.offset
+        milli = int(value * dbc_codegen.MILLI_SCALE)
+
+        # Raw to value
+        checker.real("%s_fromS(%d)" % (prefix, raw), value)
+        checker.integer("%s_fromS_Milli(%d)" % (prefix, raw), milli)
+
+        # Value to raw, exact and within less than half a step
+        if abs(raw) < MAX_EXACT_FLOAT_RAW:
+            for fraction in (Fraction(0), Fraction(3, 10), Fraction(-3, 10)):
+                expected = clamp(raw + round_half_away(fraction), raw_min, raw_max)
+                checker.integer("%s_toS(%s)" % (prefix, dbc_codegen.format_float(value + fraction * signal.factor)), expected)
+
+        # Milli-units to raw, rounded half away from zero
+        step = int(milli_per_raw)
+        for delta in sorted({0, step // 2, -(step // 2), (step - 1) // 2, -((step - 1) // 2)}):
+            expected = clamp(round_half_away(Fraction(milli + delta - int(offset_milli), step)), raw_min, raw_max)
+            if -(1 << 31) <= milli + delta < (1 << 31):
+                checker.integer("%s_toS_Milli(%d)" % (prefix, milli + delta), expected)
+
+    # Values outside the signal range are clamped
+    span = (raw_max - raw_min + 1) * signal.factor
+    for value, expected in ((raw_max * signal.factor + signal.offset + span, raw_max),
+                            (raw_min * signal.factor + signal.offset - span, raw_min)):
+        if abs(value / signal.factor) < MAX_EXACT_FLOAT_RAW:
+            checker.integer("%s_toS(%s)" % (prefix, dbc_codegen.format_float(value)), expected)
+        if abs(value * dbc_codegen.MILLI_SCALE) < (1 << 31):
+            checker.integer("%s_toS_Milli(%d)" % (prefix, int(value * dbc_codegen.MILLI_SCALE)), expected)
+
+
+def main(argv):
+    if len(argv) < 2:
+        print(__doc__)
+        return 1
+
+    compiler = argv[1]
+    rng = random.Random(1)
+    messages, value_tables = dbc_codegen.parse_dbc(DBC_PATH)
+    num_failed = check_generated_headers(messages, value_tables)
+
+    # Conversions of every scaled signal of the DBC
+    checker = Checker()
+    for message in messages:
+        for signal in message.signals:
+            if signal.is_scaled():
+                add_conversion_checks(checker, message, signal, rng)
+    board_dir = os.path.join(REPO_DIR, "Src", "Boards", BOARDS[0])
+    checker.check(compile_and_run(compiler, checker.source("#include \"ReportMgr_CAN.h\""), [board_dir]))
+    num_failed += checker.num_failed
+
+    # Packing of the DBC messages with the structures of the boards
+    num_failed += check_packing(compiler, messages, "#include \"ReportMgr_CAN.h\"", [board_dir], rng)
+
+    # Packing of the test DBC, with structures that just hold the raw values
+    with tempfile.TemporaryDirectory() as build_dir:
+        dbc_path = os.path.join(build_dir, "test.dbc")
+        with open(dbc_path, "w", encoding="ascii") as dbc_file:
+            dbc_file.write(TEST_DBC)
+        test_messages, test_value_tables = dbc_codegen.parse_dbc(dbc_path)
+
+        with open(os.path.join(build_dir, "TestSignals.h"), "w", encoding="ascii") as header_file:
+            for message in test_messages:
+                fields = " ".join("%s %s;" % (signal.c_type(), signal.name) for signal in message.signals)
+                header_file.write("typedef struct { %s } %s_t;\n" % (fields, message.name))
+            header_file.write(dbc_codegen.generate_header(test_messages, test_value_tables, "test.dbc"))
+
+        num_failed += check_packing(compiler, test_messages, "#include \"TestSignals.h\"", [build_dir], rng)
+
+    print("%d failed" % num_failed)
+    return 1 if num_failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))